@@ -27,6 +27,7 @@ public class Mcro : ModuleRules
 		{
 			"Core",
 			"RenderCore",
+			"RHI",
 			"ApplicationCore",
 			"Projects",
 			"Slate",
@@ -40,6 +41,14 @@ public class Mcro : ModuleRules
 		});
 			
 		
+		// Thread-local caching of small Ansi::New objects, it has to be the same for every module
+		PublicDefinitions.Add("MCRO_ANSI_THREAD_CACHE=0");
+
+		// Counters, trace hooks and the flight recorder (see Mcro/Instrumentation.h), compiled out of Shipping
+		PublicDefinitions.Add(
+			"MCRO_INSTRUMENTATION_ENABLED=" + (Target.Configuration == UnrealTargetConfiguration.Shipping ? "0" : "1")
+		);
+
 		PrivateDependencyModuleNames.AddRange(new[]
 		{
 			"CoreUObject",
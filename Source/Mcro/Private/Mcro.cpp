@@ -10,7 +10,48 @@
  */
 
 #include "Modules/ModuleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "Mcro/Threading.h"
+#include "Mcro/Threading/Lanes.h"
+#include "Mcro/Observable/Coalescing.h"
+#include "Mcro/Subsystems.h"
+#include "Mcro/Rendering/RenderState.h"
+#include "Mcro/Rendering/TextureConversion.h"
+#include "Mcro/Rendering/UploadRing.h"
+#include "Mcro/FlightRecorder.h"
+#include "Mcro/Text/StructuredLog.h"
 
-class FMcroModule : public IModuleInterface {};
+class FMcroModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		Mcro::Rendering::Textures::Detail::RegisterShaderDirectory();
+		OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddLambda([]
+		{
+			// Queued game thread work may enqueue render commands, so drain it before flushing the batch
+			Mcro::Threading::Detail::DrainGameThreadQueue();
+			Mcro::Observable::Detail::FlushCoalescedNotifications();
+			Mcro::Rendering::Detail::FlushRenderStateFlips();
+			Mcro::Threading::FlushRenderCommandBatch();
+		});
+		Mcro::Subsystems::Detail::StartSubsystemCacheInvalidation();
+		Mcro::FlightRecorder::Detail::StartFlightRecorderCrashDump();
+		Mcro::Text::Detail::StartStructuredLog();
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+		Mcro::Threading::Detail::ShutdownWorkLanes();
+		Mcro::Subsystems::Detail::StopSubsystemCacheInvalidation();
+		Mcro::FlightRecorder::Detail::StopFlightRecorderCrashDump();
+		Mcro::Text::Detail::StopStructuredLog();
+		Mcro::Rendering::Textures::Detail::ReleaseSharedUploadRings();
+	}
+
+private:
+	FDelegateHandle OnEndFrameHandle;
+};
 
 IMPLEMENT_MODULE(FMcroModule, Mcro);
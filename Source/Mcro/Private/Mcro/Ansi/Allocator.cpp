@@ -27,11 +27,14 @@ namespace Mcro::Ansi
 				Detail::OnInvalidAnsiAllocatorNum(newMax, numBytesPerElement);
 			}
 
-			void* NewRealloc = ::realloc(Data, newMax*numBytesPerElement);
+			void* NewRealloc = Detail::TrackedRealloc(
+				Data, newMax*numBytesPerElement, { .ProgramCounter = PLATFORM_RETURN_ADDRESS() }
+			);
 			Data = (FScriptContainerElement*)NewRealloc;
 		}
 		else
 		{
+			Detail::TrackFree(Data);
 			::free(Data);
 			Data = nullptr;
 		}
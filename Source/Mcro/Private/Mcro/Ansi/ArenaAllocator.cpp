@@ -0,0 +1,198 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Ansi/ArenaAllocator.h"
+#include "Mcro/TextMacros.h"
+
+namespace Mcro::Ansi
+{
+	namespace
+	{
+		thread_local FArena* GCurrentArena = nullptr;
+	}
+
+	FArena::FArena(SIZE_T blockSize)
+		: BlockSize(blockSize)
+	{}
+
+	FArena::~FArena()
+	{
+		for (FBlock const& block : Blocks)
+		{
+			Detail::TrackFree(block.Memory);
+			::free(block.Memory);
+		}
+	}
+
+	void* FArena::Allocate(SIZE_T size, SIZE_T alignment)
+	{
+		for (;;)
+		{
+			if (CurrentBlock < Blocks.Num())
+			{
+				FBlock const& block = Blocks[CurrentBlock];
+				uint8* start = Align(block.Memory + Offset, alignment);
+				if (start + size <= block.Memory + block.Size)
+				{
+					Offset = start + size - block.Memory;
+					return start;
+				}
+				if (Offset == 0 && CurrentBlock == Blocks.Num() - 1)
+				{
+					// An empty last block which is still too small, replace it with one large enough
+					Detail::TrackFree(block.Memory);
+					::free(block.Memory);
+					Blocks.Pop();
+					continue;
+				}
+				++CurrentBlock;
+				Offset = 0;
+				continue;
+			}
+
+			const SIZE_T newSize = FMath::Max(BlockSize, size + alignment);
+			uint8* memory = static_cast<uint8*>(::malloc(newSize));
+			Detail::TrackAlloc(memory, newSize, DEFAULT_ALIGNMENT, { .Name = TEXT_"Mcro::Ansi::FArena" });
+			Blocks.Add({ memory, newSize });
+			CurrentBlock = Blocks.Num() - 1;
+			Offset = 0;
+		}
+	}
+
+	bool FArena::Resize(void* data, SIZE_T size, SIZE_T newSize)
+	{
+		if (CurrentBlock >= Blocks.Num()) return false;
+		FBlock const& block = Blocks[CurrentBlock];
+		uint8* start = static_cast<uint8*>(data);
+		if (start + size != block.Memory + Offset || start + newSize > block.Memory + block.Size)
+			return false;
+
+		Offset = start + newSize - block.Memory;
+		return true;
+	}
+
+	void FArena::Free(void* data, SIZE_T size)
+	{
+		if (CurrentBlock >= Blocks.Num()) return;
+		FBlock const& block = Blocks[CurrentBlock];
+		uint8* start = static_cast<uint8*>(data);
+		if (start + size == block.Memory + Offset)
+			Offset = start - block.Memory;
+	}
+
+	void FArena::Rewind(FMark const& mark)
+	{
+		CurrentBlock = mark.Block;
+		Offset = mark.Offset;
+		++Epoch;
+	}
+
+	SIZE_T FArena::GetReservedBytes() const
+	{
+		SIZE_T result = 0;
+		for (FBlock const& block : Blocks)
+			result += block.Size;
+		return result;
+	}
+
+	FArena* FArena::GetCurrent()
+	{
+		return GCurrentArena;
+	}
+
+	FArenaScope::FArenaScope(FArena& arena)
+		: Arena(arena)
+		, Previous(GCurrentArena)
+		, Mark(arena.GetMark())
+	{
+		GCurrentArena = &arena;
+	}
+
+	FArenaScope::~FArenaScope()
+	{
+		Arena.Rewind(Mark);
+		GCurrentArena = Previous;
+	}
+
+	void FArenaAllocator::ForAnyElementType::MoveToEmpty(ForAnyElementType& other)
+	{
+		check(this != &other);
+		FreeAllocation();
+
+		Data = Exchange(other.Data, nullptr);
+		Arena = Exchange(other.Arena, nullptr);
+		Epoch = other.Epoch;
+		AllocatedBytes = Exchange(other.AllocatedBytes, 0);
+	}
+
+	void FArenaAllocator::ForAnyElementType::FreeAllocation()
+	{
+		if (!Data) return;
+		if (!Arena)
+		{
+			Detail::TrackFree(Data);
+			::free(Data);
+		}
+		else if (IsLiveInArena()) Arena->Free(Data, AllocatedBytes);
+
+		Data = nullptr;
+		Arena = nullptr;
+		AllocatedBytes = 0;
+	}
+
+	void FArenaAllocator::ForAnyElementType::ResizeAllocation(SizeType currentNum, SizeType newMax, SIZE_T numBytesPerElement)
+	{
+		if (!newMax)
+		{
+			FreeAllocation();
+			return;
+		}
+
+		// Check for under/overflow
+		if (UNLIKELY(newMax < 0 || numBytesPerElement < 1 || numBytesPerElement > (SIZE_T)MAX_int32))
+		{
+			Detail::OnInvalidAnsiAllocatorNum(newMax, numBytesPerElement);
+		}
+
+		const SIZE_T newBytes = newMax * numBytesPerElement;
+		if (IsLiveInArena() && Arena->Resize(Data, AllocatedBytes, newBytes))
+		{
+			AllocatedBytes = newBytes;
+			return;
+		}
+
+		FArena* current = FArena::GetCurrent();
+		if (!current && !Arena)
+		{
+			void* newData = Detail::TrackedRealloc(Data, newBytes, { .ProgramCounter = PLATFORM_RETURN_ADDRESS() });
+			Data = static_cast<FScriptContainerElement*>(newData);
+			AllocatedBytes = newBytes;
+			return;
+		}
+
+		void* newData = current
+			? current->Allocate(newBytes)
+			: ::malloc(newBytes);
+
+		if (!current)
+			Detail::TrackAlloc(newData, newBytes, DEFAULT_ALIGNMENT, { .ProgramCounter = PLATFORM_RETURN_ADDRESS() });
+
+		if (Data)
+		{
+			FMemory::Memcpy(newData, Data, FMath::Min<SIZE_T>(currentNum * numBytesPerElement, newBytes));
+			FreeAllocation();
+		}
+		Data = static_cast<FScriptContainerElement*>(newData);
+		Arena = current;
+		Epoch = current ? current->GetEpoch() : 0;
+		AllocatedBytes = newBytes;
+	}
+}
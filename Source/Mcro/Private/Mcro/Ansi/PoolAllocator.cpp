@@ -0,0 +1,161 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Ansi/PoolAllocator.h"
+#include "Mcro/Ansi/New.h"
+#include "Mcro/TextMacros.h"
+#include "Misc/ScopeLock.h"
+
+namespace Mcro::Ansi
+{
+	FPool& FPool::Get()
+	{
+		static FPool& pool = *Ansi::New<FPool>();
+		return pool;
+	}
+
+	int32 FPool::GetSizeClass(SIZE_T size)
+	{
+		if (size > GetSizeClassBytes(SizeClassCount - 1)) return INDEX_NONE;
+		const int32 log2 = static_cast<int32>(FMath::CeilLogTwo64(static_cast<uint64>(size)));
+		return FMath::Max(log2 - MinSizeClass, 0);
+	}
+
+	void* FPool::Allocate(int32 sizeClass)
+	{
+		FBucket& bucket = Buckets[sizeClass];
+		{
+			FScopeLock lock(&bucket.Lock);
+			if (FFreeBlock* block = bucket.Head)
+			{
+				bucket.Head = block->Next;
+				--bucket.Count;
+				return block;
+			}
+		}
+		void* result = ::malloc(GetSizeClassBytes(sizeClass));
+		Detail::TrackAlloc(result, GetSizeClassBytes(sizeClass), DEFAULT_ALIGNMENT, { .Name = TEXT_"Mcro::Ansi::FPool" });
+		return result;
+	}
+
+	void FPool::Free(void* data, int32 sizeClass)
+	{
+		FBucket& bucket = Buckets[sizeClass];
+		FFreeBlock* block = static_cast<FFreeBlock*>(data);
+
+		FScopeLock lock(&bucket.Lock);
+		block->Next = bucket.Head;
+		bucket.Head = block;
+		++bucket.Count;
+	}
+
+	void FPool::Trim()
+	{
+		for (FBucket& bucket : Buckets)
+		{
+			FFreeBlock* head;
+			{
+				FScopeLock lock(&bucket.Lock);
+				head = Exchange(bucket.Head, nullptr);
+				bucket.Count = 0;
+			}
+			while (head)
+			{
+				FFreeBlock* block = Exchange(head, head->Next);
+				Detail::TrackFree(block);
+				::free(block);
+			}
+		}
+	}
+
+	SIZE_T FPool::GetPooledBytes() const
+	{
+		SIZE_T result = 0;
+		for (int32 i = 0; i < SizeClassCount; ++i)
+		{
+			FScopeLock lock(&Buckets[i].Lock);
+			result += Buckets[i].Count * GetSizeClassBytes(i);
+		}
+		return result;
+	}
+
+	FPoolAllocator::SizeType FPoolAllocator::ForAnyElementType::FillSizeClass(SizeType max, SIZE_T numBytesPerElement)
+	{
+		const int32 sizeClass = FPool::GetSizeClass(max * numBytesPerElement);
+		if (sizeClass == INDEX_NONE) return max;
+		return FMath::Max(max, static_cast<SizeType>(FPool::GetSizeClassBytes(sizeClass) / numBytesPerElement));
+	}
+
+	void FPoolAllocator::ForAnyElementType::MoveToEmpty(ForAnyElementType& other)
+	{
+		check(this != &other);
+		FreeAllocation();
+
+		Data = Exchange(other.Data, nullptr);
+		SizeClass = Exchange(other.SizeClass, INDEX_NONE);
+	}
+
+	void FPoolAllocator::ForAnyElementType::FreeAllocation()
+	{
+		if (!Data) return;
+		if (SizeClass != INDEX_NONE) FPool::Get().Free(Data, SizeClass);
+		else
+		{
+			Detail::TrackFree(Data);
+			::free(Data);
+		}
+
+		Data = nullptr;
+		SizeClass = INDEX_NONE;
+	}
+
+	void FPoolAllocator::ForAnyElementType::ResizeAllocation(SizeType currentNum, SizeType newMax, SIZE_T numBytesPerElement)
+	{
+		if (!newMax)
+		{
+			FreeAllocation();
+			return;
+		}
+
+		// Check for under/overflow
+		if (UNLIKELY(newMax < 0 || numBytesPerElement < 1 || numBytesPerElement > (SIZE_T)MAX_int32))
+		{
+			Detail::OnInvalidAnsiAllocatorNum(newMax, numBytesPerElement);
+		}
+
+		const SIZE_T newBytes = newMax * numBytesPerElement;
+		const int32 newSizeClass = FPool::GetSizeClass(newBytes);
+		if (Data && newSizeClass == SizeClass)
+		{
+			if (SizeClass == INDEX_NONE)
+			{
+				void* newData = Detail::TrackedRealloc(Data, newBytes, { .ProgramCounter = PLATFORM_RETURN_ADDRESS() });
+				Data = static_cast<FScriptContainerElement*>(newData);
+			}
+			return;
+		}
+
+		void* newData = newSizeClass != INDEX_NONE
+			? FPool::Get().Allocate(newSizeClass)
+			: ::malloc(newBytes);
+
+		if (newSizeClass == INDEX_NONE)
+			Detail::TrackAlloc(newData, newBytes, DEFAULT_ALIGNMENT, { .ProgramCounter = PLATFORM_RETURN_ADDRESS() });
+
+		if (Data)
+		{
+			FMemory::Memcpy(newData, Data, FMath::Min<SIZE_T>(currentNum * numBytesPerElement, newBytes));
+			FreeAllocation();
+		}
+		Data = static_cast<FScriptContainerElement*>(newData);
+		SizeClass = newSizeClass;
+	}
+}
@@ -0,0 +1,230 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Ansi/New.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+namespace Mcro::Ansi::Detail
+{
+	namespace
+	{
+		struct FThreadCache;
+
+		/** @brief Size classes of blocks including their header: 32, 64, 128, 256 and 512 bytes */
+		constexpr int32 SizeClassCount = 5;
+		constexpr SIZE_T MinBlockSize = 32;
+		constexpr SIZE_T MaxBlockSize = MinBlockSize << (SizeClassCount - 1);
+		constexpr SIZE_T CachedAlignment = 16;
+
+		/** @brief A thread keeps at most this many free blocks per size class, the rest goes back to the system */
+		constexpr int32 MaxFreeBlocksPerClass = 256;
+
+		constexpr uint16 Uncached = 0xFFFF;
+
+		/** @brief Precedes every object from CachedMalloc */
+		struct alignas(CachedAlignment) FHeader
+		{
+			union
+			{
+				/** @brief The thread cache owning a live block */
+				FThreadCache* Owner;
+
+				/** @brief Next block in a free list */
+				FHeader* NextFree;
+			};
+
+			uint16 SizeClass;
+
+			/** @brief Distance of the object from the start of the system allocation */
+			uint16 Offset;
+		};
+		static_assert(sizeof(FHeader) == CachedAlignment);
+
+		struct FThreadCache
+		{
+			FHeader* Free[SizeClassCount] {};
+			int32 FreeCount[SizeClassCount] {};
+
+			/** @brief Blocks of this cache deleted on other threads */
+			std::atomic<FHeader*> RemoteFree { nullptr };
+
+			FThreadCache* NextOrphan = nullptr;
+		};
+
+		/**
+		 *	@brief
+		 *	Caches of exited threads. Objects allocated by those threads may still be alive and deleted any time, so
+		 *	caches are never destroyed, instead new threads adopt them.
+		 */
+		struct FOrphans
+		{
+			FCriticalSection Lock;
+			FThreadCache* Head = nullptr;
+		};
+
+		FOrphans& GetOrphans()
+		{
+			static FOrphans& orphans = *new (AnsiMalloc(sizeof(FOrphans), alignof(FOrphans))) FOrphans();
+			return orphans;
+		}
+
+		constexpr SIZE_T GetBlockSize(int32 sizeClass) { return MinBlockSize << sizeClass; }
+
+		int32 GetSizeClass(SIZE_T blockSize)
+		{
+			int32 sizeClass = 0;
+			while (GetBlockSize(sizeClass) < blockSize) ++sizeClass;
+			return sizeClass;
+		}
+
+		void PushLocal(FThreadCache& cache, FHeader* block)
+		{
+			const int32 sizeClass = block->SizeClass;
+			if (cache.FreeCount[sizeClass] >= MaxFreeBlocksPerClass)
+			{
+				AnsiFree(block);
+				return;
+			}
+			block->NextFree = cache.Free[sizeClass];
+			cache.Free[sizeClass] = block;
+			++cache.FreeCount[sizeClass];
+		}
+
+		void DrainRemoteFree(FThreadCache& cache)
+		{
+			FHeader* block = cache.RemoteFree.exchange(nullptr, std::memory_order_acquire);
+			while (block)
+				PushLocal(cache, Exchange(block, block->NextFree));
+		}
+
+		void ReleaseCache(FThreadCache* cache)
+		{
+			DrainRemoteFree(*cache);
+			for (int32 i = 0; i < SizeClassCount; ++i)
+			{
+				while (FHeader* block = cache->Free[i])
+				{
+					cache->Free[i] = block->NextFree;
+					AnsiFree(block);
+				}
+				cache->FreeCount[i] = 0;
+			}
+
+			auto& orphans = GetOrphans();
+			FScopeLock lock(&orphans.Lock);
+			cache->NextOrphan = orphans.Head;
+			orphans.Head = cache;
+		}
+
+		FThreadCache* AdoptCache()
+		{
+			{
+				auto& orphans = GetOrphans();
+				FScopeLock lock(&orphans.Lock);
+				if (FThreadCache* cache = orphans.Head)
+				{
+					orphans.Head = Exchange(cache->NextOrphan, nullptr);
+					return cache;
+				}
+			}
+			return new (AnsiMalloc(sizeof(FThreadCache), alignof(FThreadCache))) FThreadCache();
+		}
+
+		struct FThreadCacheHolder
+		{
+			FThreadCache* Cache = nullptr;
+
+			/** @brief Objects deleted by other thread_local destructors after this one go through RemoteFree */
+			bool bDestroyed = false;
+
+			~FThreadCacheHolder()
+			{
+				if (Cache) ReleaseCache(Cache);
+				bDestroyed = true;
+			}
+
+			FThreadCache* Get()
+			{
+				if (!Cache && !bDestroyed) [[unlikely]] Cache = AdoptCache();
+				return Cache;
+			}
+		};
+
+		thread_local FThreadCacheHolder GThreadCache;
+
+		void* UncachedMalloc(SIZE_T size, SIZE_T alignment)
+		{
+			const SIZE_T offset = Align(sizeof(FHeader), alignment);
+			uint8* memory = static_cast<uint8*>(AnsiMalloc(offset + size, FMath::Max(alignment, CachedAlignment)));
+			FHeader* header = reinterpret_cast<FHeader*>(memory + offset) - 1;
+			header->Owner = nullptr;
+			header->SizeClass = Uncached;
+			header->Offset = static_cast<uint16>(offset);
+			return memory + offset;
+		}
+	}
+
+	void* CachedMalloc(SIZE_T size, SIZE_T alignment)
+	{
+		const SIZE_T blockSize = size + sizeof(FHeader);
+		if (alignment > CachedAlignment || blockSize > MaxBlockSize)
+			return UncachedMalloc(size, alignment);
+
+		FThreadCache* cache = GThreadCache.Get();
+		if (!cache) [[unlikely]]
+			return UncachedMalloc(size, alignment);
+
+		const int32 sizeClass = GetSizeClass(blockSize);
+		FHeader* block = cache->Free[sizeClass];
+		if (!block)
+		{
+			DrainRemoteFree(*cache);
+			block = cache->Free[sizeClass];
+		}
+
+		if (block)
+		{
+			cache->Free[sizeClass] = block->NextFree;
+			--cache->FreeCount[sizeClass];
+		}
+		else block = static_cast<FHeader*>(AnsiMalloc(GetBlockSize(sizeClass), CachedAlignment));
+
+		block->Owner = cache;
+		block->SizeClass = static_cast<uint16>(sizeClass);
+		block->Offset = sizeof(FHeader);
+		return block + 1;
+	}
+
+	void CachedFree(void* ptr)
+	{
+		if (!ptr) return;
+		FHeader* header = static_cast<FHeader*>(ptr) - 1;
+		if (header->SizeClass == Uncached)
+		{
+			AnsiFree(static_cast<uint8*>(ptr) - header->Offset);
+			return;
+		}
+
+		FThreadCache* owner = header->Owner;
+		if (owner == GThreadCache.Cache && !GThreadCache.bDestroyed) [[likely]]
+		{
+			PushLocal(*owner, header);
+			return;
+		}
+
+		// Deleted on another thread, give it back to its owner
+		FHeader* head = owner->RemoteFree.load(std::memory_order_relaxed);
+		do header->NextFree = head;
+		while (!owner->RemoteFree.compare_exchange_weak(head, header, std::memory_order_release, std::memory_order_relaxed));
+	}
+}
@@ -0,0 +1,305 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Ansi/Tracking.h"
+#include "Mcro/TextMacros.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformStackWalk.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/MemoryTrace.h"
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+LLM_DEFINE_TAG(McroAnsi);
+#endif
+
+static TAutoConsoleVariable<bool> CVarTrackAnsiAllocations(
+	TEXT_"Mcro.Ansi.TrackAllocations", false,
+	TEXT_"Report memory allocated by Ansi::New and the Ansi container allocators to LLM and memory traces.",
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* cvar)
+	{
+		Mcro::Ansi::SetAllocationTracking(cvar->GetBool());
+	}),
+	ECVF_Default
+);
+
+namespace Mcro::Ansi
+{
+	std::atomic<uint32> Detail::GTrackingState { Detail::TrackingDisabled };
+
+	namespace
+	{
+		using namespace Detail;
+
+		/** @brief Site names are static strings, so they're identified by their address */
+		struct FSiteKey
+		{
+			const TCHAR* Name = nullptr;
+			int32 NameLength = 0;
+			const void* ProgramCounter = nullptr;
+
+			FSiteKey() = default;
+			FSiteKey(FAllocationSite const& site)
+				: Name(site.Name.GetData())
+				, NameLength(site.Name.Len())
+				, ProgramCounter(site.ProgramCounter)
+			{}
+
+			friend bool operator == (FSiteKey const&, FSiteKey const&) = default;
+			friend uint32 GetTypeHash(FSiteKey const& key)
+			{
+				return HashCombineFast(PointerHash(key.Name), PointerHash(key.ProgramCounter));
+			}
+		};
+
+		struct FSiteCounters
+		{
+			int64 Allocations = 0;
+			int64 LiveAllocations = 0;
+			int64 LiveBytes = 0;
+			int64 PeakBytes = 0;
+		};
+
+		struct FRecord
+		{
+			SIZE_T Size;
+			FSiteKey Site;
+		};
+
+		/**
+		 *	@brief
+		 *	Bookkeeping of tracked allocations. Its containers use FMemory, so tracking Ansi allocations doesn't
+		 *	recurse into itself.
+		 */
+		struct FTrackingRegistry
+		{
+			FCriticalSection Lock;
+			TMap<void*, FRecord> Records;
+#if MCRO_ANSI_ALLOCATION_SITES
+			TMap<FSiteKey, FSiteCounters> Sites;
+#endif
+		};
+
+		FTrackingRegistry& GetRegistry()
+		{
+			// Ansi allocations may be freed during static destruction, keep the registry alive until the very end
+			static FTrackingRegistry& registry = *new FTrackingRegistry();
+			return registry;
+		}
+
+		void ReportAlloc(void* ptr, SIZE_T size, uint32 alignment)
+		{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+			LLM_SCOPE_BYTAG(McroAnsi);
+			LLM_IF_ENABLED(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Default, ptr, size));
+#endif
+#if UE_MEMORY_TRACE_ENABLED
+			MemoryTrace_Alloc(reinterpret_cast<uint64>(ptr), size, alignment);
+#endif
+		}
+
+		void ReportFree(void* ptr)
+		{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+			LLM_IF_ENABLED(FLowLevelMemTracker::Get().OnLowLevelFree(ELLMTracker::Default, ptr));
+#endif
+#if UE_MEMORY_TRACE_ENABLED
+			MemoryTrace_Free(reinterpret_cast<uint64>(ptr));
+#endif
+		}
+
+		void ReportRealloc(void* oldPtr, void* newPtr, SIZE_T size)
+		{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+			LLM_SCOPE_BYTAG(McroAnsi);
+			LLM_IF_ENABLED(FLowLevelMemTracker::Get().OnLowLevelFree(ELLMTracker::Default, oldPtr));
+			LLM_IF_ENABLED(FLowLevelMemTracker::Get().OnLowLevelAlloc(ELLMTracker::Default, newPtr, size));
+#endif
+#if UE_MEMORY_TRACE_ENABLED
+			MemoryTrace_ReallocFree(reinterpret_cast<uint64>(oldPtr));
+			MemoryTrace_ReallocAlloc(reinterpret_cast<uint64>(newPtr), size, DEFAULT_ALIGNMENT);
+#endif
+		}
+
+		/** @brief A tracked allocation was resized (maybe moved), it's still the same allocation of the same site */
+		void ResizeRecord(FTrackingRegistry& registry, void* oldPtr, void* newPtr, SIZE_T size)
+		{
+			FRecord record;
+			verify(registry.Records.RemoveAndCopyValue(oldPtr, record));
+#if MCRO_ANSI_ALLOCATION_SITES
+			if (FSiteCounters* counters = registry.Sites.Find(record.Site))
+			{
+				counters->LiveBytes += static_cast<int64>(size) - static_cast<int64>(record.Size);
+				if (size > record.Size)
+					counters->PeakBytes = FMath::Max(counters->PeakBytes, counters->LiveBytes);
+			}
+#endif
+			record.Size = size;
+			registry.Records.Add(newPtr, record);
+		}
+
+		void AddRecord(FTrackingRegistry& registry, void* ptr, SIZE_T size, FSiteKey const& site)
+		{
+			registry.Records.Add(ptr, { size, site });
+#if MCRO_ANSI_ALLOCATION_SITES
+			FSiteCounters& counters = registry.Sites.FindOrAdd(site);
+			++counters.Allocations;
+			++counters.LiveAllocations;
+			counters.LiveBytes += size;
+			counters.PeakBytes = FMath::Max(counters.PeakBytes, counters.LiveBytes);
+#endif
+		}
+
+		/** @returns False if ptr was not tracked */
+		bool RemoveRecord(FTrackingRegistry& registry, void* ptr)
+		{
+			FRecord record;
+			if (!registry.Records.RemoveAndCopyValue(ptr, record)) return false;
+#if MCRO_ANSI_ALLOCATION_SITES
+			if (FSiteCounters* counters = registry.Sites.Find(record.Site))
+			{
+				--counters->LiveAllocations;
+				counters->LiveBytes -= record.Size;
+			}
+#endif
+			// The last tracked allocation of a disabled tracking is gone, the fast path can skip frees again
+			if (registry.Records.IsEmpty())
+			{
+				uint32 draining = TrackingDraining;
+				GTrackingState.compare_exchange_strong(draining, TrackingDisabled, std::memory_order_relaxed);
+			}
+			return true;
+		}
+
+		FString GetSiteName(FSiteKey const& site)
+		{
+			if (site.Name) return FString::ConstructFromPtrSize(site.Name, site.NameLength);
+
+			ANSICHAR symbol[1024] = {};
+			FPlatformStackWalk::ProgramCounterToHumanReadableString(
+				0, reinterpret_cast<uint64>(site.ProgramCounter), symbol, sizeof(symbol)
+			);
+			return ANSI_TO_TCHAR(symbol);
+		}
+
+#if MCRO_ANSI_ALLOCATION_SITES
+		FAutoConsoleCommandWithOutputDevice GDumpAllocationSitesCommand {
+			TEXT_"Mcro.Ansi.DumpAllocationSites",
+			TEXT_"List Ansi allocation sites ordered by their live bytes (needs Mcro.Ansi.TrackAllocations 1).",
+			FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& output)
+			{
+				TArray<FAllocationSiteStats> stats = GetAllocationSiteStats();
+				stats.Sort([](FAllocationSiteStats const& l, FAllocationSiteStats const& r)
+				{
+					return l.LiveBytes > r.LiveBytes;
+				});
+				output.Logf(TEXT_"%12s %12s %12s %12s  Site", TEXT_"Live bytes", TEXT_"Peak bytes", TEXT_"Live", TEXT_"Total");
+				for (FAllocationSiteStats const& site : stats)
+				{
+					output.Logf(TEXT_"%12lld %12lld %12lld %12lld  %s",
+						site.LiveBytes, site.PeakBytes, site.LiveAllocations, site.Allocations, *site.Site
+					);
+				}
+			})
+		};
+#endif
+	}
+
+	void SetAllocationTracking(bool enabled)
+	{
+		auto& registry = GetRegistry();
+		FScopeLock lock(&registry.Lock);
+		GTrackingState.store(
+			enabled ? TrackingEnabled
+			: registry.Records.IsEmpty() ? TrackingDisabled
+			: TrackingDraining,
+			std::memory_order_relaxed
+		);
+	}
+
+	bool IsAllocationTrackingEnabled()
+	{
+		return GTrackingState.load(std::memory_order_relaxed) == TrackingEnabled;
+	}
+
+	TArray<FAllocationSiteStats> GetAllocationSiteStats()
+	{
+		TArray<FAllocationSiteStats> result;
+#if MCRO_ANSI_ALLOCATION_SITES
+		TArray<TPair<FSiteKey, FSiteCounters>> sites;
+		{
+			auto& registry = GetRegistry();
+			FScopeLock lock(&registry.Lock);
+			sites = registry.Sites.Array();
+		}
+		// Symbolizing is slow, do it outside of the lock
+		result.Reserve(sites.Num());
+		for (auto const& [site, counters] : sites)
+		{
+			result.Add({
+				.Site = GetSiteName(site),
+				.Allocations = counters.Allocations,
+				.LiveAllocations = counters.LiveAllocations,
+				.LiveBytes = counters.LiveBytes,
+				.PeakBytes = counters.PeakBytes,
+			});
+		}
+#endif
+		return result;
+	}
+
+	void Detail::OnTrackedAlloc(void* ptr, SIZE_T size, uint32 alignment, FAllocationSite const& site)
+	{
+		if (!ptr) return;
+		// Reports are made under the lock, so a freed address cannot be reported as allocated again before its free
+		auto& registry = GetRegistry();
+		FScopeLock lock(&registry.Lock);
+		AddRecord(registry, ptr, size, site);
+		ReportAlloc(ptr, size, alignment);
+	}
+
+	void* Detail::OnTrackedRealloc(void* ptr, SIZE_T size, FAllocationSite const& site)
+	{
+		auto& registry = GetRegistry();
+		FScopeLock lock(&registry.Lock);
+
+		// Failing to reallocate leaves the original allocation intact
+		void* newPtr = ::realloc(ptr, size);
+		if (!newPtr) return nullptr;
+
+		const bool enabled = GTrackingState.load(std::memory_order_relaxed) == TrackingEnabled;
+		const bool wasTracked = ptr && registry.Records.Contains(ptr);
+		if (wasTracked && enabled)
+		{
+			// Growing or shrinking, in place or not, only changes the size of the allocation
+			ResizeRecord(registry, ptr, newPtr, size);
+			ReportRealloc(ptr, newPtr, size);
+		}
+		else if (wasTracked)
+		{
+			RemoveRecord(registry, ptr);
+			ReportFree(ptr);
+		}
+		else if (enabled)
+		{
+			AddRecord(registry, newPtr, size, site);
+			ReportAlloc(newPtr, size, DEFAULT_ALIGNMENT);
+		}
+		return newPtr;
+	}
+
+	void Detail::OnTrackedFree(void* ptr)
+	{
+		auto& registry = GetRegistry();
+		FScopeLock lock(&registry.Lock);
+		if (RemoveRecord(registry, ptr))
+			ReportFree(ptr);
+	}
+}
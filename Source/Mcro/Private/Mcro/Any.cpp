@@ -15,47 +15,51 @@ namespace Mcro::Any
 {
 	FAny::FAny(FAny const& other)
 	{
-		if (other.IsValid())
-			other.CopyConstruct(this, other);
+		if (!other.IsValid()) return;
+
+		VTable = other.VTable;
+		bInline = other.bInline;
+		CustomFacilities = other.CustomFacilities;
+		VTable->CopyConstruct(*this, other);
+		MainType = other.MainType;
+		ValidTypes = other.ValidTypes;
 	}
 
 	FAny::FAny(FAny&& other)
 		: Storage(other.Storage)
 		, MainType(MoveTemp(other.MainType))
-		, Destruct(MoveTemp(other.Destruct))
-		, CopyConstruct(MoveTemp(other.CopyConstruct))
+		, VTable(other.VTable)
+		, bInline(other.bInline)
+		, CustomFacilities(MoveTemp(other.CustomFacilities))
 		, ValidTypes(MoveTemp(other.ValidTypes))
 	{
+		if (other.IsInline())
+		{
+			VTable->MoveConstruct(*this, other);
+			VTable->Destruct(other);
+		}
 		other.Reset();
 	}
 
 	FAny::~FAny()
 	{
-		if (static_cast<bool>(Destruct))
-			Destruct(this);
+		if (IsValid() && VTable)
+			VTable->Destruct(*this);
 		Reset();
 	}
 	
-	void FAny::AddAlias(FType const& alias)
-	{
-		if (!ValidTypes.Contains(alias))
-			ValidTypes.Add(alias);
-	}
-
-	void FAny::CopyTypeInfo(FAny* self, const FAny* other)
+	void FAny::AddAlias(FTypeHash alias)
 	{
-		self->MainType = other->MainType;
-		self->ValidTypes = other->ValidTypes;
-		self->CopyConstruct = other->CopyConstruct;
-		self->Destruct = other->Destruct;
+		ValidTypes.AddUnique(alias);
 	}
 
 	void FAny::Reset()
 	{
 		Storage = nullptr;
 		MainType = {};
-		Destruct.Reset();
-		CopyConstruct.Reset();
+		VTable = nullptr;
+		bInline = false;
+		CustomFacilities.Reset();
 		ValidTypes.Empty();
 	}
 }
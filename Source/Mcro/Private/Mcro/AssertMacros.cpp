@@ -37,6 +37,7 @@ namespace Mcro::AssertMacros::Detail
 			->WithBlueprintStackTrace({}, IsInGameThread());
 		
 		extraSetup(error);
+		FScopedErrorCapture::Capture(error);
 		auto future = FErrorManager::Get().DisplayError(error,
 			{ .bAsync = async, .bImportantToRead = important }
 		);
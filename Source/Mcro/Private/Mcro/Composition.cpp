@@ -15,72 +15,132 @@ namespace Mcro::Composition
 {
 	IComposable::IComposable(const IComposable& other)
 		: LastAddedComponentHash(other.LastAddedComponentHash)
+		, ComponentTypes(other.ComponentTypes)
 		, Components(other.Components)
+		, SharedComponents(other.SharedComponents)
+		, AliasTypes(other.AliasTypes)
+		, AliasTargets(other.AliasTargets)
+		, FirstAliasTypes(other.FirstAliasTypes)
+		, FirstAliasTargets(other.FirstAliasTargets)
 		, ComponentLogistics(other.ComponentLogistics)
-		, ComponentAliases(other.ComponentAliases)
+		, LookupCache(other.LookupCache ? MakeUnique<FLookupCache>() : nullptr)
+		, ComponentTable(other.ComponentTable ? MakeUnique<Threading::TSnapshotStorage<FComponentTable>>() : nullptr)
 		, OnComponentAdded(other.OnComponentAdded)
 	{
+		// Components of the original may be shared with this copy now, cached mutable results need to detach again
+		other.InvalidateLookupCache();
 		NotifyCopyComponents(other);
+		PublishComponentTable();
 	}
 
 	IComposable::IComposable(IComposable&& other) noexcept
 		: LastAddedComponentHash(other.LastAddedComponentHash)
+		, ComponentTypes(MoveTemp(other.ComponentTypes))
 		, Components(MoveTemp(other.Components))
+		, SharedComponents(MoveTemp(other.SharedComponents))
+		, AliasTypes(MoveTemp(other.AliasTypes))
+		, AliasTargets(MoveTemp(other.AliasTargets))
+		, FirstAliasTypes(MoveTemp(other.FirstAliasTypes))
+		, FirstAliasTargets(MoveTemp(other.FirstAliasTargets))
 		, ComponentLogistics(MoveTemp(other.ComponentLogistics))
-		, ComponentAliases(MoveTemp(other.ComponentAliases))
+		, LookupCache(other.LookupCache ? MakeUnique<FLookupCache>() : nullptr)
+		, ComponentTable(MoveTemp(other.ComponentTable))
 		, OnComponentAdded(MoveTemp(other.OnComponentAdded))
 	{
+		// The original keeps its cache, but its entries point into the components which are owned by this one now
+		other.InvalidateLookupCache();
 		NotifyMoveComponents(FWD(other));
 	}
 
-	bool IComposable::HasExactComponent(FTypeHash typeHash) const
+	void IComposable::EnableLookupCache(bool enable)
 	{
-		return Components.Contains(typeHash);
+		if (!enable) LookupCache.Reset();
+		else if (!LookupCache) LookupCache = MakeUnique<FLookupCache>();
 	}
 
-	bool IComposable::HasComponentAliasUnchecked(FTypeHash typeHash) const
+	void IComposable::PublishComponentTable() const
 	{
-		return ComponentAliases.Contains(typeHash);
+		if (!ComponentTable) return;
+
+		FComponentTable table;
+		table.Types.Reserve(ComponentTypes.Num() + AliasTypes.Num());
+		table.Addresses.Reserve(ComponentTypes.Num() + AliasTypes.Num());
+		table.Owners.Reserve(ComponentTypes.Num() + AliasTypes.Num());
+		for (int32 i = 0; i < ComponentTypes.Num(); ++i)
+		{
+			table.Types.Add(ComponentTypes[i]);
+			table.Addresses.Add(ComponentAt(i, false).GetData());
+			table.Owners.Add(SharedComponents.IsValidIndex(i) ? SharedComponents[i] : nullptr);
+		}
+		for (int32 i = 0; i < AliasTypes.Num(); ++i)
+		{
+			const int32 target = AliasTargets[i];
+			table.Types.Add(AliasTypes[i]);
+			table.Addresses.Add(ComponentAt(target, false).GetData());
+			table.Owners.Add(SharedComponents.IsValidIndex(target) ? SharedComponents[target] : nullptr);
+		}
+		ComponentTable->Publish(MoveTemp(table));
 	}
 
-	bool IComposable::HasComponentAlias(FTypeHash typeHash) const
+	int32 IComposable::FindExactComponent(FTypeHash typeHash) const
 	{
-		if (HasComponentAliasUnchecked(typeHash))
+		return ComponentTypes.Find(typeHash);
+	}
+
+	FAny& IComposable::ComponentAt(int32 index, bool mutate) const
+	{
+		if (!SharedComponents.IsValidIndex(index) || !SharedComponents[index].IsValid())
+			return Components[index];
+		
+		FSharedComponent& shared = SharedComponents[index];
+		if (mutate && !shared.IsUnique())
 		{
-			auto& components = ComponentAliases[typeHash];
-			components.RemoveAll([this](FTypeHash i)
-			{
-				return !Components.Contains(i);
-			});
-			if (components.IsEmpty())
-			{
-				ComponentAliases.Remove(typeHash);
-				return false;
-			}
-			return true;
+			shared = MakeShared<FAny, ESPMode::ThreadSafe>(*shared);
+			InvalidateLookupCache();
+			PublishComponentTable();
 		}
-		return false;
+		return *shared;
+	}
+
+	bool IComposable::HasExactComponent(FTypeHash typeHash) const
+	{
+		return FindExactComponent(typeHash) != INDEX_NONE;
 	}
 
 	void IComposable::AddComponentAlias(FTypeHash mainType, FTypeHash validAs)
 	{
-		if (HasComponentAliasUnchecked(validAs))
-			ComponentAliases[validAs].Add(mainType);
-		else ComponentAliases.Add(validAs, { mainType });
+		const int32 target = FindExactComponent(mainType);
+		if (target == INDEX_NONE) return;
+		
+		for (int32 i = 0; i < AliasTypes.Num(); ++i)
+		{
+			if (AliasTypes[i] == validAs && AliasTargets[i] == target)
+				return;
+		}
+		AliasTypes.Add(validAs);
+		AliasTargets.Add(target);
+		InvalidateLookupCache();
+		PublishComponentTable();
+
+		if (!FirstAliasTypes.Contains(validAs))
+		{
+			FirstAliasTypes.Add(validAs);
+			FirstAliasTargets.Add(target);
+		}
 	}
 
 	void IComposable::NotifyCopyComponents(IComposable const& other)
 	{
-		for (auto const& [key, logistics] : ComponentLogistics)
+		for (auto const& [index, logistics] : ComponentLogistics)
 		{
-			logistics.Copy(this, other.Components[key]);
+			logistics.Copy(this, other.Components[index]);
 		}
 	}
 
 	void IComposable::NotifyMoveComponents(IComposable&& other)
 	{
 		if (this == &other) return;
-		for (auto const& [key, logistics] : ComponentLogistics)
+		for (auto const& [index, logistics] : ComponentLogistics)
 		{
 			logistics.Move(this);
 		}
@@ -89,35 +149,44 @@ namespace Mcro::Composition
 
 	void IComposable::ResetComponents()
 	{
+		ComponentTypes.Empty();
 		Components.Empty();
+		SharedComponents.Empty();
+		AliasTypes.Empty();
+		AliasTargets.Empty();
+		FirstAliasTypes.Empty();
+		FirstAliasTargets.Empty();
 		ComponentLogistics.Empty();
-		ComponentAliases.Empty();
 		LastAddedComponentHash = 0;
+		InvalidateLookupCache();
+		PublishComponentTable();
 	}
 
 	ranges::any_view<FAny*> IComposable::GetExactComponent(FTypeHash typeHash) const
 	{
-		namespace r = ranges;
 		namespace rv = ranges::views;
-			
-		if (HasExactComponent(typeHash)) return rv::single(Components.Find(typeHash));
+		
+		const int32 index = FindExactComponent(typeHash);
+		if (index != INDEX_NONE) return rv::single(&ComponentAt(index));
 		return ranges::empty_view<FAny*>();
 	}
 
 	ranges::any_view<FAny*> IComposable::GetAliasedComponents(FTypeHash typeHash) const
 	{
-		namespace r = ranges;
 		namespace rv = ranges::views;
-			
-		if (HasComponentAlias(typeHash))
-			return ComponentAliases[typeHash]
-				| rv::transform([this](FTypeHash i) -> decltype(auto) { return Components.Find(i); });
-			
-		return r::empty_view<FAny*>();
+		
+		return rv::iota(0, AliasTypes.Num())
+			| rv::filter([this, typeHash](int32 i) { return AliasTypes[i] == typeHash; })
+			| rv::transform([this](int32 i) { return &ComponentAt(AliasTargets[i]); });
+	}
+
+	TComponentView<FAny> IComposable::GetComponentsDynamic(FTypeHash typeHash)
+	{
+		return TComponentView<FAny>(this, typeHash);
 	}
 
-	ranges::any_view<FAny*> IComposable::GetComponentsDynamic(FTypeHash typeHash) const
+	TComponentView<const FAny> IComposable::GetComponentsDynamic(FTypeHash typeHash) const
 	{
-		return GetExactComponent(typeHash) | Concat(GetAliasedComponents(typeHash));
+		return TComponentView<const FAny>(this, typeHash);
 	}
 }
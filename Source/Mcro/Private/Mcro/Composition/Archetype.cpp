@@ -0,0 +1,189 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Composition/Archetype.h"
+#include "Mcro/Hash.h"
+
+namespace Mcro::Composition
+{
+	namespace Detail
+	{
+		FArchetypeColumn::FArchetypeColumn(
+			FTypeHash type,
+			int32 elementSize,
+			int32 elementAlignment,
+			const FArchetypeColumnOps* ops
+		)
+			: Type(type)
+			, ElementSize(elementSize)
+			, ElementAlignment(elementAlignment)
+			, Ops(ops)
+		{}
+
+		FArchetypeColumn::FArchetypeColumn(FArchetypeColumn&& other) noexcept
+			: Type(other.Type)
+			, ElementSize(other.ElementSize)
+			, ElementAlignment(other.ElementAlignment)
+			, Ops(other.Ops)
+			, Data(other.Data)
+			, Count(other.Count)
+			, Capacity(other.Capacity)
+		{
+			other.Data = nullptr;
+			other.Count = 0;
+			other.Capacity = 0;
+		}
+
+		FArchetypeColumn::~FArchetypeColumn()
+		{
+			for (int32 i = 0; i < Count; ++i)
+				Ops->Destruct(At(i));
+			if (Data) FMemory::Free(Data);
+		}
+
+		void FArchetypeColumn::Reserve(int32 capacity)
+		{
+			if (capacity <= Capacity) return;
+			
+			uint8* newData = static_cast<uint8*>(
+				FMemory::Malloc(static_cast<SIZE_T>(capacity) * ElementSize, ElementAlignment)
+			);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				void* element = At(i);
+				Ops->MoveConstruct(newData + static_cast<SIZE_T>(i) * ElementSize, element);
+				Ops->Destruct(element);
+			}
+			if (Data) FMemory::Free(Data);
+			Data = newData;
+			Capacity = capacity;
+		}
+
+		void* FArchetypeColumn::AddUninitialized()
+		{
+			if (Count == Capacity)
+				Reserve(FMath::Max(16, Capacity * 2));
+			return At(Count++);
+		}
+
+		void FArchetypeColumn::RemoveAtSwap(int32 index)
+		{
+			check(index >= 0 && index < Count);
+			void* removed = At(index);
+			Ops->Destruct(removed);
+
+			const int32 last = Count - 1;
+			if (index != last)
+			{
+				void* lastElement = At(last);
+				Ops->MoveConstruct(removed, lastElement);
+				Ops->Destruct(lastElement);
+			}
+			--Count;
+		}
+	}
+
+	bool FArchetypeStorage::Destroy(FArchetypeEntity entity)
+	{
+		if (!IsAlive(entity)) return false;
+
+		FEntitySlot& slot = EntitySlots[entity.Index];
+		Detail::FArchetype& archetype = *Archetypes[slot.Archetype];
+		const int32 row = slot.Row;
+		
+		for (auto& column : archetype.Columns)
+			column.RemoveAtSwap(row);
+		
+		archetype.Entities.RemoveAtSwap(row, EAllowShrinking::No);
+		if (archetype.Entities.IsValidIndex(row))
+			EntitySlots[archetype.Entities[row]].Row = row;
+
+		slot.Archetype = INDEX_NONE;
+		slot.Row = INDEX_NONE;
+		++slot.Generation;
+		FreeEntities.Add(entity.Index);
+		--AliveCount;
+		return true;
+	}
+
+	bool FArchetypeStorage::IsAlive(FArchetypeEntity entity) const
+	{
+		return EntitySlots.IsValidIndex(entity.Index)
+			&& EntitySlots[entity.Index].Generation == entity.Generation
+			&& EntitySlots[entity.Index].Archetype != INDEX_NONE;
+	}
+
+	int32 FArchetypeStorage::Num() const
+	{
+		return AliveCount;
+	}
+
+	int32 FArchetypeStorage::NumArchetypes() const
+	{
+		return Archetypes.Num();
+	}
+
+	void FArchetypeStorage::Reset()
+	{
+		Archetypes.Empty();
+		ArchetypeLookup.Reset();
+		FreeEntities.Empty();
+		for (int32 i = 0; i < EntitySlots.Num(); ++i)
+		{
+			FEntitySlot& slot = EntitySlots[i];
+			if (slot.Archetype != INDEX_NONE) ++slot.Generation;
+			slot.Archetype = INDEX_NONE;
+			slot.Row = INDEX_NONE;
+			FreeEntities.Add(i);
+		}
+		AliveCount = 0;
+	}
+
+	int32 FArchetypeStorage::FindArchetype(TArrayView<const FTypeHash> key) const
+	{
+		auto matches = [&](int32 i)
+		{
+			auto const& candidate = Archetypes[i]->Key;
+			return candidate.Num() == key.Num()
+				&& FMemory::Memcmp(candidate.GetData(), key.GetData(), key.Num() * sizeof(FTypeHash)) == 0;
+		};
+
+		const int32* indexed = ArchetypeLookup.Find(Hash::HashRange(key));
+		if (!indexed) return INDEX_NONE;
+		if (matches(*indexed)) return *indexed;
+
+		// Two different keys have the same hash, only the first one is in the lookup
+		for (int32 i = 0; i < Archetypes.Num(); ++i)
+			if (matches(i)) return i;
+		return INDEX_NONE;
+	}
+
+	int32 FArchetypeStorage::AddArchetype(Detail::FArchetype&& archetype)
+	{
+		ArchetypeLookup.FindOrAdd(Hash::HashRange(archetype.Key), Archetypes.Num());
+		return Archetypes.Add(MakeUnique<Detail::FArchetype>(MoveTemp(archetype)));
+	}
+
+	FArchetypeEntity FArchetypeStorage::AddEntity(int32 archetypeIndex)
+	{
+		const int32 entityIndex = FreeEntities.IsEmpty()
+			? EntitySlots.AddDefaulted()
+			: FreeEntities.Pop(EAllowShrinking::No);
+
+		Detail::FArchetype& archetype = *Archetypes[archetypeIndex];
+		FEntitySlot& slot = EntitySlots[entityIndex];
+		slot.Archetype = archetypeIndex;
+		slot.Row = archetype.Entities.Add(entityIndex);
+		++AliveCount;
+		return { entityIndex, slot.Generation };
+	}
+}
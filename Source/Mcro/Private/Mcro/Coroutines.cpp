@@ -0,0 +1,122 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Coroutines.h"
+
+namespace Mcro::Coroutines
+{
+	namespace
+	{
+		constexpr int32 SizeClassCount = 7;
+		constexpr size_t SmallestSizeClass = 64;
+		constexpr size_t LargestSizeClass = SmallestSizeClass << (SizeClassCount - 1);
+		constexpr int32 MaxCachedFrames = 64;
+
+		int32 GetSizeClass(size_t size)
+		{
+			if (size > LargestSizeClass) return INDEX_NONE;
+			int32 sizeClass = 0;
+			while ((SmallestSizeClass << sizeClass) < size) ++sizeClass;
+			return sizeClass;
+		}
+
+		struct FFreeFrame
+		{
+			FFreeFrame* Next;
+		};
+
+		/**
+		 *	Frames freed on a thread are cached for the coroutines started on the same thread. Frames migrating to
+		 *	other threads balance out by the cache limit.
+		 */
+		struct FFrameCache
+		{
+			FFreeFrame* Free[SizeClassCount] {};
+			int32 Count[SizeClassCount] {};
+
+			~FFrameCache()
+			{
+				for (FFreeFrame*& head : Free)
+				{
+					while (head)
+					{
+						FFreeFrame* next = head->Next;
+						FMemory::Free(head);
+						head = next;
+					}
+				}
+			}
+		};
+
+		thread_local FFrameCache GFrameCache;
+
+		class FResumeCoroutineTask
+		{
+		public:
+			FResumeCoroutineTask(std::coroutine_handle<> handle, ENamedThreads::Type threadName)
+				: Handle(handle)
+				, ThreadName(threadName)
+			{}
+
+			static TStatId GetStatId() { RETURN_QUICK_DECLARE_CYCLE_STAT(FResumeCoroutineTask, STATGROUP_TaskGraphTasks); }
+			static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::FireAndForget; }
+			ENamedThreads::Type GetDesiredThread() const { return ThreadName; }
+
+			void DoTask(ENamedThreads::Type, const FGraphEventRef&) { Handle.resume(); }
+
+		private:
+			std::coroutine_handle<> Handle;
+			ENamedThreads::Type ThreadName;
+		};
+	}
+
+	void* Detail::AllocateCoroutineFrame(size_t size)
+	{
+		int32 sizeClass = GetSizeClass(size);
+		if (sizeClass == INDEX_NONE) return FMemory::Malloc(size);
+
+		FFrameCache& cache = GFrameCache;
+		if (FFreeFrame* frame = cache.Free[sizeClass])
+		{
+			cache.Free[sizeClass] = frame->Next;
+			--cache.Count[sizeClass];
+			return frame;
+		}
+		return FMemory::Malloc(SmallestSizeClass << sizeClass);
+	}
+
+	void Detail::FreeCoroutineFrame(void* frame, size_t size)
+	{
+		int32 sizeClass = GetSizeClass(size);
+		FFrameCache& cache = GFrameCache;
+		if (sizeClass == INDEX_NONE || cache.Count[sizeClass] >= MaxCachedFrames)
+		{
+			FMemory::Free(frame);
+			return;
+		}
+		auto freeFrame = static_cast<FFreeFrame*>(frame);
+		freeFrame->Next = cache.Free[sizeClass];
+		cache.Free[sizeClass] = freeFrame;
+		++cache.Count[sizeClass];
+	}
+
+	void Detail::ResumeCoroutineOn(std::coroutine_handle<> handle, ENamedThreads::Type threadName)
+	{
+		TGraphTask<FResumeCoroutineTask>::CreateTask().ConstructAndDispatchWhenReady(handle, threadName);
+	}
+
+	bool Detail::IsInNamedThread(ENamedThreads::Type threadName)
+	{
+		ENamedThreads::Type threadIndex = ENamedThreads::GetThreadIndex(threadName);
+		if (threadIndex == ENamedThreads::AnyThread) return false;
+		return ENamedThreads::GetThreadIndex(FTaskGraphInterface::Get().GetCurrentThreadIfKnown()) == threadIndex;
+	}
+}
@@ -0,0 +1,155 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Delegates/AsNative.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Class.h"
+#include "UObject/Script.h"
+#include "UObject/Stack.h"
+#include "UObject/UnrealType.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace Mcro::Delegates::Detail
+{
+	namespace
+	{
+		struct FUFunctionKey
+		{
+			const UClass* Class = nullptr;
+			FName Name;
+
+			friend bool operator == (FUFunctionKey const&, FUFunctionKey const&) = default;
+			friend uint32 GetTypeHash(FUFunctionKey const& key)
+			{
+				return HashCombineFast(PointerHash(key.Class), GetTypeHash(key.Name));
+			}
+		};
+
+		struct FUFunctionCache
+		{
+			FRWLock Lock;
+			TMap<FUFunctionKey, TSharedPtr<FResolvedUFunction, ESPMode::ThreadSafe>> Functions;
+
+			FUFunctionCache()
+			{
+				// Bound delegates keep their resolution alive, the cache only lets go of the collected ones
+				FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FUFunctionCache::RemoveCollected);
+			}
+
+			void RemoveCollected()
+			{
+				FWriteScopeLock lock(Lock);
+				for (auto it = Functions.CreateIterator(); it; ++it)
+				{
+					if (!it.Value()->Function.IsValid()) it.RemoveCurrent();
+				}
+			}
+		};
+
+		FUFunctionCache& GetUFunctionCache()
+		{
+			static FUFunctionCache cache;
+			return cache;
+		}
+
+		TSharedPtr<FResolvedUFunction, ESPMode::ThreadSafe> Resolve(UFunction* function)
+		{
+			auto result = MakeShared<FResolvedUFunction, ESPMode::ThreadSafe>();
+			result->Function = function;
+			result->ParametersSize = function->ParmsSize;
+			result->ParametersAlignment = FMath::Max(function->GetMinAlignment(), 1);
+			result->ReturnValueOffset = function->ReturnValueOffset != MAX_uint16 ? function->ReturnValueOffset : INDEX_NONE;
+			for (TFieldIterator<FProperty> it(function); it && it->HasAnyPropertyFlags(CPF_Parm); ++it)
+			{
+				if (it->HasAnyPropertyFlags(CPF_ReturnParm)) continue;
+				result->ParameterOffsets.Add(it->GetOffset_ForUFunction());
+				if (it->HasAnyPropertyFlags(CPF_OutParm)) result->OutParameters.Add(*it);
+			}
+			const UClass* owner = function->GetOuterUClass();
+			result->bDirectNativeCall = function->HasAnyFunctionFlags(FUNC_Native)
+				&& !function->HasAnyFunctionFlags(FUNC_Net | FUNC_NetMulticast | FUNC_NetRequest | FUNC_NetResponse)
+				&& !function->HasAnyFunctionFlags(FUNC_Event | FUNC_BlueprintEvent)
+				&& owner && owner->HasAnyClassFlags(CLASS_Native);
+			return result;
+		}
+	}
+
+	FResolvedUFunctionPtr ResolveUFunction(const UObject* object, FName functionName)
+	{
+		if (!object) return nullptr;
+
+		const FUFunctionKey key { object->GetClass(), functionName };
+		auto& cache = GetUFunctionCache();
+		{
+			FReadScopeLock lock(cache.Lock);
+			if (auto const* resolved = cache.Functions.Find(key))
+			{
+				if ((*resolved)->Function.IsValid()) return *resolved;
+			}
+		}
+
+		UFunction* function = object->FindFunction(functionName);
+		if (!function) return nullptr;
+
+		FWriteScopeLock lock(cache.Lock);
+		auto& resolved = cache.Functions.FindOrAdd(key);
+
+		// A reinstanced class can reuse the address of a collected one before the stale resolution is removed
+		if (!resolved || !resolved->Function.IsValid()) resolved = Resolve(function);
+		return resolved;
+	}
+
+	void InitializeUFunctionParameters(FResolvedUFunction const& resolved, uint8* parameters)
+	{
+		if (UFunction* function = resolved.Function.Get())
+			function->InitializeStruct(parameters);
+	}
+
+	void DestroyUFunctionParameters(FResolvedUFunction const& resolved, uint8* parameters)
+	{
+		if (UFunction* function = resolved.Function.Get())
+			function->DestroyStruct(parameters);
+	}
+
+	void InvokeResolvedUFunction(FResolvedUFunction const& resolved, UObject* object, uint8* parameters)
+	{
+		UFunction* function = resolved.Function.Get();
+		if (!ensureMsgf(function, TEXT("A resolved UFunction has been destroyed while a delegate was still bound to it")))
+			return;
+
+		if (!resolved.bDirectNativeCall)
+		{
+			object->ProcessEvent(function, parameters);
+			return;
+		}
+
+		// Mirrors what ProcessEvent does for native functions, without the name and script checks. Only functions which
+		// aren't affected by those (see bDirectNativeCall) take this path
+		FFrame frame(object, function, parameters, nullptr, function->ChildProperties);
+
+		FOutParmRec* outParameters = static_cast<FOutParmRec*>(
+			FMemory_Alloca(sizeof(FOutParmRec) * FMath::Max(resolved.OutParameters.Num(), 1))
+		);
+		FOutParmRec** lastOut = &frame.OutParms;
+		for (int32 i = 0; i < resolved.OutParameters.Num(); ++i)
+		{
+			FProperty* property = resolved.OutParameters[i];
+			outParameters[i].Property = property;
+			outParameters[i].PropAddr = property->ContainerPtrToValuePtr<uint8>(parameters);
+			outParameters[i].NextOutParm = nullptr;
+			*lastOut = &outParameters[i];
+			lastOut = &outParameters[i].NextOutParm;
+		}
+
+		uint8* returnValue = resolved.ReturnValueOffset != INDEX_NONE ? parameters + resolved.ReturnValueOffset : nullptr;
+		function->Invoke(object, frame, returnValue);
+	}
+}
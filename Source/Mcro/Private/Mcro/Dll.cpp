@@ -10,17 +10,35 @@
  */
 
 #include "Mcro/Dll.h"
+#include "Mcro/TextMacros.h"
+#include "Misc/ScopeLock.h"
+
+DECLARE_LOG_CATEGORY_CLASS(LogMcroDll, Log, All);
 
 namespace Mcro::Dll
 {
-	
+
+	namespace
+	{
+		// Recursive, so nested search paths on the same thread are fine
+		FCriticalSection& GetSearchPathLock()
+		{
+			static FCriticalSection lock;
+			return lock;
+		}
+	}
+
 	FScopedSearchPath::FScopedSearchPath(FString const& path) : Path(path)
 	{
-		if (!path.IsEmpty()) FPlatformProcess::PushDllDirectory(*path);
+		if (path.IsEmpty()) return;
+		GetSearchPathLock().Lock();
+		FPlatformProcess::PushDllDirectory(*path);
 	}
 	FScopedSearchPath::~FScopedSearchPath()
 	{
-		if (!Path.IsEmpty()) FPlatformProcess::PopDllDirectory(*Path);
+		if (Path.IsEmpty()) return;
+		FPlatformProcess::PopDllDirectory(*Path);
+		GetSearchPathLock().Unlock();
 	}
 
 	FScopedDll::FScopedDll(const TCHAR* fileName)
@@ -30,6 +48,148 @@ namespace Mcro::Dll
 
 	FScopedDll::~FScopedDll()
 	{
-		FPlatformProcess::FreeDllHandle(Handle);
+		if (Handle) FPlatformProcess::FreeDllHandle(Handle);
+	}
+
+	FScopedDllSet::FScopedDllSet(FString const& pushPath, TArray<FDllDescriptor> const& dlls)
+	{
+		FScopedSearchPath pathContext(pushPath);
+		LoadInDependencyOrder(dlls);
+	}
+
+	FScopedDllSet::FScopedDllSet(TSharedPtr<IPlugin> plugin, FString const& pushPath, TArray<FDllDescriptor> const& dlls)
+	{
+		ASSERT_CRASH(plugin);
+		FScopedSearchPath pathContext(plugin->GetBaseDir() / pushPath);
+		LoadInDependencyOrder(dlls);
+	}
+
+	void FScopedDllSet::LoadInDependencyOrder(TArray<FDllDescriptor> const& dlls)
+	{
+		TArray<void*> handles;
+		handles.SetNumZeroed(dlls.Num());
+		LoadTimings.SetNum(dlls.Num());
+
+		// Dependencies on DLL's outside of this set are ignored
+		TArray<TArray<int32>> dependencies;
+		dependencies.SetNum(dlls.Num());
+		for (int32 i = 0; i < dlls.Num(); ++i)
+		{
+			for (FString const& dependency : dlls[i].DependsOn)
+			{
+				int32 index = dlls.IndexOfByPredicate([&](FDllDescriptor const& dll) { return dll.FileName == dependency; });
+				if (index != INDEX_NONE && index != i) dependencies[i].Add(index);
+			}
+		}
+
+		TBitArray<> attempted(false, dlls.Num());
+
+		// Dependents of a DLL which couldn't be loaded are skipped
+		auto loadDll = [&](int32 index)
+		{
+			attempted[index] = true;
+			LoadTimings[index].FileName = dlls[index].FileName;
+			if (dependencies[index].ContainsByPredicate([&](int32 d) { return attempted[d] && !handles[d]; }))
+			{
+				LoadTimings[index].bSkipped = true;
+				return;
+			}
+
+			const double start = FPlatformTime::Seconds();
+			handles[index] = FPlatformProcess::GetDllHandle(*dlls[index].FileName);
+			LoadTimings[index].Seconds = FPlatformTime::Seconds() - start;
+			LoadTimings[index].bLoaded = handles[index] != nullptr;
+		};
+
+		for (int32 remaining = dlls.Num(); remaining > 0;)
+		{
+			bool progress = false;
+			for (int32 i = 0; i < dlls.Num(); ++i)
+			{
+				if (attempted[i] || dependencies[i].ContainsByPredicate([&](int32 d) { return !attempted[d]; }))
+					continue;
+
+				loadDll(i);
+				progress = true;
+				--remaining;
+			}
+
+			if (!progress)
+			{
+				// Circular dependencies, load the rest one by one in declaration order
+				UE_LOG(LogMcroDll, Warning, TEXT_"Circular dependencies between DLL's, loading the rest sequentially");
+				for (int32 i = 0; i < dlls.Num(); ++i)
+				{
+					if (!attempted[i]) loadDll(i);
+				}
+				remaining = 0;
+			}
+		}
+
+		Dlls.Reserve(dlls.Num());
+		for (int32 i = 0; i < dlls.Num(); ++i)
+		{
+			FDllLoadTiming const& timing = LoadTimings[i];
+			if (timing.bLoaded)
+				UE_LOG(LogMcroDll, Log, TEXT_"Loaded %s in %.2f ms", *timing.FileName, timing.Seconds * 1000.0);
+			else if (timing.bSkipped)
+				UE_LOG(LogMcroDll, Warning, TEXT_"Skipped %s because its dependencies couldn't be loaded", *timing.FileName);
+			else
+				UE_LOG(LogMcroDll, Warning, TEXT_"Couldn't load %s (%.2f ms)", *timing.FileName, timing.Seconds * 1000.0);
+
+			Dlls.Add(FScopedDll(handles[i]));
+		}
+	}
+
+	FLazyDllSet::FLazyDllSet(FString const& searchPath, TArray<FDllDescriptor> const& dlls)
+		: SearchPath(searchPath)
+		, Descriptors(dlls)
+	{}
+
+	FCanFail FLazyDllSet::EnsureLoaded()
+	{
+		if (!bLoaded.load(std::memory_order_acquire))
+		{
+			FScopeLock lock(&Lock);
+			if (!bLoaded.load(std::memory_order_relaxed))
+			{
+				Dlls = MakeUnique<FScopedDllSet>(SearchPath, Descriptors);
+
+				TArray<FString> missing;
+				for (FDllLoadTiming const& timing : Dlls->GetLoadTimings())
+				{
+					if (!timing.bLoaded) missing.Add(timing.FileName);
+				}
+				if (!missing.IsEmpty())
+				{
+					LoadError = IError::Make(new FUnavailable())
+						->AsRecoverable()
+						->WithMessageF(TEXT_"{0} DLL's couldn't be loaded from {1}", missing.Num(), SearchPath)
+						->WithDetailsF(TEXT_"Missing: {0}", FString::Join(missing, TEXT_", "));
+				}
+				bLoaded.store(true, std::memory_order_release);
+			}
+		}
+		if (LoadError) return LoadError.ToSharedRef();
+		return Success();
+	}
+
+	void* FLazyDllSet::ResolveSymbol(const TCHAR* symbol)
+	{
+		// Symbols may still be found in the DLL's which did load, see LoadError for the others
+		EnsureLoaded();
+		for (FScopedDll const& dll : Dlls->GetDlls())
+		{
+			if (!dll.GetHandle()) continue;
+			if (void* address = FPlatformProcess::GetDllExport(dll.GetHandle(), symbol))
+				return address;
+		}
+		return nullptr;
+	}
+
+	TConstArrayView<FDllLoadTiming> FLazyDllSet::GetLoadTimings() const
+	{
+		if (!IsLoaded()) return {};
+		return Dlls->GetLoadTimings();
 	}
 }
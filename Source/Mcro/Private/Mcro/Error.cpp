@@ -10,6 +10,7 @@
  */
 
 #include "Mcro/Error.h"
+#include "Misc/ScopeLock.h"
 #include "Mcro/Observable.h"
 #include "Mcro/Error/SErrorDisplay.h"
 #include "Mcro/Error/PlainTextComponent.h"
@@ -26,15 +27,24 @@ namespace Mcro::Error
 	using namespace Mcro::Text;
 	using namespace Mcro::Enums;
 	using namespace Mcro::Yaml;
+
+	namespace
+	{
+		// Errors may be serialized concurrently (for example by the error journal), so the root of the document being
+		// serialized is tracked per thread instead of on the error itself
+		thread_local const IError* GSerializedRoot = nullptr;
+	}
 	
 	void IError::SerializeInnerErrors(YAML::Emitter& emitter) const
 	{
 		FMap innerErrors(emitter);
 		for (auto const& inner : InnerErrors)
-		{
-			inner.Value->bIsRoot = false;
 			emitter << YAML::Key << inner.Key << YAML::Value << inner.Value;
-		}
+	}
+
+	bool IError::IsSerializedAsRoot() const
+	{
+		return GSerializedRoot == this;
 	}
 
 	void IError::SerializeErrorPropagation(YAML::Emitter& emitter) const
@@ -57,12 +67,19 @@ namespace Mcro::Error
 		FString type = typeOverride.IsEmpty() ? error->GetType().ToStringCopy() : typeOverride;
 		FString key = Join(TEXT_" ", type, name);
 		FString keyUnique = key;
-		for (int i = 1; i <= 100 && InnerErrors.Contains(keyUnique); ++i)
+		auto isTaken = [this](FString const& candidate)
+		{
+			return InnerErrors.ContainsByPredicate([&](FNamedError const& inner)
+			{
+				return inner.Key.Equals(candidate, ESearchCase::CaseSensitive);
+			});
+		};
+		for (int i = 1; i <= 100 && isTaken(keyUnique); ++i)
 		{
 			check(i < 100);
 			keyUnique = FMT_(key, i) "{0} {1}";
 		}
-		InnerErrors.Add(keyUnique, error);
+		InnerErrors.Emplace(MoveTemp(keyUnique), error);
 	}
 
 	void IError::AddAppendix(const FString& name, const FString& text, const FString& type)
@@ -80,22 +97,45 @@ namespace Mcro::Error
 		AddError(name, Make(new FBlueprintStackTrace()));
 	}
 
+	void IError::ResolveTextsSlow() const
+	{
+		// Deferred texts are resolved rarely (when an error is displayed or logged) so a single lock is enough for
+		// all errors, and it doesn't make every error bigger.
+		static FCriticalSection lock;
+		FScopeLock scope(&lock);
+		if (!bHasDeferredTexts) return;
+
+		if (DeferredMessage.IsSet())
+		{
+			Message = DeferredMessage->Resolve();
+			DeferredMessage.Reset();
+		}
+		if (DeferredDetails.IsSet())
+		{
+			Details = DeferredDetails->Resolve();
+			DeferredDetails.Reset();
+		}
+		ResolveDeferredTexts();
+		std::atomic_ref(bHasDeferredTexts).store(false, std::memory_order_release);
+	}
+
 	void IError::SerializeMembers(YAML::Emitter& emitter) const
 	{
-		if (bIsRoot)
+		ResolveTexts();
+		if (IsSerializedAsRoot())
 			emitter << YAML::Key << "Type" << YAML::Value << TypeName;
 		
 		if (Severity > EErrorSeverity::ErrorComponent)
 			emitter << YAML::Key << "Severity" << YAML::Value << Severity;
 		
 		if (!Message.IsEmpty())
-			emitter << YAML::Key << "Message" << YAML::Value << YAML::Literal << Message;
+			emitter << YAML::Key << "Message" << YAML::Value << YAML::Literal << Message.View();
 		
 		if (!Details.IsEmpty())
-			emitter << YAML::Key << "Details" << YAML::Value << YAML::Literal << Details;
+			emitter << YAML::Key << "Details" << YAML::Value << YAML::Literal << Details.View();
 		
 		if (!CodeContext.IsEmpty())
-			emitter << YAML::Key << "CodeContext" << YAML::Value << YAML::Literal << CodeContext;
+			emitter << YAML::Key << "CodeContext" << YAML::Value << YAML::Literal << CodeContext.View();
 	}
 
 	void IError::NotifyState(Observable::IState<IErrorPtr>& state)
@@ -124,15 +164,43 @@ namespace Mcro::Error
 
 	FString IError::ToString() const
 	{
-		return UTF8_TO_TCHAR(ToStringUtf8().c_str());
+		FPooledEmitter output;
+		SerializeYamlDocument(*output);
+		return output.ToString();
+	}
+
+	void IError::SerializeYamlDocument(YAML::Emitter& emitter) const
+	{
+		TGuardValue root(GSerializedRoot, this);
+		SerializeYaml(emitter);
 	}
 
 	std::string IError::ToStringUtf8() const
 	{
-		bIsRoot = true;
-		YAML::Emitter output;
-		SerializeYaml(output);
-		return output.c_str();
+		FPooledEmitter output;
+		SerializeYamlDocument(*output);
+		return output.ToStringUtf8();
+	}
+
+	namespace
+	{
+		thread_local FScopedErrorCapture* GErrorCapture = nullptr;
+	}
+
+	FScopedErrorCapture::FScopedErrorCapture()
+		: Outer(GErrorCapture)
+	{
+		GErrorCapture = this;
+	}
+
+	FScopedErrorCapture::~FScopedErrorCapture()
+	{
+		GErrorCapture = Outer;
+	}
+
+	void FScopedErrorCapture::Capture(IErrorRef const& error)
+	{
+		if (GErrorCapture) GErrorCapture->Errors.Add(error);
 	}
 
 	auto IError::OnErrorReported() -> TEventDelegate<void(IErrorRef)>&
@@ -160,6 +228,16 @@ namespace Mcro::Error
 		return FString::Join(GetErrorPropagation(), TEXT_"\n");
 	}
 
+	IErrorPtr IError::FindInnerError(FStringView name) const
+	{
+		ResolveTexts();
+		for (FNamedError const& inner : InnerErrors)
+		{
+			if (FStringView(inner.Key).Equals(name, ESearchCase::CaseSensitive)) return inner.Value;
+		}
+		return {};
+	}
+
 	FStringView IError::GetSeverityString() const
 	{
 		return EnumToStringView(Severity);
@@ -170,6 +248,20 @@ namespace Mcro::Error
 		return SNew(SErrorDisplay).Error(SharedThis(this));
 	}
 
+	IErrorRef FErrorCode::Promote() const
+	{
+		return IError::Make(new FErrorCodeError(Code))
+			->WithMessage(Message)
+			->WithSeverity(Severity)
+			->WithLocation(Location);
+	}
+
+	void FErrorCodeError::SerializeMembers(YAML::Emitter& emitter) const
+	{
+		IError::SerializeMembers(emitter);
+		emitter << YAML::Key << "Code" << YAML::Value << Code;
+	}
+
 	FUnavailable::FUnavailable()
 	{
 		Message = TEXT_"Attempted to access a resource which doesn't exist.";
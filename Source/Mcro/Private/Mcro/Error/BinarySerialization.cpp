@@ -0,0 +1,224 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Error/BinarySerialization.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Mcro/Yaml.h"
+
+#include <string>
+
+namespace Mcro::Error::Binary
+{
+	using namespace Mcro::Yaml;
+
+	namespace
+	{
+		enum class ERecordFlags : uint8
+		{
+			None = 0,
+			PlainText = 1 << 0
+		};
+		ENUM_CLASS_FLAGS(ERecordFlags)
+
+		// Guards decoding against malicious or corrupted streams nesting inner errors forever
+		constexpr int32 MaxDepth = 64;
+
+		// Guard decoding against corrupted lengths and counts forcing huge allocations. No sane error comes close.
+		constexpr int32 MaxTextLength = 1 << 20;
+		constexpr int32 MaxRecordCount = 1 << 16;
+
+		bool IsValidCount(int32 count) { return count >= 0 && count <= MaxRecordCount; }
+
+		void WriteUtf8(FArchive& archive, const char* text)
+		{
+			int32 length = static_cast<int32>(FCStringAnsi::Strlen(text));
+			archive << length;
+			archive.Serialize(const_cast<char*>(text), length);
+		}
+
+		bool ReadUtf8(FArchive& archive, std::string& text)
+		{
+			int32 length = 0;
+			archive << length;
+			if (archive.IsError() || length < 0 || length > MaxTextLength)
+				return false;
+
+			// Streaming archives may not know their size
+			const int64 totalSize = archive.TotalSize();
+			if (totalSize >= 0 && length > totalSize - archive.Tell())
+				return false;
+			text.resize(length);
+			archive.Serialize(text.data(), length);
+			return !archive.IsError();
+		}
+
+		// Saving archives don't modify their input, this avoids copying every text of the error
+		FString& Saved(FString const& text) { return const_cast<FString&>(text); }
+
+		void EncodeRecord(FArchive& archive, IError const& error)
+		{
+			ERecordFlags flags = error.IsPlainText() ? ERecordFlags::PlainText : ERecordFlags::None;
+			archive << flags;
+
+			FString type = error.GetTypeString();
+			archive << type << Saved(error.GetMessage());
+			if (EnumHasAnyFlags(flags, ERecordFlags::PlainText))
+				return;
+
+			int8 severity = static_cast<int8>(error.GetSeverity());
+			archive << severity << Saved(error.GetDetails()) << Saved(error.GetCodeContext());
+
+			auto const& propagation = error.GetErrorPropagationLocations();
+			int32 propagationCount = propagation.Num();
+			archive << propagationCount;
+			for (auto const& at : propagation)
+			{
+				WriteUtf8(archive, at.function_name());
+				WriteUtf8(archive, at.file_name());
+				uint32 line = at.line();
+				archive << line;
+			}
+
+			int32 innerCount = error.GetInnerErrorCount();
+			archive << innerCount;
+			for (auto const& inner : error.GetInnerErrors())
+			{
+				archive << Saved(inner.Key);
+				EncodeRecord(archive, inner.Value.Get());
+			}
+		}
+
+		bool DecodeRecord(FArchive& archive, YAML::Emitter& emitter, bool isRoot, int32 depth)
+		{
+			if (depth > MaxDepth) return false;
+
+			ERecordFlags flags;
+			FString type, message;
+			archive << flags << type << message;
+			if (archive.IsError()) return false;
+
+			if (EnumHasAnyFlags(flags, ERecordFlags::PlainText))
+			{
+				emitter << YAML::Literal << message;
+				return true;
+			}
+
+			int8 severity;
+			FString details, codeContext;
+			int32 propagationCount;
+			archive << severity << details << codeContext << propagationCount;
+			if (archive.IsError() || !IsValidCount(propagationCount)) return false;
+
+			FMap errorMap(emitter);
+			if (isRoot)
+				emitter << YAML::Key << "Type" << YAML::Value << type;
+
+			if (static_cast<EErrorSeverity>(severity) > EErrorSeverity::ErrorComponent)
+				emitter << YAML::Key << "Severity" << YAML::Value << static_cast<EErrorSeverity>(severity);
+
+			if (!message.IsEmpty())
+				emitter << YAML::Key << "Message" << YAML::Value << YAML::Literal << message;
+
+			if (!details.IsEmpty())
+				emitter << YAML::Key << "Details" << YAML::Value << YAML::Literal << details;
+
+			if (!codeContext.IsEmpty())
+				emitter << YAML::Key << "CodeContext" << YAML::Value << YAML::Literal << codeContext;
+
+			if (propagationCount > 0)
+			{
+				emitter << YAML::Key << "ErrorPropagation" << YAML::Value;
+				FSeq seq(emitter);
+				std::string function, file;
+				for (int32 i = 0; i < propagationCount; ++i)
+				{
+					uint32 line = 0;
+					if (!ReadUtf8(archive, function) || !ReadUtf8(archive, file)) return false;
+					archive << line;
+					emitter << function + " @ " + file + " : " + std::to_string(line);
+				}
+			}
+
+			int32 innerCount;
+			archive << innerCount;
+			if (archive.IsError() || !IsValidCount(innerCount)) return false;
+			if (innerCount > 0)
+			{
+				emitter << YAML::Key << "InnerErrors" << YAML::Value;
+				FMap innerErrors(emitter);
+				for (int32 i = 0; i < innerCount; ++i)
+				{
+					FString key;
+					archive << key;
+					if (archive.IsError()) return false;
+					emitter << YAML::Key << key << YAML::Value;
+					if (!DecodeRecord(archive, emitter, false, depth + 1)) return false;
+				}
+			}
+			return !archive.IsError();
+		}
+	}
+
+	void Encode(FArchive& archive, IErrorRef const& error)
+	{
+		check(archive.IsSaving());
+		uint32 magic = Magic;
+		uint16 version = Version;
+		archive << magic << version;
+		EncodeRecord(archive, error.Get());
+	}
+
+	TArray<uint8> Encode(IErrorRef const& error)
+	{
+		TArray<uint8> result;
+		FMemoryWriter writer(result);
+		Encode(writer, error);
+		return result;
+	}
+
+	FCanFail DecodeToYaml(FArchive& archive, YAML::Emitter& emitter)
+	{
+		check(archive.IsLoading());
+		uint32 magic = 0;
+		uint16 version = 0;
+		archive << magic << version;
+		if (archive.IsError() || magic != Magic)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"The input is not a binary encoded error");
+
+		if (version > Version)
+			return IError::Make(new FAssertion())
+				->WithMessageF(TEXT_"Binary encoded error has version {0}, but only {1} is supported", version, Version);
+
+		// FString serialization rejects longer strings
+		const int64 callerMaxSize = archive.GetMaxSerializeSize();
+		TGuardValue maxSerializeSize(
+			archive.ArMaxSerializeSize,
+			callerMaxSize > 0 ? FMath::Min<int64>(callerMaxSize, MaxTextLength) : MaxTextLength
+		);
+		if (!DecodeRecord(archive, emitter, true, 0))
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Binary encoded error is truncated or corrupted");
+
+		return Success();
+	}
+
+	TMaybe<FString> DecodeToYaml(TArrayView<const uint8> data)
+	{
+		FMemoryReaderView reader(TArrayView64<const uint8>(data.GetData(), data.Num()));
+		FPooledEmitter emitter;
+		if (auto result = DecodeToYaml(reader, *emitter); result.HasError())
+			return result.GetErrorRef();
+		return emitter.ToString();
+	}
+}
@@ -9,6 +9,7 @@
  *  @date 2025
  */
 
+
 #include "Mcro/Error/BlueprintStackTrace.h"
 #include "UObject/Script.h"
 #include "UObject/Stack.h"
@@ -21,15 +22,14 @@ namespace Mcro::Error
 		if (const FBlueprintContextTracker* bpCtxTracker = FBlueprintContextTracker::TryGet())
 		{
 			TArrayView<const FFrame* const> rawStack = bpCtxTracker->GetCurrentScriptStack();
-			TStringBuilder<4096> scriptStack;
-			scriptStack << TEXT_"\n\nScript Stack (" << rawStack.Num() << TEXT_" frames)\n";
-
-			for (int32 frame = rawStack.Num() - 1; frame >= 0; --frame)
-			{
-				rawStack[frame]->GetStackDescription(scriptStack);
-				scriptStack << TEXT_"\n";
-			}
-			Message = *scriptStack;
+			TotalFrames = rawStack.Num();
+			
+			const int32 captured = FMath::Min(TotalFrames, MaxDepth);
+			Frames.Reserve(captured);
+			for (int32 frame = TotalFrames - 1; frame >= TotalFrames - captured; --frame)
+				Frames.Emplace(rawStack[frame]->Node);
+			
+			bHasDeferredTexts = true;
 		}
 		else
 		{
@@ -39,4 +39,24 @@ namespace Mcro::Error
 		Message = TEXT_"Blueprint stack trace is not available in Shipping or Test configurations";
 #endif
 	}
+
+	void FBlueprintStackTrace::ResolveDeferredTexts() const
+	{
+		TStringBuilder<4096> scriptStack;
+		scriptStack << TEXT_"\n\nScript Stack (" << TotalFrames << TEXT_" frames)\n";
+
+		// Same as FFrame::GetStackDescription
+		for (TWeakObjectPtr<const UFunction> const& frame : Frames)
+		{
+			if (const UFunction* function = frame.Get())
+				scriptStack << function->GetOuter()->GetName() << TEXT_"." << function->GetName();
+			else
+				scriptStack << TEXT_"<function is no longer available>";
+			scriptStack << TEXT_"\n";
+		}
+		if (TotalFrames > Frames.Num())
+			scriptStack << TEXT_"(" << TotalFrames - Frames.Num() << TEXT_" more frames)\n";
+		
+		Message = *scriptStack;
+	}
 }
@@ -9,28 +9,84 @@
  *  @date 2025
  */
 
+
 #include "Mcro/Error/CppStackTrace.h"
 #include "HAL/PlatformStackWalk.h"
-#include "Stats/StatsMisc.h"
+#include "Misc/ScopeLock.h"
 
 namespace Mcro::Error
 {
+	namespace
+	{
+		struct FSymbolCache
+		{
+			FCriticalSection Lock;
+			TMap<uint64, FString> Symbols;
+			bool bInitialized = false;
+
+			static FSymbolCache& Get()
+			{
+				static FSymbolCache cache;
+				return cache;
+			}
+
+			FString const& Resolve(uint64 programCounter)
+			{
+				if (FString const* cached = Symbols.Find(programCounter))
+					return *cached;
+
+				if (!bInitialized)
+				{
+					FPlatformStackWalk::InitStackWalking();
+					bInitialized = true;
+				}
+
+				FProgramCounterSymbolInfo info;
+				FPlatformStackWalk::ProgramCounterToSymbolInfo(programCounter, info);
+
+				FString symbol = FString::Printf(TEXT_"0x%016llx %s!%s",
+					programCounter,
+					ANSI_TO_TCHAR(info.ModuleName),
+					info.FunctionName[0] ? ANSI_TO_TCHAR(info.FunctionName) : TEXT_"UnknownFunction"
+				);
+				if (info.Filename[0])
+					symbol += FString::Printf(TEXT_" [%s:%d]", ANSI_TO_TCHAR(info.Filename), info.LineNumber);
+				
+				return Symbols.Add(programCounter, MoveTemp(symbol));
+			}
+		};
+	}
+	
 	FCppStackTrace::FCppStackTrace(int32 numAdditionalStackFramesToIgnore, bool fastWalk, int32 stackFramesIgnoreDefaultOffset)
 	{
-		// Walk the stack and dump it to the allocated memory.
-		const SIZE_T stackTraceSize = 65535;
-		ANSICHAR* stackTrace = (ANSICHAR*)FMemory::SystemMalloc(stackTraceSize);
+		// CaptureStackBackTrace reports itself too
+		constexpr int32 captureFrames = 1;
 		
-#if STATS
-		SCOPE_LOG_TIME_IN_SECONDS(TEXT_"FPlatformStackWalk::StackWalkAndDump", nullptr)
-#endif
-		stackTrace[0] = 0;
-		FPlatformStackWalk::StackWalkAndDumpEx(
-			stackTrace, stackTraceSize, numAdditionalStackFramesToIgnore + stackFramesIgnoreDefaultOffset,
-			fastWalk
-				? FPlatformStackWalk::EStackWalkFlags::FastStackWalk
-				: FPlatformStackWalk::EStackWalkFlags::AccurateStackWalk
+		Depth = static_cast<int32>(FPlatformStackWalk::CaptureStackBackTrace(ProgramCounters, MaxDepth));
+		FramesToIgnore = FMath::Clamp(
+			numAdditionalStackFramesToIgnore + stackFramesIgnoreDefaultOffset + captureFrames,
+			0, Depth
 		);
-		Message = ANSI_TO_TCHAR(stackTrace);
+		bHasDeferredTexts = true;
+	}
+
+	TArrayView<const uint64> FCppStackTrace::GetProgramCounters() const
+	{
+		return TArrayView<const uint64>(ProgramCounters + FramesToIgnore, Depth - FramesToIgnore);
+	}
+
+	void FCppStackTrace::ResolveDeferredTexts() const
+	{
+		auto& cache = FSymbolCache::Get();
+		FScopeLock lock(&cache.Lock);
+
+		TStringBuilder<4096> builder;
+		int32 frame = 0;
+		for (uint64 programCounter : GetProgramCounters())
+		{
+			if (frame > 0) builder << TEXT_"\n";
+			builder << TEXT_"[" << frame++ << TEXT_"] " << cache.Resolve(programCounter);
+		}
+		Message = builder.ToString();
 	}
 }
@@ -0,0 +1,132 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Error/ErrorFrequency.h"
+#include "Algo/Sort.h"
+#include "Mcro/Yaml.h"
+
+namespace Mcro::Error
+{
+	using namespace Mcro::Yaml;
+
+	namespace Detail
+	{
+		bool ShouldLogErrorOccurrence(IError const& error)
+		{
+			return FErrorFrequency::Get().ShouldLog(error);
+		}
+	}
+
+	FErrorFrequency& FErrorFrequency::Get()
+	{
+		static FErrorFrequency Singleton {};
+		return Singleton;
+	}
+
+	uint32 FErrorFrequency::Record(uint64 signature, FType const& type, std::source_location const& location)
+	{
+		// Open addressing with linear probing, slots are never removed so a probe can stop at the first empty one
+		for (int32 probe = 0, i = static_cast<int32>(signature % Capacity); probe < Capacity; ++probe, i = (i + 1) % Capacity)
+		{
+			FSlot& slot = Slots[i];
+			uint64 existing = slot.Signature.load(std::memory_order_acquire);
+			if (existing == 0)
+			{
+				if (slot.Signature.compare_exchange_strong(existing, signature, std::memory_order_acq_rel))
+				{
+					slot.Type = type;
+					slot.Location = location;
+					slot.bPublished.store(true, std::memory_order_release);
+					return slot.Count.fetch_add(1, std::memory_order_relaxed) + 1;
+				}
+			}
+			if (existing == signature)
+				return slot.Count.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+		Overflow.fetch_add(1, std::memory_order_relaxed);
+		return 0;
+	}
+
+	uint32 FErrorFrequency::Record(IError const& error)
+	{
+		auto const& propagation = error.GetErrorPropagationLocations();
+		return Record(
+			error.GetSignature(),
+			error.GetType(),
+			propagation.IsEmpty() ? std::source_location() : propagation[0]
+		);
+	}
+
+	bool FErrorFrequency::ShouldLog(IError const& error)
+	{
+		const uint32 count = Record(error);
+		return count <= MaxLoggedOccurrences.load(std::memory_order_relaxed);
+	}
+
+	const FErrorFrequency::FSlot* FErrorFrequency::FindSlot(uint64 signature) const
+	{
+		for (int32 probe = 0, i = static_cast<int32>(signature % Capacity); probe < Capacity; ++probe, i = (i + 1) % Capacity)
+		{
+			const uint64 existing = Slots[i].Signature.load(std::memory_order_acquire);
+			if (existing == signature) return &Slots[i];
+			if (existing == 0) return nullptr;
+		}
+		return nullptr;
+	}
+
+	uint32 FErrorFrequency::GetCount(uint64 signature) const
+	{
+		const FSlot* slot = FindSlot(signature);
+		return slot ? slot->Count.load(std::memory_order_relaxed) : 0;
+	}
+
+	TArray<FErrorFrequencyEntry> FErrorFrequency::Export() const
+	{
+		TArray<FErrorFrequencyEntry> result;
+		for (FSlot const& slot : Slots)
+		{
+			if (!slot.bPublished.load(std::memory_order_acquire)) continue;
+			result.Add({
+				.Signature = slot.Signature.load(std::memory_order_relaxed),
+				.Type = slot.Type,
+				.Location = slot.Location,
+				.Count = slot.Count.load(std::memory_order_relaxed)
+			});
+		}
+		Algo::SortBy(result, &FErrorFrequencyEntry::Count, TGreater());
+		return result;
+	}
+
+	void FErrorFrequency::SerializeYaml(YAML::Emitter& emitter) const
+	{
+		FSeq seq(emitter);
+		for (FErrorFrequencyEntry const& entry : Export())
+		{
+			FMap map(emitter);
+			emitter << YAML::Key << "Signature" << YAML::Value << YAML::Hex << entry.Signature << YAML::Dec;
+			emitter << YAML::Key << "Type" << YAML::Value << entry.Type.ToStringCopy();
+			if (*entry.Location.file_name())
+			{
+				std::string location = std::string(entry.Location.file_name()) + " : " + std::to_string(entry.Location.line());
+				emitter << YAML::Key << "Location" << YAML::Value << location;
+			}
+			emitter << YAML::Key << "Count" << YAML::Value << entry.Count;
+		}
+	}
+
+	FString FErrorFrequency::ToString() const
+	{
+		FPooledEmitter emitter;
+		SerializeYaml(*emitter);
+		return emitter.ToString();
+	}
+}
@@ -0,0 +1,254 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Error/ErrorJournal.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Mcro/Delegates/DelegateFrom.h"
+#include "Mcro/Yaml.h"
+
+namespace Mcro::Error
+{
+	using namespace Mcro::Delegates::InferDelegate;
+
+	namespace
+	{
+		const TCHAR* GetSeverityName(EErrorSeverity severity)
+		{
+			switch (severity)
+			{
+			case EErrorSeverity::ErrorComponent: return TEXT_"ErrorComponent";
+			case EErrorSeverity::Recoverable:    return TEXT_"Recoverable";
+			case EErrorSeverity::Fatal:          return TEXT_"Fatal";
+			case EErrorSeverity::Crashing:       return TEXT_"Crashing";
+			}
+			return TEXT_"Unknown";
+		}
+	}
+	
+	FErrorJournal::FErrorJournal(FErrorJournalSettings const& settings)
+		: Settings(settings)
+	{
+		if (Settings.Directory.IsEmpty())
+			Settings.Directory = FPaths::ProjectSavedDir() / TEXT_"Logs" / TEXT_"Errors";
+		Settings.MaxQueuedErrors = FMath::Max(Settings.MaxQueuedErrors, 1);
+
+		IPlatformFile::GetPlatformPhysical().CreateDirectoryTree(*Settings.Directory);
+		
+		if (Settings.bListenToReportedErrors)
+		{
+			ReportedHandle = IError::OnErrorReported().Add(From([this](IErrorRef error)
+			{
+				Submit(error);
+			}));
+		}
+		SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddRaw(this, &FErrorJournal::DumpUnwrittenLowLevel);
+
+		if (Settings.bUseWorkerThread)
+		{
+			WakeUp = FPlatformProcess::GetSynchEventFromPool();
+			Thread = FRunnableThread::Create(this, TEXT_"Mcro.ErrorJournal", 0, TPri_BelowNormal);
+		}
+	}
+
+	FErrorJournal::~FErrorJournal()
+	{
+		if (ReportedHandle.IsValid()) IError::OnErrorReported().Remove(ReportedHandle);
+		FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+		}
+		if (WakeUp) FPlatformProcess::ReturnSynchEventToPool(WakeUp);
+		Flush();
+	}
+
+	void FErrorJournal::Submit(IErrorRef const& error)
+	{
+		{
+			FScopeLock lock(&QueueLock);
+			if (Queue.Num() >= Settings.MaxQueuedErrors)
+			{
+				++DroppedCount;
+				++UnreportedDropCount;
+				if (Settings.DropPolicy == EErrorJournalDropPolicy::DropNewest)
+					return;
+				Queue.RemoveAt(0, EAllowShrinking::No);
+			}
+			Queue.Add(error);
+
+			const uint64 sequence = SubmittedSequence.load(std::memory_order_relaxed) + 1;
+			FCrashSummary& summary = CrashSummaries[sequence % CrashSummaryCapacity];
+			summary.Sequence.store(0, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			summary.Type = error->GetTypeFName().GetDisplayIndex();
+			summary.TypeNumber = error->GetTypeFName().GetNumber();
+			summary.Severity = error->GetSeverity();
+			summary.Sequence.store(sequence, std::memory_order_release);
+			SubmittedSequence.store(sequence, std::memory_order_release);
+		}
+		if (WakeUp) WakeUp->Trigger();
+	}
+
+	void FErrorJournal::Flush()
+	{
+		WriteQueued();
+		FScopeLock lock(&FileLock);
+		if (File) File->Flush();
+	}
+
+	int32 FErrorJournal::GetDroppedCount() const
+	{
+		FScopeLock lock(&QueueLock);
+		return DroppedCount;
+	}
+
+	FString FErrorJournal::GetCurrentFilePath() const
+	{
+		return GetFilePath(0);
+	}
+
+	uint32 FErrorJournal::Run()
+	{
+		while (!bStopping)
+		{
+			WakeUp->Wait(FTimespan::FromSeconds(1));
+			WriteQueued();
+		}
+		return 0;
+	}
+
+	void FErrorJournal::Stop()
+	{
+		bStopping = true;
+		WakeUp->Trigger();
+	}
+
+	FString FErrorJournal::GetFilePath(int32 rotation) const
+	{
+		return rotation == 0
+			? Settings.Directory / Settings.BaseName + TEXT_".yaml"
+			: Settings.Directory / FString::Printf(TEXT_"%s.%d.yaml", *Settings.BaseName, rotation);
+	}
+
+	void FErrorJournal::WriteQueued()
+	{
+		TArray<IErrorRef> queue;
+		int32 dropped;
+		uint64 sequence;
+		{
+			FScopeLock lock(&QueueLock);
+			queue = MoveTemp(Queue);
+			dropped = UnreportedDropCount;
+			UnreportedDropCount = 0;
+			sequence = SubmittedSequence.load(std::memory_order_relaxed);
+		}
+		if (queue.IsEmpty() && dropped == 0) return;
+
+		FScopeLock lock(&FileLock);
+		if (dropped > 0)
+		{
+			Write(IError::Make(new FAssertion())
+				->WithMessageF(TEXT_"{0} errors were dropped from the journal because its queue was full", dropped)
+			);
+		}
+		for (IErrorRef const& error : queue)
+			Write(error);
+		WrittenSequence.store(sequence, std::memory_order_release);
+	}
+
+	void FErrorJournal::Write(IErrorRef const& error)
+	{
+		if (!File)
+		{
+			File.Reset(IPlatformFile::GetPlatformPhysical().OpenWrite(*GetCurrentFilePath(), true));
+			if (!File) return;
+		}
+		
+		const std::string header = "--- # " + std::string(TCHAR_TO_UTF8(*FDateTime::UtcNow().ToIso8601())) + "\n";
+		File->Write(reinterpret_cast<const uint8*>(header.data()), header.size());
+		{
+			// Large error trees are streamed into the file in chunks instead of being rendered into a string first
+			Yaml::FStreamingEmitter emitter(*File);
+			error->SerializeYamlDocument(emitter);
+		}
+		File->Write(reinterpret_cast<const uint8*>("\n"), 1);
+
+		if (File->Size() >= Settings.MaxFileSize)
+			Rotate();
+	}
+
+	void FErrorJournal::DumpUnwrittenLowLevel()
+	{
+		const uint64 submitted = SubmittedSequence.load(std::memory_order_acquire);
+		const uint64 written = WrittenSequence.load(std::memory_order_acquire);
+		if (submitted <= written) return;
+
+		const uint64 oldestKept = submitted >= CrashSummaryCapacity ? submitted - CrashSummaryCapacity + 1 : 1;
+		const uint64 first = FMath::Max(written + 1, oldestKept);
+		FCString::Snprintf(CrashLine, UE_ARRAY_COUNT(CrashLine),
+			TEXT_"MCRO error journal, %llu errors were not written, the most recent ones:\n",
+			submitted - written
+		);
+		FPlatformMisc::LowLevelOutputDebugString(CrashLine);
+
+		TCHAR typeName[NAME_SIZE];
+		for (uint64 sequence = first; sequence <= submitted; ++sequence)
+		{
+			FCrashSummary const& summary = CrashSummaries[sequence % CrashSummaryCapacity];
+			if (summary.Sequence.load(std::memory_order_acquire) != sequence) continue;
+
+			const FNameEntryId type = summary.Type;
+			const int32 typeNumber = summary.TypeNumber;
+			const EErrorSeverity severity = summary.Severity;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (summary.Sequence.load(std::memory_order_relaxed) != sequence) continue;
+
+			typeName[0] = TCHAR(0);
+			if (const FNameEntry* entry = FName::GetEntry(type))
+				entry->GetName(typeName);
+			if (typeNumber == NAME_NO_NUMBER_INTERNAL)
+			{
+				FCString::Snprintf(CrashLine, UE_ARRAY_COUNT(CrashLine), TEXT_"  #%llu %s (%s)\n",
+					sequence, typeName, GetSeverityName(severity)
+				);
+			}
+			else
+			{
+				FCString::Snprintf(CrashLine, UE_ARRAY_COUNT(CrashLine), TEXT_"  #%llu %s_%d (%s)\n",
+					sequence, typeName, NAME_INTERNAL_TO_EXTERNAL(typeNumber), GetSeverityName(severity)
+				);
+			}
+			FPlatformMisc::LowLevelOutputDebugString(CrashLine);
+		}
+	}
+
+	void FErrorJournal::Rotate()
+	{
+		File.Reset();
+		IPlatformFile& platformFile = IPlatformFile::GetPlatformPhysical();
+		
+		platformFile.DeleteFile(*GetFilePath(Settings.MaxRotatedFiles));
+		for (int32 i = Settings.MaxRotatedFiles - 1; i >= 0; --i)
+		{
+			FString source = GetFilePath(i);
+			if (platformFile.FileExists(*source))
+				platformFile.MoveFile(*GetFilePath(i + 1), *source);
+		}
+	}
+}
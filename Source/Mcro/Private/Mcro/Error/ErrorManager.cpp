@@ -12,12 +12,15 @@
 #include "Mcro/Error/ErrorManager.h"
 #include "Mcro/Error/SErrorDisplay.h"
 #include "Mcro/Threading.h"
+#include "Mcro/Finally.h"
 #include "Mcro/FmtMacros.h"
 #include "Mcro/Range.h"
 #include "Mcro/Range/Conversion.h"
 #include "Mcro/Range/Views.h"
 
 #include "HAL/PlatformApplicationMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
 #include "Engine/Engine.h"
 #include "Engine/GameViewportClient.h"
 #include "Framework/Application/SlateApplication.h"
@@ -54,32 +57,68 @@ namespace Mcro::Error
 		int32 FontSize = 14;
 	};
 
-	auto FErrorManager::DisplayError(IErrorRef const& error, FDisplayErrorArgs const& args) -> TFuture<EDisplayErrorResult>
+	uint64 FErrorManager::GetErrorSignature(IErrorRef const& error)
 	{
-		UE_CLOG(
-			args.bLogError,
-			LogErrorManager, Error,
-			TEXT_"Displaying error %s:",
-			*error->GetType().ToStringCopy()
+		return error->GetSignature();
+	}
+
+	void FErrorManager::LogError(IErrorRef const& error, uint64 signature)
+	{
+		int32 omitted;
+		{
+			FScopeLock lock(&QueueLock);
+			FLogRecord& record = LogRecords.FindOrAdd(signature);
+			const double now = FPlatformTime::Seconds();
+			if (record.LastLogged > 0.0 && now - record.LastLogged < LogRateLimit.GetTotalSeconds())
+			{
+				++record.Omitted;
+				return;
+			}
+			record.LastLogged = now;
+			omitted = record.Omitted;
+			record.Omitted = 0;
+		}
+		
+		UE_LOG(LogErrorManager, Error, TEXT_"Displaying error %s:", *error->GetType().ToStringCopy());
+		UE_CLOG(omitted > 0, LogErrorManager, Error,
+			TEXT_"(%d more errors with the same signature were not logged since the last one)", omitted
 		);
-		ERROR_CLOG(args.bLogError && !bIsDisplayingError, LogErrorManager, Error, error);
+		// Not using ERROR_LOG as the occurrence of this error is already counted by DisplayError
+		UE_LOG(LogErrorManager, Error, TEXT_"%s", *error->WithLocation()->Report()->ToString());
+	}
+
+	auto FErrorManager::DisplayError(IErrorRef const& error, FDisplayErrorArgs const& args) -> TFuture<EDisplayErrorResult>
+	{
+		if (!FErrorFrequency::Get().ShouldLog(error.Get()))
+			return MakeFulfilledPromise<EDisplayErrorResult>(Suppressed_TooFrequent).GetFuture();
+
+		return DisplayError_Counted(error, args);
+	}
+
+	auto FErrorManager::DisplayError_Counted(IErrorRef const& error, FDisplayErrorArgs const& args) -> TFuture<EDisplayErrorResult>
+	{
+		const uint64 signature = GetErrorSignature(error);
+		if (args.bLogError) LogError(error, signature);
 		if (args.bBreakDebugger)
 		{
 			UE_DEBUG_BREAK();
 		}
 
-		if (bIsDisplayingError)
 		{
-			UE_LOG(LogErrorManager, Warning, TEXT_
-				"Another error is already being displayed. Suppressing this one."
-				" If multiple things can go wrong in quick succession please organize them into one aggregate error,"
-				" and display that."
-			);
-
-			// TODO: deal with this situation more automatically
-			return MakeFulfilledPromise<EDisplayErrorResult>(Suppressed_AnotherErrorOpen).GetFuture();
+			FScopeLock lock(&QueueLock);
+			if (bIsDisplayingError)
+			{
+				FQueuedError* queued = QueuedErrors.FindByPredicate([&](FQueuedError const& i)
+				{
+					return i.Signature == signature;
+				});
+				if (queued) ++queued->Count;
+				else QueuedErrors.Add({ error, args, signature, 1 });
+				
+				return MakeFulfilledPromise<EDisplayErrorResult>(Suppressed_AnotherErrorOpen).GetFuture();
+			}
+			bIsDisplayingError = true;
 		}
-		bIsDisplayingError = true;
 		auto result = Threading::PromiseInGameThread([=, this]
 		{
 			return DisplayError_MainThread(error, args);
@@ -94,6 +133,16 @@ namespace Mcro::Error
 		
 		decltype(auto) slate = FSlateApplication::Get();
 		auto canInferParentWidget = [&] { return args.Parent.IsValid() || InferParentWidget().IsValid(); };
+
+		// The display slot taken in DisplayError_Counted is released by the window when it's closed, or here when
+		// no window could be opened
+		bool displayed = false;
+		auto releaseDisplay = FINALLY(this, &displayed)
+		{
+			if (displayed) return;
+			FScopeLock lock(&QueueLock);
+			bIsDisplayingError = false;
+		};
 		
 		if (!slate.CanAddModalWindow() || IsEngineExitRequested() || !canInferParentWidget())
 		{
@@ -102,8 +151,8 @@ namespace Mcro::Error
 
 		TSharedPtr<const SWidget> parent = args.Parent ? args.Parent : InferParentWidget();
 		
-		auto allExtensions = IErrorWindowExtension::GetAll();
-		auto extensions = allExtensions
+		auto allExtensions = IErrorWindowExtension::GetAllView();
+		auto extensions = allExtensions.GetView()
 			| rv::filter([error, &args](IErrorWindowExtension* i) { return i->SupportsError(error, args); })
 			| RenderAs<TArray>()
 		;
@@ -324,10 +373,15 @@ namespace Mcro::Error
 		ModalWindow->SetOnWindowClosed(From([this](TSharedRef<SWindow> const& window)
 		{
 			ModalWindow.Reset();
-			bIsDisplayingError = false;
+			{
+				FScopeLock lock(&QueueLock);
+				bIsDisplayingError = false;
+			}
 			OnErrorDialogDismissed.Broadcast();
+			DisplayQueuedErrors();
 		}));
 		
+		displayed = true;
 		if (args.bAsync)
 			slate.AddWindow(ModalWindow.ToSharedRef(), true);
 		else
@@ -336,6 +390,43 @@ namespace Mcro::Error
 		return Displayed;
 	}
 
+	void FErrorManager::DisplayQueuedErrors()
+	{
+		TArray<FQueuedError> queued;
+		{
+			FScopeLock lock(&QueueLock);
+			queued = MoveTemp(QueuedErrors);
+		}
+		if (queued.IsEmpty()) return;
+
+		FDisplayErrorArgs args = queued[0].Args;
+		args.bLogError = false;
+		args.bBreakDebugger = false;
+		for (FQueuedError const& item : queued)
+			args.bImportantToRead |= item.Args.bImportantToRead;
+		
+		if (queued.Num() == 1 && queued[0].Count == 1)
+		{
+			DisplayError_Counted(queued[0].Error, args);
+			return;
+		}
+		
+		int32 total = 0;
+		auto aggregate = IError::Make(new FAggregateError());
+		for (FQueuedError const& item : queued)
+		{
+			total += item.Count;
+			aggregate->WithError(TEXT_"{0} (x{1})" _FMT(item.Error->GetType(), item.Count), item.Error);
+			if (item.Error->GetSeverity() > aggregate->GetSeverity())
+				aggregate->WithSeverity(item.Error->GetSeverity());
+		}
+		aggregate->WithMessageF(
+			TEXT_"{0} errors of {1} kinds occurred while another error was displayed.",
+			total, queued.Num()
+		);
+		DisplayError_Counted(aggregate, args);
+	}
+
 	auto FErrorManager::InferParentWidget() -> TSharedPtr<const SWidget>
 	{
 		TSharedPtr<SWindow> parentWindow = FSlateApplication::Get().GetActiveTopLevelRegularWindow();
@@ -15,6 +15,8 @@
 #include "Mcro/Range/Views.h"
 
 #include "SlateOptMacros.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Views/STableRow.h"
 
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
@@ -28,8 +30,8 @@ namespace Mcro::Error
 		namespace rv = ranges::views;
 
 		auto error = inArgs._Error.ToSharedRef();
-		auto allExtensions = IErrorDisplayExtension::GetAll();
-		auto extensions = allExtensions
+		auto allExtensions = IErrorDisplayExtension::GetAllView();
+		auto extensions = allExtensions.GetView()
 			| rv::filter([error](IErrorDisplayExtension* i) { return i->SupportsError(error); })
 			| RenderAs<TArray>()
 		;
@@ -69,7 +71,13 @@ namespace Mcro::Error
 				}
 			)
 			
-			+ Row()[ ExpandableTextWidget(INVTEXT_"Further details", inArgs._Error->GetDetails()) ]
+			+ Row()
+			[
+				LazyExpandableTextWidget(INVTEXT_"Further details",
+					[error] { return error->GetDetails(); },
+					!error->GetDetailsText().IsEmpty()
+				)
+			]
 			+ Row()[ inArgs._PostDetails.Widget ]
 			+ TSlots(
 				extensions
@@ -101,7 +109,13 @@ namespace Mcro::Error
 				}
 			)
 			
-			+ Row()[ ExpandableTextWidget(INVTEXT_"Error Propagation", inArgs._Error->GetErrorPropagationJoined()) ]
+			+ Row()
+			[
+				LazyExpandableTextWidget(INVTEXT_"Error Propagation",
+					[error] { return error->GetErrorPropagationJoined(); },
+					!error->GetErrorPropagationLocations().IsEmpty()
+				)
+			]
 			+ Row()[ inArgs._PostErrorPropagation.Widget ]
 			+ TSlots(
 				extensions
@@ -117,20 +131,7 @@ namespace Mcro::Error
 				}
 			)
 			
-			+ TSlots(error.Get(), [&](const FNamedError& inner)
-			{
-				return MoveTemp(Row()
-				[
-					SNew(SExpandableArea)
-					. AreaTitle(FText::FromString(inner.Key))
-					. InitiallyCollapsed(true)
-					. Padding(FMargin(20, 0, 0, 0))
-					. BodyContent()
-					[
-						inner.Value->CreateErrorWidget()
-					]
-				]);
-			})
+			+ Row()[ InnerErrorsWidget(error) ]
 			+ Row()[ inArgs._PostInnerErrors.Widget ]
 			+ TSlots(
 				extensions
@@ -205,6 +206,81 @@ namespace Mcro::Error
 		return SNew(SExpandableArea) / ExpandableText(title, text);
 	}
 
+	auto SErrorDisplay::LazyExpandableWidget(
+		const FText& title,
+		TFunction<TSharedRef<SWidget>()>&& createBody,
+		bool initiallyExpanded,
+		TFunction<void(bool)>&& onExpansionChanged
+	) -> TSharedRef<SExpandableArea>
+	{
+		TSharedRef<SBox> body = SNew(SBox);
+		auto materialize = [body, create = MoveTemp(createBody)]() mutable
+		{
+			if (create)
+			{
+				body->SetContent(create());
+				create.Reset();
+			}
+		};
+		if (initiallyExpanded) materialize();
+		
+		return SNew(SExpandableArea)
+			. AreaTitle(title)
+			. InitiallyCollapsed(!initiallyExpanded)
+			. OnAreaExpansionChanged_Lambda([materialize = MoveTemp(materialize), notify = MoveTemp(onExpansionChanged)](bool expanded) mutable
+			{
+				if (expanded) materialize();
+				if (notify) notify(expanded);
+			})
+			. BodyContent()
+			[
+				body
+			];
+	}
+
+	auto SErrorDisplay::LazyExpandableTextWidget(const FText& title, TFunction<FString()>&& getText, bool visible) -> TSharedRef<SExpandableArea>
+	{
+		auto result = LazyExpandableWidget(title, [get = MoveTemp(getText)]() -> TSharedRef<SWidget>
+		{
+			return SNew(SEditableTextBox) / Text(get());
+		});
+		result->SetVisibility(IsVisible(visible));
+		return result;
+	}
+
+	auto SErrorDisplay::InnerErrorsWidget(IErrorRef const& error) -> TSharedRef<SWidget>
+	{
+		if (error->GetInnerErrorCount() == 0) return SNullWidget::NullWidget;
+
+		InnerErrorItems.Reset(error->GetInnerErrorCount());
+		for (FNamedError const& inner : error->GetInnerErrors())
+			InnerErrorItems.Add(MakeShared<FInnerErrorItem>(FInnerErrorItem { inner.Key, inner.Value }));
+		
+		return SNew(SBox)
+			. MaxDesiredHeight(MaxInnerErrorsHeight)
+			[
+				SNew(SListView<FInnerErrorItemPtr>)
+				. ListItemsSource(&InnerErrorItems)
+				. SelectionMode(ESelectionMode::None)
+				. OnGenerateRow_Static(&SErrorDisplay::InnerErrorRow)
+			];
+	}
+
+	auto SErrorDisplay::InnerErrorRow(FInnerErrorItemPtr item, TSharedRef<STableViewBase> const& owner) -> TSharedRef<ITableRow>
+	{
+		return SNew(STableRow<FInnerErrorItemPtr>, owner)
+			. ShowSelection(false)
+			. Padding(FMargin(20, 0, 0, 0))
+			[
+				LazyExpandableWidget(
+					FText::FromString(item->Name),
+					[item] { return item->Error->CreateErrorWidget(); },
+					item->bExpanded,
+					[item](bool expanded) { item->bExpanded = expanded; }
+				)
+			];
+	}
+
 	auto SErrorDisplay::Severity(const IErrorRef& error) -> TAttributeBlock<STextBlock>
 	{
 		return [&](STextBlock::FArguments& args) -> auto&
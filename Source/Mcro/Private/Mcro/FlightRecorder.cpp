@@ -0,0 +1,243 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/FlightRecorder.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+
+#if MCRO_INSTRUMENTATION_ENABLED
+
+static TAutoConsoleVariable<bool> CVarFlightRecorderEnable(
+	TEXT_"Mcro.FlightRecorder.Enable", true,
+	TEXT_"Record recent MCRO errors, state changes and thread hops, which are dumped to the debug output on crash.",
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* cvar)
+	{
+		Mcro::FlightRecorder::SetFlightRecorderEnabled(cvar->GetBool());
+	}),
+	ECVF_Default
+);
+
+namespace Mcro::FlightRecorder
+{
+	std::atomic<bool> Detail::GFlightRecorderEnabled { true };
+
+	namespace
+	{
+		static_assert(FMath::IsPowerOfTwo(FlightRecorderCapacity));
+		constexpr uint64 SlotMask = FlightRecorderCapacity - 1;
+
+		/** @brief Upper bound of the characters in one formatted record, longer labels are truncated */
+		constexpr int32 LineCapacity = 384;
+
+		/**
+		 *	@brief
+		 *	Sequence is 0 while the slot is being written, otherwise it's the write index + 1 of the record it holds.
+		 *	Readers use it to skip torn records.
+		 */
+		struct FSlot
+		{
+			std::atomic<uint64> Sequence { 0 };
+			FFlightRecord Record;
+		};
+
+		std::atomic<uint64> GCursor { 0 };
+		FSlot GSlots[FlightRecorderCapacity];
+
+		/** @brief Line buffer of the crash dump, so it doesn't need stack or heap while the process is going down */
+		TCHAR GCrashLine[LineCapacity];
+
+		const TCHAR* GetKindName(ERecordKind kind)
+		{
+			switch (kind)
+			{
+			case ERecordKind::ErrorMade:     return TEXT_"ErrorMade";
+			case ERecordKind::ErrorReported: return TEXT_"ErrorReported";
+			case ERecordKind::StateChange:   return TEXT_"StateChange";
+			case ERecordKind::ThreadHop:     return TEXT_"ThreadHop";
+			}
+			return TEXT_"Unknown";
+		}
+
+		void GetRange(uint64& begin, uint64& end)
+		{
+			end = GCursor.load(std::memory_order_acquire);
+			begin = end > FlightRecorderCapacity ? end - FlightRecorderCapacity : 0;
+		}
+
+		/** @returns False if the slot of given index is being written or it has been overwritten already */
+		bool TryRead(uint64 index, FFlightRecord& record)
+		{
+			FSlot const& slot = GSlots[index & SlotMask];
+			if (slot.Sequence.load(std::memory_order_acquire) != index + 1) return false;
+
+			record = slot.Record;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return slot.Sequence.load(std::memory_order_relaxed) == index + 1;
+		}
+
+		const TCHAR* GetHeader()
+		{
+			return TEXT_"     Age (s)   Thread Kind           Type hash          Context    Sev  Label";
+		}
+
+		/** @brief Format a record into a line buffer of LineCapacity characters, without allocating */
+		void FormatRecord(TCHAR* line, FFlightRecord const& record, uint64 now)
+		{
+			int32 length = FCString::Snprintf(line, LineCapacity, TEXT_"%12.6f %8u %-14s 0x%016llx 0x%08x %3u  ",
+				FPlatformTime::ToSeconds64(now - record.Cycles),
+				record.ThreadId,
+				GetKindName(record.Kind),
+				record.TypeHash,
+				record.ContextHash,
+				record.Severity
+			);
+			length = FMath::Clamp(length, 0, LineCapacity - 1);
+
+			const int32 labelLength = FMath::Min<int32>(record.LabelLength, LineCapacity - 1 - length);
+			if (record.Label && labelLength > 0)
+			{
+				FMemory::Memcpy(line + length, record.Label, labelLength * sizeof(TCHAR));
+				length += labelLength;
+			}
+			line[length] = TCHAR(0);
+		}
+
+		FAutoConsoleCommandWithOutputDevice GDumpFlightRecordsCommand {
+			TEXT_"Mcro.FlightRecorder.Dump",
+			TEXT_"List the recent MCRO errors, state changes and thread hops kept by the flight recorder.",
+			FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&DumpFlightRecords)
+		};
+	}
+
+	void Detail::Write(FFlightRecord& record)
+	{
+		record.Cycles = FPlatformTime::Cycles64();
+		record.ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+		const uint64 index = GCursor.fetch_add(1, std::memory_order_relaxed);
+		FSlot& slot = GSlots[index & SlotMask];
+		slot.Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.Record = record;
+		slot.Sequence.store(index + 1, std::memory_order_release);
+	}
+
+	void SetFlightRecorderEnabled(bool enabled)
+	{
+		Detail::GFlightRecorderEnabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	TArray<FFlightRecord> GetFlightRecords()
+	{
+		uint64 begin, end;
+		GetRange(begin, end);
+
+		TArray<FFlightRecord> result;
+		result.Reserve(static_cast<int32>(end - begin));
+		for (uint64 index = begin; index < end; ++index)
+		{
+			FFlightRecord record;
+			if (TryRead(index, record))
+				result.Add(record);
+		}
+		return result;
+	}
+
+	void DumpFlightRecords(FOutputDevice& output)
+	{
+		const uint64 now = FPlatformTime::Cycles64();
+		TArray<FFlightRecord> records = GetFlightRecords();
+
+		output.Logf(TEXT_"MCRO flight recorder, %d most recent records (oldest first):", records.Num());
+		output.Log(GetHeader());
+
+		TCHAR line[LineCapacity];
+		for (FFlightRecord const& record : records)
+		{
+			FormatRecord(line, record, now);
+			output.Log(line);
+		}
+	}
+
+	void DumpFlightRecordsLowLevel()
+	{
+		const uint64 now = FPlatformTime::Cycles64();
+		uint64 begin, end;
+		GetRange(begin, end);
+
+		FPlatformMisc::LowLevelOutputDebugString(TEXT_"MCRO flight recorder, most recent records (oldest first):\n");
+		FPlatformMisc::LowLevelOutputDebugString(GetHeader());
+		FPlatformMisc::LowLevelOutputDebugString(TEXT_"\n");
+		for (uint64 index = begin; index < end; ++index)
+		{
+			FFlightRecord record;
+			if (!TryRead(index, record)) continue;
+
+			FormatRecord(GCrashLine, record, now);
+
+			// Leave room for the line break
+			const int32 length = FMath::Min(FCString::Strlen(GCrashLine), LineCapacity - 2);
+			GCrashLine[length] = TCHAR('\n');
+			GCrashLine[length + 1] = TCHAR(0);
+			FPlatformMisc::LowLevelOutputDebugString(GCrashLine);
+		}
+	}
+
+	namespace Detail
+	{
+		namespace
+		{
+			FDelegateHandle GSystemErrorHandle;
+
+			void DumpOnSystemError()
+			{
+				DumpFlightRecordsLowLevel();
+			}
+		}
+
+		void StartFlightRecorderCrashDump()
+		{
+			GSystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddStatic(&DumpOnSystemError);
+		}
+
+		void StopFlightRecorderCrashDump()
+		{
+			FCoreDelegates::OnHandleSystemError.Remove(GSystemErrorHandle);
+		}
+	}
+}
+
+#else
+
+namespace Mcro::FlightRecorder
+{
+	std::atomic<bool> Detail::GFlightRecorderEnabled { false };
+
+	void Detail::Write(FFlightRecord& record) {}
+	void Detail::StartFlightRecorderCrashDump() {}
+	void Detail::StopFlightRecorderCrashDump() {}
+
+	void SetFlightRecorderEnabled(bool enabled) {}
+
+	TArray<FFlightRecord> GetFlightRecords()
+	{
+		return {};
+	}
+
+	void DumpFlightRecords(FOutputDevice& output)
+	{
+		output.Log(TEXT_"MCRO flight recorder is compiled out of this build.");
+	}
+
+	void DumpFlightRecordsLowLevel() {}
+}
+
+#endif
@@ -0,0 +1,36 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	Explicit instantiations of the most common template specializations, matching the `extern template` declarations
+ *	in their headers. Modules depending on MCRO link against these instead of compiling them in every translation unit.
+ */
+
+#include "Mcro/Error.h"
+#include "Mcro/Observable.h"
+#include "Mcro/Delegates/EventDelegate.h"
+
+namespace Mcro::Error
+{
+	template struct MCRO_API TMaybe<FVoid>;
+	template struct MCRO_API TMaybe<FString>;
+}
+
+namespace Mcro::Observable
+{
+	template struct MCRO_API TState<bool>;
+}
+
+namespace Mcro::Delegates
+{
+	template class MCRO_API TEventDelegate<void()>;
+}
@@ -10,9 +10,135 @@
  */
 
 #include "Mcro/Modules.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_LOG_CATEGORY_CLASS(LogMcroModules, Log, All);
+
+static TAutoConsoleVariable<bool> CVarTrackListenerMemory(
+	TEXT_"Mcro.Modules.TrackListenerMemory", false,
+	TEXT_"Record the memory gained by each module event listener. Off by default, because querying the memory stats "
+	TEXT_"of the process is expensive enough to skew the timings of short listeners.",
+	ECVF_Default
+);
 
 namespace Mcro::Modules
 {
+	namespace
+	{
+		struct FListenerTimings
+		{
+			FCriticalSection Lock;
+			TArray<FModuleListenerTiming> Timings;
+		};
+
+		FListenerTimings& GetListenerTimings()
+		{
+			static FListenerTimings timings;
+			return timings;
+		}
+
+		const TCHAR* GetPhaseName(EModuleListenerPhase phase)
+		{
+			return phase == EModuleListenerPhase::Startup ? TEXT_"Startup" : TEXT_"Shutdown";
+		}
+
+		FAutoConsoleCommandWithOutputDevice GDumpListenerTimingsCommand {
+			TEXT_"Mcro.Modules.DumpListenerTimings",
+			TEXT_"List the time spent in TObserveModule and TModuleBoundObject listeners, per module and per listener.",
+			FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& output)
+			{
+				TArray<FModuleListenerTiming> timings = GetModuleListenerTimings();
+
+				struct FModuleTotal
+				{
+					double Seconds = 0.0;
+					int64 MemoryDelta = 0;
+					TArray<FModuleListenerTiming const*> Listeners;
+				};
+				TMap<FName, FModuleTotal> modules;
+				for (FModuleListenerTiming const& timing : timings)
+				{
+					FModuleTotal& total = modules.FindOrAdd(timing.Module);
+					total.Seconds += timing.Seconds;
+					total.MemoryDelta += timing.MemoryDelta;
+					total.Listeners.Add(&timing);
+				}
+				modules.ValueSort([](FModuleTotal const& l, FModuleTotal const& r) { return l.Seconds > r.Seconds; });
+
+				for (auto& [module, total] : modules)
+				{
+					output.Logf(TEXT_"%s: %.2f ms, %lld KiB", *module.ToString(), total.Seconds * 1000.0, total.MemoryDelta / 1024);
+					total.Listeners.Sort([](FModuleListenerTiming const& l, FModuleListenerTiming const& r)
+					{
+						return l.Seconds > r.Seconds;
+					});
+					for (FModuleListenerTiming const* listener : total.Listeners)
+					{
+						output.Logf(TEXT_"    %10.2f ms %10lld KiB  %-8s %s",
+							listener->Seconds * 1000.0, listener->MemoryDelta / 1024,
+							GetPhaseName(listener->Phase), *listener->Listener
+						);
+					}
+				}
+			})
+		};
+	}
+
+	TArray<FModuleListenerTiming> GetModuleListenerTimings()
+	{
+		auto& timings = GetListenerTimings();
+		FScopeLock lock(&timings.Lock);
+		return timings.Timings;
+	}
+
+	namespace Detail
+	{
+		FModuleListenerScope::FModuleListenerScope(FName module, FString const& listener, EModuleListenerPhase phase)
+			: Timing { .Module = module, .Listener = listener, .Phase = phase }
+		{
+#if CPUPROFILERTRACE_ENABLED
+			if (UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel))
+			{
+				FCpuProfilerTrace::OutputBeginDynamicEvent(*FString::Printf(
+					TEXT_"%s %s: %s", *module.ToString(), GetPhaseName(phase), *listener
+				));
+				bTraced = true;
+			}
+#endif
+			bTrackMemory = CVarTrackListenerMemory.GetValueOnAnyThread();
+			if (bTrackMemory) StartMemory = FPlatformMemory::GetStats().UsedPhysical;
+			StartSeconds = FPlatformTime::Seconds();
+		}
+
+		FModuleListenerScope::~FModuleListenerScope()
+		{
+			Timing.Seconds = FPlatformTime::Seconds() - StartSeconds;
+			if (bTrackMemory)
+				Timing.MemoryDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(StartMemory);
+#if CPUPROFILERTRACE_ENABLED
+			if (bTraced) FCpuProfilerTrace::OutputEndEvent();
+#endif
+			UE_LOG(LogMcroModules, Verbose, TEXT_"%s %s listener %s took %.2f ms",
+				*Timing.Module.ToString(), GetPhaseName(Timing.Phase), *Timing.Listener, Timing.Seconds * 1000.0
+			);
+
+			auto& timings = GetListenerTimings();
+			FScopeLock lock(&timings.Lock);
+			timings.Timings.Add(MoveTemp(Timing));
+		}
+
+		FString GetListenerName(std::source_location const& location)
+		{
+			return FString::Printf(TEXT_"%s:%d",
+				*FPaths::GetCleanFilename(ANSI_TO_TCHAR(location.file_name())),
+				location.line()
+			);
+		}
+	}
+
 	void IObservableModule::StartupModule()
 	{
 		OnStartupModule.Broadcast();
@@ -0,0 +1,96 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Observable/Coalescing.h"
+#include "Misc/ScopeLock.h"
+
+namespace Mcro::Observable::Detail
+{
+	namespace
+	{
+		struct FCoalescedNotification
+		{
+			IDeferredStateNotify* State;
+			double DueTime;
+		};
+
+		struct FCoalescedNotifications
+		{
+			FCriticalSection Lock;
+			TArray<FCoalescedNotification> Pending;
+			TArray<FCoalescedNotification> Flushing;
+		};
+
+		FCoalescedNotifications& GetCoalescedNotifications()
+		{
+			static FCoalescedNotifications notifications;
+			return notifications;
+		}
+	}
+
+	void CoalesceNotification(IDeferredStateNotify* state, bool& pending, double dueTime)
+	{
+		if (pending) return;
+		pending = true;
+
+		auto& notifications = GetCoalescedNotifications();
+		FScopeLock lock(&notifications.Lock);
+		notifications.Pending.Add({ state, dueTime });
+	}
+
+	void ForgetCoalescedNotification(IDeferredStateNotify* state)
+	{
+		auto& notifications = GetCoalescedNotifications();
+		FScopeLock lock(&notifications.Lock);
+		notifications.Pending.RemoveAllSwap([state](FCoalescedNotification const& entry) { return entry.State == state; });
+		for (FCoalescedNotification& entry : notifications.Flushing)
+		{
+			if (entry.State == state) entry.State = nullptr;
+		}
+	}
+
+	void FlushCoalescedNotifications()
+	{
+		check(IsInGameThread());
+		auto& notifications = GetCoalescedNotifications();
+		{
+			FScopeLock lock(&notifications.Lock);
+			if (notifications.Pending.IsEmpty()) return;
+
+			const double now = FPlatformTime::Seconds();
+			for (int32 i = notifications.Pending.Num() - 1; i >= 0; --i)
+			{
+				if (notifications.Pending[i].DueTime <= now)
+				{
+					notifications.Flushing.Add(notifications.Pending[i]);
+					notifications.Pending.RemoveAtSwap(i, EAllowShrinking::No);
+				}
+			}
+		}
+
+		// The states are not locked here, so listeners may set coalesced states again, which are flushed next frame
+		for (int32 i = 0; ; ++i)
+		{
+			IDeferredStateNotify* state;
+			{
+				FScopeLock lock(&notifications.Lock);
+				if (i >= notifications.Flushing.Num())
+				{
+					notifications.Flushing.Reset();
+					break;
+				}
+				state = notifications.Flushing[i].State;
+			}
+			if (state) state->NotifyCoalesced();
+		}
+	}
+}
@@ -0,0 +1,42 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Observable/Dependency.h"
+
+namespace Mcro::Observable::Detail
+{
+	std::atomic<int32> GActiveDependencyTrackers { 0 };
+
+	namespace
+	{
+		thread_local FDependencyTracker* GCurrentTracker = nullptr;
+	}
+
+	FDependencyTracker::FDependencyTracker()
+		: Outer(GCurrentTracker)
+	{
+		GCurrentTracker = this;
+		GActiveDependencyTrackers.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	FDependencyTracker::~FDependencyTracker()
+	{
+		GActiveDependencyTrackers.fetch_sub(1, std::memory_order_relaxed);
+		GCurrentTracker = Outer;
+	}
+
+	void RecordStateRead(IStateDependency* state)
+	{
+		if (GCurrentTracker)
+			GCurrentTracker->Dependencies.AddUnique(state);
+	}
+}
@@ -0,0 +1,60 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Observable.h"
+#include "Mcro/TextMacros.h"
+#include "Mcro/Delegates/EventDelegate.h"
+#include "HAL/IConsoleManager.h"
+
+namespace Mcro::Observable
+{
+	namespace
+	{
+		template <typename T>
+		void ReportSize(FOutputDevice& output, const TCHAR* name)
+		{
+			output.Logf(TEXT_"%-48s %6llu %6llu", name, static_cast<uint64>(sizeof(T)), static_cast<uint64>(alignof(T)));
+		}
+
+		FAutoConsoleCommandWithOutputDevice GObservableMemoryReportCommand {
+			TEXT_"Mcro.Observable.MemoryReport",
+			TEXT_"List the per-instance size of common TState and TEventDelegate instantiations. Members which are"
+			TEXT_" only allocated on first use (dynamic bindings, once-bindings, lazy caches) are not included.",
+			FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& output)
+			{
+				output.Logf(TEXT_"%-48s %6s %6s", TEXT_"Type", TEXT_"Size", TEXT_"Align");
+
+				ReportSize<TEventDelegate<void()>>(output,
+					TEXT_"TEventDelegate<void()>");
+				ReportSize<TEventDelegate<void(int32)>>(output,
+					TEXT_"TEventDelegate<void(int32)>");
+				ReportSize<TEventDelegate<void(int32), {.LazyCache = true}>>(output,
+					TEXT_"TEventDelegate<void(int32), LazyCache>");
+				ReportSize<TEventDelegate<void(int32), {.ThreadSafe = true}>>(output,
+					TEXT_"TEventDelegate<void(int32), ThreadSafe>");
+				ReportSize<TEventDelegate<void(int32), {.ThreadSafe = true, .LockFreeBroadcast = true}>>(output,
+					TEXT_"TEventDelegate<void(int32), LockFreeBroadcast>");
+				ReportSize<TBelatedRetainingEventDelegate<void(FString const&)>>(output,
+					TEXT_"TBelatedRetainingEventDelegate<void(FString)>");
+
+				ReportSize<TState<bool>>(output, TEXT_"TState<bool>");
+				ReportSize<TState<int32>>(output, TEXT_"TState<int32>");
+				ReportSize<TState<float>>(output, TEXT_"TState<float>");
+				ReportSize<TState<FString>>(output, TEXT_"TState<FString>");
+				ReportSize<TState<FVector>>(output, TEXT_"TState<FVector>");
+				ReportSize<TState<TArray<int32>>>(output, TEXT_"TState<TArray<int32>>");
+				ReportSize<TStateTS<int32>>(output, TEXT_"TStateTS<int32>");
+				ReportSize<TStateTS<FString>>(output, TEXT_"TStateTS<FString>");
+			})
+		};
+	}
+}
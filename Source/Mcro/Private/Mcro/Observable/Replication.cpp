@@ -0,0 +1,203 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Observable/Replication.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/ScopeLock.h"
+
+namespace Mcro::Observable
+{
+	namespace
+	{
+		// Names are not stable across processes, but their text is
+		uint32 GetWireId(FName id)
+		{
+			return FCrc::StrCrc32(*id.ToString().ToLower());
+		}
+	}
+
+	FStateReplicator::~FStateReplicator()
+	{
+		FScopeLock lock(&Lock);
+		for (auto const& entry : Entries)
+			entry->Unbind();
+	}
+
+	FStateReplicator::FEntryRef FStateReplicator::AddEntry(FName id, TUniqueFunction<void(FArchive&)>&& encode)
+	{
+		FScopeLock lock(&Lock);
+		const uint32 wireId = GetWireId(id);
+		ASSERT_CRASH(!Entries.ContainsByPredicate([&](auto const& entry) { return entry->WireId == wireId; }),
+			->WithMessageF(
+				TEXT_"State {0} is already registered for replication, or another one with the same hash",
+				id.ToString()
+			)
+		);
+
+		FEntryRef entry = Entries.Add_GetRef(MakeShared<FEntry, ESPMode::ThreadSafe>(id, wireId, Version));
+		entry->Encode = MoveTemp(encode);
+		entry->MarkChanged();
+		return entry;
+	}
+
+	void FStateReplicator::FEntry::MarkChanged()
+	{
+		// Doesn't lock, states notify changes while they're locked, and WriteDelta locks states while it's locked.
+		// Concurrent changes may finish in any order, the entry version only moves forward.
+		const uint64 next = ReplicatorVersion->fetch_add(1, std::memory_order_acq_rel) + 1;
+		uint64 current = Version.load(std::memory_order_relaxed);
+		while (current < next && !Version.compare_exchange_weak(current, next, std::memory_order_release, std::memory_order_relaxed)) {}
+	}
+
+	bool FStateReplicator::Unregister(FName id)
+	{
+		FScopeLock lock(&Lock);
+		const int32 index = Entries.IndexOfByPredicate([&](auto const& entry) { return entry->Id == id; });
+		if (index == INDEX_NONE) return false;
+
+		Entries[index]->Unbind();
+		Entries.RemoveAt(index);
+		return true;
+	}
+
+	uint64 FStateReplicator::WriteDelta(FArchive& archive, uint64 acknowledged)
+	{
+		check(archive.IsSaving());
+		FScopeLock lock(&Lock);
+
+		// States changing during encoding are sent with their latest value, and again in the next delta
+		uint64 version = GetVersion();
+		uint32 magic = StateReplication::Magic;
+		uint16 encoding = StateReplication::Version;
+		archive << magic << encoding << acknowledged << version;
+
+		TArray<FEntry*, TInlineAllocator<64>> changed;
+		for (auto const& entry : Entries)
+		{
+			if (entry->Version.load(std::memory_order_acquire) > acknowledged)
+				changed.Add(&entry.Get());
+		}
+
+		int32 count = changed.Num();
+		archive << count;
+
+		TArray<uint8> payload;
+		for (FEntry* entry : changed)
+		{
+			payload.Reset();
+			FMemoryWriter writer(payload);
+			entry->Encode(writer);
+
+			int32 size = payload.Num();
+			archive << entry->WireId << size;
+			archive.Serialize(payload.GetData(), size);
+		}
+		return version;
+	}
+
+	TArray<uint8> FStateReplicator::WriteDelta(uint64 acknowledged, uint64& version)
+	{
+		TArray<uint8> result;
+		FMemoryWriter writer(result);
+		version = WriteDelta(writer, acknowledged);
+		return result;
+	}
+
+	void FStateReplica::AddEntry(FName id, TUniqueFunction<void(FArchive&)>&& decode)
+	{
+		const uint32 wireId = GetWireId(id);
+		ASSERT_CRASH(!Entries.Contains(wireId),
+			->WithMessageF(
+				TEXT_"State {0} is already registered for replication, or another one with the same hash",
+				id.ToString()
+			)
+		);
+		Entries.Add(wireId, MoveTemp(decode));
+	}
+
+	bool FStateReplica::Unregister(FName id)
+	{
+		return Entries.Remove(GetWireId(id)) > 0;
+	}
+
+	TMaybe<uint64> FStateReplica::ApplyDelta(FArchive& archive)
+	{
+		check(archive.IsLoading());
+		uint32 magic = 0;
+		uint16 encoding = 0;
+		uint64 base = 0, version = 0;
+		int32 count = 0;
+		archive << magic << encoding;
+		if (archive.IsError() || magic != StateReplication::Magic)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"The input is not a state replication batch");
+
+		if (encoding > StateReplication::Version)
+			return IError::Make(new FAssertion())
+				->WithMessageF(TEXT_"State replication batch has version {0}, but only {1} is supported",
+					encoding, StateReplication::Version
+				);
+
+		archive << base << version << count;
+		if (archive.IsError() || count < 0)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"State replication batch is truncated or corrupted");
+
+		if (base > Version)
+			return IError::Make(new FAssertion())
+				->WithMessageF(TEXT_"State replication batch was made since version {0}, but only {1} has been applied",
+					base, Version
+				);
+
+		if (version <= Version)
+			return Version;
+
+		// Streaming archives don't know their size, those are only limited by MaxStateBytes
+		const int64 totalSize = archive.TotalSize();
+		TArray<uint8> payload;
+		for (int32 i = 0; i < count; ++i)
+		{
+			uint32 wireId = 0;
+			int32 size = 0;
+			archive << wireId << size;
+			if (archive.IsError()
+				|| size < 0
+				|| size > StateReplication::MaxStateBytes
+				|| (totalSize >= 0 && size > totalSize - archive.Tell())
+			)
+				return IError::Make(new FAssertion())
+					->WithMessage(TEXT_"State replication batch is truncated or corrupted");
+
+			payload.SetNumUninitialized(size, EAllowShrinking::No);
+			archive.Serialize(payload.GetData(), size);
+
+			// Decoding is isolated so codecs can't read into the next state, and unknown states are just skipped
+			if (auto* decode = Entries.Find(wireId))
+			{
+				FMemoryReader reader(payload);
+				(*decode)(reader);
+				if (reader.IsError())
+					return IError::Make(new FAssertion())
+						->WithMessage(TEXT_"A state in the replication batch couldn't be decoded");
+			}
+		}
+		Version = version;
+		return version;
+	}
+
+	TMaybe<uint64> FStateReplica::ApplyDelta(TArrayView<const uint8> data)
+	{
+		FMemoryReaderView reader(TArrayView64<const uint8>(data.GetData(), data.Num()));
+		return ApplyDelta(reader);
+	}
+}
@@ -0,0 +1,117 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Observable/Transaction.h"
+#include "Mcro/AssertMacros.h"
+#include "Mcro/TextMacros.h"
+
+namespace Mcro::Observable
+{
+	namespace
+	{
+		thread_local FStateTransaction* GCurrentTransaction = nullptr;
+
+		// States modifying each other in a cycle would be raising their ranks indefinitely
+		constexpr int32 MaxPropagationRank = 1024;
+	}
+
+	FStateTransaction::FStateTransaction()
+		: Outer(GCurrentTransaction)
+	{
+		GCurrentTransaction = this;
+	}
+
+	FStateTransaction::~FStateTransaction()
+	{
+		Commit();
+		GCurrentTransaction = Outer;
+	}
+
+	void FStateTransaction::Notify(Detail::IDeferredStateNotify* state)
+	{
+		TGuardValue notifying(Notifying, state);
+		state->NotifyDeferred();
+	}
+
+	void FStateTransaction::Commit()
+	{
+		if (Outer) return;
+
+		// Listeners may defer more states while committing, those are notified in the same loop according to their rank.
+		// When the rank of an already pending state is raised it's pushed again, and its outdated entry is skipped.
+		while (!Pending.IsEmpty())
+		{
+			FPendingState next;
+			Pending.HeapPop(next, EAllowShrinking::No);
+			if (next.State && next.State->PropagationRank.load(std::memory_order_relaxed) == next.Rank)
+				Notify(next.State);
+		}
+	}
+
+	bool FStateTransaction::IsActive()
+	{
+		return GCurrentTransaction != nullptr;
+	}
+
+	bool FStateTransaction::Defer(Detail::IDeferredStateNotify* state, bool& pending)
+	{
+		if (!GCurrentTransaction) return false;
+
+		FStateTransaction* outermost = GCurrentTransaction;
+		while (outermost->Outer) outermost = outermost->Outer;
+
+		bool rankRaised = false;
+		if (outermost->Notifying && outermost->Notifying != state)
+		{
+			const int32 rank = outermost->Notifying->PropagationRank.load(std::memory_order_relaxed) + 1;
+			ASSERT_QUIT(rank <= MaxPropagationRank, true,
+				->WithMessage(TEXT_"States are modifying each other in a cycle from their change listeners.")
+			);
+			int32 current = state->PropagationRank.load(std::memory_order_relaxed);
+			while (current < rank)
+			{
+				if (state->PropagationRank.compare_exchange_weak(current, rank, std::memory_order_relaxed))
+				{
+					rankRaised = true;
+					break;
+				}
+			}
+		}
+
+		if (pending && !rankRaised) return true;
+
+		pending = true;
+		outermost->Pending.HeapPush({ state, state->PropagationRank.load(std::memory_order_relaxed), outermost->NextOrder++ });
+		return true;
+	}
+
+	void FStateTransaction::Forget(Detail::IDeferredStateNotify* state)
+	{
+		for (FStateTransaction* transaction = GCurrentTransaction; transaction; transaction = transaction->Outer)
+		{
+			for (FPendingState& pending : transaction->Pending)
+			{
+				if (pending.State == state) pending.State = nullptr;
+			}
+		}
+	}
+
+	void FStateTransaction::Propagate(Detail::IDeferredStateNotify* state, TFunctionRef<void()> broadcast)
+	{
+		FStateTransaction wave;
+		{
+			TGuardValue notifying(wave.Notifying, state);
+			broadcast();
+		}
+		wave.Commit();
+	}
+}
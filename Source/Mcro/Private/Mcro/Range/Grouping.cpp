@@ -0,0 +1,53 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Range/Grouping.h"
+
+namespace Mcro::Range::Detail
+{
+	void RadixSort(TArray<FRadixEntry, Ansi::FArenaAllocator>& entries, int32 keyBytes)
+	{
+		const int32 num = entries.Num();
+		if (num < 2) return;
+
+		TArray<FRadixEntry, Ansi::FArenaAllocator> buffer;
+		buffer.SetNumUninitialized(num);
+		FRadixEntry* source = entries.GetData();
+		FRadixEntry* destination = buffer.GetData();
+
+		for (int32 digit = 0; digit < keyBytes; ++digit)
+		{
+			const int32 shift = digit * 8;
+			int32 offsets[256] {};
+			for (int32 i = 0; i < num; ++i)
+				++offsets[(source[i].Bits >> shift) & 0xFF];
+
+			// Every entry has the same digit, this pass wouldn't change anything
+			if (offsets[(source[0].Bits >> shift) & 0xFF] == num)
+				continue;
+
+			int32 sum = 0;
+			for (int32& offset : offsets)
+			{
+				const int32 count = offset;
+				offset = sum;
+				sum += count;
+			}
+			for (int32 i = 0; i < num; ++i)
+				destination[offsets[(source[i].Bits >> shift) & 0xFF]++] = source[i];
+
+			Swap(source, destination);
+		}
+
+		if (source != entries.GetData())
+			FMemory::Memcpy(entries.GetData(), source, num * sizeof(FRadixEntry));
+	}
+}
@@ -0,0 +1,131 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Range/MappedFile.h"
+#include "Mcro/TextMacros.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+#if PLATFORM_LINUX || PLATFORM_MAC
+#include <sys/mman.h>
+#endif
+
+namespace Mcro::Range
+{
+	using namespace Mcro::Error;
+
+	namespace
+	{
+		void AdviseAccess(TArrayView64<const uint8> contents, EMappedFileAccess access)
+		{
+#if PLATFORM_LINUX || PLATFORM_MAC
+			if (access == EMappedFileAccess::Normal || contents.IsEmpty())
+				return;
+
+			// madvise needs a page aligned start, the mapping itself starts on a page anyway
+			const UPTRINT pageSize = FPlatformMemory::GetConstants().PageSize;
+			const UPTRINT begin = reinterpret_cast<UPTRINT>(contents.GetData()) & ~(pageSize - 1);
+			const UPTRINT end = reinterpret_cast<UPTRINT>(contents.GetData()) + contents.Num();
+			madvise(
+				reinterpret_cast<void*>(begin), end - begin,
+				access == EMappedFileAccess::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM
+			);
+#endif
+		}
+	}
+
+	FMappedFile::FMappedFile() = default;
+
+	FMappedFile::~FMappedFile()
+	{
+		// Release the region before the file it was mapped from
+		Region.Reset();
+		File.Reset();
+	}
+
+	TMaybe<TSharedRef<const FMappedFile>> FMappedFile::Open(FString const& path, EMappedFileAccess access)
+	{
+		TSharedRef<FMappedFile> result = MakeShareable(new FMappedFile());
+
+		IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+		if (auto mapped = platformFile.OpenMappedEx(*path); mapped.HasValue())
+		{
+			result->File = mapped.StealValue();
+			const int64 size = result->File->GetFileSize();
+			if (size > 0)
+				result->Region.Reset(result->File->MapRegion(0, size));
+		}
+
+		if (result->Region)
+		{
+			result->Contents = TArrayView64<const uint8>(
+				result->Region->GetMappedPtr(),
+				result->Region->GetMappedSize()
+			);
+			AdviseAccess(result->Contents, access);
+			return TSharedRef<const FMappedFile>(result);
+		}
+
+		// Empty files can't be mapped, and some platforms can't map files at all
+		result->File.Reset();
+		if (!FFileHelper::LoadFileToArray(result->Owned, *path, FILEREAD_Silent))
+		{
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Couldn't open file for mapping")
+				->WithAppendix(TEXT_"File", path);
+		}
+		result->Contents = result->Owned;
+		return TSharedRef<const FMappedFile>(result);
+	}
+
+	FMappedFileLines::FMappedFileLines(TSharedRef<const FMappedFile> const& file)
+		: File(file)
+	{
+		TArrayView64<const uint8> bytes = file->GetBytes();
+		const int64 bom = bytes.Num() >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF ? 3 : 0;
+		Begin = reinterpret_cast<const UTF8CHAR*>(bytes.GetData()) + bom;
+		End = reinterpret_cast<const UTF8CHAR*>(bytes.GetData()) + bytes.Num();
+	}
+
+	TArray<FMappedFileLines> FMappedFileLines::Split(int32 count) const
+	{
+		TArray<FMappedFileLines> result;
+		const int64 size = NumBytes();
+		count = static_cast<int32>(FMath::Clamp<int64>(count, 1, FMath::Max<int64>(size, 1)));
+		result.Reserve(count);
+
+		const UTF8CHAR* begin = Begin;
+		for (int32 i = 1; i <= count && begin < End; ++i)
+		{
+			const UTF8CHAR* end = i == count ? End : Begin + size * i / count;
+			if (end <= begin)
+				continue;
+
+			// Move the boundary after the end of the line it falls into
+			if (end < End && end[-1] != '\n')
+			{
+				const void* newLine = std::memchr(end, '\n', static_cast<size_t>(End - end));
+				end = newLine ? static_cast<const UTF8CHAR*>(newLine) + 1 : End;
+			}
+			result.Add(FMappedFileLines(File, begin, end));
+			begin = end;
+		}
+		return result;
+	}
+
+	TMaybe<FMappedFileLines> MappedFileLines(FString const& path, EMappedFileAccess access)
+	{
+		auto file = FMappedFile::Open(path, access);
+		if (file.HasError()) return file.GetErrorRef();
+		return FMappedFileLines(file.GetValue());
+	}
+}
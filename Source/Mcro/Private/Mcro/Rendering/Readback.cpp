@@ -0,0 +1,151 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Rendering/Readback.h"
+#include "Mcro/Threading.h"
+#include "Mcro/TextMacros.h"
+#include "RHIGPUReadback.h"
+#include "RHICommandList.h"
+#include "TextureResource.h"
+
+namespace Mcro::Rendering::Textures
+{
+	using namespace Mcro::Threading;
+
+	namespace
+	{
+		TFuture<FTextureReadbackQueue::FResult> MakeReadbackError(FString const& message)
+		{
+			return MakeFulfilledPromise<FTextureReadbackQueue::FResult>(
+				IError::Make(new FAssertion())->WithMessage(message)
+			).GetFuture();
+		}
+	}
+
+	FTextureReadbackQueue::FTextureReadbackQueue(int32 maxInFlight)
+		: MaxInFlight(FMath::Max(1, maxInFlight))
+	{
+		Ring.SetNum(MaxInFlight);
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FTextureReadbackQueue::Tick)
+		);
+	}
+
+	FTextureReadbackQueue::~FTextureReadbackQueue()
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		for (FStagingBuffer& buffer : Ring)
+		{
+			if (buffer.Promise.IsSet())
+				buffer.Promise->SetValue(IError::Make(new FAssertion())
+					->WithMessage(TEXT_"Texture readback queue was destroyed before the GPU finished copying")
+				);
+		}
+	}
+
+	TFuture<FTextureReadbackQueue::FResult> FTextureReadbackQueue::Read(UTexture* texture)
+	{
+		FTextureResource* resource = IsValid(texture) ? texture->GetResource() : nullptr;
+		if (!resource)
+			return MakeReadbackError(TEXT_"Texture doesn't have a render resource to read back");
+
+		// Query the RHI texture on the render thread, it may be (re)created there in the meantime.
+		TPromise<FResult> promise;
+		TFuture<FResult> future = promise.GetFuture();
+		EnqueueRenderCommand([weakSelf = AsWeak(), resource, promise = MoveTemp(promise)](FRHICommandListImmediate& cmdList) mutable
+		{
+			auto self = weakSelf.Pin();
+			if (!self)
+			{
+				promise.SetValue(IError::Make(new FAssertion())
+					->WithMessage(TEXT_"Texture readback queue was destroyed before the readback could be started")
+				);
+				return;
+			}
+			self->Read(cmdList, resource->GetTexture2DRHI()).Then([promise = MoveTemp(promise)](TFuture<FResult> result) mutable
+			{
+				promise.SetValue(result.Get());
+			});
+		});
+		return future;
+	}
+
+	TFuture<FTextureReadbackQueue::FResult> FTextureReadbackQueue::Read(FRHICommandListImmediate& cmdList, FRHITexture* texture)
+	{
+		check(IsInRenderingThread());
+		if (!texture)
+			return MakeReadbackError(TEXT_"There's no RHI texture to read back");
+
+		FStagingBuffer& buffer = Ring[NextBuffer];
+		if (buffer.Promise.IsSet())
+			return MakeReadbackError(FString::Printf(
+				TEXT_"All %d texture readback staging buffers are in flight", MaxInFlight
+			));
+		NextBuffer = (NextBuffer + 1) % MaxInFlight;
+
+		if (!buffer.Readback)
+			buffer.Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT_"McroTextureReadback");
+
+		FIntVector size = texture->GetSizeXYZ();
+		buffer.Size = {size.X, size.Y, texture->GetFormat()};
+		buffer.Promise.Emplace();
+
+		cmdList.Transition(FRHITransitionInfo(texture, ERHIAccess::Unknown, ERHIAccess::CopySrc));
+		buffer.Readback->EnqueueCopy(cmdList, texture, FIntVector::ZeroValue, 0, FIntVector(size.X, size.Y, 1));
+		cmdList.Transition(FRHITransitionInfo(texture, ERHIAccess::CopySrc, ERHIAccess::SRVMask));
+
+		InFlight.fetch_add(1, std::memory_order_relaxed);
+		return buffer.Promise->GetFuture();
+	}
+
+	bool FTextureReadbackQueue::Tick(float deltaTime)
+	{
+		if (NumInFlight() > 0)
+		{
+			EnqueueRenderCommand(AsWeak(), [this](FRHICommandListImmediate& cmdList)
+			{
+				Poll(cmdList);
+			});
+		}
+		return true;
+	}
+
+	void FTextureReadbackQueue::Poll(FRHICommandListImmediate& cmdList)
+	{
+		for (FStagingBuffer& buffer : Ring)
+		{
+			if (!buffer.Promise.IsSet() || !buffer.Readback->IsReady())
+				continue;
+
+			FTextureReadbackResult result;
+			result.Size = buffer.Size;
+			result.RowBytes = static_cast<int32>(buffer.Size.Width) * GPixelFormats[buffer.Size.Format].BlockBytes;
+			result.Data.SetNumUninitialized(result.RowBytes * buffer.Size.Height);
+
+			int32 rowPitchInPixels = 0;
+			const uint8* source = static_cast<const uint8*>(buffer.Readback->Lock(rowPitchInPixels));
+			const int32 sourceRowBytes = rowPitchInPixels * GPixelFormats[buffer.Size.Format].BlockBytes;
+			if (sourceRowBytes == result.RowBytes)
+				FMemory::Memcpy(result.Data.GetData(), source, result.Data.Num());
+			else
+			{
+				for (uint32 row = 0; row < buffer.Size.Height; ++row)
+					FMemory::Memcpy(result.Data.GetData() + row * result.RowBytes, source + row * sourceRowBytes, result.RowBytes);
+			}
+			buffer.Readback->Unlock();
+
+			TPromise<FResult> promise = MoveTemp(buffer.Promise.GetValue());
+			buffer.Promise.Reset();
+			InFlight.fetch_sub(1, std::memory_order_relaxed);
+			promise.SetValue(MoveTemp(result));
+		}
+	}
+}
@@ -0,0 +1,38 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Rendering/RenderState.h"
+
+namespace Mcro::Rendering::Detail
+{
+	namespace
+	{
+		// Only the game thread queues and flushes flips, so it doesn't need synchronization
+		TArray<TSharedRef<IRenderStateFlip>> GPendingFlips;
+	}
+
+	void QueueRenderStateFlip(TSharedRef<IRenderStateFlip> const& state)
+	{
+		check(IsInGameThread());
+		GPendingFlips.Add(state);
+	}
+
+	void FlushRenderStateFlips()
+	{
+		check(IsInGameThread());
+		if (GPendingFlips.IsEmpty()) return;
+
+		TArray<TSharedRef<IRenderStateFlip>> flips = MoveTemp(GPendingFlips);
+		GPendingFlips.Reset();
+		for (auto const& state : flips)
+			state->EnqueueFlip();
+	}
+}
@@ -0,0 +1,347 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Rendering/TextureConversion.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+#include "ShaderPermutation.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "ShaderCore.h"
+#include "RHIStaticStates.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "Mcro/TextMacros.h"
+
+namespace Mcro::Rendering::Textures::Detail
+{
+	constexpr int32 ThreadGroupSize = 8;
+
+	bool ShouldCompileConversionShader(const FGlobalShaderPermutationParameters& parameters)
+	{
+		return IsFeatureLevelSupported(parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+
+	void ModifyConversionShaderEnvironment(FShaderCompilerEnvironment& environment)
+	{
+		environment.SetDefine(TEXT_"THREADGROUP_SIZE", ThreadGroupSize);
+	}
+}
+
+#define MCRO_TEXTURE_CONVERSION_SHADER_COMMON()                                                                   \
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& parameters)                    \
+	{                                                                                                            \
+		return Mcro::Rendering::Textures::Detail::ShouldCompileConversionShader(parameters);                     \
+	}                                                                                                            \
+	static void ModifyCompilationEnvironment(                                                                    \
+		const FGlobalShaderPermutationParameters& parameters, FShaderCompilerEnvironment& environment            \
+	) {                                                                                                          \
+		FGlobalShader::ModifyCompilationEnvironment(parameters, environment);                                    \
+		Mcro::Rendering::Textures::Detail::ModifyConversionShaderEnvironment(environment);                       \
+	}                                                                                                           //
+
+class FMcroConvertTextureCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FMcroConvertTextureCS);
+	SHADER_USE_PARAMETER_STRUCT(FMcroConvertTextureCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, Source)
+		SHADER_PARAMETER_SAMPLER(SamplerState, SourceSampler)
+		SHADER_PARAMETER(FUintVector2, TargetSize)
+		SHADER_PARAMETER(FVector2f, InvTargetSize)
+		SHADER_PARAMETER(FUintVector4, Swizzle)
+		SHADER_PARAMETER(uint32, bFlipVertically)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, Target)
+	END_SHADER_PARAMETER_STRUCT()
+
+	MCRO_TEXTURE_CONVERSION_SHADER_COMMON()
+};
+
+class FMcroDownsampleTextureCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FMcroDownsampleTextureCS);
+	SHADER_USE_PARAMETER_STRUCT(FMcroDownsampleTextureCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, Source)
+		SHADER_PARAMETER(FUintVector2, SourceSize)
+		SHADER_PARAMETER(FUintVector2, TargetSize)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, Target)
+	END_SHADER_PARAMETER_STRUCT()
+
+	MCRO_TEXTURE_CONVERSION_SHADER_COMMON()
+};
+
+class FMcroRgbToYuvCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FMcroRgbToYuvCS);
+	SHADER_USE_PARAMETER_STRUCT(FMcroRgbToYuvCS, FGlobalShader);
+
+	class FSeparateChroma : SHADER_PERMUTATION_BOOL("OUTPUT_SEPARATE_CHROMA");
+	using FPermutationDomain = TShaderPermutationDomain<FSeparateChroma>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D, Source)
+		SHADER_PARAMETER(FUintVector2, SourceSize)
+		SHADER_PARAMETER(FUintVector2, TargetSize)
+		SHADER_PARAMETER(uint32, bFlipVertically)
+		SHADER_PARAMETER(FVector4f, RgbToY)
+		SHADER_PARAMETER(FVector4f, RgbToU)
+		SHADER_PARAMETER(FVector4f, RgbToV)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, LumaTarget)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, ChromaTarget)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, UTarget)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, VTarget)
+	END_SHADER_PARAMETER_STRUCT()
+
+	MCRO_TEXTURE_CONVERSION_SHADER_COMMON()
+};
+
+#undef MCRO_TEXTURE_CONVERSION_SHADER_COMMON
+
+IMPLEMENT_GLOBAL_SHADER(FMcroConvertTextureCS, "/Plugin/Mcro/Private/TextureConversion.usf", "ConvertCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FMcroDownsampleTextureCS, "/Plugin/Mcro/Private/TextureConversion.usf", "DownsampleCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FMcroRgbToYuvCS, "/Plugin/Mcro/Private/TextureConversion.usf", "RgbToYuvCS", SF_Compute);
+
+namespace Mcro::Rendering::Textures
+{
+	namespace
+	{
+		FCanFail CheckComputeWritable(EPixelFormat format)
+		{
+			if (format == PF_Unknown || !UE::PixelFormat::HasCapabilities(format, EPixelFormatCapabilities::TypedUAVStore))
+				return IError::Make(new FAssertion())
+					->WithMessageF(TEXT_"Pixel format {0} cannot be written by a compute shader", GetPixelFormatString(format));
+			return Success();
+		}
+
+		FRDGTextureRef CreateComputeTarget(FRDGBuilder& graph, FIntPoint size, EPixelFormat format, const TCHAR* name)
+		{
+			return graph.CreateTexture(
+				FRDGTextureDesc::Create2D(size, format, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV),
+				name
+			);
+		}
+
+		FUintVector2 ToUintVector(FIntPoint size)
+		{
+			return { static_cast<uint32>(size.X), static_cast<uint32>(size.Y) };
+		}
+
+		FUintVector4 ToShaderSwizzle(FTextureSwizzle const& swizzle)
+		{
+			return {
+				static_cast<uint32>(swizzle.R),
+				static_cast<uint32>(swizzle.G),
+				static_cast<uint32>(swizzle.B),
+				static_cast<uint32>(swizzle.A)
+			};
+		}
+	}
+
+	TMaybe<FRDGTextureRef> AddConvertTexturePass(
+		FRDGBuilder& graph,
+		FRDGTextureRef source,
+		FUnrealTextureSize const& target,
+		FTextureConversionSettings const& settings,
+		const TCHAR* name
+	) {
+		if (!target)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Texture conversion target has no size or format")
+				->WithAppendix(TEXT_"Width", FString::FromInt(target.Width))
+				->WithAppendix(TEXT_"Height", FString::FromInt(target.Height));
+
+		auto writable = CheckComputeWritable(target.Format);
+		if (writable.HasError()) return writable.GetErrorRef();
+
+		FRDGTextureRef result = CreateComputeTarget(
+			graph, FIntPoint(target.Width, target.Height), target.Format, name
+		);
+		auto conversion = AddConvertIntoTexturePass(graph, source, result, settings);
+		if (conversion.HasError()) return conversion.GetErrorRef();
+		return result;
+	}
+
+	FCanFail AddConvertIntoTexturePass(
+		FRDGBuilder& graph,
+		FRDGTextureRef source,
+		FRDGTextureRef target,
+		FTextureConversionSettings const& settings
+	) {
+		if (!source || !target)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Texture conversion requires both a source and a target texture");
+
+		FRDGTextureDesc const& targetDesc = target->Desc;
+		if (!EnumHasAnyFlags(targetDesc.Flags, TexCreate_UAV))
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Texture conversion target must be created with TexCreate_UAV")
+				->WithAppendix(TEXT_"Target", target->Name);
+
+		auto writable = CheckComputeWritable(targetDesc.Format);
+		if (writable.HasError()) return writable.GetErrorRef();
+
+		const bool sameSize = source->Desc.Extent == targetDesc.Extent;
+		auto parameters = graph.AllocParameters<FMcroConvertTextureCS::FParameters>();
+		parameters->Source = source;
+		parameters->SourceSampler = settings.Filter == ETextureFilter::Point || sameSize
+			? TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI()
+			: TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		parameters->TargetSize = ToUintVector(targetDesc.Extent);
+		parameters->InvTargetSize = FVector2f(1.f / targetDesc.Extent.X, 1.f / targetDesc.Extent.Y);
+		parameters->Swizzle = ToShaderSwizzle(settings.Swizzle);
+		parameters->bFlipVertically = settings.bFlipVertically;
+		parameters->Target = graph.CreateUAV(target);
+
+		FComputeShaderUtils::AddPass(
+			graph,
+			RDG_EVENT_NAME("Mcro.ConvertTexture %dx%d %s", targetDesc.Extent.X, targetDesc.Extent.Y, GetPixelFormatString(targetDesc.Format)),
+			TShaderMapRef<FMcroConvertTextureCS>(GetGlobalShaderMap(GMaxRHIFeatureLevel)),
+			parameters,
+			FComputeShaderUtils::GetGroupCount(targetDesc.Extent, Detail::ThreadGroupSize)
+		);
+		return Success();
+	}
+
+	TMaybe<FRDGTextureRef> AddDownsampleTexturePass(FRDGBuilder& graph, FRDGTextureRef source, int32 steps)
+	{
+		if (!source)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Downsampling requires a source texture");
+
+		if (steps <= 0) return source;
+
+		const EPixelFormat format = source->Desc.Format;
+		auto writable = CheckComputeWritable(format);
+		if (writable.HasError()) return writable.GetErrorRef();
+
+		TShaderMapRef<FMcroDownsampleTextureCS> shader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		FRDGTextureRef current = source;
+		for (int32 step = 0; step < steps; ++step)
+		{
+			const FIntPoint sourceSize = current->Desc.Extent;
+			const FIntPoint targetSize(FMath::Max(1, sourceSize.X / 2), FMath::Max(1, sourceSize.Y / 2));
+			FRDGTextureRef target = CreateComputeTarget(graph, targetSize, format, TEXT_"Mcro.DownsampledTexture");
+
+			auto parameters = graph.AllocParameters<FMcroDownsampleTextureCS::FParameters>();
+			parameters->Source = current;
+			parameters->SourceSize = ToUintVector(sourceSize);
+			parameters->TargetSize = ToUintVector(targetSize);
+			parameters->Target = graph.CreateUAV(target);
+
+			FComputeShaderUtils::AddPass(
+				graph,
+				RDG_EVENT_NAME("Mcro.DownsampleTexture %dx%d", targetSize.X, targetSize.Y),
+				shader,
+				parameters,
+				FComputeShaderUtils::GetGroupCount(targetSize, Detail::ThreadGroupSize)
+			);
+			current = target;
+
+			if (targetSize == FIntPoint(1, 1)) break;
+		}
+		return current;
+	}
+
+	TMaybe<FRDGYuvPlanes> AddRgbToYuvPass(
+		FRDGBuilder& graph,
+		FRDGTextureRef source,
+		FYuvConversionSettings const& settings
+	) {
+		if (!source)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"YUV conversion requires a source texture");
+
+		const FIntPoint lumaSize = source->Desc.Extent;
+		const FIntPoint chromaSize((lumaSize.X + 1) / 2, (lumaSize.Y + 1) / 2);
+		const bool separateChroma = settings.Layout == EYuvLayout::I420;
+
+		FRDGYuvPlanes result;
+		result.Luma = CreateComputeTarget(graph, lumaSize, PF_G8, TEXT_"Mcro.YuvLuma");
+		if (separateChroma)
+		{
+			result.U = CreateComputeTarget(graph, chromaSize, PF_G8, TEXT_"Mcro.YuvU");
+			result.V = CreateComputeTarget(graph, chromaSize, PF_G8, TEXT_"Mcro.YuvV");
+		}
+		else result.Chroma = CreateComputeTarget(graph, chromaSize, PF_R8G8, TEXT_"Mcro.YuvChroma");
+
+		// Y'CbCr is defined over gamma encoded values, don't let the SRV linearize sRGB sources
+		FRDGTextureSRVDesc sourceSrv = FRDGTextureSRVDesc::Create(source);
+		sourceSrv.SRGBOverride = SRGBO_ForceDisable;
+
+		const Detail::FYuvMatrix matrix = Detail::GetYuvMatrix(settings.ColorSpace, settings.bFullRange);
+		auto parameters = graph.AllocParameters<FMcroRgbToYuvCS::FParameters>();
+		parameters->Source = graph.CreateSRV(sourceSrv);
+		parameters->SourceSize = ToUintVector(lumaSize);
+		parameters->TargetSize = ToUintVector(chromaSize);
+		parameters->bFlipVertically = settings.bFlipVertically;
+		parameters->RgbToY = matrix.Y;
+		parameters->RgbToU = matrix.U;
+		parameters->RgbToV = matrix.V;
+		parameters->LumaTarget = graph.CreateUAV(result.Luma);
+		if (separateChroma)
+		{
+			parameters->UTarget = graph.CreateUAV(result.U);
+			parameters->VTarget = graph.CreateUAV(result.V);
+		}
+		else parameters->ChromaTarget = graph.CreateUAV(result.Chroma);
+
+		FMcroRgbToYuvCS::FPermutationDomain permutation;
+		permutation.Set<FMcroRgbToYuvCS::FSeparateChroma>(separateChroma);
+
+		FComputeShaderUtils::AddPass(
+			graph,
+			RDG_EVENT_NAME("Mcro.RgbToYuv %s %dx%d", separateChroma ? TEXT_"I420" : TEXT_"NV12", lumaSize.X, lumaSize.Y),
+			TShaderMapRef<FMcroRgbToYuvCS>(GetGlobalShaderMap(GMaxRHIFeatureLevel), permutation),
+			parameters,
+			FComputeShaderUtils::GetGroupCount(chromaSize, Detail::ThreadGroupSize)
+		);
+		return result;
+	}
+
+	namespace Detail
+	{
+		FYuvMatrix GetYuvMatrix(EYuvColorSpace colorSpace, bool fullRange)
+		{
+			const float kr = colorSpace == EYuvColorSpace::Rec601 ? 0.299f : 0.2126f;
+			const float kb = colorSpace == EYuvColorSpace::Rec601 ? 0.114f : 0.0722f;
+			const float kg = 1.f - kr - kb;
+
+			const float lumaScale = fullRange ? 1.f : 219.f / 255.f;
+			const float chromaScale = fullRange ? 1.f : 224.f / 255.f;
+			const float lumaOffset = fullRange ? 0.f : 16.f / 255.f;
+			const float chromaOffset = 128.f / 255.f;
+
+			const float cb = chromaScale * 0.5f / (1.f - kb);
+			const float cr = chromaScale * 0.5f / (1.f - kr);
+			return {
+				.Y = { kr * lumaScale, kg * lumaScale, kb * lumaScale, lumaOffset },
+				.U = { -kr * cb, -kg * cb, (1.f - kb) * cb, chromaOffset },
+				.V = { (1.f - kr) * cr, -kg * cr, -kb * cr, chromaOffset }
+			};
+		}
+
+		void RegisterShaderDirectory()
+		{
+			TSharedPtr<IPlugin> plugin = IPluginManager::Get().FindPlugin(TEXT_"Mcro");
+			if (!plugin) return;
+
+			const FString shaderDirectory = FPaths::Combine(plugin->GetBaseDir(), TEXT_"Shaders");
+			if (!AllShaderSourceDirectoryMappings().Contains(TEXT_"/Plugin/Mcro"))
+				AddShaderSourceDirectoryMapping(TEXT_"/Plugin/Mcro", shaderDirectory);
+		}
+	}
+}
@@ -9,7 +9,10 @@
  *  @date 2025
  */
 #include "Mcro/Rendering/Textures.h"
+#include "Mcro/Rendering/TexturePool.h"
+#include "RenderUtils.h"
 #include "TextureResource.h"
+#include "UObject/Package.h"
 #include "Engine/Texture2D.h"
 #include "Engine/Texture2DDynamic.h"
 #include "Engine/TextureRenderTarget.h"
@@ -43,4 +46,19 @@ namespace Mcro::Rendering::Textures
 		ensureMsgf(format != PF_Unknown, TEXT_"Couldn't get pixel format of %s", *texture->GetClass()->GetName());
 		return {width, height, format};
 	}
+
+	int64 GetTextureMemorySize(FUnrealTextureSize const& size)
+	{
+		if (!size) return 0;
+		return static_cast<int64>(CalcTextureSize(size.Width, size.Height, size.Format, 1));
+	}
+
+	TStrongObjectPtr<UTextureRenderTarget2D> CreateRenderTarget2D(FUnrealTextureSize const& size)
+	{
+		check(IsInGameThread());
+		TStrongObjectPtr result(NewObject<UTextureRenderTarget2D>(GetTransientPackage(), NAME_None, RF_Transient));
+		result->InitCustomFormat(size.Width, size.Height, size.Format, false);
+		result->UpdateResourceImmediate(false);
+		return result;
+	}
 }
@@ -0,0 +1,197 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Rendering/UploadRing.h"
+#include "Mcro/Threading.h"
+#include "RHICommandList.h"
+#include "TextureResource.h"
+#include "Misc/ScopeLock.h"
+
+namespace Mcro::Rendering::Textures
+{
+	using namespace Mcro::Threading;
+
+	namespace
+	{
+		struct FSharedUploadRings
+		{
+			FCriticalSection Lock;
+			TMap<FUnrealTextureSize, TSharedRef<FTextureUploadRing>> Rings;
+		};
+
+		FSharedUploadRings& GetSharedUploadRings()
+		{
+			static FSharedUploadRings rings;
+			return rings;
+		}
+	}
+
+	namespace Detail
+	{
+		void ReleaseSharedUploadRings()
+		{
+			FSharedUploadRings& shared = GetSharedUploadRings();
+			FScopeLock scope(&shared.Lock);
+			shared.Rings.Empty();
+		}
+	}
+
+	FTextureUploadSlot::FTextureUploadSlot(FTextureUploadSlot&& other) noexcept
+		: Ring(MoveTemp(other.Ring))
+		, Data(other.Data)
+		, RowBytes(other.RowBytes)
+		, Index(Exchange(other.Index, INDEX_NONE))
+	{}
+
+	FTextureUploadSlot& FTextureUploadSlot::operator = (FTextureUploadSlot&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (Ring) Ring->Free(Index);
+			Ring = MoveTemp(other.Ring);
+			Data = other.Data;
+			RowBytes = other.RowBytes;
+			Index = Exchange(other.Index, INDEX_NONE);
+		}
+		return *this;
+	}
+
+	FTextureUploadSlot::~FTextureUploadSlot()
+	{
+		if (Ring) Ring->Free(Index);
+	}
+
+	FTextureUploadRing::FTextureUploadRing(FUnrealTextureSize const& size, int32 depth)
+		: Size(size)
+		, Depth(FMath::Max(1, depth))
+	{
+		const FPixelFormatInfo& format = GPixelFormats[size.Format];
+		const int32 blocksX = FMath::DivideAndRoundUp<int32>(size.Width, format.BlockSizeX);
+		const int32 blocksY = FMath::DivideAndRoundUp<int32>(size.Height, format.BlockSizeY);
+		RowBytes = blocksX * format.BlockBytes;
+		SlotBytes = static_cast<int64>(RowBytes) * blocksY;
+
+		Memory.SetNumUninitialized(SlotBytes * Depth);
+		States = MakeUnique<std::atomic<ESlotState>[]>(Depth);
+		for (int32 i = 0; i < Depth; ++i)
+			States[i].store(ESlotState::Free, std::memory_order_relaxed);
+	}
+
+	TSharedRef<FTextureUploadRing> FTextureUploadRing::Get(FUnrealTextureSize const& size)
+	{
+		FSharedUploadRings& shared = GetSharedUploadRings();
+		FScopeLock scope(&shared.Lock);
+		if (TSharedRef<FTextureUploadRing>* ring = shared.Rings.Find(size))
+			return *ring;
+		return shared.Rings.Add(size, MakeShared<FTextureUploadRing>(size));
+	}
+
+	int32 FTextureUploadRing::TrimShared()
+	{
+		FSharedUploadRings& shared = GetSharedUploadRings();
+		FScopeLock scope(&shared.Lock);
+
+		// Pending render commands and acquired slots hold a reference too, so the map being the only owner means the
+		// ring is unused. Nobody can get a new reference to it while the lock is held.
+		int32 released = 0;
+		for (auto it = shared.Rings.CreateIterator(); it; ++it)
+		{
+			if (it.Value().GetSharedReferenceCount() == 1)
+			{
+				it.RemoveCurrent();
+				++released;
+			}
+		}
+		return released;
+	}
+
+	FTextureUploadSlot FTextureUploadRing::Acquire()
+	{
+		// Start from the slot after the last acquired one, so the oldest submitted slots get reused last
+		const uint32 start = NextSlot.fetch_add(1, std::memory_order_relaxed);
+		for (int32 i = 0; i < Depth; ++i)
+		{
+			const int32 index = static_cast<int32>((start + i) % Depth);
+			ESlotState expected = ESlotState::Free;
+			if (States[index].compare_exchange_strong(expected, ESlotState::Writing, std::memory_order_acquire))
+			{
+				FTextureUploadSlot slot;
+				slot.Ring = AsShared();
+				slot.Data = TArrayView<uint8>(Memory.GetData() + SlotBytes * index, SlotBytes);
+				slot.RowBytes = RowBytes;
+				slot.Index = index;
+				return slot;
+			}
+		}
+		return {};
+	}
+
+	void FTextureUploadRing::Submit(FTextureUploadSlot&& slot, UTexture* target)
+	{
+		if (!slot) return;
+		check(slot.Ring.Get() == this);
+
+		FTextureResource* resource = IsValid(target) ? target->GetResource() : nullptr;
+		if (!resource) return;
+
+		const int32 index = Exchange(slot.Index, INDEX_NONE);
+		States[index].store(ESlotState::Pending, std::memory_order_release);
+		EnqueueRenderCommand(
+			[ring = MoveTemp(slot.Ring), index, resource](FRHICommandListImmediate& cmdList)
+			{
+				ring->Upload(cmdList, index, resource->GetTexture2DRHI());
+			}
+		);
+	}
+
+	void FTextureUploadRing::Submit(FTextureUploadSlot&& slot, FTextureRHIRef const& target)
+	{
+		if (!slot) return;
+		check(slot.Ring.Get() == this);
+		if (!target) return;
+
+		const int32 index = Exchange(slot.Index, INDEX_NONE);
+		States[index].store(ESlotState::Pending, std::memory_order_release);
+		EnqueueRenderCommand(
+			[ring = MoveTemp(slot.Ring), index, target](FRHICommandListImmediate& cmdList)
+			{
+				ring->Upload(cmdList, index, target.GetReference());
+			}
+		);
+	}
+
+	int32 FTextureUploadRing::NumInFlight() const
+	{
+		int32 result = 0;
+		for (int32 i = 0; i < Depth; ++i)
+			result += States[i].load(std::memory_order_relaxed) != ESlotState::Free;
+		return result;
+	}
+
+	void FTextureUploadRing::Free(int32 index)
+	{
+		if (index != INDEX_NONE)
+			States[index].store(ESlotState::Free, std::memory_order_release);
+	}
+
+	void FTextureUploadRing::Upload(FRHICommandListImmediate& cmdList, int32 index, FRHITexture* target)
+	{
+		if (target && ensure(target->GetDesc().Format == Size.Format))
+		{
+			const FUpdateTextureRegion2D region(0, 0, 0, 0, Size.Width, Size.Height);
+
+			// The command list copies the source data when it's deferred to the RHI thread, so the staging buffer
+			// can be reused right after this call.
+			cmdList.UpdateTexture2D(target, 0, region, RowBytes, Memory.GetData() + SlotBytes * index);
+		}
+		Free(index);
+	}
+}
@@ -0,0 +1,240 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/SharedObjects.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+namespace Mcro::SharedObjects
+{
+	using namespace Detail;
+
+	namespace
+	{
+		constexpr int32 SizeClassCount = MaxPooledSharedSize / PooledSharedGranularity;
+
+
+		struct FFreeBlock
+		{
+			FFreeBlock* Next;
+		};
+
+		struct FSharedBucket
+		{
+			FCriticalSection Lock;
+			FFreeBlock* Head = nullptr;
+			int32 Count = 0;
+		};
+
+		struct FSharedPool
+		{
+			FSharedBucket Buckets[SizeClassCount];
+			std::atomic<uint64> HeapAllocations { 0 };
+			std::atomic<uint64> SharedPoolHits { 0 };
+		};
+
+		/** @brief Never destroyed, shared objects may be released during static destruction */
+		FSharedPool& GetSharedPool()
+		{
+			static FSharedPool* pool = new FSharedPool();
+			return *pool;
+		}
+
+		constexpr int32 GetSizeClass(SIZE_T size)
+		{
+			return static_cast<int32>((FMath::Max<SIZE_T>(size, 1) + PooledSharedGranularity - 1) / PooledSharedGranularity) - 1;
+		}
+
+		constexpr SIZE_T GetSizeClassBytes(int32 sizeClass)
+		{
+			return static_cast<SIZE_T>(sizeClass + 1) * PooledSharedGranularity;
+		}
+
+		/**
+		 *	@brief
+		 *	A thread-local cache holds at most this much memory per size class before returning some to the shared
+		 *	pool, so a thread retains at most 64KB in its cache.
+		 */
+		constexpr SIZE_T ThreadCacheBytesPerSizeClass = 2048;
+
+		/** @brief Number of blocks a thread-local cache holds of a size class before returning some */
+		constexpr int32 GetThreadCacheCapacity(int32 sizeClass)
+		{
+			return FMath::Clamp(static_cast<int32>(ThreadCacheBytesPerSizeClass / GetSizeClassBytes(sizeClass)), 4, 64);
+		}
+
+		/** @brief Number of blocks moved at once between the thread-local caches and the shared pool */
+		constexpr int32 GetTransferBatch(int32 sizeClass)
+		{
+			return GetThreadCacheCapacity(sizeClass) / 2;
+		}
+
+		void PushToShared(int32 sizeClass, FFreeBlock* head, FFreeBlock* tail, int32 count)
+		{
+			FSharedBucket& bucket = GetSharedPool().Buckets[sizeClass];
+			FScopeLock lock(&bucket.Lock);
+			tail->Next = bucket.Head;
+			bucket.Head = head;
+			bucket.Count += count;
+		}
+
+		/** @brief Set once the cache of the current thread is destroyed, blocks freed afterwards go to the shared pool */
+		thread_local bool GThreadCacheDestroyed = false;
+
+		struct FThreadCache
+		{
+			FFreeBlock* Heads[SizeClassCount] {};
+			int32 Counts[SizeClassCount] {};
+
+			~FThreadCache()
+			{
+				GThreadCacheDestroyed = true;
+				for (int32 sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+				{
+					FFreeBlock* head = Heads[sizeClass];
+					if (!head) continue;
+
+					FFreeBlock* tail = head;
+					while (tail->Next) tail = tail->Next;
+					PushToShared(sizeClass, head, tail, Counts[sizeClass]);
+				}
+			}
+
+			/** @brief Take a batch of blocks from the shared pool, returns false if it's empty */
+			bool Refill(int32 sizeClass)
+			{
+				FSharedBucket& bucket = GetSharedPool().Buckets[sizeClass];
+				FScopeLock lock(&bucket.Lock);
+				if (!bucket.Head) return false;
+
+				FFreeBlock* head = bucket.Head;
+				FFreeBlock* tail = head;
+				int32 count = 1;
+				for (const int32 batch = GetTransferBatch(sizeClass); count < batch && tail->Next; ++count)
+					tail = tail->Next;
+
+				bucket.Head = tail->Next;
+				bucket.Count -= count;
+				tail->Next = Heads[sizeClass];
+				Heads[sizeClass] = head;
+				Counts[sizeClass] += count;
+				return true;
+			}
+
+			/** @brief Return a batch of blocks to the shared pool */
+			void Spill(int32 sizeClass)
+			{
+				const int32 batch = GetTransferBatch(sizeClass);
+				FFreeBlock* head = Heads[sizeClass];
+				FFreeBlock* tail = head;
+				for (int32 i = 1; i < batch; ++i)
+					tail = tail->Next;
+
+				Heads[sizeClass] = tail->Next;
+				Counts[sizeClass] -= batch;
+				PushToShared(sizeClass, head, tail, batch);
+			}
+		};
+
+		thread_local FThreadCache GThreadCache;
+	}
+
+	void* Detail::AllocatePooledShared(SIZE_T size)
+	{
+		auto& pool = GetSharedPool();
+		if (size > MaxPooledSharedSize)
+		{
+			pool.HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+			return FMemory::Malloc(size, PooledSharedAlignment);
+		}
+
+		const int32 sizeClass = GetSizeClass(size);
+		if (!GThreadCacheDestroyed) [[likely]]
+		{
+			FThreadCache& cache = GThreadCache;
+			if (!cache.Heads[sizeClass] && cache.Refill(sizeClass))
+				pool.SharedPoolHits.fetch_add(1, std::memory_order_relaxed);
+
+			if (cache.Heads[sizeClass])
+			{
+				FFreeBlock* block = cache.Heads[sizeClass];
+				cache.Heads[sizeClass] = block->Next;
+				--cache.Counts[sizeClass];
+				return block;
+			}
+		}
+
+		pool.HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+		return FMemory::Malloc(GetSizeClassBytes(sizeClass), PooledSharedAlignment);
+	}
+
+	void Detail::FreePooledShared(void* block, SIZE_T size)
+	{
+		if (!block) return;
+		if (size > MaxPooledSharedSize)
+		{
+			FMemory::Free(block);
+			return;
+		}
+
+		const int32 sizeClass = GetSizeClass(size);
+		auto freeBlock = static_cast<FFreeBlock*>(block);
+		if (GThreadCacheDestroyed) [[unlikely]]
+		{
+			PushToShared(sizeClass, freeBlock, freeBlock, 1);
+			return;
+		}
+
+		FThreadCache& cache = GThreadCache;
+		freeBlock->Next = cache.Heads[sizeClass];
+		cache.Heads[sizeClass] = freeBlock;
+		if (++cache.Counts[sizeClass] > GetThreadCacheCapacity(sizeClass))
+			cache.Spill(sizeClass);
+	}
+
+	FSharedObjectPoolStats GetSharedObjectPoolStats()
+	{
+		auto& pool = GetSharedPool();
+		FSharedObjectPoolStats result {
+			.HeapAllocations = pool.HeapAllocations.load(std::memory_order_relaxed),
+			.SharedPoolHits = pool.SharedPoolHits.load(std::memory_order_relaxed)
+		};
+		for (int32 sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+		{
+			FSharedBucket& bucket = pool.Buckets[sizeClass];
+			FScopeLock lock(&bucket.Lock);
+			result.SharedPooledBytes += bucket.Count * GetSizeClassBytes(sizeClass);
+		}
+		return result;
+	}
+
+	void TrimSharedObjectPool()
+	{
+		auto& pool = GetSharedPool();
+		for (FSharedBucket& bucket : pool.Buckets)
+		{
+			FFreeBlock* head;
+			{
+				FScopeLock lock(&bucket.Lock);
+				head = bucket.Head;
+				bucket.Head = nullptr;
+				bucket.Count = 0;
+			}
+			while (head)
+			{
+				FFreeBlock* next = head->Next;
+				FMemory::Free(head);
+				head = next;
+			}
+		}
+	}
+}
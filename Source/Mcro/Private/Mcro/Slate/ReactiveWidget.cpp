@@ -0,0 +1,46 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Slate/ReactiveWidget.h"
+
+namespace Mcro::Slate::Detail
+{
+	TBitArray<> LongestIncreasingSubsequence(TConstArrayView<int32> sequence)
+	{
+		const int32 num = sequence.Num();
+		TBitArray<> result(false, num);
+		if (num == 0) return result;
+
+		// tails[l]: index of the smallest item ending an increasing run of length l + 1
+		TArray<int32, TInlineAllocator<64>> tails;
+		TArray<int32, TInlineAllocator<64>> predecessors;
+		predecessors.SetNumUninitialized(num);
+		for (int32 i = 0; i < num; ++i)
+		{
+			const int32 value = sequence[i];
+			int32 low = 0;
+			int32 high = tails.Num();
+			while (low < high)
+			{
+				const int32 middle = (low + high) / 2;
+				if (sequence[tails[middle]] < value) low = middle + 1;
+				else high = middle;
+			}
+			predecessors[i] = low > 0 ? tails[low - 1] : INDEX_NONE;
+			if (low == tails.Num()) tails.Add(i);
+			else tails[low] = i;
+		}
+
+		for (int32 i = tails.Last(); i != INDEX_NONE; i = predecessors[i])
+			result[i] = true;
+		return result;
+	}
+}
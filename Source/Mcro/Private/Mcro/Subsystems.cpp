@@ -0,0 +1,50 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Subsystems.h"
+#include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace Mcro::Subsystems::Detail
+{
+	std::atomic<uint32> GSubsystemCacheEpoch { 1 };
+
+	namespace
+	{
+		TArray<FDelegateHandle> GInvalidationHandles;
+
+		void Invalidate()
+		{
+			GSubsystemCacheEpoch.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void StartSubsystemCacheInvalidation()
+	{
+		GInvalidationHandles = {
+			FWorldDelegates::OnPostWorldInitialization.AddLambda([](UWorld*, UWorld::InitializationValues) { Invalidate(); }),
+			FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld*, bool, bool) { Invalidate(); }),
+			FWorldDelegates::OnStartGameInstance.AddLambda([](UGameInstance*) { Invalidate(); }),
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([] { Invalidate(); }),
+		};
+	}
+
+	void StopSubsystemCacheInvalidation()
+	{
+		if (GInvalidationHandles.IsEmpty()) return;
+		FWorldDelegates::OnPostWorldInitialization.Remove(GInvalidationHandles[0]);
+		FWorldDelegates::OnWorldCleanup.Remove(GInvalidationHandles[1]);
+		FWorldDelegates::OnStartGameInstance.Remove(GInvalidationHandles[2]);
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(GInvalidationHandles[3]);
+		GInvalidationHandles.Reset();
+		Invalidate();
+	}
+}
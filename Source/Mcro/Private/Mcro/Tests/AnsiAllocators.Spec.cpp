@@ -0,0 +1,142 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Mcro/TextMacros.h"
+#include "Mcro/Ansi/ArenaAllocator.h"
+#include "Mcro/Ansi/PoolAllocator.h"
+#include "Mcro/Threading/Scratch.h"
+
+DEFINE_SPEC(
+	FMcroAnsiAllocators_Spec,
+	TEXT_"Mcro.AnsiAllocators",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroAnsiAllocators_Spec::Define()
+{
+	using namespace Mcro::Ansi;
+
+	Describe(TEXT_"TAnsiInlineAllocator", [this]
+	{
+		It(TEXT_"should keep elements in-object until it spills", [this]
+		{
+			TAnsiInlineArray<int32, 8> values;
+			const uint8* object = reinterpret_cast<const uint8*>(&values);
+			auto isInline = [&]
+			{
+				const SSIZE_T offset = reinterpret_cast<const uint8*>(values.GetData()) - object;
+				return offset >= 0 && offset < (SSIZE_T)sizeof(values);
+			};
+
+			for (int32 i = 0; i < 8; ++i) values.Add(i);
+			TestTrue(TEXT_"Inline with 8 elements", isInline());
+
+			values.Add(8);
+			TestFalse(TEXT_"Spilled with 9 elements", isInline());
+			TestEqual(TEXT_"Values survive spilling", values[3], 3);
+		});
+	});
+
+	Describe(TEXT_"FArenaAllocator", [this]
+	{
+		It(TEXT_"should reuse arena memory across scopes", [this]
+		{
+			FArena arena(4096);
+			int32* firstData = nullptr;
+			{
+				FArenaScope scope(arena);
+				TAnsiArenaArray<int32> values;
+				for (int32 i = 0; i < 100; ++i) values.Add(i);
+				firstData = values.GetData();
+				TestEqual(TEXT_"Last value", values.Last(), 99);
+			}
+			const SIZE_T reserved = arena.GetReservedBytes();
+			{
+				FArenaScope scope(arena);
+				TAnsiArenaArray<int32> values;
+				for (int32 i = 0; i < 100; ++i) values.Add(i);
+				TestEqual(TEXT_"Same memory is handed out again", values.GetData(), firstData);
+			}
+			TestEqual(TEXT_"No new blocks were needed", arena.GetReservedBytes(), reserved);
+		});
+
+		It(TEXT_"should work with maps", [this]
+		{
+			FArena arena;
+			FArenaScope scope(arena);
+			TAnsiArenaMap<int32, FString> map;
+			for (int32 i = 0; i < 50; ++i) map.Add(i, FString::FromInt(i));
+			TestEqual(TEXT_"Num", map.Num(), 50);
+			TestEqual(TEXT_"Value", map[42], FString(TEXT_"42"));
+		});
+
+		It(TEXT_"should fall back to the heap without a scope", [this]
+		{
+			TAnsiArenaArray<int32> values;
+			for (int32 i = 0; i < 100; ++i) values.Add(i);
+			TestEqual(TEXT_"Num", values.Num(), 100);
+			TestNull(TEXT_"No current arena", FArena::GetCurrent());
+		});
+	});
+
+	Describe(TEXT_"FTaskScratchScope", [this]
+	{
+		It(TEXT_"should rewind the scratch arena of the thread", [this]
+		{
+			using namespace Mcro::Threading;
+			FArena& arena = GetThreadScratchArena();
+			const FArena::FMark before = arena.GetMark();
+			{
+				FTaskScratchScope scratch;
+				TScratchArray<int32> values;
+				for (int32 i = 0; i < 100; ++i) values.Add(i);
+				TestEqual(TEXT_"Allocated from the scratch arena", FArena::GetCurrent(), &arena);
+				TestTrue(TEXT_"Arena has advanced", arena.GetMark().Offset != before.Offset || arena.GetMark().Block != before.Block);
+			}
+			TestEqual(TEXT_"Rewound block", arena.GetMark().Block, before.Block);
+			TestEqual(TEXT_"Rewound offset", arena.GetMark().Offset, before.Offset);
+		});
+	});
+
+	Describe(TEXT_"FPoolAllocator", [this]
+	{
+		It(TEXT_"should recycle blocks of the same size class", [this]
+		{
+			int32* firstData = nullptr;
+			{
+				TAnsiPoolArray<int32> values;
+				values.Reserve(1000);
+				firstData = values.GetData();
+			}
+			TAnsiPoolArray<int32> values;
+			values.Reserve(1000);
+			TestEqual(TEXT_"Same block is handed out again", values.GetData(), firstData);
+		});
+
+		It(TEXT_"should fill the size class with slack", [this]
+		{
+			TAnsiPoolArray<int32> values;
+			values.Reserve(100);
+			TestEqual(TEXT_"Capacity fills 512 bytes", values.Max(), 128);
+		});
+
+		It(TEXT_"should work with sets", [this]
+		{
+			TAnsiPoolSet<int32> set;
+			for (int32 i = 0; i < 50; ++i) set.Add(i);
+			TestTrue(TEXT_"Contains", set.Contains(42));
+		});
+	});
+}
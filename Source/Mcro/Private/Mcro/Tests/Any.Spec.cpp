@@ -78,6 +78,27 @@ void FMcroAny_Spec::Define()
 			TestEqual(TEXT_"Contents shouldn't actually move", movedCopy.TryGet<FCopyConstructCounter>()->MoveCount, 0);
 		});
 		
+		It(TEXT_"should store small objects inline", [this]
+		{
+			FAny payload(TInPlaceType<FCopyConstructCounter>{});
+			TestTrue(TEXT_"Small object is stored inline", payload.IsInline());
+			check(payload.TryGet<FCopyConstructCounter>());
+
+			FAny copy = payload;
+			TestTrue(TEXT_"Copy is stored inline", copy.IsInline());
+			TestEqual(TEXT_"Copy once", copy.TryGet<FCopyConstructCounter>()->CopyCount, 1);
+
+			FAny movedCopy { MoveTemp(copy) };
+			TestFalse(TEXT_"Source should be invalid", copy.IsValid());
+			TestFalse(TEXT_"Source isn't inline anymore", copy.IsInline());
+			TestTrue(TEXT_"Moved object is stored inline", movedCopy.IsInline());
+			TestEqual(TEXT_"Inline contents are move constructed", movedCopy.TryGet<FCopyConstructCounter>()->MoveCount, 1);
+
+			FAny large(TInPlaceType<FMatrix>{}, FMatrix::Identity);
+			TestFalse(TEXT_"Large object is stored on the heap", large.IsInline());
+			TestNotNull(TEXT_"Large object is accessible", large.TryGet<FMatrix>());
+		});
+		
 		It(TEXT_"should support object lifespan customization", [this]
 		{
 			TMap<int, FAnyTest> stupidPool { {1, FAnyTest{.B = 1}} };
@@ -81,9 +81,26 @@ void FMcroAutoModularFeatures_Spec::Define()
 			}
 		});
 
+		It(TEXT_"should keep pinned implementation views stable", [this]
+		{
+			TOptional<FTestFeatureImplementation> first;
+			first.Emplace();
+			auto view = ITestFeature::GetAllView();
+			TestEqual(TEXT_"One implementation in view", view.Num(), 1);
+
+			{
+				FTestFeatureImplementation second {};
+				TestEqual(TEXT_"New implementation is visible", ITestFeature::ImplementationCount(), 2);
+				TestEqual(TEXT_"Pinned view is unchanged", view.Num(), 1);
+			}
+			first.Reset();
+			TestEqual(TEXT_"Pinned view still holds its snapshot", view.Num(), 1);
+			TestEqual(TEXT_"All implementations are gone", ITestFeature::ImplementationCount(), 0);
+		});
+
 		LatentIt(TEXT_"should be available via TFuture", 30_mSec, [this](FDoneDelegate const& done)
 		{
-			ITestBelatedFeature::GetBelated().Next([this, &done](ITestBelatedFeature*)
+			ITestBelatedFeature::GetBelated().Next([done](ITestBelatedFeature*)
 			{
 				(void) done.ExecuteIfBound();
 			});
@@ -12,6 +12,7 @@
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
 #include "TestHelpers.h"
+#include "Async/ParallelFor.h"
 
 #include "Mcro/CommonCore.h"
 
@@ -26,6 +27,9 @@ namespace Mcro::Test
 
 	struct FComposableOther : IComposable {};
 	struct FSharedComposable : IComposable, TSharedFromThis<FSharedComposable> {};
+	struct FPooledComposable : IComposable { static constexpr bool PoolComponents = true; };
+	struct FCopyOnWriteComposable : IComposable { static constexpr bool ShareComponentsOnCopy = true; };
+	struct FConcurrentComposable : IComposable { static constexpr bool ConcurrentReads = true; };
 
 	struct FSimpleComponent { int D = 3; };
 	
@@ -35,6 +39,10 @@ namespace Mcro::Test
 	struct FComponentB : FComponentBase { int C = 3; };
 	struct FComponentC : FComponentBase { int C = 4; };
 
+	struct FPooledComponent { int F = 8; };
+	struct FPosition { float Value = 0; };
+	struct FVelocity { float Value = 0; };
+
 	struct IAnotherInterface { int E = 0; };
 	struct FAutoComponentA : TInherit<IComponentInterface, IAnotherInterface> { int C = 5; };
 	struct FAutoComponentB : TInherit<IComponentInterface, IAnotherInterface> { int C = 6; };
@@ -48,6 +56,18 @@ namespace Mcro::Test
 		}
 	};
 
+	struct FStaticAwareComponent : IComponent
+	{
+		int Created = 0;
+		int Copied = 0;
+		
+		template <typename Parent>
+		void OnCreatedAt(Parent& to) { ++Created; }
+		
+		template <typename Parent>
+		void OnCopiedAt(Parent& to, FStaticAwareComponent const& from) { Copied = from.Copied + 1; }
+	};
+
 	struct FStrictComponent : IStrictComponent 
 	{
 		void OnCreatedAt(FComposableSimple& to) const
@@ -100,6 +120,19 @@ void FMcroComposition_Spec::Define()
 
 			auto anotherComponents = payload.GetComponents<IAnotherInterface>() | RenderAs<TArray>();
 			TestEqual(TEXT_"Support TInherit",  anotherComponents.Num(), 3);
+
+			int32 viewed = 0;
+			for (IComponentInterface* component : payload.GetComponents<IComponentInterface>())
+			{
+				TestNotNull(TEXT_"Typed view only yields valid components", component);
+				++viewed;
+			}
+			TestEqual(TEXT_"Typed view iterates all matching components", viewed, 6);
+			TestNotNull(TEXT_"TryGetComponent through alias", payload.TryGetComponent<IAnotherInterface>());
+
+			auto dynamicComponents = payload.GetComponentsDynamic(TTypeHash<IAnotherInterface>) | RenderAs<TArray>();
+			TestEqual(TEXT_"Dynamic view yields boxed components", dynamicComponents.Num(), 3);
+			TestEqual(TEXT_"Dynamic view of exact component", ranges::distance(payload.GetComponentsDynamic(TTypeHash<FSimpleComponent>)), 1ll);
 		});
 		
 		It(TEXT_"should call OnComponentRegistered with supported components", [this]
@@ -136,5 +169,200 @@ void FMcroComposition_Spec::Define()
 			auto components = payload->GetComponents<IComponentInterface>() | RenderAs<TArray>();
 			TestEqual(TEXT_"Getting multiple Components",  components.Num(), 3);
 		});
+
+		It(TEXT_"should allocate components from pools when opted in.", [this]
+		{
+			auto& pool = TObjectPool<FPooledComponent>::Get();
+			int32 liveBefore = pool.Num();
+			{
+				auto payload = FPooledComposable().With<FPooledComponent>();
+				TestEqual(TEXT_"Component is allocated from the pool", pool.Num(), liveBefore + 1);
+
+				auto copy = payload;
+				TestEqual(TEXT_"Copied component is allocated from the pool", pool.Num(), liveBefore + 2);
+				TestEqual(TEXT_"Copied component value", copy.Get<FPooledComponent>().F, 8);
+			}
+			TestEqual(TEXT_"Components are returned to the pool", pool.Num(), liveBefore);
+		});
+
+		It(TEXT_"should share components of copy-on-write composables until mutated.", [this]
+		{
+			auto payload = FCopyOnWriteComposable()
+				.With<FSimpleComponent>()
+				.With<FComponentA>().With(TTypes<FComponentBase, IComponentInterface>())
+			;
+			auto copy = payload;
+			auto const& constPayload = payload;
+			auto const& constCopy = copy;
+			TestEqual(TEXT_"Copies share components",
+				constCopy.TryGet<FSimpleComponent>(), constPayload.TryGet<FSimpleComponent>()
+			);
+
+			int32 iterated = 0;
+			for (const IComponentInterface* component : constCopy.GetComponents<IComponentInterface>())
+				iterated += component != nullptr;
+			TestEqual(TEXT_"Const iteration visits components", iterated, 1);
+			TestEqual(TEXT_"Const iteration doesn't detach",
+				constCopy.TryGet<IComponentInterface>(), constPayload.TryGet<IComponentInterface>()
+			);
+			
+			copy.Get<FSimpleComponent>().D = 10;
+			TestNotEqual(TEXT_"Mutated component is detached",
+				constCopy.TryGet<FSimpleComponent>(), constPayload.TryGet<FSimpleComponent>()
+			);
+			TestEqual(TEXT_"Original component is unchanged", constPayload.Get<FSimpleComponent>().D, 3);
+			TestEqual(TEXT_"Detached component is changed", constCopy.Get<FSimpleComponent>().D, 10);
+			TestEqual(TEXT_"Other components stay shared",
+				constCopy.TryGet<IComponentInterface>(), constPayload.TryGet<IComponentInterface>()
+			);
+		});
+
+		It(TEXT_"should serve concurrent read-only queries from a published table.", [this]
+		{
+			FConcurrentComposable payload;
+			payload.With<FSimpleComponent>();
+			auto const& constPayload = payload;
+			const FSimpleComponent* expected = constPayload.TryGet<FSimpleComponent>();
+
+			std::atomic<int32> mismatches { 0 };
+			ParallelFor(64, [&](int32 i)
+			{
+				if (i == 0) payload.With<FComponentA>().With(TTypes<FComponentBase>());
+				if (constPayload.TryGet<FSimpleComponent>() != expected) ++mismatches;
+			});
+			TestEqual(TEXT_"Readers always found the existing component", mismatches.load(), 0);
+			TestEqual(TEXT_"Aliases are published", constPayload.Get<FComponentBase>().B, 1);
+			TestEqual(TEXT_"Mutable queries see the same component", payload.TryGet<FSimpleComponent>(), expected);
+		});
+
+		It(TEXT_"should keep shared query results alive after the composable is gone.", [this]
+		{
+			TSharedPtr<const FSimpleComponent, ESPMode::ThreadSafe> kept;
+			{
+				FConcurrentComposable payload;
+				payload.With<FSimpleComponent>();
+				kept = payload.TryGetShared<FSimpleComponent>();
+				TestEqual(TEXT_"Shared result is the component", kept.Get(), payload.TryGet<FSimpleComponent>());
+			}
+			TestTrue(TEXT_"Shared result is still valid", kept.IsValid());
+			TestEqual(TEXT_"Shared result is intact", kept->D, 3);
+		});
+
+		It(TEXT_"should keep cached lookups coherent with changes.", [this]
+		{
+			FCopyOnWriteComposable payload;
+			payload.EnableLookupCache();
+			payload.With<FSimpleComponent>();
+			auto const& constPayload = payload;
+
+			const FSimpleComponent* shared = constPayload.TryGet<FSimpleComponent>();
+			TestEqual(TEXT_"Repeated lookup is cached", constPayload.TryGet<FSimpleComponent>(), shared);
+
+			auto copy = payload;
+			auto const& constCopy = copy;
+			TestTrue(TEXT_"Copies inherit the cache", copy.IsLookupCacheEnabled());
+
+			payload.Get<FSimpleComponent>().D = 10;
+			TestNotEqual(TEXT_"Mutable lookup detaches after copy",
+				constPayload.TryGet<FSimpleComponent>(), constCopy.TryGet<FSimpleComponent>()
+			);
+			TestEqual(TEXT_"Copy is unchanged", constCopy.Get<FSimpleComponent>().D, 3);
+
+			FCopyOnWriteComposable moved = MoveTemp(copy);
+			TestNotNull(TEXT_"Moved composable finds its component", moved.TryGet<FSimpleComponent>());
+			TestNull(TEXT_"Moved-from composable doesn't return stale cached components",
+				constCopy.TryGet<FSimpleComponent>()
+			);
+
+			TestNull(TEXT_"Missing component", constPayload.TryGet<FComponentBase>());
+			payload.With<FComponentA>().With(TTypes<FComponentBase>());
+			TestNotNull(TEXT_"Added alias is found", constPayload.TryGet<FComponentBase>());
+		});
+	});
+
+	Describe(TEXT_"FArchetypeStorage", [this]
+	{
+		It(TEXT_"should group entities by their component sets.", [this]
+		{
+			FArchetypeStorage storage;
+			TArray<FArchetypeEntity> moving;
+			for (int i = 0; i < 100; ++i)
+				moving.Add(storage.Create(FPosition{}, FVelocity{ .Value = static_cast<float>(i) }));
+			for (int i = 0; i < 10; ++i)
+				storage.Create(FPosition{ .Value = -1 });
+			storage.Create(FVelocity{}, FPosition{});
+
+			TestEqual(TEXT_"Entity count", storage.Num(), 111);
+			TestEqual(TEXT_"Component order doesn't define a new archetype", storage.NumArchetypes(), 2);
+
+			storage.ParallelForEach<FPosition, FVelocity const>([](FPosition& position, FVelocity const& velocity)
+			{
+				position.Value += velocity.Value;
+			});
+			TestEqual(TEXT_"Batch updated component", storage.TryGet<FPosition>(moving[42])->Value, 42.f);
+
+			int visited = 0;
+			storage.ForEach<FPosition>([&](FArchetypeEntity entity, FPosition const& position)
+			{
+				TestTrue(TEXT_"Entity handle given to ForEach is alive", storage.IsAlive(entity));
+				++visited;
+			});
+			TestEqual(TEXT_"Visited all entities with FPosition", visited, 111);
+
+			TestTrue(TEXT_"Destroy entity", storage.Destroy(moving[0]));
+			TestFalse(TEXT_"Destroyed entity is not alive", storage.IsAlive(moving[0]));
+			TestNull(TEXT_"Destroyed entity has no components", storage.TryGet<FPosition>(moving[0]));
+			TestEqual(TEXT_"Swapped entity keeps its components", storage.TryGet<FVelocity>(moving[99])->Value, 99.f);
+		});
+
+		It(TEXT_"should copy components from composables.", [this]
+		{
+			FArchetypeStorage storage;
+			auto composable = FComposableOther().With<FSimpleComponent>().With<FPooledComponent>();
+			auto entity = storage.CreateFrom<FSimpleComponent, FPooledComponent>(composable);
+			TestEqual(TEXT_"Copied component", storage.TryGet<FSimpleComponent>(entity)->D, 3);
+			TestNull(TEXT_"Missing component", storage.TryGet<FPosition>(entity));
+		});
+	});
+
+	Describe(TEXT_"TStaticComposable", [this]
+	{
+		It(TEXT_"should resolve components at compile time.", [this]
+		{
+			using FStatic = TStaticComposable<FSimpleComponent, FAutoComponentA, FComponentB>;
+			static_assert(FStatic::Has<FSimpleComponent>);
+			static_assert(FStatic::Has<IAnotherInterface>);
+			static_assert(FStatic::IndexOf<IComponentInterface> == 1);
+			static_assert(FStatic::Count<IComponentInterface> == 1);
+			static_assert(!FStatic::Has<FComponentBase>, "FComponentB doesn't declare its bases explicitly");
+			static_assert(!FStatic::Has<FVector>);
+
+			FStatic payload;
+			TestEqual(TEXT_"Exact component", payload.Get<FSimpleComponent>().D, 3);
+			TestEqual(TEXT_"Aliased component",
+				static_cast<const void*>(&payload.Get<IComponentInterface>()),
+				static_cast<const void*>(static_cast<IComponentInterface*>(&payload.Get<FAutoComponentA>()))
+			);
+			TestNull(TEXT_"Missing component", payload.TryGet<FVector>());
+			TestEqual(TEXT_"Dynamic fallback",
+				payload.TryGetDynamic(TTypeHash<IAnotherInterface>),
+				static_cast<const void*>(payload.TryGet<IAnotherInterface>())
+			);
+
+			IComposable dynamic = payload.ToDynamic();
+			TestEqual(TEXT_"Dynamic copy", dynamic.Get<FComponentB>().C, 3);
+			TestNotNull(TEXT_"Dynamic copy keeps aliases", dynamic.TryGet<IAnotherInterface>());
+		});
+
+		It(TEXT_"should notify explicit components.", [this]
+		{
+			TStaticComposable<FStaticAwareComponent> payload;
+			TestEqual(TEXT_"OnCreatedAt", payload.Get<FStaticAwareComponent>().Created, 1);
+			auto copy = payload;
+			TestEqual(TEXT_"OnCopiedAt", copy.Get<FStaticAwareComponent>().Copied, 1);
+			TStaticComposable<FStaticAwareComponent> assigned;
+			assigned = copy;
+			TestEqual(TEXT_"OnCopiedAt on assignment", assigned.Get<FStaticAwareComponent>().Copied, 2);
+		});
 	});
 }
@@ -0,0 +1,97 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Mcro/Common.h"
+
+using namespace Mcro::Common;
+
+namespace CoroutinesTest
+{
+	TCoTask<int32> Add(int32 a, int32 b)
+	{
+		co_return a + b;
+	}
+
+	TCoTask<int32> AddTwice(int32 a, int32 b)
+	{
+		int32 first = co_await Add(a, b);
+		int32 second = co_await Add(first, b);
+		co_return second;
+	}
+
+	TCoTask<FString> AwaitFuture(TFuture<FString> future, int32& stage)
+	{
+		stage = 1;
+		FString value = co_await MoveTemp(future);
+		stage = 2;
+		co_return value;
+	}
+
+	TCoTask<> StayOnGameThread(bool& suspended)
+	{
+		co_await ResumeOn(ENamedThreads::GameThread);
+		suspended = !IsInGameThread();
+	}
+}
+
+DEFINE_SPEC(
+	FMcroCoroutines_Spec,
+	TEXT_"Mcro.Coroutines",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroCoroutines_Spec::Define()
+{
+	using namespace CoroutinesTest;
+
+	Describe(TEXT_"TCoTask", [this]
+	{
+		It(TEXT_"should complete synchronous coroutines eagerly", [this]
+		{
+			TCoTask<int32> task = AddTwice(1, 2);
+			TestTrue(TEXT_"Task is done", task.IsDone());
+		});
+
+		It(TEXT_"should resume when an awaited future is fulfilled", [this]
+		{
+			int32 stage = 0;
+			TPromise<FString> promise;
+			TCoTask<FString> task = AwaitFuture(promise.GetFuture(), stage);
+			TestEqual(TEXT_"Suspended at the future", stage, 1);
+			TestFalse(TEXT_"Task is not done yet", task.IsDone());
+
+			promise.SetValue(TEXT_"Hello");
+			TestEqual(TEXT_"Resumed after the future", stage, 2);
+			TestTrue(TEXT_"Task is done", task.IsDone());
+		});
+
+		It(TEXT_"should keep running after the task object is discarded", [this]
+		{
+			int32 stage = 0;
+			TPromise<FString> promise;
+			AwaitFuture(promise.GetFuture(), stage);
+			promise.SetValue(TEXT_"Hello");
+			TestEqual(TEXT_"Detached coroutine finished", stage, 2);
+		});
+
+		It(TEXT_"should not suspend when resuming on the current thread", [this]
+		{
+			bool suspended = true;
+			TCoTask<> task = StayOnGameThread(suspended);
+			TestTrue(TEXT_"Task is done", task.IsDone());
+			TestFalse(TEXT_"Didn't hop threads", suspended);
+		});
+	});
+}
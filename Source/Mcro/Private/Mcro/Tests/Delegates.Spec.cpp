@@ -229,6 +229,36 @@ void FMcroDelegates_Spec::Define()
 			delegate.Execute();
 			TestDelegateResultArray(object->TestResult, { .ExpectedValue = TEXT_"From UFunction" });
 		});
+		It(TEXT_"should invoke pre-resolved UFunctions of dynamic delegates", [this]
+		{
+			TScopeObject<UDynamicDelegateTestClass> object({});
+			object->DynamicDelegateRetVal.BindUFunction(&object.Get(), TEXT_"ScaleArgument");
+			auto delegate = AsFastNative(object->DynamicDelegateRetVal);
+			TestTrue(TEXT_"Is bound", delegate.IsBound());
+			TestEqual(TEXT_"Result", delegate.Execute(21), 42);
+		});
+	});
+	Describe(TEXT_"TInlineFunction", [this]
+	{
+		It(TEXT_"should invoke small capturing lambdas", [this]
+		{
+			int32 total = 0;
+			int32 scale = 3;
+			TInlineFunction<int32(int32)> function = [&total, scale](int32 value) { total += value * scale; return total; };
+			TestEqual(TEXT_"Result", function(2), 6);
+			TestEqual(TEXT_"Captured reference", total, 6);
+		});
+		It(TEXT_"should move its functor", [this]
+		{
+			auto shared = MakeShared<int32>(5);
+			TInlineFunction<int32()> function = [shared] { return *shared; };
+			TInlineFunction<int32()> moved = MoveTemp(function);
+			TestFalse(TEXT_"Moved from is unset", function.IsSet());
+			TestEqual(TEXT_"Moved functor", moved(), 5);
+			TestEqual(TEXT_"Captures are not copied", shared.GetSharedReferenceCount(), 2);
+			moved.Reset();
+			TestEqual(TEXT_"Captures are destroyed", shared.GetSharedReferenceCount(), 1);
+		});
 	});
 }
 
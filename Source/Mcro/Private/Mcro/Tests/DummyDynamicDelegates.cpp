@@ -43,3 +43,8 @@ void UDynamicDelegateTestClass::DynamicDelegateBinding()
 {
 	TestResult.Add(TEXT_"From UFunction");
 }
+
+int32 UDynamicDelegateTestClass::ScaleArgument(int32 argument)
+{
+	return argument * 2;
+}
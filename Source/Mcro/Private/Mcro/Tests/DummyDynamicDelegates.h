@@ -49,4 +49,7 @@ public:
 
 	UFUNCTION()
 	void DynamicDelegateBinding();
+
+	UFUNCTION()
+	int32 ScaleArgument(int32 argument);
 };
@@ -12,6 +12,10 @@
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
 #include "Algo/Count.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
 #include "Mcro/Common.h"
 
 using namespace Mcro::Common::With::Literals;
@@ -116,6 +120,266 @@ void FMcroError_Spec::Define()
 			TestEqual(TEXT_"Error Code context", error->GetCodeContext(), STRING_"D = A + B + C");
 			ERROR_LOG(LogTemp, Display, error);
 		});
+
+		It(TEXT_"should find inner errors by their unique name", [this]
+		{
+			auto error = IError::Make(new FTestSimpleError())
+				->WithAppendix(TEXT_"Note", TEXT_"First")
+				->WithAppendix(TEXT_"Note", TEXT_"Second");
+
+			TestEqual(TEXT_"Inner error count", error->GetInnerErrorCount(), 2);
+			auto first = error->FindInnerError(TEXT_"Appendix Note");
+			auto second = error->FindInnerError(TEXT_"Appendix Note 1");
+			TestTrue(TEXT_"First appendix found", first.IsValid());
+			TestTrue(TEXT_"Second appendix found", second.IsValid());
+			if (first && second)
+			{
+				TestEqual(TEXT_"First appendix text", first->GetMessage(), TEXT_"First");
+				TestEqual(TEXT_"Second appendix text", second->GetMessage(), TEXT_"Second");
+			}
+			TestFalse(TEXT_"Missing appendix", error->FindInnerError(TEXT_"Appendix Other").IsValid());
+			TestFalse(TEXT_"Names are case sensitive", error->FindInnerError(TEXT_"appendix note").IsValid());
+		});
+		It(TEXT_"should leave a trace in the flight recorder", [this]
+		{
+			using namespace Mcro::FlightRecorder;
+			if (!IsFlightRecorderEnabled()) return;
+
+			IError::Make(new FTestSimpleError())->WithCodeContext(TEXT_"FlightRecorderTest")->Report();
+			TArray<FFlightRecord> records = GetFlightRecords();
+			const bool made = records.ContainsByPredicate([](FFlightRecord const& record)
+			{
+				return record.Kind == ERecordKind::ErrorMade && record.TypeHash == TTypeHash<FTestSimpleError>;
+			});
+			const bool reported = records.ContainsByPredicate([](FFlightRecord const& record)
+			{
+				return record.Kind == ERecordKind::ErrorReported
+					&& record.ContextHash == GetTypeHash(FString(TEXT_"FlightRecorderTest"));
+			});
+			TestTrue(TEXT_"Error creation recorded", made);
+			TestTrue(TEXT_"Error report recorded", reported);
+		});
+		It(TEXT_"should format texts when they're accessed", [this]
+		{
+			FString dynamicFormat = TEXT_"Dynamic {0}";
+			FString argument = TEXT_"argument";
+			auto error = IError::Make(new FTestSimpleError())
+				->WithMessageF(TEXT_"Deferred {0} {1}", argument, 42)
+				->WithDetailsF(*dynamicFormat, 1);
+			
+			argument = TEXT_"modified";
+			TestEqual(TEXT_"Deferred message", error->GetMessage(), STRING_"Deferred argument 42");
+			TestEqual(TEXT_"Eager details", error->GetDetails(), STRING_"Dynamic 1");
+
+			error->WithMessage(TEXT_"Overridden");
+			TestEqual(TEXT_"Overridden message", error->GetMessage(), STRING_"Overridden");
+		});
+
+		It(TEXT_"should fail with lightweight error codes", [this]
+		{
+			auto parse = [](int32 input) -> TMaybe<int32>
+			{
+				if (input < 0) return FErrorCode { 7, TEXT_"Input was negative" };
+				return input * 2;
+			};
+			
+			auto failed = parse(-1);
+			TestFalse(TEXT_"Failed result", failed.HasValue());
+			TestTrue(TEXT_"Error code is not promoted yet", failed.HasErrorCode());
+			TestEqual(TEXT_"Error code", failed.TryGetErrorCode()->Code, 7);
+
+			TMaybe<int64> converted = failed;
+			TestTrue(TEXT_"Error code is preserved through conversion", converted.HasErrorCode());
+
+			TMaybe<int64> const& shared = converted;
+			TestEqual(TEXT_"Const promotion", shared.GetErrorRef()->GetMessage(), STRING_"Input was negative");
+			TestTrue(TEXT_"Const promotion doesn't modify", shared.HasErrorCode());
+			
+			IErrorRef promoted = failed.GetErrorRef();
+			TestEqual(TEXT_"Promoted message", promoted->GetMessage(), STRING_"Input was negative");
+			TestFalse(TEXT_"Error code is promoted in place", failed.HasErrorCode());
+			TestTrue(TEXT_"Promoted error is cached", failed.GetErrorRef() == promoted);
+
+			TestEqual(TEXT_"Successful result", parse(2).GetValue(), 4);
+		});
+
+		It(TEXT_"should chain fallible steps without copying values", [this]
+		{
+			struct FCopyCounted
+			{
+				FCopyCounted(int32 value, int32& copies) : Value(value), Copies(&copies) {}
+				FCopyCounted(FCopyCounted const& other) : Value(other.Value), Copies(other.Copies) { ++*Copies; }
+				FCopyCounted(FCopyCounted&&) = default;
+				
+				int32 Value;
+				int32* Copies;
+			};
+
+			int32 copies = 0;
+			auto load = [&](int32 input) -> TMaybe<FCopyCounted>
+			{
+				if (input < 0) return FErrorCode { 3, TEXT_"Input was negative" };
+				return FCopyCounted(input, copies);
+			};
+			auto step = [](FCopyCounted&& value) -> TMaybe<FCopyCounted>
+			{
+				value.Value *= 2;
+				return MoveTemp(value);
+			};
+
+			auto result = load(2)
+				.AndThen(step)
+				.Map([](FCopyCounted&& value) { value.Value += 1; return MoveTemp(value); })
+				.AndThen(step);
+			
+			TestEqual(TEXT_"Result", result.GetValue().Value, 10);
+			TestEqual(TEXT_"Value was never copied", copies, 0);
+
+			auto failed = load(-1).AndThen(step).Map([](FCopyCounted&& value) { return value.Value; });
+			TestTrue(TEXT_"Error is propagated", failed.HasError());
+			TestTrue(TEXT_"Error code is not promoted on the way", failed.HasErrorCode());
+			TestEqual(TEXT_"Fallback value", MoveTemp(failed).ValueOr(-1), -1);
+
+			auto recovered = load(-1).OrElse([&](IErrorRef const&) -> TMaybe<FCopyCounted>
+			{
+				return FCopyCounted(42, copies);
+			});
+			TestEqual(TEXT_"Recovered", recovered.GetValue().Value, 42);
+			TestEqual(TEXT_"Value is passed through OrElse", load(1).OrElse([&](IErrorRef const&) -> TMaybe<FCopyCounted>
+			{
+				return FCopyCounted(0, copies);
+			}).GetValue().Value, 1);
+
+			int32 sideEffect = 0;
+			FCanFail done = Success().AndThen([&] { sideEffect = 1; return Success(); }).Map([&] { ++sideEffect; });
+			TestTrue(TEXT_"FCanFail steps take no arguments", done.HasValue());
+			TestEqual(TEXT_"Both steps ran", sideEffect, 2);
+			TestEqual(TEXT_"Still no copies", copies, 0);
+		});
+
+		It(TEXT_"should write errors into a journal", [this]
+		{
+			FString directory = FPaths::AutomationTransientDir() / TEXT_"McroErrorJournal";
+			FString path;
+			{
+				FErrorJournal journal({
+					.Directory = directory,
+					.MaxQueuedErrors = 2,
+					.DropPolicy = EErrorJournalDropPolicy::DropNewest,
+					.bListenToReportedErrors = false,
+					// Without a worker nothing is written before Flush, so the queue deterministically overflows
+					.bUseWorkerThread = false
+				});
+				path = journal.GetCurrentFilePath();
+				for (int i = 0; i < 3; ++i)
+					journal.Submit(IError::Make(new FTestSimpleError())->WithMessage(TEXT_"Journaled error"));
+				journal.Flush();
+				TestTrue(TEXT_"Errors are dropped when the queue is full", journal.GetDroppedCount() == 1);
+			}
+
+			FString content;
+			TestTrue(TEXT_"Journal file exists", FFileHelper::LoadFileToString(content, *path));
+			TestTrue(TEXT_"Journal contains the error", content.Contains(TEXT_"Journaled error"));
+			IFileManager::Get().DeleteDirectory(*directory, false, true);
+		});
+
+		It(TEXT_"should stream YAML into archives", [this]
+		{
+			auto error = CommonTestError();
+			auto writeErrors = [&](YAML::Emitter& emitter)
+			{
+				// Larger than a single chunk of the streaming emitter
+				FSeq errors(emitter);
+				for (int i = 0; i < 20; ++i) emitter << error;
+			};
+
+			YAML::Emitter buffered;
+			writeErrors(buffered);
+
+			TArray<uint8> streamed;
+			FMemoryWriter writer(streamed);
+			{
+				FStreamingEmitter emitter(writer);
+				writeErrors(emitter);
+			}
+
+			TestTrue(TEXT_"Streamed in multiple chunks", streamed.Num() > FOutputStreamBuffer::ChunkSize);
+			TestEqual(TEXT_"Same size", static_cast<size_t>(streamed.Num()), buffered.size());
+			TestTrue(TEXT_"Same content", FMemory::Memcmp(streamed.GetData(), buffered.c_str(), buffered.size()) == 0);
+		});
+
+		It(TEXT_"should serialize through pooled emitters", [this]
+		{
+			auto error = CommonTestError();
+			YAML::Emitter plain;
+			error->SerializeYamlDocument(plain);
+
+			TestEqual(TEXT_"Same as a fresh emitter", error->ToStringUtf8(), std::string(plain.c_str()));
+			TestEqual(TEXT_"Repeated", error->ToString(), FString(UTF8_TO_TCHAR(plain.c_str())));
+
+			FPooledEmitter outer;
+			*outer << YAML::BeginSeq << "outer";
+			TestEqual(TEXT_"Nested use gets a separate emitter", error->ToStringUtf8(), std::string(plain.c_str()));
+			*outer << YAML::EndSeq;
+			TestEqual(TEXT_"Outer document", outer.ToStringUtf8(), std::string("- outer"));
+		});
+
+		It(TEXT_"should round-trip through the binary encoding", [this]
+		{
+			auto error = CommonTestError();
+			TArray<uint8> encoded = Binary::Encode(error);
+			auto decoded = Binary::DecodeToYaml(encoded);
+			
+			TestTrue(TEXT_"Decoding succeeded", decoded.HasValue());
+			TestEqual(TEXT_"Decoded YAML", decoded.GetValue(), error->ToString());
+
+			encoded.SetNum(encoded.Num() / 2);
+			TestTrue(TEXT_"Truncated input is rejected", Binary::DecodeToYaml(encoded).HasError());
+
+			// Length of the type string, right after the magic, the version and the flags
+			TArray<uint8> corrupted = Binary::Encode(error);
+			const int32 hugeLength = 1 << 30;
+			FMemory::Memcpy(corrupted.GetData() + 7, &hugeLength, sizeof(hugeLength));
+			TestTrue(TEXT_"Huge lengths are rejected", Binary::DecodeToYaml(corrupted).HasError());
+		});
+
+		It(TEXT_"should count errors by their signature", [this]
+		{
+			auto validate = [](int32 input) -> FCanFail
+			{
+				ASSERT_RETURN(input > 0)->WithMessage(TEXT_"Input must be positive");
+				ASSERT_RETURN(input < 100)->WithMessage(TEXT_"Input must be less than 100");
+				return Success();
+			};
+
+			uint64 signature = validate(-1).GetErrorRef()->GetSignature();
+			TestEqual(TEXT_"Same site has the same signature", validate(-2).GetErrorRef()->GetSignature(), signature);
+			TestNotEqual(TEXT_"Different sites have different signatures", validate(200).GetErrorRef()->GetSignature(), signature);
+
+			auto& frequency = FErrorFrequency::Get();
+			uint32 before = frequency.GetCount(signature);
+			for (int i = 0; i < 3; ++i)
+				frequency.Record(validate(-1).GetErrorRef().Get());
+			
+			TestEqual(TEXT_"Occurrences are counted", frequency.GetCount(signature), before + 3);
+			TestTrue(TEXT_"Signature is exported", frequency.Export().ContainsByPredicate([&](FErrorFrequencyEntry const& entry)
+			{
+				return entry.Signature == signature;
+			}));
+		});
+
+		It(TEXT_"should symbolicate C++ stack traces lazily", [this]
+		{
+			auto stackTrace = IError::Make(new FCppStackTrace());
+			TestTrue(TEXT_"Program counters are captured", stackTrace->GetProgramCounters().Num() > 0);
+			TestFalse(TEXT_"Stack trace is symbolicated on access", stackTrace->GetMessage().IsEmpty());
+		});
+
+		It(TEXT_"should describe Blueprint stack traces on access", [this]
+		{
+			auto stackTrace = IError::Make(new FBlueprintStackTrace());
+			TestFalse(TEXT_"Stack trace is described on access", stackTrace->GetMessage().IsEmpty());
+		});
 	});
 }
 
@@ -183,6 +447,24 @@ void FMcroErrorUI_Spec::Define()
 				}
 			);
 		});
+
+		LatentIt(TEXT_"should display errors with many inner errors", 1_Hour, [this](FDoneDelegate const& done)
+		{
+			auto error = CommonTestError()->WithLocation();
+			for (int i = 0; i < 500; ++i)
+				error->WithError(TEXT_"Asset {0}" _FMT(i), CommonTestInnerError());
+			
+			FErrorManager::Get().DisplayError(
+				error,
+				{.bImportantToRead = true, .bBreakDebugger = false, .bLogError = false}
+			).Next(
+				[this, done](FErrorManager::EDisplayErrorResult result)
+				{
+					TestEqual(TEXT_"Display result", result, FErrorManager::Displayed);
+					(void) done.ExecuteIfBound();
+				}
+			);
+		});
 	});
 
 	xDescribe(TEXT_"Assertions", [this]
@@ -25,6 +25,18 @@ DEFINE_SPEC(
 	| EAutomationTestFlags::ProductFilter
 );
 
+namespace
+{
+	struct FInlineEventListener
+	{
+		int32 Sum = 0;
+		void OnEvent(int32 value) { Sum += value; }
+	};
+
+	int32 GStaticEventSum = 0;
+	void AddToStaticEventSum(int32 value) { GStaticEventSum += value; }
+}
+
 void FMcroEventDelegate_Spec::Define()
 {
 	Describe(TEXT_"TEventDelegate", [this]
@@ -87,6 +99,120 @@ void FMcroEventDelegate_Spec::Define()
 			TestEqual(TEXT_"Has 1 entry from only-once binding", Algo::Count(result, STRING_"Called once"), 1UL);
 		});
 		
+		It(TEXT_"should broadcast snapshots of bindings with LockFreeBroadcast", [this]
+		{
+			int32 called = 0;
+			int32 calledOnce = 0;
+			TLockFreeEventDelegate<void(int32)> event;
+			FDelegateHandle handle = event.Add(From([&](int32 value) { called += value; }));
+			event.Add(From([&](int32 value) { calledOnce += value; }), {.Once = true});
+
+			// Listeners are executed without holding the lock, so a listener can modify the event
+			event.Add(From([&](int32)
+			{
+				event.Remove(handle);
+			}), {.Once = true});
+
+			event.Broadcast(1);
+			TestEqual(TEXT_"Removed binding was still part of the broadcasted snapshot", called, 1);
+			TestEqual(TEXT_"Once binding was called", calledOnce, 1);
+
+			event.Broadcast(1);
+			TestEqual(TEXT_"Removed binding is not called anymore", called, 1);
+			TestEqual(TEXT_"Once binding is only called once", calledOnce, 1);
+			TestFalse(TEXT_"No bindings are left", event.IsBound());
+		});
+
+		It(TEXT_"should execute listeners in parallel with BroadcastAsync", [this]
+		{
+			std::atomic<int32> called = 0;
+			TLockFreeEventDelegate<void(int32)> event;
+			for (int i = 0; i < 8; ++i)
+				event.Add(From([&](int32 value) { called += value; }));
+			event.Add(From([&](int32 value) { called += value * 100; }), {.Once = true});
+			event.Add(From([](int32)
+			{
+				IError::Make(new FAssertion())->WithMessage(TEXT_"Listener failed")->Report();
+			}));
+
+			FCanFail result = BroadcastAsync(event, 1).Get();
+			TestEqual(TEXT_"All listeners were executed", called.load(), 108);
+			TestTrue(TEXT_"Reported error was gathered", result.HasError());
+			if (result.HasError())
+				TestEqual(TEXT_"Gathered error contains the reported one", result.GetError()->GetInnerErrorCount(), 1);
+
+			called = 0;
+			BroadcastAsync(event, 1).Wait();
+			TestEqual(TEXT_"Once binding was removed", called.load(), 8);
+		});
+
+		It(TEXT_"should broadcast enqueued arguments in a batch on Flush", [this]
+		{
+			TArray<int32> received;
+			int32 batches = 0;
+			int32 batchSize = 0;
+			TEventDelegate<void(int32), {.Queued = true}> event;
+			event.Add(From([&](int32 value) { received.Add(value); }));
+			event.AddBatch(From([&](TArrayView<const TTuple<int32>> batch)
+			{
+				++batches;
+				batchSize += batch.Num();
+			}));
+
+			event.Enqueue(1);
+			event.EnqueueUnique(10, 2);
+			event.Enqueue(3);
+			event.EnqueueUnique(10, 4);
+			TestTrue(TEXT_"Nothing is broadcasted before Flush", received.IsEmpty());
+
+			TestEqual(TEXT_"Flushed broadcasts", event.Flush(), 3);
+			TestTrue(TEXT_"Deduplicated entry was replaced in place", received == TArray<int32>{1, 4, 3});
+			TestEqual(TEXT_"Batch listener was called once", batches, 1);
+			TestEqual(TEXT_"Batch listener received every entry", batchSize, 3);
+			TestEqual(TEXT_"Queue is empty after Flush", event.Flush(), 0);
+		});
+
+		It(TEXT_"should broadcast TInlineEvent bindings without type erasure", [this]
+		{
+			FInlineEventListener listener;
+			TInlineEvent<void(int32), 4> event;
+			event.Add<&FInlineEventListener::OnEvent>(&listener);
+			event.Add([](int32 value) { GStaticEventSum += value; }, {.Once = true});
+
+			GStaticEventSum = 0;
+			event.Broadcast(2);
+			event.Broadcast(3);
+			TestEqual(TEXT_"Member function binding was called every time", listener.Sum, 5);
+			TestEqual(TEXT_"Once binding was only called once", GStaticEventSum, 2);
+			TestEqual(TEXT_"Once binding was removed", event.Num(), 1);
+
+			TestEqual(TEXT_"Object bindings are removed", event.RemoveAll(&listener), 1);
+			TestFalse(TEXT_"No bindings are left", event.IsBound());
+
+			GStaticEventSum = 0;
+			TStaticEvent<void(int32), &AddToStaticEventSum, &AddToStaticEventSum>::Broadcast(1);
+			TestEqual(TEXT_"Static listeners were called", GStaticEventSum, 2);
+		});
+
+		It(TEXT_"should execute TPriorityEvent bindings by priority and stop when handled", [this]
+		{
+			TArray<FString> order;
+			TPriorityEvent<bool(int32)> event;
+			event.Add(From([&](int32) { order.Add(TEXT_"Low"); return false; }), -10);
+			event.Add(From([&](int32) { order.Add(TEXT_"Default"); return false; }));
+			event.Add(From([&](int32) { order.Add(TEXT_"High"); return false; }), 10);
+			event.Add(From([&](int32 value) { order.Add(TEXT_"Handler"); return value > 0; }), 5);
+
+			TestFalse(TEXT_"Event was not handled", event.Broadcast(0));
+			TestTrue(TEXT_"Executed in order of priority",
+				order == TArray<FString>{TEXT_"High", TEXT_"Handler", TEXT_"Default", TEXT_"Low"}
+			);
+
+			order.Empty();
+			TestTrue(TEXT_"Event was handled", event.Broadcast(1));
+			TestTrue(TEXT_"Lower priority bindings were skipped", order == TArray<FString>{TEXT_"High", TEXT_"Handler"});
+		});
+
 		It(TEXT_"should only copy broadcast arguments when CopyArguments is active", [this]
 		{
 			FCopyForbidden cannotCopy;
@@ -126,8 +252,41 @@ void FMcroEventDelegate_Spec::Define()
 
 			retainingEvent.Add(From([this](FCopyConstructCounter const& payload)
 			{
-				TestGreaterThan(TEXT_"Belated invoke should get copy constructed object", payload.CopyCount, 0);
+				TestEqual(TEXT_"Belated invoke should get an object copied exactly once", payload.CopyCount, 1);
 			}), {.Belated = true});
 		});
+
+		It(TEXT_"should only cache arguments for belated bindings with LazyCache", [this]
+		{
+			int32 called = 0;
+			TEventDelegate<void(int32), {.LazyCache = true}> event;
+
+			event.Broadcast(1);
+			event.Add(From([&](int32 value) { called += value; }), {.Belated = true});
+			TestEqual(TEXT_"Nothing was cached before a belated binding existed", called, 0);
+
+			event.Broadcast(2);
+			TestEqual(TEXT_"Belated binding is called by the next broadcast", called, 2);
+
+			event.Add(From([&](int32 value) { called += value; }), {.Belated = true});
+			TestEqual(TEXT_"Second belated binding received the cached arguments", called, 4);
+		});
+
+		It(TEXT_"should sweep stale bindings in bulk during broadcasts", [this]
+		{
+			int32 called = 0;
+			TEventDelegate<void(int32), {.ThreadSafe = true, .LockFreeBroadcast = true}> event;
+			TArray<TSharedRef<int32>> owners;
+			for (int32 i = 0; i < StaleBindingCompactionThreshold; ++i)
+			{
+				auto owner = owners.Add_GetRef(MakeShared<int32>(i));
+				event.Add(From(owner, [&](int32 value) { called += value; }));
+			}
+
+			owners.Empty();
+			event.Broadcast(1);
+			TestEqual(TEXT_"Stale bindings are not executed", called, 0);
+			TestFalse(TEXT_"Stale bindings were swept after reaching the threshold", event.IsBound());
+		});
 	});
 }
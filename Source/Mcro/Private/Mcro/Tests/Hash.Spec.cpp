@@ -0,0 +1,82 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Mcro/Common.h"
+
+using namespace Mcro::Common;
+
+namespace
+{
+	template <size_t Length>
+	consteval std::array<char, Length> MakeHashInput()
+	{
+		std::array<char, Length> result {};
+		for (size_t i = 0; i < Length; ++i)
+			result[i] = static_cast<char>('!' + (i * 7) % 90);
+		return result;
+	}
+
+	template <size_t Length>
+	bool MatchesConstexprHash()
+	{
+		static constexpr std::array<char, Length> input = MakeHashInput<Length>();
+		constexpr uint64 expected = constexpr_xxh3::XXH3_64bits_const(input.data(), input.size());
+		return HashBytes(input.data(), input.size()) == expected
+			&& HashString(FAnsiStringView(input.data(), Length)) == expected;
+	}
+}
+
+DEFINE_SPEC(
+	FMcroHash_Spec,
+	TEXT_"Mcro.Hash",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroHash_Spec::Define()
+{
+	Describe(TEXT_"Runtime XXH3", [this]
+	{
+		It(TEXT_"should match the compile-time hashes for every input size class", [this]
+		{
+			// XXH3 has a separate code path for each of these size classes
+			TestTrue(TEXT_"0",    MatchesConstexprHash<0>());
+			TestTrue(TEXT_"3",    MatchesConstexprHash<3>());
+			TestTrue(TEXT_"8",    MatchesConstexprHash<8>());
+			TestTrue(TEXT_"16",   MatchesConstexprHash<16>());
+			TestTrue(TEXT_"100",  MatchesConstexprHash<100>());
+			TestTrue(TEXT_"200",  MatchesConstexprHash<200>());
+			TestTrue(TEXT_"1000", MatchesConstexprHash<1000>());
+			TestTrue(TEXT_"5000", MatchesConstexprHash<5000>());
+
+			constexpr uint64 key = HashConst("Mcro.Hash");
+			TestEqual(TEXT_"HashConst", HashString(ANSITEXTVIEW("Mcro.Hash")), key);
+		});
+		It(TEXT_"should hash ranges by the bytes of their elements", [this]
+		{
+			TArray<int32> array;
+			for (int32 i = 0; i < 1000; ++i) array.Add(i * 31);
+
+			const uint64 contiguous = HashRange(array);
+			TestEqual(TEXT_"Buffer", contiguous, HashBytes(array.GetData(), array.Num() * sizeof(int32)));
+
+			auto nonContiguous = array | ranges::views::filter([](int32) { return true; });
+			TestEqual(TEXT_"Streamed", HashRange(nonContiguous), contiguous);
+
+			FString string = TEXT_"Mcro.Hash";
+			TestEqual(TEXT_"String", HashRange(string), HashString(string));
+		});
+	});
+}
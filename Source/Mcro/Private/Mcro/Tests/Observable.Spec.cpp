@@ -12,6 +12,7 @@
 #include "CoreMinimal.h"
 #include "Misc/AutomationTest.h"
 #include "Algo/Count.h"
+#include "Async/ParallelFor.h"
 #include "Mcro/Common.h"
 
 using namespace Mcro::Common;
@@ -37,7 +38,7 @@ void FMcroObservable_Spec::Define()
 
 			auto [value, dummyLock] = state.GetOnAnyThread();
 
-			TestTrue(TEXT_"Lock is dummy type when thread safety is not enabled", dummyLock->IsType<FVoid>());
+			TestFalse(TEXT_"Lock is empty when thread safety is not enabled", dummyLock.IsLocked());
 			
 			TestEqual(TEXT_"Initial value", state.Get(), -2);
 			TestTrue(TEXT_"Reactive change", state.HasChangedFrom(1));
@@ -62,5 +63,261 @@ void FMcroObservable_Spec::Define()
 			TestEqual(TEXT_"Next value", nextCache, 2);
 			TestEqual(TEXT_"Previous value", previousCache, 1);
 		});
+
+		It(TEXT_"should be readable without locks when ReadMostly", [this]
+		{
+			TStateRM<int> small(1);
+			small = 2;
+			TestEqual(TEXT_"Seqlock copy", small.GetCopyOnAnyThread(), 2);
+
+			TStateRM<FString> large(TEXT_"first");
+			{
+				auto snapshot = large.GetSnapshotOnAnyThread();
+				large = TEXT_"second";
+				TestEqual(TEXT_"Snapshot is immutable", *snapshot, FString(TEXT_"first"));
+				TestEqual(TEXT_"Copy is current", large.GetCopyOnAnyThread(), FString(TEXT_"second"));
+			}
+			large = TEXT_"third";
+			TestEqual(TEXT_"Snapshot is current", *large.GetSnapshotOnAnyThread(), FString(TEXT_"third"));
+		});
+
+		It(TEXT_"should notify once per transaction", [this]
+		{
+			TState<int> width(0), height(0);
+			int notifications = 0, area = 0, previousWidth = -1;
+			width.OnChange([&](int next, TOptional<int> const& previous)
+			{
+				++notifications;
+				area = next * height.Get();
+				previousWidth = previous.Get(-1);
+			});
+			{
+				FStateTransaction transaction;
+				width = 10;
+				height = 20;
+				width = 30;
+				TestEqual(TEXT_"Deferred until commit", notifications, 0);
+			}
+			TestEqual(TEXT_"Merged notification", notifications, 1);
+			TestEqual(TEXT_"Listener sees every state updated", area, 600);
+			TestEqual(TEXT_"Previous is from before the transaction", previousWidth, 0);
+		});
+
+		It(TEXT_"should propagate diamond dependencies once in topological order", [this]
+		{
+			TState<int> top(0), left(0), right(0), bottom(0);
+			top.OnChange([&](int next) { left = next + 1; });
+			top.OnChange([&](int next) { right = next + 2; });
+			left.OnChange([&](int) { bottom = left.Get() + right.Get(); });
+			right.OnChange([&](int) { bottom = left.Get() + right.Get(); });
+
+			TArray<int> observed;
+			bottom.OnChange([&](int next) { observed.Add(next); });
+
+			top = 1;
+			top = 10;
+			TestEqual(TEXT_"Notified once per change", observed.Num(), 2);
+			TestEqual(TEXT_"Only consistent values observed", observed.Last(), 23);
+		});
+
+		It(TEXT_"should report element changes of container states", [this]
+		{
+			TState<TArray<int>> array;
+			TArray<TContainerDeltaEntry<int32>> arrayDelta;
+			array.OnChange(TDelegate<void(TChangeData<TArray<int>> const&)>::CreateLambda([&](auto const& change)
+			{
+				arrayDelta = change.Delta;
+			}));
+			array.Add(1);
+			array.Add(2);
+			TestEqual(TEXT_"Single insertion", arrayDelta.Num(), 1);
+			TestEqual(TEXT_"Insertion index", arrayDelta[0].Key, 1);
+			array.RemoveAt(0);
+			TestTrue(TEXT_"Removal", arrayDelta[0].Change == EContainerDelta::Removed);
+			{
+				FStateTransaction transaction;
+				array.Add(3);
+				array.SetAt(0, 4);
+			}
+			TestEqual(TEXT_"Merged in transaction", arrayDelta.Num(), 2);
+
+			TState<TMap<FName, int>> map;
+			TOptional<EContainerDelta> mapChange;
+			map.OnChange(TDelegate<void(TChangeData<TMap<FName, int>> const&)>::CreateLambda([&](auto const& change)
+			{
+				mapChange = change.HasDelta ? change.Delta[0].Change : TOptional<EContainerDelta>();
+			}));
+			map.Add(TEXT_"a", 1);
+			TestTrue(TEXT_"Map insertion", mapChange.Get(EContainerDelta::Removed) == EContainerDelta::Inserted);
+			map.Add(TEXT_"a", 2);
+			TestTrue(TEXT_"Map update", mapChange.Get(EContainerDelta::Removed) == EContainerDelta::Updated);
+			TestFalse(TEXT_"Missing key", map.RemoveKey(TEXT_"b"));
+			TestTrue(TEXT_"No-op keeps the previous value", map.GetPrevious().IsSet() && map.GetPrevious()->FindRef(TEXT_"a") == 1);
+			map.Set({});
+			TestFalse(TEXT_"Set has no delta", mapChange.IsSet());
+		});
+
+		It(TEXT_"should share unchanged copy-on-write values with the previous value", [this]
+		{
+			TState<TCow<TArray<int>>> state(TArray{1, 2, 3});
+			int notifications = 0;
+			state.OnChange([&](TCow<TArray<int>> const&) { ++notifications; });
+
+			state.Modify([](TCow<TArray<int>>&) {}, false);
+			TestEqual(TEXT_"No-op modification doesn't notify", notifications, 0);
+
+			state.Modify([](TCow<TArray<int>>& value) { value.Mutate().Add(4); }, false);
+			TestEqual(TEXT_"Mutation notifies", notifications, 1);
+			TestEqual(TEXT_"Previous is the old value", state.GetPrevious()->Get().Num(), 3);
+			TestFalse(TEXT_"Next is a separate copy", state.Get().SharesWith(state.GetPrevious().GetValue()));
+		});
+
+		It(TEXT_"should coalesce notifications until the end of the frame", [this]
+		{
+			TState<int, FStatePolicy {.NotifyOnChangeOnly = true, .StorePrevious = true, .CoalescePerFrame = true}> state(0);
+			int notifications = 0, last = -1, previous = -1;
+			state.OnChange([&](int next, TOptional<int> const& prev)
+			{
+				++notifications;
+				last = next;
+				previous = prev.Get(-1);
+			});
+			for (int i = 1; i <= 100; ++i) state = i;
+
+			TestEqual(TEXT_"Not notified before flush", notifications, 0);
+			Mcro::Observable::Detail::FlushCoalescedNotifications();
+			TestEqual(TEXT_"Notified once", notifications, 1);
+			TestEqual(TEXT_"With the latest value", last, 100);
+			TestEqual(TEXT_"Previous is from the last notification", previous, 0);
+		});
+
+		It(TEXT_"should record a bounded history", [this]
+		{
+			TState<int, StatePolicyFor<int>.With({.History = 3})> state(0);
+			for (int i = 1; i <= 5; ++i) state = i;
+
+			auto const& history = state.GetHistory();
+			TestEqual(TEXT_"Bounded", history.Num(), 3);
+			TestEqual(TEXT_"Most recent first", history[0], 5);
+			TestEqual(TEXT_"Oldest last", history[2], 3);
+			TestTrue(TEXT_"Usable as a range", (history | RenderAs<TArray>()) == TArray{5, 4, 3});
+		});
+
+		LatentIt(TEXT_"should notify listeners on their thread once per change", [this](FDoneDelegate const& done)
+		{
+			auto state = MakeShared<TStateTS<int>>(0);
+			auto notifications = MakeShared<std::atomic<int32>>(0);
+			state->OnChangeInThread(ENamedThreads::GameThread, [notifications](int) { ++*notifications; });
+			state->OnChangeInThread(ENamedThreads::GameThread, [notifications](int) { ++*notifications; });
+
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, state, notifications, done]
+			{
+				{
+					FStateTransaction wave;
+					state->Set(1);
+					state->Set(2);
+				}
+				RunInGameThread([this, state, notifications, done]
+				{
+					TestEqual(TEXT_"Both listeners notified once per change wave", notifications->load(), 2);
+					done.Execute();
+				});
+			});
+		});
+	});
+
+	Describe(TEXT_"TComputedState", [this]
+	{
+		It(TEXT_"should only recompute when read after a dependency changed", [this]
+		{
+			TState<int> width(2), height(3);
+			int evaluations = 0;
+			TComputedState<int> area([&] { ++evaluations; return width.Get() * height.Get(); });
+			TComputedState<int> doubleArea([&] { return area.Get() * 2; });
+
+			TestEqual(TEXT_"Lazy", evaluations, 0);
+			TestEqual(TEXT_"Computed", area.Get(), 6);
+			area.Get();
+			TestEqual(TEXT_"Memoized", evaluations, 1);
+
+			width = 4;
+			TestTrue(TEXT_"Dirty after dependency change", area.IsDirty());
+			TestEqual(TEXT_"Not evaluated until read", evaluations, 1);
+			TestEqual(TEXT_"Chained", doubleArea.Get(), 24);
+
+			int notified = 0;
+			doubleArea.OnChange([&](int next) { notified = next; });
+			height = 5;
+			TestEqual(TEXT_"Evaluated eagerly with listeners", notified, 40);
+		});
+	});
+
+	Describe(TEXT_"TAccumulatorState", [this]
+	{
+		It(TEXT_"should notify the reduced value of all threads only on flush", [this]
+		{
+			TAccumulatorState<int64> total({.FlushIntervalSeconds = -1.f});
+			int64 notified = 0;
+			total.GetState().OnChange([&](int64 next) { notified = next; });
+
+			ParallelFor(64, [&](int32 i) { total.Accumulate(i); });
+			TestEqual(TEXT_"Reduced on read", total.Read(), 2016ll);
+			TestEqual(TEXT_"Not notified before flush", notified, 0ll);
+
+			TestTrue(TEXT_"Flushed", total.Flush());
+			TestEqual(TEXT_"Notified on flush", notified, 2016ll);
+			TestFalse(TEXT_"Nothing to flush", total.Flush());
+
+			TAccumulatorState<int32, TMaxReducer<int32>> peak({.FlushIntervalSeconds = -1.f});
+			ParallelFor(64, [&](int32 i) { peak.Accumulate(i); });
+			peak.Flush();
+			TestEqual(TEXT_"Max reducer", peak.GetState().Get(), 63);
+		});
+	});
+
+	Describe(TEXT_"FStateReplicator", [this]
+	{
+		It(TEXT_"should only send states changed since the acknowledged version", [this]
+		{
+			TState<int32> health(100), sentArmor(50);
+			TState<FString> sentName(TEXT_"Player");
+			TState<int32> receivedHealth(0), receivedArmor(0);
+			TState<FString> receivedName;
+
+			FStateReplicator replicator;
+			replicator.Register(TEXT_"Health", health);
+			replicator.Register(TEXT_"Armor", sentArmor);
+			replicator.Register(TEXT_"Name", sentName);
+
+			FStateReplica replica;
+			replica.Register(TEXT_"Health", receivedHealth);
+			replica.Register(TEXT_"Armor", receivedArmor);
+			replica.Register(TEXT_"Name", receivedName);
+
+			uint64 version = 0;
+			TArray<uint8> full = replicator.WriteDelta(0, version);
+			auto acknowledged = replica.ApplyDelta(full);
+			TestFalse(TEXT_"Full batch applied", acknowledged.HasError());
+			TestEqual(TEXT_"Acknowledged version", acknowledged.GetValue(), version);
+			TestEqual(TEXT_"Name received", receivedName.Get(), FString(TEXT_"Player"));
+			TestFalse(TEXT_"Nothing changed since", replicator.HasChangesSince(version));
+
+			health.Set(80);
+			health.Set(75);
+			uint64 deltaVersion = 0;
+			TArray<uint8> delta = replicator.WriteDelta(version, deltaVersion);
+			TestTrue(TEXT_"Delta is smaller than the full batch", delta.Num() < full.Num());
+
+			receivedArmor.Set(0);
+			TestFalse(TEXT_"Delta applied", replica.ApplyDelta(delta).HasError());
+			TestEqual(TEXT_"Latest value received", receivedHealth.Get(), 75);
+			TestEqual(TEXT_"Unchanged state is not sent", receivedArmor.Get(), 0);
+
+			TestEqual(TEXT_"Stale full batch is ignored", replica.ApplyDelta(full).GetValue(), deltaVersion);
+			TestEqual(TEXT_"Newer value is kept", receivedHealth.Get(), 75);
+
+			FStateReplica lateReplica;
+			TestTrue(TEXT_"Delta against an unseen version is rejected", lateReplica.ApplyDelta(delta).HasError());
+		});
 	});
 }
\ No newline at end of file
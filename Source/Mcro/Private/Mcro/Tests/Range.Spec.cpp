@@ -16,6 +16,10 @@
 #include "Containers/LruCache.h"
 #include "Containers/PagedArray.h"
 #include "Containers/RingBuffer.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
 
 using namespace Mcro::Common;
 
@@ -65,6 +69,21 @@ void FMcroRange_Spec::Define()
 			for (int i = 0; i < 5; ++i)
 				TestEqual(TEXT_"Map got zipped", result[i], i + 5);
 		});
+
+		It(TEXT_"TMap from moved and prehashed entries", [this]
+		{
+			TArray<TPair<FString, FString>> pairs { {TEXT_"a", TEXT_"Alpha"}, {TEXT_"b", TEXT_"Beta"} };
+			auto moved = MoveTemp(pairs) | RenderAsMap();
+			TestEqual(TEXT_"Moved values", moved[TEXT_"b"], FString(TEXT_"Beta"));
+
+			TMap<FName, int32> hashed;
+			hashed.Add(NAME_"Existing", 0);
+			views::ints(1, 4)
+				| views::transform([](int32 i) { return MakeTuple(WithKeyHash(FName(NAME_"Key", i)), i); })
+				| OutputToMap(hashed);
+			TestEqual(TEXT_"Kept existing", hashed.Num(), 4);
+			TestEqual(TEXT_"Found by regular hash", hashed.FindRef(FName(NAME_"Key", 2)), 2);
+		});
 	});
 
 	Describe(TEXT_"Serialize ranges to string", [this]
@@ -115,6 +134,205 @@ void FMcroRange_Spec::Define()
 				TEXT_"(PF_R8G8, Ech), (PF_DXT1, OK), (PF_DXT3, Nice), (PF_DXT5, Great)"
 			);
 		});
+		It(TEXT_"should stream into existing string builders and archives", [this]
+		{
+			TArray payload { NAME_"Foo", NAME_"Bar", NAME_"Asd" };
+			TStringBuilder<16> builder;
+			builder << TEXT_"names: ";
+			payload | Separator(TEXT_"; ") | RenderStringTo(builder);
+			TestEqualSensitive(TEXT_"Appended to builder", builder.ToString(), TEXT_"names: [Foo; Bar; Asd]");
+
+			TArray<int32> numbers { 1, 20, 300 };
+			TestEqualSensitive(TEXT_"Numbers", numbers | RenderAsString(), TEXT_"[1, 20, 300]");
+
+			TArray<TArray<int32>> nested { {1, 2}, {}, {3} };
+			TestEqualSensitive(TEXT_"Nested ranges", nested | RenderAsString(), TEXT_"[[1, 2], , [3]]");
+
+			TArray<uint8> bytes;
+			FMemoryWriter writer(bytes);
+			RenderStringTo(payload | NoEnclosure(), writer);
+			auto decoded = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(bytes.GetData()), bytes.Num());
+			TestEqualSensitive(
+				TEXT_"Written to archive as UTF-8",
+				FString::ConstructFromPtrSize(decoded.Get(), decoded.Length()),
+				TEXT_"Foo, Bar, Asd"
+			);
+		});
+	});
+
+	Describe(TEXT_"Conversion to containers", [this]
+	{
+		It(TEXT_"should reserve sized ranges", [this]
+		{
+			TArray<int32> input {0, 1, 2, 3, 4};
+			auto result = input
+				| views::transform([](int32 i) { return i * 2; })
+				| RenderAs<TArray>();
+			
+			TestEqual(TEXT_"Result", result, TArray {0, 2, 4, 6, 8});
+			TestTrue(TEXT_"Result is reserved up-front", result.Max() >= 5);
+		});
+
+		It(TEXT_"should move r-value containers", [this]
+		{
+			TArray<FString> input {TEXT_"foo", TEXT_"bar"};
+			const TCHAR* data = input[0].GetCharArray().GetData();
+			auto result = MoveTemp(input) | RenderAs<TSet>();
+			
+			TestEqual(TEXT_"Elements are moved", result.Array()[0].GetCharArray().GetData(), data);
+		});
+
+		It(TEXT_"should reuse the capacity of existing storage", [this]
+		{
+			TArray<int32> storage;
+			storage.Reserve(64);
+			const int32* data = storage.GetData();
+			for (int32 frame = 0; frame < 3; ++frame)
+			{
+				views::ints(0, 10 + frame) | OutputTo(storage, EOutputMode::Reuse);
+				TestEqual(TEXT_"Storage has only the latest items", storage.Num(), 10 + frame);
+			}
+			TestEqual(TEXT_"Storage is not reallocated", storage.GetData(), data);
+		});
+	});
+
+	Describe(TEXT_"Contiguous algorithms", [this]
+	{
+		It(TEXT_"should detect contiguous ranges", [this]
+		{
+			static_assert(CContiguousRange<TArray<int32>>);
+			static_assert(CContiguousRange<TArrayView<const int32>>);
+			static_assert(CContiguousRange<TStaticArray<int32, 4>>);
+			static_assert(CContiguousRange<TResourceArray<int32>>);
+			static_assert(CContiguousRange<FString>);
+			static_assert(!CContiguousRange<TSet<int32>>);
+			static_assert(!CContiguousRange<TBitArray<>>);
+			TestTrue(TEXT_"Compiles", true);
+		});
+		
+		It(TEXT_"should reduce contiguous and other ranges the same way", [this]
+		{
+			TArray<int32> array {1, 2, 3, 4, 5, 6};
+			TSet<int32> set {1, 2, 3, 4, 5, 6};
+			auto plus = [](int32 a, int32 b) { return a + b; };
+			auto isEven = [](int32 i) { return i % 2 == 0; };
+			auto square = [](int32 i) { return i * i; };
+			
+			TestEqual(TEXT_"Reduce", array | Reduce(0, plus), set | Reduce(0, plus));
+			TestEqual(TEXT_"TransformReduce", array | TransformReduce(0, plus, square), 91);
+			TestEqual(TEXT_"FilterReduce", array | FilterReduce(0, plus, isEven), set | FilterReduce(0, plus, isEven));
+			TestEqual(TEXT_"CountIf", array | CountIf(isEven), 3ll);
+
+			TArray<int32> output;
+			array | TransformTo(output, square);
+			TestEqual(TEXT_"TransformTo", output, TArray {1, 4, 9, 16, 25, 36});
+		});
+	});
+
+	Describe(TEXT_"Slices of contiguous ranges", [this]
+	{
+		It(TEXT_"should chunk without copying", [this]
+		{
+			TArray<int32> array {0, 1, 2, 3, 4, 5, 6};
+			auto chunks = array | Chunk(3) | RenderAs<TArray>();
+			
+			TestEqual(TEXT_"Number of chunks", chunks.Num(), 3);
+			TestEqual(TEXT_"Last chunk is smaller", chunks.Last().Num(), 1);
+			TestEqual(TEXT_"Chunks refer to the input", chunks[1].GetData(), array.GetData() + 3);
+		});
+
+		It(TEXT_"should batch evenly", [this]
+		{
+			TArray<int32> array {0, 1, 2, 3, 4, 5, 6};
+			TestTrue(TEXT_"Batch sizes",
+				array
+					| Batch(3)
+					| views::transform([](TArrayView<int32> batch) { return batch.Num(); })
+					| MatchOrdered({2, 2, 3})
+			);
+		});
+
+		It(TEXT_"should process chunks in parallel", [this]
+		{
+			TArray<int32> array;
+			array.SetNumZeroed(1000);
+			array | ParallelChunks(64, [](TArrayView<int32> chunk, int32 index)
+			{
+				for (int32& item : chunk) item = index;
+			});
+			TestEqual(TEXT_"Last chunk", array.Last(), 15);
+			TestEqual(TEXT_"First chunk", array[63], 0);
+		});
+	});
+
+	Describe(TEXT_"Contiguous comparisons", [this]
+	{
+		It(TEXT_"should match the scalar reference", [this]
+		{
+			static_assert(Detail::CBitwiseComparableRanges<TArray<uint8>&, TArray<uint8>&>);
+			static_assert(!Detail::CBitwiseComparableRanges<TArray<float>&, TArray<float>&>);
+
+			FString text = TEXT_"GET /index.html HTTP/1.1";
+			TestTrue(TEXT_"Prefix", MatchOrdered(text, FStringView(TEXT_"GET /"), true));
+			TestFalse(TEXT_"Prefix mismatch", MatchOrdered(text, FStringView(TEXT_"POST"), true));
+			TestFalse(TEXT_"Different lengths", MatchOrdered(text, FStringView(TEXT_"GET /")));
+			TestTrue(TEXT_"Empty prefix", MatchOrdered(text, FStringView(), true));
+
+			TArray<uint8> packet;
+			for (int32 i = 0; i < 300; ++i) packet.Add(static_cast<uint8>(i % 200));
+			TArray<uint8> other = packet;
+			for (int32 position : {0, 63, 64, 150, 299})
+			{
+				other[position] ^= 1;
+				TestEqual(
+					TEXT_"Same as scalar",
+					MatchOrdered(packet, other),
+					Detail::MatchOrderedScalar(packet, other, false)
+				);
+				other[position] ^= 1;
+			}
+			TestTrue(TEXT_"Equal", MatchOrdered(packet, other));
+
+			auto isSmall = [](uint8 i) { return i < 199; };
+			TestFalse(TEXT_"AllOf", packet | AllOf(isSmall));
+			TestEqual(TEXT_"AllOf as scalar", AllOf(packet, isSmall), ranges::all_of(packet, isSmall));
+			TestTrue(TEXT_"AllOf in tail", AllOf(TArrayView<uint8>(packet.GetData(), 199), isSmall));
+			TestTrue(TEXT_"AnyOf", packet | AnyOf([](uint8 i) { return i == 199; }));
+			TestFalse(TEXT_"AnyOf none", packet | AnyOf([](uint8 i) { return i == 255; }));
+			TestTrue(TEXT_"AnyOf in tail", AnyOf(TArrayView<uint8>(packet.GetData(), 70), [](uint8 i) { return i == 66; }));
+		});
+	});
+
+	Describe(TEXT_"Temporary strings", [this]
+	{
+		It(TEXT_"should be owned inline by the view", [this]
+		{
+			static_assert(ranges::view_<FOwningStringView>);
+			static_assert(CContiguousRange<FOwningStringView>);
+
+			auto view = AsOwningView(FString(TEXT_"hello"));
+			const TCHAR* data = view.GetData();
+			auto moved = MoveTemp(view);
+			TestEqual(TEXT_"Moving keeps the storage", moved.GetData(), data);
+
+			auto upper = AsOwningView(FString(TEXT_"hello"))
+				| views::transform([](TCHAR c) { return FChar::ToUpper(c); })
+				| RenderAsString();
+			TestEqualSensitive(TEXT_"Pipeline over temporary", upper, TEXT_"HELLO");
+			TestEqual(TEXT_"Empty string", ranges::distance(AsOwningView(FString())), 0ll);
+		});
+	});
+
+	Describe(TEXT_"Concatenation", [this]
+	{
+		It(TEXT_"should iterate each range with its own loop", [this]
+		{
+			TArray<int32> array {1, 2};
+			TSet<int32> set {3};
+			TArray<int32> result;
+			ForEachConcat([&](int32 item) { result.Add(item); }, array, set, views::ints(4, 6));
+			TestEqual(TEXT_"Concatenated", result, TArray {1, 2, 3, 4, 5});
+		});
 	});
 
 	Describe(TEXT_"Functional deconstruction of tuples", [this]
@@ -139,6 +357,162 @@ void FMcroRange_Spec::Define()
 					| MatchOrdered({NAME_"Ech", NAME_"OK", NAME_"Nice", NAME_"Great"})
 			);
 		});
+		It(TEXT_"should filter properly", [this]
+		{
+			TMap<int32, int32> map { {0, 10}, {1, 11}, {2, 12}, {3, 13} };
+			TestTrue(
+				TEXT_"Filtered",
+				map
+					| FilterTuple([](int32 key, int32 value) { return key % 2 == 0; })
+					| GetValues()
+					| MatchOrdered({10, 12})
+			);
+		});
+	});
+
+	Describe(TEXT_"Structure of arrays", [this]
+	{
+		It(TEXT_"should store fields in separate aligned arrays", [this]
+		{
+			TSoAArray<int32, float, FName> soa;
+			soa.Add(0, 0.5f, NAME_"Zero");
+			soa.Add(1, 1.5f, NAME_"One");
+			soa.Add(2, 2.5f, NAME_"Two");
+
+			TestEqual(TEXT_"Num", soa.Num(), 3);
+			TestTrue(TEXT_"Ints", soa.Field<int32>() | MatchOrdered({0, 1, 2}));
+			TestTrue(TEXT_"Floats", soa.Field<1>() | MatchOrdered({0.5f, 1.5f, 2.5f}));
+			TestEqual(TEXT_"Aligned", reinterpret_cast<UPTRINT>(soa.Field<1>().GetData()) % PLATFORM_CACHE_LINE_SIZE, 0ull);
+			TestEqual(TEXT_"Element", soa[1].Get<2>(), NAME_"One");
+
+			soa.RemoveAtSwap(0);
+			TestTrue(TEXT_"Swapped", soa.Field<FName>() | MatchOrdered({NAME_"Two", NAME_"One"}));
+		});
+		It(TEXT_"should iterate with tuple views", [this]
+		{
+			TSoAArray<int32, float> soa;
+			for (int32 i = 0; i < 4; ++i)
+				soa.Add(i, i * 10.f);
+
+			soa.ForEach([](int32 index, float& value) { value += index; });
+			TestTrue(TEXT_"Modified in place", soa.Field<float>() | MatchOrdered({0.f, 11.f, 22.f, 33.f}));
+
+			for (auto [index, value] : soa.Each())
+				value -= index;
+
+			TestTrue(
+				TEXT_"Transformed",
+				soa.Each()
+					| FilterTuple([](int32 index, float value) { return index % 2 == 0; })
+					| TransformTuple([](int32 index, float value) { return value; })
+					| MatchOrdered({0.f, 20.f})
+			);
+		});
+	});
+
+	Describe(TEXT_"Sorting and grouping", [this]
+	{
+		It(TEXT_"should order stably by radix and comparison keys", [this]
+		{
+			Ansi::FArena scratch;
+			TArray<TPair<int32, FString>> items { {3, TEXT_"c"}, {-1, TEXT_"a"}, {3, TEXT_"d"}, {1000, TEXT_"e"}, {-1, TEXT_"b"} };
+
+			TestTrue(
+				TEXT_"Radix ascending",
+				items
+					| OrderBy([](auto const& item) { return item.Key; }, ESortOrder::Ascending, &scratch)
+					| views::transform([](auto const& item) { return item.Value; })
+					| MatchOrdered({TEXT_"a", TEXT_"b", TEXT_"c", TEXT_"d", TEXT_"e"})
+			);
+			TestTrue(
+				TEXT_"Comparison descending",
+				items
+					| OrderBy([](auto const& item) { return item.Value; }, ESortOrder::Descending)
+					| views::transform([](auto const& item) { return item.Key; })
+					| MatchOrdered({1000, 3, 3, -1, -1})
+			);
+		});
+		It(TEXT_"should select top K, distinct elements and groups", [this]
+		{
+			TArray<int32> values { 5, 1, 9, 1, 7, 3, 9, 0 };
+			TestEqual(TEXT_"Smallest three", values | TopK(3), TArray<int32> {0, 1, 1});
+			TestEqual(TEXT_"Largest two", values | TopK(2, ESortOrder::Descending), TArray<int32> {9, 9});
+			TestEqual(TEXT_"Distinct", values | Distinct(), TArray<int32> {5, 1, 9, 7, 3, 0});
+
+			TestEqual(TEXT_"More than the input", values | TopK(10), TArray<int32> {0, 1, 1, 3, 5, 7, 9, 9});
+
+			auto groups = values | GroupBy([](int32 value) { return value % 2 == 0; });
+			TestEqual(TEXT_"Odd", groups[false], TArray<int32> {5, 1, 9, 1, 7, 3, 9});
+			TestEqual(TEXT_"Even", groups[true], TArray<int32> {0});
+		});
+		It(TEXT_"should keep the first of equal keys in top K over unsorted input", [this]
+		{
+			TArray<TPair<int32, FString>> items {
+				{4, TEXT_"a"}, {2, TEXT_"b"}, {8, TEXT_"c"}, {2, TEXT_"d"}, {6, TEXT_"e"}, {2, TEXT_"f"}, {1, TEXT_"g"}, {8, TEXT_"h"}
+			};
+			auto byKey = [](auto const& item) { return item.Key; };
+			TestTrue(
+				TEXT_"Smallest four",
+				items
+					| TopK(4, byKey)
+					| views::transform([](auto const& item) { return item.Value; })
+					| MatchOrdered({TEXT_"g", TEXT_"b", TEXT_"d", TEXT_"f"})
+			);
+			TestTrue(
+				TEXT_"Largest three",
+				items
+					| TopK(3, byKey, ESortOrder::Descending)
+					| views::transform([](auto const& item) { return item.Value; })
+					| MatchOrdered({TEXT_"c", TEXT_"h", TEXT_"e"})
+			);
+		});
+	});
+
+	Describe(TEXT_"Memory-mapped files", [this]
+	{
+		It(TEXT_"should iterate lines without copying", [this]
+		{
+			FString path = FPaths::ProjectSavedDir() / TEXT_"Mcro/Tests/MappedLines.txt";
+			FFileHelper::SaveStringToFile(TEXT_"first\r\nsecond\n\nfourth line\n", *path, FFileHelper::EEncodingOptions::ForceUTF8);
+
+			auto lines = MappedFileLines(path);
+			TestTrue(TEXT_"Opened", lines.HasValue());
+			TArray<FString> result;
+			for (FUtf8StringView line : lines.GetValue())
+				result.Add(FString(line));
+			TestEqual(TEXT_"Lines", result, TArray<FString> {TEXT_"first", TEXT_"second", TEXT_"", TEXT_"fourth line"});
+
+			auto parts = lines.GetValue().Split(3);
+			int64 splitCount = 0;
+			for (FMappedFileLines const& part : parts)
+				splitCount += part | CountIf([](FUtf8StringView) { return true; });
+			TestEqual(TEXT_"Split keeps every line", splitCount, 4ll);
+
+			TestTrue(TEXT_"Missing file is an error", MappedFileLines(path + TEXT_".missing").HasError());
+			IFileManager::Get().Delete(*path);
+		});
+		It(TEXT_"should read records in place", [this]
+		{
+			FString path = FPaths::ProjectSavedDir() / TEXT_"Mcro/Tests/MappedRecords.bin";
+			TArray<int32> source;
+			for (int32 i = 0; i < 10000; ++i)
+				source.Add(i);
+			FFileHelper::SaveArrayToFile(TArrayView<const uint8>(reinterpret_cast<const uint8*>(source.GetData()), source.NumBytes()), *path);
+
+			auto records = MappedFileRecords<int32>(path, EMappedFileAccess::Random);
+			TestTrue(TEXT_"Opened", records.HasValue());
+			TestEqual(TEXT_"Num", records.GetValue().Num(), 10000ll);
+
+			std::atomic<int64> sum {0};
+			records.GetValue() | ParallelChunks(1000, [&](TArrayView<const int32> chunk)
+			{
+				int64 chunkSum = 0;
+				for (int32 value : chunk) chunkSum += value;
+				sum += chunkSum;
+			});
+			TestEqual(TEXT_"Sum", sum.load(), 10000ll * 9999 / 2);
+			IFileManager::Get().Delete(*path);
+		});
 	});
 }
 
@@ -0,0 +1,111 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Async/Async.h"
+#include "Mcro/TextMacros.h"
+#include "Mcro/SharedObjects.h"
+
+namespace
+{
+	struct FPooledTestObject : TSharedFromThis<FPooledTestObject>
+	{
+		FPooledTestObject(int32 value, int32& liveCount) : Value(value), LiveCount(liveCount) { ++LiveCount; }
+		~FPooledTestObject() { --LiveCount; }
+
+		int32 Value;
+		int32& LiveCount;
+	};
+
+	struct FInitializedTestObject
+	{
+		void Initialize(int32 value) { Value = value * 2; }
+
+		int32 Value = 0;
+	};
+}
+
+DEFINE_SPEC(
+	FMcroSharedObjects_Spec,
+	TEXT_"Mcro.SharedObjects",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroSharedObjects_Spec::Define()
+{
+	using namespace Mcro::SharedObjects;
+
+	Describe(TEXT_"MakeSharedPooled", [this]
+	{
+		It(TEXT_"should behave like MakeShared", [this]
+		{
+			int32 liveCount = 0;
+			TWeakPtr<FPooledTestObject> weak;
+			{
+				TSharedRef<FPooledTestObject> object = MakeSharedPooled<FPooledTestObject>(42, liveCount);
+				weak = object;
+				TestEqual(TEXT_"Constructed with arguments", object->Value, 42);
+				TestEqual(TEXT_"One live object", liveCount, 1);
+				TestTrue(TEXT_"TSharedFromThis is set up", object->AsShared() == object);
+
+				TSharedPtr<FPooledTestObject> copy = object;
+				TestEqual(TEXT_"Shared reference count", object.GetSharedReferenceCount(), 2);
+			}
+			TestEqual(TEXT_"Destroyed with the last shared reference", liveCount, 0);
+			TestFalse(TEXT_"Weak pointer expired", weak.IsValid());
+		});
+
+		It(TEXT_"should recycle blocks instead of allocating from the heap", [this]
+		{
+			int32 liveCount = 0;
+			auto churn = [&]
+			{
+				TArray<TSharedRef<FPooledTestObject>> objects;
+				for (int32 i = 0; i < 200; ++i)
+					objects.Add(MakeSharedPooled<FPooledTestObject>(i, liveCount));
+			};
+
+			// Warm up the caches first
+			churn();
+			uint64 heapAllocations = GetSharedObjectPoolStats().HeapAllocations;
+			for (int32 i = 0; i < 10; ++i) churn();
+
+			TestEqual(TEXT_"No live objects", liveCount, 0);
+			TestEqual(TEXT_"Steady state doesn't allocate", GetSharedObjectPoolStats().HeapAllocations, heapAllocations);
+		});
+
+		It(TEXT_"should release objects on other threads", [this]
+		{
+			int32 liveCount = 0;
+			TArray<TSharedRef<FPooledTestObject>> objects;
+			for (int32 i = 0; i < 500; ++i)
+				objects.Add(MakeSharedPooled<FPooledTestObject>(i, liveCount));
+
+			Async(EAsyncExecution::Thread, [objects = MoveTemp(objects)]() mutable
+			{
+				objects.Empty();
+			}).Wait();
+			TestEqual(TEXT_"Every object is destroyed", liveCount, 0);
+		});
+	});
+
+	Describe(TEXT_"MakeShareableInit", [this]
+	{
+		It(TEXT_"should call Initialize on the adopted object", [this]
+		{
+			TSharedRef<FInitializedTestObject> object = MakeShareableInit(new FInitializedTestObject(), 21);
+			TestEqual(TEXT_"Initialized", object->Value, 42);
+		});
+	});
+}
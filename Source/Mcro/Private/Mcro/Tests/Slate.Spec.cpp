@@ -0,0 +1,142 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/Ticker.h"
+#include "Widgets/Layout/SSpacer.h"
+#include "Widgets/SBoxPanel.h"
+#include "Mcro/Common.h"
+#include "Mcro/Slate/ReactiveWidget.h"
+
+#include <atomic>
+
+using namespace Mcro::Common;
+
+namespace
+{
+	TArray<int32> SelectedItems(TConstArrayView<int32> sequence)
+	{
+		const TBitArray<> mask = Mcro::Slate::Detail::LongestIncreasingSubsequence(sequence);
+		TArray<int32> result;
+		for (int32 i = 0; i < sequence.Num(); ++i)
+		{
+			if (mask[i]) result.Add(sequence[i]);
+		}
+		return result;
+	}
+
+	/** @brief Exposes the reconciliation of a reactive widget, which is otherwise triggered before painting it */
+	template <typename Widget>
+	class TTestedReactiveWidget : public Widget
+	{
+	public:
+		void ReconcileNow()
+		{
+			if (auto state = this->State.Pin())
+				this->ReconcileWith(*state);
+		}
+
+		bool IsPlanInFlight() const { return this->bPlanInFlight; }
+		int32 GetChildrenNum() const { return this->Children.Num(); }
+	};
+
+	using FTestedArrayWidget = TTestedReactiveWidget<TKeyedArrayReactiveWidget<int32, int32, SVerticalBox>>;
+
+	struct FOffThreadCounters
+	{
+		int32 Created = 0;
+		int32 Removed = 0;
+		int32 Moved = 0;
+		std::atomic<bool> bKeyedOffGameThread { false };
+		int32 Phase = 0;
+	};
+}
+
+DEFINE_SPEC(
+	FMcroSlate_Spec,
+	TEXT_"Mcro.Slate",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroSlate_Spec::Define()
+{
+	Describe(TEXT_"Keyed reconciliation", [this]
+	{
+		It(TEXT_"should keep the longest run of children already in order", [this]
+		{
+			TestEqual(TEXT_"Empty", SelectedItems({}).Num(), 0);
+			TestEqual(TEXT_"Sorted", SelectedItems({0, 1, 2, 3}), TArray{0, 1, 2, 3});
+			TestEqual(TEXT_"Reversed", SelectedItems({3, 2, 1, 0}).Num(), 1);
+
+			// An item moved from the end to the front, only that one should move
+			TestEqual(TEXT_"Moved to front", SelectedItems({4, 0, 1, 2, 3}), TArray{0, 1, 2, 3});
+			TestEqual(TEXT_"Swapped", SelectedItems({0, 3, 2, 1, 4}).Num(), 3);
+			TestEqual(TEXT_"Interleaved", SelectedItems({2, 0, 3, 1, 4, 5}), TArray{0, 1, 4, 5});
+		});
+
+		LatentIt(TEXT_"should plan off the game thread and apply on it", [this](FDoneDelegate const& done)
+		{
+			auto state = MakeShared<TState<TArray<int32>>>(TArray {1, 2, 3});
+			auto counters = MakeShared<FOffThreadCounters>();
+			TSharedRef<FTestedArrayWidget> widget = SNew(FTestedArrayWidget)
+				. State(state)
+				. Container(SNew(SVerticalBox))
+				. PlanOffGameThread(true)
+				. KeyOf_Lambda([counters](int32 const& item)
+				{
+					if (!IsInGameThread()) counters->bKeyedOffGameThread = true;
+					return item;
+				})
+				. CreateChild_Lambda([counters](TSharedRef<SVerticalBox> const& container, int32 const&, int32 const& at)
+				{
+					++counters->Created;
+					return MoveTemp(container->InsertSlot(at)[SNew(SSpacer)]);
+				})
+				. RemoveChild_Lambda([counters](TSharedRef<SVerticalBox> const& container, TSharedRef<SWidget> const& child, int32 const&)
+				{
+					++counters->Removed;
+					container->RemoveSlot(child);
+				})
+				. MoveChild_Lambda([counters](TSharedRef<SVerticalBox> const& container, TSharedRef<SWidget> const& child, int32, int32 to)
+				{
+					++counters->Moved;
+					container->RemoveSlot(child);
+					container->InsertSlot(to)[child];
+				})
+			;
+			widget->ReconcileNow();
+
+			// The plan is applied through the time-sliced game thread queue, poll until it's done
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, state, counters, widget, done](float)
+			{
+				if (widget->IsPlanInFlight()) return true;
+				if (counters->Phase == 0)
+				{
+					TestEqual(TEXT_"Initial children", widget->GetChildrenNum(), 3);
+					counters->Phase = 1;
+					state->Set(TArray {3, 1, 4});
+					widget->ReconcileNow();
+					return true;
+				}
+				TestTrue(TEXT_"Planned off the game thread", counters->bKeyedOffGameThread.load());
+				TestEqual(TEXT_"Children", widget->GetChildrenNum(), 3);
+				TestEqual(TEXT_"Created", counters->Created, 4);
+				TestEqual(TEXT_"Removed", counters->Removed, 1);
+				TestTrue(TEXT_"Moved", counters->Moved > 0);
+				done.Execute();
+				return false;
+			}));
+		});
+	});
+}
@@ -0,0 +1,366 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Mcro/Common.h"
+
+using namespace Mcro::Common;
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcroStructuredLogSpec, Log, All);
+
+namespace
+{
+	template <typename CharTo, typename CharFrom>
+	bool TranscodeMatchesStringCast(const CharFrom* source, int32 length)
+	{
+		TArray<CharTo> transcoded;
+		transcoded.SetNumUninitialized(MaxTranscodedLength<CharTo, CharFrom>(length));
+		transcoded.SetNum(Transcode(transcoded.GetData(), transcoded.Num(), source, length));
+
+		auto conversion = StringCast<CharTo>(source, length);
+		return transcoded == TArray<CharTo>(conversion.Get(), conversion.Length());
+	}
+}
+
+DEFINE_SPEC(
+	FMcroText_Spec,
+	TEXT_"Mcro.Text",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroText_Spec::Define()
+{
+	Describe(TEXT_"Conversion into caller buffers", [this]
+	{
+		It(TEXT_"should append to Unreal buffers", [this]
+		{
+			std::string ansi = "Hello";
+			TStringBuilder<32> builder;
+			builder << TEXT_"> ";
+			UnrealConvert(ansi, builder);
+			TestEqualSensitive(TEXT_"Builder", builder.ToString(), TEXT_"> Hello");
+
+			FString string = TEXT_"> ";
+			UnrealConvert(ansi, string);
+			TestEqualSensitive(TEXT_"FString", string, TEXT_"> Hello");
+
+			TArray<TCHAR> array;
+			UnrealCopy(FStdStringView(TEXT_"copy"), array);
+			TestEqual(TEXT_"TArray", array.Num(), 4);
+		});
+		It(TEXT_"should append to STL and inline buffers reusing their capacity", [this]
+		{
+			TInlineCharBuffer<ANSICHAR> buffer;
+			StdConvert(FStringView(TEXT_"first"), buffer);
+			TestTrue(TEXT_"Converted", StdView(buffer) == "first");
+
+			buffer.Reset();
+			StdConvert(NAME_"Second", buffer);
+			TestTrue(TEXT_"Reused", StdView(buffer) == "Second");
+
+			std::string stdString;
+			stdString.reserve(64);
+			const char* storage = stdString.data();
+			StdConvert(FStringView(TEXT_"Ünicode"), stdString);
+			TestTrue(TEXT_"STL string", stdString.size() >= 7);
+			TestEqual(TEXT_"Capacity retained", stdString.data(), storage);
+
+			buffer.Reset();
+			StdConvert(TEXT_"literal", buffer);
+			TestTrue(TEXT_"String literal", StdView(buffer) == "literal");
+
+			buffer.Reset();
+			StdConvert(FStdString(TEXT_"stl"), buffer);
+			TestTrue(TEXT_"STL source", StdView(buffer) == "stl");
+		});
+	});
+
+	Describe(TEXT_"Transcoding", [this]
+	{
+		auto makeWide = [](FRandomStream& random, int32 length, bool loneSurrogates)
+		{
+			FString result;
+			for (int32 i = 0; i < length; ++i)
+			{
+				switch (random.RandRange(0, loneSurrogates ? 9 : 8))
+				{
+				case 0:  result.AppendChar(static_cast<TCHAR>(random.RandRange(0x80, 0x7FF))); break;
+				case 1:  result.AppendChar(static_cast<TCHAR>(random.RandRange(0xE000, 0xFFFD))); break;
+				case 2:  result += TEXT_"\U0001F600"; break;
+				case 9:  result.AppendChar(static_cast<TCHAR>(random.RandRange(0xD800, 0xDFFF))); break;
+				default: result.AppendChar(static_cast<TCHAR>(random.RandRange(0x20, 0x7E))); break;
+				}
+			}
+			return result;
+		};
+		auto makeNarrow = [](FRandomStream& random, int32 length)
+		{
+			TArray<uint8> result;
+			for (int32 i = 0; i < length; ++i)
+			{
+				result.Add(random.RandRange(0, 5) == 0
+					? static_cast<uint8>(random.RandRange(0x80, 0xFF))
+					: static_cast<uint8>(random.RandRange(0x20, 0x7E))
+				);
+			}
+			return result;
+		};
+
+		It(TEXT_"should match StringCast from TCHAR", [this, makeWide]
+		{
+			FRandomStream random(1337);
+			for (int32 round = 0; round < 500; ++round)
+			{
+				// mostly ASCII with sparse non-ASCII characters so both the vector and the segment paths are hit
+				const FString input = makeWide(random, random.RandRange(0, 100), true);
+				const TCHAR* data = *input;
+				const int32 length = input.Len();
+				TestTrue(TEXT_"UTF-8", TranscodeMatchesStringCast<UTF8CHAR>(data, length));
+				TestTrue(TEXT_"ANSI", TranscodeMatchesStringCast<ANSICHAR>(data, length));
+			}
+		});
+		It(TEXT_"should match StringCast into TCHAR", [this, makeNarrow]
+		{
+			FRandomStream random(4242);
+			for (int32 round = 0; round < 500; ++round)
+			{
+				const TArray<uint8> input = makeNarrow(random, random.RandRange(0, 100));
+				const auto* utf8 = reinterpret_cast<const UTF8CHAR*>(input.GetData());
+				const auto* ansi = reinterpret_cast<const ANSICHAR*>(input.GetData());
+				const int32 length = input.Num();
+				TestTrue(TEXT_"UTF-8", TranscodeMatchesStringCast<TCHAR>(utf8, length));
+				TestTrue(TEXT_"ANSI", TranscodeMatchesStringCast<TCHAR>(ansi, length));
+			}
+		});
+		It(TEXT_"should round-trip through the high level conversions", [this, makeWide]
+		{
+			FRandomStream random(7);
+			for (int32 round = 0; round < 100; ++round)
+			{
+				// no lone surrogates, those are not preserved by UTF-8
+				const FString input = makeWide(random, random.RandRange(0, 200), false);
+				TestEqualSensitive(TEXT_"Round-trip", UnrealConvert(StdConvert<UTF8CHAR>(input)), input);
+			}
+		});
+	});
+
+	Describe(TEXT_"Cached name conversions", [this]
+	{
+		It(TEXT_"should return the same names as the global name table", [this]
+		{
+			std::string ansi = "Mcro_CachedName";
+			for (int32 i = 0; i < 3; ++i)
+			{
+				TestEqual(TEXT_"Convert", UnrealNameConvert(ansi), FName(TEXT_"Mcro_CachedName"));
+				TestEqual(TEXT_"Copy", UnrealNameCopy(FStdStringView(TEXT_"Mcro_CachedName")), FName(TEXT_"Mcro_CachedName"));
+			}
+
+			std::string numbered = "Mcro_CachedName_3";
+			FName name = UnrealNameConvert(numbered);
+			TestEqual(TEXT_"Number", name.GetNumber(), NAME_EXTERNAL_TO_INTERNAL(3));
+			TestEqual(TEXT_"Cached number", UnrealNameConvert(numbered), name);
+		});
+		It(TEXT_"should tell apart different strings", [this]
+		{
+			TSet<FName> names;
+			for (int32 i = 0; i < 20000; ++i)
+			{
+				std::string identifier = "Mcro_Identifier" + std::to_string(i);
+				FName name = UnrealNameConvert(identifier);
+				TestEqualSensitive(TEXT_"Content", name.ToString(), UnrealConvert(identifier));
+				names.Add(name);
+			}
+			TestEqual(TEXT_"Unique", names.Num(), 20000);
+		});
+	});
+
+	Describe(TEXT_"DynamicPrintf", [this]
+	{
+		It(TEXT_"should format strings of any length", [this]
+		{
+			FString format = TEXT_"%s-%d";
+			TestEqualSensitive(TEXT_"Short", DynamicPrintf(*format, TEXT_"a", 1), TEXT_"a-1");
+
+			FString longArgument = FString::ChrN(3000, TEXT('x'));
+			FString result = DynamicPrintf(*format, *longArgument, 2);
+			TestEqual(TEXT_"Long", result.Len(), 3002);
+			TestTrue(TEXT_"Long ending", result.EndsWith(TEXT_"x-2"));
+
+			FString output = TEXT_"> ";
+			DynamicPrintfTo(output, *format, *longArgument, 3);
+			DynamicPrintfTo(output, *format, TEXT_"b", 4);
+			TestEqual(TEXT_"Appended", output.Len(), 2 + 3002 + 3);
+			TestTrue(TEXT_"Appended ending", output.EndsWith(TEXT_"x-3b-4"));
+		});
+	});
+
+	Describe(TEXT_"Compile-time format strings", [this]
+	{
+		It(TEXT_"should format ordered arguments", [this]
+		{
+			FString name = TEXT_"Bob";
+			TestEqualSensitive(
+				TEXT_"Ordered",
+				TEXT_"Hi {0}, your number is {1} ({1})" _FMT(name, 42),
+				TEXT_"Hi Bob, your number is 42 (42)"
+			);
+			TestEqualSensitive(
+				TEXT_"Leading",
+				FMT_(PF_Unknown, -3, "text") "{0} {1} {2}",
+				TEXT_"PF_Unknown -3 text"
+			);
+			TestEqualSensitive(
+				TEXT_"Same as FString::Format for floating point",
+				TEXT_"{0}" _FMT(1.5),
+				FString::Format(TEXT_"{0}", {1.5})
+			);
+		});
+		It(TEXT_"should format named arguments", [this]
+		{
+			TestEqualSensitive(
+				TEXT_"Named",
+				TEXT_"{Type}: {count} {Count}" _FMT(
+					(Type, PF_DXT1)
+					(Count, 3u)
+				),
+				TEXT_"PF_DXT1: 3 3"
+			);
+			TestEqualSensitive(
+				TEXT_"Missing names are kept",
+				TEXT_"{Type} {Missing}" _FMT((Type, 1)),
+				TEXT_"1 {Missing}"
+			);
+		});
+		It(TEXT_"should own temporary arguments", [this]
+		{
+			auto args = FormatArguments(
+				Mcro::Text::Detail::MakeNamedFormatArgument([] { return TEXT_"Name"; }, FString(TEXT_"Temporary")),
+				Mcro::Text::Detail::MakeNamedFormatArgument([] { return TEXT_"Count"; }, 2)
+			);
+			TestEqualSensitive(
+				TEXT_"Formatted after the full expression",
+				Format(TEXT_"{Name} {Count}", args),
+				TEXT_"Temporary 2"
+			);
+		});
+		It(TEXT_"should keep escaped and non-argument braces", [this]
+		{
+			TestEqualSensitive(
+				TEXT_"Escaped",
+				TEXT_"`{0`} {0} {} { \"a\": {Foo} }" _FMT(1),
+				TEXT_"{0} 1 {} { \"a\": {Foo} }"
+			);
+		});
+		It(TEXT_"should handle more segments than stored at compile time", [this]
+		{
+			FString expected;
+			for (int32 i = 0; i < 20; ++i) expected += TEXT_"a-b-";
+			TestEqualSensitive(
+				TEXT_"Long format",
+				TEXT_"{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-"
+				     "{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-{0}-{1}-" _FMT(TEXT_"a", TEXT_"b"),
+				expected
+			);
+		});
+		It(TEXT_"should format into existing builders", [this]
+		{
+			TStringBuilder<64> builder;
+			builder << TEXT_"> ";
+			FormatTo(builder, TEXT_"{0}/{1}", FormatArguments(NAME_"Foo", FStringView(TEXT_"Bar")));
+			TestEqualSensitive(TEXT_"Appended", builder.ToString(), TEXT_"> Foo/Bar");
+		});
+		It(TEXT_"should still format FText at runtime", [this]
+		{
+			TestEqualSensitive(
+				TEXT_"FText",
+				(INVTEXT_"{0} {Name}" _FMT(1)).ToString(),
+				TEXT_"1 {Name}"
+			);
+		});
+	});
+
+	Describe(TEXT_"Inline strings", [this]
+	{
+		It(TEXT_"should store short text inline", [this]
+		{
+			TInlineString<16> text = TEXT_"Short";
+			TestTrue(TEXT_"Inline", text.IsInline());
+			TestEqual(TEXT_"Length", text.Len(), 5);
+			TestTrue(TEXT_"Same content", text == TEXT_"Short");
+			TestEqualSensitive(TEXT_"Null-terminated", *text, TEXT_"Short");
+			TestEqual(TEXT_"Same hash as FString", GetTypeHash(text), GetTypeHash(FString(TEXT_"Short")));
+		});
+		It(TEXT_"should allocate only for long text", [this]
+		{
+			FString longText = FString::ChrN(100, TEXT('x'));
+			TInlineString<16> text = longText;
+			TestFalse(TEXT_"Allocated", text.IsInline());
+			TestEqual(TEXT_"Same content", text.ToString(), longText);
+
+			text = TEXT_"";
+			TestTrue(TEXT_"Empty", text.IsEmpty());
+			TestEqualSensitive(TEXT_"Empty C string", *text, TEXT_"");
+		});
+		It(TEXT_"should be used as a format argument", [this]
+		{
+			TInlineString<16> name = "Ansi";
+			TestEqualSensitive(TEXT_"_FMT", TEXT_"Hi {0}!" _FMT(name), TEXT_"Hi Ansi!");
+			TestEqualSensitive(TEXT_"AsString", AsString(name), TEXT_"Ansi");
+		});
+	});
+
+	Describe(TEXT_"Structured log", [this]
+	{
+		It(TEXT_"should format deferred messages in the binary log", [this]
+		{
+			const FString binaryPath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT_"StructuredLog", TEXT_".mslog");
+			auto started = StartBinaryStructuredLog(binaryPath);
+			if (!TestFalse(TEXT_"Binary log opened", started.HasError())) return;
+
+			SetStructuredLogTextOutput(false);
+			const FString longText = FString::ChrN(32 * 1024, TEXT('x'));
+			for (int32 i = 0; i < 3; ++i)
+				MCRO_SLOG(LogMcroStructuredLogSpec, Log, "{0} {1} {2} {3} {4}", i, 1.5, PF_DXT1, NAME_"Foo", TEXT_"bar");
+
+			// Messages which don't fit into the ring of the thread are logged immediately, flush to keep the order
+			FlushStructuredLog();
+			MCRO_SLOG(LogMcroStructuredLogSpec, Warning, "{0}", longText);
+			StopBinaryStructuredLog();
+			SetStructuredLogTextOutput(true);
+
+			TArray<uint8> binary;
+			FFileHelper::LoadFileToArray(binary, *binaryPath);
+			IFileManager::Get().Delete(*binaryPath);
+
+			TArray<FStructuredLogEntry> entries;
+			auto decoded = DecodeStructuredLog(binary, [&](FStructuredLogEntry const& entry) { entries.Add(entry); });
+			if (!TestFalse(TEXT_"Decoded", decoded.HasError())) return;
+			if (!TestEqual(TEXT_"Message count", entries.Num(), 4)) return;
+
+			TestEqualSensitive(TEXT_"Formatted", entries[1].GetMessage(), TEXT_"1 " + FString::Format(TEXT_"{0}", {1.5}) + TEXT_" PF_DXT1 Foo bar");
+			TestEqual(TEXT_"Category", entries[0].Category, FName(TEXT_"LogMcroStructuredLogSpec"));
+			TestEqual(TEXT_"Synchronously logged large message", entries.Last().GetMessage(), longText);
+			TestEqual(TEXT_"Verbosity", entries.Last().Verbosity, ELogVerbosity::Warning);
+		});
+		It(TEXT_"should reject data which is not a structured log", [this]
+		{
+			const uint8 garbage[] { 1, 2, 3, 4, 5, 6, 7, 8 };
+			TestTrue(TEXT_"Error", DecodeStructuredLog(garbage, [](FStructuredLogEntry const&) {}).HasError());
+		});
+	});
+}
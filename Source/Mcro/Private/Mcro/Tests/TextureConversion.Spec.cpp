@@ -0,0 +1,85 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "RenderGraphBuilder.h"
+#include "RenderingThread.h"
+#include "Mcro/Common.h"
+#include "Mcro/Rendering/TextureConversion.h"
+
+using namespace Mcro::Rendering::Textures;
+
+DEFINE_SPEC(
+	FMcroTextureConversion_Spec,
+	TEXT_"Mcro.Rendering.TextureConversion",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroTextureConversion_Spec::Define()
+{
+	Describe(TEXT_"YUV matrix", [this]
+	{
+		auto apply = [](FVector4f const& row, FVector3f const& rgb)
+		{
+			return row.X * rgb.X + row.Y * rgb.Y + row.Z * rgb.Z + row.W;
+		};
+
+		It(TEXT_"should map full range white and black to the ends of the range", [this, apply]
+		{
+			auto matrix = Detail::GetYuvMatrix(EYuvColorSpace::Rec709, true);
+			TestEqual(TEXT_"White luma", apply(matrix.Y, FVector3f(1.f)), 1.f, KINDA_SMALL_NUMBER);
+			TestEqual(TEXT_"Black luma", apply(matrix.Y, FVector3f(0.f)), 0.f, KINDA_SMALL_NUMBER);
+			TestEqual(TEXT_"White U", apply(matrix.U, FVector3f(1.f)), 128.f / 255.f, KINDA_SMALL_NUMBER);
+			TestEqual(TEXT_"White V", apply(matrix.V, FVector3f(1.f)), 128.f / 255.f, KINDA_SMALL_NUMBER);
+		});
+
+		It(TEXT_"should keep video range luma between 16 and 235", [this, apply]
+		{
+			auto matrix = Detail::GetYuvMatrix(EYuvColorSpace::Rec601, false);
+			TestEqual(TEXT_"White luma", apply(matrix.Y, FVector3f(1.f)), 235.f / 255.f, KINDA_SMALL_NUMBER);
+			TestEqual(TEXT_"Black luma", apply(matrix.Y, FVector3f(0.f)), 16.f / 255.f, KINDA_SMALL_NUMBER);
+			TestEqual(TEXT_"Blue U", apply(matrix.U, FVector3f(0.f, 0.f, 1.f)), 240.f / 255.f, KINDA_SMALL_NUMBER);
+			TestEqual(TEXT_"Red V", apply(matrix.V, FVector3f(1.f, 0.f, 0.f)), 240.f / 255.f, KINDA_SMALL_NUMBER);
+		});
+	});
+
+	Describe(TEXT_"Conversion passes", [this]
+	{
+		It(TEXT_"should reject invalid inputs without adding passes", [this]
+		{
+			bool emptyTarget = false;
+			bool compressedTarget = false;
+			bool missingConvertSource = false;
+			bool missingDownsampleSource = false;
+			bool missingYuvSource = false;
+			ENQUEUE_RENDER_COMMAND(FMcroTextureConversionSpec)([&](FRHICommandListImmediate& commands)
+			{
+				FRDGBuilder graph(commands);
+				emptyTarget = AddConvertTexturePass(graph, nullptr, FUnrealTextureSize()).HasError();
+				compressedTarget = AddConvertTexturePass(graph, nullptr, FUnrealTextureSize(16, 16, PF_DXT1)).HasError();
+				missingConvertSource = AddConvertIntoTexturePass(graph, nullptr, nullptr).HasError();
+				missingDownsampleSource = AddDownsampleTexturePass(graph, nullptr).HasError();
+				missingYuvSource = AddRgbToYuvPass(graph, nullptr).HasError();
+				graph.Execute();
+			});
+			FlushRenderingCommands();
+
+			TestTrue(TEXT_"Target without size or format", emptyTarget);
+			TestTrue(TEXT_"Block compressed target", compressedTarget);
+			TestTrue(TEXT_"Conversion without source", missingConvertSource);
+			TestTrue(TEXT_"Downsampling without source", missingDownsampleSource);
+			TestTrue(TEXT_"YUV conversion without source", missingYuvSource);
+		});
+	});
+}
@@ -0,0 +1,140 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Containers/Ticker.h"
+#include "Mcro/Common.h"
+#include "Mcro/Threading/Pipeline.h"
+
+using namespace Mcro::Common;
+using namespace Mcro::Threading;
+
+namespace ThreadingTest
+{
+	/** @brief Pipeline items don't need to be default constructible */
+	struct FNoDefault
+	{
+		explicit FNoDefault(int32 value) : Value(value) {}
+		int32 Value;
+	};
+
+	struct FPipelineResults
+	{
+		FCriticalSection Lock;
+		TArray<int32> Values;
+		int32 Pushed = 0;
+	};
+}
+
+DEFINE_SPEC(
+	FMcroThreading_Spec,
+	TEXT_"Mcro.Threading",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::ProductFilter
+)
+	static constexpr int32 ItemCount = 200;
+END_DEFINE_SPEC(FMcroThreading_Spec)
+
+void FMcroThreading_Spec::Define()
+{
+	using namespace ThreadingTest;
+
+	Describe(TEXT_"TPipeline", [this]
+	{
+		LatentIt(TEXT_"should process every item across parallel stages", [this](FDoneDelegate const& done)
+		{
+			auto results = MakeShared<FPipelineResults>();
+			auto pipeline = MakePipeline<FNoDefault, 16>()
+				.Then({ .Name = TEXT_"Double", .Parallelism = 4 }, [](FNoDefault&& item)
+				{
+					return FNoDefault(item.Value * 2);
+				})
+				.Finally({ .Name = TEXT_"Collect", .Parallelism = 2 }, [results](FNoDefault&& item)
+				{
+					FScopeLock lock(&results->Lock);
+					results->Values.Add(item.Value);
+				});
+
+			// Items which don't fit into the first stage are pushed again on the next tick
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+				[this, pipeline, results, done](float) mutable
+			{
+				while (results->Pushed < ItemCount && pipeline.TryPush(FNoDefault(results->Pushed)))
+					++results->Pushed;
+
+				if (results->Pushed < ItemCount || !pipeline.IsIdle()) return true;
+
+				FScopeLock lock(&results->Lock);
+				TestEqual(TEXT_"Every item arrived", results->Values.Num(), ItemCount);
+				int64 sum = 0;
+				for (int32 value : results->Values) sum += value;
+				TestEqual(TEXT_"Every item was transformed", sum, int64(ItemCount) * (ItemCount - 1));
+				done.Execute();
+				return false;
+			}));
+		});
+
+		LatentIt(TEXT_"should keep the order of a stalled sequential stage", [this](FDoneDelegate const& done)
+		{
+			auto results = MakeShared<FPipelineResults>();
+
+			// The game thread sink only runs between ticks, so the tiny queues fill up and the first stage parks
+			auto pipeline = MakePipeline<int32, 4>()
+				.Then({ .Name = TEXT_"Increment" }, [](int32&& item) { return item + 1; })
+				.Finally({ .Name = TEXT_"Collect", .Thread = ENamedThreads::GameThread }, [results](int32&& item)
+				{
+					results->Values.Add(item);
+				});
+
+			FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+				[this, pipeline, results, done](float) mutable
+			{
+				while (results->Pushed < ItemCount && pipeline.TryPush(int32(results->Pushed)))
+					++results->Pushed;
+
+				if (results->Pushed < ItemCount || !pipeline.IsIdle()) return true;
+
+				TestEqual(TEXT_"Every item arrived", results->Values.Num(), ItemCount);
+				bool ordered = true;
+				for (int32 i = 0; i < results->Values.Num(); ++i)
+					ordered &= results->Values[i] == i + 1;
+				TestTrue(TEXT_"Items arrived in order", ordered);
+
+				uint64 stalls = 0;
+				for (FPipelineStageStats const& stats : pipeline.GetStats()) stalls += stats.Stalls;
+				TestTrue(TEXT_"The first stage has stalled", stalls > 0);
+				done.Execute();
+				return false;
+			}));
+		});
+	});
+
+	Describe(TEXT_"TBoundedMpmcStorage", [this]
+	{
+		It(TEXT_"should reject items when full and receive them in order", [this]
+		{
+			Detail::TBoundedMpmcStorage<FNoDefault, 4> storage;
+			for (int32 i = 0; i < 4; ++i)
+				TestTrue(TEXT_"Sent", storage.Send(FNoDefault(i)));
+
+			FNoDefault rejected(4);
+			TestFalse(TEXT_"Full", storage.Send(MoveTemp(rejected)));
+
+			for (int32 i = 0; i < 4; ++i)
+			{
+				TOptional<FNoDefault> received = storage.TryReceive();
+				TestTrue(TEXT_"Received", received.IsSet() && received->Value == i);
+			}
+			TestFalse(TEXT_"Empty", storage.TryReceive().IsSet());
+		});
+	});
+}
@@ -0,0 +1,115 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Mcro/Common.h"
+
+using namespace Mcro::Common;
+
+namespace
+{
+	struct FTypeHashMapFoo {};
+	struct FTypeHashMapBar {};
+
+	constexpr auto GFrozenRegistry = MakeFrozenTypeHashMap<int32>(
+		std::pair { TTypeHash<FTypeHashMapFoo>, 1 },
+		std::pair { TTypeHash<FTypeHashMapBar>, 2 }
+	);
+	static_assert(*GFrozenRegistry.Find<FTypeHashMapBar>() == 2);
+	static_assert(!GFrozenRegistry.Contains<int32>());
+
+	// Spread like XXH3 type hashes
+	uint64 MakeKey(int32 i)
+	{
+		return Hash::HashBytes(&i, sizeof(i));
+	}
+}
+
+DEFINE_SPEC(
+	FMcroTypeHashMap_Spec,
+	TEXT_"Mcro.TypeHashMap",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroTypeHashMap_Spec::Define()
+{
+	Describe(TEXT_"TTypeHashMap", [this]
+	{
+		It(TEXT_"should find values by type", [this]
+		{
+			TTypeHashMap<FString> map;
+			map.Add<FTypeHashMapFoo>(TEXT_"Foo");
+			map.Add<FTypeHashMapBar>(TEXT_"Bar");
+			TestEqual(TEXT_"Num", map.Num(), 2);
+			TestEqual(TEXT_"Foo", *map.Find<FTypeHashMapFoo>(), TEXT_"Foo");
+			TestEqual(TEXT_"Bar", *map.Find<FTypeHashMapBar>(), TEXT_"Bar");
+			TestNull(TEXT_"Missing", map.Find<int32>());
+
+			map.Add<FTypeHashMapFoo>(TEXT_"Replaced");
+			TestEqual(TEXT_"Replaced", *map.Find<FTypeHashMapFoo>(), TEXT_"Replaced");
+			TestEqual(TEXT_"FindOrAdd existing", map.FindOrAdd(TTypeHash<FTypeHashMapBar>), TEXT_"Bar");
+			TestEqual(TEXT_"Num after replace", map.Num(), 2);
+		});
+		It(TEXT_"should stay consistent through growing and removal", [this]
+		{
+			TTypeHashMap<int32> map;
+			TMap<uint64, int32> reference;
+			for (int32 i = 0; i < 5000; ++i)
+			{
+				map.Add(MakeKey(i), i);
+				reference.Add(MakeKey(i), i);
+			}
+			for (int32 i = 0; i < 5000; i += 3)
+			{
+				TestTrue(TEXT_"Removed", map.Remove(MakeKey(i)));
+				reference.Remove(MakeKey(i));
+			}
+			TestFalse(TEXT_"Removed twice", map.Remove(MakeKey(0)));
+			for (int32 i = 5000; i < 6000; ++i)
+			{
+				map.Add(MakeKey(i), i);
+				reference.Add(MakeKey(i), i);
+			}
+
+			TestEqual(TEXT_"Num", map.Num(), reference.Num());
+			bool matches = true;
+			for (int32 i = 0; i < 6000; ++i)
+			{
+				const int32* value = map.Find(MakeKey(i));
+				const int32* expected = reference.Find(MakeKey(i));
+				matches &= (value == nullptr) == (expected == nullptr) && (!value || *value == *expected);
+			}
+			TestTrue(TEXT_"Same content as TMap", matches);
+
+			int32 iterated = 0;
+			for (auto const& [key, value] : map)
+				iterated += reference.FindRef(key) == value;
+			TestEqual(TEXT_"Iteration", iterated, reference.Num());
+
+			map.Reset();
+			TestTrue(TEXT_"Reset", map.IsEmpty() && !map.Contains(MakeKey(1)));
+		});
+	});
+
+	Describe(TEXT_"TFrozenTypeHashMap", [this]
+	{
+		It(TEXT_"should be usable at runtime", [this]
+		{
+			TestEqual(TEXT_"Foo", *GFrozenRegistry.Find(TTypeHash<FTypeHashMapFoo>), 1);
+			TestNull(TEXT_"Missing", GFrozenRegistry.Find(TTypeHash<FString>));
+			TestEqual(TEXT_"Num", GFrozenRegistry.Num(), 2);
+		});
+	});
+}
@@ -50,6 +50,12 @@ void FMcroTypes_Spec::Define()
 {
 	Describe(TEXT_"TTypeName template", [this]
 	{
+		It(TEXT_"should cache runtime type names", [this]
+		{
+			TestEqual(TEXT_"Same FString", &TTypeString<FMcroTypes_Spec>(), &TTypeString<FMcroTypes_Spec>());
+			TestEqual(TEXT_"FName matches", TTypeFName<FMcroTypes_Spec>(), FName(TEXT_"FMcroTypes_Spec"));
+			TestNotEqual(TEXT_"Per type", TTypeFName<FMcroTypes_Spec>(), TTypeFName<FNonExistent>());
+		});
 		It(TEXT_"should correctly match typenames", [this]
 		{
 			auto name = TTypeName<FMcroTypes_Spec>;
@@ -73,6 +79,22 @@ void FMcroTypes_Spec::Define()
 		});
 	});
 	
+	Describe(TEXT_"FType", [this]
+	{
+		It(TEXT_"should be a compact handle to a compile-time descriptor", [this]
+		{
+			using namespace Mcro::TypeInfo;
+			static_assert(sizeof(FType) == sizeof(void*));
+			static_assert(TTypeOf<FDerivedSomething>.GetHash() == TTypeHash<FDerivedSomething>);
+
+			FType type = TTypeOf<FDerivedSomething>;
+			TestEqual(TEXT_"Name is stored", type.ToString(), TEXT_"FDerivedSomething");
+			TestTrue(TEXT_"Same types are equal", type == TTypeOf<FDerivedSomething>);
+			TestFalse(TEXT_"Different types are not equal", type == TTypeOf<FBaseSomething>);
+			TestFalse(TEXT_"Default constructed type is invalid", FType().IsValid());
+		});
+	});
+
 	Describe(TEXT_"IHaveType base class", [this]
 	{
 		It(TEXT_"should correctly preserve type", [this]
@@ -0,0 +1,439 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Mcro/Common.h"
+#include "Mcro/Yaml/Reflection.h"
+#include "Mcro/Yaml/Mapped.h"
+#include "Mcro/Yaml/Range.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "YamlTestTypes.h"
+
+using namespace Mcro::Common;
+
+namespace
+{
+	FYamlTestRow MakeTestRow()
+	{
+		FYamlTestRow row;
+		row.bFlag = true;
+		row.Byte = 200;
+		row.Large = -1234567890123ll;
+		row.Single = 1.5f;
+		row.Precise = 0.1;
+		row.String = TEXT_"Ünicode string";
+		row.Name = TEXT_"SomeName";
+		row.Text = INVTEXT_"Some text";
+		row.Enum = EYamlTestEnum::Third;
+		row.Vector = FVector(1, 2, 3);
+		row.Inner = { 7, TEXT_"Inner" };
+		row.Children = { { 1, TEXT_"A" }, { 2, TEXT_"B" } };
+		row.Numbers = { 4, 5, 6 };
+		row.Fixed[1] = 9;
+		row.Exported.Add(TEXT_"Key", 3);
+		row.Transient = 5;
+		return row;
+	}
+
+	TMaybe<TSharedRef<FMappedYamlDocument>> ParseYaml(const ANSICHAR* text)
+	{
+		return FMappedYamlDocument::Parse(TArray<uint8>(reinterpret_cast<const uint8*>(text), FCStringAnsi::Strlen(text)));
+	}
+}
+
+DEFINE_SPEC(
+	FMcroYaml_Spec,
+	TEXT_"Mcro.Yaml",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroYaml_Spec::Define()
+{
+	Describe(TEXT_"Reflected structs", [this]
+	{
+		It(TEXT_"should round-trip every kind of property", [this]
+		{
+			const FYamlTestRow row = MakeTestRow();
+			YAML::Emitter out;
+			out << AsYaml(row);
+
+			FYamlTestRow parsed;
+			TestTrue(TEXT_"Deserialized", DeserializeStruct(YAML::Load(out.c_str()), parsed));
+			TestEqual(TEXT_"Bool", parsed.bFlag, row.bFlag);
+			TestEqual(TEXT_"Byte", parsed.Byte, row.Byte);
+			TestEqual(TEXT_"Int64", parsed.Large, row.Large);
+			TestEqual(TEXT_"Float", parsed.Single, row.Single);
+			TestEqual(TEXT_"Double", parsed.Precise, row.Precise);
+			TestEqualSensitive(TEXT_"String", parsed.String, row.String);
+			TestEqual(TEXT_"Name", parsed.Name, row.Name);
+			TestEqualSensitive(TEXT_"Text", parsed.Text.ToString(), row.Text.ToString());
+			TestTrue(TEXT_"Enum", parsed.Enum == row.Enum);
+			TestEqual(TEXT_"Nested engine struct", parsed.Vector, row.Vector);
+			TestEqual(TEXT_"Nested struct", parsed.Inner.Number, 7);
+			TestEqual(TEXT_"Array of structs", parsed.Children.Num(), 2);
+			TestEqualSensitive(TEXT_"Array of structs content", parsed.Children[1].Label, TEXT_"B");
+			TestEqual(TEXT_"Array", parsed.Numbers, row.Numbers);
+			TestEqual(TEXT_"Static array", parsed.Fixed[1], 9);
+			TestEqual(TEXT_"Exported map", parsed.Exported.FindRef(TEXT_"Key"), 3);
+			TestEqual(TEXT_"Transient property is skipped", parsed.Transient, 0);
+			TestFalse(TEXT_"Transient property is not written", FString(out.c_str()).Contains(TEXT_"Transient"));
+		});
+		It(TEXT_"should keep missing properties and report invalid ones", [this]
+		{
+			FYamlTestRow row;
+			row.Numbers = { 1 };
+			TestTrue(TEXT_"Partial", DeserializeStruct(YAML::Load("{ Byte: 12 }"), row));
+			TestEqual(TEXT_"Read", row.Byte, 12);
+			TestEqual(TEXT_"Untouched", row.Numbers.Num(), 1);
+
+			TestFalse(TEXT_"Out of range", DeserializeStruct(YAML::Load("{ Byte: 300 }"), row));
+			TestFalse(TEXT_"Unknown enum", DeserializeStruct(YAML::Load("{ Enum: Fourth }"), row));
+		});
+		It(TEXT_"should serialize many rows with the same plan", [this]
+		{
+			TArray<FYamlTestRow> rows;
+			rows.Init(MakeTestRow(), 1000);
+
+			YAML::Emitter out;
+			{
+				FSeq seq(out);
+				for (auto const& row : rows) out << AsYaml(row);
+			}
+			YAML::Node parsed = YAML::Load(out.c_str());
+			TestEqual(TEXT_"Rows", static_cast<int32>(parsed.size()), 1000);
+			TestEqual(TEXT_"Content", parsed[999]["Inner"]["Label"].as<std::string>(), std::string("Inner"));
+		});
+	});
+	Describe(TEXT_"Memory-mapped documents", [this]
+	{
+		It(TEXT_"should parse block and flow collections", [this]
+		{
+			auto document = ParseYaml(
+				"# Items\n"
+				"Name: Sword\n"
+				"Tags: [sharp, 'two handed', \"rare\"]\n"
+				"Stats: { Damage: 12, Weight: 3.5 }\n"
+				"Upgrades:\n"
+				"- Level: 1\n"
+				"  Cost: 0x20\n"
+				"-   Level: 2\n"
+				"    Cost: 64 # comment\n"
+				"Empty:\n"
+				"Nested:\n"
+				"  Deeper:\n"
+				"    - - a\n"
+				"      - b\n"
+			);
+			if (!TestFalse(TEXT_"Parsed", document.HasError())) return;
+
+			FMappedYamlNode root = document.GetValue()->GetRoot();
+			TestTrue(TEXT_"Root is a map", root.IsMap());
+			TestEqual(TEXT_"Root entries", root.Num(), 6);
+			TestEqualSensitive(TEXT_"Plain scalar", root["Name"].AsString(), TEXT_"Sword");
+			TestEqual(TEXT_"Flow sequence", root["Tags"].Num(), 3);
+			TestEqualSensitive(TEXT_"Single quoted", root["Tags"][1].AsString(), TEXT_"two handed");
+			TestEqualSensitive(TEXT_"Double quoted", root["Tags"][2].AsString(), TEXT_"rare");
+			TestEqual(TEXT_"Flow map", root["Stats"]["Damage"].AsInt().Get(0), 12ll);
+			TestEqual(TEXT_"Double", root["Stats"]["Weight"].AsDouble().Get(0), 3.5);
+			TestEqual(TEXT_"Block sequence", root["Upgrades"].Num(), 2);
+			TestEqual(TEXT_"Hexadecimal", root["Upgrades"][0]["Cost"].AsInt().Get(0), 32ll);
+			TestEqual(TEXT_"Compact map", root["Upgrades"][1]["Cost"].AsInt().Get(0), 64ll);
+			TestEqual(TEXT_"Line", root["Upgrades"][1].GetLine(), 8);
+			TestTrue(TEXT_"Null", root["Empty"].IsNull());
+			TestFalse(TEXT_"Missing key", root["Missing"].IsValid());
+			TestEqualSensitive(TEXT_"Nested sequences", root["Nested"]["Deeper"][0][1].AsString(), TEXT_"b");
+
+			TArray<FString> keys;
+			for (auto it = root.begin(); it != root.end(); ++it)
+				keys.Add(it.Key().AsString());
+			TestEqual(TEXT_"Ordered keys", keys[3], FString(TEXT_"Upgrades"));
+		});
+		It(TEXT_"should reference the source for scalars which don't need decoding", [this]
+		{
+			TArray<uint8> source;
+			const ANSICHAR* text = "plain: value\nquoted: 'simple'\nescaped: \"tab\\there\"\n";
+			source.Append(reinterpret_cast<const uint8*>(text), FCStringAnsi::Strlen(text));
+			const uint8* begin = source.GetData();
+			const uint8* end = begin + source.Num();
+
+			auto document = FMappedYamlDocument::Parse(MoveTemp(source));
+			if (!TestFalse(TEXT_"Parsed", document.HasError())) return;
+			FMappedYamlNode root = document.GetValue()->GetRoot();
+
+			auto isInSource = [&](FMappedYamlNode const& node)
+			{
+				auto data = reinterpret_cast<const uint8*>(node.GetScalar().GetData());
+				return data >= begin && data < end;
+			};
+			TestTrue(TEXT_"Plain scalar is a view", isInSource(root["plain"]));
+			TestTrue(TEXT_"Quoted scalar is a view", isInSource(root["quoted"]));
+			TestFalse(TEXT_"Escaped scalar is decoded", isInSource(root["escaped"]));
+			TestEqualSensitive(TEXT_"Escaped content", root["escaped"].AsString(), TEXT_"tab\there");
+		});
+		It(TEXT_"should decode quoted and block scalars", [this]
+		{
+			auto document = ParseYaml(
+				"single: 'it''s'\n"
+				"unicode: \"\\u00DCber \\U0001F600\"\n"
+				"folded quote: \"one\n"
+				"  two\n"
+				"\n"
+				"  three\"\n"
+				"literal: |\n"
+				"  line 1\n"
+				"    line 2\n"
+				"\n"
+				"folded: >-\n"
+				"  joined\n"
+				"  words\n"
+				"\n"
+				"  paragraph\n"
+				"kept: |+\n"
+				"  text\n"
+				"\n"
+			);
+			if (!TestFalse(TEXT_"Parsed", document.HasError())) return;
+			FMappedYamlNode root = document.GetValue()->GetRoot();
+
+			TestEqualSensitive(TEXT_"Single quote escape", root["single"].AsString(), TEXT_"it's");
+			TestEqualSensitive(TEXT_"Unicode escapes", root["unicode"].AsString(), FString(TEXT_"\u00DCber ") + FString(UTF8_TO_TCHAR("\xF0\x9F\x98\x80")));
+			TestEqualSensitive(TEXT_"Quoted line folding", root["folded quote"].AsString(), TEXT_"one two\nthree");
+			TestEqualSensitive(TEXT_"Literal", root["literal"].AsString(), TEXT_"line 1\n  line 2\n");
+			TestEqualSensitive(TEXT_"Folded", root["folded"].AsString(), TEXT_"joined words\nparagraph");
+			TestEqualSensitive(TEXT_"Keep chomping", root["kept"].AsString(), TEXT_"text\n\n");
+		});
+		It(TEXT_"should fold multi-line plain scalars", [this]
+		{
+			auto document = ParseYaml(
+				"plain: first\n"
+				"  second\n"
+				"\n"
+				"  third # comment\n"
+				"items:\n"
+				"  - one\n"
+				"    two\n"
+				"  - three\n"
+				"flow: [a\n  b, c]\n"
+				"next: 1\n"
+			);
+			if (!TestFalse(TEXT_"Parsed", document.HasError())) return;
+			FMappedYamlNode root = document.GetValue()->GetRoot();
+
+			TestEqualSensitive(TEXT_"Folded plain", root["plain"].AsString(), TEXT_"first second\nthird");
+			TestEqualSensitive(TEXT_"Sequence item", root["items"][0].AsString(), TEXT_"one two");
+			TestEqualSensitive(TEXT_"Next item", root["items"][1].AsString(), TEXT_"three");
+			TestEqualSensitive(TEXT_"Flow item", root["flow"][0].AsString(), TEXT_"a b");
+			TestEqual(TEXT_"Following key", root["next"].AsInt().Get(0), 1ll);
+
+			TArray<FString> items;
+			for (FMappedYamlNode item : document.GetValue()->GetRoot()["items"])
+				items.Add(item.AsString());
+			TestEqual(TEXT_"Iterating a temporary node", items, TArray<FString> { TEXT_"one two", TEXT_"three" });
+		});
+		It(TEXT_"should convert scalars", [this]
+		{
+			auto document = ParseYaml("[true, off, -42, 0o17, 1e3, -.inf, ~, 'null', Name, nope, 99999999999999999999]");
+			if (!TestFalse(TEXT_"Parsed", document.HasError())) return;
+			FMappedYamlNode root = document.GetValue()->GetRoot();
+
+			TestEqual(TEXT_"True", root[0].AsBool().Get(false), true);
+			TestEqual(TEXT_"Off", root[1].AsBool().Get(true), false);
+			TestEqual(TEXT_"Negative", root[2].AsInt().Get(0), -42ll);
+			TestEqual(TEXT_"Octal", root[3].AsInt().Get(0), 15ll);
+			TestEqual(TEXT_"Exponent", root[4].AsDouble().Get(0), 1000.0);
+			TestTrue(TEXT_"Infinity", root[5].AsDouble().Get(0) < -1e300);
+			TestTrue(TEXT_"Tilde is null", root[6].IsNull());
+			TestFalse(TEXT_"Quoted null is a string", root[7].IsNull());
+			TestEqual(TEXT_"Name", root[8].AsName(), FName(TEXT_"Name"));
+			TestFalse(TEXT_"Not a bool", root[9].AsBool().IsSet());
+			TestFalse(TEXT_"Integer overflow", root[10].AsInt().IsSet());
+			TestFalse(TEXT_"Not a number", root[9].AsDouble().IsSet());
+		});
+		It(TEXT_"should report syntax errors with their line", [this]
+		{
+			auto unterminated = ParseYaml("a: 1\nb: [1, 2\n");
+			TestTrue(TEXT_"Unterminated flow", unterminated.HasError());
+
+			auto indentation = ParseYaml("a:\n  b: 1\n   c: 2\n");
+			if (TestTrue(TEXT_"Bad indentation", indentation.HasError()))
+				TestTrue(TEXT_"Line", indentation.GetErrorRef()->GetMessage().Contains(TEXT_"line 3"));
+
+			TestTrue(TEXT_"Anchors", ParseYaml("a: &anchor 1\n").HasError());
+			TestTrue(TEXT_"Tabs", ParseYaml("a:\n\tb: 1\n").HasError());
+		});
+		It(TEXT_"should memory-map files", [this]
+		{
+			const FString path = FPaths::AutomationTransientDir() / TEXT_"McroMappedYaml.yaml";
+			if (!TestTrue(TEXT_"Written", FFileHelper::SaveStringToFile(TEXT_"Items:\n- Ünicode\n- Second\n", *path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)))
+				return;
+
+			{
+				auto document = FMappedYamlDocument::Load(path);
+				if (TestFalse(TEXT_"Loaded", document.HasError()))
+				{
+					FMappedYamlNode items = document.GetValue()->GetRoot()["Items"];
+					TestEqual(TEXT_"Items", items.Num(), 2);
+					TestEqualSensitive(TEXT_"Unicode", items[0].AsString(), TEXT_"Ünicode");
+				}
+			}
+			IFileManager::Get().Delete(*path);
+
+			TestTrue(TEXT_"Missing file", FMappedYamlDocument::Load(path).HasError());
+		});
+		It(TEXT_"should parse multi-document streams in order", [this]
+		{
+			// Big enough to be parsed in parallel
+			FString stream = TEXT_"# Leading comment\nFirst: 0\n";
+			for (int32 i = 1; i < 2000; ++i)
+			{
+				stream.Appendf(TEXT_"--- # Document %d\nIndex: %d\nItems: [a, b, c]\nText: 'document number %d'\n", i, i, i);
+				if (i % 100 == 0) stream += TEXT_"...\n# Comment between documents\n";
+			}
+
+			FTCHARToUTF8 utf8(*stream);
+			auto documents = FMappedYamlDocument::ParseAll(TArray<uint8>(reinterpret_cast<const uint8*>(utf8.Get()), utf8.Length()));
+			if (!TestFalse(TEXT_"Parsed", documents.HasError())) return;
+
+			auto const& parsed = documents.GetValue();
+			if (!TestEqual(TEXT_"Documents", parsed.Num(), 2000)) return;
+			TestEqual(TEXT_"Implicit first document", parsed[0]->GetRoot()["First"].AsInt().Get(-1), 0ll);
+
+			bool ordered = true;
+			for (int32 i = 1; i < parsed.Num(); ++i)
+				ordered &= parsed[i]->GetRoot()["Index"].AsInt().Get(-1) == i;
+			TestTrue(TEXT_"Ordered", ordered);
+			TestEqualSensitive(TEXT_"Content", parsed[1234]->GetRoot()["Text"].AsString(), TEXT_"document number 1234");
+			TestEqual(TEXT_"Lines are counted from the start of the stream", parsed[1]->GetRoot()["Index"].GetLine(), 4);
+
+			auto broken = FMappedYamlDocument::ParseAll(TArray<uint8>(reinterpret_cast<const uint8*>("a: 1\n---\nb: [\n---\nc: 3\n"), 23));
+			if (TestTrue(TEXT_"Error in a document", broken.HasError()))
+				TestTrue(TEXT_"Error line", broken.GetErrorRef()->GetMessage().Contains(TEXT_"line 3"));
+		});
+		It(TEXT_"should read back unchanged files from the binary cache", [this]
+		{
+			const FString directory = FPaths::AutomationTransientDir() / TEXT_"McroYamlCache";
+			const FString path = directory / TEXT_"Cached.yaml";
+			const FString cacheDirectory = directory / TEXT_"Cache";
+			IFileManager::Get().DeleteDirectory(*directory, false, true);
+
+			auto writeAndLoad = [&](const TCHAR* contents)
+			{
+				FFileHelper::SaveStringToFile(contents, *path, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+				return FMappedYamlDocument::LoadCached(path, cacheDirectory);
+			};
+
+			auto parsed = writeAndLoad(TEXT_"Name: plain\nEscaped: \"a\\tb\"\nList: [1, 2]\n");
+			auto cached = writeAndLoad(TEXT_"Name: plain\nEscaped: \"a\\tb\"\nList: [1, 2]\n");
+			if (TestFalse(TEXT_"Parsed", parsed.HasError()) && TestFalse(TEXT_"Cached", cached.HasError()))
+			{
+				TestFalse(TEXT_"First load parses", parsed.GetValue()->IsFromCache());
+				TestTrue(TEXT_"Second load uses the cache", cached.GetValue()->IsFromCache());
+
+				FMappedYamlNode root = cached.GetValue()->GetRoot();
+				TestEqual(TEXT_"Node count", cached.GetValue()->NumNodes(), parsed.GetValue()->NumNodes());
+				TestEqualSensitive(TEXT_"Source scalar", root["Name"].AsString(), TEXT_"plain");
+				TestEqualSensitive(TEXT_"Decoded scalar", root["Escaped"].AsString(), TEXT_"a\tb");
+				TestEqual(TEXT_"Collection", root["List"][1].AsInt().Get(0), 2ll);
+				TestEqual(TEXT_"Line", root["List"].GetLine(), 3);
+			}
+
+			auto changed = writeAndLoad(TEXT_"Name: changed\n");
+			if (TestFalse(TEXT_"Changed", changed.HasError()))
+			{
+				TestFalse(TEXT_"Changed contents are parsed", changed.GetValue()->IsFromCache());
+				TestEqualSensitive(TEXT_"Changed scalar", changed.GetValue()->GetRoot()["Name"].AsString(), TEXT_"changed");
+			}
+
+			// Make every child refer to the root in the cached tree of the last contents
+			TArray<FString> cacheFiles;
+			IFileManager::Get().FindFiles(cacheFiles, *(cacheDirectory / TEXT_"*.ymlc"), true, false);
+			for (FString const& file : cacheFiles)
+			{
+				TArray<uint8> cache;
+				FFileHelper::LoadFileToArray(cache, *(cacheDirectory / file));
+
+				// Header: magic, version, hash, size, node count, child count, decoded size, root. Nodes are 24 bytes.
+				int32 nodeCount, childCount, root;
+				FMemory::Memcpy(&nodeCount, cache.GetData() + 24, sizeof(int32));
+				FMemory::Memcpy(&childCount, cache.GetData() + 28, sizeof(int32));
+				FMemory::Memcpy(&root, cache.GetData() + 36, sizeof(int32));
+				for (int32 i = 0; i < childCount; ++i)
+					FMemory::Memcpy(cache.GetData() + 40 + nodeCount * 24 + i * sizeof(int32), &root, sizeof(int32));
+				FFileHelper::SaveArrayToFile(cache, *(cacheDirectory / file));
+			}
+			auto cyclic = FMappedYamlDocument::LoadCached(path, cacheDirectory);
+			if (TestFalse(TEXT_"Cyclic cache", cyclic.HasError()))
+				TestFalse(TEXT_"Cyclic cached tree is rejected", cyclic.GetValue()->IsFromCache());
+
+			IFileManager::Get().DeleteDirectory(*directory, false, true);
+		});
+	});
+
+	Describe(TEXT_"Ranges", [this]
+	{
+		It(TEXT_"should emit views as sequences and tuple views as maps", [this]
+		{
+			TArray<FString> names { TEXT_"A", TEXT_"B" };
+			YAML::Emitter out;
+			{
+				FMap map(out);
+				out << YAML::Key << "Squares" << YAML::Value
+					<< (views::ints(1, 4) | views::transform([](int32 i) { return i * i; }));
+				out << YAML::Key << "Indices" << YAML::Value << views::zip(names, views::ints(0, 2));
+				out << YAML::Key << "Tuples" << YAML::Value
+					<< (views::ints(0, 2) | views::transform([](int32 i) { return MakeTuple(i, TEXT_"x", i * 2); }));
+			}
+
+			YAML::Emitter expected;
+			expected << YAML::BeginMap
+				<< YAML::Key << "Squares" << YAML::Value << YAML::BeginSeq << 1 << 4 << 9 << YAML::EndSeq
+				<< YAML::Key << "Indices" << YAML::Value << YAML::BeginMap
+					<< YAML::Key << "A" << YAML::Value << 0
+					<< YAML::Key << "B" << YAML::Value << 1
+				<< YAML::EndMap
+				<< YAML::Key << "Tuples" << YAML::Value << YAML::BeginSeq
+					<< YAML::Flow << YAML::BeginSeq << 0 << "x" << 0 << YAML::EndSeq
+					<< YAML::Flow << YAML::BeginSeq << 1 << "x" << 2 << YAML::EndSeq
+				<< YAML::EndSeq
+			<< YAML::EndMap;
+
+			TestEqual(TEXT_"Emitted", FString(UTF8_TO_TCHAR(out.c_str())), FString(UTF8_TO_TCHAR(expected.c_str())));
+		});
+		It(TEXT_"should flatten elements and entries into open regions", [this]
+		{
+			TMap<FString, int32> weights { { TEXT_"Light", 1 }, { TEXT_"Heavy", 10 } };
+			YAML::Emitter out;
+			{
+				FMap map(out);
+				out << YAML::Key << "Version" << YAML::Value << 2;
+				out << Entries(weights);
+			}
+			{
+				FSeq seq(out);
+				out << Elements(views::ints(0, 3)) << 3;
+			}
+
+			YAML::Emitter expected;
+			expected << YAML::BeginMap << YAML::Key << "Version" << YAML::Value << 2;
+			for (auto const& [key, value] : weights)
+				expected << YAML::Key << StdConvert<ANSICHAR>(key) << YAML::Value << value;
+			expected << YAML::EndMap << YAML::BeginSeq << 0 << 1 << 2 << 3 << YAML::EndSeq;
+
+			TestEqual(TEXT_"Emitted", FString(UTF8_TO_TCHAR(out.c_str())), FString(UTF8_TO_TCHAR(expected.c_str())));
+		});
+	});
+}
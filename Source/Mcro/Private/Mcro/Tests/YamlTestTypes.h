@@ -0,0 +1,60 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "YamlTestTypes.generated.h"
+
+UENUM()
+enum class EYamlTestEnum : uint8
+{
+	First,
+	Second,
+	Third
+};
+
+USTRUCT()
+struct FYamlTestInner
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Number = 0;
+
+	UPROPERTY()
+	FString Label;
+};
+
+USTRUCT()
+struct FYamlTestRow
+{
+	GENERATED_BODY()
+
+	UPROPERTY() bool bFlag = false;
+	UPROPERTY() uint8 Byte = 0;
+	UPROPERTY() int64 Large = 0;
+	UPROPERTY() float Single = 0;
+	UPROPERTY() double Precise = 0;
+	UPROPERTY() FString String;
+	UPROPERTY() FName Name;
+	UPROPERTY() FText Text;
+	UPROPERTY() EYamlTestEnum Enum = EYamlTestEnum::First;
+	UPROPERTY() FVector Vector = FVector::ZeroVector;
+	UPROPERTY() FYamlTestInner Inner;
+	UPROPERTY() TArray<FYamlTestInner> Children;
+	UPROPERTY() TArray<int32> Numbers;
+	UPROPERTY() int32 Fixed[3] = { 0, 0, 0 };
+	UPROPERTY() TMap<FString, int32> Exported;
+	UPROPERTY(Transient) int32 Transient = 0;
+};
@@ -12,6 +12,7 @@
 #include "Mcro/Text.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/SharedObjects.h"
+#include "Mcro/Hash.h"
 
 namespace Mcro::Text
 {
@@ -23,17 +24,74 @@ namespace Mcro::Text
 		return FString(stdStr.data(), stdStr.size());
 	}
 
+	namespace Detail
+	{
+		namespace
+		{
+			struct FCachedName
+			{
+				uint64 Hash = 0;
+				FTypeHash CharType = 0;
+				TArray<uint8> Key;
+				FName Name;
+			};
+
+			// Power of two. Entries own a copy of their key, so it's kept small to not bloat every converting thread.
+			constexpr int32 NameCacheSize = 512;
+
+			// Longer strings are rarely hot identifiers, they go to the name table directly
+			constexpr int32 MaxCachedNameBytes = 256;
+		}
+
+		FName FindOrAddCachedName(const void* data, int32 size, FTypeHash charType, TFunctionRef<FName()> makeName)
+		{
+			if (size > MaxCachedNameBytes) return makeName();
+
+			thread_local TArray<FCachedName> cache;
+			if (cache.IsEmpty()) [[unlikely]]
+				cache.SetNum(NameCacheSize);
+
+			const uint64 hash = Hash::HashBytes(data, size) ^ charType;
+			FCachedName& entry = cache[hash & (NameCacheSize - 1)];
+			if (entry.Hash == hash
+				&& entry.CharType == charType
+				&& entry.Key.Num() == size
+				&& FMemory::Memcmp(entry.Key.GetData(), data, size) == 0
+			) [[likely]]
+				return entry.Name;
+
+			entry.Hash = hash;
+			entry.CharType = charType;
+			entry.Key.Reset();
+			entry.Key.Append(static_cast<const uint8*>(data), size);
+			entry.Name = makeName();
+			return entry.Name;
+		}
+	}
+
 	FName UnrealNameCopy(FStdStringView const& stdStr)
 	{
-		return FName(stdStr.length(), stdStr.data());
+		return Detail::FindOrAddCachedName(
+			stdStr.data(), static_cast<int32>(stdStr.length() * sizeof(TCHAR)),
+			GetCompileTimeTypeHash<TCHAR>(),
+			[&] { return FName(stdStr.length(), stdStr.data()); }
+		);
 	}
 	FName UnrealNameConvert(std::string_view const& stdStr)
 	{
-		return FName(stdStr.length(), stdStr.data());
+		return Detail::FindOrAddCachedName(
+			stdStr.data(), static_cast<int32>(stdStr.length()),
+			GetCompileTimeTypeHash<char>(),
+			[&] { return FName(stdStr.length(), stdStr.data()); }
+		);
 	}
 	FName UnrealNameConvert(std::wstring_view const& stdStr)
 	{
-		return FName(stdStr.length(), stdStr.data());
+		return Detail::FindOrAddCachedName(
+			stdStr.data(), static_cast<int32>(stdStr.length() * sizeof(wchar_t)),
+			GetCompileTimeTypeHash<wchar_t>(),
+			[&] { return FName(stdStr.length(), stdStr.data()); }
+		);
 	}
 
 	FStdString StdCopy(const FStringView& unrealStr)
@@ -46,37 +104,93 @@ namespace Mcro::Text
 		return StdCopy(unrealStr.ToString());
 	}
 
-	FString DynamicPrintf(const TCHAR* fmt, ...)
+	namespace
 	{
-		int32  BufferSize     = 512;
-		TCHAR  StartingBuffer  [512];
-		TCHAR* Buffer         = StartingBuffer;
-		int32  Result         = -1;
+		constexpr int32 InitialPrintfBufferSize = 512;
 
-		// First try to print to a stack allocated location 
-		GET_TYPED_VARARGS_RESULT( TCHAR, Buffer, BufferSize, BufferSize-1, fmt, fmt, Result );
+		// Scratch buffers above this size are released after use, so a single huge string doesn't pin memory per thread
+		constexpr int32 MaxRetainedPrintfBufferSize = 64 * 1024;
 
-		// If that fails, start allocating regular memory
-		if( Result == -1 )
+		/** @return Number of characters the format would produce, or -1 when that cannot be measured on this platform */
+		int32 MeasureVarArgs(const TCHAR* fmt, va_list args)
 		{
-			Buffer = nullptr;
-			while(Result == -1)
-			{
-				BufferSize *= 2;
-				Buffer = (TCHAR*) FMemory::Realloc( Buffer, BufferSize * sizeof(TCHAR) );
-				GET_TYPED_VARARGS_RESULT( TCHAR, Buffer, BufferSize, BufferSize-1, fmt, fmt, Result );
-			};
+#if PLATFORM_WINDOWS && !PLATFORM_TCHAR_IS_UTF8CHAR
+			va_list measureArgs;
+			va_copy(measureArgs, args);
+			const int32 result = _vscwprintf(fmt, measureArgs);
+			va_end(measureArgs);
+			return result;
+#else
+			return -1;
+#endif
 		}
 
-		Buffer[Result] = CHARTEXT(TCHAR, '\0');
+		/**
+		 *	Format into a character array starting at `offset`, growing it when the output doesn't fit. The output is
+		 *	null-terminated, the number of characters without the terminator is returned.
+		 */
+		int32 FormatVarArgs(TArray<TCHAR>& buffer, int32 offset, int32 measured, const TCHAR* fmt, va_list args)
+		{
+			const int32 required = offset + (measured >= 0 ? measured + 1 : InitialPrintfBufferSize);
+			if (buffer.Num() < required)
+				buffer.SetNumUninitialized(required, EAllowShrinking::No);
+
+			for (;;)
+			{
+				va_list formatArgs;
+				va_copy(formatArgs, args);
+				const TCHAR* format = fmt;
+				const int32 capacity = buffer.Num() - offset;
+				const int32 result = FCString::GetVarArgs(buffer.GetData() + offset, capacity, format, formatArgs);
+				va_end(formatArgs);
 
-		FString ResultString(Buffer);
+				if (result >= 0 && result < capacity)
+				{
+					buffer[offset + result] = CHARTEXT(TCHAR, '\0');
+					return result;
+				}
+				buffer.SetNumUninitialized(offset + capacity * 2, EAllowShrinking::No);
+			}
+		}
 
-		if( BufferSize != 512 )
+		void AppendVarArgs(FString& output, const TCHAR* fmt, va_list args)
 		{
-			FMemory::Free( Buffer );
+			const int32 measured = MeasureVarArgs(fmt, args);
+			if (measured >= 0)
+			{
+				// Size is known up-front, format directly into the storage of the output string in a single pass
+				TArray<TCHAR>& chars = output.GetCharArray();
+				const int32 start = output.Len();
+				const int32 written = FormatVarArgs(chars, start, measured, fmt, args);
+				chars.SetNum(start + written + 1, EAllowShrinking::No);
+				return;
+			}
+
+			// Otherwise use a scratch buffer retaining its size across calls, so only the first long string on a given
+			// thread needs multiple passes
+			thread_local TArray<TCHAR> scratch;
+			const int32 written = FormatVarArgs(scratch, 0, INDEX_NONE, fmt, args);
+			output.AppendChars(scratch.GetData(), written);
+			if (scratch.Num() > MaxRetainedPrintfBufferSize)
+				scratch.Empty();
 		}
+	}
 
-		return ResultString;
+	FString DynamicPrintf(const TCHAR* fmt, ...)
+	{
+		FString result;
+		va_list args;
+		va_start(args, fmt);
+		AppendVarArgs(result, fmt, args);
+		va_end(args);
+		return result;
+	}
+
+	void DynamicPrintfTo(FString& output, const TCHAR* fmt, ...)
+	{
+		va_list args;
+		va_start(args, fmt);
+		AppendVarArgs(output, fmt, args);
+		va_end(args);
 	}
 }
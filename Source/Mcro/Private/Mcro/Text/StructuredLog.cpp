@@ -0,0 +1,996 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Text/StructuredLog.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+
+#include <atomic>
+
+static TAutoConsoleVariable<bool> CVarStructuredLogTextOutput(
+	TEXT_"Mcro.StructuredLog.TextOutput", true,
+	TEXT_"Send messages of MCRO_SLOG to the regular log. The binary structured log is not affected by this.",
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* cvar)
+	{
+		Mcro::Text::SetStructuredLogTextOutput(cvar->GetBool());
+	}),
+	ECVF_Default
+);
+
+namespace Mcro::Text
+{
+	using namespace Mcro::Error;
+	using namespace Mcro::Text::Detail;
+
+	namespace
+	{
+		constexpr uint32 BinaryMagic = 0x474C534D; // "MSLG"
+		constexpr uint32 BinaryVersion = 1;
+
+		enum class EBinaryEntry : uint8
+		{
+			Site = 1,
+			Message = 2
+		};
+
+		/** @brief Precedes each record in the ring buffers, a record with a SiteId of 0 is padding before wrapping */
+		struct FRecordHeader
+		{
+			uint32 Size;
+			uint32 SiteId;
+			uint64 Cycles;
+			uint32 ArgumentBytes;
+			uint32 ThreadId;
+		};
+
+		constexpr uint32 RingCapacity = 16 * 1024;
+		constexpr uint64 RingMask = RingCapacity - 1;
+		static_assert(FMath::IsPowerOfTwo(RingCapacity));
+
+		/** @brief Records are never larger than this so a full ring can still carry a couple of them */
+		constexpr uint32 MaxRecordSize = RingCapacity / 4;
+
+		/** @brief Threads beyond this many concurrently logging ones log synchronously */
+		constexpr int32 MaxRings = 256;
+
+		constexpr uint32 SiteChunkSize = 256;
+		constexpr uint32 MaxSiteChunks = 256;
+
+		constexpr int32 CrashLineCapacity = 1024;
+		constexpr int32 MaxCrashArguments = 16;
+
+		/** @brief Single producer (the owning thread), single consumer (whoever holds the drain lock) byte ring */
+		struct FThreadRing
+		{
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Head { 0 };
+			uint64 PendingHead = 0;
+			std::atomic<bool> bWakeRequested { false };
+			uint32 ThreadId = 0;
+
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Tail { 0 };
+
+			/** @brief The owning thread has exited, the ring can be given to a new thread once it's drained */
+			std::atomic<bool> bOrphaned { false };
+
+			alignas(PLATFORM_CACHE_LINE_SIZE) uint8 Data[RingCapacity];
+		};
+
+		/**
+		 *	@brief
+		 *	Copy of an FStructuredLogSite, so messages can still be formatted after the module of their call site has
+		 *	been unloaded.
+		 */
+		struct FRegisteredSite
+		{
+			FString Format;
+			FName Category;
+			FString CategoryName;
+			ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+			FString File;
+			int32 Line = 0;
+			uint32 Id = 0;
+		};
+
+		struct FPendingMessage
+		{
+			const FRegisteredSite* Site;
+			uint64 Cycles;
+			uint32 ThreadId;
+			FStringFormatOrderedArguments Arguments;
+		};
+
+		/** @brief Line buffer of the crash dump, so it doesn't need stack or heap while the process is going down */
+		TCHAR GCrashLine[CrashLineCapacity];
+
+		/** @brief Fills a fixed size line buffer, silently truncating what doesn't fit */
+		struct FCrashLineWriter
+		{
+			TCHAR* Line;
+			int32 Length = 0;
+
+			void Append(const TCHAR* text, int32 length)
+			{
+				length = FMath::Min(length, CrashLineCapacity - 2 - Length);
+				if (length <= 0) return;
+				FMemory::Memcpy(Line + Length, text, length * sizeof(TCHAR));
+				Length += length;
+			}
+
+			void Append(const ANSICHAR* text, int32 length)
+			{
+				length = FMath::Min(length, CrashLineCapacity - 2 - Length);
+				for (int32 i = 0; i < length; ++i)
+					Line[Length++] = static_cast<TCHAR>(text[i]);
+			}
+
+			template <typename Format, typename... Args>
+			void Appendf(Format const& format, Args... args)
+			{
+				const int32 remaining = CrashLineCapacity - 1 - Length;
+				if (remaining <= 0) return;
+				const int32 written = FCString::Snprintf(Line + Length, remaining, format, args...);
+				Length += FMath::Clamp(written, 0, remaining - 1);
+			}
+
+			const TCHAR* Finish()
+			{
+				Line[Length] = TCHAR('\n');
+				Line[Length + 1] = TCHAR(0);
+				return Line;
+			}
+		};
+
+		class FStructuredLog : public FRunnable
+		{
+		public:
+			bool IsStopped() const
+			{
+				return bStopped.load();
+			}
+
+			/** @return The id of the site, or 0 when there's no more room for new sites */
+			uint32 RegisterSite(FStructuredLogSite const& site)
+			{
+				FScopeLock lock(&SitesLock);
+				const uint32 index = NumSites.load(std::memory_order_relaxed);
+				const uint32 chunk = index / SiteChunkSize;
+				if (chunk >= MaxSiteChunks) return 0;
+
+				if (!SiteChunks[chunk].load(std::memory_order_relaxed))
+					SiteChunks[chunk].store(new FRegisteredSite[SiteChunkSize], std::memory_order_release);
+
+				FRegisteredSite& registered = SiteChunks[chunk].load(std::memory_order_relaxed)[index % SiteChunkSize];
+				registered.Format = site.Format;
+				registered.Category = site.Category;
+				registered.CategoryName = site.Category.ToString();
+				registered.Verbosity = site.Verbosity;
+				registered.File = site.File;
+				registered.Line = site.Line;
+				registered.Id = index + 1;
+
+				NumSites.store(index + 1, std::memory_order_release);
+				return index + 1;
+			}
+
+			/** @brief Doesn't lock, registered sites are never moved or modified */
+			const FRegisteredSite* FindSite(uint32 id) const
+			{
+				if (id == 0 || id > NumSites.load(std::memory_order_acquire)) return nullptr;
+				const uint32 index = id - 1;
+				return SiteChunks[index / SiteChunkSize].load(std::memory_order_acquire) + index % SiteChunkSize;
+			}
+
+			/** @return A ring buffer for the calling thread, or null when messages should be logged synchronously */
+			FThreadRing* CreateRing()
+			{
+				if (!FPlatformProcess::SupportsMultithreading()) return nullptr;
+
+				FScopeLock lock(&RingsLock);
+				if (bStopped) return nullptr;
+				if (!Thread)
+				{
+					WakeUp = FPlatformProcess::GetSynchEventFromPool();
+					Thread = FRunnableThread::Create(this, TEXT_"Mcro.StructuredLog", 0, TPri_BelowNormal);
+					if (!Thread)
+					{
+						FPlatformProcess::ReturnSynchEventToPool(WakeUp.exchange(nullptr));
+						bStopped = true;
+						return nullptr;
+					}
+				}
+
+				const uint32 threadId = FPlatformTLS::GetCurrentThreadId();
+				const int32 numRings = NumRings.load(std::memory_order_relaxed);
+				for (int32 i = 0; i < numRings; ++i)
+				{
+					FThreadRing* ring = Rings[i];
+					if (ring->bOrphaned.load(std::memory_order_acquire)
+						&& ring->Tail.load(std::memory_order_acquire) == ring->Head.load(std::memory_order_relaxed)
+					) {
+						ring->ThreadId = threadId;
+						ring->PendingHead = ring->Head.load(std::memory_order_relaxed);
+						ring->bOrphaned.store(false, std::memory_order_relaxed);
+						return ring;
+					}
+				}
+				if (numRings == MaxRings) return nullptr;
+
+				// Rings are never freed, so the crash dump can walk them without locking
+				FThreadRing* ring = new FThreadRing();
+				ring->ThreadId = threadId;
+				Rings[numRings] = ring;
+				NumRings.store(numRings + 1, std::memory_order_release);
+				return ring;
+			}
+
+			void RequestDrain()
+			{
+				if (FEvent* wakeUp = WakeUp.load(std::memory_order_acquire)) wakeUp->Trigger();
+			}
+
+			void Drain()
+			{
+				TArray<FPendingMessage> pending;
+
+				DrainLock.Lock();
+				const int32 numRings = NumRings.load(std::memory_order_acquire);
+				for (int32 i = 0; i < numRings; ++i)
+				{
+					FThreadRing* ring = Rings[i];
+					ForEachRecord(*ring, [&](FRecordHeader const& header, const uint8* arguments)
+					{
+						if (const FRegisteredSite* site = FindSite(header.SiteId))
+						{
+							FPendingMessage& message = pending.Add_GetRef({ site, header.Cycles, header.ThreadId, {} });
+							DecodeArguments(arguments, header.ArgumentBytes, message.Arguments);
+						}
+					});
+					ring->bWakeRequested.store(false, std::memory_order_relaxed);
+				}
+
+				// Formatting and writing the messages doesn't need to hold up other drains, but taking the emit lock
+				// before letting them collect keeps the batches in order.
+				EmitLock.Lock();
+				DrainLock.Unlock();
+
+				pending.StableSort([](FPendingMessage const& l, FPendingMessage const& r) { return l.Cycles < r.Cycles; });
+				for (FPendingMessage const& message : pending)
+					Emit(*message.Site, message.Cycles, message.ThreadId, message.Arguments);
+
+				{
+					FScopeLock binaryLock(&BinaryLock);
+					if (Binary) Binary->Flush();
+				}
+				EmitLock.Unlock();
+			}
+
+			/**
+			 *	@brief
+			 *	Write the messages which are still in the rings to FPlatformMisc::LowLevelOutputDebugString, without
+			 *	locking or allocating. Messages are only ordered within their own thread.
+			 */
+			void DumpLowLevel()
+			{
+				const int32 numRings = NumRings.load(std::memory_order_acquire);
+				if (numRings == 0) return;
+
+				FPlatformMisc::LowLevelOutputDebugString(TEXT_"MCRO structured log, messages not logged yet:\n");
+				for (int32 i = 0; i < numRings; ++i)
+				{
+					// The drain thread might have been stopped in the middle of reading, peek without consuming so
+					// at worst a message is printed twice
+					FThreadRing& ring = *Rings[i];
+					uint64 tail = ring.Tail.load(std::memory_order_acquire);
+					const uint64 head = ring.Head.load(std::memory_order_acquire);
+					PeekRecords(ring, tail, head, [&](FRecordHeader const& header, const uint8* arguments)
+					{
+						if (const FRegisteredSite* site = FindSite(header.SiteId))
+							FPlatformMisc::LowLevelOutputDebugString(FormatLowLevel(*site, header, arguments));
+					});
+				}
+			}
+
+			static void DecodeArguments(const uint8* data, uint32 bytes, FStringFormatOrderedArguments& output)
+			{
+				const uint8* end = data + bytes;
+				auto read = [&]<typename T>(T& value)
+				{
+					FMemory::Memcpy(&value, data, sizeof(T));
+					data += sizeof(T);
+				};
+				auto readString = [&]<typename Char>(TStringView<Char>& view)
+				{
+					int32 length;
+					read(length);
+					view = TStringView<Char>(reinterpret_cast<const Char*>(data), length);
+					data += length * sizeof(Char);
+				};
+				while (data < end)
+				{
+					const auto tag = static_cast<EStructuredLogArg>(*data++);
+					switch (tag)
+					{
+					case EStructuredLogArg::Int:    { int64 value;  read(value); output.Add(value); break; }
+					case EStructuredLogArg::UInt:   { uint64 value; read(value); output.Add(value); break; }
+					case EStructuredLogArg::Float:  { float value;  read(value); output.Add(value); break; }
+					case EStructuredLogArg::Double: { double value; read(value); output.Add(value); break; }
+					case EStructuredLogArg::String:
+						{
+							FStringView view;
+							readString(view);
+							output.Add(FString(view));
+							break;
+						}
+					case EStructuredLogArg::AnsiString:
+						{
+							FAnsiStringView view;
+							readString(view);
+							output.Add(FString(view));
+							break;
+						}
+					case EStructuredLogArg::Name:
+						{
+							FNameEntryId id;
+							int32 number;
+							read(id);
+							read(number);
+							output.Add(FName::CreateFromDisplayId(id, number).ToString());
+							break;
+						}
+					default:
+						return;
+					}
+				}
+			}
+
+			void Emit(
+				FRegisteredSite const& site,
+				uint64 cycles,
+				uint32 threadId,
+				FStringFormatOrderedArguments const& arguments
+			) {
+				const double time = FPlatformTime::ToSeconds64(cycles) - GStartTime;
+				if (bTextOutput.load(std::memory_order_relaxed) && GLog)
+				{
+					const FString message = FString::Format(*site.Format, arguments);
+					GLog->Serialize(*message, site.Verbosity, site.Category, time);
+				}
+
+				FScopeLock lock(&BinaryLock);
+				if (!Binary || site.Id == 0) return;
+
+				FArchive& archive = *Binary;
+				if (!WrittenSites.Contains(site.Id))
+				{
+					WrittenSites.Add(site.Id);
+					auto kind = static_cast<uint8>(EBinaryEntry::Site);
+					uint32 id = site.Id;
+					FString format = site.Format;
+					FString category = site.CategoryName;
+					uint8 verbosity = site.Verbosity;
+					FString file = site.File;
+					int32 line = site.Line;
+					archive << kind << id << format << category << verbosity << file << line;
+				}
+
+				auto kind = static_cast<uint8>(EBinaryEntry::Message);
+				uint32 id = site.Id;
+				double messageTime = time;
+				int32 count = arguments.Num();
+				archive << kind << id << messageTime << threadId << count;
+				for (FStringFormatArg const& argument : arguments)
+				{
+					auto type = static_cast<uint8>(argument.Type);
+					archive << type;
+					switch (argument.Type)
+					{
+					case FStringFormatArg::Int:    { int64 value = argument.IntValue; archive << value; break; }
+					case FStringFormatArg::UInt:   { uint64 value = argument.UIntValue; archive << value; break; }
+					case FStringFormatArg::Double: { double value = argument.DoubleValue; archive << value; break; }
+					default:
+						{
+							FString value = argument.StringValue;
+							archive << value;
+							break;
+						}
+					}
+				}
+			}
+
+			TMaybe<FString> StartBinary(FString const& path)
+			{
+				FString fullPath = path.IsEmpty()
+					? FPaths::ProjectLogDir() / FApp::GetProjectName() + TEXT_".mslog"
+					: path;
+
+				Drain();
+				FScopeLock lock(&BinaryLock);
+				Binary.Reset(IFileManager::Get().CreateFileWriter(*fullPath));
+				WrittenSites.Reset();
+				if (!Binary)
+				{
+					return IError::Make(new FAssertion())
+						->WithMessage(TEXT_"Couldn't open binary structured log for writing")
+						->WithAppendix(TEXT_"File", fullPath);
+				}
+				uint32 magic = BinaryMagic;
+				uint32 version = BinaryVersion;
+				*Binary << magic << version;
+				return fullPath;
+			}
+
+			void StopBinary()
+			{
+				Drain();
+				FScopeLock lock(&BinaryLock);
+				Binary.Reset();
+				WrittenSites.Reset();
+			}
+
+			void StopWorker()
+			{
+				FRunnableThread* thread;
+				{
+					FScopeLock lock(&RingsLock);
+					bStopped = true;
+					thread = Thread;
+					Thread = nullptr;
+				}
+				if (thread)
+				{
+					thread->Kill(true);
+					delete thread;
+					FPlatformProcess::ReturnSynchEventToPool(WakeUp.exchange(nullptr));
+				}
+				StopBinary();
+			}
+
+			virtual uint32 Run() override
+			{
+				while (!bStopping)
+				{
+					WakeUp.load()->Wait(FTimespan::FromMilliseconds(50));
+					Drain();
+				}
+				return 0;
+			}
+
+			virtual void Stop() override
+			{
+				bStopping = true;
+				WakeUp.load()->Trigger();
+			}
+
+			std::atomic<bool> bTextOutput { true };
+
+		private:
+			/** @brief Call onRecord for every record between tail and head, leaves tail at the end of the last one */
+			template <typename Function>
+			static void PeekRecords(FThreadRing const& ring, uint64& tail, uint64 head, Function&& onRecord)
+			{
+				while (tail < head)
+				{
+					const uint64 offset = tail & RingMask;
+					if (RingCapacity - offset < sizeof(FRecordHeader))
+					{
+						tail += RingCapacity - offset;
+						continue;
+					}
+					FRecordHeader header;
+					FMemory::Memcpy(&header, ring.Data + offset, sizeof(FRecordHeader));
+					if (header.Size == 0) return;
+					tail += header.Size;
+					if (header.SiteId != 0) onRecord(header, ring.Data + offset + sizeof(FRecordHeader));
+				}
+			}
+
+			/** @brief Consume every published record of a ring, the caller must hold the drain lock */
+			template <typename Function>
+			static void ForEachRecord(FThreadRing& ring, Function&& onRecord)
+			{
+				// Pairs with the sequentially consistent head store in EndStructuredLogRecord, see there
+				const uint64 head = ring.Head.load();
+				uint64 tail = ring.Tail.load(std::memory_order_relaxed);
+				PeekRecords(ring, tail, head, Forward<Function>(onRecord));
+				ring.Tail.store(tail, std::memory_order_release);
+			}
+
+			/** @brief Format a record into GCrashLine similarly to FString::Format, without allocating */
+			static const TCHAR* FormatLowLevel(
+				FRegisteredSite const& site,
+				FRecordHeader const& header,
+				const uint8* data
+			) {
+				// Find where each argument starts first, so they can be referred to in any order
+				const uint8* arguments[MaxCrashArguments];
+				int32 argumentCount = 0;
+				const uint8* end = data + header.ArgumentBytes;
+				for (const uint8* cursor = data; cursor < end && argumentCount < MaxCrashArguments;)
+				{
+					arguments[argumentCount++] = cursor;
+					int32 length = 0;
+					switch (static_cast<EStructuredLogArg>(*cursor++))
+					{
+					case EStructuredLogArg::Int:
+					case EStructuredLogArg::UInt:
+					case EStructuredLogArg::Double: cursor += sizeof(uint64); break;
+					case EStructuredLogArg::Float:  cursor += sizeof(float); break;
+					case EStructuredLogArg::Name:   cursor += sizeof(FNameEntryId) + sizeof(int32); break;
+					case EStructuredLogArg::String:
+						FMemory::Memcpy(&length, cursor, sizeof(int32));
+						cursor += sizeof(int32) + length * sizeof(TCHAR);
+						break;
+					case EStructuredLogArg::AnsiString:
+						FMemory::Memcpy(&length, cursor, sizeof(int32));
+						cursor += sizeof(int32) + length;
+						break;
+					default:
+						cursor = end;
+						--argumentCount;
+						break;
+					}
+				}
+
+				FCrashLineWriter writer { GCrashLine };
+				writer.Appendf(TEXT_"[%8u] ", header.ThreadId);
+				writer.Append(*site.CategoryName, site.CategoryName.Len());
+				writer.Append(TEXT_": ", 2);
+
+				const TCHAR* format = *site.Format;
+				while (*format)
+				{
+					int32 index = 0;
+					const TCHAR* digits = format + 1;
+					while (FChar::IsDigit(*digits)) index = index * 10 + (*digits++ - TCHAR('0'));
+
+					if (*format != TCHAR('{') || digits == format + 1 || *digits != TCHAR('}') || index >= argumentCount)
+					{
+						writer.Append(format++, 1);
+						continue;
+					}
+					format = digits + 1;
+					AppendLowLevel(writer, arguments[index]);
+				}
+				return writer.Finish();
+			}
+
+			static void AppendLowLevel(FCrashLineWriter& writer, const uint8* argument)
+			{
+				const auto tag = static_cast<EStructuredLogArg>(*argument++);
+				auto read = [&]<typename T>(T& value)
+				{
+					FMemory::Memcpy(&value, argument, sizeof(T));
+					argument += sizeof(T);
+				};
+				switch (tag)
+				{
+				case EStructuredLogArg::Int:    { int64 value;  read(value); writer.Appendf(TEXT_"%lld", value); break; }
+				case EStructuredLogArg::UInt:   { uint64 value; read(value); writer.Appendf(TEXT_"%llu", value); break; }
+				case EStructuredLogArg::Float:  { float value;  read(value); writer.Appendf(TEXT_"%g", value); break; }
+				case EStructuredLogArg::Double: { double value; read(value); writer.Appendf(TEXT_"%g", value); break; }
+				case EStructuredLogArg::String:
+					{
+						int32 length;
+						read(length);
+						writer.Append(reinterpret_cast<const TCHAR*>(argument), length);
+						break;
+					}
+				case EStructuredLogArg::AnsiString:
+					{
+						int32 length;
+						read(length);
+						writer.Append(reinterpret_cast<const ANSICHAR*>(argument), length);
+						break;
+					}
+				case EStructuredLogArg::Name:
+					{
+						FNameEntryId id;
+						int32 number;
+						read(id);
+						read(number);
+						if (const FNameEntry* entry = FName::GetEntry(id))
+						{
+							TCHAR name[NAME_SIZE];
+							entry->GetName(name);
+							writer.Append(name, FCString::Strlen(name));
+						}
+						if (number != NAME_NO_NUMBER_INTERNAL)
+							writer.Appendf(TEXT_"_%d", NAME_INTERNAL_TO_EXTERNAL(number));
+						break;
+					}
+				default:
+					break;
+				}
+			}
+
+			FCriticalSection SitesLock;
+			std::atomic<FRegisteredSite*> SiteChunks[MaxSiteChunks] {};
+			std::atomic<uint32> NumSites { 0 };
+
+			FCriticalSection RingsLock;
+			FThreadRing* Rings[MaxRings] {};
+			std::atomic<int32> NumRings { 0 };
+			FRunnableThread* Thread = nullptr;
+			std::atomic<FEvent*> WakeUp { nullptr };
+			std::atomic<bool> bStopped { false };
+			std::atomic<bool> bStopping { false };
+
+			FCriticalSection DrainLock;
+			FCriticalSection EmitLock;
+
+			FCriticalSection BinaryLock;
+			TUniquePtr<FArchive> Binary;
+			TSet<uint32> WrittenSites;
+		};
+
+		FStructuredLog& GetStructuredLog()
+		{
+			// Never destroyed: the worker is stopped with the module, destroying it statically would join the thread
+			// at a point where that may deadlock, and threads exiting late still refer to their ring.
+			static FStructuredLog* log = new FStructuredLog();
+			return *log;
+		}
+
+		/** @brief Per-thread state of the producer side */
+		struct FThreadState
+		{
+			FThreadRing* Ring = nullptr;
+			bool bRingRequested = false;
+
+			/** @brief Arguments of a record which is logged synchronously */
+			TArray<uint8, TInlineAllocator<256>> Fallback;
+			const FStructuredLogSite* FallbackSite = nullptr;
+
+			~FThreadState()
+			{
+				if (Ring) Ring->bOrphaned.store(true, std::memory_order_release);
+			}
+
+			FThreadRing* GetRing()
+			{
+				if (!bRingRequested)
+				{
+					bRingRequested = true;
+					Ring = GetStructuredLog().CreateRing();
+				}
+				return Ring;
+			}
+		};
+
+		thread_local FThreadState GThreadState;
+
+		FAutoConsoleCommandWithOutputDevice GFlushCommand {
+			TEXT_"Mcro.StructuredLog.Flush",
+			TEXT_"Format and log all pending MCRO_SLOG messages.",
+			FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice&)
+			{
+				FlushStructuredLog();
+			})
+		};
+
+		FAutoConsoleCommandWithArgsAndOutputDevice GBinaryStartCommand {
+			TEXT_"Mcro.StructuredLog.BinaryStart",
+			TEXT_"Start writing MCRO_SLOG messages into a binary log. Optionally specify the path of the file.",
+			FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](TArray<FString> const& args, FOutputDevice& output)
+			{
+				auto result = StartBinaryStructuredLog(args.IsEmpty() ? FString() : args[0]);
+				if (result.HasError())
+					output.Log(result.GetErrorRef()->GetMessage());
+				else
+					output.Logf(TEXT_"Writing binary structured log into %s", *result.GetValue());
+			})
+		};
+
+		FAutoConsoleCommand GBinaryStopCommand {
+			TEXT_"Mcro.StructuredLog.BinaryStop",
+			TEXT_"Stop writing MCRO_SLOG messages into the binary log.",
+			FConsoleCommandDelegate::CreateStatic(&StopBinaryStructuredLog)
+		};
+
+		FAutoConsoleCommandWithArgsAndOutputDevice GDecodeCommand {
+			TEXT_"Mcro.StructuredLog.Decode",
+			TEXT_"Decode a binary structured log into a text log: <binary path> [text path]. By default the text log is"
+			TEXT_" written next to the binary one.",
+			FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](TArray<FString> const& args, FOutputDevice& output)
+			{
+				if (args.IsEmpty())
+				{
+					output.Log(TEXT_"Usage: Mcro.StructuredLog.Decode <binary path> [text path]");
+					return;
+				}
+				const FString textPath = args.IsValidIndex(1)
+					? args[1]
+					: FPaths::ChangeExtension(args[0], TEXT_"txt");
+
+				auto result = DecodeStructuredLogFile(args[0], textPath);
+				if (result.HasError())
+					output.Log(result.GetErrorRef()->GetMessage());
+				else
+					output.Logf(TEXT_"Decoded %d messages into %s", result.GetValue(), *textPath);
+			})
+		};
+	}
+
+	FStructuredLogSite::FStructuredLogSite(
+		const TCHAR* format,
+		FLogCategoryBase const& category,
+		ELogVerbosity::Type verbosity,
+		const ANSICHAR* file,
+		int32 line
+	)
+		: Format(format)
+		, Category(category.GetCategoryName())
+		, Verbosity(verbosity)
+		, File(file)
+		, Line(line)
+		, Id(GetStructuredLog().RegisterSite(*this))
+	{}
+
+	FString FStructuredLogEntry::GetMessage() const
+	{
+		return FString::Format(*Format, Arguments);
+	}
+
+	FString FStructuredLogEntry::ToLogLine() const
+	{
+		const FString message = GetMessage();
+		return Verbosity == ELogVerbosity::Log
+			? FString::Printf(TEXT_"[%.6f][%u]%s: %s", Time, ThreadId, *Category.ToString(), *message)
+			: FString::Printf(TEXT_"[%.6f][%u]%s: %s: %s", Time, ThreadId, *Category.ToString(), ::ToString(Verbosity), *message);
+	}
+
+	void FlushStructuredLog()
+	{
+		GetStructuredLog().Drain();
+	}
+
+	TMaybe<FString> StartBinaryStructuredLog(FString const& path)
+	{
+		return GetStructuredLog().StartBinary(path);
+	}
+
+	void StopBinaryStructuredLog()
+	{
+		GetStructuredLog().StopBinary();
+	}
+
+	void SetStructuredLogTextOutput(bool enabled)
+	{
+		GetStructuredLog().bTextOutput.store(enabled, std::memory_order_relaxed);
+	}
+
+	TMaybe<int32> DecodeStructuredLog(
+		TArrayView<const uint8> binary,
+		TFunctionRef<void(FStructuredLogEntry const&)> onEntry
+	) {
+		FMemoryReaderView reader(TArrayView64<const uint8>(binary.GetData(), binary.Num()));
+		uint32 magic = 0, version = 0;
+		reader << magic << version;
+		if (reader.IsError() || magic != BinaryMagic)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Data is not a binary structured log");
+		if (version != BinaryVersion)
+			return IError::Make(new FAssertion())
+				->WithMessageF(TEXT_"Binary structured log has version {0}, but only {1} is supported", version, BinaryVersion);
+
+		TMap<uint32, FStructuredLogEntry> sites;
+		int32 count = 0;
+		while (!reader.AtEnd())
+		{
+			uint8 kind = 0;
+			uint32 id = 0;
+			reader << kind << id;
+			if (kind == static_cast<uint8>(EBinaryEntry::Site))
+			{
+				FStructuredLogEntry site;
+				FString category;
+				uint8 verbosity = 0;
+				reader << site.Format << category << verbosity << site.File << site.Line;
+				site.Category = FName(category);
+				site.Verbosity = static_cast<ELogVerbosity::Type>(verbosity);
+				if (reader.IsError()) break;
+				sites.Add(id, MoveTemp(site));
+			}
+			else if (kind == static_cast<uint8>(EBinaryEntry::Message))
+			{
+				FStructuredLogEntry const* site = sites.Find(id);
+				if (!site)
+					return IError::Make(new FAssertion())
+						->WithMessageF(TEXT_"Message refers to call site {0} which was not defined before", id);
+
+				FStructuredLogEntry entry = *site;
+				int32 argumentCount = 0;
+				reader << entry.Time << entry.ThreadId << argumentCount;
+				if (reader.IsError() || argumentCount < 0 || argumentCount > reader.TotalSize() - reader.Tell())
+					break;
+
+				entry.Arguments.Reserve(argumentCount);
+				for (int32 i = 0; i < argumentCount && !reader.IsError(); ++i)
+				{
+					uint8 type = 0;
+					reader << type;
+					switch (type)
+					{
+					case FStringFormatArg::Int:    { int64 value = 0; reader << value; entry.Arguments.Add(value); break; }
+					case FStringFormatArg::UInt:   { uint64 value = 0; reader << value; entry.Arguments.Add(value); break; }
+					case FStringFormatArg::Double: { double value = 0; reader << value; entry.Arguments.Add(value); break; }
+					default:
+						{
+							FString value;
+							reader << value;
+							entry.Arguments.Add(MoveTemp(value));
+							break;
+						}
+					}
+				}
+				// A process may crash while writing its last message, decoding simply stops there
+				if (reader.IsError()) break;
+
+				onEntry(entry);
+				++count;
+			}
+			else if (!reader.IsError())
+			{
+				return IError::Make(new FAssertion())
+					->WithMessageF(TEXT_"Binary structured log is corrupted, unknown entry kind {0}", kind);
+			}
+			else break;
+		}
+		return count;
+	}
+
+	TMaybe<int32> DecodeStructuredLogFile(FString const& binaryPath, FString const& textPath)
+	{
+		TArray<uint8> binary;
+		if (!FFileHelper::LoadFileToArray(binary, *binaryPath))
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Couldn't read binary structured log")
+				->WithAppendix(TEXT_"File", binaryPath);
+
+		TUniquePtr<FArchive> text(IFileManager::Get().CreateFileWriter(*textPath));
+		if (!text)
+			return IError::Make(new FAssertion())
+				->WithMessage(TEXT_"Couldn't open text log for writing")
+				->WithAppendix(TEXT_"File", textPath);
+
+		return DecodeStructuredLog(binary, [&](FStructuredLogEntry const& entry)
+		{
+			FTCHARToUTF8 line(*(entry.ToLogLine() + LINE_TERMINATOR));
+			text->Serialize(const_cast<void*>(static_cast<const void*>(line.Get())), line.Length());
+		});
+	}
+
+	namespace Detail
+	{
+		namespace
+		{
+			FDelegateHandle GSystemErrorHandle;
+
+			void EmitSynchronously(FThreadState& state)
+			{
+				FStringFormatOrderedArguments arguments;
+				FStructuredLog::DecodeArguments(state.Fallback.GetData(), state.Fallback.Num(), arguments);
+
+				FStructuredLogSite const& site = *state.FallbackSite;
+				state.FallbackSite = nullptr;
+				auto emit = [&](FRegisteredSite const& registered)
+				{
+					GetStructuredLog().Emit(
+						registered,
+						FPlatformTime::Cycles64(),
+						FPlatformTLS::GetCurrentThreadId(),
+						arguments
+					);
+				};
+				if (const FRegisteredSite* registered = GetStructuredLog().FindSite(site.Id))
+				{
+					emit(*registered);
+					return;
+				}
+
+				// The site registry is full, the site is still alive while its message is being logged
+				FRegisteredSite unregistered;
+				unregistered.Format = site.Format;
+				unregistered.Category = site.Category;
+				unregistered.Verbosity = site.Verbosity;
+				emit(unregistered);
+			}
+
+			void DumpOnSystemError()
+			{
+				GetStructuredLog().DumpLowLevel();
+			}
+		}
+
+		uint8* BeginStructuredLogRecord(FStructuredLogSite const& site, int32 argumentBytes)
+		{
+			FThreadState& state = GThreadState;
+			const uint32 size = Align(static_cast<uint32>(sizeof(FRecordHeader) + argumentBytes), 8);
+			if (size <= MaxRecordSize && site.Id != 0 && !GetStructuredLog().IsStopped())
+			{
+				if (FThreadRing* ring = state.GetRing())
+				{
+					uint64 head = ring->Head.load(std::memory_order_relaxed);
+					const uint64 tail = ring->Tail.load(std::memory_order_acquire);
+					const uint32 contiguous = RingCapacity - static_cast<uint32>(head & RingMask);
+					const uint32 padding = contiguous < size ? contiguous : 0;
+
+					if (head + padding + size - tail <= RingCapacity)
+					{
+						if (padding >= sizeof(FRecordHeader))
+						{
+							const FRecordHeader paddingHeader { padding, 0, 0, 0, 0 };
+							FMemory::Memcpy(ring->Data + (head & RingMask), &paddingHeader, sizeof(FRecordHeader));
+						}
+						head += padding;
+
+						uint8* record = ring->Data + (head & RingMask);
+						const FRecordHeader header {
+							size, site.Id, FPlatformTime::Cycles64(), static_cast<uint32>(argumentBytes), ring->ThreadId
+						};
+						FMemory::Memcpy(record, &header, sizeof(FRecordHeader));
+						ring->PendingHead = head + size;
+						return record + sizeof(FRecordHeader);
+					}
+				}
+			}
+
+			// The ring is full, the record is too large or there's no background thread to defer formatting to
+			state.FallbackSite = &site;
+			state.Fallback.SetNumUninitialized(argumentBytes, EAllowShrinking::No);
+			return state.Fallback.GetData();
+		}
+
+		void EndStructuredLogRecord()
+		{
+			FThreadState& state = GThreadState;
+			if (state.FallbackSite)
+			{
+				EmitSynchronously(state);
+				return;
+			}
+
+			// Pairs with the stopping thread setting bStopped then draining: either its last drain sees this record
+			// or this thread sees the log stopped and drains it itself.
+			FThreadRing* ring = state.Ring;
+			ring->Head.store(ring->PendingHead);
+			if (GetStructuredLog().IsStopped())
+			{
+				GetStructuredLog().Drain();
+				return;
+			}
+
+			const uint64 used = ring->PendingHead - ring->Tail.load(std::memory_order_relaxed);
+			if (used > RingCapacity / 2 && !ring->bWakeRequested.exchange(true, std::memory_order_relaxed))
+				GetStructuredLog().RequestDrain();
+		}
+
+		void StartStructuredLog()
+		{
+			GSystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddStatic(&DumpOnSystemError);
+		}
+
+		void StopStructuredLog()
+		{
+			FCoreDelegates::OnHandleSystemError.Remove(GSystemErrorHandle);
+			GetStructuredLog().StopWorker();
+		}
+	}
+}
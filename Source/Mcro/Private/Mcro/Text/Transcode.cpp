@@ -0,0 +1,241 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Text/Transcode.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+	#include <emmintrin.h>
+	#define MCRO_TRANSCODE_SSE2 1
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+	#define MCRO_TRANSCODE_NEON 1
+#endif
+
+#ifndef MCRO_TRANSCODE_SSE2
+	#define MCRO_TRANSCODE_SSE2 0
+#endif
+#ifndef MCRO_TRANSCODE_NEON
+	#define MCRO_TRANSCODE_NEON 0
+#endif
+
+#if !PLATFORM_TCHAR_IS_UTF8CHAR
+
+namespace Mcro::Text
+{
+	namespace
+	{
+		constexpr bool IsAscii(uint32 character) { return character < 0x80; }
+
+		FORCEINLINE uint32 CodeUnit(TCHAR character)
+		{
+			if constexpr (sizeof(TCHAR) == 2)
+				return static_cast<uint16>(character);
+			else
+				return static_cast<uint32>(character);
+		}
+
+		/** Copy the leading run of ASCII characters from a narrow string widened to TCHAR, returns its length */
+		int32 WidenAscii(TCHAR* destination, const uint8* source, int32 length)
+		{
+			int32 i = 0;
+			if constexpr (sizeof(TCHAR) == 2)
+			{
+#if MCRO_TRANSCODE_SSE2
+				const __m128i zero = _mm_setzero_si128();
+				for (; i + 16 <= length; i += 16)
+				{
+					const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+					if (_mm_movemask_epi8(chunk) != 0) break;
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),     _mm_unpacklo_epi8(chunk, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i + 8), _mm_unpackhi_epi8(chunk, zero));
+				}
+#elif MCRO_TRANSCODE_NEON
+				for (; i + 16 <= length; i += 16)
+				{
+					const uint8x16_t chunk = vld1q_u8(source + i);
+					if (vmaxvq_u8(chunk) >= 0x80) break;
+					vst1q_u16(reinterpret_cast<uint16*>(destination + i),     vmovl_u8(vget_low_u8(chunk)));
+					vst1q_u16(reinterpret_cast<uint16*>(destination + i + 8), vmovl_high_u8(chunk));
+				}
+#endif
+			}
+			for (; i < length && IsAscii(source[i]); ++i)
+				destination[i] = static_cast<TCHAR>(source[i]);
+			return i;
+		}
+
+		/** Copy the leading run of ASCII characters from a TCHAR string narrowed to bytes, returns its length */
+		int32 NarrowAscii(uint8* destination, const TCHAR* source, int32 length)
+		{
+			int32 i = 0;
+			if constexpr (sizeof(TCHAR) == 2)
+			{
+#if MCRO_TRANSCODE_SSE2
+				const __m128i nonAsciiBits = _mm_set1_epi16(static_cast<int16>(0xFF80));
+				const __m128i zero = _mm_setzero_si128();
+				for (; i + 16 <= length; i += 16)
+				{
+					const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+					const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 8));
+					const __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiBits);
+					if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF) break;
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_packus_epi16(low, high));
+				}
+#elif MCRO_TRANSCODE_NEON
+				for (; i + 16 <= length; i += 16)
+				{
+					const uint16x8_t low  = vld1q_u16(reinterpret_cast<const uint16*>(source + i));
+					const uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16*>(source + i + 8));
+					if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80) break;
+					vst1q_u8(destination + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+				}
+#endif
+			}
+			for (; i < length && IsAscii(CodeUnit(source[i])); ++i)
+				destination[i] = static_cast<uint8>(source[i]);
+			return i;
+		}
+
+		/**
+		 *	Length of the leading run of complete, well-formed UTF-8 sequences of non-ASCII characters, or INDEX_NONE
+		 *	if the run is malformed. Malformed input is left entirely to the platform conversion, so its handling stays
+		 *	the same as of StringCast.
+		 */
+		int32 FindUtf8Segment(const uint8* source, int32 length)
+		{
+			int32 i = 0;
+			while (i < length && !IsAscii(source[i]))
+			{
+				const uint8 lead = source[i];
+				int32 continuations;
+				uint32 codepoint;
+				if      (lead >= 0xC2 && lead <= 0xDF) { continuations = 1; codepoint = lead & 0x1F; }
+				else if (lead >= 0xE0 && lead <= 0xEF) { continuations = 2; codepoint = lead & 0x0F; }
+				else if (lead >= 0xF0 && lead <= 0xF4) { continuations = 3; codepoint = lead & 0x07; }
+				else return INDEX_NONE;
+
+				if (i + continuations >= length) return INDEX_NONE;
+				for (int32 j = 1; j <= continuations; ++j)
+				{
+					const uint8 continuation = source[i + j];
+					if ((continuation & 0xC0) != 0x80) return INDEX_NONE;
+					codepoint = (codepoint << 6) | (continuation & 0x3F);
+				}
+				const bool overlong = (continuations == 2 && codepoint < 0x800) || (continuations == 3 && codepoint < 0x10000);
+				const bool surrogate = codepoint >= 0xD800 && codepoint <= 0xDFFF;
+				if (overlong || surrogate || codepoint > 0x10FFFF) return INDEX_NONE;
+
+				i += continuations + 1;
+			}
+			return i;
+		}
+
+		/** Length of the leading run of well-formed non-ASCII TCHAR characters, or INDEX_NONE if it is malformed */
+		int32 FindWideSegment(const TCHAR* source, int32 length)
+		{
+			int32 i = 0;
+			while (i < length && !IsAscii(CodeUnit(source[i])))
+			{
+				const uint32 unit = CodeUnit(source[i]);
+				if constexpr (sizeof(TCHAR) == 2)
+				{
+					if (unit >= 0xD800 && unit <= 0xDBFF)
+					{
+						if (i + 1 >= length) return INDEX_NONE;
+						const uint32 low = CodeUnit(source[i + 1]);
+						if (low < 0xDC00 || low > 0xDFFF) return INDEX_NONE;
+						i += 2;
+						continue;
+					}
+					if (unit >= 0xDC00 && unit <= 0xDFFF) return INDEX_NONE;
+				}
+				else if (unit > 0x10FFFF || (unit >= 0xD800 && unit <= 0xDFFF)) return INDEX_NONE;
+				++i;
+			}
+			return i;
+		}
+
+		/** ANSI characters are converted one by one, so any run of them can be converted on its own */
+		template <typename CharType>
+		int32 FindSingleUnitSegment(const CharType* source, int32 length)
+		{
+			int32 i = 0;
+			while (i < length && !IsAscii(static_cast<uint8>(source[i]))) ++i;
+			return i;
+		}
+
+		template <typename CharTo, typename CharFrom>
+		int32 ConvertSegment(CharTo* destination, int32 capacity, const CharFrom* source, int32 length)
+		{
+			CharTo* end = FPlatformString::Convert(destination, capacity, source, length);
+			ensureMsgf(end, TEXT("Destination buffer was too small for string conversion"));
+			return end ? static_cast<int32>(end - destination) : 0;
+		}
+
+		template <typename CharTo, typename CharFrom, typename CopyAscii, typename FindSegment>
+		int32 TranscodeRuns(
+			CharTo* destination, int32 capacity,
+			const CharFrom* source, int32 length,
+			CopyAscii&& copyAscii, FindSegment&& findSegment
+		) {
+			int32 read = 0;
+			int32 written = 0;
+			while (read < length)
+			{
+				const int32 ascii = copyAscii(destination + written, source + read, length - read);
+				read += ascii;
+				written += ascii;
+				if (read == length) break;
+
+				int32 segment = findSegment(source + read, length - read);
+				if (segment == INDEX_NONE) segment = length - read;
+				written += ConvertSegment(destination + written, capacity - written, source + read, segment);
+				read += segment;
+			}
+			return written;
+		}
+	}
+
+	int32 Transcode(UTF8CHAR* destination, int32 capacity, const TCHAR* source, int32 length)
+	{
+		return TranscodeRuns(destination, capacity, source, length,
+			[](UTF8CHAR* to, const TCHAR* from, int32 count) { return NarrowAscii(reinterpret_cast<uint8*>(to), from, count); },
+			FindWideSegment
+		);
+	}
+
+	int32 Transcode(ANSICHAR* destination, int32 capacity, const TCHAR* source, int32 length)
+	{
+		return TranscodeRuns(destination, capacity, source, length,
+			[](ANSICHAR* to, const TCHAR* from, int32 count) { return NarrowAscii(reinterpret_cast<uint8*>(to), from, count); },
+			FindWideSegment
+		);
+	}
+
+	int32 Transcode(TCHAR* destination, int32 capacity, const UTF8CHAR* source, int32 length)
+	{
+		return TranscodeRuns(destination, capacity, source, length,
+			[](TCHAR* to, const UTF8CHAR* from, int32 count) { return WidenAscii(to, reinterpret_cast<const uint8*>(from), count); },
+			[](const UTF8CHAR* from, int32 count) { return FindUtf8Segment(reinterpret_cast<const uint8*>(from), count); }
+		);
+	}
+
+	int32 Transcode(TCHAR* destination, int32 capacity, const ANSICHAR* source, int32 length)
+	{
+		return TranscodeRuns(destination, capacity, source, length,
+			[](TCHAR* to, const ANSICHAR* from, int32 count) { return WidenAscii(to, reinterpret_cast<const uint8*>(from), count); },
+			FindSingleUnitSegment<ANSICHAR>
+		);
+	}
+}
+
+#endif
@@ -11,6 +11,23 @@
 
 #include "Mcro/Threading.h"
 #include "Mcro/TextMacros.h"
+#include "Containers/Queue.h"
+#include "HAL/IConsoleManager.h"
+#include "Stats/Stats.h"
+#include "UObject/GCObject.h"
+
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("Mcro"), STATGROUP_Mcro, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Game thread queue depth"), STAT_McroGameThreadQueueDepth, STATGROUP_Mcro);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Game thread queue drained items"), STAT_McroGameThreadQueueDrained, STATGROUP_Mcro);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Game thread queue drained ms"), STAT_McroGameThreadQueueDrainedMs, STATGROUP_Mcro);
+
+static TAutoConsoleVariable<float> CVarGameThreadQueueBudget(
+	TEXT_"Mcro.GameThreadQueue.BudgetMs", 2.f,
+	TEXT_"Milliseconds per frame spent on executing work queued with Mcro::Threading::QueueInGameThread.",
+	ECVF_Default
+);
 
 namespace Mcro::Threading
 {
@@ -35,6 +52,62 @@ namespace Mcro::Threading
 		return isInThreadPtr && isInThreadPtr();
 	}
 
+	namespace
+	{
+		/**
+		 *	@brief
+		 *	Objects bound to functions currently executing on the game thread. Scopes on the game thread are nested,
+		 *	so this behaves like a stack, and it's only touched by the game thread. Garbage collection runs on the
+		 *	game thread as well, so it sees a consistent set even when a bound function triggers it.
+		 */
+		class FGameThreadObjectPins : public FGCObject
+		{
+		public:
+			TArray<TObjectPtr<UObject>> Objects;
+
+			virtual void AddReferencedObjects(FReferenceCollector& collector) override
+			{
+				collector.AddReferencedObjects(Objects);
+			}
+
+			virtual FString GetReferencerName() const override
+			{
+				return TEXT_"Mcro::Threading::FGameThreadObjectPins";
+			}
+		};
+
+		FGameThreadObjectPins& GetGameThreadObjectPins()
+		{
+			// Leaked intentionally, so it doesn't need to unregister from a GC which might be gone at static teardown
+			static FGameThreadObjectPins* pins = new FGameThreadObjectPins();
+			return *pins;
+		}
+	}
+
+	Detail::FObjectLifetimeScope::FObjectLifetimeScope(FWeakObjectPtr const& object)
+	{
+		if (IsInGameThread())
+		{
+			if (UObject* resolved = object.Get())
+			{
+				GetGameThreadObjectPins().Objects.Push(resolved);
+				bPinnedOnGameThread = true;
+				bIsValid = true;
+			}
+		}
+		else
+		{
+			Pin.Reset(object.Get());
+			bIsValid = Pin.IsValid();
+		}
+	}
+
+	Detail::FObjectLifetimeScope::~FObjectLifetimeScope()
+	{
+		if (bPinnedOnGameThread)
+			GetGameThreadObjectPins().Objects.Pop(EAllowShrinking::No);
+	}
+
 	void RunInThread(ENamedThreads::Type threadName, TUniqueFunction<void()>&& func)
 	{
 		Detail::RunInThreadBoilerplate(threadName, MoveTemp(func), []{ return true; });
@@ -42,9 +115,9 @@ namespace Mcro::Threading
 
 	void RunInThread(ENamedThreads::Type threadName, const UObject* boundToObject, TUniqueFunction<void()>&& func)
 	{
-		Detail::RunInThreadBoilerplate(threadName, MoveTemp(func), [boundToObject]
+		Detail::RunInThreadBoilerplate(threadName, MoveTemp(func), [weakObject = FWeakObjectPtr(boundToObject)]
 		{
-			return IsValid(boundToObject) ? TStrongObjectPtr(boundToObject) : nullptr;
+			return Detail::FObjectLifetimeScope(weakObject);
 		});
 	}
 
@@ -52,7 +125,16 @@ namespace Mcro::Threading
 	{
 		Detail::RunInThreadBoilerplate(threadName, MoveTemp(func), [boundToObject]
 		{
-			return TStrongObjectPtr(boundToObject.Get());
+			return Detail::FObjectLifetimeScope(boundToObject);
+		});
+	}
+
+	void RunInThread(ENamedThreads::Type threadName, const FCancellationToken& token, TUniqueFunction<void()>&& func)
+	{
+		if (token.IsCancelled()) return;
+		Detail::RunInThreadBoilerplate(threadName, MoveTemp(func), [token]
+		{
+			return static_cast<bool>(token);
 		});
 	}
 
@@ -73,13 +155,200 @@ namespace Mcro::Threading
 
 	void EnqueueRenderCommand(TUniqueFunction<void(FRHICommandListImmediate&)>&& func)
 	{
+		Detail::EnqueueRenderCommandBoilerplate(MoveTemp(func), []{ return true; });
 	}
 
 	void EnqueueRenderCommand(const UObject* boundToObject, TUniqueFunction<void(FRHICommandListImmediate&)>&& func)
 	{
+		Detail::EnqueueRenderCommandBoilerplate(MoveTemp(func), [weakObject = FWeakObjectPtr(boundToObject)]
+		{
+			return Detail::FObjectLifetimeScope(weakObject);
+		});
 	}
 
 	void EnqueueRenderCommand(const FWeakObjectPtr& boundToObject, TUniqueFunction<void(FRHICommandListImmediate&)>&& func)
 	{
+		Detail::EnqueueRenderCommandBoilerplate(MoveTemp(func), [boundToObject]
+		{
+			return Detail::FObjectLifetimeScope(boundToObject);
+		});
+	}
+
+	namespace
+	{
+		using FRenderCommand = TUniqueFunction<void(FRHICommandListImmediate&)>;
+
+		// Only the game thread adds to or flushes the batch, so it doesn't need synchronization
+		std::atomic<bool> GRenderCommandBatching { false };
+		TArray<FRenderCommand> GRenderCommandBatch;
+	}
+
+	void SetRenderCommandBatching(bool enabled)
+	{
+		if (!GRenderCommandBatching.exchange(enabled) || enabled) return;
+		if (IsInGameThread()) FlushRenderCommandBatch();
+		else AsyncTask(ENamedThreads::GameThread, [] { FlushRenderCommandBatch(); });
+	}
+
+	bool IsRenderCommandBatchingEnabled()
+	{
+		return GRenderCommandBatching.load(std::memory_order_relaxed);
+	}
+
+	void FlushRenderCommandBatch()
+	{
+		check(IsInGameThread());
+		if (GRenderCommandBatch.IsEmpty()) return;
+
+		ENQUEUE_RENDER_COMMAND(FMcroThreadingBatch)([batch = MoveTemp(GRenderCommandBatch)](FRHICommandListImmediate& cmdList) mutable
+		{
+			for (FRenderCommand& command : batch)
+				command(cmdList);
+		});
+		GRenderCommandBatch.Reset();
+	}
+
+	bool Detail::ShouldBatchRenderCommand()
+	{
+		return GRenderCommandBatching.load(std::memory_order_relaxed) && IsInGameThread();
+	}
+
+	void Detail::BatchRenderCommand(TUniqueFunction<void(FRHICommandListImmediate&)>&& func)
+	{
+		GRenderCommandBatch.Add(MoveTemp(func));
+	}
+
+	namespace
+	{
+		struct FGameThreadQueue
+		{
+			TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Queues[3];
+			std::atomic<int32> Depth { 0 };
+			int32 LastDrainedCount = 0;
+			double LastDrainedMilliseconds = 0.0;
+		};
+
+		FGameThreadQueue& GetGameThreadQueue()
+		{
+			static FGameThreadQueue queue;
+			return queue;
+		}
+	}
+
+	void QueueInGameThread(TUniqueFunction<void()>&& func, EGameThreadQueuePriority priority)
+	{
+		auto& queue = GetGameThreadQueue();
+		queue.Queues[static_cast<int32>(priority)].Enqueue(MoveTemp(func));
+		queue.Depth.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void QueueInGameThread(const UObject* boundToObject, TUniqueFunction<void()>&& func, EGameThreadQueuePriority priority)
+	{
+		QueueInGameThread([weakObject = FWeakObjectPtr(boundToObject), func = MoveTemp(func)]
+		{
+			if (weakObject.IsValid()) func();
+		}, priority);
+	}
+
+	FGameThreadQueueStats GetGameThreadQueueStats()
+	{
+		auto& queue = GetGameThreadQueue();
+		return {
+			.Depth = queue.Depth.load(std::memory_order_relaxed),
+			.LastDrainedCount = queue.LastDrainedCount,
+			.LastDrainedMilliseconds = queue.LastDrainedMilliseconds
+		};
+	}
+
+	void Detail::DrainGameThreadQueue()
+	{
+		check(IsInGameThread());
+		auto& queue = GetGameThreadQueue();
+
+		double start = FPlatformTime::Seconds();
+		double deadline = start + CVarGameThreadQueueBudget.GetValueOnGameThread() / 1000.0;
+		int32 drained = 0;
+		TUniqueFunction<void()> func;
+
+		for (auto& priorityQueue : queue.Queues)
+		{
+			while ((drained == 0 || FPlatformTime::Seconds() < deadline) && priorityQueue.Dequeue(func))
+			{
+				queue.Depth.fetch_sub(1, std::memory_order_relaxed);
+				func();
+				++drained;
+			}
+		}
+
+		queue.LastDrainedCount = drained;
+		queue.LastDrainedMilliseconds = drained > 0 ? (FPlatformTime::Seconds() - start) * 1000.0 : 0.0;
+		SET_DWORD_STAT(STAT_McroGameThreadQueueDepth, queue.Depth.load(std::memory_order_relaxed));
+		SET_DWORD_STAT(STAT_McroGameThreadQueueDrained, drained);
+		SET_FLOAT_STAT(STAT_McroGameThreadQueueDrainedMs, queue.LastDrainedMilliseconds);
+	}
+
+	namespace
+	{
+		using FCoalescingKey = TPair<const void*, FName>;
+
+		struct FCoalescedCalls
+		{
+			FCriticalSection Lock;
+			TMap<FCoalescingKey, TUniqueFunction<void()>> Pending;
+		};
+
+		FCoalescedCalls& GetCoalescedCalls()
+		{
+			static FCoalescedCalls calls;
+			return calls;
+		}
+	}
+
+	void Detail::RunInGameThreadCoalescedBoilerplate(const void* objectKey, FName key, TUniqueFunction<void()>&& func)
+	{
+		auto& calls = GetCoalescedCalls();
+		FCoalescingKey id { objectKey, key };
+
+		// Superseded functions are destroyed outside of the lock
+		TUniqueFunction<void()> superseded;
+		if (IsInGameThread())
+		{
+			{
+				FScopeLock lock(&calls.Lock);
+				calls.Pending.RemoveAndCopyValue(id, superseded);
+			}
+			func();
+			return;
+		}
+
+		{
+			FScopeLock lock(&calls.Lock);
+			if (auto pending = calls.Pending.Find(id))
+			{
+				superseded = MoveTemp(*pending);
+				*pending = MoveTemp(func);
+				return;
+			}
+			calls.Pending.Add(id, MoveTemp(func));
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [id]
+		{
+			auto& calls = GetCoalescedCalls();
+			TUniqueFunction<void()> latest;
+			{
+				FScopeLock lock(&calls.Lock);
+				calls.Pending.RemoveAndCopyValue(id, latest);
+			}
+			if (latest) latest();
+		});
+	}
+
+	void RunInGameThreadCoalesced(const UObject* boundToObject, FName key, TUniqueFunction<void()>&& func)
+	{
+		Detail::RunInGameThreadCoalescedBoilerplate(boundToObject, key, [weakObject = FWeakObjectPtr(boundToObject), func = MoveTemp(func)]
+		{
+			if (weakObject.IsValid()) func();
+		});
 	}
 }
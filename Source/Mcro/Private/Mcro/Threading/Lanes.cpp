@@ -0,0 +1,309 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Threading/Lanes.h"
+#include "Mcro/TextMacros.h"
+#include "Containers/Queue.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+static TAutoConsoleVariable<int32> CVarIOLaneMaxThreads(
+	TEXT_"Mcro.Lanes.IO.MaxThreads", 8,
+	TEXT_"At most this many threads execute functions submitted to the IO work lane at once.",
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarBackgroundLaneMaxThreads(
+	TEXT_"Mcro.Lanes.Background.MaxThreads", 2,
+	TEXT_"At most this many threads execute functions submitted to the Background work lane at once.",
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<float> CVarLaneIdleTimeout(
+	TEXT_"Mcro.Lanes.IdleTimeoutSeconds", 5.f,
+	TEXT_"Threads of work lanes exit after being idle for this many seconds.",
+	ECVF_Default
+);
+
+namespace Mcro::Threading
+{
+	namespace
+	{
+		class FWorkLane;
+
+		class FLaneThread : public FRunnable
+		{
+		public:
+			FLaneThread(FWorkLane& lane) : Lane(lane), Wake(FPlatformProcess::GetSynchEventFromPool(false)) {}
+			virtual ~FLaneThread() override
+			{
+				delete Thread;
+				FPlatformProcess::ReturnSynchEventToPool(Wake);
+			}
+
+			virtual uint32 Run() override;
+
+			FWorkLane& Lane;
+			FEvent* Wake;
+			FRunnableThread* Thread = nullptr;
+		};
+
+		/**
+		 *	@brief
+		 *	Work is handed to idle threads directly by waking their own event, so no thread is woken in vain and
+		 *	stopping the lane can wake every thread reliably. Everything else is guarded by a single lock, which is
+		 *	negligible next to the blocking operations lanes are meant for.
+		 */
+		class FWorkLane
+		{
+		public:
+			FWorkLane(const TCHAR* name, TAutoConsoleVariable<int32>& maxThreadsVar, EThreadPriority priority)
+				: Name(name), MaxThreadsVar(maxThreadsVar), Priority(priority)
+			{}
+
+			int32 GetMaxConcurrency() const
+			{
+				const int32 overridden = MaxConcurrencyOverride.load(std::memory_order_relaxed);
+				return FMath::Max(1, overridden > 0 ? overridden : MaxThreadsVar.GetValueOnAnyThread());
+			}
+
+			void Enqueue(TUniqueFunction<void(bool)>&& func)
+			{
+				if (!FPlatformProcess::SupportsMultithreading()) [[unlikely]]
+				{
+					func(false);
+					return;
+				}
+
+				TArray<TUniquePtr<FLaneThread>> finished;
+				bool rejected = false;
+				{
+					FScopeLock lock(&Lock);
+					if (bStopping) rejected = true;
+					else
+					{
+						Queue.Enqueue(MoveTemp(func));
+						++Depth;
+						PeakDepth = FMath::Max(PeakDepth, Depth);
+
+						if (!IdleThreads.IsEmpty())
+							IdleThreads.Pop(EAllowShrinking::No)->Wake->Trigger();
+						else if (Threads.Num() < GetMaxConcurrency())
+							StartThread();
+					}
+					finished = MoveTemp(FinishedThreads);
+				}
+				// Joining threads which have already left their loop, outside of the lock
+				finished.Reset();
+
+				// The cancellation path may enqueue more work, so it's called without the lock
+				if (rejected) func(true);
+			}
+
+			void Stop()
+			{
+				TArray<TUniquePtr<FLaneThread>> threads;
+				{
+					FScopeLock lock(&Lock);
+					bStopping = true;
+					for (FLaneThread* thread : Threads)
+						thread->Wake->Trigger();
+					IdleThreads.Reset();
+				}
+				// Threads finish the remaining work, then leave their loop and move themselves to FinishedThreads
+				while (true)
+				{
+					{
+						FScopeLock lock(&Lock);
+						threads.Append(MoveTemp(FinishedThreads));
+						if (Threads.IsEmpty()) break;
+					}
+					FPlatformProcess::SleepNoStats(0.001f);
+				}
+				threads.Reset();
+			}
+
+			FWorkLaneStats GetStats() const
+			{
+				FScopeLock lock(&Lock);
+				return {
+					.Depth = Depth,
+					.PeakDepth = PeakDepth,
+					.Threads = Threads.Num(),
+					.BusyThreads = BusyThreads,
+					.MaxConcurrency = GetMaxConcurrency(),
+					.Executed = Executed
+				};
+			}
+
+			std::atomic<int32> MaxConcurrencyOverride { 0 };
+
+		private:
+			friend FLaneThread;
+
+			void StartThread()
+			{
+				FLaneThread* thread = new FLaneThread(*this);
+				Threads.Add(thread);
+				thread->Thread = FRunnableThread::Create(
+					thread, *FString::Printf(TEXT_"%s #%d", Name, ++StartedThreads), 0, Priority
+				);
+			}
+
+			/** @brief Leave the lane from the thread itself, it's deleted (and joined) later by another thread */
+			void Retire(FLaneThread* thread)
+			{
+				Threads.Remove(thread);
+				IdleThreads.Remove(thread);
+				FinishedThreads.Emplace(thread);
+			}
+
+			const TCHAR* Name;
+			TAutoConsoleVariable<int32>& MaxThreadsVar;
+			EThreadPriority Priority;
+
+			mutable FCriticalSection Lock;
+			TQueue<TUniqueFunction<void(bool)>> Queue;
+			TArray<FLaneThread*> Threads;
+			TArray<FLaneThread*> IdleThreads;
+			TArray<TUniquePtr<FLaneThread>> FinishedThreads;
+			int32 Depth = 0;
+			int32 PeakDepth = 0;
+			int32 BusyThreads = 0;
+			int32 StartedThreads = 0;
+			uint64 Executed = 0;
+			bool bStopping = false;
+		};
+
+		uint32 FLaneThread::Run()
+		{
+			TUniqueFunction<void(bool)> func;
+			FScopeLock lock(&Lane.Lock);
+			while (true)
+			{
+				if (Lane.Queue.Dequeue(func))
+				{
+					--Lane.Depth;
+					++Lane.BusyThreads;
+					{
+						FScopeUnlock unlock(&Lane.Lock);
+						func(false);
+						func.Reset();
+					}
+					--Lane.BusyThreads;
+					++Lane.Executed;
+					continue;
+				}
+
+				if (Lane.bStopping) break;
+
+				Lane.IdleThreads.Push(this);
+				bool woken;
+				{
+					FScopeUnlock unlock(&Lane.Lock);
+					woken = Wake->Wait(FTimespan::FromSeconds(CVarLaneIdleTimeout.GetValueOnAnyThread()));
+				}
+
+				// The thread is taken off the idle list by whoever handed it work, even when the wait has timed out
+				// in the meantime
+				if (!woken && Lane.IdleThreads.Contains(this) && Lane.Queue.IsEmpty()) break;
+				Lane.IdleThreads.Remove(this);
+			}
+			Lane.Retire(this);
+			return 0;
+		}
+
+		FWorkLane& GetLane(EWorkLane lane)
+		{
+			static FWorkLane lanes[] {
+				{ TEXT_"McroIO", CVarIOLaneMaxThreads, TPri_Normal },
+				{ TEXT_"McroBackground", CVarBackgroundLaneMaxThreads, TPri_BelowNormal },
+			};
+			return lanes[static_cast<int32>(lane)];
+		}
+
+		FAutoConsoleCommandWithOutputDevice GDumpLaneStatsCommand {
+			TEXT_"Mcro.Lanes.DumpStats",
+			TEXT_"List the queue depth and thread usage of Mcro::Threading work lanes.",
+			FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& output)
+			{
+				output.Logf(TEXT_"%-12s %8s %8s %8s %8s %8s %12s",
+					TEXT_"Lane", TEXT_"Depth", TEXT_"Peak", TEXT_"Threads", TEXT_"Busy", TEXT_"Max", TEXT_"Executed"
+				);
+				auto dump = [&](const TCHAR* name, EWorkLane lane)
+				{
+					FWorkLaneStats stats = GetLaneStats(lane);
+					output.Logf(TEXT_"%-12s %8d %8d %8d %8d %8d %12llu",
+						name, stats.Depth, stats.PeakDepth, stats.Threads, stats.BusyThreads, stats.MaxConcurrency, stats.Executed
+					);
+				};
+				dump(TEXT_"IO", EWorkLane::IO);
+				dump(TEXT_"Background", EWorkLane::Background);
+			})
+		};
+	}
+
+	void Detail::EnqueueInLane(EWorkLane lane, TUniqueFunction<void(bool)>&& func)
+	{
+		GetLane(lane).Enqueue(MoveTemp(func));
+	}
+
+	void Detail::ShutdownWorkLanes()
+	{
+		GetLane(EWorkLane::IO).Stop();
+		GetLane(EWorkLane::Background).Stop();
+	}
+
+	void RunInLane(EWorkLane lane, TUniqueFunction<void()>&& func)
+	{
+		Detail::EnqueueInLane(lane, [func = MoveTemp(func)](bool cancelled)
+		{
+			if (!cancelled) func();
+		});
+	}
+
+	void RunInLane(EWorkLane lane, const UObject* boundToObject, TUniqueFunction<void()>&& func)
+	{
+		RunInLane(lane, FWeakObjectPtr(boundToObject), MoveTemp(func));
+	}
+
+	void RunInLane(EWorkLane lane, const FWeakObjectPtr& boundToObject, TUniqueFunction<void()>&& func)
+	{
+		Detail::EnqueueInLane(lane, [boundToObject, func = MoveTemp(func)](bool cancelled)
+		{
+			if (cancelled) return;
+			if (auto keep = Detail::FObjectLifetimeScope(boundToObject)) func();
+		});
+	}
+
+	void RunInLane(EWorkLane lane, const FCancellationToken& token, TUniqueFunction<void()>&& func)
+	{
+		if (token.IsCancelled()) return;
+		Detail::EnqueueInLane(lane, [token, func = MoveTemp(func)](bool cancelled)
+		{
+			if (!cancelled && token) func();
+		});
+	}
+
+	void SetLaneMaxConcurrency(EWorkLane lane, int32 maxThreads)
+	{
+		GetLane(lane).MaxConcurrencyOverride.store(maxThreads, std::memory_order_relaxed);
+	}
+
+	FWorkLaneStats GetLaneStats(EWorkLane lane)
+	{
+		return GetLane(lane).GetStats();
+	}
+}
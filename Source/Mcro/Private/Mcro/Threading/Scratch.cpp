@@ -0,0 +1,21 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Threading/Scratch.h"
+
+namespace Mcro::Threading
+{
+	Ansi::FArena& GetThreadScratchArena()
+	{
+		static thread_local Ansi::FArena arena;
+		return arena;
+	}
+}
@@ -0,0 +1,45 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Trace.h"
+
+#if MCRO_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(McroThreadingChannel)
+UE_TRACE_CHANNEL_DEFINE(McroEventsChannel)
+UE_TRACE_CHANNEL_DEFINE(McroStateChannel)
+UE_TRACE_CHANNEL_DEFINE(McroCompositionChannel)
+UE_TRACE_CHANNEL_DEFINE(McroErrorsChannel)
+UE_TRACE_CHANNEL_DEFINE(McroYamlChannel)
+UE_TRACE_CHANNEL_DEFINE(McroSlateChannel)
+
+TRACE_DECLARE_INT_COUNTER(McroThreadHops, TEXT("Mcro/ThreadHops"));
+TRACE_DECLARE_INT_COUNTER(McroBroadcasts, TEXT("Mcro/Broadcasts"));
+TRACE_DECLARE_INT_COUNTER(McroStateChanges, TEXT("Mcro/StateChanges"));
+TRACE_DECLARE_INT_COUNTER(McroErrorsMade, TEXT("Mcro/ErrorsMade"));
+TRACE_DECLARE_INT_COUNTER(McroBindingSweeps, TEXT("Mcro/BindingSweeps"));
+
+namespace Mcro::Trace::Detail
+{
+	void IncrementCounter(ECounter counter)
+	{
+		switch (counter)
+		{
+		case ECounter::ThreadHops:   TRACE_COUNTER_INCREMENT(McroThreadHops); break;
+		case ECounter::Broadcasts:   TRACE_COUNTER_INCREMENT(McroBroadcasts); break;
+		case ECounter::StateChanges: TRACE_COUNTER_INCREMENT(McroStateChanges); break;
+		case ECounter::ErrorsMade:   TRACE_COUNTER_INCREMENT(McroErrorsMade); break;
+		case ECounter::BindingSweeps: TRACE_COUNTER_INCREMENT(McroBindingSweeps); break;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,34 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/TraceHooks.h"
+
+namespace Mcro::TraceHooks
+{
+	std::atomic<uint32> Detail::GEnabledTraceHooks { 0 };
+	std::atomic<ITraceHooks*> Detail::GTraceHooks { nullptr };
+
+	void SetTraceHooks(ITraceHooks* hooks)
+	{
+		Detail::GTraceHooks.store(hooks, std::memory_order_release);
+	}
+
+	void SetEnabledTraceHooks(ETraceHook hooks)
+	{
+		Detail::GEnabledTraceHooks.store(static_cast<uint32>(hooks), std::memory_order_relaxed);
+	}
+
+	uint64 Detail::NextThreadHopId()
+	{
+		static std::atomic<uint64> counter { 0 };
+		return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+}
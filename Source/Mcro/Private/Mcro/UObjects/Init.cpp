@@ -0,0 +1,71 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/UObjects/Init.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+
+namespace Mcro::UObjects::Init::Detail
+{
+	FBulkObjectConstructor::FBulkObjectConstructor(
+		FConstructObjectParameters const& params,
+		const UClass* defaultClass,
+		int32 count
+	)
+		: Params(MakeUnique<FStaticConstructObjectParameters>(params.Class ? params.Class : defaultClass))
+	{
+		Params->Outer = params.Outer;
+		Params->SetFlags = params.Flags;
+		Params->InternalSetFlags = params.InternalSetFlags;
+		Params->bCopyTransientsFromClassDefaults = params.bCopyTransientsFromClassDefaults;
+		Params->InstanceGraph = params.InstanceGraph;
+		Params->ExternalPackage = params.ExternalPackage;
+		Params->PropertyInitCallback = params.PropertyInitCallback;
+
+		if (params.bSequentialNames || (params.Name != NAME_None && count > 1))
+		{
+			BaseName = params.Name != NAME_None
+				? FName(params.Name, NAME_NO_NUMBER_INTERNAL)
+				: Params->Class->GetFName();
+		}
+		else Params->Name = params.Name;
+
+		// NewObject would look up the same archetype for each object with the same name. Generated names may match a
+		// different subobject of the archetype of the outer, so those are looked up for each object in Construct
+		bResolveTemplate = !params.Template && BaseName != NAME_None;
+		Params->Template = params.Template || bResolveTemplate
+			? params.Template
+			: UObject::GetArchetypeFromRequiredInfo(Params->Class, Params->Outer, Params->Name, Params->SetFlags);
+		Params->bAssumeTemplateIsArchetype = params.Template ? params.bAssumeTemplateIsArchetype : true;
+
+		// Only async loading threads may collect garbage while constructing objects outside of the game thread
+		if (!IsInGameThread()) GCGuard = MakeUnique<FGCScopeGuard>();
+	}
+
+	FBulkObjectConstructor::~FBulkObjectConstructor() = default;
+
+	FName FBulkObjectConstructor::MakeNextName()
+	{
+		FName candidate;
+		do candidate = FName(BaseName, NAME_EXTERNAL_TO_INTERNAL(NextNumber++));
+		while (StaticFindObjectFastInternal(nullptr, Params->Outer, candidate));
+		return candidate;
+	}
+
+	UObject* FBulkObjectConstructor::Construct()
+	{
+		if (BaseName != NAME_None) Params->Name = MakeNextName();
+		if (bResolveTemplate)
+			Params->Template = UObject::GetArchetypeFromRequiredInfo(Params->Class, Params->Outer, Params->Name, Params->SetFlags);
+		return StaticConstructObject_Internal(*Params);
+	}
+}
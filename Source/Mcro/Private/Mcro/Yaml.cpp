@@ -0,0 +1,160 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Yaml.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+
+namespace Mcro::Yaml
+{
+	FOutputStreamBuffer::FOutputStreamBuffer(FArchive& archive)
+		: Archive(&archive)
+	{
+		setp(Buffer, Buffer + ChunkSize);
+	}
+
+	FOutputStreamBuffer::FOutputStreamBuffer(IFileHandle& file)
+		: File(&file)
+	{
+		setp(Buffer, Buffer + ChunkSize);
+	}
+
+	FOutputStreamBuffer::~FOutputStreamBuffer()
+	{
+		FlushBuffer();
+	}
+
+	void FOutputStreamBuffer::WriteToTarget(const char* data, int64 count)
+	{
+		if (count <= 0) return;
+		if (Archive)
+			Archive->Serialize(const_cast<char*>(data), count);
+		else
+			File->Write(reinterpret_cast<const uint8*>(data), count);
+		WrittenSize += count;
+	}
+
+	bool FOutputStreamBuffer::FlushBuffer()
+	{
+		WriteToTarget(pbase(), pptr() - pbase());
+		setp(Buffer, Buffer + ChunkSize);
+		return !Archive || !Archive->IsError();
+	}
+
+	FOutputStreamBuffer::int_type FOutputStreamBuffer::overflow(int_type character)
+	{
+		if (!FlushBuffer()) return traits_type::eof();
+		if (!traits_type::eq_int_type(character, traits_type::eof()))
+		{
+			*pptr() = traits_type::to_char_type(character);
+			pbump(1);
+		}
+		return traits_type::not_eof(character);
+	}
+
+	std::streamsize FOutputStreamBuffer::xsputn(const char_type* data, std::streamsize count)
+	{
+		// Large pieces skip the buffer, as they would overflow it anyway
+		if (count >= ChunkSize)
+		{
+			if (!FlushBuffer()) return 0;
+			WriteToTarget(data, count);
+			return count;
+		}
+		if (count > epptr() - pptr() && !FlushBuffer()) return 0;
+		traits_type::copy(pptr(), data, static_cast<size_t>(count));
+		pbump(static_cast<int>(count));
+		return count;
+	}
+
+	int FOutputStreamBuffer::sync()
+	{
+		if (!FlushBuffer()) return -1;
+		if (Archive) Archive->Flush();
+		else File->Flush();
+		return 0;
+	}
+
+	FStreamingEmitter::FStreamingEmitter(FArchive& archive)
+		: FStreamingEmitterStorage(archive)
+		, YAML::Emitter(Stream)
+	{}
+
+	FStreamingEmitter::FStreamingEmitter(IFileHandle& file)
+		: FStreamingEmitterStorage(file)
+		, YAML::Emitter(Stream)
+	{}
+
+	FStreamingEmitter::~FStreamingEmitter()
+	{
+		Flush();
+	}
+
+	void FStreamingEmitter::Flush()
+	{
+		Stream.flush();
+	}
+
+	void FRetainedStreamBuffer::Reset(int32 maxRetained)
+	{
+		if (Buffer.Max() > maxRetained)
+			Buffer.Empty();
+		else
+			Buffer.Reset();
+	}
+
+	FRetainedStreamBuffer::int_type FRetainedStreamBuffer::overflow(int_type character)
+	{
+		if (!traits_type::eq_int_type(character, traits_type::eof()))
+			Buffer.Add(traits_type::to_char_type(character));
+		return traits_type::not_eof(character);
+	}
+
+	std::streamsize FRetainedStreamBuffer::xsputn(const char_type* data, std::streamsize count)
+	{
+		Buffer.Append(data, static_cast<int32>(count));
+		return count;
+	}
+
+	namespace
+	{
+		struct FEmitterPool
+		{
+			TArray<TUniquePtr<Detail::FPooledEmitterEntry>, TInlineAllocator<FPooledEmitter::MaxPooledPerThread>> Idle;
+		};
+
+		thread_local FEmitterPool GEmitterPool;
+	}
+
+	FPooledEmitter::FPooledEmitter()
+		: Entry(GEmitterPool.Idle.IsEmpty()
+			? MakeUnique<Detail::FPooledEmitterEntry>()
+			: GEmitterPool.Idle.Pop(EAllowShrinking::No)
+		)
+	{
+		Entry->Emitter.Emplace(Entry->Stream);
+	}
+
+	FPooledEmitter::~FPooledEmitter()
+	{
+		Entry->Emitter.Reset();
+		Entry->Stream.clear();
+		Entry->StreamBuffer.Reset(MaxRetainedCapacity);
+		if (GEmitterPool.Idle.Num() < MaxPooledPerThread)
+			GEmitterPool.Idle.Push(MoveTemp(Entry));
+	}
+
+	FString FPooledEmitter::ToString() const
+	{
+		const std::string_view view = GetView();
+		return FString(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(view.data()), static_cast<int32>(view.size())));
+	}
+}
@@ -0,0 +1,1569 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Mcro/Yaml/Mapped.h"
+#include "Mcro/Text.h"
+#include "Mcro/Hash.h"
+#include "Mcro/Trace.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <cstring>
+#include <limits>
+
+namespace Mcro::Yaml
+{
+	using namespace Mcro::Text;
+	using namespace Mcro::Hash;
+
+	namespace
+	{
+		constexpr int32 DecodedChunkSize = 64 * 1024;
+		constexpr int32 MaxNestingDepth = 256;
+
+		bool IsLineBreak(uint8 c) { return c == '\n' || c == '\r'; }
+		bool IsSpace(uint8 c) { return c == ' ' || c == '\t'; }
+		bool IsBlank(uint8 c) { return c == 0 || IsSpace(c) || IsLineBreak(c); }
+		bool IsFlowIndicator(uint8 c) { return c == ',' || c == '[' || c == ']' || c == '{' || c == '}'; }
+
+		FUtf8StringView MakeView(const uint8* data, int64 length)
+		{
+			return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(data), static_cast<int32>(length));
+		}
+
+		bool ScalarIsAnyOf(FUtf8StringView scalar, std::initializer_list<const ANSICHAR*> options)
+		{
+			for (const ANSICHAR* option : options)
+			{
+				if (scalar.Equals(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(option)), ESearchCase::CaseSensitive))
+					return true;
+			}
+			return false;
+		}
+	}
+
+	/** @brief Single pass recursive descent parser building the flat node tree of an FMappedYamlDocument */
+	class FMappedYamlParser
+	{
+	public:
+		FMappedYamlParser(FMappedYamlDocument& document, int32 firstLine)
+			: Document(document)
+			, Cur(document.Contents.GetData())
+			, End(document.Contents.GetData() + document.Contents.Num())
+			, LineStart(document.Contents.GetData())
+			, Line(firstLine)
+		{}
+
+		bool Parse()
+		{
+			if (End - Cur >= 3 && Cur[0] == 0xEF && Cur[1] == 0xBB && Cur[2] == 0xBF)
+			{
+				Cur += 3;
+				LineStart = Cur;
+			}
+			if (!SkipIndentation() || !SkipToContent()) return false;
+
+			if (AtDocumentMarker('-'))
+			{
+				Cur += 3;
+				if (!SkipToContent()) return false;
+			}
+
+			const int32 root = AtBlockEnd() ? AddNode(EMappedYamlNodeType::Null, Line) : ParseBlockNode(-1, false);
+			if (root == INDEX_NONE || !SkipToContent()) return false;
+
+			// Content after the end of the root node is either a new document (ignored) or misplaced
+			if (Cur < End && !AtDocumentMarker('-') && !AtDocumentMarker('.'))
+			{
+				Fail(TEXT_"unexpected content after the document root");
+				return false;
+			}
+
+			Document.Root = root;
+			return true;
+		}
+
+		FString const& GetError() const { return Error; }
+		int32 GetErrorLine() const { return ErrorLine; }
+
+	private:
+		using FScratch = TArray<uint8, TInlineAllocator<256>>;
+
+		struct FDepthGuard
+		{
+			FDepthGuard(int32& depth) : Depth(depth) { ++Depth; }
+			~FDepthGuard() { --Depth; }
+			int32& Depth;
+		};
+
+		FMappedYamlDocument& Document;
+		const uint8* Cur;
+		const uint8* End;
+		const uint8* LineStart;
+		int32 Line;
+		int32 Depth = 0;
+
+		FString Error;
+		int32 ErrorLine = 0;
+
+		/** @brief Children of the containers being parsed, moved to the document when a container is finished */
+		TArray<int32> ChildStack;
+
+		UTF8CHAR* ChunkCursor = nullptr;
+		int32 ChunkRemaining = 0;
+
+		uint8 At(const uint8* position) const { return position < End ? *position : 0; }
+		int32 Column() const { return static_cast<int32>(Cur - LineStart); }
+		bool AtLineEnd() const { return Cur >= End || IsLineBreak(*Cur); }
+		bool AtCommentOrLineEnd() const { return AtLineEnd() || *Cur == '#'; }
+		bool AtSequenceEntry() const { return Cur < End && *Cur == '-' && IsBlank(At(Cur + 1)); }
+
+		bool AtDocumentMarker(uint8 marker) const
+		{
+			return Cur == LineStart && End - Cur >= 3
+				&& Cur[0] == marker && Cur[1] == marker && Cur[2] == marker
+				&& IsBlank(At(Cur + 3));
+		}
+
+		bool AtBlockEnd() const { return Cur >= End || AtDocumentMarker('-') || AtDocumentMarker('.'); }
+
+		int32 Fail(const TCHAR* message, int32 line = 0)
+		{
+			if (Error.IsEmpty())
+			{
+				Error = message;
+				ErrorLine = line > 0 ? line : Line;
+			}
+			return INDEX_NONE;
+		}
+
+		void SkipSpaces()
+		{
+			while (Cur < End && IsSpace(*Cur)) ++Cur;
+		}
+
+		void ConsumeLineBreak()
+		{
+			if (Cur < End && *Cur == '\r') ++Cur;
+			if (Cur < End && *Cur == '\n') ++Cur;
+			++Line;
+			LineStart = Cur;
+		}
+
+		void NextLine()
+		{
+			while (Cur < End && *Cur != '\n') ++Cur;
+			if (Cur < End)
+			{
+				++Cur;
+				++Line;
+			}
+			LineStart = Cur;
+		}
+
+		/** @brief Skip the indentation of the current line, which may only contain spaces */
+		bool SkipIndentation()
+		{
+			while (Cur < End && *Cur == ' ') ++Cur;
+			if (Cur < End && *Cur == '\t')
+			{
+				SkipSpaces();
+				if (!AtCommentOrLineEnd())
+				{
+					Fail(TEXT_"tabs are not allowed in indentation");
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/** @brief Skip whitespace, comments and empty lines until the next meaningful character */
+		bool SkipToContent()
+		{
+			SkipSpaces();
+			while (Cur < End && AtCommentOrLineEnd())
+			{
+				NextLine();
+				if (!SkipIndentation()) return false;
+			}
+			return true;
+		}
+
+		/** @brief Skip whitespace, comments and line breaks inside flow collections */
+		void SkipFlowSpace()
+		{
+			for (;;)
+			{
+				SkipSpaces();
+				if (Cur >= End) return;
+				if (*Cur == '#')
+				{
+					while (Cur < End && !IsLineBreak(*Cur)) ++Cur;
+				}
+				else if (IsLineBreak(*Cur))
+					ConsumeLineBreak();
+				else return;
+			}
+		}
+
+		int32 AddNode(EMappedYamlNodeType type, int32 line)
+		{
+			const int32 index = Document.Nodes.AddDefaulted();
+			auto& node = Document.Nodes[index];
+			node.Type = type;
+			node.Line = line;
+			return index;
+		}
+
+		int32 AddScalar(FUtf8StringView value, bool plain, int32 line)
+		{
+			if (plain && value.IsEmpty())
+				return AddNode(EMappedYamlNodeType::Null, line);
+
+			const int32 index = AddNode(EMappedYamlNodeType::Scalar, line);
+			auto& node = Document.Nodes[index];
+			node.bPlain = plain;
+			node.Scalar = value;
+			return index;
+		}
+
+		void FinishContainer(int32 node, int32 stackStart)
+		{
+			const int32 count = ChildStack.Num() - stackStart;
+			auto& data = Document.Nodes[node];
+			data.FirstChild = Document.Children.Num();
+			data.ChildCount = count;
+			Document.Children.Append(ChildStack.GetData() + stackStart, count);
+			ChildStack.SetNum(stackStart, EAllowShrinking::No);
+		}
+
+		/** @brief Copy decoded scalar contents into the chunked arena of the document */
+		FUtf8StringView Store(FScratch const& text)
+		{
+			const int32 length = text.Num();
+			if (length == 0) return {};
+
+			UTF8CHAR* destination;
+			if (length > DecodedChunkSize / 4)
+			{
+				destination = Document.DecodedChunks.Add_GetRef(MakeUniqueForOverwrite<UTF8CHAR[]>(length)).Get();
+			}
+			else
+			{
+				if (length > ChunkRemaining)
+				{
+					ChunkCursor = Document.DecodedChunks.Add_GetRef(MakeUniqueForOverwrite<UTF8CHAR[]>(DecodedChunkSize)).Get();
+					ChunkRemaining = DecodedChunkSize;
+				}
+				destination = ChunkCursor;
+				ChunkCursor += length;
+				ChunkRemaining -= length;
+			}
+			FMemory::Memcpy(destination, text.GetData(), length);
+			return FUtf8StringView(destination, length);
+		}
+
+		static void AppendUtf8(FScratch& output, uint32 codepoint)
+		{
+			if (codepoint < 0x80)
+				output.Add(static_cast<uint8>(codepoint));
+			else if (codepoint < 0x800)
+			{
+				output.Add(static_cast<uint8>(0xC0 | (codepoint >> 6)));
+				output.Add(static_cast<uint8>(0x80 | (codepoint & 0x3F)));
+			}
+			else if (codepoint < 0x10000)
+			{
+				output.Add(static_cast<uint8>(0xE0 | (codepoint >> 12)));
+				output.Add(static_cast<uint8>(0x80 | ((codepoint >> 6) & 0x3F)));
+				output.Add(static_cast<uint8>(0x80 | (codepoint & 0x3F)));
+			}
+			else
+			{
+				output.Add(static_cast<uint8>(0xF0 | (codepoint >> 18)));
+				output.Add(static_cast<uint8>(0x80 | ((codepoint >> 12) & 0x3F)));
+				output.Add(static_cast<uint8>(0x80 | ((codepoint >> 6) & 0x3F)));
+				output.Add(static_cast<uint8>(0x80 | (codepoint & 0x3F)));
+			}
+		}
+
+		static void AppendLineFeeds(FScratch& output, int32 count)
+		{
+			output.AddUninitialized(count);
+			FMemory::Memset(output.GetData() + output.Num() - count, '\n', count);
+		}
+
+		/**
+		 *	@brief
+		 *	Fold a line break inside a quoted scalar: trailing and leading whitespace is dropped, a single break
+		 *	becomes a space, every further empty line becomes a line feed.
+		 *
+		 *	@param keep  Trailing whitespace before this position came from escape sequences and is preserved
+		 */
+		static void FoldLineBreak(const uint8*& position, const uint8* stop, FScratch& output, int32 keep)
+		{
+			while (output.Num() > keep && IsSpace(output.Last())) output.Pop(EAllowShrinking::No);
+
+			int32 breaks = 0;
+			for (;;)
+			{
+				if (position < stop && *position == '\r') ++position;
+				if (position < stop && *position == '\n') ++position;
+				while (position < stop && IsSpace(*position)) ++position;
+				if (position < stop && IsLineBreak(*position)) ++breaks;
+				else break;
+			}
+			if (breaks == 0) output.Add(' ');
+			else AppendLineFeeds(output, breaks);
+		}
+
+		/** @brief Scan a quoted scalar body, counting lines. Returns the position of the closing quote */
+		const uint8* ScanQuoted(uint8 quote, bool& needsDecode)
+		{
+			for (; Cur < End; ++Cur)
+			{
+				const uint8 c = *Cur;
+				if (c == quote)
+				{
+					if (quote == '\'' && At(Cur + 1) == '\'')
+					{
+						needsDecode = true;
+						++Cur;
+						continue;
+					}
+					return Cur;
+				}
+				if (quote == '"' && c == '\\' && Cur + 1 < End)
+				{
+					needsDecode = true;
+					++Cur;
+				}
+				if (*Cur == '\n')
+				{
+					needsDecode = true;
+					++Line;
+					LineStart = Cur + 1;
+				}
+			}
+			return nullptr;
+		}
+
+		int32 ParseSingleQuoted()
+		{
+			const int32 line = Line;
+			bool needsDecode = false;
+			const uint8* start = ++Cur;
+			const uint8* stop = ScanQuoted('\'', needsDecode);
+			if (!stop) return Fail(TEXT_"unterminated single quoted scalar", line);
+			Cur = stop + 1;
+
+			if (!needsDecode) return AddScalar(MakeView(start, stop - start), false, line);
+
+			FScratch output;
+			for (const uint8* position = start; position < stop;)
+			{
+				if (*position == '\'')
+				{
+					output.Add('\'');
+					position += 2;
+				}
+				else if (IsLineBreak(*position))
+					FoldLineBreak(position, stop, output, 0);
+				else
+					output.Add(*position++);
+			}
+			return AddScalar(Store(output), false, line);
+		}
+
+		bool ReadHex(const uint8*& position, const uint8* stop, int32 digits, uint32& result)
+		{
+			result = 0;
+			for (int32 i = 0; i < digits; ++i, ++position)
+			{
+				if (position >= stop) return false;
+				const uint8 c = *position;
+				uint32 digit;
+				if (c >= '0' && c <= '9') digit = c - '0';
+				else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+				else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+				else return false;
+				result = result << 4 | digit;
+			}
+			return true;
+		}
+
+		int32 ParseDoubleQuoted()
+		{
+			const int32 line = Line;
+			bool needsDecode = false;
+			const uint8* start = ++Cur;
+			const uint8* stop = ScanQuoted('"', needsDecode);
+			if (!stop) return Fail(TEXT_"unterminated double quoted scalar", line);
+			Cur = stop + 1;
+
+			if (!needsDecode) return AddScalar(MakeView(start, stop - start), false, line);
+
+			FScratch output;
+			int32 keep = 0;
+			for (const uint8* position = start; position < stop;)
+			{
+				const uint8 c = *position;
+				if (IsLineBreak(c))
+				{
+					FoldLineBreak(position, stop, output, keep);
+					continue;
+				}
+				if (c != '\\')
+				{
+					output.Add(c);
+					++position;
+					continue;
+				}
+
+				++position;
+				const uint8 escape = *position++;
+				uint32 codepoint = 0;
+				switch (escape)
+				{
+				case '0':  output.Add(0x00); break;
+				case 'a':  output.Add(0x07); break;
+				case 'b':  output.Add(0x08); break;
+				case 't':
+				case '\t': output.Add(0x09); break;
+				case 'n':  output.Add(0x0A); break;
+				case 'v':  output.Add(0x0B); break;
+				case 'f':  output.Add(0x0C); break;
+				case 'r':  output.Add(0x0D); break;
+				case 'e':  output.Add(0x1B); break;
+				case ' ':
+				case '"':
+				case '/':
+				case '\\': output.Add(escape); break;
+				case 'N':  AppendUtf8(output, 0x85); break;
+				case '_':  AppendUtf8(output, 0xA0); break;
+				case 'L':  AppendUtf8(output, 0x2028); break;
+				case 'P':  AppendUtf8(output, 0x2029); break;
+				case 'x':
+				case 'u':
+				case 'U':
+					if (!ReadHex(position, stop, escape == 'x' ? 2 : escape == 'u' ? 4 : 8, codepoint))
+						return Fail(TEXT_"invalid hexadecimal escape sequence", line);
+					if (codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+						return Fail(TEXT_"escape sequence is not a valid unicode code point", line);
+					AppendUtf8(output, codepoint);
+					break;
+				case '\r':
+				case '\n':
+					// Escaped line break, the lines are joined without any whitespace
+					if (escape == '\r' && position < stop && *position == '\n') ++position;
+					while (position < stop && IsSpace(*position)) ++position;
+					break;
+				default:
+					return Fail(TEXT_"invalid escape sequence in double quoted scalar", line);
+				}
+				keep = output.Num();
+			}
+			return AddScalar(Store(output), false, line);
+		}
+
+		/** @brief Move the cursor to where the plain scalar stops on the current line. Returns the end of its text. */
+		const uint8* ScanPlainLine(bool inFlow)
+		{
+			const uint8* start = Cur;
+			const uint8* last = Cur;
+			for (; Cur < End; ++Cur)
+			{
+				const uint8 c = *Cur;
+				if (IsLineBreak(c)) break;
+				if (c == ':' && (IsBlank(At(Cur + 1)) || (inFlow && IsFlowIndicator(At(Cur + 1))))) break;
+				if (c == '#' && Cur > start && IsSpace(Cur[-1])) break;
+				if (inFlow && IsFlowIndicator(c)) break;
+				if (!IsSpace(c)) last = Cur + 1;
+			}
+			return last;
+		}
+
+		/**
+		 *	@brief
+		 *	Find the continuation line of a multi-line plain scalar after the line break at the cursor. In block context
+		 *	it must be more indented than the collection containing the scalar, and it can't hold a mapping key. Empty
+		 *	lines before it are counted.
+		 *
+		 *	@return  The first character of the continuation, or nullptr if the scalar ends on the current line
+		 */
+		const uint8* FindPlainContinuation(bool inFlow, int32 parentIndent, int32& breaks, const uint8*& lineBegin) const
+		{
+			const uint8* position = Cur;
+			breaks = 0;
+			for (;;)
+			{
+				if (position < End && *position == '\r') ++position;
+				if (position < End && *position == '\n') ++position;
+				++breaks;
+				lineBegin = position;
+				while (position < End && *position == ' ') ++position;
+				const int32 indent = static_cast<int32>(position - lineBegin);
+				while (position < End && IsSpace(*position)) ++position;
+				if (position >= End) return nullptr;
+				if (IsLineBreak(*position)) continue;
+
+				if (!inFlow && indent <= parentIndent) return nullptr;
+				if (*position == '#') return nullptr;
+				if (*position == ':' && (IsBlank(At(position + 1)) || inFlow)) return nullptr;
+				if (inFlow && IsFlowIndicator(*position)) return nullptr;
+				if (indent == 0 && End - lineBegin >= 3 && IsBlank(At(lineBegin + 3))
+					&& ((lineBegin[0] == '-' && lineBegin[1] == '-' && lineBegin[2] == '-')
+						|| (lineBegin[0] == '.' && lineBegin[1] == '.' && lineBegin[2] == '.'))
+				) return nullptr;
+
+				// A line holding a mapping key is an indentation error, not a continuation
+				for (const uint8* c = position; c < End && !IsLineBreak(*c); ++c)
+				{
+					if (*c == '#' && IsSpace(c[-1])) break;
+					if (*c == ':' && IsBlank(At(c + 1))) return nullptr;
+				}
+				return position;
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Parse a plain scalar, which may continue on following lines. Single line scalars are views into the source,
+		 *	multi-line ones are folded like quoted scalars: line breaks become spaces and empty lines line feeds.
+		 *
+		 *	@param parentIndent  Indentation of the collection containing the scalar, or INT32_MAX if the scalar has to
+		 *	                     fit on a single line (like mapping keys)
+		 */
+		int32 ParsePlain(bool inFlow, int32 parentIndent)
+		{
+			const int32 line = Line;
+			const uint8* start = Cur;
+			const uint8* last = ScanPlainLine(inFlow);
+
+			FScratch folded;
+			bool multiLine = false;
+			while (parentIndent != TNumericLimits<int32>::Max() && Cur < End && IsLineBreak(*Cur))
+			{
+				int32 breaks;
+				const uint8* lineBegin;
+				const uint8* continuation = FindPlainContinuation(inFlow, parentIndent, breaks, lineBegin);
+				if (!continuation) break;
+
+				if (!multiLine)
+				{
+					folded.Append(start, last - start);
+					multiLine = true;
+				}
+				if (breaks == 1) folded.Add(' ');
+				else AppendLineFeeds(folded, breaks - 1);
+
+				Line += breaks;
+				LineStart = lineBegin;
+				Cur = continuation;
+				last = ScanPlainLine(inFlow);
+				folded.Append(continuation, last - continuation);
+			}
+			Cur = last;
+			return multiLine
+				? AddScalar(Store(folded), true, line)
+				: AddScalar(MakeView(start, last - start), true, line);
+		}
+
+		int32 ParseScalar(bool inFlow, int32 parentIndent = TNumericLimits<int32>::Max())
+		{
+			const uint8 c = *Cur;
+			switch (c)
+			{
+			case '\'': return ParseSingleQuoted();
+			case '"':  return ParseDoubleQuoted();
+			case '&':  return Fail(TEXT_"anchors are not supported");
+			case '*':  return Fail(TEXT_"aliases are not supported");
+			case '!':  return Fail(TEXT_"tags are not supported");
+			case '%':  return Fail(TEXT_"directives are not supported");
+			case '@':
+			case '`':  return Fail(TEXT_"plain scalars can't start with a reserved indicator");
+			case '|':
+			case '>':  return Fail(TEXT_"block scalars are only allowed as values in block collections");
+			case '?':
+				if (IsBlank(At(Cur + 1))) return Fail(TEXT_"complex mapping keys are not supported");
+				break;
+			default:
+				if (inFlow && IsFlowIndicator(c)) return Fail(TEXT_"expected a value in flow collection");
+				break;
+			}
+			return ParsePlain(inFlow, parentIndent);
+		}
+
+		int32 ParseFlowNode()
+		{
+			FDepthGuard guard(Depth);
+			if (Depth > MaxNestingDepth) return Fail(TEXT_"collections are nested too deeply");
+
+			if (*Cur == '[') return ParseFlowSequence();
+			if (*Cur == '{') return ParseFlowMap();
+			return ParseScalar(true, -1);
+		}
+
+		int32 ParseFlowSequence()
+		{
+			const int32 line = Line;
+			const int32 node = AddNode(EMappedYamlNodeType::Sequence, line);
+			const int32 stackStart = ChildStack.Num();
+			++Cur;
+			for (;;)
+			{
+				SkipFlowSpace();
+				if (Cur >= End) return Fail(TEXT_"unterminated flow sequence", line);
+				if (*Cur == ']') break;
+
+				const int32 child = ParseFlowNode();
+				if (child == INDEX_NONE) return INDEX_NONE;
+				ChildStack.Add(child);
+
+				SkipFlowSpace();
+				if (Cur >= End) return Fail(TEXT_"unterminated flow sequence", line);
+				if (*Cur == ']') break;
+				if (*Cur == ':') return Fail(TEXT_"single pair mappings inside flow sequences are not supported");
+				if (*Cur != ',') return Fail(TEXT_"expected ',' or ']' in flow sequence");
+				++Cur;
+			}
+			++Cur;
+			FinishContainer(node, stackStart);
+			return node;
+		}
+
+		int32 ParseFlowMap()
+		{
+			const int32 line = Line;
+			const int32 node = AddNode(EMappedYamlNodeType::Map, line);
+			const int32 stackStart = ChildStack.Num();
+			++Cur;
+			for (;;)
+			{
+				SkipFlowSpace();
+				if (Cur >= End) return Fail(TEXT_"unterminated flow mapping", line);
+				if (*Cur == '}') break;
+				if (*Cur == '[' || *Cur == '{') return Fail(TEXT_"collections as mapping keys are not supported");
+
+				const int32 key = ParseScalar(true);
+				if (key == INDEX_NONE) return INDEX_NONE;
+
+				SkipFlowSpace();
+				if (Cur >= End) return Fail(TEXT_"unterminated flow mapping", line);
+
+				int32 value;
+				if (*Cur == ':')
+				{
+					++Cur;
+					SkipFlowSpace();
+					if (Cur >= End) return Fail(TEXT_"unterminated flow mapping", line);
+					value = *Cur == ',' || *Cur == '}'
+						? AddNode(EMappedYamlNodeType::Null, Line)
+						: ParseFlowNode();
+					if (value == INDEX_NONE) return INDEX_NONE;
+
+					SkipFlowSpace();
+					if (Cur >= End) return Fail(TEXT_"unterminated flow mapping", line);
+				}
+				else value = AddNode(EMappedYamlNodeType::Null, Line);
+
+				ChildStack.Add(key);
+				ChildStack.Add(value);
+
+				if (*Cur == '}') break;
+				if (*Cur != ',') return Fail(TEXT_"expected ',' or '}' in flow mapping");
+				++Cur;
+			}
+			++Cur;
+			FinishContainer(node, stackStart);
+			return node;
+		}
+
+		/** @brief Literal `|` and folded `>` block scalars. They are always decoded into the arena */
+		int32 ParseBlockScalar(int32 parentIndent)
+		{
+			enum class EChomping { Clip, Strip, Keep };
+
+			const int32 line = Line;
+			const bool folded = *Cur == '>';
+			++Cur;
+
+			EChomping chomping = EChomping::Clip;
+			int32 explicitIndent = 0;
+			for (int32 i = 0; i < 2; ++i)
+			{
+				const uint8 c = At(Cur);
+				if (chomping == EChomping::Clip && (c == '-' || c == '+'))
+					chomping = c == '-' ? EChomping::Strip : EChomping::Keep;
+				else if (explicitIndent == 0 && c >= '1' && c <= '9')
+					explicitIndent = c - '0';
+				else break;
+				++Cur;
+			}
+			SkipSpaces();
+			if (!AtCommentOrLineEnd()) return Fail(TEXT_"unexpected characters after block scalar header");
+			NextLine();
+
+			int32 contentIndent;
+			if (explicitIndent > 0)
+				contentIndent = FMath::Max(parentIndent, 0) + explicitIndent;
+			else
+			{
+				// Indentation of the block is taken from its first non-empty line
+				contentIndent = parentIndent + 1;
+				for (const uint8* position = Cur; position < End;)
+				{
+					const uint8* lineBegin = position;
+					while (position < End && *position == ' ') ++position;
+					if (position < End && !IsLineBreak(*position))
+					{
+						contentIndent = FMath::Max(contentIndent, static_cast<int32>(position - lineBegin));
+						break;
+					}
+					while (position < End && *position != '\n') ++position;
+					if (position < End) ++position;
+				}
+			}
+
+			FScratch output;
+			int32 emptyLines = 0;
+			bool hasContent = false;
+			bool previousMoreIndented = false;
+			bool endsWithBreak = false;
+			while (Cur < End)
+			{
+				const uint8* position = Cur;
+				while (position < End && *position == ' ') ++position;
+				const bool isEmpty = position >= End || IsLineBreak(*position);
+				if (!isEmpty && position - Cur < contentIndent) break;
+
+				if (isEmpty)
+				{
+					++emptyLines;
+					NextLine();
+					continue;
+				}
+
+				const uint8* textStart = Cur + contentIndent;
+				const uint8* textEnd = textStart;
+				while (textEnd < End && *textEnd != '\n') ++textEnd;
+				endsWithBreak = textEnd < End;
+				if (textEnd > textStart && textEnd[-1] == '\r') --textEnd;
+
+				const bool moreIndented = IsSpace(*textStart);
+				int32 breaks = emptyLines;
+				if (hasContent)
+				{
+					if (folded && !previousMoreIndented && !moreIndented && emptyLines == 0)
+					{
+						output.Add(' ');
+						breaks = 0;
+					}
+					else if (!folded || previousMoreIndented || moreIndented)
+						++breaks;
+				}
+				AppendLineFeeds(output, breaks);
+				output.Append(textStart, static_cast<int32>(textEnd - textStart));
+
+				hasContent = true;
+				previousMoreIndented = moreIndented;
+				emptyLines = 0;
+				NextLine();
+			}
+
+			int32 trailing = 0;
+			switch (chomping)
+			{
+			case EChomping::Strip: break;
+			case EChomping::Clip:  trailing = hasContent && endsWithBreak ? 1 : 0; break;
+			case EChomping::Keep:  trailing = (hasContent && endsWithBreak ? 1 : 0) + emptyLines; break;
+			}
+			AppendLineFeeds(output, trailing);
+
+			return AddScalar(Store(output), false, line);
+		}
+
+		int32 ParseBlockSequence(int32 indent)
+		{
+			const int32 node = AddNode(EMappedYamlNodeType::Sequence, Line);
+			const int32 stackStart = ChildStack.Num();
+			for (;;)
+			{
+				++Cur;
+				SkipSpaces();
+
+				int32 child;
+				if (AtCommentOrLineEnd())
+				{
+					const int32 line = Line;
+					if (!SkipToContent()) return INDEX_NONE;
+					child = !AtBlockEnd() && Column() > indent
+						? ParseBlockNode(indent, false)
+						: AddNode(EMappedYamlNodeType::Null, line);
+				}
+				else child = ParseBlockNode(indent, false);
+
+				if (child == INDEX_NONE || !SkipToContent()) return INDEX_NONE;
+				ChildStack.Add(child);
+
+				if (AtBlockEnd() || Column() < indent) break;
+				if (Column() > indent) return Fail(TEXT_"unexpected indentation");
+
+				// Same indentation but not an entry: the next key of the parent mapping
+				if (!AtSequenceEntry()) break;
+			}
+			FinishContainer(node, stackStart);
+			return node;
+		}
+
+		int32 ParseBlockKey()
+		{
+			if (*Cur == '[' || *Cur == '{') return Fail(TEXT_"collections as mapping keys are not supported");
+			if (AtSequenceEntry()) return Fail(TEXT_"unexpected sequence entry inside a mapping");
+
+			const int32 line = Line;
+			const int32 key = ParseScalar(false);
+			if (key == INDEX_NONE) return INDEX_NONE;
+			if (line != Line) return Fail(TEXT_"mapping keys must fit on a single line", line);
+
+			SkipSpaces();
+			if (Cur >= End || *Cur != ':' || !IsBlank(At(Cur + 1)))
+				return Fail(TEXT_"expected ':' after mapping key");
+			return key;
+		}
+
+		int32 ParseBlockMap(int32 indent, int32 firstKey)
+		{
+			const int32 node = AddNode(EMappedYamlNodeType::Map, Document.Nodes[firstKey].Line);
+			const int32 stackStart = ChildStack.Num();
+			int32 key = firstKey;
+			for (;;)
+			{
+				++Cur;
+				SkipSpaces();
+
+				int32 value;
+				if (AtCommentOrLineEnd())
+				{
+					const int32 line = Line;
+					if (!SkipToContent()) return INDEX_NONE;
+					if (!AtBlockEnd() && Column() > indent)
+						value = ParseBlockNode(indent, false);
+					else if (!AtBlockEnd() && Column() == indent && AtSequenceEntry())
+						value = ParseBlockSequence(indent);
+					else
+						value = AddNode(EMappedYamlNodeType::Null, line);
+				}
+				else value = ParseBlockNode(indent, true);
+
+				if (value == INDEX_NONE || !SkipToContent()) return INDEX_NONE;
+				ChildStack.Add(key);
+				ChildStack.Add(value);
+
+				if (AtBlockEnd() || Column() < indent) break;
+				if (Column() > indent) return Fail(TEXT_"unexpected indentation");
+
+				key = ParseBlockKey();
+				if (key == INDEX_NONE) return INDEX_NONE;
+			}
+			FinishContainer(node, stackStart);
+			return node;
+		}
+
+		/**
+		 *	@brief  Parse the node starting at the current character
+		 *	@param parentIndent  Indentation of the collection containing this node
+		 *	@param     afterKey  The node is on the same line as its mapping key, so it can't be a block collection
+		 */
+		int32 ParseBlockNode(int32 parentIndent, bool afterKey)
+		{
+			FDepthGuard guard(Depth);
+			if (Depth > MaxNestingDepth) return Fail(TEXT_"collections are nested too deeply");
+
+			const int32 column = Column();
+			const uint8 c = *Cur;
+			if (AtSequenceEntry())
+			{
+				if (afterKey) return Fail(TEXT_"block sequences can't start on the same line as their key");
+				return ParseBlockSequence(column);
+			}
+			if (c == '|' || c == '>')
+				return ParseBlockScalar(parentIndent);
+			if (c == '?' && IsBlank(At(Cur + 1)))
+				return Fail(TEXT_"complex mapping keys are not supported");
+
+			const int32 line = Line;
+			const int32 node = c == '[' || c == '{' ? ParseFlowNode() : ParseScalar(false, parentIndent);
+			if (node == INDEX_NONE) return INDEX_NONE;
+
+			SkipSpaces();
+			if (Cur < End && *Cur == ':' && IsBlank(At(Cur + 1)))
+			{
+				if (afterKey) return Fail(TEXT_"nested mappings can't start on the same line as their key");
+				if (c == '[' || c == '{') return Fail(TEXT_"collections as mapping keys are not supported", line);
+				if (line != Line) return Fail(TEXT_"mapping keys must fit on a single line", line);
+				return ParseBlockMap(column, node);
+			}
+			if (!AtCommentOrLineEnd())
+				return Fail(TEXT_"unexpected characters after value");
+			return node;
+		}
+	};
+
+	namespace Detail
+	{
+		struct FMappedYamlSource
+		{
+			TUniquePtr<IMappedFileHandle> File;
+			TUniquePtr<IMappedFileRegion> Region;
+			TArray<uint8> Owned;
+			TArrayView<const uint8> Contents;
+
+			~FMappedYamlSource()
+			{
+				// Release the region before the file it was mapped from
+				Region.Reset();
+				File.Reset();
+			}
+		};
+	}
+
+	namespace
+	{
+		using FSourceRef = TSharedRef<Detail::FMappedYamlSource>;
+
+		/** @brief Documents of a stream smaller than this are parsed on the calling thread */
+		constexpr int32 ParallelParseMinSize = 64 * 1024;
+
+		TMaybe<FSourceRef> OpenSource(FString const& path)
+		{
+			FSourceRef source = MakeShared<Detail::FMappedYamlSource>();
+
+			IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+			if (auto mapped = platformFile.OpenMappedEx(*path); mapped.HasValue())
+			{
+				source->File = mapped.StealValue();
+				const int64 size = source->File->GetFileSize();
+				if (size > 0 && size <= MAX_int32)
+					source->Region.Reset(source->File->MapRegion(0, size));
+			}
+
+			if (source->Region)
+			{
+				source->Contents = TArrayView<const uint8>(
+					source->Region->GetMappedPtr(),
+					static_cast<int32>(source->Region->GetMappedSize())
+				);
+				return source;
+			}
+
+			// Empty files can't be mapped, and some platforms can't map files at all
+			source->File.Reset();
+			if (!FFileHelper::LoadFileToArray(source->Owned, *path, FILEREAD_Silent))
+			{
+				return IError::Make(new FAssertion())
+					->WithMessage(TEXT_"Couldn't open YAML file")
+					->WithAppendix(TEXT_"File", path);
+			}
+			source->Contents = source->Owned;
+			return source;
+		}
+
+		FSourceRef MakeSource(TArray<uint8>&& contents)
+		{
+			FSourceRef source = MakeShared<Detail::FMappedYamlSource>();
+			source->Owned = MoveTemp(contents);
+			source->Contents = source->Owned;
+			return source;
+		}
+
+		struct FDocumentRange
+		{
+			int32 Begin;
+			int32 End;
+			int32 FirstLine;
+		};
+
+		/**
+		 *	@brief
+		 *	Find the documents of a stream. Document markers at the start of a line can't be part of any scalar, so
+		 *	lines can be checked without parsing. A document starts at `---` and ends before the next `---` or
+		 *	after `...`. Ranges without a `---` and without content (only comments) are dropped.
+		 */
+		TArray<FDocumentRange> SplitDocuments(TArrayView<const uint8> contents)
+		{
+			TArray<FDocumentRange> result;
+			const uint8* data = contents.GetData();
+			const int32 size = contents.Num();
+
+			int32 lineStart = size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF ? 3 : 0;
+			int32 line = 1;
+			FDocumentRange current { lineStart, size, 1 };
+			bool explicitStart = false;
+			bool hasContent = false;
+
+			auto finish = [&](int32 end)
+			{
+				if (explicitStart || hasContent)
+					result.Add({ current.Begin, end, current.FirstLine });
+			};
+
+			while (lineStart < size)
+			{
+				auto lineBreak = static_cast<const uint8*>(std::memchr(data + lineStart, '\n', size - lineStart));
+				const int32 lineEnd = lineBreak ? static_cast<int32>(lineBreak - data) + 1 : size;
+
+				const uint8 first = data[lineStart];
+				const bool isMarker = (first == '-' || first == '.') && lineEnd - lineStart >= 3
+					&& data[lineStart + 1] == first && data[lineStart + 2] == first
+					&& (lineStart + 3 >= size || IsBlank(data[lineStart + 3]));
+
+				if (isMarker && first == '-')
+				{
+					finish(lineStart);
+					current = { lineStart, size, line };
+					explicitStart = true;
+					hasContent = false;
+				}
+				else if (isMarker)
+				{
+					finish(lineEnd);
+					current = { lineEnd, size, line + 1 };
+					explicitStart = false;
+					hasContent = false;
+				}
+				else if (!hasContent)
+				{
+					int32 position = lineStart;
+					while (position < lineEnd && IsSpace(data[position])) ++position;
+					hasContent = position < lineEnd && data[position] != '#' && !IsLineBreak(data[position]);
+				}
+				lineStart = lineEnd;
+				++line;
+			}
+			finish(size);
+			return result;
+		}
+	}
+
+	FMappedYamlDocument::~FMappedYamlDocument() = default;
+
+	TMaybe<TSharedRef<FMappedYamlDocument>> FMappedYamlDocument::Load(FString const& path)
+	{
+		auto source = OpenSource(path);
+		if (source.HasError()) return source.GetErrorRef();
+
+		TSharedRef<FMappedYamlDocument> document = MakeShareable(new FMappedYamlDocument());
+		document->Source = source.GetValue();
+		document->Contents = source.GetValue()->Contents;
+
+		if (auto result = document->ParseContents(path); result.HasError())
+			return result.GetErrorRef();
+		return document;
+	}
+
+	namespace
+	{
+		/** @brief The number of cached trees kept in a cache directory, least recently used ones are deleted above it */
+		constexpr int32 MaxCachedTrees = 256;
+
+		void PruneYamlCache(FString const& directory)
+		{
+			TArray<TPair<FDateTime, FString>> entries;
+			IFileManager::Get().IterateDirectoryStat(*directory, [&](const TCHAR* path, FFileStatData const& stat)
+			{
+				if (!stat.bIsDirectory && FStringView(path).EndsWith(TEXTVIEW_".ymlc"))
+					entries.Emplace(stat.ModificationTime, path);
+				return true;
+			});
+			if (entries.Num() <= MaxCachedTrees) return;
+
+			entries.Sort([](auto const& left, auto const& right) { return left.Key < right.Key; });
+			for (int32 i = 0; i < entries.Num() - MaxCachedTrees; ++i)
+				IFileManager::Get().Delete(*entries[i].Value, false, false, true);
+		}
+	}
+
+	TMaybe<TSharedRef<FMappedYamlDocument>> FMappedYamlDocument::LoadCached(FString const& path, FString const& cacheDirectory)
+	{
+		auto source = OpenSource(path);
+		if (source.HasError()) return source.GetErrorRef();
+
+		TSharedRef<FMappedYamlDocument> document = MakeShareable(new FMappedYamlDocument());
+		document->Source = source.GetValue();
+		document->Contents = source.GetValue()->Contents;
+
+		const uint64 contentHash = HashBytes(document->Contents.GetData(), document->Contents.Num());
+		const FString directory = cacheDirectory.IsEmpty()
+			? FPaths::ProjectSavedDir() / TEXT_"Mcro" / TEXT_"YamlCache"
+			: cacheDirectory;
+		const FString cachePath = directory / FString::Printf(TEXT_"%016llx.ymlc", contentHash);
+
+		TArray<uint8> cache;
+		if (FFileHelper::LoadFileToArray(cache, *cachePath, FILEREAD_Silent) && document->ReadCache(cache, contentHash))
+		{
+			// Keep the modification time as the last use, so pruning deletes the least recently used trees
+			IFileManager::Get().SetTimeStamp(*cachePath, FDateTime::UtcNow());
+			return document;
+		}
+
+		if (auto result = document->ParseContents(path); result.HasError())
+			return result.GetErrorRef();
+
+		// Write a temporary file first, so concurrent loads never see a partially written cache
+		const FString temporaryPath = FPaths::CreateTempFilename(*FPaths::GetPath(cachePath), TEXT_"YamlCache", TEXT_".tmp");
+		if (FFileHelper::SaveArrayToFile(document->WriteCache(contentHash), *temporaryPath)
+			&& !IFileManager::Get().Move(*cachePath, *temporaryPath, true, true, false, true)
+		) IFileManager::Get().Delete(*temporaryPath, false, false, true);
+		PruneYamlCache(directory);
+		return document;
+	}
+
+	TMaybe<TSharedRef<FMappedYamlDocument>> FMappedYamlDocument::Parse(TArray<uint8>&& contents)
+	{
+		TSharedRef<FMappedYamlDocument> document = MakeShareable(new FMappedYamlDocument());
+		document->Source = MakeSource(MoveTemp(contents));
+		document->Contents = document->Source->Contents;
+
+		if (auto result = document->ParseContents({}); result.HasError())
+			return result.GetErrorRef();
+		return document;
+	}
+
+	TMaybe<TArray<TSharedRef<FMappedYamlDocument>>> FMappedYamlDocument::LoadAll(FString const& path)
+	{
+		auto source = OpenSource(path);
+		if (source.HasError()) return source.GetErrorRef();
+		return ParseStream(source.GetValue(), path);
+	}
+
+	TMaybe<TArray<TSharedRef<FMappedYamlDocument>>> FMappedYamlDocument::ParseAll(TArray<uint8>&& contents)
+	{
+		return ParseStream(MakeSource(MoveTemp(contents)), {});
+	}
+
+	TMaybe<TArray<TSharedRef<FMappedYamlDocument>>> FMappedYamlDocument::ParseStream(
+		TSharedRef<Detail::FMappedYamlSource> const& source,
+		FString const& sourceName
+	) {
+		const TArray<FDocumentRange> ranges = SplitDocuments(source->Contents);
+
+		TArray<TSharedRef<FMappedYamlDocument>> documents;
+		documents.Reserve(ranges.Num());
+		for (auto const& range : ranges)
+		{
+			TSharedRef<FMappedYamlDocument> document = MakeShareable(new FMappedYamlDocument());
+			document->Source = source;
+			document->Contents = source->Contents.Slice(range.Begin, range.End - range.Begin);
+			documents.Add(document);
+		}
+
+		TArray<IErrorPtr> errors;
+		errors.SetNum(documents.Num());
+		ParallelFor(
+			documents.Num(),
+			[&](int32 index)
+			{
+				if (auto result = documents[index]->ParseContents(sourceName, ranges[index].FirstLine); result.HasError())
+					errors[index] = result.GetErrorRef();
+			},
+			documents.Num() < 2 || source->Contents.Num() < ParallelParseMinSize
+				? EParallelForFlags::ForceSingleThread
+				: EParallelForFlags::Unbalanced
+		);
+
+		for (int32 i = 0; i < errors.Num(); ++i)
+		{
+			if (errors[i])
+				return errors[i].ToSharedRef()->WithAppendix(TEXT_"Document", FString::FromInt(i));
+		}
+		return documents;
+	}
+
+	FCanFail FMappedYamlDocument::ParseContents(FString const& sourceName, int32 firstLine)
+	{
+		MCRO_TRACE_SCOPE(Yaml, "FMappedYamlDocument::Parse");
+		FMappedYamlParser parser(*this, firstLine);
+		if (parser.Parse()) return Success();
+
+		return IError::Make(new FAssertion())
+			->WithMessageF(TEXT_"YAML syntax error at line {0}: {1}", parser.GetErrorLine(), parser.GetError())
+			->WithAppendix(TEXT_"File", sourceName, !sourceName.IsEmpty());
+	}
+
+	namespace
+	{
+		constexpr uint32 CacheMagic = 0x434C4D59; // "YMLC"
+		constexpr uint32 CacheVersion = 1;
+
+		enum ECachedNodeFlags : uint8
+		{
+			CachedNode_Plain   = 1 << 0,
+			CachedNode_Decoded = 1 << 1,
+		};
+
+		struct FCacheHeader
+		{
+			uint32 Magic;
+			uint32 Version;
+			uint64 ContentHash;
+			int64 ContentSize;
+			int32 NodeCount;
+			int32 ChildCount;
+			int32 DecodedSize;
+			int32 Root;
+		};
+
+		/** @brief Scalars are stored as offsets, either into the source contents or into the decoded blob */
+		struct FCachedNode
+		{
+			uint8 Type;
+			uint8 Flags;
+			uint16 Padding;
+			int32 Line;
+			int32 FirstChild;
+			int32 ChildCount;
+			int32 ScalarOffset;
+			int32 ScalarLength;
+		};
+	}
+
+	TArray<uint8> FMappedYamlDocument::WriteCache(uint64 contentHash) const
+	{
+		const uint8* contentsBegin = Contents.GetData();
+		const uint8* contentsEnd = contentsBegin + Contents.Num();
+
+		TArray<FCachedNode> cachedNodes;
+		cachedNodes.Reserve(Nodes.Num());
+		TArray<uint8> decoded;
+		for (auto const& node : Nodes)
+		{
+			auto scalar = reinterpret_cast<const uint8*>(node.Scalar.GetData());
+			const bool inSource = scalar >= contentsBegin && scalar < contentsEnd;
+			const bool isDecoded = !node.Scalar.IsEmpty() && !inSource;
+
+			FCachedNode& cached = cachedNodes.AddZeroed_GetRef();
+			cached.Type = static_cast<uint8>(node.Type);
+			cached.Flags = (node.bPlain ? CachedNode_Plain : 0) | (isDecoded ? CachedNode_Decoded : 0);
+			cached.Line = node.Line;
+			cached.FirstChild = node.FirstChild;
+			cached.ChildCount = node.ChildCount;
+			cached.ScalarLength = node.Scalar.Len();
+			if (isDecoded)
+			{
+				cached.ScalarOffset = decoded.Num();
+				decoded.Append(scalar, node.Scalar.Len());
+			}
+			else if (inSource)
+				cached.ScalarOffset = static_cast<int32>(scalar - contentsBegin);
+		}
+
+		const FCacheHeader header {
+			CacheMagic, CacheVersion, contentHash, Contents.Num(),
+			Nodes.Num(), Children.Num(), decoded.Num(), Root
+		};
+
+		TArray<uint8> result;
+		result.Reserve(sizeof(FCacheHeader) + cachedNodes.NumBytes() + Children.NumBytes() + decoded.Num());
+		result.Append(reinterpret_cast<const uint8*>(&header), sizeof(FCacheHeader));
+		result.Append(reinterpret_cast<const uint8*>(cachedNodes.GetData()), cachedNodes.NumBytes());
+		result.Append(reinterpret_cast<const uint8*>(Children.GetData()), Children.NumBytes());
+		result.Append(decoded);
+		return result;
+	}
+
+	bool FMappedYamlDocument::ReadCache(TArray<uint8> const& cache, uint64 contentHash)
+	{
+		if (cache.Num() < static_cast<int32>(sizeof(FCacheHeader))) return false;
+
+		FCacheHeader header;
+		FMemory::Memcpy(&header, cache.GetData(), sizeof(FCacheHeader));
+		if (header.Magic != CacheMagic
+			|| header.Version != CacheVersion
+			|| header.ContentHash != contentHash
+			|| header.ContentSize != Contents.Num()
+			|| header.NodeCount <= 0 || header.ChildCount < 0 || header.DecodedSize < 0
+			|| header.Root < 0 || header.Root >= header.NodeCount
+		) return false;
+
+		const int64 expectedSize = sizeof(FCacheHeader)
+			+ static_cast<int64>(header.NodeCount) * sizeof(FCachedNode)
+			+ static_cast<int64>(header.ChildCount) * sizeof(int32)
+			+ header.DecodedSize;
+		if (cache.Num() != expectedSize) return false;
+
+		const uint8* position = cache.GetData() + sizeof(FCacheHeader);
+		TArray<FCachedNode> cachedNodes;
+		cachedNodes.SetNumUninitialized(header.NodeCount);
+		FMemory::Memcpy(cachedNodes.GetData(), position, cachedNodes.NumBytes());
+		position += cachedNodes.NumBytes();
+
+		TArray<int32> children;
+		children.SetNumUninitialized(header.ChildCount);
+		FMemory::Memcpy(children.GetData(), position, children.NumBytes());
+		position += children.NumBytes();
+
+		// Every node may only be the child of a single parent, and the root of none. Otherwise a corrupted cache
+		// could make a node its own descendant, and traversing the tree would never end.
+		TBitArray<> hasParent(false, header.NodeCount);
+		for (int32 child : children)
+		{
+			if (child < 0 || child >= header.NodeCount || child == header.Root || hasParent[child]) return false;
+			hasParent[child] = true;
+		}
+
+		TUniquePtr<UTF8CHAR[]> decoded;
+		if (header.DecodedSize > 0)
+		{
+			decoded = MakeUniqueForOverwrite<UTF8CHAR[]>(header.DecodedSize);
+			FMemory::Memcpy(decoded.Get(), position, header.DecodedSize);
+		}
+
+		// The cache only has to be as trustworthy as the file system, but a corrupted one must not crash
+		TArray<Detail::FMappedYamlNodeData> nodes;
+		nodes.SetNum(header.NodeCount);
+		for (int32 i = 0; i < header.NodeCount; ++i)
+		{
+			auto const& cached = cachedNodes[i];
+			if (cached.Type > static_cast<uint8>(EMappedYamlNodeType::Map)
+				|| cached.FirstChild < 0 || cached.ChildCount < 0
+				|| cached.FirstChild > header.ChildCount - cached.ChildCount
+				|| cached.ScalarOffset < 0 || cached.ScalarLength < 0
+			) return false;
+
+			const bool isDecoded = (cached.Flags & CachedNode_Decoded) != 0;
+			const int32 available = isDecoded ? header.DecodedSize : Contents.Num();
+			if (cached.ScalarOffset > available - cached.ScalarLength) return false;
+
+			auto& node = nodes[i];
+			node.Type = static_cast<EMappedYamlNodeType>(cached.Type);
+			node.bPlain = (cached.Flags & CachedNode_Plain) != 0;
+			node.Line = cached.Line;
+			node.FirstChild = cached.FirstChild;
+			node.ChildCount = cached.ChildCount;
+			if (cached.ScalarLength > 0)
+			{
+				node.Scalar = isDecoded
+					? FUtf8StringView(decoded.Get() + cached.ScalarOffset, cached.ScalarLength)
+					: MakeView(Contents.GetData() + cached.ScalarOffset, cached.ScalarLength);
+			}
+		}
+
+		Nodes = MoveTemp(nodes);
+		Children = MoveTemp(children);
+		if (decoded) DecodedChunks.Add(MoveTemp(decoded));
+		Root = header.Root;
+		bFromCache = true;
+		return true;
+	}
+
+	Detail::FMappedYamlNodeData const* FMappedYamlNode::GetData() const
+	{
+		return Document ? &Document->Nodes[Index] : nullptr;
+	}
+
+	FMappedYamlNode FMappedYamlNode::GetChild(int32 childIndex) const
+	{
+		return FMappedYamlNode(Document, Document->Children[GetData()->FirstChild + childIndex]);
+	}
+
+	EMappedYamlNodeType FMappedYamlNode::GetType() const
+	{
+		auto data = GetData();
+		return data ? data->Type : EMappedYamlNodeType::Null;
+	}
+
+	bool FMappedYamlNode::IsNull() const
+	{
+		auto data = GetData();
+		if (!data) return false;
+		if (data->Type == EMappedYamlNodeType::Null) return true;
+		return data->Type == EMappedYamlNodeType::Scalar && data->bPlain
+			&& ScalarIsAnyOf(data->Scalar, {"~", "null", "Null", "NULL"});
+	}
+
+	int32 FMappedYamlNode::GetLine() const
+	{
+		auto data = GetData();
+		return data ? data->Line : 0;
+	}
+
+	FUtf8StringView FMappedYamlNode::GetScalar() const
+	{
+		auto data = GetData();
+		return data && data->Type == EMappedYamlNodeType::Scalar ? data->Scalar : FUtf8StringView();
+	}
+
+	int32 FMappedYamlNode::Num() const
+	{
+		auto data = GetData();
+		if (!data) return 0;
+		switch (data->Type)
+		{
+		case EMappedYamlNodeType::Sequence: return data->ChildCount;
+		case EMappedYamlNodeType::Map:      return data->ChildCount / 2;
+		default:                            return 0;
+		}
+	}
+
+	FMappedYamlNode FMappedYamlNode::operator [] (int32 index) const
+	{
+		if (index < 0 || index >= Num()) return {};
+		return GetChild(IsMap() ? index * 2 + 1 : index);
+	}
+
+	FMappedYamlNode FMappedYamlNode::operator [] (FUtf8StringView key) const
+	{
+		if (!IsMap()) return {};
+		const int32 count = Num();
+		for (int32 i = 0; i < count; ++i)
+		{
+			if (GetChild(i * 2).GetScalar().Equals(key, ESearchCase::CaseSensitive))
+				return GetChild(i * 2 + 1);
+		}
+		return {};
+	}
+
+	FMappedYamlNode FMappedYamlNode::GetKey(int32 index) const
+	{
+		if (!IsMap() || index < 0 || index >= Num()) return {};
+		return GetChild(index * 2);
+	}
+
+	FString FMappedYamlNode::AsString() const
+	{
+		FUtf8StringView scalar = GetScalar();
+		if (scalar.IsEmpty()) return {};
+
+		auto converted = StringCast<TCHAR>(scalar.GetData(), scalar.Len());
+		return FString::ConstructFromPtrSize(converted.Get(), converted.Length());
+	}
+
+	FName FMappedYamlNode::AsName() const
+	{
+		FUtf8StringView scalar = GetScalar();
+		if (scalar.IsEmpty()) return NAME_None;
+
+		return Text::Detail::FindOrAddCachedName(
+			scalar.GetData(), scalar.Len() * sizeof(UTF8CHAR),
+			GetCompileTimeTypeHash<UTF8CHAR>(),
+			[&]
+			{
+				auto converted = StringCast<TCHAR>(scalar.GetData(), scalar.Len());
+				return FName(converted.Length(), converted.Get());
+			}
+		);
+	}
+
+	FText FMappedYamlNode::AsText() const
+	{
+		return FText::FromString(AsString());
+	}
+
+	TOptional<bool> FMappedYamlNode::AsBool() const
+	{
+		FUtf8StringView scalar = GetScalar();
+		if (ScalarIsAnyOf(scalar, {"true", "True", "TRUE", "yes", "Yes", "YES", "on", "On", "ON"}))
+			return true;
+		if (ScalarIsAnyOf(scalar, {"false", "False", "FALSE", "no", "No", "NO", "off", "Off", "OFF"}))
+			return false;
+		return {};
+	}
+
+	TOptional<int64> FMappedYamlNode::AsInt() const
+	{
+		FUtf8StringView scalar = GetScalar();
+		const UTF8CHAR* position = scalar.GetData();
+		const UTF8CHAR* end = position + scalar.Len();
+		if (position == end) return {};
+
+		const bool negative = *position == '-';
+		if (*position == '-' || *position == '+') ++position;
+
+		uint64 base = 10;
+		if (end - position > 2 && position[0] == '0' && (position[1] == 'x' || position[1] == 'o'))
+		{
+			base = position[1] == 'x' ? 16 : 8;
+			position += 2;
+		}
+		if (position == end) return {};
+
+		uint64 magnitude = 0;
+		for (; position < end; ++position)
+		{
+			const UTF8CHAR c = *position;
+			uint64 digit;
+			if (c >= '0' && c <= '9') digit = c - '0';
+			else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+			else return {};
+			if (digit >= base) return {};
+
+			if (magnitude > (MAX_uint64 - digit) / base) return {};
+			magnitude = magnitude * base + digit;
+		}
+
+		if (negative)
+		{
+			if (magnitude > static_cast<uint64>(MAX_int64) + 1) return {};
+			return static_cast<int64>(0 - magnitude);
+		}
+		if (magnitude > static_cast<uint64>(MAX_int64)) return {};
+		return static_cast<int64>(magnitude);
+	}
+
+	TOptional<double> FMappedYamlNode::AsDouble() const
+	{
+		FUtf8StringView scalar = GetScalar();
+		if (scalar.IsEmpty() || scalar.Len() > 64) return {};
+
+		if (ScalarIsAnyOf(scalar, {".inf", ".Inf", ".INF", "+.inf", "+.Inf", "+.INF"}))
+			return std::numeric_limits<double>::infinity();
+		if (ScalarIsAnyOf(scalar, {"-.inf", "-.Inf", "-.INF"}))
+			return -std::numeric_limits<double>::infinity();
+		if (ScalarIsAnyOf(scalar, {".nan", ".NaN", ".NAN"}))
+			return std::numeric_limits<double>::quiet_NaN();
+
+		// [-+]? (digits (. digits?)? | . digits) ([eE] [-+]? digits)?
+		ANSICHAR buffer[65];
+		const int32 length = scalar.Len();
+		int32 i = 0;
+		auto digits = [&]
+		{
+			const int32 start = i;
+			while (i < length && scalar[i] >= '0' && scalar[i] <= '9') ++i;
+			return i - start;
+		};
+		if (scalar[i] == '-' || scalar[i] == '+') ++i;
+		int32 mantissaDigits = digits();
+		if (i < length && scalar[i] == '.')
+		{
+			++i;
+			mantissaDigits += digits();
+		}
+		if (mantissaDigits == 0) return {};
+		if (i < length && (scalar[i] == 'e' || scalar[i] == 'E'))
+		{
+			++i;
+			if (i < length && (scalar[i] == '-' || scalar[i] == '+')) ++i;
+			if (digits() == 0) return {};
+		}
+		if (i != length) return {};
+
+		FMemory::Memcpy(buffer, scalar.GetData(), length);
+		buffer[length] = 0;
+		return FCStringAnsi::Atod(buffer);
+	}
+}
@@ -0,0 +1,419 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "Mcro/Yaml/Reflection.h"
+#include "Mcro/Trace.h"
+#include "UObject/UnrealType.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
+#include <limits>
+#include <utility>
+
+namespace Mcro::Yaml
+{
+	namespace
+	{
+		enum class EStepKind : uint8
+		{
+			Bool,
+			Int8, Int16, Int32, Int64,
+			UInt8, UInt16, UInt32, UInt64,
+			Float, Double,
+			String, Name, Text,
+			Enum,
+			Struct,
+			Array,
+
+			/** @brief Anything else is written and read as its Unreal text export */
+			Exported
+		};
+
+		struct FPlan;
+		const FPlan& GetPlan(const UStruct* type);
+
+		/** @brief How to read and write a single value */
+		struct FStep
+		{
+			EStepKind Kind = EStepKind::Exported;
+			int32 Offset = 0;
+			int32 ArrayDim = 1;
+			int32 ElementSize = 0;
+			std::string Key;
+			const FProperty* Property = nullptr;
+			const UEnum* Enum = nullptr;
+			const FNumericProperty* Underlying = nullptr;
+			const UStruct* NestedType = nullptr;
+			TUniquePtr<FStep> Inner;
+
+			// Resolved on first use, so self-referencing structs (via arrays) don't recurse while building the plan
+			mutable std::atomic<const FPlan*> Nested { nullptr };
+
+			const FPlan& GetNested() const
+			{
+				const FPlan* nested = Nested.load(std::memory_order_acquire);
+				if (!nested) [[unlikely]]
+				{
+					nested = &GetPlan(NestedType);
+					Nested.store(nested, std::memory_order_release);
+				}
+				return *nested;
+			}
+		};
+
+		struct FPlan
+		{
+			FWeakObjectPtr Type;
+			TArray<TUniquePtr<FStep>> Steps;
+		};
+
+		std::string ToUtf8(FStringView string)
+		{
+			FTCHARToUTF8 converted(string.GetData(), string.Len());
+			return std::string(converted.Get(), converted.Length());
+		}
+
+		FString FromUtf8(std::string const& string)
+		{
+			FUTF8ToTCHAR converted(string.data(), static_cast<int32>(string.size()));
+			return FString::ConstructFromPtrSize(converted.Get(), converted.Length());
+		}
+
+		TUniquePtr<FStep> MakeStep(const FProperty* property)
+		{
+			auto step = MakeUnique<FStep>();
+			step->Property = property;
+			step->Offset = property->GetOffset_ForInternal();
+			step->ArrayDim = property->ArrayDim;
+			step->ElementSize = property->GetElementSize();
+			step->Key = ToUtf8(property->GetAuthoredName());
+
+			if      (CastField<FBoolProperty>(property))   step->Kind = EStepKind::Bool;
+			else if (CastField<FInt8Property>(property))   step->Kind = EStepKind::Int8;
+			else if (CastField<FInt16Property>(property))  step->Kind = EStepKind::Int16;
+			else if (CastField<FIntProperty>(property))    step->Kind = EStepKind::Int32;
+			else if (CastField<FInt64Property>(property))  step->Kind = EStepKind::Int64;
+			else if (CastField<FUInt16Property>(property)) step->Kind = EStepKind::UInt16;
+			else if (CastField<FUInt32Property>(property)) step->Kind = EStepKind::UInt32;
+			else if (CastField<FUInt64Property>(property)) step->Kind = EStepKind::UInt64;
+			else if (CastField<FFloatProperty>(property))  step->Kind = EStepKind::Float;
+			else if (CastField<FDoubleProperty>(property)) step->Kind = EStepKind::Double;
+			else if (CastField<FStrProperty>(property))    step->Kind = EStepKind::String;
+			else if (CastField<FNameProperty>(property))   step->Kind = EStepKind::Name;
+			else if (CastField<FTextProperty>(property))   step->Kind = EStepKind::Text;
+			else if (auto byteProperty = CastField<FByteProperty>(property))
+			{
+				step->Kind = byteProperty->Enum ? EStepKind::Enum : EStepKind::UInt8;
+				step->Enum = byteProperty->Enum;
+				step->Underlying = byteProperty;
+			}
+			else if (auto enumProperty = CastField<FEnumProperty>(property))
+			{
+				step->Kind = EStepKind::Enum;
+				step->Enum = enumProperty->GetEnum();
+				step->Underlying = enumProperty->GetUnderlyingProperty();
+			}
+			else if (auto structProperty = CastField<FStructProperty>(property))
+			{
+				step->Kind = EStepKind::Struct;
+				step->NestedType = structProperty->Struct;
+			}
+			else if (auto arrayProperty = CastField<FArrayProperty>(property))
+			{
+				step->Kind = EStepKind::Array;
+				step->Inner = MakeStep(arrayProperty->Inner);
+				step->Inner->Offset = 0;
+				step->Inner->ArrayDim = 1;
+			}
+			return step;
+		}
+
+		TUniquePtr<FPlan> BuildPlan(const UStruct* type)
+		{
+			auto plan = MakeUnique<FPlan>();
+			plan->Type = type;
+			for (TFieldIterator<FProperty> it(type); it; ++it)
+			{
+				// Same as what the engine skips when saving properties to config or text
+				if (it->HasAnyPropertyFlags(CPF_Transient | CPF_Deprecated)) continue;
+				plan->Steps.Add(MakeStep(*it));
+			}
+			return plan;
+		}
+
+		struct FPlanCache
+		{
+			FRWLock Lock;
+			TMap<const UStruct*, TUniquePtr<FPlan>> Plans;
+
+			// Plans of destroyed types are kept, because other threads might still run them
+			TArray<TUniquePtr<FPlan>> Retired;
+
+			FPlanCache()
+			{
+				// Hot reload and live coding may reinstance a struct at the same address, with different properties
+				FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([this](EReloadCompleteReason) { RetireAll(); });
+				FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda(
+					[this](FCoreUObjectDelegates::FReplacementObjectMap const&) { RetireAll(); }
+				);
+			}
+
+			void RetireAll()
+			{
+				FWriteScopeLock lock(Lock);
+				for (auto& [type, plan] : Plans)
+				{
+					if (plan) Retired.Add(MoveTemp(plan));
+				}
+				Plans.Empty();
+			}
+		};
+
+		FPlanCache& GetPlanCache()
+		{
+			static FPlanCache cache;
+			return cache;
+		}
+
+		bool IsPlanOf(FPlan const& plan, const UStruct* type)
+		{
+			return plan.Type.Get() == type;
+		}
+
+		const FPlan& GetPlan(const UStruct* type)
+		{
+			FPlanCache& cache = GetPlanCache();
+			{
+				FReadScopeLock lock(cache.Lock);
+				if (auto* plan = cache.Plans.Find(type); plan && IsPlanOf(**plan, type)) [[likely]]
+					return **plan;
+			}
+
+			// Built outside of the lock, nested struct plans are resolved lazily anyway
+			TUniquePtr<FPlan> built = BuildPlan(type);
+
+			FWriteScopeLock lock(cache.Lock);
+			TUniquePtr<FPlan>& entry = cache.Plans.FindOrAdd(type);
+			if (entry && IsPlanOf(*entry, type))
+				return *entry;
+			if (entry)
+				cache.Retired.Add(MoveTemp(entry));
+			entry = MoveTemp(built);
+			return *entry;
+		}
+
+		void WritePlan(YAML::Emitter& out, FPlan const& plan, const uint8* container);
+
+		void WriteValue(YAML::Emitter& out, FStep const& step, const uint8* value)
+		{
+			switch (step.Kind)
+			{
+			case EStepKind::Bool:   out << static_cast<const FBoolProperty*>(step.Property)->GetPropertyValue(value); break;
+			case EStepKind::Int8:   out << static_cast<int32>(*reinterpret_cast<const int8*>(value)); break;
+			case EStepKind::Int16:  out << *reinterpret_cast<const int16*>(value); break;
+			case EStepKind::Int32:  out << *reinterpret_cast<const int32*>(value); break;
+			case EStepKind::Int64:  out << static_cast<long long>(*reinterpret_cast<const int64*>(value)); break;
+			case EStepKind::UInt8:  out << static_cast<uint32>(*value); break;
+			case EStepKind::UInt16: out << *reinterpret_cast<const uint16*>(value); break;
+			case EStepKind::UInt32: out << *reinterpret_cast<const uint32*>(value); break;
+			case EStepKind::UInt64: out << static_cast<unsigned long long>(*reinterpret_cast<const uint64*>(value)); break;
+			case EStepKind::Float:  out << *reinterpret_cast<const float*>(value); break;
+			case EStepKind::Double: out << *reinterpret_cast<const double*>(value); break;
+			case EStepKind::String: out << ToUtf8(*reinterpret_cast<const FString*>(value)); break;
+			case EStepKind::Name:   out << ToUtf8(reinterpret_cast<const FName*>(value)->ToString()); break;
+			case EStepKind::Text:   out << ToUtf8(reinterpret_cast<const FText*>(value)->ToString()); break;
+			case EStepKind::Enum:
+				out << ToUtf8(step.Enum->GetNameStringByValue(step.Underlying->GetSignedIntPropertyValue(value)));
+				break;
+			case EStepKind::Struct:
+				WritePlan(out, step.GetNested(), value);
+				break;
+			case EStepKind::Array:
+			{
+				FScriptArrayHelper array(static_cast<const FArrayProperty*>(step.Property), value);
+				out << YAML::BeginSeq;
+				for (int32 i = 0; i < array.Num(); ++i)
+					WriteValue(out, *step.Inner, array.GetRawPtr(i));
+				out << YAML::EndSeq;
+				break;
+			}
+			case EStepKind::Exported:
+			{
+				FString exported;
+				step.Property->ExportTextItem_Direct(exported, value, nullptr, nullptr, PPF_None);
+				out << ToUtf8(exported);
+				break;
+			}
+			}
+		}
+
+		void WritePlan(YAML::Emitter& out, FPlan const& plan, const uint8* container)
+		{
+			out << YAML::BeginMap;
+			for (auto const& step : plan.Steps)
+			{
+				out << YAML::Key << step->Key << YAML::Value;
+				const uint8* value = container + step->Offset;
+				if (step->ArrayDim == 1)
+					WriteValue(out, *step, value);
+				else
+				{
+					out << YAML::Flow << YAML::BeginSeq;
+					for (int32 i = 0; i < step->ArrayDim; ++i)
+						WriteValue(out, *step, value + i * step->ElementSize);
+					out << YAML::EndSeq;
+				}
+			}
+			out << YAML::EndMap;
+		}
+
+		template <typename Number, typename Decoded>
+		bool ReadNumber(YAML::Node const& node, uint8* value)
+		{
+			Decoded decoded;
+			if (!YAML::convert<Decoded>::decode(node, decoded)) return false;
+			if constexpr (std::is_integral_v<Number>)
+			{
+				if (!std::in_range<Number>(decoded)) return false;
+			}
+			else if (decoded < std::numeric_limits<Number>::lowest() || decoded > std::numeric_limits<Number>::max())
+				return false;
+			*reinterpret_cast<Number*>(value) = static_cast<Number>(decoded);
+			return true;
+		}
+
+		bool ReadString(YAML::Node const& node, FString& result)
+		{
+			std::string decoded;
+			if (!node.IsScalar() || !YAML::convert<std::string>::decode(node, decoded)) return false;
+			result = FromUtf8(decoded);
+			return true;
+		}
+
+		bool ReadPlan(YAML::Node const& node, FPlan const& plan, uint8* container);
+
+		bool ReadValue(YAML::Node const& node, FStep const& step, uint8* value)
+		{
+			switch (step.Kind)
+			{
+			case EStepKind::Bool:
+			{
+				bool decoded;
+				if (!YAML::convert<bool>::decode(node, decoded)) return false;
+				static_cast<const FBoolProperty*>(step.Property)->SetPropertyValue(value, decoded);
+				return true;
+			}
+			case EStepKind::Int8:   return ReadNumber<int8, int64>(node, value);
+			case EStepKind::Int16:  return ReadNumber<int16, int64>(node, value);
+			case EStepKind::Int32:  return ReadNumber<int32, int64>(node, value);
+			case EStepKind::Int64:  return ReadNumber<int64, int64>(node, value);
+			case EStepKind::UInt8:  return ReadNumber<uint8, uint64>(node, value);
+			case EStepKind::UInt16: return ReadNumber<uint16, uint64>(node, value);
+			case EStepKind::UInt32: return ReadNumber<uint32, uint64>(node, value);
+			case EStepKind::UInt64: return ReadNumber<uint64, uint64>(node, value);
+			case EStepKind::Float:  return ReadNumber<float, double>(node, value);
+			case EStepKind::Double: return ReadNumber<double, double>(node, value);
+			case EStepKind::String: return ReadString(node, *reinterpret_cast<FString*>(value));
+			case EStepKind::Name:
+			{
+				FString decoded;
+				if (!ReadString(node, decoded)) return false;
+				*reinterpret_cast<FName*>(value) = FName(decoded);
+				return true;
+			}
+			case EStepKind::Text:
+			{
+				FString decoded;
+				if (!ReadString(node, decoded)) return false;
+				*reinterpret_cast<FText*>(value) = FText::FromString(MoveTemp(decoded));
+				return true;
+			}
+			case EStepKind::Enum:
+			{
+				FString decoded;
+				if (!ReadString(node, decoded)) return false;
+				const int64 enumValue = step.Enum->GetValueByNameString(decoded);
+				if (enumValue == INDEX_NONE) return false;
+				step.Underlying->SetIntPropertyValue(value, enumValue);
+				return true;
+			}
+			case EStepKind::Struct:
+				return ReadPlan(node, step.GetNested(), value);
+			case EStepKind::Array:
+			{
+				if (!node.IsSequence()) return false;
+				FScriptArrayHelper array(static_cast<const FArrayProperty*>(step.Property), value);
+				array.EmptyAndAddValues(static_cast<int32>(node.size()));
+				bool success = true;
+				for (int32 i = 0; i < array.Num(); ++i)
+					success &= ReadValue(node[i], *step.Inner, array.GetRawPtr(i));
+				return success;
+			}
+			case EStepKind::Exported:
+			{
+				FString decoded;
+				if (!ReadString(node, decoded)) return false;
+				return step.Property->ImportText_Direct(*decoded, value, nullptr, PPF_None) != nullptr;
+			}
+			}
+			return false;
+		}
+
+		bool ReadPlan(YAML::Node const& node, FPlan const& plan, uint8* container)
+		{
+			if (!node.IsMap()) return false;
+			bool success = true;
+			for (auto const& step : plan.Steps)
+			{
+				YAML::Node const child = node[step->Key];
+				if (!child) continue;
+
+				uint8* value = container + step->Offset;
+				if (step->ArrayDim == 1)
+					success &= ReadValue(child, *step, value);
+				else if (child.IsSequence() && static_cast<int32>(child.size()) == step->ArrayDim)
+				{
+					for (int32 i = 0; i < step->ArrayDim; ++i)
+						success &= ReadValue(child[i], *step, value + i * step->ElementSize);
+				}
+				else success = false;
+			}
+			return success;
+		}
+	}
+
+	void SerializeStruct(YAML::Emitter& emitter, const UStruct* type, const void* instance)
+	{
+		MCRO_TRACE_SCOPE(Yaml, "Yaml::SerializeStruct");
+		WritePlan(emitter, GetPlan(type), static_cast<const uint8*>(instance));
+	}
+
+	bool DeserializeStruct(YAML::Node const& node, const UStruct* type, void* instance)
+	{
+		MCRO_TRACE_SCOPE(Yaml, "Yaml::DeserializeStruct");
+		return ReadPlan(node, GetPlan(type), static_cast<uint8*>(instance));
+	}
+
+	void SerializeObject(YAML::Emitter& emitter, const UObject* object)
+	{
+		SerializeStruct(emitter, object->GetClass(), object);
+	}
+
+	bool DeserializeObject(YAML::Node const& node, UObject* object)
+	{
+		return DeserializeStruct(node, object->GetClass(), object);
+	}
+}
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Mcro/Ansi/Tracking.h"
 
 /**
  *	@brief
@@ -60,7 +61,11 @@ namespace Mcro::Ansi
 			{
 				check(this != &other);
 
-				if (Data) ::free(Data);
+				if (Data)
+				{
+					Detail::TrackFree(Data);
+					::free(Data);
+				}
 
 				Data = other.Data;
 				other.Data = nullptr;
@@ -69,7 +74,11 @@ namespace Mcro::Ansi
 			/** Destructor. */
 			FORCEINLINE ~ForAnyElementType()
 			{
-				if (Data) ::free(Data);
+				if (Data)
+				{
+					Detail::TrackFree(Data);
+					::free(Data);
+				}
 			}
 
 			// FContainerAllocatorInterface
@@ -138,6 +147,18 @@ namespace Mcro::Ansi
 template <typename T>
 using TAnsiArray = TArray<T, Mcro::Ansi::FAllocator>;
 
+/**
+ *	@brief
+ *	Keeps the first `NumInlineElements` in the container object, and only spills to standard memory allocations
+ *	beyond that.
+ */
+template <uint32 NumInlineElements>
+using TAnsiInlineAllocator = TInlineAllocator<NumInlineElements, Mcro::Ansi::FAllocator>;
+
+/** @brief TArray alias storing its first `NumInlineElements` in-object, with standard memory allocations beyond that */
+template <typename T, uint32 NumInlineElements>
+using TAnsiInlineArray = TArray<T, TAnsiInlineAllocator<NumInlineElements>>;
+
 /** @brief TSet alias which enforces standard memory allocations */
 template <typename T, typename KeyFuncs = DefaultKeyFuncs<T>>
 using TAnsiSet = TSet<T, KeyFuncs, Mcro::Ansi::FSetAllocator>;
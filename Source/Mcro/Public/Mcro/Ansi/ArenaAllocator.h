@@ -0,0 +1,232 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Ansi/Allocator.h"
+
+namespace Mcro::Ansi
+{
+	/**
+	 *	@brief
+	 *	A linear allocator which grows by blocks from `::malloc`. Blocks are kept when the arena is rewound, so after a
+	 *	warm-up, scratch memory of a recurring workload is served without allocations.
+	 *
+	 *	The arena is not thread safe, use one per thread. Containers using FArenaAllocator take memory from the arena of
+	 *	the innermost FArenaScope on the current thread.
+	 */
+	class MCRO_API FArena
+	{
+	public:
+		/** @brief A position in the arena to rewind to */
+		struct FMark
+		{
+			int32 Block = 0;
+			SIZE_T Offset = 0;
+		};
+
+		FArena(SIZE_T blockSize = 64 * 1024);
+		~FArena();
+
+		FArena(const FArena&) = delete;
+		FArena& operator=(const FArena&) = delete;
+
+		void* Allocate(SIZE_T size, SIZE_T alignment = DEFAULT_ALIGNMENT);
+
+		/** @brief Grow or shrink the most recent allocation in place. Returns false for any other allocation. */
+		bool Resize(void* data, SIZE_T size, SIZE_T newSize);
+
+		/** @brief Give back memory, it is only reused if this was the most recent allocation */
+		void Free(void* data, SIZE_T size);
+
+		FMark GetMark() const { return { CurrentBlock, Offset }; }
+
+		/** @brief Invalidate everything allocated after mark, and start a new epoch */
+		void Rewind(FMark const& mark);
+
+		/** @brief Invalidate everything allocated from the arena, keeping its blocks */
+		void Reset() { Rewind({}); }
+
+		/**
+		 *	@brief
+		 *	Incremented on every rewind. Allocations made in a previous epoch are not resized or freed in place anymore,
+		 *	as their memory may have been handed out again.
+		 */
+		uint32 GetEpoch() const { return Epoch; }
+
+		SIZE_T GetReservedBytes() const;
+
+		/** @returns The innermost arena of an FArenaScope on the current thread, or nullptr if there's none */
+		static FArena* GetCurrent();
+
+	private:
+		friend class FArenaScope;
+
+		struct FBlock
+		{
+			uint8* Memory;
+			SIZE_T Size;
+		};
+
+		TAnsiArray<FBlock> Blocks;
+		int32 CurrentBlock = 0;
+		SIZE_T Offset = 0;
+		SIZE_T BlockSize;
+		uint32 Epoch = 0;
+	};
+
+	/**
+	 *	@brief
+	 *	Make FArenaAllocator containers on this thread allocate from given arena, and rewind the arena to its state
+	 *	before the scope when it ends. Containers allocated inside the scope must be destroyed or emptied before it
+	 *	ends.
+	 *
+	 *	@code
+	 *	static thread_local Ansi::FArena scratch;
+	 *	Ansi::FArenaScope scope(scratch);
+	 *	TAnsiArenaArray<FVector> points;
+	 *	TAnsiArenaMap<FName, int32> counts;
+	 *	@endcode
+	 */
+	class MCRO_API FArenaScope
+	{
+	public:
+		FArenaScope(FArena& arena);
+		~FArenaScope();
+
+		FArenaScope(const FArenaScope&) = delete;
+		FArenaScope& operator=(const FArenaScope&) = delete;
+
+	private:
+		FArena& Arena;
+		FArena* Previous;
+		FArena::FMark Mark;
+	};
+
+	/**
+	 *	@brief
+	 *	Container allocator taking memory from the current FArena (see FArenaScope), or from `::realloc` like
+	 *	FAllocator when there's no arena scope on the current thread.
+	 */
+	class MCRO_API FArenaAllocator
+	{
+	public:
+		using SizeType = int32;
+
+		enum { NeedsElementType = false };
+		enum { RequireRangeCheck = true };
+
+		typedef FArenaAllocator ElementAllocator;
+		typedef FArenaAllocator BitArrayAllocator;
+
+		class MCRO_API ForAnyElementType
+		{
+		public:
+			ForAnyElementType() {}
+
+			/**
+			 *	@brief  Moves the state of another allocator into this one.
+			 *	
+			 *	Assumes that the allocator is currently empty, i.e. memory may be allocated but any existing elements
+			 *	have already been destructed (if necessary).
+			 *	
+			 *	@param other  The allocator to move the state from.  This allocator should be left in a valid empty state.
+			 */
+			void MoveToEmpty(ForAnyElementType& other);
+
+			/** Destructor. */
+			FORCEINLINE ~ForAnyElementType()
+			{
+				FreeAllocation();
+			}
+
+			// FContainerAllocatorInterface
+			FORCEINLINE FScriptContainerElement* GetAllocation() const
+			{
+				return Data;
+			}
+			void ResizeAllocation(SizeType currentNum, SizeType newMax, SIZE_T numBytesPerElement);
+			SizeType CalculateSlackReserve(SizeType newMax, SIZE_T numBytesPerElement) const
+			{
+				return DefaultCalculateSlackReserve(newMax, numBytesPerElement, false);
+			}
+			SizeType CalculateSlackShrink(SizeType newMax, SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return DefaultCalculateSlackShrink(newMax, currentMax, numBytesPerElement, false);
+			}
+			SizeType CalculateSlackGrow(SizeType newMax, SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return DefaultCalculateSlackGrow(newMax, currentMax, numBytesPerElement, false);
+			}
+
+			SIZE_T GetAllocatedSize(SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return currentMax * numBytesPerElement;
+			}
+
+			bool HasAllocation() const
+			{
+				return !!Data;
+			}
+
+			SizeType GetInitialCapacity() const
+			{
+				return 0;
+			}
+
+		private:
+			ForAnyElementType(const ForAnyElementType&) = delete;
+			ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+			void FreeAllocation();
+			bool IsLiveInArena() const { return Arena && Arena->GetEpoch() == Epoch; }
+
+			/** A pointer to the container's elements. */
+			FScriptContainerElement* Data = nullptr;
+
+			/** The arena Data was allocated from, or nullptr if it's from `::realloc` */
+			FArena* Arena = nullptr;
+			uint32 Epoch = 0;
+			SIZE_T AllocatedBytes = 0;
+		};
+
+		template<typename ElementType>
+		class ForElementType : public ForAnyElementType
+		{
+		public:
+
+			/** Default constructor. */
+			ForElementType()
+			{}
+
+			FORCEINLINE ElementType* GetAllocation() const
+			{
+				return (ElementType*)ForAnyElementType::GetAllocation();
+			}
+		};
+	};
+
+	/** @brief Allocator for sets to allocate from the current arena */
+	class FArenaSetAllocator : public TSetAllocator<FArenaAllocator, TInlineAllocator<1, FArenaAllocator>> {};
+}
+
+/** @brief TArray alias which allocates from the current Ansi arena */
+template <typename T>
+using TAnsiArenaArray = TArray<T, Mcro::Ansi::FArenaAllocator>;
+
+/** @brief TSet alias which allocates from the current Ansi arena */
+template <typename T, typename KeyFuncs = DefaultKeyFuncs<T>>
+using TAnsiArenaSet = TSet<T, KeyFuncs, Mcro::Ansi::FArenaSetAllocator>;
+
+/** @brief TMap alias which allocates from the current Ansi arena */
+template <typename K, typename V, typename KeyFuncs = TDefaultMapHashableKeyFuncs<K, V, false>>
+using TAnsiArenaMap = TMap<K, V, Mcro::Ansi::FArenaSetAllocator, KeyFuncs>;
@@ -13,10 +13,35 @@
 
 #include "CoreMinimal.h"
 #include "Mcro/Macros.h"
+#include "Mcro/TypeName.h"
+#include "Mcro/Ansi/Tracking.h"
 #include "HAL/MallocAnsi.h"
 
+/**
+ *	@brief
+ *	Serve small `Ansi::New` objects from thread-local free lists of the ANSI heap, instead of calling AnsiMalloc and
+ *	AnsiFree every time. Objects deleted on another thread are given back to the thread which allocated them through
+ *	a lock-free queue. It must be the same for every module, so it's set in Mcro.Build.cs.
+ */
+#ifndef MCRO_ANSI_THREAD_CACHE
+#define MCRO_ANSI_THREAD_CACHE 0
+#endif
+
 namespace Mcro::Ansi
 {
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Allocate from the thread cache of the calling thread, or from AnsiMalloc when the object doesn't fit into
+		 *	its size classes. Only free the result with CachedFree.
+		 */
+		MCRO_API void* CachedMalloc(SIZE_T size, SIZE_T alignment);
+
+		/** @brief Free memory from CachedMalloc on any thread */
+		MCRO_API void CachedFree(void* ptr);
+	}
+
 	/**
 	 *	@brief  Force using the ANSI memory allocation behavior, instead of the Unreal default.
 	 *
@@ -31,7 +56,12 @@ namespace Mcro::Ansi
 	template <typename T, typename... Args>
 	T* New(Args&&... args)
 	{
+#if MCRO_ANSI_THREAD_CACHE
+		T* result = static_cast<T*>(Detail::CachedMalloc(sizeof(T), alignof(T)));
+#else
 		T* result = static_cast<T*>(AnsiMalloc(sizeof(T), alignof(T)));
+#endif
+		Detail::TrackAlloc(result, sizeof(T), alignof(T), { .Name = TypeName::TTypeName<T> });
 		return new (result) T(FWD(args)...);
 	}
 	
@@ -50,6 +80,11 @@ namespace Mcro::Ansi
 	{
 		if (!ptr) return;
 		ptr->~T();
+		Detail::TrackFree(ptr);
+#if MCRO_ANSI_THREAD_CACHE
+		Detail::CachedFree(ptr);
+#else
 		AnsiFree(ptr);
+#endif
 	}
 }
\ No newline at end of file
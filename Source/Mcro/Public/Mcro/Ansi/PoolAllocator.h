@@ -0,0 +1,184 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Ansi/Allocator.h"
+
+namespace Mcro::Ansi
+{
+	/**
+	 *	@brief
+	 *	Process wide pool of `::malloc` blocks in power of two size classes. Freed blocks are kept for reuse, so
+	 *	containers which are repeatedly filled and emptied reach a steady state without allocations. Requests larger
+	 *	than the biggest size class go straight to `::malloc`. It is safe to use from multiple threads.
+	 */
+	class MCRO_API FPool
+	{
+	public:
+		/** @brief The smallest size class is 16 bytes */
+		static constexpr int32 MinSizeClass = 4;
+
+		/** @brief The largest size class is 1 MB */
+		static constexpr int32 MaxSizeClass = 20;
+
+		static constexpr int32 SizeClassCount = MaxSizeClass - MinSizeClass + 1;
+
+		/** @brief The pool is never destroyed, so containers may safely outlive static destruction */
+		static FPool& Get();
+
+		/** @returns The size class fitting given size, or INDEX_NONE if it's bigger than the largest one */
+		static int32 GetSizeClass(SIZE_T size);
+
+		static constexpr SIZE_T GetSizeClassBytes(int32 sizeClass) { return SIZE_T(1) << (sizeClass + MinSizeClass); }
+
+		void* Allocate(int32 sizeClass);
+		void Free(void* data, int32 sizeClass);
+
+		/** @brief Give all pooled blocks back to the system */
+		void Trim();
+
+		/** @returns Memory of the blocks waiting in the pool */
+		SIZE_T GetPooledBytes() const;
+
+	private:
+		struct FFreeBlock
+		{
+			FFreeBlock* Next;
+		};
+
+		struct FBucket
+		{
+			mutable FCriticalSection Lock;
+			FFreeBlock* Head = nullptr;
+			int32 Count = 0;
+		};
+
+		FBucket Buckets[SizeClassCount];
+	};
+
+	/**
+	 *	@brief
+	 *	Container allocator taking memory from FPool. Capacity growth is rounded up to fill the size class, so the
+	 *	slack is usable without further allocations.
+	 */
+	class MCRO_API FPoolAllocator
+	{
+	public:
+		using SizeType = int32;
+
+		enum { NeedsElementType = false };
+		enum { RequireRangeCheck = true };
+
+		typedef FPoolAllocator ElementAllocator;
+		typedef FPoolAllocator BitArrayAllocator;
+
+		class MCRO_API ForAnyElementType
+		{
+		public:
+			ForAnyElementType() {}
+
+			/**
+			 *	@brief  Moves the state of another allocator into this one.
+			 *	
+			 *	Assumes that the allocator is currently empty, i.e. memory may be allocated but any existing elements
+			 *	have already been destructed (if necessary).
+			 *	
+			 *	@param other  The allocator to move the state from.  This allocator should be left in a valid empty state.
+			 */
+			void MoveToEmpty(ForAnyElementType& other);
+
+			/** Destructor. */
+			FORCEINLINE ~ForAnyElementType()
+			{
+				FreeAllocation();
+			}
+
+			// FContainerAllocatorInterface
+			FORCEINLINE FScriptContainerElement* GetAllocation() const
+			{
+				return Data;
+			}
+			void ResizeAllocation(SizeType currentNum, SizeType newMax, SIZE_T numBytesPerElement);
+			SizeType CalculateSlackReserve(SizeType newMax, SIZE_T numBytesPerElement) const
+			{
+				return FillSizeClass(DefaultCalculateSlackReserve(newMax, numBytesPerElement, false), numBytesPerElement);
+			}
+			SizeType CalculateSlackShrink(SizeType newMax, SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return DefaultCalculateSlackShrink(newMax, currentMax, numBytesPerElement, false);
+			}
+			SizeType CalculateSlackGrow(SizeType newMax, SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return FillSizeClass(DefaultCalculateSlackGrow(newMax, currentMax, numBytesPerElement, false), numBytesPerElement);
+			}
+
+			SIZE_T GetAllocatedSize(SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return currentMax * numBytesPerElement;
+			}
+
+			bool HasAllocation() const
+			{
+				return !!Data;
+			}
+
+			SizeType GetInitialCapacity() const
+			{
+				return 0;
+			}
+
+		private:
+			ForAnyElementType(const ForAnyElementType&) = delete;
+			ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+			static SizeType FillSizeClass(SizeType max, SIZE_T numBytesPerElement);
+			void FreeAllocation();
+
+			/** A pointer to the container's elements. */
+			FScriptContainerElement* Data = nullptr;
+
+			/** Size class of Data in FPool, or INDEX_NONE if it's from `::realloc` */
+			int32 SizeClass = INDEX_NONE;
+		};
+
+		template<typename ElementType>
+		class ForElementType : public ForAnyElementType
+		{
+		public:
+
+			/** Default constructor. */
+			ForElementType()
+			{}
+
+			FORCEINLINE ElementType* GetAllocation() const
+			{
+				return (ElementType*)ForAnyElementType::GetAllocation();
+			}
+		};
+	};
+
+	/** @brief Allocator for sets to allocate from the Ansi pool */
+	class FPoolSetAllocator : public TSetAllocator<FPoolAllocator, TInlineAllocator<1, FPoolAllocator>> {};
+}
+
+/** @brief TArray alias which allocates from the Ansi pool */
+template <typename T>
+using TAnsiPoolArray = TArray<T, Mcro::Ansi::FPoolAllocator>;
+
+/** @brief TSet alias which allocates from the Ansi pool */
+template <typename T, typename KeyFuncs = DefaultKeyFuncs<T>>
+using TAnsiPoolSet = TSet<T, KeyFuncs, Mcro::Ansi::FPoolSetAllocator>;
+
+/** @brief TMap alias which allocates from the Ansi pool */
+template <typename K, typename V, typename KeyFuncs = TDefaultMapHashableKeyFuncs<K, V, false>>
+using TAnsiPoolMap = TMap<K, V, Mcro::Ansi::FPoolSetAllocator, KeyFuncs>;
@@ -0,0 +1,108 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+#include <atomic>
+
+/** @brief Per allocation site counters of Ansi allocations, only available in non-shipping builds */
+#define MCRO_ANSI_ALLOCATION_SITES !UE_BUILD_SHIPPING
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+LLM_DECLARE_TAG_API(McroAnsi, MCRO_API);
+#endif
+
+/**
+ *	@brief
+ *	Opt-in tracking of the memory allocated by `Ansi::New` and the Ansi container allocators, which bypass FMemory
+ *	and so they're otherwise invisible to LLM, Memory Insights and `memreport`.
+ *
+ *	When enabled (with `SetAllocationTracking` or `Mcro.Ansi.TrackAllocations 1`) these allocations are
+ *	- reported to LLM under the `McroAnsi` tag
+ *	- emitted as memory trace events of the system memory root heap
+ *	- counted per allocation site in non-shipping builds (the type for `Ansi::New`, the calling code for container
+ *	  allocators), see `Mcro.Ansi.DumpAllocationSites`
+ *
+ *	When disabled the cost is a relaxed atomic load per allocation. It's best enabled at startup, allocations made
+ *	before enabling are not accounted for.
+ */
+namespace Mcro::Ansi
+{
+	MCRO_API void SetAllocationTracking(bool enabled);
+	MCRO_API bool IsAllocationTrackingEnabled();
+
+	struct FAllocationSiteStats
+	{
+		/** @brief Type name or symbolized code address */
+		FString Site;
+		int64 Allocations = 0;
+		int64 LiveAllocations = 0;
+		int64 LiveBytes = 0;
+		int64 PeakBytes = 0;
+	};
+
+	/** @returns Counters of each allocation site seen since tracking was enabled, empty in shipping builds */
+	MCRO_API TArray<FAllocationSiteStats> GetAllocationSiteStats();
+
+	namespace Detail
+	{
+		enum ETrackingState : uint32
+		{
+			TrackingDisabled = 0,
+
+			/** @brief New allocations are tracked */
+			TrackingEnabled = 1,
+
+			/** @brief Tracking is disabled, but there are still tracked allocations to be freed */
+			TrackingDraining = 2,
+		};
+
+		MCRO_API extern std::atomic<uint32> GTrackingState;
+
+		/** @brief An allocation site is either a type name (Ansi::New) or a code address (container allocators) */
+		struct FAllocationSite
+		{
+			FStringView Name;
+			const void* ProgramCounter = nullptr;
+		};
+
+		MCRO_API void OnTrackedAlloc(void* ptr, SIZE_T size, uint32 alignment, FAllocationSite const& site);
+		MCRO_API void* OnTrackedRealloc(void* ptr, SIZE_T size, FAllocationSite const& site);
+		MCRO_API void OnTrackedFree(void* ptr);
+
+		FORCEINLINE void TrackAlloc(void* ptr, SIZE_T size, uint32 alignment, FAllocationSite const& site)
+		{
+			if (GTrackingState.load(std::memory_order_relaxed) & TrackingEnabled) [[unlikely]]
+				OnTrackedAlloc(ptr, size, alignment, site);
+		}
+
+		/**
+		 *	@brief
+		 *	`::realloc` which is tracked. Unlike allocations and frees this cannot be reported separately, because the
+		 *	address realloc frees could be allocated and tracked by another thread before its record is updated.
+		 */
+		FORCEINLINE void* TrackedRealloc(void* ptr, SIZE_T size, FAllocationSite const& site)
+		{
+			if (GTrackingState.load(std::memory_order_relaxed) != TrackingDisabled) [[unlikely]]
+				return OnTrackedRealloc(ptr, size, site);
+			return ::realloc(ptr, size);
+		}
+
+		FORCEINLINE void TrackFree(void* ptr)
+		{
+			if (ptr && GTrackingState.load(std::memory_order_relaxed) != TrackingDisabled) [[unlikely]]
+				OnTrackedFree(ptr);
+		}
+	}
+}
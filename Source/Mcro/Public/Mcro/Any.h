@@ -19,6 +19,7 @@
 #include "Mcro/Templates.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/TypeInfo.h"
+#include "Mcro/ObjectPool.h"
 
 namespace Mcro::Any
 {
@@ -27,38 +28,70 @@ namespace Mcro::Any
 	using namespace Mcro::Templates;
 	using namespace Mcro::FunctionTraits;
 	using namespace Mcro::Inheritance;
+	using namespace Mcro::ObjectPool;
 
 	struct FAny;
 
 	/**
 	 *	@brief
 	 *	Give the opportunity to customize object lifespan operations for `FAny` by either specializing this template
-	 *	or just providing functors in-place
+	 *	or just providing functors in-place. Unset functors fall back to `delete` and `new T(other)`, in which case
+	 *	FAny doesn't need to store the facilities at all.
 	 *	
 	 *	@tparam T  The type being set for an FAny
 	 */
 	template <typename T>
 	struct TAnyTypeFacilities
 	{
-		TFunction<void(T*)> Destruct {[](T* object) { delete object; }};
-		TFunction<T*(T const&)> CopyConstruct {[](T const& object)
-		{
-			if constexpr (CCopyConstructible<T>) return new T(object); 
-			else return nullptr;
-		}};
+		TFunction<void(T*)> Destruct {};
+		TFunction<T*(T const&)> CopyConstruct {};
+
+		/** @brief Are all lifespan operations the defaults */
+		bool IsDefault() const { return !Destruct && !CopyConstruct; }
 	};
 
 	/** @brief Type facilities for `FAny` enforcing standard memory allocations */
 	template <typename T>
 	inline TAnyTypeFacilities<T> AnsiAnyFacilities = {
 		.Destruct = [](T* object) { Ansi::Delete(object); },
-		.CopyConstruct = [](T const& object)
+		.CopyConstruct = [](T const& object) -> T*
 		{
 			if constexpr (CCopyConstructible<T>) return Ansi::New<T>(object);
 			else return nullptr;
 		}
 	};
 
+	/**
+	 *	@brief
+	 *	Type facilities for `FAny` allocating objects from the global `TObjectPool` of their type. Objects using these
+	 *	facilities must have been created with `TObjectPool<T>::Get().New(...)`.
+	 */
+	template <typename T>
+	inline TAnyTypeFacilities<T> PooledAnyFacilities = {
+		.Destruct = [](T* object) { TObjectPool<T>::Get().Delete(object); },
+		.CopyConstruct = [](T const& object) -> T*
+		{
+			if constexpr (CCopyConstructible<T>) return TObjectPool<T>::Get().New(object);
+			else return nullptr;
+		}
+	};
+
+	namespace Detail
+	{
+		/** @brief Lifespan operations of a type stored in FAny. There's one static instance per type and storage mode */
+		struct FAnyVTable
+		{
+			void (*Destruct)(FAny& self);
+			void (*CopyConstruct)(FAny& self, FAny const& other);
+
+			/** @brief Only set for objects stored inline, heap objects are moved by transferring their pointer */
+			void (*MoveConstruct)(FAny& self, FAny& other);
+		};
+
+		template <typename T>
+		struct TAnyOps;
+	}
+
 	/**
 	 *	@brief
 	 *	A simplistic but type-safe and RAII compliant storage for anything. Enclosed data is owned by this type.
@@ -76,9 +109,13 @@ namespace Mcro::Any
 	 *	`TInherit` has a member alias `using Bases = TTypes<...>` and that can be used by FAny to automatically register
 	 *	base classes as compatible ones.
 	 *
+	 *	Values constructed in-place with `FAny(TInPlaceType<T>(), args...)` are stored inline when they're small enough
+	 *	(see `InlineCapacity`), so boxing them doesn't allocate. Lifespan operations are dispatched through a static
+	 *	per-type table of function pointers.
+	 *
 	 *	Enclosed value is recommended to be copy constructible. It may yield a runtime error otherwise. Moving an FAny
-	 *	will just transfer ownership of the wrapped object but will not move construct a new object. The source FAny
-	 *	will be reset to an invalid state.
+	 *	holding a heap object will just transfer ownership of the wrapped object but will not move construct a new
+	 *	object, inline objects are move constructed. The source FAny will be reset to an invalid state.
 	 *
 	 *	@todo
 	 *	C++ 26 has promising proposal for static value-based reflection, which can gather metadata from classes
@@ -91,34 +128,56 @@ namespace Mcro::Any
 	 */
 	struct MCRO_API FAny
 	{
+		/** @brief Objects up to this size (in bytes) are stored inline when constructed in-place */
+		static constexpr int32 InlineCapacity = 32;
+		static constexpr int32 InlineAlignment = 16;
+
+		/** @brief Can objects of T be stored inline */
+		template <typename T>
+		static constexpr bool FitsInline =
+			sizeof(T) <= InlineCapacity
+			&& alignof(T) <= InlineAlignment
+			&& CMoveConstructible<T>
+		;
+
+		/** @brief Take ownership of an already allocated object */
 		template <typename T>
 		FAny(T* newObject, TAnyTypeFacilities<T> const& facilities = {})
 			: Storage(newObject)
 			, MainType(TTypeOf<T>)
-			, Destruct([facilities](FAny* self)
-			{
-				T* object = static_cast<T*>(self->Storage);
-				facilities.Destruct(object);
-				self->Storage = nullptr;
-			})
-			, CopyConstruct([facilities](FAny* self, FAny const& other)
+		{
+			if (facilities.IsDefault())
+				VTable = &Detail::TAnyOps<T>::Heap;
+			else if (&facilities == &AnsiAnyFacilities<T>)
+				VTable = &Detail::TAnyOps<T>::AnsiHeap;
+			else if (&facilities == &PooledAnyFacilities<T>)
+				VTable = &Detail::TAnyOps<T>::PooledHeap;
+			else
 			{
-				const T* object = static_cast<const T*>(other.Storage);
-				self->Storage = facilities.CopyConstruct(*object);
-				checkf(self->Storage, TEXT_"Copy constructor failed for %s. Is it deleted?", *TTypeString<T>());
-				
-				CopyTypeInfo(self, &other);
-			})
+				VTable = &Detail::TAnyOps<T>::CustomHeap;
+				CustomFacilities = MakeShared<const TAnyTypeFacilities<T>>(facilities);
+			}
+			RegisterTypes<T>();
+		}
+
+		/** @brief Construct a new object in-place, stored inline when it fits into `InlineCapacity` */
+		template <typename T, typename... Args>
+		requires CConstructibleFrom<T, Args...>
+		FAny(TInPlaceType<T>, Args&&... args)
+			: MainType(TTypeOf<T>)
 		{
-			ValidTypes.Add(MainType);
-			
-			if constexpr (CHasBases<T>)
+			if constexpr (FitsInline<T>)
 			{
-				ForEachExplicitBase<T>([this] <typename Base> ()
-				{
-					AddAlias(TTypeOf<Base>);
-				});
+				Storage = new (InlineStorage) T(FWD(args)...);
+				VTable = &Detail::TAnyOps<T>::Inline;
+				bInline = true;
 			}
+			else
+			{
+				Storage = new T(FWD(args)...);
+				VTable = &Detail::TAnyOps<T>::Heap;
+			}
+			RegisterTypes<T>();
 		}
 
 		FORCEINLINE FAny() {}
@@ -129,7 +188,7 @@ namespace Mcro::Any
 		template <typename T>
 		const T* TryGet() const
 		{
-			return ValidTypes.Contains(TTypeOf<T>)
+			return ValidTypes.Contains(TTypeHash<T>)
 				? static_cast<const T*>(Storage)
 				: nullptr;
 		}
@@ -137,7 +196,7 @@ namespace Mcro::Any
 		template <typename T>
 		T* TryGet()
 		{
-			return ValidTypes.Contains(TTypeOf<T>)
+			return ValidTypes.Contains(TTypeHash<T>)
 				? static_cast<T*>(Storage)
 				: nullptr;
 		}
@@ -146,13 +205,13 @@ namespace Mcro::Any
 		template <typename T, typename Self>
 		decltype(auto) WithAlias(this Self&& self)
 		{
-			self.AddAlias(TTypeOf<T>);
+			self.AddAlias(TTypeHash<T>);
 			
 			if constexpr (CHasBases<T>)
 			{
 				ForEachExplicitBase<T>([&] <typename Base> ()
 				{
-					self.AddAlias(TTypeOf<Base>);
+					self.AddAlias(TTypeHash<Base>);
 				});
 			}
 			return FWD(self);
@@ -162,25 +221,125 @@ namespace Mcro::Any
 		template <typename Self, typename... T>
 		decltype(auto) With(this Self&& self, TTypes<T...>&&)
 		{
-			(self.AddAlias(TTypeOf<T>), ...);
+			(self.AddAlias(TTypeHash<T>), ...);
 			return FWD(self);
 		}
 
 		FORCEINLINE bool IsValid() const { return static_cast<bool>(Storage); }
+		FORCEINLINE bool IsInline() const { return bInline; }
 		FORCEINLINE FType GetType() const { return MainType; }
-		FORCEINLINE TSet<FType> const& GetValidTypes() const { return ValidTypes; }
+		FORCEINLINE TArrayView<const FTypeHash> GetValidTypes() const { return ValidTypes; }
+
+		/** @brief Type-erased address of the enclosed value, which is the same for all of its valid types */
+		FORCEINLINE void* GetData() const { return Storage; }
 		
 	private:
-		void AddAlias(FType const& alias);
-		static void CopyTypeInfo(FAny* self, const FAny* other);
+		template <typename T>
+		friend struct Detail::TAnyOps;
+
+		template <typename T>
+		void RegisterTypes()
+		{
+			ValidTypes.Add(TTypeHash<T>);
+			
+			if constexpr (CHasBases<T>)
+			{
+				ForEachExplicitBase<T>([this] <typename Base> ()
+				{
+					AddAlias(TTypeHash<Base>);
+				});
+			}
+		}
+		
+		void AddAlias(FTypeHash alias);
 		void Reset();
 		
 		void* Storage = nullptr;
 		FType MainType {};
-		
-		TFunction<void(FAny* self)> Destruct {};
-		TFunction<void(FAny* self, FAny const& other)> CopyConstruct {};
-		
-		TSet<FType> ValidTypes {};
+		const Detail::FAnyVTable* VTable = nullptr;
+
+		// Storage points into InlineStorage. Kept explicitly, because comparing addresses is meaningless for an
+		// FAny which has just been moved or copied bitwise.
+		bool bInline = false;
+
+		// Only set when non-default TAnyTypeFacilities were provided, shared between copies
+		TSharedPtr<const void> CustomFacilities {};
+
+		TArray<FTypeHash, TInlineAllocator<4>> ValidTypes {};
+		alignas(InlineAlignment) uint8 InlineStorage[InlineCapacity];
 	};
+
+	namespace Detail
+	{
+		template <typename T>
+		struct TAnyOps
+		{
+			static T* Get(FAny& self) { return static_cast<T*>(self.Storage); }
+			static const T* Get(FAny const& self) { return static_cast<const T*>(self.Storage); }
+
+			static TAnyTypeFacilities<T> const& GetFacilities(FAny const& self)
+			{
+				return *static_cast<const TAnyTypeFacilities<T>*>(self.CustomFacilities.Get());
+			}
+
+			static void CheckCopy(FAny const& self)
+			{
+				checkf(self.Storage, TEXT_"Copy constructor failed for %s. Is it deleted?", *TTypeString<T>());
+			}
+
+			static void DestructHeap(FAny& self) { delete Get(self); }
+			static void CopyHeap(FAny& self, FAny const& other)
+			{
+				if constexpr (CCopyConstructible<T>) self.Storage = new T(*Get(other));
+				CheckCopy(self);
+			}
+
+			static void DestructAnsi(FAny& self) { Ansi::Delete(Get(self)); }
+			static void CopyAnsi(FAny& self, FAny const& other)
+			{
+				if constexpr (CCopyConstructible<T>) self.Storage = Ansi::New<T>(*Get(other));
+				CheckCopy(self);
+			}
+
+			static void DestructPooled(FAny& self) { TObjectPool<T>::Get().Delete(Get(self)); }
+			static void CopyPooled(FAny& self, FAny const& other)
+			{
+				if constexpr (CCopyConstructible<T>) self.Storage = TObjectPool<T>::Get().New(*Get(other));
+				CheckCopy(self);
+			}
+
+			static void DestructCustom(FAny& self)
+			{
+				auto const& facilities = GetFacilities(self);
+				if (facilities.Destruct) facilities.Destruct(Get(self));
+				else delete Get(self);
+			}
+			static void CopyCustom(FAny& self, FAny const& other)
+			{
+				auto const& facilities = GetFacilities(other);
+				if (facilities.CopyConstruct)
+					self.Storage = facilities.CopyConstruct(*Get(other));
+				else if constexpr (CCopyConstructible<T>)
+					self.Storage = new T(*Get(other));
+				CheckCopy(self);
+			}
+
+			static void DestructInline(FAny& self) { Get(self)->~T(); }
+			static void CopyInline(FAny& self, FAny const& other)
+			{
+				if constexpr (CCopyConstructible<T>) self.Storage = new (self.InlineStorage) T(*Get(other));
+				CheckCopy(self);
+			}
+			static void MoveInline(FAny& self, FAny& other)
+			{
+				self.Storage = new (self.InlineStorage) T(MoveTemp(*Get(other)));
+			}
+
+			static constexpr FAnyVTable Heap       { &DestructHeap, &CopyHeap, nullptr };
+			static constexpr FAnyVTable AnsiHeap   { &DestructAnsi, &CopyAnsi, nullptr };
+			static constexpr FAnyVTable PooledHeap { &DestructPooled, &CopyPooled, nullptr };
+			static constexpr FAnyVTable CustomHeap { &DestructCustom, &CopyCustom, nullptr };
+			static constexpr FAnyVTable Inline     { &DestructInline, &CopyInline, &MoveInline };
+		};
+	}
 }
\ No newline at end of file
@@ -46,13 +46,17 @@ namespace Mcro::AssertMacros
 	}
 }
 
-#define MCRO_ASSERT_SUBMIT_ERROR(condition, severity, async, important, ...) \
-	Mcro::AssertMacros::Detail::SubmitError(                                 \
-		Mcro::Error::EErrorSeverity::severity,                               \
-		PREPROCESSOR_TO_TEXT(condition),                                     \
-		async, important,                                                    \
-		[&](Mcro::Error::IErrorRef const& error) { (error __VA_ARGS__); }    \
-	);                                                                      //
+#define MCRO_ASSERT_SUBMIT_ERROR(condition, severity, async, important, ...)            \
+	[&](std::source_location const& mcroLocation) MCRO_COLD_LAMBDA                      \
+	{                                                                                   \
+		Mcro::AssertMacros::Detail::SubmitError(                                        \
+			Mcro::Error::EErrorSeverity::severity,                                      \
+			PREPROCESSOR_TO_TEXT(condition),                                            \
+			async, important,                                                           \
+			[&](Mcro::Error::IErrorRef const& error) { (error __VA_ARGS__); },          \
+			mcroLocation                                                                \
+		);                                                                              \
+	}(std::source_location::current());                                                //
 
 #define MCRO_ASSERT_CRASH_METHOD                                   \
 	UE_LOG(LogTemp, Fatal,                                         \
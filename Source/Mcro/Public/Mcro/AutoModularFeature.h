@@ -15,6 +15,8 @@
 #include "Async/Future.h"
 #include "Mcro/TypeName.h"
 #include "Mcro/Delegates/EventDelegate.h"
+#include "Mcro/Threading/Snapshot.h"
+#include "Misc/ScopeLock.h"
 
 DECLARE_LOG_CATEGORY_CLASS(LogAutoModularFeature, Log, Log);
 
@@ -28,6 +30,108 @@ namespace Mcro::AutoModularFeature
 	
 	/** @brief Tagging an implementation of a feature */
 	class IFeatureImplementation {};
+
+	/**
+	 *	@brief
+	 *	Implementations of a feature pinned in a snapshot. It stays valid while this object is alive, regardless of
+	 *	features being registered or unregistered meanwhile.
+	 */
+	template <typename Feature>
+	class TFeatureImplementationsView
+	{
+	public:
+		using FNode = Threading::TSnapshotNode<TArray<Feature*>>;
+
+		explicit TFeatureImplementationsView(FNode const* node) : Node(node) {}
+		TFeatureImplementationsView(TFeatureImplementationsView&& other) : Node(Exchange(other.Node, nullptr)) {}
+		TFeatureImplementationsView(TFeatureImplementationsView const&) = delete;
+		TFeatureImplementationsView& operator = (TFeatureImplementationsView const&) = delete;
+		TFeatureImplementationsView& operator = (TFeatureImplementationsView&&) = delete;
+
+		~TFeatureImplementationsView()
+		{
+			if (Node) Threading::TSnapshotStorage<TArray<Feature*>>::Unpin(Node);
+		}
+
+		TArrayView<Feature* const> GetView() const { return Node->Value.GetValue(); }
+		operator TArrayView<Feature* const>() const { return GetView(); }
+
+		int32 Num() const { return GetView().Num(); }
+		bool IsEmpty() const { return GetView().IsEmpty(); }
+		Feature* operator [] (int32 index) const { return GetView()[index]; }
+
+		auto begin() const { return GetView().begin(); }
+		auto end() const { return GetView().end(); }
+
+	private:
+		FNode const* Node;
+	};
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Implementations of a feature read without locking IModularFeatures. It's marked dirty by the modular
+		 *	feature register / unregister events, and rebuilt on the next read.
+		 */
+		template <typename Feature>
+		class TFeatureCache
+		{
+		public:
+			static TFeatureCache& Get()
+			{
+				static TFeatureCache cache;
+				return cache;
+			}
+
+			TFeatureImplementationsView<Feature> Pin()
+			{
+				if (bDirty.load(std::memory_order_acquire)) [[unlikely]]
+					Rebuild();
+				return TFeatureImplementationsView<Feature>(Storage.Pin());
+			}
+
+			FName const& GetName() const { return Name; }
+
+		private:
+			TFeatureCache() : Name(TTypeFName<Feature>())
+			{
+				auto& features = IModularFeatures::Get();
+				auto invalidate = [this](const FName& type, IModularFeature*)
+				{
+					if (type == Name) bDirty.store(true, std::memory_order_release);
+				};
+				RegisteredHandle = features.OnModularFeatureRegistered().AddLambda(invalidate);
+				UnregisteredHandle = features.OnModularFeatureUnregistered().AddLambda(invalidate);
+			}
+
+			/**
+			 *	@brief
+			 *	The cache is a function local static of the module using the feature, so it's destroyed when that
+			 *	module is unloaded. The modular feature registry is constructed before the cache, so it's still alive.
+			 */
+			~TFeatureCache()
+			{
+				auto& features = IModularFeatures::Get();
+				features.OnModularFeatureRegistered().Remove(RegisteredHandle);
+				features.OnModularFeatureUnregistered().Remove(UnregisteredHandle);
+			}
+
+			void Rebuild()
+			{
+				FScopeLock lock(&Lock);
+				if (!bDirty.exchange(false, std::memory_order_acq_rel)) return;
+				Storage.Publish(IModularFeatures::Get().GetModularFeatureImplementations<Feature>(Name));
+			}
+
+			FName Name;
+			FDelegateHandle RegisteredHandle;
+			FDelegateHandle UnregisteredHandle;
+			FCriticalSection Lock;
+			std::atomic<bool> bDirty { true };
+			Threading::TSnapshotStorage<TArray<Feature*>> Storage;
+		};
+	}
 	
 	/**
 	 *	@brief
@@ -109,13 +213,13 @@ namespace Mcro::AutoModularFeature
 		/** @brief Get the name of the feature */
 		static FORCEINLINE FName FeatureName()
 		{
-			return TTypeFName<Feature>();
+			return Detail::TFeatureCache<Feature>::Get().GetName();
 		}
 
 		/** @return The number of implementations created for this feature */
 		static FORCEINLINE int32 ImplementationCount()
 		{
-			return IModularFeatures::Get().GetModularFeatureImplementationCount(FeatureName());
+			return GetAllView().Num();
 		}
 
 		/**
@@ -124,19 +228,32 @@ namespace Mcro::AutoModularFeature
 		 */
 		static FORCEINLINE Feature& Get()
 		{
-			return IModularFeatures::Get().GetModularFeature<Feature>(FeatureName());
+			auto implementations = GetAllView();
+			checkf(!implementations.IsEmpty(), TEXT_"No implementations of %s were registered", *FeatureName().ToString());
+			return *implementations[0];
 		}
 		
-		/** @brief Get the first existing implementation of this feature. Return nullptr If there are no implementations. */
+		/** @brief Get the implementation at given index. Return nullptr if there's no implementation at that index. */
 		static FORCEINLINE Feature* TryGet(const int32 index)
 		{
-			return static_cast<Feature*>(IModularFeatures::Get().GetModularFeatureImplementation(FeatureName(), index));
+			auto implementations = GetAllView();
+			return implementations.GetView().IsValidIndex(index) ? implementations[index] : nullptr;
 		}
 
 		/** @return An array of all implementations of this feature */
 		static FORCEINLINE TArray<Feature*> GetAll()
 		{
-			return IModularFeatures::Get().GetModularFeatureImplementations<Feature>(FeatureName());
+			return TArray<Feature*>(GetAllView().GetView());
+		}
+
+		/**
+		 *	@brief
+		 *	All implementations of this feature without allocations or locking, from a snapshot updated when
+		 *	implementations are registered or unregistered.
+		 */
+		static FORCEINLINE TFeatureImplementationsView<Feature> GetAllView()
+		{
+			return Detail::TFeatureCache<Feature>::Get().Pin();
 		}
 
 		/**
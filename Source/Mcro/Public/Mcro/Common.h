@@ -24,24 +24,38 @@
 #include "Mcro/AssertMacros.h"
 #include "Mcro/Dll.h"
 #include "Mcro/Delegates/EventDelegate.h"
+#include "Mcro/Delegates/BroadcastAsync.h"
+#include "Mcro/Delegates/PriorityEvent.h"
+#include "Mcro/Delegates/StaticEvent.h"
+#include "Mcro/Delegates/InlineFunction.h"
 #include "Mcro/Delegates/DelegateFrom.h"
 #include "Mcro/Delegates/AsNative.h"
+#include "Mcro/Error/BinarySerialization.h"
 #include "Mcro/Error/BlueprintStackTrace.h"
 #include "Mcro/Error/CppException.h"
 #include "Mcro/Error/CppStackTrace.h"
+#include "Mcro/Error/ErrorFrequency.h"
+#include "Mcro/Error/ErrorJournal.h"
 #include "Mcro/Error/ErrorManager.h"
 #include "Mcro/Error/PlainTextComponent.h"
 #include "Mcro/Error/SErrorDisplay.h"
 #include "Mcro/Error/SPlainTextDisplay.h"
 #include "Mcro/Modules.h"
 #include "Mcro/Observable.h"
+#include "Mcro/Observable/Computed.h"
+#include "Mcro/Observable/Accumulator.h"
+#include "Mcro/Observable/Replication.h"
+#include "Mcro/Range/MappedFile.h"
 #include "Mcro/Rendering/Textures.h"
 #include "Mcro/Slate.h"
 #include "Mcro/Subsystems.h"
+#include "Mcro/Text/StructuredLog.h"
 #include "Mcro/TimespanLiterals.h"
 #include "Mcro/UObjects/Init.h"
+#include "Mcro/UObjects/AsyncInit.h"
 #include "Mcro/UObjects/ScopeObject.h"
 #include "Mcro/Yaml.h"
+#include "Mcro/Yaml/Range.h"
 
 /** @brief Use this namespace for all the common features MCRO has to offer */
 namespace Mcro::Common
@@ -26,26 +26,38 @@
 #include "Mcro/Ansi/New.h"
 #include "Mcro/Badge.h"
 #include "Mcro/Composition.h"
+#include "Mcro/Composition/Archetype.h"
+#include "Mcro/Composition/StaticComposable.h"
 #include "Mcro/Concepts.h"
 #include "Mcro/Construct.h"
+#include "Mcro/Coroutines.h"
 #include "Mcro/Enums.h"
 #include "Mcro/Finally.h"
 #include "Mcro/FmtMacros.h"
 #include "Mcro/FunctionTraits.h"
+#include "Mcro/Hash.h"
 #include "Mcro/Inheritance.h"
 #include "Mcro/InitializeOnCopy.h"
+#include "Mcro/ObjectPool.h"
 #include "Mcro/Once.h"
 #include "Mcro/SharedObjects.h"
 #include "Mcro/Text.h"
 #include "Mcro/Text/TupleAsString.h"
+#include "Mcro/Text/InlineString.h"
 #include "Mcro/Threading.h"
+#include "Mcro/Threading/InlineFunction.h"
 #include "Mcro/TypeName.h"
+#include "Mcro/TypeHashMap.h"
 #include "Mcro/TypeInfo.h"
 #include "Mcro/Types.h"
 #include "Mcro/Void.h"
 #include "Mcro/TextMacros.h"
 #include "Mcro/Range.h"
+#include "Mcro/Range/Contiguous.h"
 #include "Mcro/Range/Conversion.h"
+#include "Mcro/Range/Grouping.h"
+#include "Mcro/Range/Parallel.h"
+#include "Mcro/Range/SoAArray.h"
 #include "Mcro/Range/Views.h"
 #include "Mcro/ValueThunk.h"
 #include "Mcro/Zero.h"
@@ -59,9 +71,11 @@ namespace Mcro::CommonCore
 	using namespace Mcro::Composition;
 	using namespace Mcro::Concepts;
 	using namespace Mcro::Construct;
+	using namespace Mcro::Coroutines;
 	using namespace Mcro::Enums;
 	using namespace Mcro::Finally;
 	using namespace Mcro::FunctionTraits;
+	using namespace Mcro::Hash;
 	using namespace Mcro::Inheritance;
 	using namespace Mcro::InitializeOnCopy;
 	using namespace Mcro::Once;
@@ -69,6 +83,7 @@ namespace Mcro::CommonCore
 	using namespace Mcro::Text;
 	using namespace Mcro::Threading;
 	using namespace Mcro::TypeName;
+	using namespace Mcro::TypeHashMap;
 	using namespace Mcro::TypeInfo;
 	using namespace Mcro::Types;
 	using namespace Mcro::Range;
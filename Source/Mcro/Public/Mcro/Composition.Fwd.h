@@ -0,0 +1,72 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+/**
+ *	@file
+ *	This is a forward declaration for types in Composition.h. Unless components are added or queried inline, use
+ *	this header in other header files.
+ */
+
+#include <type_traits>
+
+namespace Mcro::Composition
+{
+	class IComposable;
+
+	/**
+	 *	@brief
+	 *	A composable class can opt into allocating its default constructed components from per-type object pools
+	 *	(see `TObjectPool` and `PooledAnyFacilities`) by declaring
+	 *	@code
+	 *	static constexpr bool PoolComponents = true;
+	 *	@endcode
+	 */
+	template <typename T>
+	concept CPooledComposable = std::decay_t<T>::PoolComponents;
+
+	/**
+	 *	@brief
+	 *	A composable class can opt into copy-on-write component storage by declaring
+	 *	@code
+	 *	static constexpr bool ShareComponentsOnCopy = true;
+	 *	@endcode
+	 *	Copies of such composables share their components until one of them accesses a component mutably, only then
+	 *	that single component is detached into its own copy. Copy or move aware components are never shared, because
+	 *	they expect to be notified with their own instance.
+	 */
+	template <typename T>
+	concept CCopyOnWriteComposable = std::decay_t<T>::ShareComponentsOnCopy;
+
+	/**
+	 *	@brief
+	 *	A composable class can opt into lock-free concurrent single component queries by declaring
+	 *	@code
+	 *	static constexpr bool ConcurrentReads = true;
+	 *	@endcode
+	 *	Read-only queries (`TryGet` and `Get` on a const composable) of such composables read an immutable table of
+	 *	components, which is published RCU-style whenever components or aliases are added. So they can be made from
+	 *	any number of threads, even while a single writer keeps adding components. Components are boxed on the heap
+	 *	so they don't move, and they're shared between copies until mutated, like with copy-on-write composables.
+	 *	Copy or move aware components are not supported.
+	 *
+	 *	Mutable queries, range queries (`GetComponents`), copying and moving the composable still count as writes.
+	 */
+	template <typename T>
+	concept CConcurrentComposable = std::decay_t<T>::ConcurrentReads;
+
+	template <typename T>
+	class TComponentView;
+
+	struct IComponent;
+	struct IStrictComponent;
+}
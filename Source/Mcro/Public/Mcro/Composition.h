@@ -16,18 +16,20 @@
 #include "Mcro/Ansi/Allocator.h"
 #include "Mcro/TextMacros.h"
 #include "Mcro/AssertMacros.h"
+#include "Mcro/Trace.h"
 #include "Mcro/Range.h"
 #include "Mcro/Range/Views.h"
 #include "Mcro/Range/Conversion.h"
+#include "Mcro/Threading/Snapshot.h"
+#include "Mcro/Composition.Fwd.h"
 
 /** @brief Namespace containing utilities and base classes for type composition */
 namespace Mcro::Composition
 {
 	using namespace Mcro::Any;
+	using namespace Mcro::ObjectPool;
 	using namespace Mcro::Range;
 
-	class IComposable;
-
 	/**
 	 *	@brief
 	 *	Inherit from this empty interface to signal that the inheriting class knows that it's a component and that it
@@ -268,6 +270,9 @@ namespace Mcro::Composition
 	 */
 	class MCRO_API IComposable
 	{
+		template <typename T>
+		friend class TComponentView;
+		
 		FTypeHash LastAddedComponentHash = 0;
 
 		struct FComponentLogistics
@@ -276,16 +281,150 @@ namespace Mcro::Composition
 			TFunction<void(IComposable* target)> Move;
 		};
 
-		// Using ANSI allocators here because I've seen Unreal default allocators fail when moving or copying composable classes
-		mutable TMap<FTypeHash, FAny> Components;
-		mutable TMap<FTypeHash, FComponentLogistics> ComponentLogistics;
-		mutable TMap<FTypeHash, TArray<FTypeHash>> ComponentAliases;
+		static constexpr int32 InlineComponentCount = 16;
+
+		// Composables usually have only a handful of components, so they're stored in flat arrays and looked up with
+		// short linear scans over contiguous type hashes. ComponentTypes is index-matched with Components, and
+		// AliasTypes is index-matched with AliasTargets pointing into Components. Components are boxed on the heap so
+		// their addresses stay stable when these arrays grow.
+		TArray<FTypeHash, TInlineAllocator<InlineComponentCount>> ComponentTypes;
+		mutable TArray<FAny> Components;
+
+		// Components of copy-on-write composables are boxed once more into shared storage, in which case the matching
+		// element of Components stays empty. Copying the composable then only copies these references. This array is
+		// only grown when such a component is added, so it may be shorter than Components.
+		using FSharedComponent = TSharedPtr<FAny, ESPMode::ThreadSafe>;
+		mutable TArray<FSharedComponent> SharedComponents;
+
+		TArray<FTypeHash, TInlineAllocator<InlineComponentCount>> AliasTypes;
+		TArray<int32, TInlineAllocator<InlineComponentCount>> AliasTargets;
+
+		// The first component registered for each distinct alias type, so single component queries through an alias
+		// don't need to scan the entire alias table. Like the alias table it's only modified when components are
+		// added, queries are read-only.
+		TArray<FTypeHash, TInlineAllocator<InlineComponentCount>> FirstAliasTypes;
+		TArray<int32, TInlineAllocator<InlineComponentCount>> FirstAliasTargets;
+		TArray<TPair<int32, FComponentLogistics>> ComponentLogistics;
+
+		// Optional direct-mapped cache of recent FindComponent results. Entries are only valid for the generation they
+		// were stored at, which is bumped by anything which may change the result of a query, or the address of a
+		// component (adding components or aliases, copying, moving, resetting, detaching shared components).
+		struct FLookupCache
+		{
+			static constexpr int32 Size = 8;
+
+			struct FEntry
+			{
+				FTypeHash Type = 0;
+				void* Component = nullptr;
+				uint32 Generation = 0;
+
+				// Only lookups which may mutate detach shared components, so only those can serve mutable lookups
+				bool Mutable = false;
+			};
+
+			FEntry Entries[Size];
+			uint32 Generation = 1;
+		};
+		TUniquePtr<FLookupCache> LookupCache;
+
+		// Published table of components of CConcurrentComposable's, exact types first, then every alias in
+		// registration order, so the first match has the same precedence as FindComponentUncached. The table co-owns
+		// the components, so readers can take a reference which keeps them alive after the table is unpinned.
+		struct FComponentTable
+		{
+			TArray<FTypeHash, TInlineAllocator<InlineComponentCount>> Types;
+			TArray<void*, TInlineAllocator<InlineComponentCount>> Addresses;
+			TArray<FSharedComponent, TInlineAllocator<InlineComponentCount>> Owners;
+		};
+		TUniquePtr<Mcro::Threading::TSnapshotStorage<FComponentTable>> ComponentTable;
+
+		/** @brief Publish the current components for concurrent readers, if this composable has a component table */
+		void PublishComponentTable() const;
+
+		template <typename T>
+		T* FindPublishedComponent() const
+		{
+			auto const* node = ComponentTable->Pin();
+			FComponentTable const& table = node->Value.GetValue();
+			const int32 index = table.Types.Find(TTypeHash<T>);
+			T* result = index == INDEX_NONE ? nullptr : static_cast<T*>(table.Addresses[index]);
+			Mcro::Threading::TSnapshotStorage<FComponentTable>::Unpin(node);
+			return result;
+		}
+
+		template <typename T>
+		TSharedPtr<const T, ESPMode::ThreadSafe> FindPublishedComponentShared() const
+		{
+			auto const* node = ComponentTable->Pin();
+			FComponentTable const& table = node->Value.GetValue();
+			const int32 index = table.Types.Find(TTypeHash<T>);
+			TSharedPtr<const T, ESPMode::ThreadSafe> result;
+			if (index != INDEX_NONE)
+				result = TSharedPtr<const T, ESPMode::ThreadSafe>(
+					table.Owners[index], static_cast<const T*>(table.Addresses[index])
+				);
+			Mcro::Threading::TSnapshotStorage<FComponentTable>::Unpin(node);
+			return result;
+		}
+
+		void InvalidateLookupCache() const
+		{
+			if (LookupCache) ++LookupCache->Generation;
+		}
+
+		int32 FindExactComponent(FTypeHash typeHash) const;
 
+		/**
+		 *	@brief
+		 *	Access the storage of a component. If the component is shared with other copies of this composable and
+		 *	`mutate` is true, the component is detached into a copy owned only by this composable first.
+		 */
+		FAny& ComponentAt(int32 index, bool mutate = true) const;
 		bool HasExactComponent(FTypeHash typeHash) const;
-		bool HasComponentAliasUnchecked(FTypeHash typeHash) const;
-		bool HasComponentAlias(FTypeHash typeHash) const;
 		void AddComponentAlias(FTypeHash mainType, FTypeHash validAs);
 
+		template <typename T>
+		FORCEINLINE T* FindComponent(bool mutate = true) const
+		{
+			if (ComponentTable && !mutate) return FindPublishedComponent<T>();
+			if (!LookupCache) return FindComponentUncached<T>(mutate);
+
+			constexpr FTypeHash typeHash = TTypeHash<T>;
+			auto& entry = LookupCache->Entries[typeHash % FLookupCache::Size];
+			if (entry.Type == typeHash && entry.Generation == LookupCache->Generation && (entry.Mutable || !mutate))
+				return static_cast<T*>(entry.Component);
+
+			T* result = FindComponentUncached<T>(mutate);
+			if (result) entry = { typeHash, result, LookupCache->Generation, mutate };
+			return result;
+		}
+
+		template <typename T>
+		T* FindComponentUncached(bool mutate) const
+		{
+			MCRO_TRACE_SCOPE(Composition, "IComposable::FindComponent");
+			const FTypeHash typeHash = TTypeHash<T>;
+			const int32 exact = FindExactComponent(typeHash);
+			if (exact != INDEX_NONE)
+			{
+				if (T* result = ComponentAt(exact, mutate).TryGet<T>())
+					return result;
+			}
+			const int32 firstAlias = FirstAliasTypes.Find(typeHash);
+			if (firstAlias == INDEX_NONE) return nullptr;
+			if (T* result = ComponentAt(FirstAliasTargets[firstAlias], mutate).TryGet<T>())
+				return result;
+			
+			for (int32 i = 0; i < AliasTypes.Num(); ++i)
+			{
+				if (AliasTypes[i] != typeHash) continue;
+				if (T* result = ComponentAt(AliasTargets[i], mutate).TryGet<T>())
+					return result;
+			}
+			return nullptr;
+		}
+
 		void NotifyCopyComponents(IComposable const& other);
 		void NotifyMoveComponents(IComposable&& other);
 		void ResetComponents();
@@ -293,7 +432,7 @@ namespace Mcro::Composition
 		template <typename ValidAs>
 		void AddComponentAlias(FTypeHash mainType)
 		{
-			Components[mainType].WithAlias<ValidAs>();
+			ComponentAt(FindExactComponent(mainType)).WithAlias<ValidAs>();
 			AddComponentAlias(mainType, TTypeHash<ValidAs>);
 
 			if constexpr (CHasBases<ValidAs>)
@@ -327,12 +466,30 @@ namespace Mcro::Composition
 		IComposable(const IComposable& other);
 		IComposable(IComposable&& other) noexcept;
 
+		/**
+		 *	@brief
+		 *	Cache the results of single component queries (`TryGet`, `Get`, `TryGetComponent`), so repeated queries
+		 *	of the same type cost a compare and a load, until components are added, or this composable is copied or
+		 *	moved. Copies inherit this setting.
+		 *
+		 *	@warning
+		 *	Queries write the cache, so with the cache enabled, even read-only queries must not be made from multiple
+		 *	threads at the same time.
+		 */
+		void EnableLookupCache(bool enable = true);
+
+		/** @brief Are results of single component queries cached. @see EnableLookupCache */
+		bool IsLookupCacheEnabled() const { return LookupCache.IsValid(); }
+
 		/**
 		 *	@brief   Get components determined at runtime
 		 *	@param   typeHash  The runtime determined type-hash the desired components are represented with
-		 *	@return  A type erased range view for all the components matched with given type-hash
+		 *	@return  A range view of boxed components matched with given type-hash, without type-erasure
 		 */
-		ranges::any_view<FAny*> GetComponentsDynamic(FTypeHash typeHash) const;
+		TComponentView<FAny> GetComponentsDynamic(FTypeHash typeHash);
+
+		/** @copydoc GetComponentsDynamic. Read-only, doesn't detach components shared by copy-on-write composables. */
+		TComponentView<const FAny> GetComponentsDynamic(FTypeHash typeHash) const;
 
 		/**
 		 *	@brief
@@ -354,6 +511,7 @@ namespace Mcro::Composition
 		requires CCompatibleComponent<MainType, Self>
 		void AddComponent(this Self&& self, MainType* newComponent, TAnyTypeFacilities<MainType> const& facilities = {})
 		{
+			MCRO_TRACE_SCOPE(Composition, "IComposable::AddComponent");
 			ASSERT_CRASH(newComponent);
 			ASSERT_CRASH(!self.HasExactComponent(TTypeHash<MainType>),
 				->WithMessageF(
@@ -368,7 +526,29 @@ namespace Mcro::Composition
 				)
 			);
 			
-			FAny& boxedComponent = self.Components.Add(TTypeHash<MainType>, FAny(newComponent, facilities));
+			constexpr bool hasLogistics = CCompatibleExplicitComponent<MainType, Self>
+				&& (CCopyAwareComponent<MainType, Self> || CMoveAwareComponent<MainType, Self>);
+			static_assert(!CConcurrentComposable<Self> || !hasLogistics,
+				"Copy or move aware components cannot be added to composables with ConcurrentReads"
+			);
+
+			if constexpr (CConcurrentComposable<Self>)
+			if (!self.ComponentTable)
+				self.ComponentTable = MakeUnique<Mcro::Threading::TSnapshotStorage<FComponentTable>>();
+
+			int32 componentIndex;
+			if constexpr ((CCopyOnWriteComposable<Self> || CConcurrentComposable<Self>) && !hasLogistics)
+			{
+				componentIndex = self.Components.AddDefaulted();
+				self.SharedComponents.SetNum(componentIndex + 1);
+				self.SharedComponents[componentIndex] = MakeShared<FAny, ESPMode::ThreadSafe>(newComponent, facilities);
+			}
+			else componentIndex = self.Components.Emplace(newComponent, facilities);
+			
+			self.ComponentTypes.Add(TTypeHash<MainType>);
+			self.InvalidateLookupCache();
+			self.PublishComponentTable();
+			FAny& boxedComponent = self.ComponentAt(componentIndex);
 			MainType* unboxedComponent = boxedComponent.TryGet<MainType>();
 
 			self.LastAddedComponentHash = TTypeHash<MainType>;
@@ -385,9 +565,9 @@ namespace Mcro::Composition
 			if constexpr (CCompatibleExplicitComponent<MainType, Self>)
 			{
 				unboxedComponent->OnCreatedAt(self);
-				if constexpr (CCopyAwareComponent<MainType, Self> || CMoveAwareComponent<MainType, Self>)
+				if constexpr (hasLogistics)
 				{
-					self.ComponentLogistics.Add(TTypeHash<MainType>, {
+					self.ComponentLogistics.Emplace(componentIndex, FComponentLogistics {
 						.Copy = [unboxedComponent](IComposable* target, FAny const& targetBoxedComponent)
 						{
 							// TODO: Provide safe parent reference mechanism without smart pointers because this doesn't seem to work well
@@ -429,6 +609,17 @@ namespace Mcro::Composition
 		requires CCompatibleComponent<MainType, Self>
 		void AddComponent(this Self&& self, TAnyTypeFacilities<MainType> const& facilities = {})
 		{
+			if constexpr (CPooledComposable<Self>)
+			{
+				if (facilities.IsDefault())
+				{
+					FWD(self).template AddComponent<MainType, Self>(
+						TObjectPool<MainType>::Get().New(),
+						PooledAnyFacilities<MainType>
+					);
+					return;
+				}
+			}
 			FWD(self).template AddComponent<MainType, Self>(new MainType(), facilities);
 		}
 
@@ -447,7 +638,7 @@ namespace Mcro::Composition
 		template <typename... ValidAs>
 		void AddAlias()
 		{
-			ASSERT_CRASH(LastAddedComponentHash != 0 && Components.Contains(LastAddedComponentHash),
+			ASSERT_CRASH(LastAddedComponentHash != 0 && HasExactComponent(LastAddedComponentHash),
 				->WithMessage(TEXT_"Component aliases were listed, but no components were added before.")
 				->WithDetails(TEXT_"Make sure `AddAlias` or `WithAlias` is called after `AddComponent` / `With`.")
 			);
@@ -897,12 +1088,53 @@ namespace Mcro::Composition
 		 *	(as long as the composable class is alive of course)
 		 */
 		template <typename T>
-		ranges::any_view<T*> GetComponents() const
+		TComponentView<T> GetComponents()
+		{
+			return TComponentView<T>(this);
+		}
+
+		/**
+		 *	@copydoc GetComponents
+		 *	Read-only, iterating the components doesn't detach the ones shared by copy-on-write composables.
+		 */
+		template <typename T>
+		TComponentView<const T> GetComponents() const
+		{
+			return TComponentView<const T>(this);
+		}
+
+		/**
+		 *	@brief
+		 *	Get the first component matching~ or aliased by the given type, without any range machinery involved. Same
+		 *	as `TryGet`.
+		 *	
+		 *	@tparam T  Desired component type.
+		 *	@return A pointer to the component if one at least exists, nullptr otherwise.
+		 */
+		template <typename T>
+		const T* TryGetComponent() const
+		{
+			return FindComponent<T>(false);
+		}
+
+		/**
+		 *	@brief
+		 *	Get the first component matching~ or aliased by the given type, as a shared reference keeping it alive
+		 *	even if a concurrent writer detaches or removes it from this composable meanwhile. Pointers returned by
+		 *	`TryGet` are only valid until the next write, so readers of CConcurrentComposable's running concurrently
+		 *	with writers should use this instead. For other composables it's the same as `TryGet` referring to the
+		 *	component without owning it.
+		 *	
+		 *	@tparam T  Desired component type.
+		 *	@return A shared pointer to the component if one at least exists, invalid otherwise.
+		 */
+		template <typename T>
+		TSharedPtr<const T, ESPMode::ThreadSafe> TryGetShared() const
 		{
-			namespace rv = ranges::views;
-			return GetComponentsDynamic(TTypeHash<T>)
-				| rv::transform([](FAny* component) { return component->TryGet<T>(); })
-				| FilterValid();
+			if (ComponentTable) return FindPublishedComponentShared<T>();
+			const T* result = FindComponent<T>(false);
+			if (!result) return {};
+			return TSharedPtr<const T, ESPMode::ThreadSafe>(MakeShareable(result, [](const T*) {}));
 		}
 
 		/**
@@ -920,7 +1152,8 @@ namespace Mcro::Composition
 		template <typename T>
 		const T* TryGet() const
 		{
-			return GetComponents<T>() | First(nullptr);
+			// Read-only access doesn't detach components shared by copy-on-write composables
+			return FindComponent<T>(false);
 		}
 
 		/**
@@ -938,7 +1171,7 @@ namespace Mcro::Composition
 		template <typename T>
 		T* TryGet()
 		{
-			return GetComponents<T>() | First(nullptr);
+			return FindComponent<T>();
 		}
 		
 		/**
@@ -989,4 +1222,106 @@ namespace Mcro::Composition
 			return *result;
 		}
 	};
+
+	/**
+	 *	@brief
+	 *	A typed view of all components matching~ or aliased by T on a composable class, returned by
+	 *	`IComposable::GetComponents`. It iterates the flat component tables directly with a concrete iterator, so it
+	 *	doesn't need type-erasure or allocations, but it can still be used with range-v3 views.
+	 *
+	 *	`TComponentView<FAny>` is returned by `IComposable::GetComponentsDynamic`, it yields the boxed components
+	 *	matching a type-hash given at runtime.
+	 *
+	 *	Views of const T are read-only, they don't copy components shared by copy-on-write composables, while views
+	 *	of mutable T detach every component they yield.
+	 */
+	template <typename T>
+	class TComponentView : public ranges::view_base
+	{
+	public:
+		class FIterator
+		{
+		public:
+			using value_type = T*;
+			using reference = T*;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::forward_iterator_tag;
+
+			FIterator() = default;
+			FIterator(IComposable const* owner, FTypeHash typeHash, int32 position)
+				: Owner(owner), TypeHash(typeHash), Position(position)
+			{
+				Settle();
+			}
+
+			T* operator * () const { return Current; }
+
+			FIterator& operator ++ ()
+			{
+				++Position;
+				Settle();
+				return *this;
+			}
+
+			FIterator operator ++ (int)
+			{
+				FIterator result = *this;
+				++*this;
+				return result;
+			}
+
+			friend bool operator == (FIterator const& lhs, FIterator const& rhs) { return lhs.Position == rhs.Position; }
+			friend bool operator != (FIterator const& lhs, FIterator const& rhs) { return lhs.Position != rhs.Position; }
+
+		private:
+			using FValue = std::remove_const_t<T>;
+			static constexpr bool Mutate = !std::is_const_v<T>;
+
+			static T* Unbox(FAny& component)
+			{
+				if constexpr (std::is_same_v<FValue, FAny>) return &component;
+				else return component.template TryGet<FValue>();
+			}
+			
+			// Position -1 is the exact component, then positions are indices of the alias table
+			void Settle()
+			{
+				Current = nullptr;
+				if (!Owner) return;
+				
+				if (Position < 0)
+				{
+					const int32 exact = Owner->FindExactComponent(TypeHash);
+					if (exact != INDEX_NONE && (Current = Unbox(Owner->ComponentAt(exact, Mutate))))
+						return;
+					Position = 0;
+				}
+				for (; Position < Owner->AliasTypes.Num(); ++Position)
+				{
+					if (Owner->AliasTypes[Position] != TypeHash) continue;
+					if ((Current = Unbox(Owner->ComponentAt(Owner->AliasTargets[Position], Mutate))))
+						return;
+				}
+				Position = Owner->AliasTypes.Num();
+			}
+			
+			IComposable const* Owner = nullptr;
+			FTypeHash TypeHash = 0;
+			int32 Position = 0;
+			T* Current = nullptr;
+		};
+
+		TComponentView() = default;
+		TComponentView(IComposable const* owner) requires (!std::is_same_v<std::remove_const_t<T>, FAny>)
+			: Owner(owner), TypeHash(TTypeHash<std::remove_const_t<T>>)
+		{}
+		TComponentView(IComposable const* owner, FTypeHash typeHash) : Owner(owner), TypeHash(typeHash) {}
+
+		FIterator begin() const { return FIterator(Owner, TypeHash, -1); }
+		FIterator end() const { return FIterator(Owner, TypeHash, Owner ? Owner->AliasTypes.Num() : 0); }
+
+	private:
+		IComposable const* Owner = nullptr;
+		FTypeHash TypeHash = 0;
+	};
 }
\ No newline at end of file
@@ -0,0 +1,355 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Mcro/Composition.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/TypeName.h"
+#include "Mcro/TypeHashMap.h"
+#include "Mcro/TextMacros.h"
+#include "Mcro/AssertMacros.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Batch storage for large populations of objects with the same composition. Instead of boxing each component on its
+ *	own like `IComposable` does, entities with identical component type sets share an archetype, which stores each
+ *	component type in its own contiguous array. Iterating a set of component types over all entities then touches
+ *	memory linearly and can be split over multiple threads.
+ */
+namespace Mcro::Composition
+{
+	using namespace Mcro::Concepts;
+	using namespace Mcro::TypeName;
+
+	/** @brief Handle of an entity stored in an FArchetypeStorage. Handles of destroyed entities are never revived */
+	struct FArchetypeEntity
+	{
+		int32 Index = INDEX_NONE;
+		int32 Generation = 0;
+
+		bool IsSet() const { return Index != INDEX_NONE; }
+		bool operator == (FArchetypeEntity const&) const = default;
+
+		friend uint32 GetTypeHash(FArchetypeEntity const& entity)
+		{
+			return HashCombineFast(::GetTypeHash(entity.Index), ::GetTypeHash(entity.Generation));
+		}
+	};
+
+	namespace Detail
+	{
+		/** @brief Lifespan operations of elements in a type-erased archetype column */
+		struct FArchetypeColumnOps
+		{
+			void (*Destruct)(void* element);
+			void (*MoveConstruct)(void* destination, void* source);
+		};
+
+		template <typename T>
+		struct TArchetypeColumnOps
+		{
+			static void Destruct(void* element) { static_cast<T*>(element)->~T(); }
+			static void MoveConstruct(void* destination, void* source)
+			{
+				new (destination) T(MoveTemp(*static_cast<T*>(source)));
+			}
+
+			static constexpr FArchetypeColumnOps Value { &Destruct, &MoveConstruct };
+		};
+
+		/** @brief A contiguous array of a single component type, which type is only known at runtime */
+		class MCRO_API FArchetypeColumn : public FNoncopyable
+		{
+		public:
+			template <typename T>
+			static FArchetypeColumn Make()
+			{
+				return FArchetypeColumn(TTypeHash<T>, sizeof(T), alignof(T), &TArchetypeColumnOps<T>::Value);
+			}
+
+			FArchetypeColumn(FArchetypeColumn&& other) noexcept;
+			~FArchetypeColumn();
+
+			FTypeHash GetType() const { return Type; }
+			int32 Num() const { return Count; }
+			void* GetData() const { return Data; }
+			void* At(int32 index) const { return Data + static_cast<SIZE_T>(index) * ElementSize; }
+
+			void Reserve(int32 capacity);
+
+			/** @brief Get memory for a new element at the end of the column, the caller must construct it */
+			void* AddUninitialized();
+
+			/** @brief Destruct the element at given index and move the last element in its place */
+			void RemoveAtSwap(int32 index);
+
+		private:
+			FArchetypeColumn(FTypeHash type, int32 elementSize, int32 elementAlignment, const FArchetypeColumnOps* ops);
+
+			FTypeHash Type;
+			int32 ElementSize;
+			int32 ElementAlignment;
+			const FArchetypeColumnOps* Ops;
+			uint8* Data = nullptr;
+			int32 Count = 0;
+			int32 Capacity = 0;
+		};
+
+		/** @brief Entities sharing the exact same set of component types */
+		struct FArchetype
+		{
+			/** @brief Sorted component type hashes identifying this archetype */
+			TArray<FTypeHash, TInlineAllocator<8>> Key;
+
+			/** @brief One column per component type, in the order they were first declared */
+			TArray<FArchetypeColumn, TInlineAllocator<8>> Columns;
+
+			/** @brief Entity index of each row */
+			TArray<int32> Entities;
+
+			int32 FindColumn(FTypeHash type) const
+			{
+				for (int32 i = 0; i < Columns.Num(); ++i)
+				{
+					if (Columns[i].GetType() == type)
+						return i;
+				}
+				return INDEX_NONE;
+			}
+			
+			int32 Num() const { return Entities.Num(); }
+		};
+
+		template <typename... Components>
+		TArray<FTypeHash, TInlineAllocator<8>> MakeArchetypeKey()
+		{
+			TArray<FTypeHash, TInlineAllocator<8>> result { TTypeHash<Components>... };
+			result.Sort();
+			return result;
+		}
+
+		template <typename... Components>
+		constexpr bool AreComponentsUnique()
+		{
+			constexpr FTypeHash hashes[] { TTypeHash<Components>... };
+			for (int32 i = 0; i < static_cast<int32>(sizeof...(Components)); ++i)
+				for (int32 j = i + 1; j < static_cast<int32>(sizeof...(Components)); ++j)
+					if (hashes[i] == hashes[j]) return false;
+			return true;
+		}
+	}
+
+	/** @brief Types which can be stored in the columns of an FArchetypeStorage */
+	template <typename T>
+	concept CArchetypeComponent = CMoveConstructible<T> && !std::is_reference_v<T> && !std::is_const_v<T>;
+
+	/**
+	 *	@brief
+	 *	Stores entities made of plain component values, grouped into archetypes by their set of component types. Each
+	 *	archetype keeps its components in contiguous per-type arrays, so batch systems can process them with
+	 *	`ForEach<A, B>(f)` or `ParallelForEach<A, B>(f)` without chasing pointers.
+	 *
+	 *	Unlike `IComposable` the composition of an entity is fixed when it's created, and components are only accessible
+	 *	with their exact type. Creating or destroying entities moves components around, so pointers returned by
+	 *	`TryGet` or given to `ForEach` are only valid until the next structural change. Structural changes are not
+	 *	allowed while iterating.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	FArchetypeStorage storage;
+	 *	for (int i = 0; i < 10000; ++i)
+	 *		storage.Create(FPosition{}, FVelocity{ .Value = FVector(i) });
+	 *
+	 *	storage.ParallelForEach<FPosition, FVelocity const>([&](FPosition& position, FVelocity const& velocity)
+	 *	{
+	 *		position.Value += velocity.Value * deltaTime;
+	 *	});
+	 *	@endcode
+	 */
+	class MCRO_API FArchetypeStorage : public FNoncopyable
+	{
+	public:
+		/**
+		 *	@brief  Create a new entity from the given component values
+		 *	@return The handle of the new entity
+		 */
+		template <typename... Components>
+		requires (sizeof...(Components) > 0 && (CArchetypeComponent<std::decay_t<Components>> && ...))
+		FArchetypeEntity Create(Components&&... components)
+		{
+			static_assert(
+				Detail::AreComponentsUnique<std::decay_t<Components>...>(),
+				"An entity can only have one component of each type"
+			);
+			const int32 archetypeIndex = FindOrAddArchetype<std::decay_t<Components>...>();
+			Detail::FArchetype& archetype = *Archetypes[archetypeIndex];
+			
+			(new (archetype.Columns[archetype.FindColumn(TTypeHash<std::decay_t<Components>>)].AddUninitialized())
+				std::decay_t<Components>(FWD(components)), ...);
+
+			return AddEntity(archetypeIndex);
+		}
+
+		/**
+		 *	@brief
+		 *	Create a new entity by copying the given components of a composable class. It is a runtime crash if any
+		 *	of the listed components are missing.
+		 */
+		template <CArchetypeComponent... Components>
+		requires (sizeof...(Components) > 0 && (CCopyConstructible<Components> && ...))
+		FArchetypeEntity CreateFrom(IComposable const& composable)
+		{
+			return Create(Components(composable.Get<Components>())...);
+		}
+
+		/** @brief Destroy an entity and its components. Returns false if the entity wasn't alive */
+		bool Destroy(FArchetypeEntity entity);
+
+		/** @brief Does the given handle point to an entity which hasn't been destroyed yet */
+		bool IsAlive(FArchetypeEntity entity) const;
+
+		/** @brief Get a component of an entity by its exact type, or nullptr if the entity doesn't have one */
+		template <typename T>
+		T* TryGet(FArchetypeEntity entity) const
+		{
+			if (!IsAlive(entity)) return nullptr;
+			FEntitySlot const& slot = EntitySlots[entity.Index];
+			Detail::FArchetype const& archetype = *Archetypes[slot.Archetype];
+			const int32 column = archetype.FindColumn(TTypeHash<std::decay_t<T>>);
+			if (column == INDEX_NONE) return nullptr;
+			return static_cast<T*>(archetype.Columns[column].At(slot.Row));
+		}
+
+		/**
+		 *	@brief
+		 *	Call a function for every entity which has all the listed components. Component types may be const
+		 *	qualified to signal read-only access. The function may optionally take the entity handle as its first
+		 *	argument.
+		 */
+		template <typename... Components, typename Function>
+		requires (sizeof...(Components) > 0)
+		void ForEach(Function&& function) const
+		{
+			for (auto const& archetype : Archetypes)
+			{
+				ForEachInArchetype<Components...>(*archetype, [&](int32 row, auto&&... components)
+				{
+					InvokeRow(function, *archetype, row, FWD(components)...);
+				}, [](int32 num, auto&& body)
+				{
+					for (int32 row = 0; row < num; ++row) body(row);
+				});
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Same as ForEach but rows of each matching archetype are processed in parallel. The function is called from
+		 *	multiple threads, so it must only modify the components it receives.
+		 *
+		 *	@param minBatchSize  Minimum number of consecutive entities processed by a single task
+		 */
+		template <typename... Components, typename Function>
+		requires (sizeof...(Components) > 0)
+		void ParallelForEach(Function&& function, int32 minBatchSize = 64) const
+		{
+			for (auto const& archetype : Archetypes)
+			{
+				ForEachInArchetype<Components...>(*archetype, [&](int32 row, auto&&... components)
+				{
+					InvokeRow(function, *archetype, row, FWD(components)...);
+				}, [minBatchSize](int32 num, auto&& body)
+				{
+					ParallelFor(TEXT_"Mcro::Composition::FArchetypeStorage::ParallelForEach",
+						num, FMath::Max(minBatchSize, 1), body
+					);
+				});
+			}
+		}
+
+		/** @brief Number of entities alive */
+		int32 Num() const;
+
+		/** @brief Number of distinct component type sets this storage has seen */
+		int32 NumArchetypes() const;
+
+		/** @brief Destroy all entities. Previously issued handles won't be considered alive anymore */
+		void Reset();
+
+	private:
+		struct FEntitySlot
+		{
+			int32 Archetype = INDEX_NONE;
+			int32 Row = INDEX_NONE;
+			int32 Generation = 0;
+		};
+
+		TArray<TUniquePtr<Detail::FArchetype>> Archetypes;
+
+		/** @brief Archetype indices by the hash of their keys. The first archetype wins if two keys hash the same */
+		TypeHashMap::TTypeHashMap<int32> ArchetypeLookup;
+		TArray<FEntitySlot> EntitySlots;
+		TArray<int32> FreeEntities;
+		int32 AliveCount = 0;
+
+		int32 FindArchetype(TArrayView<const FTypeHash> key) const;
+		int32 AddArchetype(Detail::FArchetype&& archetype);
+		FArchetypeEntity AddEntity(int32 archetypeIndex);
+
+		template <typename... Components>
+		int32 FindOrAddArchetype()
+		{
+			auto key = Detail::MakeArchetypeKey<Components...>();
+			const int32 found = FindArchetype(key);
+			if (found != INDEX_NONE) return found;
+
+			Detail::FArchetype archetype;
+			archetype.Key = MoveTemp(key);
+			(archetype.Columns.Add(Detail::FArchetypeColumn::Make<Components>()), ...);
+			return AddArchetype(MoveTemp(archetype));
+		}
+
+		template <typename Function, typename... Args>
+		void InvokeRow(Function& function, Detail::FArchetype const& archetype, int32 row, Args&&... components) const
+		{
+			if constexpr (std::is_invocable_v<Function&, FArchetypeEntity, Args...>)
+			{
+				const int32 entityIndex = archetype.Entities[row];
+				function(FArchetypeEntity { entityIndex, EntitySlots[entityIndex].Generation }, FWD(components)...);
+			}
+			else function(FWD(components)...);
+		}
+
+		template <typename... Components, typename Body, typename Loop>
+		static void ForEachInArchetype(Detail::FArchetype const& archetype, Body&& body, Loop&& loop)
+		{
+			const int32 columns[] { archetype.FindColumn(TTypeHash<std::decay_t<Components>>)... };
+			for (int32 column : columns)
+				if (column == INDEX_NONE) return;
+
+			[&] <size_t... Indices> (std::index_sequence<Indices...>)
+			{
+				std::tuple<Components*...> data {
+					static_cast<Components*>(archetype.Columns[columns[Indices]].GetData())...
+				};
+				loop(archetype.Num(), [&](int32 row)
+				{
+					body(row, std::get<Indices>(data)[row]...);
+				});
+			}(std::index_sequence_for<Components...>());
+		}
+	};
+}
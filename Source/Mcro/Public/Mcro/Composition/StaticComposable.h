@@ -0,0 +1,292 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Composition.h"
+#include "Mcro/Inheritance.h"
+#include "Mcro/Tuples.h"
+#include "Mcro/TypeName.h"
+
+namespace Mcro::Composition
+{
+	using namespace Mcro::Inheritance;
+	using namespace Mcro::Tuples;
+	using namespace Mcro::TypeName;
+
+	namespace Detail
+	{
+		template <typename T, typename Component>
+		consteval bool IsStaticComponentAlias()
+		{
+			if constexpr (CHasBases<Component>) return HasExplicitBase<std::decay_t<T>, Component>();
+			else return false;
+		}
+
+		template <typename T, typename Component>
+		concept CStaticComponentMatch = CSameAsDecayed<T, Component> || IsStaticComponentAlias<T, Component>();
+	}
+
+	/**
+	 *	@brief
+	 *	A composable class with a component set known at compile time. Components are stored inline in a tuple, and
+	 *	both exact and alias lookups are resolved at compile time, so accessing them costs the same as accessing a
+	 *	member. Aliases are the explicit bases of components declared with `TInherit` or a `Bases` member alias, the same
+	 *	way `IComposable` registers them automatically.
+	 *
+	 *	Explicit components (`IComponent` / `IStrictComponent`) are notified with `OnCreatedAt`, `OnCopiedAt` and
+	 *	`OnMovedAt` if they're compatible with this exact composable type.
+	 *
+	 *	For API expecting dynamic composition, `TryGetDynamic` provides read-only access by runtime type-hash, and
+	 *	`ToDynamic` creates an `IComposable` with copies of the components.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	TStaticComposable<FSimpleComponent, FComponentImplementation> MyStuff;
+	 *	int a = MyStuff.Get<FSimpleComponent>().A;
+	 *	int b = MyStuff.Get<IBaseComponent>().B; // <- resolved at compile time via TInherit of FComponentImplementation
+	 *	static_assert(!MyStuff.Has<FVector>);
+	 *	@endcode
+	 *
+	 *	@tparam Components  Unique component types, they are constructed in the order they're listed
+	 */
+	template <typename... Components>
+	class TStaticComposable
+	{
+		static_assert((CSameAs<Components, std::decay_t<Components>> && ...), "Components must be plain value types");
+
+		template <typename T, size_t... Indices>
+		static consteval int32 FindIndex(std::index_sequence<Indices...>&&)
+		{
+			int32 result = INDEX_NONE;
+			((result = result == INDEX_NONE && CSameAsDecayed<T, Components> ? static_cast<int32>(Indices) : result), ...);
+			((result = result == INDEX_NONE && Detail::CStaticComponentMatch<T, Components>
+				? static_cast<int32>(Indices)
+				: result
+			), ...);
+			return result;
+		}
+
+	public:
+		using FTuple = TTuple<Components...>;
+
+		/** @brief Index of the first component matching~ or aliased by T, or INDEX_NONE */
+		template <typename T>
+		static constexpr int32 IndexOf = FindIndex<T>(std::index_sequence_for<Components...>());
+
+		/** @brief Is there a component matching~ or aliased by T */
+		template <typename T>
+		static constexpr bool Has = IndexOf<T> != INDEX_NONE;
+
+		/** @brief Number of components matching~ or aliased by T */
+		template <typename T>
+		static constexpr int32 Count = (0 + ... + (Detail::CStaticComponentMatch<T, Components> ? 1 : 0));
+
+		/** @brief Default construct all components */
+		TStaticComposable()
+			requires (CDefaultInitializable<Components> && ...)
+		{
+			NotifyCreated();
+		}
+
+		/** @brief Construct all components from the given arguments, in the same order as `Components` */
+		template <typename... Args>
+		requires (sizeof...(Args) == sizeof...(Components) && sizeof...(Args) > 0)
+			&& (!(sizeof...(Args) == 1 && (CSameAsDecayed<Args, TStaticComposable> && ...)))
+		explicit TStaticComposable(Args&&... args)
+			: Storage(FWD(args)...)
+		{
+			NotifyCreated();
+		}
+
+		TStaticComposable(TStaticComposable const& other)
+			: Storage(other.Storage)
+		{
+			NotifyCopied(other);
+		}
+
+		TStaticComposable(TStaticComposable&& other) noexcept
+			: Storage(MoveTemp(other.Storage))
+		{
+			NotifyMoved();
+		}
+
+		/** @brief Components are notified the same way as with copy construction */
+		TStaticComposable& operator = (TStaticComposable const& other)
+		{
+			if (this == &other) return *this;
+			Storage = other.Storage;
+			NotifyCopied(other);
+			return *this;
+		}
+
+		/** @brief Components are notified the same way as with move construction */
+		TStaticComposable& operator = (TStaticComposable&& other) noexcept
+		{
+			if (this == &other) return *this;
+			Storage = MoveTemp(other.Storage);
+			NotifyMoved();
+			return *this;
+		}
+
+		/** @brief Get the first component matching~ or aliased by T. It is a compile error if there's none */
+		template <typename T>
+		requires Has<T>
+		T& Get() { return GetItem<IndexOf<T>>(Storage); }
+
+		/** @copydoc Get */
+		template <typename T>
+		requires Has<T>
+		T const& Get() const { return GetItem<IndexOf<T>>(Storage); }
+
+		/** @brief Same as Get, but returns nullptr when T is not a component, instead of failing to compile */
+		template <typename T>
+		T* TryGet()
+		{
+			if constexpr (Has<T>) return &Get<T>();
+			else return nullptr;
+		}
+
+		/** @copydoc TryGet */
+		template <typename T>
+		const T* TryGet() const
+		{
+			if constexpr (Has<T>) return &Get<T>();
+			else return nullptr;
+		}
+
+		/** @brief Same as Get, kept for parity with `IComposable::TryGetComponent` */
+		template <typename T>
+		requires Has<T>
+		T& GetComponent() { return Get<T>(); }
+
+		/** @copydoc GetComponent */
+		template <typename T>
+		requires Has<T>
+		T const& GetComponent() const { return Get<T>(); }
+
+		/** @brief Call a function with all components matching~ or aliased by T, in the order they're declared */
+		template <typename T, typename Function>
+		void ForEachComponent(Function&& function)
+		{
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				if constexpr (Detail::CStaticComponentMatch<T, TTypeAt<I, FTuple>>)
+					function(static_cast<T&>(GetItem<I>(Storage)));
+			});
+		}
+
+		/** @copydoc ForEachComponent */
+		template <typename T, typename Function>
+		void ForEachComponent(Function&& function) const
+		{
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				if constexpr (Detail::CStaticComponentMatch<T, TTypeAt<I, FTuple>>)
+					function(static_cast<T const&>(GetItem<I>(Storage)));
+			});
+		}
+
+		/**
+		 *	@brief
+		 *	Read-only fallback for API which only knows the component type at runtime. Exact types are matched first,
+		 *	then explicit bases, same as `IndexOf`.
+		 *	
+		 *	@return A pointer to the component cast to the type represented by given type-hash, or nullptr
+		 */
+		const void* TryGetDynamic(FTypeHash typeHash) const
+		{
+			const void* result = nullptr;
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				if (!result && TTypeHash<TTypeAt<I, FTuple>> == typeHash)
+					result = &GetItem<I>(Storage);
+			});
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				using FComponent = TTypeAt<I, FTuple>;
+				if constexpr (CHasBases<FComponent>)
+				{
+					ForEachExplicitBase<FComponent>([&, this] <typename Base> ()
+					{
+						if (!result && TTypeHash<Base> == typeHash)
+							result = static_cast<const Base*>(&GetItem<I>(Storage));
+					});
+				}
+			});
+			return result;
+		}
+
+		/** @brief Create a dynamic composable holding copies of the components of this one */
+		template <CComposable Composable = IComposable>
+		requires (CCopyConstructible<Components> && ...)
+		Composable ToDynamic() const
+		{
+			Composable result;
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				using FComponent = TTypeAt<I, FTuple>;
+				result.AddComponent(new FComponent(GetItem<I>(Storage)));
+			});
+			return result;
+		}
+
+		/** @brief Direct access to the component tuple */
+		FTuple& GetTuple() { return Storage; }
+
+		/** @copydoc GetTuple */
+		FTuple const& GetTuple() const { return Storage; }
+
+	private:
+		FTuple Storage;
+
+		template <typename Function>
+		static constexpr void ForEachIndex(Function&& function)
+		{
+			[&] <size_t... Indices> (std::index_sequence<Indices...>&&)
+			{
+				(function.template operator()<Indices>(), ...);
+			}(std::index_sequence_for<Components...>());
+		}
+
+		void NotifyCreated()
+		{
+			ForEachIndex([this] <size_t I> ()
+			{
+				using FComponent = TTypeAt<I, FTuple>;
+				if constexpr (CCompatibleExplicitComponent<FComponent, TStaticComposable&>)
+					GetItem<I>(Storage).OnCreatedAt(*this);
+			});
+		}
+
+		void NotifyCopied(TStaticComposable const& other)
+		{
+			ForEachIndex([&, this] <size_t I> ()
+			{
+				using FComponent = TTypeAt<I, FTuple>;
+				if constexpr (CCopyAwareComponent<FComponent, TStaticComposable&>)
+					GetItem<I>(Storage).OnCopiedAt(*this, GetItem<I>(other.Storage));
+			});
+		}
+
+		void NotifyMoved()
+		{
+			ForEachIndex([this] <size_t I> ()
+			{
+				using FComponent = TTypeAt<I, FTuple>;
+				if constexpr (CMoveAwareComponent<FComponent, TStaticComposable&>)
+					GetItem<I>(Storage).OnMovedAt(*this);
+			});
+		}
+	};
+}
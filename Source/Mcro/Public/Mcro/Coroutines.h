@@ -0,0 +1,287 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Mcro/Concepts.h"
+
+#include <atomic>
+#include <coroutine>
+
+/**
+ *	@file
+ *	@brief
+ *	C++20 coroutine support for asynchronous code otherwise written with RunInThread / PromiseInThread callbacks.
+ *	
+ *	@code
+ *	using namespace Mcro::Coroutines;
+ *	TCoTask<void> LoadStuff(TWeakObjectPtr<UMyObject> target)
+ *	{
+ *	    co_await ResumeOn(ENamedThreads::AnyBackgroundThreadNormalTask);
+ *	    FMyData data = ParseStuff();
+ *
+ *	    TArray<uint8> bytes = co_await ReadFileAsync(); // co_await on TFuture<TArray<uint8>>
+ *	
+ *	    co_await ResumeOn(ENamedThreads::GameThread);
+ *	    if (auto object = target.Get()) object->Apply(data, bytes);
+ *	}
+ *	@endcode
+ */
+namespace Mcro::Coroutines
+{
+	using namespace Mcro::Concepts;
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Allocate memory for a coroutine frame from thread-local pools of a couple of size classes, falling back to
+		 *	FMemory for large frames. Frames may be freed on any thread.
+		 */
+		MCRO_API void* AllocateCoroutineFrame(size_t size);
+
+		/** @brief Free a coroutine frame allocated with AllocateCoroutineFrame */
+		MCRO_API void FreeCoroutineFrame(void* frame, size_t size);
+
+		/** @brief Resume a coroutine on a named thread via the task graph */
+		MCRO_API void ResumeCoroutineOn(std::coroutine_handle<> handle, ENamedThreads::Type threadName);
+
+		/** @returns True if the calling thread is the given named thread, false for any-thread task types */
+		MCRO_API bool IsInNamedThread(ENamedThreads::Type threadName);
+
+		/** @brief Coroutine frames allocating from the pools of AllocateCoroutineFrame */
+		struct FPooledCoroutineFrame
+		{
+			static void* operator new(size_t size) { return AllocateCoroutineFrame(size); }
+			static void operator delete(void* frame, size_t size) { FreeCoroutineFrame(frame, size); }
+		};
+
+		/** @brief Resume a coroutine with the result of a TFuture, on the thread which fulfilled the future */
+		template <typename Value>
+		struct TFutureAwaiter
+		{
+			TFuture<Value> Future;
+			TOptional<std::conditional_t<CVoid<Value>, bool, Value>> Result;
+
+			bool await_ready() const { return Future.IsReady(); }
+
+			void await_suspend(std::coroutine_handle<> handle)
+			{
+				// The continuation may resume the coroutine (and destroy this awaiter) before Then returns
+				TFuture<Value> future = MoveTemp(Future);
+				future.Then([this, handle](TFuture<Value> input)
+				{
+					if constexpr (CVoid<Value>) { input.Get(); Result.Emplace(true); }
+					else Result.Emplace(input.Consume());
+					handle.resume();
+				});
+			}
+
+			Value await_resume()
+			{
+				if constexpr (CVoid<Value>)
+				{
+					if (!Result) Future.Get();
+				}
+				else
+				{
+					if (!Result) return Future.Consume();
+					return MoveTemp(Result.GetValue());
+				}
+			}
+		};
+
+		// Sentinel value of the waiter slot when the task has finished
+		inline void* const CompletedTask = reinterpret_cast<void*>(1);
+
+		template <typename Value>
+		class TCoTaskPromise;
+	}
+
+	/**
+	 *	@brief
+	 *	Awaitable resuming the coroutine on the selected thread. It doesn't suspend when the coroutine is already on that
+	 *	thread. Resuming doesn't allocate a TUniqueFunction, only a graph task.
+	 */
+	struct FResumeOn
+	{
+		ENamedThreads::Type Thread;
+
+		bool await_ready() const { return Detail::IsInNamedThread(Thread); }
+		void await_suspend(std::coroutine_handle<> handle) const { Detail::ResumeCoroutineOn(handle, Thread); }
+		void await_resume() const {}
+	};
+
+	/** @brief co_await this to continue the coroutine on the selected thread */
+	FORCEINLINE FResumeOn ResumeOn(ENamedThreads::Type threadName) { return { threadName }; }
+
+	/**
+	 *	@brief
+	 *	A lightweight eagerly started coroutine task. It can be awaited from other TCoTask coroutines, or it can be
+	 *	discarded in which case the coroutine keeps running until it's finished (fire and forget). Inside a TCoTask
+	 *	coroutine TFutures can be awaited directly (which resumes on the thread fulfilling the future).
+	 *	Coroutine frames are allocated from a pool. It's not called TTask so it doesn't clash with UE::Tasks::TTask
+	 *	when both namespaces are used (like through CommonCore).
+	 *
+	 *	@tparam Value  The result of the coroutine
+	 */
+	template <typename Value = void>
+	class TCoTask
+	{
+	public:
+		using promise_type = Detail::TCoTaskPromise<Value>;
+		using FHandle = std::coroutine_handle<promise_type>;
+
+		TCoTask() = default;
+		explicit TCoTask(FHandle handle) : Handle(handle) {}
+		TCoTask(TCoTask&& other) noexcept : Handle(other.Handle) { other.Handle = nullptr; }
+		TCoTask& operator = (TCoTask&& other) noexcept
+		{
+			Release();
+			Handle = other.Handle;
+			other.Handle = nullptr;
+			return *this;
+		}
+		TCoTask(const TCoTask&) = delete;
+		TCoTask& operator = (const TCoTask&) = delete;
+		~TCoTask() { Release(); }
+
+		bool IsValid() const { return static_cast<bool>(Handle); }
+
+		/** @returns True if the coroutine has finished and its result is available */
+		bool IsDone() const
+		{
+			return Handle && Handle.promise().Waiter.load(std::memory_order_acquire) == Detail::CompletedTask;
+		}
+
+		struct FAwaiter
+		{
+			FHandle Handle;
+
+			bool await_ready() const
+			{
+				return Handle.promise().Waiter.load(std::memory_order_acquire) == Detail::CompletedTask;
+			}
+
+			bool await_suspend(std::coroutine_handle<> waiter) const
+			{
+				void* expected = nullptr;
+				// Fails when the task has been completed in the meantime, so the waiter just continues
+				return Handle.promise().Waiter.compare_exchange_strong(expected, waiter.address(), std::memory_order_acq_rel);
+			}
+
+			Value await_resume() const
+			{
+				if constexpr (!CVoid<Value>) return MoveTemp(Handle.promise().Result.GetValue());
+			}
+		};
+
+		/** @brief Await the task, only possible on rvalue tasks (like the result of a coroutine call) */
+		FAwaiter operator co_await () &&
+		{
+			check(Handle);
+			return { Handle };
+		}
+
+	private:
+		void Release()
+		{
+			if (Handle && Handle.promise().Refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				Handle.destroy();
+			Handle = nullptr;
+		}
+
+		FHandle Handle = nullptr;
+	};
+
+	namespace Detail
+	{
+		template <typename Value>
+		class TCoTaskPromiseBase : public FPooledCoroutineFrame
+		{
+		public:
+			// Held by the TCoTask object and the running coroutine
+			std::atomic<int32> Refs { 2 };
+
+			// nullptr while running and nobody waits, the address of the awaiting coroutine or CompletedTask
+			std::atomic<void*> Waiter { nullptr };
+
+			std::suspend_never initial_suspend() noexcept { return {}; }
+
+			struct FFinalAwaiter
+			{
+				bool await_ready() const noexcept { return false; }
+
+				template <typename Promise>
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> self) noexcept
+				{
+					auto& promise = self.promise();
+					void* waiter = promise.Waiter.exchange(CompletedTask, std::memory_order_acq_rel);
+
+					// Nothing of the frame can be touched after this as the owning TCoTask may destroy it
+					if (promise.Refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					{
+						self.destroy();
+						return std::noop_coroutine();
+					}
+					if (waiter && waiter != CompletedTask)
+						return std::coroutine_handle<>::from_address(waiter);
+					return std::noop_coroutine();
+				}
+
+				void await_resume() const noexcept {}
+			};
+
+			FFinalAwaiter final_suspend() noexcept { return {}; }
+
+			void unhandled_exception() { checkNoEntry(); }
+
+			template <typename Future>
+			TFutureAwaiter<Future> await_transform(TFuture<Future>&& future)
+			{
+				return { MoveTemp(future) };
+			}
+
+			template <typename Awaitable>
+			Awaitable&& await_transform(Awaitable&& awaitable) { return Forward<Awaitable>(awaitable); }
+		};
+
+		template <typename Value>
+		class TCoTaskPromise : public TCoTaskPromiseBase<Value>
+		{
+		public:
+			TOptional<Value> Result;
+
+			TCoTask<Value> get_return_object()
+			{
+				return TCoTask<Value>(std::coroutine_handle<TCoTaskPromise>::from_promise(*this));
+			}
+
+			template <CConvertibleTo<Value> From>
+			void return_value(From&& value) { Result.Emplace(Forward<From>(value)); }
+		};
+
+		template <>
+		class TCoTaskPromise<void> : public TCoTaskPromiseBase<void>
+		{
+		public:
+			TCoTask<void> get_return_object()
+			{
+				return TCoTask<void>(std::coroutine_handle<TCoTaskPromise>::from_promise(*this));
+			}
+
+			void return_void() {}
+		};
+	}
+}
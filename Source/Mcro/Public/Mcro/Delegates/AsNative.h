@@ -15,6 +15,8 @@
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/Delegates/Traits.h"
 
+#include <utility>
+
 namespace Mcro::Delegates
 {
 	using namespace Mcro::FunctionTraits;
@@ -71,4 +73,133 @@ namespace Mcro::Delegates
 
 		return NativeDelegateType::CreateUFunction(dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
 	}
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	A UFunction resolved for a class and function name, with its parameter layout. The cache releases them
+		 *	after their UFunction is garbage collected, delegates bound to them share their ownership.
+		 */
+		struct FResolvedUFunction
+		{
+			TWeakObjectPtr<UFunction> Function;
+
+			/** @brief Offsets of the parameters in the parameter struct, in declaration order, without return value */
+			TArray<int32> ParameterOffsets;
+
+			int32 ParametersSize = 0;
+			int32 ParametersAlignment = 1;
+			int32 ReturnValueOffset = INDEX_NONE;
+
+			/** @brief Out and reference parameters, native functions read them from the frame */
+			TArray<FProperty*> OutParameters;
+
+			/**
+			 *	@brief
+			 *	Native C++ functions which are not networked, not Blueprint events and are declared by a native class
+			 *	can be invoked directly, skipping ProcessEvent. Everything else goes through ProcessEvent for RPC
+			 *	dispatch, script hooks and Blueprint debugging.
+			 */
+			bool bDirectNativeCall = false;
+		};
+
+		using FResolvedUFunctionPtr = TSharedPtr<const FResolvedUFunction, ESPMode::ThreadSafe>;
+
+		/** @returns The cached resolution of given function on the class of given object, or nullptr if it doesn't exist */
+		MCRO_API FResolvedUFunctionPtr ResolveUFunction(const UObject* object, FName functionName);
+
+		MCRO_API void InitializeUFunctionParameters(FResolvedUFunction const& resolved, uint8* parameters);
+		MCRO_API void DestroyUFunctionParameters(FResolvedUFunction const& resolved, uint8* parameters);
+		MCRO_API void InvokeResolvedUFunction(FResolvedUFunction const& resolved, UObject* object, uint8* parameters);
+
+		template <typename Return, typename... Args, size_t... Indices>
+		Return InvokeUFunction(
+			FResolvedUFunction const& resolved, UObject* object, std::index_sequence<Indices...>, Args&&... args
+		) {
+			uint8* parameters = static_cast<uint8*>(
+				FMemory_Alloca_Aligned(resolved.ParametersSize, resolved.ParametersAlignment)
+			);
+			InitializeUFunctionParameters(resolved, parameters);
+
+			// The layout of UFunction parameters matches their C++ types, the same way UE's own UFunction delegate
+			// instances rely on it
+			((*reinterpret_cast<std::decay_t<Args>*>(parameters + resolved.ParameterOffsets[Indices]) = args), ...);
+
+			InvokeResolvedUFunction(resolved, object, parameters);
+
+			// Copy back non-const reference parameters
+			([&]
+			{
+				using Arg = Args;
+				if constexpr (std::is_lvalue_reference_v<Arg> && !std::is_const_v<std::remove_reference_t<Arg>>)
+					args = *reinterpret_cast<std::decay_t<Arg>*>(parameters + resolved.ParameterOffsets[Indices]);
+			}(), ...);
+
+			if constexpr (std::is_void_v<Return>)
+				DestroyUFunctionParameters(resolved, parameters);
+			else
+			{
+				Return result = MoveTemp(*reinterpret_cast<Return*>(parameters + resolved.ReturnValueOffset));
+				DestroyUFunctionParameters(resolved, parameters);
+				return result;
+			}
+		}
+
+		template <typename Signature>
+		struct TResolvedUFunctionDelegate {};
+
+		template <typename Return, typename... Args>
+		struct TResolvedUFunctionDelegate<Return(Args...)>
+		{
+			static TDelegate<Return(Args...)> Create(UObject* object, FResolvedUFunctionPtr const& resolved)
+			{
+				return TDelegate<Return(Args...)>::CreateWeakLambda(object, [object, resolved](Args... args) -> Return
+				{
+					return InvokeUFunction<Return, Args...>(
+						*resolved, object, std::index_sequence_for<Args...>(), Forward<Args>(args)...
+					);
+				});
+			}
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Like AsNative, creates a native delegate calling the same UFunction as the specified dynamic delegate, but the
+	 *	UFunction and its parameter layout are resolved once per class and function name and cached. Only native
+	 *	UFunctions of native classes without networking or Blueprint event flags are invoked directly instead of
+	 *	through ProcessEvent, so calls to those cost close to a native binding. Other functions still use ProcessEvent.
+	 *
+	 *	The resulting delegate is a weak lambda bound to the same object, so it's not reporting a bound function name.
+	 *	If the function cannot be resolved, it falls back to AsNative.
+	 *
+	 *	@tparam            Dynamic  The origin type, i.e. the dynamic delegate. Will be auto-deduced.
+	 *	@param     dynamicDelegate  The dynamic delegate that will be converted
+	 */
+	template <
+		CDynamicDelegate Dynamic,
+		typename MethodPtrTypeDynamic = TDynamicMethodPtr<Dynamic>,
+		typename NativeDelegateType = TDelegate<TFunction_Signature<MethodPtrTypeDynamic>>,
+		typename MethodPtrTypeNative = typename TMemFunPtrType<
+			false,
+			FDeclareOnly,
+			typename NativeDelegateType::TFuncType
+		>::Type
+	>
+	requires CSameAsDecayed<MethodPtrTypeDynamic, MethodPtrTypeNative>
+	NativeDelegateType AsFastNative(Dynamic&& dynamicDelegate)
+	{
+		if (!dynamicDelegate.IsBound())
+		{
+			return NativeDelegateType();
+		}
+
+		UObject* object = dynamicDelegate.GetUObject();
+		if (auto resolved = Detail::ResolveUFunction(object, dynamicDelegate.GetFunctionName()))
+		{
+			return Detail::TResolvedUFunctionDelegate<typename NativeDelegateType::TFuncType>::Create(object, resolved);
+		}
+		return AsNative(FWD(dynamicDelegate));
+	}
 }
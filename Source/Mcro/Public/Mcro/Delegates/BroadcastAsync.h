@@ -0,0 +1,116 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Mcro/Delegates/EventDelegate.h"
+#include "Mcro/Error.h"
+
+#include <atomic>
+
+namespace Mcro::Delegates
+{
+	using namespace Mcro::Error;
+
+	namespace Detail
+	{
+		template <typename... Args>
+		struct TParallelBroadcastState
+		{
+			template <typename... BroadcastArgs>
+			TParallelBroadcastState(BroadcastArgs&&... args) : Arguments(FWD(args)...) {}
+
+			TTuple<std::decay_t<Args>...> Arguments;
+			std::atomic<int32> Remaining { 0 };
+			FCriticalSection Lock;
+			TArray<IErrorRef> Errors;
+			TPromise<FCanFail> Promise;
+
+			void Finish()
+			{
+				if (Remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+					return;
+
+				if (Errors.IsEmpty())
+				{
+					Promise.SetValue(Success());
+					return;
+				}
+
+				TArray<TTuple<FString, IErrorRef>> namedErrors;
+				for (IErrorRef const& error : Errors)
+					namedErrors.Emplace(FString(), error);
+				
+				Promise.SetValue(IError::Make(new FAssertion())
+					->WithMessageF(TEXT_"{0} error(s) occured while executing listeners of a parallel broadcast", Errors.Num())
+					->WithErrors(namedErrors)
+				);
+			}
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Execute the listeners of an event in parallel on background worker threads, instead of serially on the
+	 *	calling thread. Belated and once semantics are handled the same way as `Broadcast` does, at the time of
+	 *	calling this function.
+	 *
+	 *	The arguments are copied once and shared by all listeners, so listeners must not modify them. Errors reported
+	 *	or assertions submitted by the listeners on their worker thread are gathered into a single IError.
+	 *
+	 *	Only available for events with `ThreadSafe` and `LockFreeBroadcast` policies.
+	 *	
+	 *	@param event  The event to broadcast
+	 *	@param  args  Broadcast arguments
+	 *	@return A future which is fulfilled once all listeners have been executed. 
+	 */
+	template <typename... Args, FEventPolicy DefaultPolicy, typename... BroadcastArgs>
+	requires (
+		TEventDelegate<void(Args...), DefaultPolicy>::UseSnapshots
+		&& CConvertibleTo<TTuple<BroadcastArgs...>, TTuple<Args...>>
+		&& (!std::is_rvalue_reference_v<Args> && ...)
+	)
+	TFuture<FCanFail> BroadcastAsync(TEventDelegate<void(Args...), DefaultPolicy>& event, BroadcastArgs&&... args)
+	{
+		using FState = Detail::TParallelBroadcastState<Args...>;
+		
+		auto state = MakeShared<FState>(args...);
+		auto bindings = event.TakeBroadcastBindings(FWD(args)...);
+		if (bindings.IsEmpty())
+			return MakeFulfilledPromise<FCanFail>(Success()).GetFuture();
+
+		auto future = state->Promise.GetFuture();
+		state->Remaining.store(bindings.Num(), std::memory_order_relaxed);
+		for (auto& delegate : bindings)
+		{
+			AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [state, delegate = MoveTemp(delegate)]
+			{
+				{
+					FScopedErrorCapture capture;
+					state->Arguments.ApplyAfter([&](auto&... arguments)
+					{
+						delegate->ExecuteIfBound(arguments...);
+					});
+					if (!capture.GetErrors().IsEmpty())
+					{
+						FScopeLock lock(&state->Lock);
+						state->Errors.Append(capture.GetErrors());
+					}
+				}
+				state->Finish();
+			});
+		}
+		return future;
+	}
+}
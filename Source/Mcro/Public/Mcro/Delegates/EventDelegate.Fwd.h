@@ -0,0 +1,142 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+/**
+ *	@file
+ *	This is a forward declaration for types in EventDelegate.h. Unless events are bound or broadcast inline, or the
+ *	full TEventDelegate type is used for class member declarations, use this header in other header files.
+ */
+
+#include "CoreMinimal.h"
+
+namespace Mcro::Delegates
+{
+	/** @brief Settings for the TEventDelegate class, which defines optional behavior when adding a binding to it */
+	struct FEventPolicy
+	{
+		/** @brief The binding will be automatically removed after the next broadcast */
+		bool Once = false;
+
+		/** @brief The binding will be executed immediately if the delegate has already been broadcasted */
+		bool Belated = false;
+
+		/**
+		 *	@brief
+		 *	Attempt to copy arguments when storing them for belated invokes, instead of perfect
+		 *	forwarding them. This is only considered from the template argument
+		 */
+		bool CacheViaCopy = false;
+
+		/** @brief Enable mutex locks around adding/broadcasting delegates. Only considered in DefaultPolicy */
+		bool ThreadSafe = false;
+
+		/**
+		 *	@brief
+		 *	When ThreadSafe is also enabled, broadcast an immutable snapshot of the bindings without holding the lock
+		 *	while listeners are executed. Adding or removing bindings publishes a new snapshot, so slow listeners don't
+		 *	block other threads adding bindings or broadcasting. Bindings removed during a broadcast on another thread
+		 *	may still be executed by that broadcast. Only considered in DefaultPolicy.
+		 */
+		bool LockFreeBroadcast = false;
+
+		/**
+		 *	@brief
+		 *	Only store broadcast arguments when they may be used for belated invokes, i.e. when Belated is part of the
+		 *	DefaultPolicy, or a belated binding has already been added. Belated bindings added after a broadcast which
+		 *	wasn't cached will be executed on the next broadcast instead. Only considered in DefaultPolicy.
+		 */
+		bool LazyCache = false;
+
+		/**
+		 *	@brief
+		 *	Allow queueing broadcast arguments from any thread with `Enqueue`, which are then broadcasted in a batch
+		 *	when `Flush` is called (for example from a tick on the consuming thread). Listeners may also receive a whole
+		 *	batch at once with `AddBatch`. Only considered in DefaultPolicy.
+		 */
+		bool Queued = false;
+
+		/** @brief Merge two policy flags */
+		FORCEINLINE constexpr FEventPolicy With(FEventPolicy const& other) const
+		{
+			return {
+				Once         || other.Once,
+				Belated      || other.Belated,
+				CacheViaCopy      || other.CacheViaCopy,
+				ThreadSafe        || other.ThreadSafe,
+				LockFreeBroadcast || other.LockFreeBroadcast,
+				LazyCache         || other.LazyCache,
+				Queued            || other.Queued
+			};
+		}
+
+		FORCEINLINE friend constexpr bool operator == (FEventPolicy const& lhs, FEventPolicy const& rhs)
+		{
+			return lhs.Once         == rhs.Once
+				&& lhs.Belated      == rhs.Belated
+				&& lhs.CacheViaCopy      == rhs.CacheViaCopy
+				&& lhs.ThreadSafe        == rhs.ThreadSafe
+				&& lhs.LockFreeBroadcast == rhs.LockFreeBroadcast
+				&& lhs.LazyCache         == rhs.LazyCache
+				&& lhs.Queued            == rhs.Queued
+			;
+		}
+
+		FORCEINLINE friend constexpr bool operator != (FEventPolicy const& lhs, FEventPolicy const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+		/** @brief Is this instance equivalent to a default constructed one */
+		FORCEINLINE constexpr bool IsDefault() const
+		{
+			return *this == FEventPolicy();
+		}
+	};
+
+	template <typename Function, FEventPolicy DefaultPolicy = {}>
+	class TEventDelegate;
+
+	/** @brief Shorthand alias for TEventDelegate which copies arguments to its cache regardless of their qualifiers */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TRetainingEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.CacheViaCopy = true})>;
+
+	/** @brief Shorthand alias for TEventDelegate which broadcasts listeners immediately once they're added */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TBelatedEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Belated = true})>;
+
+	/** @brief Shorthand alias for combination of TRetainingEventDelegate and TBelatedEventDelegate */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TBelatedRetainingEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Belated = true, .CacheViaCopy = true})>;
+
+	/** @brief Shorthand alias for TEventDelegate which broadcasts listeners only once and then they're removed */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TOneTimeEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Once = true})>;
+	
+	/** @brief Shorthand alias for combination of TRetainingEventDelegate and TOneTimeEventDelegate */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TOneTimeRetainingEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Once = true, .CacheViaCopy = true})>;
+
+	/** @brief Shorthand alias for combination of TBelatedEventDelegate and TOneTimeEventDelegate */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TOneTimeBelatedEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Once = true, .Belated = true})>;
+
+	/** @brief Shorthand alias for a thread-safe TEventDelegate which doesn't hold its lock while executing listeners */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TLockFreeEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.ThreadSafe = true, .LockFreeBroadcast = true})>;
+
+	/** @brief Collect'em all */
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	using TOneTimeRetainingBelatedEventDelegate = TEventDelegate<Signature,
+		DefaultPolicy.With({.Once = true, .Belated = true, .CacheViaCopy = true})
+	>;
+}
@@ -14,64 +14,60 @@
 #include "CoreMinimal.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/InitializeOnCopy.h"
+#include "Mcro/Instrumentation.h"
+#include "Mcro/TypeName.h"
 #include "Mcro/Delegates/AsNative.h"
 #include "Mcro/Delegates/DelegateFrom.h"
+#include "Mcro/Threading/Snapshot.h"
+#include "Mcro/Delegates/EventDelegate.Fwd.h"
 
 namespace Mcro::Delegates
 {
 	using namespace Mcro::FunctionTraits;
 	using namespace Mcro::InitializeOnCopy;
 	
-	/** @brief Settings for the TEventDelegate class, which defines optional behavior when adding a binding to it */
-	struct FEventPolicy
-	{
-		/** @brief The binding will be automatically removed after the next broadcast */
-		bool Once = false;
-
-		/** @brief The binding will be executed immediately if the delegate has already been broadcasted */
-		bool Belated = false;
+	/**
+	 *	@brief
+	 *	The number of stale bindings a TEventDelegate detects during broadcasts, before they're swept in bulk. Bindings
+	 *	are stale when their object has been destroyed, or their shared pointer has expired.
+	 */
+	inline constexpr int32 StaleBindingCompactionThreshold = 16;
 
+	namespace Detail
+	{
 		/**
 		 *	@brief
-		 *	Attempt to copy arguments when storing them for belated invokes, instead of perfect
-		 *	forwarding them. This is only considered from the template argument
+		 *	Heap storage for rarely used members, which is only allocated when it's first needed. Copies are deep, so
+		 *	owners stay copyable as they were with the member stored inline.
 		 */
-		bool CacheViaCopy = false;
+		template <typename T>
+		struct TOnDemand
+		{
+			TOnDemand() = default;
+			TOnDemand(TOnDemand const& other) : Value(other.Value ? MakeUnique<T>(*other.Value) : nullptr) {}
+			TOnDemand(TOnDemand&&) noexcept = default;
 
-		/** @brief Enable mutex locks around adding/broadcasting delegates. Only considered in DefaultPolicy */
-		bool ThreadSafe = false;
+			TOnDemand& operator = (TOnDemand const& other)
+			{
+				Value = other.Value ? MakeUnique<T>(*other.Value) : nullptr;
+				return *this;
+			}
+			TOnDemand& operator = (TOnDemand&&) noexcept = default;
 
-		/** @brief Merge two policy flags */
-		FORCEINLINE constexpr FEventPolicy With(FEventPolicy const& other) const
-		{
-			return {
-				Once         || other.Once,
-				Belated      || other.Belated,
-				CacheViaCopy || other.CacheViaCopy,
-				ThreadSafe   || other.ThreadSafe
-			};
-		}
+			T* Find() const { return Value.Get(); }
 
-		FORCEINLINE friend constexpr bool operator == (FEventPolicy const& lhs, FEventPolicy const& rhs)
-		{
-			return lhs.Once         == rhs.Once
-				&& lhs.Belated      == rhs.Belated
-				&& lhs.CacheViaCopy == rhs.CacheViaCopy
-				&& lhs.ThreadSafe   == rhs.ThreadSafe
-			;
-		}
+			T& FindOrAdd()
+			{
+				if (!Value) Value = MakeUnique<T>();
+				return *Value;
+			}
 
-		FORCEINLINE friend constexpr bool operator != (FEventPolicy const& lhs, FEventPolicy const& rhs)
-		{
-			return !(lhs == rhs);
-		}
+			void Reset() { Value.Reset(); }
 
-		/** @brief Is this instance equivalent to a default constructed one */
-		FORCEINLINE constexpr bool IsDefault() const
-		{
-			return *this == FEventPolicy();
-		}
-	};
+		private:
+			TUniquePtr<T> Value;
+		};
+	}
 
 	/**
 	 *	@brief
@@ -98,7 +94,7 @@ namespace Mcro::Delegates
 	 *	using FMyEventDelegate = TEventDelegate<void(int32 someParam), {.Belated = true, .Once = true}>;
 	 *	@endcode 
 	 */
-	template <typename Function, FEventPolicy DefaultPolicy = {}>
+	template <typename Function, FEventPolicy DefaultPolicy>
 	class TEventDelegate {};
 
 	/** @copydoc TEventDelegate */
@@ -116,31 +112,287 @@ namespace Mcro::Delegates
 			TTuple<std::decay_t<Args>...>,
 			TTuple<Args...>
 		>;
+
+		/** @brief Are bindings broadcasted from immutable snapshots without holding the lock */
+		static constexpr bool UseSnapshots = DefaultPolicy.ThreadSafe && DefaultPolicy.LockFreeBroadcast;
+
+		/** @brief Is the argument cache only allocated once a belated binding needs it */
+		static constexpr bool OnDemandCache = DefaultPolicy.LazyCache && !DefaultPolicy.Belated;
 		
 		template <typename... BroadcastArgs>
 		requires CConvertibleTo<TTuple<BroadcastArgs...>, TTuple<Args...>>
 		void Broadcast(BroadcastArgs&&... args)
+		{
+			MCRO_TRACE_SCOPE(Events, "TEventDelegate::Broadcast");
+			Instrumentation::TBroadcastScope<FunctionSignature> traceScope;
+			if constexpr (UseSnapshots)
+				BroadcastSnapshot(FWD(args)...);
+			else
+				BroadcastLocked(FWD(args)...);
+		}
+
+		/**
+		 *	@brief
+		 *	Do the bookkeeping of a broadcast (argument cache and removing once-bindings) but instead of executing the
+		 *	bindings return them, so they can be executed in any order or thread by the caller. Only available with
+		 *	LockFreeBroadcast.
+		 *
+		 *	@see Mcro::Delegates::BroadcastAsync
+		 */
+		template <typename... BroadcastArgs>
+		requires (UseSnapshots && CConvertibleTo<TTuple<BroadcastArgs...>, TTuple<Args...>>)
+		TArray<TSharedRef<FDelegate>> TakeBroadcastBindings(BroadcastArgs&&... args)
+		{
+			MutexLock lock(&Mutex.Get());
+			UpdateCache(FWD(args)...);
+
+			TArray<TSharedRef<FDelegate>> result;
+			result.Reserve(SnapshotBindings.Num());
+			for (FSnapshotBinding const& binding : SnapshotBindings)
+				result.Add(binding.Delegate);
+
+			SweepOnceBindings();
+			return result;
+		}
+
+		/** @brief Storage of arguments enqueued for a later broadcast with the Queued policy */
+		using FQueuedArguments = TTuple<std::decay_t<Args>...>;
+
+		/** @brief Listener type receiving a whole batch of queued broadcasts at once */
+		using FBatchDelegate = TDelegate<void(TArrayView<const FQueuedArguments>)>;
+
+		/**
+		 *	@brief
+		 *	Store arguments for a broadcast during the next `Flush`. It is thread-safe regardless of the ThreadSafe
+		 *	policy, and it doesn't execute any listeners. Only available with the Queued policy.
+		 */
+		template <typename... BroadcastArgs>
+		requires (DefaultPolicy.Queued && CConvertibleTo<TTuple<BroadcastArgs...>, FQueuedArguments>)
+		void Enqueue(BroadcastArgs&&... args)
+		{
+			FScopeLock lock(&Queue.Lock.Get());
+			Queue.Entries.Emplace(FWD(args)...);
+		}
+
+		/**
+		 *	@brief
+		 *	Same as `Enqueue` but when arguments were already queued with the same key since the last `Flush`, they are
+		 *	replaced with the new ones, keeping their original order. Only available with the Queued policy.
+		 */
+		template <typename... BroadcastArgs>
+		requires (DefaultPolicy.Queued && CConvertibleTo<TTuple<BroadcastArgs...>, FQueuedArguments>)
+		void EnqueueUnique(uint64 key, BroadcastArgs&&... args)
+		{
+			FScopeLock lock(&Queue.Lock.Get());
+			if (const int32* index = Queue.Keys.Find(key))
+				Queue.Entries[*index] = FQueuedArguments(FWD(args)...);
+			else
+				Queue.Keys.Add(key, Queue.Entries.Emplace(FWD(args)...));
+		}
+
+		/** @brief Add a listener receiving all broadcasts of a `Flush` at once. Only available with the Queued policy. */
+		FDelegateHandle AddBatch(FBatchDelegate delegate) requires DefaultPolicy.Queued
 		{
 			MutexLock lock(&Mutex.Get());
+			return Queue.BatchDelegate.Add(delegate);
+		}
+
+		/** @brief Remove a listener added with `AddBatch` */
+		bool RemoveBatch(FDelegateHandle const& delegateHandle) requires DefaultPolicy.Queued
+		{
+			MutexLock lock(&Mutex.Get());
+			return Queue.BatchDelegate.Remove(delegateHandle);
+		}
+
+		/**
+		 *	@brief
+		 *	Broadcast everything queued since the last `Flush` on the calling thread. Batch listeners are executed once
+		 *	with all entries, regular listeners are executed for each entry in order. Only available with the Queued
+		 *	policy.
+		 *
+		 *	@return The number of flushed broadcasts
+		 */
+		int32 Flush() requires (DefaultPolicy.Queued && (!std::is_rvalue_reference_v<Args> && ...))
+		{
+			TArray<FQueuedArguments> entries;
+			{
+				FScopeLock lock(&Queue.Lock.Get());
+				entries = MoveTemp(Queue.Entries);
+				Queue.Keys.Reset();
+			}
+			if (entries.IsEmpty()) return 0;
+
+			{
+				MutexLock lock(&Mutex.Get());
+				Queue.BatchDelegate.Broadcast(TArrayView<const FQueuedArguments>(entries));
+			}
+			for (FQueuedArguments& entry : entries)
+			{
+				entry.ApplyAfter([this](auto&... arguments)
+				{
+					Broadcast(arguments...);
+				});
+			}
+			return entries.Num();
+		}
+
+	private:
+		template <typename... BroadcastArgs>
+		void UpdateCache(BroadcastArgs&&... args)
+		{
 			bHasBroadcasted = true;
-			if constexpr (DefaultPolicy.CacheViaCopy)
+			if constexpr (DefaultPolicy.LazyCache && !DefaultPolicy.Belated)
 			{
-				// this here actually copies twice, instead of once, but if we don't have this temporary variable
-				// it doesn't copy at all. CopyTemp, or function with pass-by-copy parameters didn't help
-				ArgumentsCache cache{args...};
-				Cache = cache;
+				if (!bHasBelatedBindings) return;
 			}
+
+			// Construct the cache in-place, so arguments are copied exactly once with CacheViaCopy
+			if constexpr (DefaultPolicy.CacheViaCopy)
+				GetCache().Emplace(std::as_const(args)...);
 			else
-				Cache = ArgumentsCache(FWD(args)...);
-			
+				GetCache().Emplace(FWD(args)...);
+		}
+
+		TOptional<ArgumentsCache>& GetCache()
+		{
+			if constexpr (OnDemandCache)
+				return Cache.FindOrAdd();
+			else
+				return Cache;
+		}
+
+		template <typename... BroadcastArgs>
+		void BroadcastSnapshot(BroadcastArgs&&... args)
+		{
+			{
+				MutexLock lock(&Mutex.Get());
+				UpdateCache(FWD(args)...);
+			}
+
+			int32 stale = 0;
+			auto const* snapshot = Snapshot.Pin();
+			for (FSnapshotBinding const& binding : snapshot->Value.GetValue())
+			{
+				if (!binding.Delegate->ExecuteIfBound(args...))
+					++stale;
+			}
+			Snapshot.Unpin(snapshot);
+
+			MutexLock lock(&Mutex.Get());
+			SweepOnceBindings();
+			CompactAfterBroadcast(stale);
+		}
+
+		template <typename... BroadcastArgs>
+		void BroadcastLocked(BroadcastArgs&&... args)
+		{
+			MutexLock lock(&Mutex.Get());
+			UpdateCache(FWD(args)...);
 			MulticastDelegate.Broadcast(FWD(args)...);
-		
-			for (const FDelegateHandle& handle : OnlyNextDelegates)
-				MulticastDelegate.Remove(handle);
+			SweepOnceBindings();
+			CompactAfterBroadcast(0);
+		}
+
+		/**
+		 *	@brief
+		 *	Sweep stale bindings in bulk, once enough of them were detected. Snapshot bindings failing to execute are
+		 *	counted as stale. The MulticastDelegate compacts its own invocation list on broadcast, but the bookkeeping
+		 *	of dynamic bindings can only be checked through their objects, so that check is amortized over at least as
+		 *	many broadcasts as there are dynamic bindings.
+		 */
+		void CompactAfterBroadcast(int32 stale)
+		{
+			StaleBindings += stale;
+			if (StaleBindings >= StaleBindingCompactionThreshold)
+			{
+				CompactInternal();
+				return;
+			}
+			if (auto* boundUFunctions = BoundUFunctions.Find())
+			if (++BroadcastsSinceCompaction > FMath::Max(StaleBindingCompactionThreshold, boundUFunctions->Handles.Num()))
+				CompactInternal();
+		}
+
+		int32 CompactInternal()
+		{
+			MCRO_TRACE_SCOPE(Events, "TEventDelegate::Compact");
+			Instrumentation::OnBindingSweep();
+			StaleBindings = 0;
+			BroadcastsSinceCompaction = 0;
+
+			int32 removed = 0;
+			if constexpr (UseSnapshots)
+			{
+				TArray<FDelegateHandle, TInlineAllocator<16>> staleHandles;
+				SnapshotBindings.RemoveAll([&](FSnapshotBinding const& binding)
+				{
+					if (binding.Delegate->IsBound()) return false;
+					staleHandles.Add(binding.Handle);
+					return true;
+				});
+				if (!staleHandles.IsEmpty())
+				{
+					Snapshot.Publish(SnapshotBindings);
+					for (FDelegateHandle const& handle : staleHandles)
+					{
+						ForgetBoundUFunction(handle);
+						if (auto* onlyNextDelegates = OnlyNextDelegates.Find())
+							onlyNextDelegates->Remove(handle);
+					}
+				}
+				removed += staleHandles.Num();
+			}
+
+			if (auto* boundUFunctions = BoundUFunctions.Find())
+			{
+				for (auto it = boundUFunctions->Handles.CreateIterator(); it; ++it)
+				{
+					if (it.Key().Key.IsValid()) continue;
+					if constexpr (!UseSnapshots)
+						removed += MulticastDelegate.Remove(it.Value()) ? 1 : 0;
+					boundUFunctions->Keys.Remove(it.Value());
+					it.RemoveCurrent();
+				}
+			}
+			return removed;
+		}
+
+		/** @brief Remove all bindings which were only meant for the next broadcast in a single pass */
+		void SweepOnceBindings()
+		{
+			auto* onlyNextDelegates = OnlyNextDelegates.Find();
+			if (!onlyNextDelegates || onlyNextDelegates->IsEmpty()) return;
+
+			if constexpr (UseSnapshots)
+			{
+				SnapshotBindings.RemoveAll([this](FSnapshotBinding const& binding)
+				{
+					return onlyNextDelegates->Contains(binding.Handle);
+				});
+				Snapshot.Publish(SnapshotBindings);
+			}
 			
-			OnlyNextDelegates.Empty();
+			for (const FDelegateHandle& handle : *onlyNextDelegates)
+			{
+				if constexpr (!UseSnapshots)
+					MulticastDelegate.Remove(handle);
+				ForgetBoundUFunction(handle);
+			}
+			onlyNextDelegates->Empty();
+		}
+
+		void ForgetBoundUFunction(const FDelegateHandle& delegateHandle)
+		{
+			auto* boundUFunctions = BoundUFunctions.Find();
+			if (!boundUFunctions || boundUFunctions->Keys.IsEmpty()) return;
+			
+			FBoundUFunction key;
+			if (boundUFunctions->Keys.RemoveAndCopyValue(delegateHandle, key))
+				boundUFunctions->Handles.Remove(key);
 		}
 
+	public:
+
 		/**
 		 *	@brief
 		 *	Create a delegate object which is broadcasting this event. This is useful for chaining
@@ -210,7 +462,7 @@ namespace Mcro::Delegates
 		FDelegateHandle Add(const DynamicDelegateType& dynamicDelegate, FEventPolicy const& policy = {})
 		{
 			MutexLock lock(&Mutex.Get());
-			return AddInternal(AsNative(dynamicDelegate), policy, {}, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
+			return AddInternal(AsFastNative(dynamicDelegate), policy, {}, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
 		}
 
 		/**
@@ -230,18 +482,27 @@ namespace Mcro::Delegates
 		FDelegateHandle AddUnique(const DynamicDelegateType& dynamicDelegate, FEventPolicy const& policy = {})
 		{
 			MutexLock lock(&Mutex.Get());
-			return AddUniqueInternal(AsNative(dynamicDelegate), policy, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
+			return AddUniqueInternal(AsFastNative(dynamicDelegate), policy, dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName());
 		}
 
 	private:
 		bool RemoveInternal(const FDelegateHandle& delegateHandle)
 		{
-			const bool result = MulticastDelegate.Remove(delegateHandle);
-
-			if (const FBoundUFunction* key = BoundUFunctionsMap.FindKey(delegateHandle))
-				BoundUFunctionsMap.Remove(*key);
+			bool result;
+			if constexpr (UseSnapshots)
+			{
+				result = SnapshotBindings.RemoveAll([&](FSnapshotBinding const& binding)
+				{
+					return binding.Handle == delegateHandle;
+				}) > 0;
+				if (result) Snapshot.Publish(SnapshotBindings);
+			}
+			else
+				result = MulticastDelegate.Remove(delegateHandle);
 
-			OnlyNextDelegates.Remove(delegateHandle);
+			ForgetBoundUFunction(delegateHandle);
+			if (auto* onlyNextDelegates = OnlyNextDelegates.Find())
+				onlyNextDelegates->Remove(delegateHandle);
 
 			return result;
 		}
@@ -271,8 +532,12 @@ namespace Mcro::Delegates
 		bool Remove(const DynamicDelegateType& dynamicDelegate)
 		{
 			MutexLock lock(&Mutex.Get());
+			auto* boundUFunctions = BoundUFunctions.Find();
 			FDelegateHandle delegateHandle;
-			if (BoundUFunctionsMap.RemoveAndCopyValue(FBoundUFunction(dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName()), delegateHandle))
+			if (boundUFunctions && boundUFunctions->Handles.RemoveAndCopyValue(
+				FBoundUFunction(dynamicDelegate.GetUObject(), dynamicDelegate.GetFunctionName()),
+				delegateHandle
+			))
 				return RemoveInternal(delegateHandle);
 
 			return false;
@@ -288,11 +553,40 @@ namespace Mcro::Delegates
 		int32 RemoveAll(const void* inUserObject)
 		{
 			MutexLock lock(&Mutex.Get());
-			for (auto it = BoundUFunctionsMap.CreateIterator(); it; ++it)
-				if (!it.Key().Key.IsValid() || it.Key().Key.Get() == inUserObject)
-					it.RemoveCurrent();
+			if (auto* boundUFunctions = BoundUFunctions.Find())
+			{
+				for (auto it = boundUFunctions->Handles.CreateIterator(); it; ++it)
+					if (!it.Key().Key.IsValid() || it.Key().Key.Get() == inUserObject)
+					{
+						boundUFunctions->Keys.Remove(it.Value());
+						it.RemoveCurrent();
+					}
+			}
 
-			return MulticastDelegate.RemoveAll(inUserObject);
+			if constexpr (UseSnapshots)
+			{
+				const int32 result = SnapshotBindings.RemoveAll([&](FSnapshotBinding const& binding)
+				{
+					return binding.Delegate->IsBoundToObject(inUserObject);
+				});
+				if (result > 0) Snapshot.Publish(SnapshotBindings);
+				return result;
+			}
+			else
+				return MulticastDelegate.RemoveAll(inUserObject);
+		}
+
+		/**
+		 *	@brief
+		 *	Remove bindings to destroyed objects or expired shared pointers right away, instead of waiting for the
+		 *	automatic compaction during broadcasts.
+		 *
+		 *	@return The number of removed bindings which were still held by this event delegate
+		 */
+		int32 Compact()
+		{
+			MutexLock lock(&Mutex.Get());
+			return CompactInternal();
 		}
 
 		/** @brief Resets all states of this event delegate to their default. */
@@ -300,12 +594,30 @@ namespace Mcro::Delegates
 		{
 			MutexLock lock(&Mutex.Get());
 			MulticastDelegate.Clear();
+			if constexpr (UseSnapshots)
+			{
+				SnapshotBindings.Reset();
+				Snapshot.Publish(SnapshotBindings);
+			}
 			OnlyNextDelegates.Reset();
-			BoundUFunctionsMap.Reset();
+			BoundUFunctions.Reset();
 			bHasBroadcasted = false;
+			bHasBelatedBindings = false;
 			Cache.Reset();
 		}
 
+		/** @returns true if this event delegate has any bindings. */
+		bool IsBound() const
+		{
+			if constexpr (UseSnapshots)
+			{
+				MutexLock lock(&Mutex.Get());
+				return !SnapshotBindings.IsEmpty();
+			}
+			else
+				return MulticastDelegate.IsBound();
+		}
+
 		/** @returns true if this event delegate was ever broadcasted. */
 		bool IsBroadcasted() const
 		{
@@ -322,7 +634,8 @@ namespace Mcro::Delegates
 		) {
 			FDelegateHandle uniqueHandle;
 			
-			if (const FDelegateHandle* delegateHandle = BoundUFunctionsMap.Find(FBoundUFunction(boundObject, boundFunctionName)))
+			if (auto* boundUFunctions = BoundUFunctions.Find())
+			if (const FDelegateHandle* delegateHandle = boundUFunctions->Handles.Find(FBoundUFunction(boundObject, boundFunctionName)))
 				uniqueHandle = *delegateHandle;
 			
 			return AddInternal(delegate, policy, uniqueHandle, boundObject, boundFunctionName);
@@ -336,8 +649,9 @@ namespace Mcro::Delegates
 			FName const& boundFunctionName = NAME_None
 		) {
 			const FEventPolicy actualPolicy = policy.With(DefaultPolicy);
+			bHasBelatedBindings |= actualPolicy.Belated;
 
-			if (bHasBroadcasted && actualPolicy.Belated && actualPolicy.Once)
+			if (CanCallBelated() && actualPolicy.Belated && actualPolicy.Once)
 			{
 				CallBelated(delegate);
 				return FDelegateHandle();
@@ -346,66 +660,110 @@ namespace Mcro::Delegates
 			FDelegateHandle outputHandle = uniqueHandle;
 			if (!outputHandle.IsValid())
 			{
-				outputHandle = MulticastDelegate.Add(delegate);
+				if constexpr (UseSnapshots)
+				{
+					if (delegate.IsBound())
+					{
+						outputHandle = delegate.GetHandle();
+						SnapshotBindings.Add({ outputHandle, MakeShared<FDelegate>(delegate) });
+						Snapshot.Publish(SnapshotBindings);
+					}
+				}
+				else
+					outputHandle = MulticastDelegate.Add(delegate);
 
 				if (boundObject && boundFunctionName != NAME_None)
-					BoundUFunctionsMap.Add(FBoundUFunction(boundObject, boundFunctionName), outputHandle);
+				{
+					auto& boundUFunctions = BoundUFunctions.FindOrAdd();
+					boundUFunctions.Handles.Add(FBoundUFunction(boundObject, boundFunctionName), outputHandle);
+					boundUFunctions.Keys.Add(outputHandle, FBoundUFunction(boundObject, boundFunctionName));
+				}
 
 				if (actualPolicy.Once)
-					OnlyNextDelegates.Add(outputHandle);
+					OnlyNextDelegates.FindOrAdd().Add(outputHandle);
 			}
 
-			if (bHasBroadcasted && actualPolicy.Belated)
+			if (CanCallBelated() && actualPolicy.Belated)
 				CallBelated(delegate);
 			
 			return outputHandle;
 		}
 
+		bool CanCallBelated() const
+		{
+			if constexpr (OnDemandCache)
+			{
+				auto const* cache = Cache.Find();
+				return bHasBroadcasted && cache && cache->IsSet();
+			}
+			else
+				return bHasBroadcasted && Cache.IsSet();
+		}
+
 		void CallBelated(FDelegate& delegate)
 		{
-			InvokeWithTuple(&delegate, &FDelegate::Execute, Cache.GetValue());
+			InvokeWithTuple(&delegate, &FDelegate::Execute, GetCache().GetValue());
 		}
 		
 		using FBoundUFunction = TPair<TWeakObjectPtr<const UObject>, FName>;
 
+		struct FSnapshotBinding
+		{
+			FDelegateHandle Handle;
+			TSharedRef<FDelegate> Delegate;
+		};
+		using FSnapshotBindings = TArray<FSnapshotBinding>;
+
+		struct FNoSnapshotBindings {};
+		struct FNoSnapshot {};
+
+		// Only needed by bindings of dynamic delegates, Remove and AddUnique find them by their object and function
+		struct FBoundUFunctions
+		{
+			TMap<FBoundUFunction, FDelegateHandle> Handles;
+			TMap<FDelegateHandle, FBoundUFunction> Keys;
+		};
+
+		using FCache = std::conditional_t<OnDemandCache,
+			Detail::TOnDemand<TOptional<ArgumentsCache>>,
+			TOptional<ArgumentsCache>
+		>;
+
+		struct FQueue
+		{
+			TInitializeOnCopy<FCriticalSection> Lock;
+			TArray<FQueuedArguments> Entries;
+			TMap<uint64, int32> Keys;
+			TMulticastDelegate<void(TArrayView<const FQueuedArguments>), FDefaultDelegateUserPolicy> BatchDelegate;
+		};
+
+		struct FNoQueue {};
+
 		bool bHasBroadcasted = false;
+		bool bHasBelatedBindings = false;
+		int32 StaleBindings = 0;
+		int32 BroadcastsSinceCompaction = 0;
 		
-		mutable TInitializeOnCopy<FCriticalSection> Mutex;
-		TSet<FDelegateHandle>                       OnlyNextDelegates;
-		TMap<FBoundUFunction, FDelegateHandle>      BoundUFunctionsMap;
-		TOptional<ArgumentsCache>                   Cache;
+		// Members which are not needed by a policy are either empty or allocated only when they're first used
+		UE_NO_UNIQUE_ADDRESS
+		mutable TInitializeOnCopyIf<DefaultPolicy.ThreadSafe, FCriticalSection> Mutex;
+		Detail::TOnDemand<TSet<FDelegateHandle>> OnlyNextDelegates;
+		Detail::TOnDemand<FBoundUFunctions>      BoundUFunctions;
+		FCache                                   Cache;
 		TMulticastDelegate<void(Args...), FDefaultDelegateUserPolicy> MulticastDelegate;
-	};
-
-	/** @brief Shorthand alias for TEventDelegate which copies arguments to its cache regardless of their qualifiers */
-	template <typename Signature, FEventPolicy DefaultPolicy = {}>
-	using TRetainingEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.CacheViaCopy = true})>;
-
-	/** @brief Shorthand alias for TEventDelegate which broadcasts listeners immediately once they're added */
-	template <typename Signature, FEventPolicy DefaultPolicy = {}>
-	using TBelatedEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Belated = true})>;
 
-	/** @brief Shorthand alias for combination of TRetainingEventDelegate and TBelatedEventDelegate */
-	template <typename Signature, FEventPolicy DefaultPolicy = {}>
-	using TBelatedRetainingEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Belated = true, .CacheViaCopy = true})>;
+		// With UseSnapshots, these are used instead of the MulticastDelegate. SnapshotBindings is only accessed under
+		// the lock, Snapshot is its last published copy.
+		UE_NO_UNIQUE_ADDRESS
+		std::conditional_t<UseSnapshots, FSnapshotBindings, FNoSnapshotBindings> SnapshotBindings;
+		UE_NO_UNIQUE_ADDRESS
+		std::conditional_t<UseSnapshots, Mcro::Threading::TSnapshotStorage<FSnapshotBindings>, FNoSnapshot> Snapshot;
+		UE_NO_UNIQUE_ADDRESS
+		std::conditional_t<DefaultPolicy.Queued, FQueue, FNoQueue> Queue;
+	};
 
-	/** @brief Shorthand alias for TEventDelegate which broadcasts listeners only once and then they're removed */
-	template <typename Signature, FEventPolicy DefaultPolicy = {}>
-	using TOneTimeEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Once = true})>;
-	
-	/** @brief Shorthand alias for combination of TRetainingEventDelegate and TOneTimeEventDelegate */
-	template <typename Signature, FEventPolicy DefaultPolicy = {}>
-	using TOneTimeRetainingEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Once = true, .CacheViaCopy = true})>;
-
-	/** @brief Shorthand alias for combination of TBelatedEventDelegate and TOneTimeEventDelegate */
-	template <typename Signature, FEventPolicy DefaultPolicy = {}>
-	using TOneTimeBelatedEventDelegate = TEventDelegate<Signature, DefaultPolicy.With({.Once = true, .Belated = true})>;
-
-	/** @brief Collect'em all */
-	template <typename Signature, FEventPolicy DefaultPolicy = {}>
-	using TOneTimeRetainingBelatedEventDelegate = TEventDelegate<Signature,
-		DefaultPolicy.With({.Once = true, .Belated = true, .CacheViaCopy = true})
-	>;
+	/** @brief Parameterless events are instantiated once inside MCRO, so dependant modules don't compile them again */
+	extern template class MCRO_API TEventDelegate<void()>;
 
 	/** @brief Map the input dynamic multicast delegate to a conceptually compatible native event delegate type */
 	template <CDynamicMulticastDelegate Dynamic, FEventPolicy DefaultPolicy = {}>
@@ -0,0 +1,135 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Concepts.h"
+
+#include <type_traits>
+
+namespace Mcro::Delegates
+{
+	using namespace Mcro::Concepts;
+
+	/** @brief Default number of bytes a TInlineFunction can store its functor in */
+	inline constexpr int32 DefaultInlineFunctionCapacity = 64;
+
+	template <typename Signature, int32 Capacity = DefaultInlineFunctionCapacity>
+	class TInlineFunction {};
+
+	/**
+	 *	@brief
+	 *	A move-only type-erased callable which stores its functor inside itself, so binding a lambda never allocates.
+	 *	Functors which don't fit into Capacity are rejected at compile time instead of spilling to the heap. Meant for
+	 *	internal event plumbing where TFunction or a TDelegate would allocate for small captures, and for task
+	 *	submission with RunInThreadInline.
+	 *
+	 *	@code
+	 *	TInlineFunction<void(int32)> onValue = [this, scale](int32 value) { Total += value * scale; };
+	 *	onValue(2);
+	 *	@endcode
+	 *
+	 *	@tparam Capacity  Number of bytes available for the captures of the functor
+	 */
+	template <typename Return, typename... Args, int32 Capacity>
+	class TInlineFunction<Return(Args...), Capacity>
+	{
+		struct FOperations
+		{
+			Return (*Invoke)(void* functor, Args&&... args);
+			void (*Move)(void* to, void* from);
+			void (*Destroy)(void* functor);
+		};
+
+		template <typename Functor>
+		static constexpr FOperations Operations {
+			.Invoke = [](void* functor, Args&&... args) -> Return
+			{
+				return ::Invoke(*static_cast<Functor*>(functor), Forward<Args>(args)...);
+			},
+			.Move = [](void* to, void* from)
+			{
+				new (to) Functor(MoveTemp(*static_cast<Functor*>(from)));
+				static_cast<Functor*>(from)->~Functor();
+			},
+			.Destroy = [](void* functor) { static_cast<Functor*>(functor)->~Functor(); }
+		};
+
+	public:
+		TInlineFunction() = default;
+		TInlineFunction(TYPE_OF_NULLPTR) {}
+
+		template <typename Functor>
+		requires (!CSameAsDecayed<Functor, TInlineFunction>)
+			&& std::is_invocable_r_v<Return, std::decay_t<Functor>&, Args...>
+		TInlineFunction(Functor&& functor)
+		{
+			using FFunctor = std::decay_t<Functor>;
+			static_assert(sizeof(FFunctor) <= Capacity,
+				"The captures of this functor don't fit into TInlineFunction, increase its Capacity"
+			);
+			static_assert(alignof(FFunctor) <= alignof(std::max_align_t),
+				"TInlineFunction doesn't support over-aligned functors"
+			);
+			new (Storage) FFunctor(FWD(functor));
+			Functions = &Operations<FFunctor>;
+		}
+
+		TInlineFunction(TInlineFunction&& other) noexcept
+		{
+			MoveFrom(other);
+		}
+
+		TInlineFunction& operator = (TInlineFunction&& other) noexcept
+		{
+			if (&other != this)
+			{
+				Reset();
+				MoveFrom(other);
+			}
+			return *this;
+		}
+
+		TInlineFunction(TInlineFunction const&) = delete;
+		TInlineFunction& operator = (TInlineFunction const&) = delete;
+
+		~TInlineFunction() { Reset(); }
+
+		Return operator () (Args... args) const
+		{
+			checkf(Functions, TEXT("Attempting to call an unset TInlineFunction"));
+			return Functions->Invoke(Storage, Forward<Args>(args)...);
+		}
+
+		bool IsSet() const { return Functions != nullptr; }
+		explicit operator bool () const { return IsSet(); }
+
+		void Reset()
+		{
+			if (Functions) Functions->Destroy(Storage);
+			Functions = nullptr;
+		}
+
+	private:
+		void MoveFrom(TInlineFunction& other)
+		{
+			if (other.Functions)
+			{
+				other.Functions->Move(Storage, other.Storage);
+				Functions = Exchange(other.Functions, nullptr);
+			}
+		}
+
+		alignas(std::max_align_t) mutable uint8 Storage[Capacity];
+		const FOperations* Functions = nullptr;
+	};
+}
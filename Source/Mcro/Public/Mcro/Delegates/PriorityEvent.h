@@ -0,0 +1,232 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Delegates/EventDelegate.h"
+
+namespace Mcro::Delegates
+{
+	template <typename Signature, FEventPolicy DefaultPolicy = {}>
+	class TPriorityEvent {};
+
+	/**
+	 *	@brief
+	 *	An event which executes its bindings ordered by their priority (higher first, insertion order among equal
+	 *	priorities). Bindings are kept sorted when they're added, so broadcasting is a plain loop.
+	 *
+	 *	When the signature returns `bool`, returning true from a binding means the event has been "handled", and
+	 *	the remaining bindings with lower priority are not executed. In that case Broadcast returns whether the event
+	 *	was handled. This is useful for input routing or validation chains.
+	 *
+	 *	It shares the FEventPolicy vocabulary with TEventDelegate, but only Once, Belated, CacheViaCopy and ThreadSafe
+	 *	are supported. Belated bindings of a `bool` signature are executed regardless of their result.
+	 *
+	 *	@code
+	 *	TPriorityEvent<bool(FKeyEvent const&)> OnKey;
+	 *	OnKey.Add(From(this, &SMyWidget::HandleShortcuts), 100);
+	 *	OnKey.Add(From(this, &SMyWidget::HandleTyping));
+	 *	bool handled = OnKey.Broadcast(keyEvent);
+	 *	@endcode
+	 */
+	template <typename Return, typename... Args, FEventPolicy DefaultPolicy>
+	requires (CSameAs<Return, void> || CSameAs<Return, bool>)
+	class TPriorityEvent<Return(Args...), DefaultPolicy>
+	{
+		static_assert(!DefaultPolicy.LockFreeBroadcast && !DefaultPolicy.LazyCache && !DefaultPolicy.Queued,
+			"TPriorityEvent only supports Once, Belated, CacheViaCopy and ThreadSafe policies"
+		);
+		static_assert((!std::is_rvalue_reference_v<Args> && ...),
+			"TPriorityEvent cannot forward rvalue references to multiple listeners"
+		);
+
+	public:
+		using FDelegate = TDelegate<Return(Args...), FDefaultDelegateUserPolicy>;
+		static constexpr bool CanBeHandled = CSameAs<Return, bool>;
+
+		using ArgumentsCache = std::conditional_t<
+			DefaultPolicy.CacheViaCopy,
+			TTuple<std::decay_t<Args>...>,
+			TTuple<Args...>
+		>;
+
+		/**
+		 *	@brief  Adds a new delegate to the event.
+		 *	@param delegate  The delegate to bind
+		 *	@param priority  Bindings with higher priority are executed first
+		 *	@param   policy  The (optional) settings to use for this binding
+		 *	@return Handle to the delegate
+		 */
+		FDelegateHandle Add(FDelegate delegate, int32 priority = 0, FEventPolicy const& policy = {})
+		{
+			MutexLock lock(&Mutex.Get());
+			const FEventPolicy actualPolicy = policy.With(DefaultPolicy);
+			if (bHasBroadcasted && actualPolicy.Belated)
+			{
+				InvokeWithTuple(&delegate, &FDelegate::Execute, Cache.GetValue());
+				if (actualPolicy.Once) return {};
+			}
+
+			FBinding binding {
+				.Delegate = MoveTemp(delegate),
+				.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle),
+				.Priority = priority,
+				.Once = actualPolicy.Once
+			};
+			FDelegateHandle handle = binding.Handle;
+
+			if (BroadcastDepth > 0)
+				PendingBindings.Add(MoveTemp(binding));
+			else
+				Insert(MoveTemp(binding));
+			return handle;
+		}
+
+		/** @brief Remove the binding associated to the given handle */
+		bool Remove(FDelegateHandle const& handle)
+		{
+			MutexLock lock(&Mutex.Get());
+			return RemoveBindings([&](FBinding const& binding) { return binding.Handle == handle; }) > 0;
+		}
+
+		/** @brief Removes all binding associated to the given object */
+		int32 RemoveAll(const void* object)
+		{
+			MutexLock lock(&Mutex.Get());
+			return RemoveBindings([&](FBinding const& binding) { return binding.Delegate.IsBoundToObject(object); });
+		}
+
+		/**
+		 *	@brief  Execute bindings in order of their priority
+		 *	@return With a `bool` signature, true when a binding has handled the event
+		 */
+		template <typename... BroadcastArgs>
+		requires CConvertibleTo<TTuple<BroadcastArgs...>, TTuple<Args...>>
+		Return Broadcast(BroadcastArgs&&... args)
+		{
+			MutexLock lock(&Mutex.Get());
+			bHasBroadcasted = true;
+			if constexpr (DefaultPolicy.CacheViaCopy)
+				Cache.Emplace(std::as_const(args)...);
+			else
+				Cache.Emplace(args...);
+
+			bool handled = false;
+			++BroadcastDepth;
+			for (int32 i = 0; i < Bindings.Num(); ++i)
+			{
+				FBinding& binding = Bindings[i];
+				if (!binding.Delegate.IsBound() || binding.bExecuted) continue;
+				binding.bExecuted = binding.Once;
+				
+				if constexpr (CanBeHandled)
+				{
+					if (binding.Delegate.Execute(args...))
+					{
+						handled = true;
+						break;
+					}
+				}
+				else binding.Delegate.Execute(args...);
+			}
+			--BroadcastDepth;
+
+			if (BroadcastDepth == 0)
+			{
+				// Bindings removed during the broadcast were only unbound, and once-bindings skipped by a handled
+				// event stay for the next broadcast
+				Bindings.RemoveAll([](FBinding const& binding)
+				{
+					return !binding.Delegate.IsBound() || binding.bExecuted;
+				});
+				for (FBinding& binding : PendingBindings)
+					Insert(MoveTemp(binding));
+				PendingBindings.Reset();
+			}
+
+			if constexpr (CanBeHandled) return handled;
+			else return;
+		}
+
+		/** @brief Remove all bindings and the broadcasted state */
+		void Reset()
+		{
+			MutexLock lock(&Mutex.Get());
+			if (BroadcastDepth > 0)
+				for (FBinding& binding : Bindings) binding.Delegate.Unbind();
+			else
+				Bindings.Reset();
+			PendingBindings.Reset();
+			bHasBroadcasted = false;
+			Cache.Reset();
+		}
+
+		int32 Num() const { return Bindings.Num() + PendingBindings.Num(); }
+		bool IsBound() const { return Num() > 0; }
+		bool IsBroadcasted() const { return bHasBroadcasted; }
+
+	private:
+		using MutexLock = std::conditional_t<DefaultPolicy.ThreadSafe, FScopeLock, FVoid>;
+
+		struct FBinding
+		{
+			FDelegate Delegate;
+			FDelegateHandle Handle;
+			int32 Priority = 0;
+			bool Once = false;
+			bool bExecuted = false;
+		};
+
+		void Insert(FBinding&& binding)
+		{
+			// Bindings are sorted descending, find the first one with lower priority (upper bound)
+			int32 index = Bindings.Num();
+			for (int32 i = 0; i < Bindings.Num(); ++i)
+			{
+				if (Bindings[i].Priority < binding.Priority)
+				{
+					index = i;
+					break;
+				}
+			}
+			Bindings.Insert(MoveTemp(binding), index);
+		}
+
+		template <typename Predicate>
+		int32 RemoveBindings(Predicate&& predicate)
+		{
+			const int32 removedPending = PendingBindings.RemoveAll(predicate);
+			if (BroadcastDepth == 0)
+				return Bindings.RemoveAll(predicate) + removedPending;
+
+			int32 removed = 0;
+			for (FBinding& binding : Bindings)
+			{
+				if (binding.Delegate.IsBound() && predicate(binding))
+				{
+					binding.Delegate.Unbind();
+					++removed;
+				}
+			}
+			return removed + removedPending;
+		}
+
+		TArray<FBinding> Bindings;
+		TArray<FBinding> PendingBindings;
+		bool bHasBroadcasted = false;
+		int32 BroadcastDepth = 0;
+		TOptional<ArgumentsCache> Cache;
+		UE_NO_UNIQUE_ADDRESS
+		mutable TInitializeOnCopyIf<DefaultPolicy.ThreadSafe, FCriticalSection> Mutex;
+	};
+}
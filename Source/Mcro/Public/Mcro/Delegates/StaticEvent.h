@@ -0,0 +1,231 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/AssertMacros.h"
+#include "Mcro/Delegates/EventDelegate.h"
+
+namespace Mcro::Delegates
+{
+	/** @brief Default number of bindings a TInlineEvent can hold */
+	inline constexpr int32 DefaultInlineEventCapacity = 8;
+
+	template <typename Signature, int32 Capacity = DefaultInlineEventCapacity, FEventPolicy DefaultPolicy = {}>
+	class TInlineEvent {};
+
+	/**
+	 *	@brief
+	 *	A fixed capacity event for hot internal events, storing raw function and object pointers contiguously without
+	 *	type-erased delegate instances. Adding bindings never allocates and broadcasting is a loop over plain function
+	 *	pointers. Member functions are bound through compile-time thunks.
+	 *
+	 *	It shares the FEventPolicy vocabulary with TEventDelegate, but only Once, Belated, CacheViaCopy and ThreadSafe
+	 *	are supported. Bindings are not lifetime checked, remove them before their object is destroyed.
+	 *
+	 *	@tparam Capacity  Maximum number of bindings
+	 */
+	template <typename... Args, int32 Capacity, FEventPolicy DefaultPolicy>
+	class TInlineEvent<void(Args...), Capacity, DefaultPolicy>
+	{
+		static_assert(!DefaultPolicy.LockFreeBroadcast && !DefaultPolicy.LazyCache && !DefaultPolicy.Queued,
+			"TInlineEvent only supports Once, Belated, CacheViaCopy and ThreadSafe policies"
+		);
+		static_assert((!std::is_rvalue_reference_v<Args> && ...),
+			"TInlineEvent cannot forward rvalue references to multiple listeners"
+		);
+		
+	public:
+		using FFunction = void(*)(Args...);
+		using FThunk = void(*)(void* object, FFunction function, Args... args);
+		
+		using ArgumentsCache = std::conditional_t<
+			DefaultPolicy.CacheViaCopy,
+			TTuple<std::decay_t<Args>...>,
+			TTuple<Args...>
+		>;
+
+		/** @brief Bind a free function or a non-capturing lambda */
+		FDelegateHandle Add(FFunction function, FEventPolicy const& policy = {})
+		{
+			return AddBinding({
+				.Object = nullptr,
+				.Function = function,
+				.Thunk = [](void*, FFunction target, Args... args) { target(args...); }
+			}, policy);
+		}
+
+		/**
+		 *	@brief  Bind a member function known at compile time
+		 *	@code
+		 *	MyEvent.Add<&FMyClass::OnMyEvent>(this);
+		 *	@endcode
+		 */
+		template <auto Method, typename Object>
+		requires std::is_invocable_v<decltype(Method), Object*, Args...>
+		FDelegateHandle Add(Object* object, FEventPolicy const& policy = {})
+		{
+			return AddBinding({
+				.Object = const_cast<std::remove_const_t<Object>*>(object),
+				.Function = nullptr,
+				.Thunk = [](void* target, FFunction, Args... args)
+				{
+					std::invoke(Method, static_cast<Object*>(target), args...);
+				}
+			}, policy);
+		}
+
+		/** @brief Remove the binding associated to the given handle */
+		bool Remove(FDelegateHandle const& handle)
+		{
+			MutexLock lock(&Mutex.Get());
+			for (int32 i = 0; i < Count; ++i)
+			{
+				if (Bindings[i].Handle == handle)
+				{
+					RemoveAt(i);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/** @brief Remove all member function bindings of the given object */
+		int32 RemoveAll(const void* object)
+		{
+			MutexLock lock(&Mutex.Get());
+			int32 removed = 0;
+			for (int32 i = Count - 1; i >= 0; --i)
+			{
+				if (Bindings[i].Object == object)
+				{
+					RemoveAt(i);
+					++removed;
+				}
+			}
+			return removed;
+		}
+
+		void Broadcast(Args... args)
+		{
+			MutexLock lock(&Mutex.Get());
+			bHasBroadcasted = true;
+			if constexpr (DefaultPolicy.CacheViaCopy)
+				Cache.Emplace(std::as_const(args)...);
+			else
+				Cache.Emplace(args...);
+
+			bool hasOnce = false;
+			for (int32 i = 0; i < Count; ++i)
+			{
+				FBinding const& binding = Bindings[i];
+				binding.Thunk(binding.Object, binding.Function, args...);
+				hasOnce |= binding.Once;
+			}
+
+			if (!hasOnce) return;
+			int32 kept = 0;
+			for (int32 i = 0; i < Count; ++i)
+			{
+				if (!Bindings[i].Once)
+					Bindings[kept++] = Bindings[i];
+			}
+			Count = kept;
+		}
+
+		/** @brief Remove all bindings and the broadcasted state */
+		void Reset()
+		{
+			MutexLock lock(&Mutex.Get());
+			Count = 0;
+			bHasBroadcasted = false;
+			Cache.Reset();
+		}
+
+		int32 Num() const { return Count; }
+		bool IsBound() const { return Count > 0; }
+		bool IsBroadcasted() const { return bHasBroadcasted; }
+
+	private:
+		using MutexLock = std::conditional_t<DefaultPolicy.ThreadSafe, FScopeLock, FVoid>;
+
+		struct FBinding
+		{
+			void* Object;
+			FFunction Function;
+			FThunk Thunk;
+			FDelegateHandle Handle;
+			bool Once = false;
+		};
+
+		FDelegateHandle AddBinding(FBinding binding, FEventPolicy const& policy)
+		{
+			MutexLock lock(&Mutex.Get());
+			const FEventPolicy actualPolicy = policy.With(DefaultPolicy);
+			const bool callBelated = bHasBroadcasted && actualPolicy.Belated;
+			if (callBelated)
+			{
+				Cache.GetValue().ApplyAfter([&](auto&... args)
+				{
+					binding.Thunk(binding.Object, binding.Function, args...);
+				});
+				if (actualPolicy.Once) return {};
+			}
+
+			ASSERT_QUIT(Count < Capacity, {},
+				->WithMessageF(TEXT_"TInlineEvent is full, it can only hold {0} bindings", Capacity)
+			);
+
+			binding.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+			binding.Once = actualPolicy.Once;
+			Bindings[Count++] = binding;
+			return binding.Handle;
+		}
+
+		void RemoveAt(int32 index)
+		{
+			for (int32 i = index + 1; i < Count; ++i)
+				Bindings[i - 1] = Bindings[i];
+			--Count;
+		}
+
+		FBinding Bindings[Capacity];
+		int32 Count = 0;
+		bool bHasBroadcasted = false;
+		TOptional<ArgumentsCache> Cache;
+		UE_NO_UNIQUE_ADDRESS
+		mutable TInitializeOnCopyIf<DefaultPolicy.ThreadSafe, FCriticalSection> Mutex;
+	};
+
+	/**
+	 *	@brief
+	 *	An event with its listeners known at compile time. Broadcasting it is a direct call of each listener, which
+	 *	the compiler can inline, without any storage or allocation.
+	 *	@code
+	 *	using FOnFrameEnd = TStaticEvent<void(float), &FlushStats, &FlushLogs>;
+	 *	FOnFrameEnd::Broadcast(deltaTime);
+	 *	@endcode
+	 */
+	template <typename Signature, auto... Listeners>
+	struct TStaticEvent {};
+
+	template <typename... Args, auto... Listeners>
+	requires (std::is_invocable_v<decltype(Listeners), Args...> && ...)
+	struct TStaticEvent<void(Args...), Listeners...>
+	{
+		static FORCEINLINE void Broadcast(Args... args)
+		{
+			(std::invoke(Listeners, args...), ...);
+		}
+	};
+}
@@ -17,12 +17,19 @@
 
 #include "Mcro/Concepts.h"
 
+#include <atomic>
+
 namespace Mcro::Dll
 {
 	using namespace Mcro::Concepts;
 	using namespace Mcro::Modules;
 	
-	/** @brief RAII wrapper around PushDllDirectory / PopDllDirectory */
+	/**
+	 *	@brief
+	 *	RAII wrapper around PushDllDirectory / PopDllDirectory. The DLL directory stack of FPlatformProcess is not
+	 *	thread safe, so a global lock is held while a search path is pushed. This serializes MCRO DLL loading with
+	 *	search paths across threads, but it doesn't protect against the engine pushing DLL directories directly.
+	 */
 	struct MCRO_API FScopedSearchPath
 	{
 		FScopedSearchPath(FString const& path);
@@ -36,12 +43,43 @@ namespace Mcro::Dll
 	struct MCRO_API FScopedDll
 	{
 		FScopedDll(const TCHAR* fileName);
+		FScopedDll(FScopedDll&& other) noexcept : Handle(Exchange(other.Handle, nullptr)) {}
+		FScopedDll(FScopedDll const&) = delete;
 		~FScopedDll();
+
+		void* GetHandle() const { return Handle; }
 		
 	private:
+		friend struct FScopedDllSet;
+		FScopedDll(void* handle) : Handle(handle) {}
+
 		void* Handle;
 	};
 
+	/** @brief A DLL of an FScopedDllSet and the other DLL's of the same set it has to be loaded after */
+	struct FDllDescriptor
+	{
+		FDllDescriptor(const TCHAR* fileName) : FileName(fileName) {}
+		FDllDescriptor(const TCHAR* fileName, TArray<FString> const& dependsOn)
+			: FileName(fileName)
+			, DependsOn(dependsOn)
+		{}
+
+		FString FileName;
+		TArray<FString> DependsOn;
+	};
+
+	/** @brief How long it took to load a DLL of an FScopedDllSet */
+	struct FDllLoadTiming
+	{
+		FString FileName;
+		double Seconds = 0;
+		bool bLoaded = false;
+
+		/** @brief The DLL wasn't attempted to be loaded, because one of its dependencies in the same set failed */
+		bool bSkipped = false;
+	};
+
 	/** @brief Handle multiple DLL files in one set and an optional base path for them */
 	struct MCRO_API FScopedDllSet
 	{
@@ -71,10 +109,92 @@ namespace Mcro::Dll
 			FScopedSearchPath pathContext(absPushPath);
 			(Dlls.Emplace(dllFiles), ...);
 		}
+
+		/**
+		 *	@brief
+		 *	Load DLL's in the order of their dependencies (in the same set), dependencies outside of the set are not
+		 *	considered. DLL's are loaded on the calling thread, because the pushed search path is only respected by
+		 *	loads happening while it's pushed. When a DLL couldn't be loaded, the DLL's depending on it are skipped.
+		 *	Every load is timed, see GetLoadTimings.
+		 *	
+		 *	@param pushPath  The absolute path to be pushed for the basis of finding given DLL's 
+		 *	@param     dlls  The DLL's with their dependencies inside this set
+		 */
+		FScopedDllSet(FString const& pushPath, TArray<FDllDescriptor> const& dlls);
+
+		/** @copydoc FScopedDllSet(FString const&, TArray<FDllDescriptor> const&) */
+		FScopedDllSet(TSharedPtr<IPlugin> plugin, FString const& pushPath, TArray<FDllDescriptor> const& dlls);
+
+		/** @brief Load times of each DLL, only recorded for sets loaded from FDllDescriptor's */
+		TConstArrayView<FDllLoadTiming> GetLoadTimings() const { return LoadTimings; }
+
+		/** @brief The DLL's of this set, including the ones which couldn't be loaded (with a null handle) */
+		TConstArrayView<FScopedDll> GetDlls() const { return Dlls; }
 		
 	private:
+		void LoadInDependencyOrder(TArray<FDllDescriptor> const& dlls);
 
 		TArray<FScopedDll> Dlls;
+		TArray<FDllLoadTiming> LoadTimings;
+	};
+
+	/**
+	 *	@brief
+	 *	A set of DLL's which are only loaded on first use, either explicitly with EnsureLoaded, or when a symbol is
+	 *	resolved from them. The set can be used from any thread: it's loaded once, and the search path is pushed
+	 *	under the lock of FScopedSearchPath. The engine modifies the DLL directory stack on the game thread without
+	 *	that lock while it loads modules, so if the first use may be on another thread during module loading,
+	 *	call EnsureLoaded on the game thread first.
+	 */
+	class MCRO_API FLazyDllSet
+	{
+	public:
+		/**
+		 *	@param searchPath  The absolute path to be pushed for the basis of finding given DLL's while loading them
+		 *	@param       dlls  The DLL's with their dependencies inside this set
+		 */
+		FLazyDllSet(FString const& searchPath, TArray<FDllDescriptor> const& dlls);
+
+		/** @brief Load the DLL's if they're not loaded yet. Fails if any of them couldn't be loaded. */
+		FCanFail EnsureLoaded();
+
+		bool IsLoaded() const { return bLoaded.load(std::memory_order_acquire); }
+
+		/** @brief Load the DLL's if needed and find an exported symbol in any of them which could be loaded */
+		void* ResolveSymbol(const TCHAR* symbol);
+
+		/**
+		 *	@brief
+		 *	Load the DLL's if needed and find an exported function in any of them. It only fails when the symbol is
+		 *	not found, then the DLL's which couldn't be loaded are listed in an inner error.
+		 *	
+		 *	@tparam Function  The function type of the symbol (not the pointer type)
+		 */
+		template <typename Function>
+		TMaybe<Function*> Resolve(const TCHAR* symbol)
+		{
+			// Symbols of the DLL's which did load are still available, when others in the set failed
+			if (void* address = ResolveSymbol(symbol))
+				return reinterpret_cast<Function*>(address);
+
+			auto error = IError::Make(new FUnavailable())
+				->AsRecoverable()
+				->WithMessageF(TEXT_"Symbol {0} was not found in the DLL's loaded from {1}", symbol, SearchPath);
+			if (LoadError) error->WithError(LoadError.ToSharedRef());
+			return error;
+		}
+
+		/** @brief Timings of the load, empty until the DLL's are loaded */
+		TConstArrayView<FDllLoadTiming> GetLoadTimings() const;
+
+	private:
+		FString SearchPath;
+		TArray<FDllDescriptor> Descriptors;
+
+		FCriticalSection Lock;
+		std::atomic<bool> bLoaded { false };
+		TUniquePtr<FScopedDllSet> Dlls;
+		IErrorPtr LoadError;
 	};
 
 	/**
@@ -107,5 +227,72 @@ namespace Mcro::Dll
 				}
 			})
 		{}
+
+		/** @brief Load the DLL's respecting their dependencies, see FScopedDllSet */
+		TModuleBoundDlls(const TCHAR* pushPath, TArray<FDllDescriptor> const& dlls)
+			: ModuleBoundObject(
+			{
+				[pushPath, dlls]
+				{
+					auto thisPlugin = IPluginManager::Get().GetModuleOwnerPlugin(*InferModuleName<M>());
+					return new FScopedDllSet(thisPlugin, pushPath, dlls);
+				}
+			})
+		{}
+	};
+
+	/**
+	 *	@brief
+	 *	Like TModuleBoundDlls, but the DLL's are only loaded on first use, instead of when the module starts up.
+	 *	@code
+	 *	TModuleBoundLazyDlls<FMyAwesomeModule> GMyLibraryDlls {MYLIBRARY_DLL_PATH, MYLIBRARY_DLL_FILES};
+	 *
+	 *	auto createContext = GMyLibraryDlls.Resolve<decltype(MyLibrary_CreateContext)>(TEXT_"MyLibrary_CreateContext");
+	 *	@endcode
+	 */
+	template <CObservableModule M>
+	struct TModuleBoundLazyDlls : TModuleBoundObject<M, FLazyDllSet>
+	{
+		using ModuleBoundObject = TModuleBoundObject<M, FLazyDllSet>;
+
+		template <CConvertibleTo<const TCHAR*>... DllFiles>
+		TModuleBoundLazyDlls(const TCHAR* pushPath, DllFiles... dllFiles)
+			: TModuleBoundLazyDlls(pushPath, TArray<FDllDescriptor> { FDllDescriptor(dllFiles)... })
+		{}
+
+		TModuleBoundLazyDlls(const TCHAR* pushPath, TArray<FDllDescriptor> const& dlls)
+			: ModuleBoundObject(
+			{
+				[pushPath, dlls]
+				{
+					auto thisPlugin = IPluginManager::Get().GetModuleOwnerPlugin(*InferModuleName<M>());
+					ASSERT_CRASH(thisPlugin);
+					return new FLazyDllSet(thisPlugin->GetBaseDir() / pushPath, dlls);
+				}
+			})
+		{}
+
+		/** @copydoc FLazyDllSet::EnsureLoaded */
+		FCanFail EnsureLoaded()
+		{
+			if (FLazyDllSet* dlls = this->TryGet()) return dlls->EnsureLoaded();
+			return ModuleNotStarted();
+		}
+
+		/** @copydoc FLazyDllSet::Resolve */
+		template <typename Function>
+		TMaybe<Function*> Resolve(const TCHAR* symbol)
+		{
+			if (FLazyDllSet* dlls = this->TryGet()) return dlls->template Resolve<Function>(symbol);
+			return ModuleNotStarted();
+		}
+
+	private:
+		static IErrorRef ModuleNotStarted()
+		{
+			return IError::Make(new FUnavailable())
+				->AsRecoverable()
+				->WithMessageF(TEXT_"DLL's bound to {0} are not available while it's not started", TTypeName<M>);
+		}
 	};
 }
@@ -14,6 +14,8 @@
 #include "CoreMinimal.h"
 #include "Mcro/Concepts.h"
 
+#include <source_location>
+
 /** @brief Contains utilities for structured error handling */
 namespace Mcro::Error
 {
@@ -26,8 +28,23 @@ namespace Mcro::Error
 	using IErrorPtr = TSharedPtr<IError>;   /**< @brief Convenience alias for an instance of an error */
 	using IErrorWeakPtr = TWeakPtr<IError>; /**< @brief Convenience alias for an instance of an error */
 
+	/**
+	 *	@brief
+	 *	An inner error of an IError, keyed by its unique (within its parent) name. Names are compared case sensitively.
+	 *	They're not FNames, as they're often made at runtime and FNames would never leave the name table.
+	 */
 	using FNamedError = TPair<FString, IErrorRef>;
 
+	/**
+	 *	@brief
+	 *	Storage of the inner errors of an IError. Most errors have only a handful of inner errors or appendices, so
+	 *	they're stored inline with the error, and looked up linearly by name.
+	 */
+	using FInnerErrors = TArray<FNamedError, TInlineAllocator<4>>;
+
+	/** @brief Storage of the recorded source locations an IError has been propagated through */
+	using FErrorPropagation = TArray<std::source_location, TInlineAllocator<4>>;
+
 	/** @brief Concept constraining input type argument T to an IError */
 	template <typename T>
 	concept CError = CDerivedFrom<T, IError>;
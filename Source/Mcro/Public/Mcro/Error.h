@@ -13,21 +13,24 @@
 
 #include "CoreMinimal.h"
 #include "Templates/ValueOrError.h"
+#include "Misc/TVariant.h"
 #include "Mcro/Error.Fwd.h"
 #include "Void.h"
 #include "Mcro/Types.h"
 #include "Mcro/Concepts.h"
+#include "Mcro/Macros.h"
 #include "Mcro/SharedObjects.h"
 #include "Mcro/Observable.Fwd.h"
 #include "Mcro/TextMacros.h"
 #include "Mcro/Text.h"
+#include "Mcro/Text/InlineString.h"
 #include "Mcro/Delegates/EventDelegate.h"
+#include "Mcro/Instrumentation.h"
+#include "Mcro/Yaml.Fwd.h"
 
-#include "Mcro/LibraryIncludes/Start.h"
-#include "yaml-cpp/yaml.h"
-#include "Mcro/LibraryIncludes/End.h"
-
+#include <atomic>
 #include <source_location>
+#include <string>
 
 /** Contains utilities for structured error handling */
 namespace Mcro::Error
@@ -38,6 +41,76 @@ namespace Mcro::Error
 	using namespace Mcro::SharedObjects;
 	using namespace Mcro::Delegates;
 
+	/**
+	 *	@brief
+	 *	Storage of the message, the details and the code context of an IError. Most of them are short enough to be
+	 *	stored inline with the error, without allocating each of them separately.
+	 */
+	using FErrorText = TInlineString<48>;
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	A format string with its arguments already converted to format arguments, but not yet formatted. Used by
+		 *	IError to defer formatting its texts until they're actually needed. The format is copied, because even
+		 *	constant character arrays may be on the stack of the caller, only string literals would outlive the error
+		 *	but they can't be told apart from those. Most formats fit into the inline storage of FErrorText.
+		 */
+		struct FDeferredFormat
+		{
+			FErrorText Format;
+			FStringFormatOrderedArguments Arguments;
+
+			FString Resolve() const { return FString::Format(*Format, Arguments); }
+		};
+
+		constexpr uint64 CombineErrorSignature(uint64 siteHash, FTypeHash typeHash)
+		{
+			const uint64 result = siteHash ^ (typeHash + 0x9E3779B97F4A7C15ull + (siteHash << 6) + (siteHash >> 2));
+			return result ? result : 1;
+		}
+
+		/** @brief Count the occurrence of the error, and tell if it should still be logged. See `FErrorFrequency` */
+		MCRO_API bool ShouldLogErrorOccurrence(IError const& error);
+	}
+
+	/**
+	 *	@brief
+	 *	Hash the file and the line of the call-site during compile time. Together with the type of the error this
+	 *	identifies errors originating from the same place, see `IError::WithSignature`.
+	 */
+	consteval uint64 MakeErrorSiteHash(std::source_location location = std::source_location::current())
+	{
+		uint64 hash = 0xCBF29CE484222325ull;
+		for (const char* c = location.file_name(); *c; ++c)
+			hash = (hash ^ static_cast<uint8>(*c)) * 0x100000001B3ull;
+		hash = (hash ^ location.line()) * 0x100000001B3ull;
+		return hash;
+	}
+
+	/**
+	 *	@brief
+	 *	While an instance is alive, errors reported via `IError::Report` or submitted by assertions on the current
+	 *	thread are also collected into it. This allows gathering errors from code which cannot return them, like event
+	 *	listeners. Scopes can be nested, only the inner-most one of a thread collects errors.
+	 */
+	class MCRO_API FScopedErrorCapture : public FNoncopyable
+	{
+	public:
+		FScopedErrorCapture();
+		~FScopedErrorCapture();
+
+		/** @brief Add an error to the inner-most capture scope of the current thread, if there's any */
+		static void Capture(IErrorRef const& error);
+
+		TArray<IErrorRef> const& GetErrors() const { return Errors; }
+		
+	private:
+		FScopedErrorCapture* Outer;
+		TArray<IErrorRef> Errors;
+	};
+
 	/**
 	 *	@brief  A base class for a structured error handling and reporting with modular architecture and fluent API.
 	 *	
@@ -67,14 +140,64 @@ namespace Mcro::Error
 	class MCRO_API IError : public IHaveTypeShareable
 	{
 	protected:
-		TMap<FString, IErrorRef> InnerErrors;
-		TArray<std::source_location> ErrorPropagation;
+		FInnerErrors InnerErrors;
+		FErrorPropagation ErrorPropagation;
 		EErrorSeverity Severity = EErrorSeverity::ErrorComponent;
-		FString Message;
-		FString Details;
-		FString CodeContext;
+		mutable FErrorText Message;
+		mutable FErrorText Details;
+		FErrorText CodeContext;
+		uint64 Signature = 0;
+
+		/**
+		 *	@brief
+		 *	No longer updated, errors can be serialized concurrently on multiple threads. Use `IsSerializedAsRoot`
+		 *	while serializing instead.
+		 */
+		UE_DEPRECATED(5.5, "bIsRoot is no longer updated, use IsSerializedAsRoot() instead")
 		mutable bool bIsRoot = false;
 
+		/**
+		 *	@brief
+		 *	Errors which can produce their Message (or Details) only through expensive operations can set this flag
+		 *	in their constructor, and override `ResolveDeferredTexts` to fill them when they're first needed.
+		 */
+		mutable bool bHasDeferredTexts = false;
+
+		mutable TOptional<Detail::FDeferredFormat> DeferredMessage;
+		mutable TOptional<Detail::FDeferredFormat> DeferredDetails;
+
+		/**
+		 *	@brief
+		 *	Set a formatted text member. The format and the arguments are copied right away, but formatting happens
+		 *	when the text is first accessed. Most recoverable errors are handled programmatically without ever being
+		 *	displayed, so they don't need to pay for formatting.
+		 */
+		template <typename Format, typename... FormatArgs>
+		void SetFormattedText(FErrorText& target, TOptional<Detail::FDeferredFormat>& deferred, Format&& input, FormatArgs&&... fmtArgs)
+		{
+			target.Reset();
+			deferred.Emplace(Detail::FDeferredFormat {
+				FErrorText(static_cast<const TCHAR*>(input)),
+				OrderedArguments(FWD(fmtArgs)...)
+			});
+			std::atomic_ref(bHasDeferredTexts).store(true, std::memory_order_release);
+		}
+
+		/**
+		 *	@brief
+		 *	Override this method to fill Message or Details on demand. It's called at most once, when `bHasDeferredTexts`
+		 *	is set, before the first access to them via `GetMessageText`, `GetDetailsText`, `GetInnerErrors` or serialization.
+		 *	Appendices which are expensive to produce can be added here too.
+		 */
+		virtual void ResolveDeferredTexts() const {}
+
+		/** @brief Call this before directly accessing Message or Details of errors which may defer them */
+		FORCEINLINE void ResolveTexts() const
+		{
+			if (std::atomic_ref(bHasDeferredTexts).load(std::memory_order_acquire)) [[unlikely]]
+				ResolveTextsSlow();
+		}
+
 		/** @brief Override this method if inner errors needs custom way of serialization */
 		virtual void SerializeInnerErrors(YAML::Emitter& emitter) const;
 		
@@ -97,14 +220,20 @@ namespace Mcro::Error
 		 */
 		virtual void SerializeMembers(YAML::Emitter& emitter) const;
 
+		/** @brief Is this error the root of the YAML document currently being serialized on this thread */
+		bool IsSerializedAsRoot() const;
+
 		virtual void NotifyState(Observable::IState<IErrorPtr>& state);
+
+	private:
+		void ResolveTextsSlow() const;
 		
 	public:
 		
-		FORCEINLINE decltype(InnerErrors)::TRangedForIterator      begin()       { return InnerErrors.begin(); }
-		FORCEINLINE decltype(InnerErrors)::TRangedForConstIterator begin() const { return InnerErrors.begin(); }
-		FORCEINLINE decltype(InnerErrors)::TRangedForIterator      end()         { return InnerErrors.end(); }
-		FORCEINLINE decltype(InnerErrors)::TRangedForConstIterator end()   const { return InnerErrors.end(); }
+		FORCEINLINE auto begin()       { return InnerErrors.begin(); }
+		FORCEINLINE auto begin() const { return InnerErrors.begin(); }
+		FORCEINLINE auto end()         { return InnerErrors.end(); }
+		FORCEINLINE auto end()   const { return InnerErrors.end(); }
 		
 		/**
 		 * 	@brief
@@ -125,6 +254,13 @@ namespace Mcro::Error
 		/** @brief Overload append operator for YAML::Emitter */
 		friend auto operator << (YAML::Emitter& emitter, IErrorRef const& error) -> YAML::Emitter&;
 
+		/**
+		 *	@brief
+		 *	Serialize this error as the root of a YAML document. Use it with a `Yaml::FStreamingEmitter` to write large
+		 *	error trees directly into a file or an archive without rendering them into a string first.
+		 */
+		void SerializeYamlDocument(YAML::Emitter& emitter) const;
+
 		/** @brief Render this error as a string using the YAML representation */
 		FString ToString() const;
 
@@ -147,6 +283,8 @@ namespace Mcro::Error
 		requires CSharedInitializeable<T, Args...>
 		static TSharedRef<T> Make(T* newError, Args&&... args)
 		{
+			MCRO_TRACE_SCOPE(Errors, "IError::Make");
+			Instrumentation::OnErrorMade<T>(static_cast<uint8>(newError->Severity));
 			return MakeShareableInit(newError, FWD(args)...)->WithType();
 		}
 
@@ -161,11 +299,34 @@ namespace Mcro::Error
 
 		FORCEINLINE EErrorSeverity                  GetSeverity() const        { return Severity; }
 		FORCEINLINE int32                           GetSeverityInt() const     { return static_cast<int32>(Severity); }
-		FORCEINLINE FString const&                  GetMessage() const         { return Message; }
-		FORCEINLINE FString const&                  GetDetails() const         { return Details; }
-		FORCEINLINE FString const&                  GetCodeContext() const     { return CodeContext; }
-		FORCEINLINE TMap<FString, IErrorRef> const& GetInnerErrors() const     { return InnerErrors; }
-		FORCEINLINE int32                           GetInnerErrorCount() const { return InnerErrors.Num(); }
+		FORCEINLINE FErrorText const&               GetMessageText() const     { ResolveTexts(); return Message; }
+		FORCEINLINE FErrorText const&               GetDetailsText() const     { ResolveTexts(); return Details; }
+		FORCEINLINE FErrorText const&               GetCodeContextText() const { return CodeContext; }
+
+		/**
+		 *	@brief
+		 *	Copies of the texts as FString, kept for existing callers. Prefer `GetMessageText`, `GetDetailsText` and
+		 *	`GetCodeContextText` which don't allocate.
+		 */
+		FORCEINLINE FString                         GetMessage() const         { return GetMessageText().ToString(); }
+		FORCEINLINE FString                         GetDetails() const         { return GetDetailsText().ToString(); }
+		FORCEINLINE FString                         GetCodeContext() const     { return CodeContext.ToString(); }
+
+		FORCEINLINE FInnerErrors const&             GetInnerErrors() const     { ResolveTexts(); return InnerErrors; }
+		FORCEINLINE int32                           GetInnerErrorCount() const { ResolveTexts(); return InnerErrors.Num(); }
+
+		/** @brief Find an inner error (or appendix) by its full unique name. Returns nullptr when it's not present. */
+		IErrorPtr FindInnerError(FStringView name) const;
+
+		/**
+		 *	@brief
+		 *	Errors are considered the same when they have the same signature. This is the one given to `WithSignature`,
+		 *	or when that wasn't set, it's the combination of the type and the code context of this error.
+		 */
+		uint64 GetSignature() const
+		{
+			return Signature ? Signature : Detail::CombineErrorSignature(GetTypeHash(CodeContext), TypeInfo.GetHash());
+		}
 
 		/**
 		 *	@brief
@@ -175,12 +336,22 @@ namespace Mcro::Error
 		 */
 		TArray<FString> GetErrorPropagation() const;
 
+		/** @brief Same as `GetErrorPropagation` but without formatting the recorded source locations. */
+		FORCEINLINE FErrorPropagation const& GetErrorPropagationLocations() const { return ErrorPropagation; }
+
 		/** @brief Same as `GetErrorPropagation` but items are separated by new line. */
 		FString GetErrorPropagationJoined() const;
 
 		/** @brief Get the error severity as an unreal string. */
 		FStringView GetSeverityString() const;
 
+		/**
+		 *	@brief
+		 *	Errors which return true are represented only by their Message, without members, inner errors or error
+		 *	propagation. Serializers other than YAML use this to preserve the plain text representation.
+		 */
+		virtual bool IsPlainText() const { return false; }
+
 		/** @brief Override this function to customize how an error is displaxed for the end-user */
 		virtual TSharedRef<SErrorDisplay> CreateErrorWidget();
 
@@ -193,9 +364,13 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self>
-		SelfRef<Self> WithMessage(this Self&& self, const FString& input, bool condition = true)
+		SelfRef<Self> WithMessage(this Self&& self, FStringView input, bool condition = true)
 		{
-			if (condition) self.Message = input;
+			if (condition)
+			{
+				self.Message = input;
+				self.DeferredMessage.Reset();
+			}
 			return self.SharedThis(&self);
 		}
 
@@ -207,10 +382,10 @@ namespace Mcro::Error
 		 *	@param   fmtArgs  ordered format arguments
 		 *	@return  Self for further fluent API setup
 		 */
-		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithMessageF(this Self&& self, const TCHAR* input, FormatArgs&&... fmtArgs)
+		template <typename Self, CConvertibleTo<const TCHAR*> Format, CStringFormatArgument... FormatArgs>
+		SelfRef<Self> WithMessageF(this Self&& self, Format&& input, FormatArgs&&... fmtArgs)
 		{
-			self.Message = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			self.SetFormattedText(self.Message, self.DeferredMessage, FWD(input), FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -223,10 +398,10 @@ namespace Mcro::Error
 		 *	@param     fmtArgs  format arguments
 		 *	@return  Self for further fluent API setup
 		 */
-		template <typename Self, typename... FormatArgs>
-		SelfRef<Self> WithMessageFC(this Self&& self, bool condition, const TCHAR* input, FormatArgs&&... fmtArgs)
+		template <typename Self, CConvertibleTo<const TCHAR*> Format, typename... FormatArgs>
+		SelfRef<Self> WithMessageFC(this Self&& self, bool condition, Format&& input, FormatArgs&&... fmtArgs)
 		{
-			if (condition) self.Message = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			if (condition) self.SetFormattedText(self.Message, self.DeferredMessage, FWD(input), FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 		
@@ -281,9 +456,13 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self>
-		SelfRef<Self> WithDetails(this Self&& self, const FString& input, bool condition = true)
+		SelfRef<Self> WithDetails(this Self&& self, FStringView input, bool condition = true)
 		{
-			if (condition) self.Details = input;
+			if (condition)
+			{
+				self.Details = input;
+				self.DeferredDetails.Reset();
+			}
 			return self.SharedThis(&self);
 		}
 
@@ -298,10 +477,10 @@ namespace Mcro::Error
 		 *	@param   fmtArgs  ordered format arguments
 		 *	@return  Self for further fluent API setup
 		 */
-		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithDetailsF(this Self&& self, const TCHAR* input, FormatArgs&&... fmtArgs)
+		template <typename Self, CConvertibleTo<const TCHAR*> Format, CStringFormatArgument... FormatArgs>
+		SelfRef<Self> WithDetailsF(this Self&& self, Format&& input, FormatArgs&&... fmtArgs)
 		{
-			self.Details = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			self.SetFormattedText(self.Details, self.DeferredDetails, FWD(input), FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -317,10 +496,10 @@ namespace Mcro::Error
 		 *	@param     fmtArgs  ordered format arguments
 		 *	@return  Self for further fluent API setup
 		 */
-		template <typename Self, CStringFormatArgument... FormatArgs>
-		SelfRef<Self> WithDetailsFC(this Self&& self, bool condition, const TCHAR* input, FormatArgs&&... fmtArgs)
+		template <typename Self, CConvertibleTo<const TCHAR*> Format, CStringFormatArgument... FormatArgs>
+		SelfRef<Self> WithDetailsFC(this Self&& self, bool condition, Format&& input, FormatArgs&&... fmtArgs)
 		{
-			if (condition) self.Details = FString::Format(input, OrderedArguments(FWD(fmtArgs)...));
+			if (condition) self.SetFormattedText(self.Details, self.DeferredDetails, FWD(input), FWD(fmtArgs)...);
 			return self.SharedThis(&self);
 		}
 
@@ -333,12 +512,29 @@ namespace Mcro::Error
 		 *	@return  Self for further fluent API setup
 		 */
 		template <typename Self>
-		SelfRef<Self> WithCodeContext(this Self&& self, const FString& input, bool condition = true)
+		SelfRef<Self> WithCodeContext(this Self&& self, FStringView input, bool condition = true)
 		{
 			if (condition) self.CodeContext = input;
 			return self.SharedThis(&self);
 		}
 
+		/**
+		 *	@brief
+		 *	Identify this error by the place where it has been raised, combined with its type. Both are known during
+		 *	compile time, so this costs nothing at runtime. `ASSERT_RETURN` and `UNAVAILABLE` set this automatically.
+		 *	
+		 *	@tparam      Self  Deducing this
+		 *	@param       self  Deduced this (not present in calling arguments)
+		 *	@param   siteHash  Result of `MakeErrorSiteHash` evaluated at the call site
+		 *	@return  Self for further fluent API setup
+		 */
+		template <typename Self>
+		SelfRef<Self> WithSignature(this Self&& self, uint64 siteHash)
+		{
+			self.Signature = Detail::CombineErrorSignature(siteHash, TTypeHash<Self>);
+			return self.SharedThis(&self);
+		}
+
 		/**
 		 *	@brief   Add a uniquely typed inner error.
 		 *	@tparam       Self  Deducing this
@@ -536,7 +732,11 @@ namespace Mcro::Error
 		SelfRef<Self> Report(this Self&& self, bool condition = true)
 		{
 			if (condition)
+			{
+				Instrumentation::OnErrorReported(self);
+				FScopedErrorCapture::Capture(self.SharedThis(&self));
 				OnErrorReported().Broadcast(self.SharedThis(&self));
+			}
 			
 			return self.SharedThis(&self);
 		}
@@ -578,13 +778,71 @@ namespace Mcro::Error
 		FUnavailable();
 	};
 
+	/**
+	 *	@brief
+	 *	A lightweight error for hot paths which may fail often, like validating untrusted input. Creating one doesn't
+	 *	allocate anything, so its message must have static lifetime (a string literal). It can be promoted to a full
+	 *	`IError` (an `FErrorCodeError`) on demand when more context is needed, or when it's displayed or logged.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	TMaybe<FPacket> ParsePacket(TArrayView<const uint8> data)
+	 *	{
+	 *		if (data.Num() < HeaderSize) return FErrorCode { 1, TEXT_"Packet is smaller than its header" };
+	 *		// ...
+	 *	}
+	 *	@endcode
+	 */
+	struct FErrorCode
+	{
+		int32 Code = 0;
+		const TCHAR* Message = TEXT_"";
+		EErrorSeverity Severity = EErrorSeverity::Recoverable;
+		std::source_location Location = std::source_location::current();
+
+		/** @brief Create a full IError from this error code */
+		MCRO_API IErrorRef Promote() const;
+	};
+
+	/** @brief The error type lightweight `FErrorCode`s are promoted to */
+	class MCRO_API FErrorCodeError : public IError
+	{
+	public:
+		FErrorCodeError(int32 code) : Code(code) {}
+		
+		int32 GetCode() const { return Code; }
+
+	protected:
+		int32 Code;
+		virtual void SerializeMembers(YAML::Emitter& emitter) const override;
+	};
+
+	namespace Detail
+	{
+		/** @brief Tag for constructing a TMaybe from only the error of another one, used by the TMaybe combinators */
+		struct FPropagateMaybeError {};
+	}
+
 	/**
 	 *	@brief
 	 *	A `TValueOrError` alternative for IError which allows implicit conversion from values and errors (no need for
 	 *	`MakeError` or `MakeValue`) and is boolean testable. It also doesn't have ambiguous state such as
 	 *	`TValueOrError` has, so a TMaybe will always have either an error or a value, it will never have neither of
 	 *	them or both of them.
+	 *
+	 *	The value, the error or a lightweight `FErrorCode` is stored in a single tagged union. Failing with an
+	 *	`FErrorCode` therefore costs no heap allocation, the code is only promoted to a full `IError` when one is asked
+	 *	for via `GetError` / `GetErrorRef` / `ModifyError`.
 	 */
+	template <CNonVoid T>
+	struct TMaybe;
+
+	template <typename>
+	constexpr bool TIsMaybe = false;
+
+	template <typename T>
+	constexpr bool TIsMaybe<TMaybe<T>> = true;
+
 	template <CNonVoid T>
 	struct TMaybe
 	{
@@ -597,50 +855,108 @@ namespace Mcro::Error
 		 */
 		template <typename = T>
 		requires (!CDefaultInitializable<T>)
-		TMaybe() : Error(IError::Make(new FUnavailable())
-			->WithMessageF(
-				TEXT_"TMaybe has been default initialized, but a Value of {0} cannot be default initialized",
-				TTypeName<T>
-			)
-		) {}
+		TMaybe()
+		{
+			Storage.template Emplace<IErrorRef>(IError::Make(new FUnavailable())
+				->WithMessageF(
+					TEXT_"TMaybe has been default initialized, but a Value of {0} cannot be default initialized",
+					TTypeName<T>
+				)
+			);
+		}
 
 		/** @brief If T is default initializable then the default state of TMaybe will be the default value of T, and not an error */
 		template <CDefaultInitializable = T>
-		TMaybe() : Value(T{}) {}
+		TMaybe() { Storage.template Emplace<T>(T{}); }
 		
 		/** @brief Enable copy constructor for T only when T is copy constructable */
 		template <CConvertibleToDecayed<T> From, CCopyConstructible = T>
-		TMaybe(From const& value) : Value(value) {}
+		requires (!TIsMaybe<std::decay_t<From>>)
+		TMaybe(From const& value) { Storage.template Emplace<T>(value); }
 		
 		/** @brief Enable move constructor for T only when T is move constructable */
 		template <CConvertibleToDecayed<T> From, CMoveConstructible = T>
-		TMaybe(From&& value) : Value(FWD(value)) {}
+		requires (!TIsMaybe<std::decay_t<From>>)
+		TMaybe(From&& value) { Storage.template Emplace<T>(FWD(value)); }
 		
 		/** @brief Enable copy constructor for TMaybe only when T is copy constructable */
 		template <CConvertibleToDecayed<T> From, CCopyConstructible = T>
-		TMaybe(TMaybe<From> const& other) : Value(other.Value) {}
+		TMaybe(TMaybe<From> const& other)
+		{
+			if (other.HasValue()) Storage.template Emplace<T>(other.GetValue());
+			else CopyErrorFrom(other);
+		}
 		
 		/** @brief Enable move constructor for TMaybe only when T is move constructable */
 		template <CConvertibleToDecayed<T> From, CMoveConstructible = T>
-		TMaybe(TMaybe<From>&& other) : Value(MoveTemp(other.Value)) {}
+		TMaybe(TMaybe<From>&& other)
+		{
+			if (other.HasValue()) Storage.template Emplace<T>(MoveTemp(other.GetValue()));
+			else CopyErrorFrom(other);
+		}
 
 		/** @brief Set this TMaybe to an erroneous state */
 		template <CError ErrorType>
-		TMaybe(TSharedRef<ErrorType> const& error) : Error(error) {}
+		TMaybe(TSharedRef<ErrorType> const& error) { Storage.template Emplace<IErrorRef>(error); }
+
+		/** @brief Set this TMaybe to an erroneous state without allocating a full IError */
+		TMaybe(FErrorCode const& error) { Storage.template Emplace<FErrorCode>(error); }
+
+		bool HasValue() const { return Storage.template IsType<T>(); }
+		bool HasError() const { return !HasValue(); }
 
-		bool HasValue() const { return Value.IsSet(); }
-		bool HasError() const { return Error.IsValid(); }
+		/** @brief Is this TMaybe failed with a lightweight error code which hasn't been promoted to an IError yet */
+		bool HasErrorCode() const { return Storage.template IsType<FErrorCode>(); }
 
-		auto TryGetValue()       -> TOptional<T>&       { return Value; }
-		auto TryGetValue() const -> TOptional<T> const& { return Value; }
+		auto TryGetValue()       -> T*       { return Storage.template TryGet<T>(); }
+		auto TryGetValue() const -> T const* { return Storage.template TryGet<T>(); }
 		
-		auto GetValue()       -> T&       { return Value.GetValue(); }
-		auto GetValue() const -> T const& { return Value.GetValue(); }
+		auto GetValue()       -> T&       { return Storage.template Get<T>(); }
+		auto GetValue() const -> T const& { return Storage.template Get<T>(); }
 
-		T&& StealValue() && { return MoveTemp(Value.GetValue()); }
+		T&& StealValue() && { return MoveTemp(Storage.template Get<T>()); }
 
-		auto GetError() const -> IErrorPtr { return Error; }
-		auto GetErrorRef() const -> IErrorRef { return Error.ToSharedRef(); }
+		/** @brief Get the lightweight error code this TMaybe has failed with, if it hasn't been promoted yet */
+		auto TryGetErrorCode() const -> FErrorCode const* { return Storage.template TryGet<FErrorCode>(); }
+
+		/** @brief Get the error, promoting a lightweight error code to a full IError in place if necessary */
+		auto GetError() -> IErrorPtr
+		{
+			if (HasValue()) return {};
+			return GetErrorRef();
+		}
+
+		/** @copydoc GetErrorRef() const */
+		auto GetError() const -> IErrorPtr
+		{
+			if (HasValue()) return {};
+			return GetErrorRef();
+		}
+		
+		/** @brief Get the error, promoting a lightweight error code to a full IError in place if necessary */
+		auto GetErrorRef() -> IErrorRef
+		{
+			if (FErrorCode const* code = Storage.template TryGet<FErrorCode>())
+			{
+				IErrorRef promoted = code->Promote();
+				Storage.template Emplace<IErrorRef>(promoted);
+				return promoted;
+			}
+			return Storage.template Get<IErrorRef>();
+		}
+
+		/**
+		 *	@brief
+		 *	Get the error without modifying this TMaybe, so it's safe to call concurrently on a shared const TMaybe.
+		 *	A lightweight error code is promoted to a new IError on every call, use the non-const overload to keep
+		 *	the promoted error.
+		 */
+		auto GetErrorRef() const -> IErrorRef
+		{
+			if (FErrorCode const* code = Storage.template TryGet<FErrorCode>())
+				return code->Promote();
+			return Storage.template Get<IErrorRef>();
+		}
 
 		operator bool() const { return HasValue(); }
 
@@ -659,18 +975,133 @@ namespace Mcro::Error
 			return FWD(self);
 		}
 		
+		/**
+		 *	@brief
+		 *	Chain a fallible step after this one. The value is passed to `function` preserving the qualifiers of this
+		 *	TMaybe, so calling it on an rvalue moves the value into the next step. An error is propagated without
+		 *	calling `function` and without promoting a lightweight error code.
+		 *
+		 *	@code
+		 *	TMaybe<FParsed> parsed = LoadBuffer(path)
+		 *		.AndThen([](TArray<uint8>&& buffer) { return Parse(MoveTemp(buffer)); });
+		 *	@endcode
+		 *	
+		 *	@tparam     Self  Deducing this
+		 *	@tparam Function  Returning a TMaybe. For `FCanFail` it may also take no arguments
+		 *	@return  The result of `function`, or its TMaybe type carrying the error of this one
+		 */
+		template <typename Self, typename Function>
+		auto AndThen(this Self&& self, Function&& function)
+		{
+			using Result = std::decay_t<decltype(InvokeWithValue(FWD(self), FWD(function)))>;
+			static_assert(TIsMaybe<Result>, "AndThen expects a function returning a TMaybe, use Map otherwise");
+
+			if (self.HasValue()) return Result(InvokeWithValue(FWD(self), FWD(function)));
+			return Result(Detail::FPropagateMaybeError(), self);
+		}
+
+		/**
+		 *	@brief
+		 *	Transform the value with an infallible function. The value is passed to `function` preserving the
+		 *	qualifiers of this TMaybe. An error is propagated without calling `function`.
+		 *	
+		 *	@tparam     Self  Deducing this
+		 *	@tparam Function  Returning anything but a TMaybe (use AndThen for that). A void function results in an
+		 *	                  `FCanFail`. For `FCanFail` it may also take no arguments
+		 *	@return  A TMaybe of the result of `function`, or carrying the error of this one
+		 */
+		template <typename Self, typename Function>
+		auto Map(this Self&& self, Function&& function)
+		{
+			using Invoked = decltype(InvokeWithValue(FWD(self), FWD(function)));
+			static_assert(!TIsMaybe<std::decay_t<Invoked>>, "Map expects an infallible function, use AndThen otherwise");
+
+			if constexpr (std::is_void_v<Invoked>)
+			{
+				if (self.HasError()) return TMaybe<FVoid>(Detail::FPropagateMaybeError(), self);
+				InvokeWithValue(FWD(self), FWD(function));
+				return TMaybe<FVoid>(FVoid());
+			}
+			else
+			{
+				using Result = TMaybe<std::decay_t<Invoked>>;
+				if (self.HasError()) return Result(Detail::FPropagateMaybeError(), self);
+				return Result(InvokeWithValue(FWD(self), FWD(function)));
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Recover from an error. The value of this TMaybe is passed through, moved when it's called on an rvalue.
+		 *	
+		 *	@tparam     Self  Deducing this
+		 *	@tparam Function  Taking the error and returning something a `TMaybe<T>` can be constructed from, so
+		 *	                  either a fallback value or another error
+		 */
+		template <typename Self, CFunctionCompatible_ArgumentsDecay<void(IErrorRef)> Function>
+		TMaybe OrElse(this Self&& self, Function&& function)
+		{
+			if (self.HasValue()) return FWD(self);
+			return function(self.GetErrorRef());
+		}
+
+		/** @brief Get the value, moved out when it's called on an rvalue, or construct `T` from the fallback */
+		template <typename Self, typename Fallback>
+		requires CConstructibleFrom<T, Fallback>
+		T ValueOr(this Self&& self, Fallback&& fallback)
+		{
+			if (self.HasValue()) return static_cast<TForwardedValue<Self>>(self.GetValue());
+			return T(FWD(fallback));
+		}
+		
 		operator TValueOrError<T, IErrorPtr>() const
 		{
 			if (HasValue())
-				return MakeValue(Value.GetValue());
-			return MakeError(Error);
+				return MakeValue(GetValue());
+			return MakeError(GetError());
 		}
 
 	private:
-		TOptional<T> Value;
-		IErrorPtr Error;
+		template <CNonVoid>
+		friend struct TMaybe;
+
+		/** @brief Only the error of `other` is taken, for propagating it through the combinators */
+		template <typename From>
+		TMaybe(Detail::FPropagateMaybeError, TMaybe<From> const& other) { CopyErrorFrom(other); }
+
+		/** @brief The value of a TMaybe with the reference and const qualifiers of the TMaybe itself */
+		template <typename Self>
+		using TForwardedValue = std::conditional_t<
+			std::is_lvalue_reference_v<Self>,
+			std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, T const&, T&>,
+			std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, T const&&, T&&>
+		>;
+
+		template <typename Self, typename Function>
+		static decltype(auto) InvokeWithValue(Self&& self, Function&& function)
+		{
+			if constexpr (std::is_same_v<T, FVoid> && std::is_invocable_v<Function>)
+				return Invoke(FWD(function));
+			else
+				return Invoke(FWD(function), static_cast<TForwardedValue<Self>>(self.GetValue()));
+		}
+
+		template <typename From>
+		void CopyErrorFrom(TMaybe<From> const& other)
+		{
+			if (FErrorCode const* code = other.TryGetErrorCode())
+				Storage.template Emplace<FErrorCode>(*code);
+			else
+				Storage.template Emplace<IErrorRef>(other.GetErrorRef());
+		}
+
+		TVariant<FEmptyVariantState, T, IErrorRef, FErrorCode> Storage;
 	};
 
+	/** @brief The most common TMaybe types are instantiated once inside MCRO, so dependant modules don't compile them again */
+	extern template struct MCRO_API TMaybe<FVoid>;
+	extern template struct MCRO_API TMaybe<FString>;
+
 	/** @brief Indicate that an otherwise void function that it may fail with an IError. */
 	using FCanFail = TMaybe<FVoid>;
 
@@ -685,19 +1116,35 @@ namespace Mcro::Error
 	FORCEINLINE FCanFail Success() { return FVoid(); }
 }
 
-#define MCRO_ERROR_LOG_3(categoryName, verbosity, error) \
-	UE_LOG(categoryName, verbosity, TEXT_"%s", *((error) \
-		->WithLocation()                                 \
-		->Report()                                       \
-		->ToString()                                     \
-	))                                                  //
+namespace Mcro::Error::Detail
+{
+	/**
+	 *	@brief
+	 *	Report the error and pass it to `log`, unless its signature occurred more times than
+	 *	`FErrorFrequency::MaxLoggedOccurrences`, in which case only its occurrence is counted.
+	 */
+	template <CError T, CFunctionLike Function>
+	void LogFrequencyLimited(TSharedRef<T> const& error, Function&& log)
+	{
+		if (ShouldLogErrorOccurrence(error.Get()))
+			log(error->Report());
+	}
+}
 
-#define MCRO_ERROR_LOG_2(categoryName, verbosity)                         \
-	Report()                                                              \
-	->AsOperandWith([](IErrorRef const& error)                            \
-	{                                                                     \
-		UE_LOG(categoryName, verbosity, TEXT_"%s", *(error->ToString())); \
-	})                                                                   //
+#define MCRO_ERROR_LOG_3(categoryName, verbosity, error)                                             \
+	Mcro::Error::Detail::LogFrequencyLimited((error)->WithLocation(), [](auto const& mcroErrorToLog) \
+	{                                                                                                \
+		UE_LOG(categoryName, verbosity, TEXT_"%s", *(mcroErrorToLog->ToString()));                   \
+	})                                                                                              //
+
+#define MCRO_ERROR_LOG_2(categoryName, verbosity)                                   \
+	AsOperandWith([](IErrorRef const& error)                                        \
+	{                                                                               \
+		Mcro::Error::Detail::LogFrequencyLimited(error, [](auto const& mcroErrorToLog) \
+		{                                                                           \
+			UE_LOG(categoryName, verbosity, TEXT_"%s", *(mcroErrorToLog->ToString())); \
+		});                                                                         \
+	})                                                                             //
 
 /**
  *	@brief  Convenience macro for logging an error with UE_LOG
@@ -709,19 +1156,19 @@ namespace Mcro::Error
  */
 #define ERROR_LOG(...) MACRO_OVERLOAD(MCRO_ERROR_LOG_, __VA_ARGS__)
 
-#define ERROR_CLOG(condition, categoryName, verbosity, error)        \
-	UE_CLOG(condition, categoryName, verbosity, TEXT_"%s", *((error) \
-		->WithLocation()                                             \
-		->Report()                                                   \
-		->ToString()                                                 \
-	))                                                              //
+#define ERROR_CLOG(condition, categoryName, verbosity, error)                \
+	((condition) ? MCRO_ERROR_LOG_3(categoryName, verbosity, error) : void()) //
 
-#define MCRO_ASSERT_RETURN_2(condition, error)                  \
-	if (UNLIKELY(!(condition)))                                 \
-		return Mcro::Error::IError::Make(new error)             \
-			->WithLocation()                                    \
-			->AsRecoverable()                                   \
-			->WithCodeContext(PREPROCESSOR_TO_TEXT(condition)) //
+#define MCRO_ASSERT_RETURN_2(condition, error)                                                 \
+	if (UNLIKELY(!(condition)))                                                                \
+		return [&](std::source_location const& mcroLocation, uint64 mcroSiteHash) MCRO_COLD_LAMBDA \
+		{                                                                                      \
+			return Mcro::Error::IError::Make(new error)                                        \
+				->WithLocation(mcroLocation)                                                   \
+				->WithSignature(mcroSiteHash)                                                  \
+				->AsRecoverable()                                                              \
+				->WithCodeContext(PREPROCESSOR_TO_TEXT(condition));                            \
+		}(std::source_location::current(), Mcro::Error::MakeErrorSiteHash())                 //
 
 #define MCRO_ASSERT_RETURN_1(condition) MCRO_ASSERT_RETURN_2(condition, Mcro::Error::FAssertion())
 
@@ -734,10 +1181,14 @@ namespace Mcro::Error
  */
 #define ASSERT_RETURN(...) MACRO_OVERLOAD(MCRO_ASSERT_RETURN_, __VA_ARGS__)
 
-#define MCRO_UNAVAILABLE_1(error)                                                              \
-	return Mcro::Error::IError::Make(new DEFAULT_ON_EMPTY(error, Mcro::Error::FUnavailable())) \
-		->WithLocation()                                                                       \
-		->AsRecoverable()                                                                     //
+#define MCRO_UNAVAILABLE_1(error)                                                                       \
+	return [&](std::source_location const& mcroLocation, uint64 mcroSiteHash) MCRO_COLD_LAMBDA          \
+	{                                                                                                   \
+		return Mcro::Error::IError::Make(new DEFAULT_ON_EMPTY(error, Mcro::Error::FUnavailable()))      \
+			->WithLocation(mcroLocation)                                                                \
+			->WithSignature(mcroSiteHash)                                                               \
+			->AsRecoverable();                                                                          \
+	}(std::source_location::current(), Mcro::Error::MakeErrorSiteHash())                               //
 
 /**
  *	@brief  Denote that a resource which is asked for doesn't exist
@@ -748,10 +1199,13 @@ namespace Mcro::Error
  */
 #define UNAVAILABLE(error) MCRO_UNAVAILABLE_1(error)
 
-#define MCRO_PROPAGATE_FAIL_3(type, var, expression)    \
-	type var = (expression);                            \
-	if (UNLIKELY(var.HasError())) return var.GetError() \
-		->WithLocation()                               //
+#define MCRO_PROPAGATE_FAIL_3(type, var, expression)                                   \
+	type var = (expression);                                                           \
+	if (UNLIKELY(var.HasError()))                                                      \
+		return [&](std::source_location const& mcroLocation) MCRO_COLD_LAMBDA         \
+		{                                                                              \
+			return var.GetError()->WithLocation(mcroLocation);                         \
+		}(std::source_location::current())                                            //
 
 #define MCRO_PROPAGATE_FAIL_2(var, expression) MCRO_PROPAGATE_FAIL_3(auto, var, expression)
 #define MCRO_PROPAGATE_FAIL_1(expression) MCRO_PROPAGATE_FAIL_2(PREPROCESSOR_JOIN(tempResult, __LINE__), expression)
@@ -0,0 +1,56 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Error.h"
+
+/**
+ *	@brief
+ *	Compact binary encoding of the IError model, meant for shipping error telemetry in bulk. It stores the same
+ *	information as the YAML representation (type, severity, message, details, code context, error propagation and
+ *	inner errors), and it can be decoded back into the same YAML layout offline.
+ *
+ *	Members added by derived errors through overriding `SerializeMembers` are not part of the binary encoding, as
+ *	they're only known to the YAML emitter. Derived errors which need them to be preserved should rather use
+ *	appendices.
+ */
+namespace Mcro::Error::Binary
+{
+	/** @brief Identifies a binary error stream ("MCER") */
+	constexpr uint32 Magic = 0x5245434D;
+
+	/** @brief Version of the binary error encoding, decoders reject streams made with a newer version */
+	constexpr uint16 Version = 1;
+
+	/** @brief Write an error and all of its inner errors into an archive which is saving */
+	MCRO_API void Encode(FArchive& archive, IErrorRef const& error);
+
+	/** @brief Convenience function encoding an error into a new byte array */
+	MCRO_API TArray<uint8> Encode(IErrorRef const& error);
+
+	/**
+	 *	@brief
+	 *	Decode one binary encoded error from an archive which is loading, and emit it in the same layout as
+	 *	`IError::SerializeYaml` does.
+	 *
+	 *	Texts longer than a million characters, and more than 65536 inner errors or propagation entries per error are
+	 *	treated as corruption, so a damaged stream can't force huge allocations.
+	 *
+	 *	@return  Fails if the stream is not a binary encoded error, it's made with a newer version or it is truncated.
+	 */
+	MCRO_API FCanFail DecodeToYaml(FArchive& archive, YAML::Emitter& emitter);
+
+	/** @brief Convenience function decoding a binary encoded error into a YAML string */
+	MCRO_API TMaybe<FString> DecodeToYaml(TArrayView<const uint8> data);
+}
@@ -12,16 +12,31 @@
 #pragma once
 
 #include "CoreMinimal.h"
-
-#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 #include "Mcro/Error/PlainTextComponent.h"
 
 namespace Mcro::Error
 {
-	/** @brief An Error component which stores a BP stack trace in its message upon construction */
+	/**
+	 *	@brief
+	 *	An Error component which captures a BP stack trace upon construction. Only weak pointers to the functions of
+	 *	the script frames are captured at construction, the message is built only when it is first accessed (when the
+	 *	error is displayed, serialized or logged).
+	 */
 	class MCRO_API FBlueprintStackTrace : public IPlainTextComponent
 	{
 	public:
 		FBlueprintStackTrace();
+
+		/** @brief Maximum number of script frames captured, the outer-most frames are omitted beyond this */
+		static constexpr int32 MaxDepth = 64;
+
+	protected:
+		virtual void ResolveDeferredTexts() const override;
+
+	private:
+		/** @brief Captured script frames, the inner-most frame first */
+		TArray<TWeakObjectPtr<const UFunction>, TInlineAllocator<16>> Frames;
+		int32 TotalFrames = 0;
 	};
 }
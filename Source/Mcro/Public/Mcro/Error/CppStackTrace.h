@@ -16,16 +16,25 @@
 
 namespace Mcro::Error
 {
-	/** @brief An Error component which stores a C++ stack trace in its message upon construction. */
+	/**
+	 *	@brief
+	 *	An Error component which captures a C++ stack trace upon construction. Only the raw program counters are
+	 *	captured at construction, symbols are resolved only when the message of this component is first accessed (when
+	 *	the error is displayed, serialized or logged). Resolved symbols are cached globally so repeated errors from the
+	 *	same call sites are cheap to symbolicate too.
+	 */
 	class MCRO_API FCppStackTrace : public IPlainTextComponent
 	{
 	public:
+		/** @brief Maximum number of stack frames captured */
+		static constexpr int32 MaxDepth = 64;
+		
 		/**
 		 *	@param numAdditionalStackFramesToIgnore
 		 *	Ignore stack frames which might be irrelevant for the error report
 		 *	
 		 *	@param fastWalk
-		 *	Use fast stack trace walking instead of accurate
+		 *	Kept for compatibility. Capturing program counters is always fast, symbolication is always accurate.
 		 *	
 		 *	@param stackFramesIgnoreDefaultOffset
 		 *	A default offset applied to ignore-stack-frames which accounts for the facilities of IError. Only set this
@@ -38,5 +47,16 @@ namespace Mcro::Error
 			bool fastWalk = !UE_BUILD_DEBUG,
 			int32 stackFramesIgnoreDefaultOffset = 1
 		);
+
+		/** @brief The captured raw program counters, the inner-most frame first */
+		TArrayView<const uint64> GetProgramCounters() const;
+
+	protected:
+		virtual void ResolveDeferredTexts() const override;
+		
+	private:
+		uint64 ProgramCounters[MaxDepth];
+		int32 Depth = 0;
+		int32 FramesToIgnore = 0;
 	};
 }
@@ -0,0 +1,96 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Error.h"
+
+#include <atomic>
+
+namespace Mcro::Error
+{
+	/** @brief A snapshot of how many times errors with a given signature occurred */
+	struct FErrorFrequencyEntry
+	{
+		uint64 Signature = 0;
+		FType Type;
+
+		/** @brief The earliest recorded location of the first error with this signature, empty if it had none */
+		std::source_location Location;
+		uint32 Count = 0;
+	};
+
+	/**
+	 *	@brief
+	 *	Global lock-free table counting errors by their signature (see `IError::GetSignature`). `ERROR_LOG`,
+	 *	`ERROR_CLOG` and `FErrorManager::DisplayError` consult it, and after `MaxLoggedOccurrences` of the same
+	 *	signature, they only count further occurrences instead of reporting, logging or displaying them. This way
+	 *	errors repeating thousands of times will not saturate logs and CPU.
+	 *
+	 *	The table has a fixed capacity, signatures which don't fit into it are counted together via
+	 *	`GetOverflowCount`, and they're never limited.
+	 */
+	class MCRO_API FErrorFrequency : public FNoncopyable
+	{
+	public:
+		static constexpr int32 Capacity = 4096;
+
+		/** @brief Get the global singleton */
+		static FErrorFrequency& Get();
+
+		/** @brief The number of occurrences of the same signature which are still logged */
+		std::atomic<uint32> MaxLoggedOccurrences { 10 };
+
+		/**
+		 *	@brief  Count an occurrence of the given signature
+		 *	@return The number of occurrences including this one, or 0 if the table is full.
+		 */
+		uint32 Record(uint64 signature, FType const& type, std::source_location const& location = {});
+
+		/** @brief Count an occurrence of the given error */
+		uint32 Record(IError const& error);
+
+		/** @brief Count an occurrence of the given error, and tell if it's still within `MaxLoggedOccurrences` */
+		bool ShouldLog(IError const& error);
+
+		/** @brief Get the number of occurrences of a signature so far */
+		uint32 GetCount(uint64 signature) const;
+
+		/** @brief Get the number of occurrences which couldn't be recorded because the table was full */
+		uint32 GetOverflowCount() const { return Overflow.load(std::memory_order_relaxed); }
+
+		/** @brief Get a snapshot of all recorded signatures for telemetry, most frequent first */
+		TArray<FErrorFrequencyEntry> Export() const;
+
+		/** @brief Emit the snapshot of recorded signatures as a YAML sequence */
+		void SerializeYaml(YAML::Emitter& emitter) const;
+
+		/** @brief Render the snapshot of recorded signatures as YAML */
+		FString ToString() const;
+
+	private:
+		struct FSlot
+		{
+			std::atomic<uint64> Signature { 0 };
+			std::atomic<uint32> Count { 0 };
+			std::atomic<bool> bPublished { false };
+			FType Type;
+			std::source_location Location;
+		};
+
+		const FSlot* FindSlot(uint64 signature) const;
+
+		FSlot Slots[Capacity];
+		std::atomic<uint32> Overflow { 0 };
+	};
+}
@@ -0,0 +1,144 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Mcro/Error.h"
+
+namespace Mcro::Error
+{
+	/** @brief What an FErrorJournal should do with new errors when its queue is full */
+	enum class EErrorJournalDropPolicy : uint8
+	{
+		/** @brief Keep the queued errors and drop the incoming one */
+		DropNewest,
+
+		/** @brief Drop the oldest queued error to make room for the incoming one */
+		DropOldest
+	};
+
+	/** @brief Settings of an FErrorJournal. Use C++ 20 designated initializers for convenience */
+	struct FErrorJournalSettings
+	{
+		/** @brief The directory journal files are written into. Defaults to `<ProjectSaved>/Logs/Errors` */
+		FString Directory;
+
+		/** @brief Journal files are named `<BaseName>.yaml`, rotated ones get an index like `<BaseName>.1.yaml` */
+		FString BaseName = TEXT_"ErrorJournal";
+
+		/** @brief The current journal file is rotated when it grows larger than this */
+		int64 MaxFileSize = 8 * 1024 * 1024;
+
+		/** @brief Number of rotated journal files to keep besides the current one */
+		int32 MaxRotatedFiles = 4;
+
+		/** @brief Maximum number of errors waiting for serialization */
+		int32 MaxQueuedErrors = 1024;
+
+		EErrorJournalDropPolicy DropPolicy = EErrorJournalDropPolicy::DropOldest;
+
+		/** @brief Automatically submit every error passed to `IError::Report` (including `ERROR_LOG`) */
+		bool bListenToReportedErrors = true;
+
+		/** @brief When false there's no background thread, errors are only written when the journal is flushed */
+		bool bUseWorkerThread = true;
+	};
+
+	/**
+	 *	@brief
+	 *	An error sink which serializes errors into YAML and writes them into a rotating on-disk journal on its own
+	 *	background thread. Submitting an error only takes a reference to it, so it's cheap even under error storms.
+	 *	The queue is bounded and excess errors are dropped according to the drop policy, the number of dropped errors
+	 *	are recorded in the journal.
+	 *
+	 *	When the application crashes the type and severity of the most recent errors which weren't written yet are sent
+	 *	to `FPlatformMisc::LowLevelOutputDebugString`, without locking or allocating. Serializing them from a crashing
+	 *	process is not safe, so their details are lost.
+	 *
+	 *	@warning
+	 *	Errors are serialized on another thread after they're submitted, so they should not be modified anymore once
+	 *	submitted (which is usually the case for reported errors).
+	 */
+	class MCRO_API FErrorJournal : public FRunnable
+	{
+	public:
+		FErrorJournal(FErrorJournalSettings const& settings = {});
+		virtual ~FErrorJournal() override;
+
+		/** @brief Queue an error for writing it into the journal */
+		void Submit(IErrorRef const& error);
+
+		/** @brief Write every queued error into the journal on the calling thread, and flush the journal file */
+		void Flush();
+
+		/** @brief Number of errors dropped because the queue was full */
+		int32 GetDroppedCount() const;
+
+		/** @brief Path of the current journal file */
+		FString GetCurrentFilePath() const;
+
+		FErrorJournalSettings const& GetSettings() const { return Settings; }
+
+		/** @brief How many recently submitted errors are summarized when the application crashes */
+		static constexpr int32 CrashSummaryCapacity = 64;
+
+	protected:
+		virtual uint32 Run() override;
+		virtual void Stop() override;
+
+	private:
+		FString GetFilePath(int32 rotation) const;
+		void WriteQueued();
+		void Write(IErrorRef const& error);
+		void Rotate();
+		void DumpUnwrittenLowLevel();
+
+		/**
+		 *	@brief
+		 *	Sequence is 0 while the summary is being written, otherwise it's the submission sequence of the error it
+		 *	describes.
+		 */
+		struct FCrashSummary
+		{
+			std::atomic<uint64> Sequence { 0 };
+			FNameEntryId Type;
+			int32 TypeNumber = 0;
+			EErrorSeverity Severity = EErrorSeverity::ErrorComponent;
+		};
+
+		FErrorJournalSettings Settings;
+		
+		mutable FCriticalSection QueueLock;
+		TArray<IErrorRef> Queue;
+		int32 DroppedCount = 0;
+		int32 UnreportedDropCount = 0;
+
+		// Written under QueueLock, read without locking by the crash dump
+		FCrashSummary CrashSummaries[CrashSummaryCapacity];
+		std::atomic<uint64> SubmittedSequence { 0 };
+		std::atomic<uint64> WrittenSequence { 0 };
+		TCHAR CrashLine[256];
+
+		// Serializes writing the file between the background thread and Flush
+		FCriticalSection FileLock;
+		TUniquePtr<IFileHandle> File;
+
+		FEvent* WakeUp = nullptr;
+		FRunnableThread* Thread = nullptr;
+		std::atomic<bool> bStopping = false;
+		
+		FDelegateHandle ReportedHandle;
+		FDelegateHandle SystemErrorHandle;
+	};
+}
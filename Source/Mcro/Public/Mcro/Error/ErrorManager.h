@@ -13,9 +13,11 @@
 
 #include "CoreMinimal.h"
 #include "HAL/ThreadSafeBool.h"
+#include "Misc/Timespan.h"
 #include "Widgets/SWidget.h"
 #include "Widgets/SWindow.h"
 #include "Mcro/Error.h"
+#include "Mcro/Error/ErrorFrequency.h"
 #include "Mcro/Delegates/EventDelegate.h"
 #include "Mcro/AutoModularFeature.h"
 
@@ -70,6 +72,13 @@ namespace Mcro::Error
 		virtual TSharedPtr<SWidget> PostErrorDisplay(IErrorRef const& error, FDisplayErrorArgs const& displayArgs) { return {}; };
 	};
 	
+	/**
+	 *	@brief
+	 *	An error summarizing other errors which arrived while another error was displayed. Each inner error is a
+	 *	distinct error signature (type and code context) named with the number of times it occurred.
+	 */
+	class MCRO_API FAggregateError : public IError {};
+
 	/** @brief Global facilities for IError handling, including displaying them to the user, trigger error events, etc */
 	class MCRO_API FErrorManager
 	{
@@ -84,11 +93,23 @@ namespace Mcro::Error
 			/** @brief The error has been displayed for the user. */
 			Displayed,
 
-			/** @brief The error has not been shown to the user because another error is already being shown. */
+			/**
+			 *	@brief
+			 *	The error has not been shown to the user because another error is already being shown. It is queued
+			 *	instead, and displayed in an `FAggregateError` together with other queued errors once the current one
+			 *	is dismissed.
+			 */
 			Suppressed_AnotherErrorOpen,
 
 			/** @brief Modal windows couldn't be created at the time, so we couldn't show it to the user either. */
 			Suppressed_CannotDisplayModalWindow,
+
+			/**
+			 *	@brief
+			 *	The same error signature occurred more than `FErrorFrequency::MaxLoggedOccurrences` times, so the error
+			 *	was only counted, it was neither logged nor displayed.
+			 */
+			Suppressed_TooFrequent,
 		};
 
 		/**
@@ -119,12 +140,43 @@ namespace Mcro::Error
 
 		TEventDelegate<void()> OnErrorDialogDismissed;
 
+		/**
+		 *	@brief
+		 *	Errors with the same signature (type and code context) are logged at most once in this interval, the
+		 *	number of omitted errors is mentioned with the next log of the same signature.
+		 */
+		FTimespan LogRateLimit = FTimespan::FromSeconds(1);
+
+		/** @brief Same as `IError::GetSignature` */
+		static uint64 GetErrorSignature(IErrorRef const& error);
+
 	private:
 		
+		struct FQueuedError
+		{
+			IErrorRef Error;
+			FDisplayErrorArgs Args;
+			uint64 Signature;
+			int32 Count;
+		};
+
+		struct FLogRecord
+		{
+			double LastLogged = 0.0;
+			int32 Omitted = 0;
+		};
+		
+		auto DisplayError_Counted(IErrorRef const& error, FDisplayErrorArgs const& args) -> TFuture<EDisplayErrorResult>;
 		auto DisplayError_MainThread(IErrorRef const& error, FDisplayErrorArgs const& args) -> EDisplayErrorResult;
 		auto InferParentWidget() -> TSharedPtr<const SWidget>;
+		void LogError(IErrorRef const& error, uint64 signature);
+		void DisplayQueuedErrors();
 
 		TSharedPtr<SWindow> ModalWindow;
 		FThreadSafeBool bIsDisplayingError;
+
+		FCriticalSection QueueLock;
+		TArray<FQueuedError> QueuedErrors;
+		TMap<uint64, FLogRecord> LogRecords;
 	};
 }
@@ -25,6 +25,9 @@ namespace Mcro::Error
 
 		virtual void SerializeYaml(YAML::Emitter& emitter) const override;
 		virtual TSharedRef<SErrorDisplay> CreateErrorWidget() override;
+
+	public:
+		virtual bool IsPlainText() const override { return true; }
 	};
 	
 }
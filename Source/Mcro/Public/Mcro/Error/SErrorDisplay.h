@@ -16,6 +16,7 @@
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Layout/SExpandableArea.h"
 #include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Views/SListView.h"
 #include "Mcro/Error.h"
 #include "Mcro/Slate.h"
 #include "Mcro/AutoModularFeature.h"
@@ -43,10 +44,20 @@ namespace Mcro::Error
 		virtual TSharedPtr<SWidget> PostInnerErrors(IErrorRef const& error) { return {}; };
 	};
 	
-	/** @brief Base class for displaying Mcro::Error::IError objects to the user */
+	/**
+	 *	@brief
+	 *	Base class for displaying Mcro::Error::IError objects to the user.
+	 *
+	 *	Inner errors are listed in a virtualized list view, so only the rows visible on screen are materialized, and
+	 *	the widgets of inner errors (and large texts like error propagation) are only created when they're expanded.
+	 *	This keeps errors aggregating hundreds of inner errors responsive.
+	 */
 	class MCRO_API SErrorDisplay : public SCompoundWidget
 	{
 	public:
+		/** @brief Inner error lists taller than this are scrolled instead of growing the error display */
+		static constexpr float MaxInnerErrorsHeight = 480.f;
+		
 		SLATE_BEGIN_ARGS(SErrorDisplay) {}
 			SLATE_ARGUMENT(IErrorPtr, Error);
 			SLATE_NAMED_SLOT(FArguments, PostSeverity);
@@ -67,10 +78,42 @@ namespace Mcro::Error
 		 
 		static auto ExpandableText(const FText& title, const FString& text) -> Slate::TAttributeBlock<SExpandableArea>;
 		static auto ExpandableTextWidget(const FText& title, const FString& text) -> TSharedRef<SExpandableArea>;
+
+		/**
+		 *	@brief  An expandable area which creates its body only when it is first expanded
+		 *	@param               title  Title of the expandable area
+		 *	@param          createBody  Called at most once to create the body
+		 *	@param   initiallyExpanded  Create the body immediately and show it expanded
+		 *	@param  onExpansionChanged  Optionally get notified about the user expanding or collapsing the area
+		 */
+		static auto LazyExpandableWidget(
+			const FText& title,
+			TFunction<TSharedRef<SWidget>()>&& createBody,
+			bool initiallyExpanded = false,
+			TFunction<void(bool)>&& onExpansionChanged = {}
+		) -> TSharedRef<SExpandableArea>;
+
+		/** @brief An expandable text area which gets its text only when it is first expanded */
+		static auto LazyExpandableTextWidget(const FText& title, TFunction<FString()>&& getText, bool visible = true) -> TSharedRef<SExpandableArea>;
 		
 		static auto Severity(const IErrorRef& error)        -> Slate::TAttributeBlock<STextBlock>;
 		static auto SeverityWidget(const IErrorRef& error)  -> TSharedRef<STextBlock>;
 
 		static auto Row() -> SVerticalBox::FSlot::FSlotArguments;
+
+	protected:
+		/** @brief An inner error listed by SErrorDisplay, it remembers its expansion state while its row is recycled */
+		struct FInnerErrorItem
+		{
+			FString Name;
+			IErrorRef Error;
+			bool bExpanded = false;
+		};
+		using FInnerErrorItemPtr = TSharedPtr<FInnerErrorItem>;
+
+		auto InnerErrorsWidget(IErrorRef const& error) -> TSharedRef<SWidget>;
+		static auto InnerErrorRow(FInnerErrorItemPtr item, TSharedRef<STableViewBase> const& owner) -> TSharedRef<ITableRow>;
+
+		TArray<FInnerErrorItemPtr> InnerErrorItems;
 	};
 }
@@ -0,0 +1,137 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/TypeName.h"
+
+#include <atomic>
+
+/**
+ *	@file
+ *	A small history of recent MCRO errors, state changes and thread hops, meant for post-mortem context when a
+ *	process crashes. Records are compact fixed-size binary entries written into a global lock-free ring buffer, and
+ *	the buffer is dumped to the low-level debug output by the crash handler (or into the log on demand via
+ *	`Mcro.FlightRecorder.Dump`). Recording costs a relaxed atomic load when disabled, and an atomic increment plus a
+ *	few stores when enabled. Disable it at runtime with `Mcro.FlightRecorder.Enable 0`.
+ *
+ *	The flight recorder is compiled out with the rest of MCRO instrumentation when `MCRO_INSTRUMENTATION_ENABLED` is
+ *	0 (by default in Shipping builds). Then recording is a no-op and there are no records to get or dump. MCRO
+ *	primitives don't record directly, they go through Mcro/Instrumentation.h.
+ */
+
+namespace Mcro::FlightRecorder
+{
+	/** @brief Number of records kept by the flight recorder, older records are overwritten */
+	constexpr int32 FlightRecorderCapacity = 4096;
+
+	enum class ERecordKind : uint8
+	{
+		/** @brief IError::Make, TypeHash/Label is the error type, Severity is its initial severity */
+		ErrorMade,
+
+		/** @brief IError::Report, ContextHash is the hash of the code context */
+		ErrorReported,
+
+		/** @brief TState::Set/Modify, TypeHash/Label is the type of the state */
+		StateChange,
+
+		/** @brief RunInThread/PromiseInThread enqueue, ContextHash is the target ENamedThreads::Type */
+		ThreadHop,
+	};
+
+	/** @brief A single entry of the flight recorder */
+	struct FFlightRecord
+	{
+		/** @brief FPlatformTime::Cycles64 at the time of recording */
+		uint64 Cycles = 0;
+		FTypeHash TypeHash = 0;
+
+		/** @brief Optional static text (like a type name) describing the record, it's not null-terminated */
+		const TCHAR* Label = nullptr;
+		uint32 ContextHash = 0;
+		uint32 ThreadId = 0;
+		uint16 LabelLength = 0;
+		ERecordKind Kind = ERecordKind::ErrorMade;
+		uint8 Severity = 0;
+
+		FStringView GetLabel() const { return FStringView(Label, LabelLength); }
+	};
+
+	namespace Detail
+	{
+		MCRO_API extern std::atomic<bool> GFlightRecorderEnabled;
+
+		/** @brief Fills the timestamp and the thread ID of the record, then stores it in the ring buffer */
+		MCRO_API void Write(FFlightRecord& record);
+
+		MCRO_API void StartFlightRecorderCrashDump();
+		MCRO_API void StopFlightRecorderCrashDump();
+	}
+
+	FORCEINLINE bool IsFlightRecorderEnabled()
+	{
+#if MCRO_INSTRUMENTATION_ENABLED
+		return Detail::GFlightRecorderEnabled.load(std::memory_order_relaxed);
+#else
+		return false;
+#endif
+	}
+
+	MCRO_API void SetFlightRecorderEnabled(bool enabled);
+
+	/**
+	 *	@brief  Add a record to the flight recorder when it's enabled.
+	 *	@param label  Must have static storage duration (like type names or string literals)
+	 */
+	FORCEINLINE void Record(ERecordKind kind, FTypeHash typeHash, FStringView label, uint32 contextHash = 0, uint8 severity = 0)
+	{
+#if MCRO_INSTRUMENTATION_ENABLED
+		if (!IsFlightRecorderEnabled()) [[unlikely]] return;
+		FFlightRecord record {
+			.TypeHash = typeHash,
+			.Label = label.GetData(),
+			.ContextHash = contextHash,
+			.LabelLength = static_cast<uint16>(FMath::Min(label.Len(), static_cast<int32>(MAX_uint16))),
+			.Kind = kind,
+			.Severity = severity
+		};
+		Detail::Write(record);
+#endif
+	}
+
+	/** @brief Add a record about type T to the flight recorder when it's enabled. */
+	template <typename T>
+	FORCEINLINE void Record(ERecordKind kind, uint32 contextHash = 0, uint8 severity = 0)
+	{
+#if MCRO_INSTRUMENTATION_ENABLED
+		Record(kind, TTypeHash<T>, TTypeName<T>, contextHash, severity);
+#endif
+	}
+
+	/**
+	 *	@brief
+	 *	Get a copy of the records currently held by the flight recorder, from oldest to newest. Records which are
+	 *	being overwritten while this function runs are skipped.
+	 */
+	MCRO_API TArray<FFlightRecord> GetFlightRecords();
+
+	/** @brief Write the records of the flight recorder in a human-readable form, from oldest to newest */
+	MCRO_API void DumpFlightRecords(FOutputDevice& output);
+
+	/**
+	 *	@brief
+	 *	Write the records of the flight recorder to FPlatformMisc::LowLevelOutputDebugString, without allocating
+	 *	memory or taking locks. This is what the crash handler uses.
+	 */
+	MCRO_API void DumpFlightRecordsLowLevel();
+}
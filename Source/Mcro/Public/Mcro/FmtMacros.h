@@ -17,6 +17,10 @@
  *	The major difference from `PRINTF_` or `FString::Printf(...)` is that `FMT` macros can take user defined string
  *	conversions into account, so more types can be used directly as arguments.
  *
+ *	Format string literals are parsed at compile time (see `Mcro/Text/Format.h`), so referring to an ordered argument
+ *	which is not given is a compile error, and formatting doesn't need to parse the format string or box the arguments
+ *	at runtime. The syntax is the same as the one of `FString::Format`, named slots without an argument are kept.
+ *
  *	@todo
  *	Make a unified way to handle format arguments for FText and FString. Currently _FMT on FText is using string
  *	conversions to do the actual formatting, and not vanilla FText::Format
@@ -28,6 +32,7 @@
 
 #include "CoreMinimal.h"
 #include "Mcro/Text.h"
+#include "Mcro/Text/Format.h"
 #include "Mcro/TextMacros.h"
 #include "Mcro/Enums.h"
 #include "Mcro/Macros.h"
@@ -79,7 +84,7 @@ FORCEINLINE FText operator % (FText const& format, FStringFormatNamedArguments&&
 }
 
 #define MCRO_FMT_NAMED_ARG_TRANSFORM(s, data, elem) BOOST_PP_EXPAND(MCRO_FMT_NAMED_ARG elem)
-#define MCRO_FMT_NAMED_ARG(key, value) MakeTuple(FString(TEXT(#key)), value)
+#define MCRO_FMT_NAMED_ARG(key, value) Mcro::Text::Detail::MakeNamedFormatArgument([] { return TEXT(#key); }, value)
 
 #define MCRO_FMT_NAMED(seq)                     \
 	BOOST_PP_IIF(BOOST_PP_IS_BEGIN_PARENS(seq), \
@@ -88,7 +93,7 @@ FORCEINLINE FText operator % (FText const& format, FStringFormatNamedArguments&&
 	)(seq)                                     //
 
 #define MCRO_FMT_NAMED_0(seq)                     \
-	Mcro::Text::NamedArguments(                   \
+	Mcro::Text::FormatArguments(                  \
 		BOOST_PP_SEQ_ENUM(                        \
 			BOOST_PP_SEQ_TRANSFORM(               \
 				MCRO_FMT_NAMED_ARG_TRANSFORM, ,   \
@@ -97,7 +102,7 @@ FORCEINLINE FText operator % (FText const& format, FStringFormatNamedArguments&&
 		)                                         \
 	)                                            //
 
-#define MCRO_FMT_ORDERED(...) Mcro::Text::OrderedArguments(__VA_ARGS__)
+#define MCRO_FMT_ORDERED(...) Mcro::Text::FormatArguments(__VA_ARGS__)
 
 #define MCRO_FMT_ARGS(...)                                      \
 	BOOST_PP_IIF(BOOST_PP_IS_BEGIN_PARENS(__VA_ARGS__),         \
@@ -0,0 +1,96 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/xxhash.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/Range/Contiguous.h"
+#include "Mcro/ConstexprXXH3.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Runtime XXH3 (64 bit) hashing of buffers, ranges and strings. It is backed by the engine's vectorized xxHash
+ *	implementation (`FXxHash64`), and the results are identical to the compile-time `constexpr_xxh3` ones used by
+ *	`TTypeHash`. So a value hashed during compilation can be looked up by a value hashed at runtime.
+ */
+
+namespace Mcro::Hash
+{
+	using namespace Mcro::Concepts;
+	using namespace Mcro::Range;
+
+	/**
+	 *	@brief
+	 *	Elements which can be hashed by their bytes, so equal values always produce equal hashes. This excludes types
+	 *	with padding and floating point numbers (because of `-0.0` and NaNs).
+	 */
+	template <typename T>
+	concept CHashableBytes = std::has_unique_object_representations_v<T>;
+
+	/** @brief XXH3 hash of a memory buffer */
+	FORCEINLINE uint64 HashBytes(const void* data, uint64 size)
+	{
+		return FXxHash64::HashBuffer(data, size).Hash;
+	}
+
+	/**
+	 *	@brief
+	 *	XXH3 hash of the bytes of the elements of a range.
+	 *
+	 *	Contiguous ranges are hashed in one go. Other ranges are streamed element by element into the hash state,
+	 *	which gives the same result as if their elements were copied into an array first.
+	 */
+	template <ranges::input_range Range>
+	requires CHashableBytes<ranges::range_value_t<Range>>
+	uint64 HashRange(Range&& range)
+	{
+		using Element = ranges::range_value_t<Range>;
+		if constexpr (CContiguousRange<Range>)
+			return HashBytes(GetContiguousData(range), GetContiguousNum(range) * sizeof(Element));
+		else
+		{
+			FXxHash64Builder builder;
+			for (auto&& element : range)
+			{
+				const Element value = element;
+				builder.Update(&value, sizeof(Element));
+			}
+			return builder.Finalize().Hash;
+		}
+	}
+
+	/** @brief XXH3 hash of the characters of a string, without a null terminator */
+	FORCEINLINE uint64 HashString(FStringView string)    { return HashBytes(string.GetData(), string.Len() * sizeof(TCHAR)); }
+
+	/** @copydoc HashString(FStringView) */
+	FORCEINLINE uint64 HashString(FAnsiStringView string) { return HashBytes(string.GetData(), string.Len()); }
+
+	/** @copydoc HashString(FStringView) */
+	FORCEINLINE uint64 HashString(FUtf8StringView string) { return HashBytes(string.GetData(), string.Len()); }
+
+	/**
+	 *	@brief
+	 *	Compile-time XXH3 hash of a byte string, equal to `HashString` or `HashBytes` of the same bytes at runtime.
+	 *
+	 *	@code
+	 *	constexpr uint64 key = HashConst("MyIdentifier");
+	 *	check(key == HashString(ANSITEXTVIEW("MyIdentifier")));
+	 *	@endcode
+	 */
+	consteval uint64 HashConst(std::string_view string)
+	{
+		return constexpr_xxh3::XXH3_64bits_const(string.data(), string.size());
+	}
+}
@@ -45,4 +45,19 @@ namespace Mcro::InitializeOnCopy
 		template <typename Self>
 		operator typename TCopyQualifiersFromTo<Self, T&>::Type (this Self&& self) { return self.Get(); }
 	};
+
+	/**
+	 *	@brief
+	 *	Empty stand-in for TInitializeOnCopy, when the wrapped object is not needed by a particular instantiation of a
+	 *	class, like the mutex of a type which is not thread-safe. Use it with `UE_NO_UNIQUE_ADDRESS` so it takes no
+	 *	space. `Get` returns the stand-in itself, so it can still be passed to dummy locks.
+	 */
+	struct FNoInitializeOnCopy
+	{
+		FNoInitializeOnCopy& Get() const { return const_cast<FNoInitializeOnCopy&>(*this); }
+	};
+
+	/** @brief TInitializeOnCopy when the condition is true, an empty FNoInitializeOnCopy otherwise */
+	template <bool Condition, typename T>
+	using TInitializeOnCopyIf = std::conditional_t<Condition, TInitializeOnCopy<T>, FNoInitializeOnCopy>;
 }
\ No newline at end of file
@@ -0,0 +1,124 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Trace.h"
+#include "Mcro/TraceHooks.h"
+#include "Mcro/FlightRecorder.h"
+
+/**
+ *	@file
+ *	The single entry point of MCRO primitives into instrumentation. Every instrumented site (state changes, event
+ *	broadcasts, error creation and reporting, thread hops) calls one hook from here, which forwards it to the Unreal
+ *	Insights counters (Mcro/Trace.h), to the installed trace hooks like ETW (Mcro/TraceHooks.h) and to the flight
+ *	recorder (Mcro/FlightRecorder.h). All of them compile to nothing when `MCRO_INSTRUMENTATION_ENABLED` is 0, which
+ *	is the default in Shipping builds.
+ *
+ *	Hooks are only called for things which actually happened, like a state change which is broadcasted to its
+ *	listeners, so the backends agree with each other.
+ */
+namespace Mcro::Instrumentation
+{
+	/** @brief A TState of type T has changed and its listeners are about to be notified */
+	template <typename T>
+	FORCEINLINE void OnStateChanged()
+	{
+#if MCRO_INSTRUMENTATION_ENABLED
+		MCRO_TRACE_COUNT(StateChanges);
+		FlightRecorder::Record<T>(FlightRecorder::ERecordKind::StateChange);
+#endif
+	}
+
+	/** @brief An error of type T is made with given initial severity */
+	template <typename T>
+	FORCEINLINE void OnErrorMade(uint8 severity)
+	{
+#if MCRO_INSTRUMENTATION_ENABLED
+		MCRO_TRACE_COUNT(ErrorsMade);
+		TraceHooks::TraceErrorMade(TypeName::TTypeName<T>);
+		FlightRecorder::Record<T>(FlightRecorder::ERecordKind::ErrorMade, 0, severity);
+#endif
+	}
+
+	/** @brief An error is reported, nothing is evaluated from it when instrumentation is compiled out */
+	template <typename Error>
+	FORCEINLINE void OnErrorReported(Error const& error)
+	{
+#if MCRO_INSTRUMENTATION_ENABLED
+		if (!FlightRecorder::IsFlightRecorderEnabled()) [[unlikely]] return;
+		FlightRecorder::Record(
+			FlightRecorder::ERecordKind::ErrorReported,
+			error.GetType().GetHash(), error.GetType().ToString(),
+			GetTypeHash(error.GetCodeContextText()), static_cast<uint8>(error.GetSeverity())
+		);
+#endif
+	}
+
+	/**
+	 *	@brief  A function is about to be enqueued to another thread
+	 *	@param targetThread  The ENamedThreads::Type the function is enqueued to
+	 *	@param label         Must have static storage duration
+	 *	@return  The ID of the hop for the FThreadHopScope on the target thread
+	 */
+	FORCEINLINE uint64 OnThreadHopEnqueued(int32 targetThread, FStringView label)
+	{
+#if MCRO_INSTRUMENTATION_ENABLED
+		MCRO_TRACE_COUNT(ThreadHops);
+		FlightRecorder::Record(FlightRecorder::ERecordKind::ThreadHop, 0, label, static_cast<uint32>(targetThread));
+		return TraceHooks::TraceThreadHopEnqueued(targetThread);
+#else
+		return 0;
+#endif
+	}
+
+	/** @brief Placed in the function enqueued after OnThreadHopEnqueued to measure its execution */
+	class FThreadHopScope
+	{
+	public:
+		FORCEINLINE FThreadHopScope(int32 targetThread, uint64 hopId)
+#if MCRO_INSTRUMENTATION_ENABLED
+			: Inner(targetThread, hopId)
+#endif
+		{}
+
+	private:
+#if MCRO_INSTRUMENTATION_ENABLED
+		TraceHooks::FThreadHopScope Inner;
+#endif
+	};
+
+	/** @brief Stale bindings of an event are being removed */
+	FORCEINLINE void OnBindingSweep()
+	{
+		MCRO_TRACE_COUNT(BindingSweeps);
+	}
+
+	/** @brief Placed in the broadcast of an event with given function signature to count and measure it */
+	template <typename FunctionSignature>
+	class TBroadcastScope
+	{
+	public:
+		FORCEINLINE TBroadcastScope()
+#if MCRO_INSTRUMENTATION_ENABLED
+			: Inner(TypeName::TTypeName<FunctionSignature>)
+#endif
+		{
+			MCRO_TRACE_COUNT(Broadcasts);
+		}
+
+	private:
+#if MCRO_INSTRUMENTATION_ENABLED
+		TraceHooks::FBroadcastScope Inner;
+#endif
+	};
+}
@@ -41,4 +41,20 @@
 #define DEFAULT_ON_EMPTY(value, default) BOOST_PP_IF(BOOST_PP_CHECK_EMPTY(value), default, value)
 
 /** @brief Shorten forwarding expression with this macro so one may not need to specify explicit type */
-#define FWD(...) Forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
\ No newline at end of file
+#define FWD(...) Forward<decltype(__VA_ARGS__)>(__VA_ARGS__)
+
+/**
+ *	@brief
+ *	Place this after the parameter list of a lambda which is only called on a rarely taken path (like constructing an
+ *	error). The compiler keeps its body out of line, so the enclosing function only contains a test-and-branch and a
+ *	call instead of the entire cold code.
+ *
+ *	@code
+ *	if (UNLIKELY(!bValid)) return [&]() MCRO_COLD_LAMBDA { return MakeExpensiveError(); }();
+ *	@endcode
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#define MCRO_COLD_LAMBDA [[msvc::noinline]]
+#else
+#define MCRO_COLD_LAMBDA __attribute__((noinline, cold))
+#endif
@@ -19,6 +19,11 @@
 #include "Mcro/Delegates/EventDelegate.h"
 #include "Mcro/Error.h"
 #include "Mcro/Enums.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+#include <source_location>
 
 /** @brief Namespace for utilities handling Unreal modules */
 namespace Mcro::Modules
@@ -140,8 +145,74 @@ namespace Mcro::Modules
 	{
 		TFunction<void()> OnStartup;
 		TFunction<void()> OnShutdown;
+
+		/** @brief Name of the listener in traces and startup reports. The construction site is used when empty. */
+		FString Name;
 	};
 
+	/** @brief The module event a listener was executed for */
+	enum class EModuleListenerPhase : uint8
+	{
+		Startup,
+		Shutdown
+	};
+
+	/** @brief Time spent and memory gained during a single module event listener */
+	struct FModuleListenerTiming
+	{
+		FName Module;
+		FString Listener;
+		EModuleListenerPhase Phase = EModuleListenerPhase::Startup;
+		double Seconds = 0.0;
+
+		/**
+		 *	@brief
+		 *	Growth of the used physical memory of the process while the listener was running. Only recorded when
+		 *	`Mcro.Modules.TrackListenerMemory` is enabled, otherwise it's 0.
+		 */
+		int64 MemoryDelta = 0;
+	};
+
+	/**
+	 *	@brief
+	 *	Get the timings of every TObserveModule and TModuleBoundObject listener executed so far, in order of their
+	 *	execution. Use the `Mcro.Modules.DumpListenerTimings` console command for a report.
+	 */
+	MCRO_API TArray<FModuleListenerTiming> GetModuleListenerTimings();
+
+	namespace Detail
+	{
+		/** @brief Emits a named trace scope and records a startup report entry around a module event listener */
+		class MCRO_API FModuleListenerScope
+		{
+		public:
+			FModuleListenerScope(FName module, FString const& listener, EModuleListenerPhase phase);
+			~FModuleListenerScope();
+
+			FModuleListenerScope(FModuleListenerScope const&) = delete;
+			FModuleListenerScope& operator = (FModuleListenerScope const&) = delete;
+
+		private:
+			FModuleListenerTiming Timing;
+			double StartSeconds;
+			uint64 StartMemory = 0;
+			bool bTrackMemory = false;
+			bool bTraced = false;
+		};
+
+		MCRO_API FString GetListenerName(std::source_location const& location);
+
+		inline TFunction<void()> WrapListener(
+			TFunction<void()>&& listener, FName module, FString const& name, EModuleListenerPhase phase
+		) {
+			return [listener = MoveTemp(listener), module, name, phase]
+			{
+				FModuleListenerScope scope(module, name, phase);
+				listener();
+			};
+		}
+	}
+
 	/** @brief Use this in global variables to automatically do things on module startup or shutdown */
 	template <CObservableModule M>
 	struct TObserveModule
@@ -152,19 +223,26 @@ namespace Mcro::Modules
 		 *	`(F|I)Foobar(Module(Interface)?)?` the extracted name will be `Foobar`. If your module doesn't follow this
 		 *	naming use the constructor accepting an FName
 		 */
-		TObserveModule(FObserveModuleListener&& listeners)
+		TObserveModule(
+			FObserveModuleListener&& listeners,
+			std::source_location location = std::source_location::current()
+		)
+			: ModuleName(*InferModuleName<M>())
 		{
-			BindListeners(FWD(listeners));
-			
-			ObserveModule(*InferModuleName<M>());
-			
+			BindListeners(FWD(listeners), location);
+			ObserveModule(ModuleName);
 		}
 
 		/** @brief This constructor provides an explicit FName for getting the module */
-		TObserveModule(FName const& moduleName, FObserveModuleListener&& listeners)
+		TObserveModule(
+			FName const& moduleName,
+			FObserveModuleListener&& listeners,
+			std::source_location location = std::source_location::current()
+		)
+			: ModuleName(moduleName)
 		{
-			BindListeners(FWD(listeners));
-			ObserveModule(moduleName);
+			BindListeners(FWD(listeners), location);
+			ObserveModule(ModuleName);
 		}
 
 		/**
@@ -182,26 +260,46 @@ namespace Mcro::Modules
 		TBelatedEventDelegate<void()> OnShutdownModule;
 
 		/** @brief Specify function to be executed on startup */
-		TObserveModule& OnStartup(TFunction<void()>&& func)
-		{
-			OnStartupModule.Add(InferDelegate::From(func));
+		TObserveModule& OnStartup(
+			TFunction<void()>&& func,
+			std::source_location location = std::source_location::current()
+		) {
+			OnStartupModule.Add(InferDelegate::From(Detail::WrapListener(
+				FWD(func), ModuleName, Detail::GetListenerName(location), EModuleListenerPhase::Startup
+			)));
 			return *this;
 		}
 		
 		/** @brief Specify function to be executed on shutdown */
-		TObserveModule& OnShutdown(TFunction<void()>&& func)
-		{
-			OnShutdownModule.Add(InferDelegate::From(func));
+		TObserveModule& OnShutdown(
+			TFunction<void()>&& func,
+			std::source_location location = std::source_location::current()
+		) {
+			OnShutdownModule.Add(InferDelegate::From(Detail::WrapListener(
+				FWD(func), ModuleName, Detail::GetListenerName(location), EModuleListenerPhase::Shutdown
+			)));
 			return *this;
 		}
 		
 	private:
 		M* Module = nullptr;
+		FName ModuleName;
 
-		void BindListeners(FObserveModuleListener&& listeners)
+		void BindListeners(FObserveModuleListener&& listeners, std::source_location const& location)
 		{
-			if (listeners.OnStartup) OnStartupModule.Add(InferDelegate::From(listeners.OnStartup));
-			if (listeners.OnShutdown) OnShutdownModule.Add(InferDelegate::From(listeners.OnShutdown));
+			FString name = listeners.Name.IsEmpty() ? Detail::GetListenerName(location) : listeners.Name;
+			if (listeners.OnStartup)
+			{
+				OnStartupModule.Add(InferDelegate::From(Detail::WrapListener(
+					MoveTemp(listeners.OnStartup), ModuleName, name, EModuleListenerPhase::Startup
+				)));
+			}
+			if (listeners.OnShutdown)
+			{
+				OnShutdownModule.Add(InferDelegate::From(Detail::WrapListener(
+					MoveTemp(listeners.OnShutdown), ModuleName, name, EModuleListenerPhase::Shutdown
+				)));
+			}
 		}
 
 		void ObserveModule(FName const& moduleName)
@@ -225,6 +323,27 @@ namespace Mcro::Modules
 		}
 	};
 
+	/** @brief When TModuleBoundObject creates its object after its module has started up */
+	enum class EModuleBoundConstruction : uint8
+	{
+		/** @brief Create the object synchronously inside the module startup */
+		Immediate,
+
+		/** @brief Create the object on the first TryGet or GetChecked after the module has started up */
+		Lazy,
+
+		/**
+		 *	@brief
+		 *	Create the object on a worker thread right after the module has started up, so the module load chain is
+		 *	not blocked by it. Use OnReady or GetChecked (which waits for it) to access the object.
+		 *
+		 *	Module shutdown waits for a pending construction. If the factory waits on the game thread, that wait is
+		 *	served by processing game thread tasks while shutting down. Factories waiting on anything else should poll
+		 *	TModuleBoundObject::IsCancelled and return nullptr when it's true.
+		 */
+		Async
+	};
+
 	/** @brief A wrapper around a given object which lifespan is bound to given module. */
 	template <CObservableModule M, typename T>
 	struct TModuleBoundObject
@@ -237,49 +356,78 @@ namespace Mcro::Modules
 		
 		struct FObjectFactory
 		{
+			/** @brief Create the object, or nullptr when construction was given up (see IsCancelled) */
 			TFunction<T*()> Create;
 			TFunction<void(T&)> OnAfterCreated;
 			TFunction<void(T&)> OnShutdown;
+			EModuleBoundConstruction Construction = EModuleBoundConstruction::Immediate;
 		};
 
 		TModuleBoundObject(FObjectFactory&& factory = {})
-			: Observer({
-				[this, factory]
-				{
-					T* newObject = !factory.Create ? new T() : factory.Create();
-					CreateObject(newObject);
-					if (factory.OnAfterCreated) factory.OnAfterCreated(*Storage.Get());
-				},
-				[this, factory]
-				{
-					if (factory.OnShutdown) factory.OnShutdown(*Storage.Get());
-					Storage.Reset();
-				}
+			: Factory(MoveTemp(factory))
+			, Observer({
+				[this] { OnModuleStartup(); },
+				[this] { OnModuleShutdown(); },
+				TTypeString<T>()
 			})
 		{}
 
+		/**
+		 *	@brief
+		 *	Event broadcasted once the object has been created, or immediately executed upon subscription if it's
+		 *	already available. With EModuleBoundConstruction::Async this is broadcasted from a worker thread. Bindings
+		 *	are removed on module shutdown.
+		 */
+		TBelatedEventDelegate<void(T&)> OnReady;
+
+		/**
+		 *	@brief
+		 *	Get the object or crash when it's not available. This waits for asynchronously constructed objects, and
+		 *	creates lazily constructed ones.
+		 */
 		T& GetChecked()
 		{
-			ASSERT_CRASH(Storage,
+			T* object = TryGet();
+			if (!object && Factory.Construction == EModuleBoundConstruction::Async && AsyncConstruction.IsValid())
+			{
+				WaitForAsyncConstruction();
+				object = TryGet();
+			}
+			ASSERT_CRASH(object,
 				->WithMessage(TEXT_"Module bound object was not available")
 				->WithAppendix(TEXT_"Module type", TTypeString<M>())
 				->WithAppendix(TEXT_"Object type", TTypeString<T>())
 			);
-			return *Storage.Get();
+			return *object;
 		}
 
-		T const& GetChecked() const
+		T const& GetChecked() const { return const_cast<TModuleBoundObject*>(this)->GetChecked(); }
+
+		/**
+		 *	@brief
+		 *	Get the object if it's available. Lazily constructed objects are created here, asynchronously constructed
+		 *	ones return nullptr until they're ready.
+		 */
+		T* TryGet()
 		{
-			ASSERT_CRASH(Storage,
-				->WithMessage(TEXT_"Module bound object was not available")
-				->WithAppendix(TEXT_"Module type", TTypeString<M>())
-				->WithAppendix(TEXT_"Object type", TTypeString<T>())
-			);
-			return *Storage.Get();
+			if (T* object = Object.load(std::memory_order_acquire)) [[likely]]
+				return object;
+			if (Factory.Construction == EModuleBoundConstruction::Lazy && bModuleStarted.load(std::memory_order_acquire))
+				return Construct();
+			return nullptr;
 		}
-		
-		      T* TryGet()       { return Storage.Get(); }
-		const T* TryGet() const { return Storage.Get(); }
+
+		const T* TryGet() const { return const_cast<TModuleBoundObject*>(this)->TryGet(); }
+
+		/** @brief Is the object already created (without creating lazily constructed ones) */
+		bool IsReady() const { return Object.load(std::memory_order_acquire) != nullptr; }
+
+		/**
+		 *	@brief
+		 *	True while the module is shutting down. Asynchronous factories waiting on other threads or events should
+		 *	poll this and give up by returning nullptr, otherwise module shutdown may wait for them forever.
+		 */
+		bool IsCancelled() const { return bCancelled.load(std::memory_order_acquire); }
 
 	private:
 
@@ -292,8 +440,90 @@ namespace Mcro::Modules
 			else
 				Storage = TUniquePtr<T>(newObject);
 		}
-		
+
+		T* Construct()
+		{
+			{
+				FScopeLock lock(&Lock);
+
+				// Storage is already set while OnAfterCreated is running on this thread
+				if (Storage) return Storage.Get();
+
+				T* newObject = !Factory.Create ? new T() : Factory.Create();
+				if (!newObject) return nullptr;
+				CreateObject(newObject);
+				if (Factory.OnAfterCreated) Factory.OnAfterCreated(*Storage.Get());
+				Object.store(Storage.Get(), std::memory_order_release);
+			}
+			OnReady.Broadcast(*Storage.Get());
+			return Storage.Get();
+		}
+
+		/**
+		 *	@brief
+		 *	Waiting on the game thread processes its tasks meanwhile, so factories waiting on the game thread can
+		 *	finish instead of deadlocking.
+		 */
+		void WaitForAsyncConstruction()
+		{
+			if (!IsInGameThread() || !FTaskGraphInterface::IsRunning())
+			{
+				AsyncConstruction.Wait();
+				return;
+			}
+			while (!AsyncConstruction.WaitFor(FTimespan::FromMilliseconds(1)))
+				FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		}
+
+		void OnModuleStartup()
+		{
+			bCancelled.store(false, std::memory_order_release);
+			switch (Factory.Construction)
+			{
+			case EModuleBoundConstruction::Immediate:
+				Construct();
+				break;
+			case EModuleBoundConstruction::Lazy:
+				bModuleStarted.store(true, std::memory_order_release);
+				break;
+			case EModuleBoundConstruction::Async:
+				AsyncConstruction = Async(
+					FTaskGraphInterface::IsRunning() ? EAsyncExecution::TaskGraph : EAsyncExecution::Thread,
+					[this] { Construct(); }
+				);
+				break;
+			}
+		}
+
+		void OnModuleShutdown()
+		{
+			bCancelled.store(true, std::memory_order_release);
+			if (AsyncConstruction.IsValid())
+			{
+				WaitForAsyncConstruction();
+				AsyncConstruction.Reset();
+			}
+
+			FScopeLock lock(&Lock);
+			bModuleStarted.store(false, std::memory_order_release);
+			Object.store(nullptr, std::memory_order_release);
+			if (Storage)
+			{
+				if (Factory.OnShutdown) Factory.OnShutdown(*Storage.Get());
+				Storage.Reset();
+			}
+			OnReady.Reset();
+		}
+
+		FObjectFactory Factory;
 		StorageType Storage {};
+		std::atomic<T*> Object { nullptr };
+		std::atomic<bool> bModuleStarted { false };
+		std::atomic<bool> bCancelled { false };
+		FCriticalSection Lock;
+		TFuture<void> AsyncConstruction;
+
+		// Declared last, because it may invoke the startup listener already during construction
 		TObserveModule<M> Observer;
 	};
 }
@@ -0,0 +1,129 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+
+/** @brief Contains a simple per-type pooled allocator */
+namespace Mcro::ObjectPool
+{
+	/** @brief Default number of objects allocated together in one slab of a TObjectPool */
+	inline constexpr int32 DefaultObjectPoolSlabSize = 64;
+
+	/**
+	 *	@brief
+	 *	A thread-safe pool of fixed size slots for objects of a single type. Memory is allocated in slabs of `SlabSize`
+	 *	objects, freed slots are reused through an intrusive free-list, so creating and destroying many objects of the
+	 *	same type doesn't go through general purpose malloc and doesn't fragment the heap.
+	 *
+	 *	Slabs are only released when the pool is destroyed. Use the global instance via `Get()`, objects created with
+	 *	it must be destroyed with `Delete` of the same pool.
+	 *
+	 *	@tparam SlabSize  Number of objects allocated together
+	 */
+	template <typename T, int32 SlabSize = DefaultObjectPoolSlabSize>
+	class TObjectPool : public FNoncopyable
+	{
+		static_assert(SlabSize > 0, "TObjectPool needs at least one object per slab");
+		
+	public:
+		/** @brief The global pool of objects of type T */
+		static TObjectPool& Get()
+		{
+			static TObjectPool pool;
+			return pool;
+		}
+
+		~TObjectPool()
+		{
+			for (void* slab : Slabs)
+				FMemory::Free(slab);
+		}
+
+		/** @brief Construct a new object in a pooled slot */
+		template <typename... Args>
+		T* New(Args&&... args)
+		{
+			return new (Allocate()) T(Forward<Args>(args)...);
+		}
+
+		/** @brief Destruct an object previously created with `New` and return its slot to the pool */
+		void Delete(const T* object)
+		{
+			if (!object) return;
+			object->~T();
+			Free(const_cast<T*>(object));
+		}
+
+		/** @brief Get an uninitialized slot */
+		void* Allocate()
+		{
+			FScopeLock lock(&Lock);
+			if (!FreeList)
+				AddSlab();
+			
+			FSlot* slot = FreeList;
+			FreeList = slot->Next;
+			++LiveCount;
+			return slot;
+		}
+
+		/** @brief Return an uninitialized slot to the pool */
+		void Free(void* memory)
+		{
+			FScopeLock lock(&Lock);
+			FSlot* slot = static_cast<FSlot*>(memory);
+			slot->Next = FreeList;
+			FreeList = slot;
+			--LiveCount;
+		}
+
+		/** @brief Number of objects currently allocated from this pool */
+		int32 Num() const
+		{
+			FScopeLock lock(&Lock);
+			return LiveCount;
+		}
+
+		/** @brief Total number of slots this pool has reserved */
+		int32 Capacity() const
+		{
+			FScopeLock lock(&Lock);
+			return Slabs.Num() * SlabSize;
+		}
+
+	private:
+		union FSlot
+		{
+			FSlot* Next;
+			alignas(T) uint8 Storage[sizeof(T)];
+		};
+
+		void AddSlab()
+		{
+			FSlot* slab = static_cast<FSlot*>(FMemory::Malloc(sizeof(FSlot) * SlabSize, alignof(FSlot)));
+			Slabs.Add(slab);
+			for (int32 i = SlabSize - 1; i >= 0; --i)
+			{
+				slab[i].Next = FreeList;
+				FreeList = &slab[i];
+			}
+		}
+
+		mutable FCriticalSection Lock;
+		TArray<void*> Slabs;
+		FSlot* FreeList = nullptr;
+		int32 LiveCount = 0;
+	};
+}
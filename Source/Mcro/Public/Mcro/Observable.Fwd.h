@@ -54,6 +54,40 @@ namespace Mcro::Observable
 		 */
 		bool ThreadSafe = false;
 
+		/**
+		 *	@brief
+		 *	Optimize thread-safe states for frequent reads from many threads. Small trivially copyable values are
+		 *	published through a seqlock, anything else through immutable snapshots. `GetCopyOnAnyThread` and
+		 *	`GetSnapshotOnAnyThread` then won't take a lock or allocate. This flag doesn't do anything unless
+		 *	ThreadSafe is also true.
+		 */
+		bool ReadMostly = false;
+
+		/**
+		 *	@brief
+		 *	Don't notify listeners immediately on change, but once at the end of the current game thread frame with
+		 *	the latest value. Listeners are then always called on the game thread. The previous value in the change
+		 *	data is the value at the last notification.
+		 *
+		 *	@warning
+		 *	States with pending coalesced notifications must be destroyed on the game thread.
+		 */
+		bool CoalescePerFrame = false;
+
+		/**
+		 *	@brief
+		 *	When greater than zero, coalesce notifications like CoalescePerFrame, and also notify listeners at most
+		 *	once per this many seconds.
+		 */
+		double ThrottleSeconds = 0;
+
+		/**
+		 *	@brief
+		 *	Record this many of the most recent values, including the current one, in a fixed capacity ring buffer
+		 *	accessible via `TState::GetHistory`. Only considered from DefaultPolicy.
+		 */
+		int32 History = 0;
+
 		/** @brief Merge two policy flags */
 		FORCEINLINE constexpr FStatePolicy With(FStatePolicy const& other) const
 		{
@@ -62,7 +96,11 @@ namespace Mcro::Observable
 				AlwaysNotify        || other.AlwaysNotify,
 				StorePrevious       || other.StorePrevious,
 				AlwaysStorePrevious || other.AlwaysStorePrevious,
-				ThreadSafe          || other.ThreadSafe
+				ThreadSafe          || other.ThreadSafe,
+				ReadMostly          || other.ReadMostly,
+				CoalescePerFrame    || other.CoalescePerFrame,
+				ThrottleSeconds > other.ThrottleSeconds ? ThrottleSeconds : other.ThrottleSeconds,
+				History > other.History ? History : other.History
 			};
 		}
 
@@ -73,6 +111,10 @@ namespace Mcro::Observable
 				&& lhs.StorePrevious       == rhs.StorePrevious
 				&& lhs.AlwaysStorePrevious == rhs.AlwaysStorePrevious
 				&& lhs.ThreadSafe          == rhs.ThreadSafe
+				&& lhs.ReadMostly          == rhs.ReadMostly
+				&& lhs.CoalescePerFrame    == rhs.CoalescePerFrame
+				&& lhs.ThrottleSeconds     == rhs.ThrottleSeconds
+				&& lhs.History             == rhs.History
 			;
 		}
 
@@ -90,6 +132,9 @@ namespace Mcro::Observable
 
 	struct IStateTag {};
 
+	template <typename T>
+	class TCow;
+
 	template <typename T>
 	inline constexpr FStatePolicy StatePolicyFor =
 		CClass<T>
@@ -97,6 +142,10 @@ namespace Mcro::Observable
 				? FStatePolicy {.NotifyOnChangeOnly = true}
 				: FStatePolicy {.AlwaysNotify = true}
 			: FStatePolicy {.NotifyOnChangeOnly = true, .StorePrevious = true}; 
+
+	/** @brief Storing the previous value of copy-on-write values is cheap, so they do it by default */
+	template <typename T>
+	inline constexpr FStatePolicy StatePolicyFor<TCow<T>> = FStatePolicy {.NotifyOnChangeOnly = true, .StorePrevious = true};
 	
 	template <typename T>
 	struct IState;
@@ -180,6 +229,10 @@ namespace Mcro::Observable
 	template <typename T, FStatePolicy DefaultPolicy = StatePolicyFor<T>>
 	using TStateTS = TState<T, DefaultPolicy.With({.ThreadSafe = true})>;
 
+	/** @brief Convenience alias for thread safe states optimized for lock-free reads from many threads */
+	template <typename T, FStatePolicy DefaultPolicy = StatePolicyFor<T>>
+	using TStateRM = TState<T, DefaultPolicy.With({.ThreadSafe = true, .ReadMostly = true})>;
+
 	/** @brief Convenience alias for boolean states */
 	using FBool = TState<bool>;
 	
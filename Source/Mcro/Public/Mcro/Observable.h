@@ -13,7 +13,16 @@
 #include "CoreMinimal.h"
 #include "Mcro/AssertMacros.h"
 #include "Mcro/Delegates/EventDelegate.h"
+#include "Mcro/Instrumentation.h"
+#include "Mcro/Threading/InlineFunction.h"
 #include "Mcro/Observable.Fwd.h"
+#include "Mcro/Observable/Coalescing.h"
+#include "Mcro/Observable/ContainerDelta.h"
+#include "Mcro/Observable/CopyOnWrite.h"
+#include "Mcro/Observable/History.h"
+#include "Mcro/Observable/Dependency.h"
+#include "Mcro/Observable/ReadMostly.h"
+#include "Mcro/Observable/Transaction.h"
 
 namespace Mcro::Observable
 {
@@ -23,10 +32,11 @@ namespace Mcro::Observable
 	/**
 	 *	@brief
 	 *	This struct holds the circumstances of the data change. It cannot be moved or copied and its lifespan is
-	 *	managed entirely by `TState`
+	 *	managed entirely by `TState`. For array and map states it also carries the element-wise changes made via
+	 *	the container operations of `TState`.
 	 */
 	template <typename T>
-	struct TChangeData
+	struct TChangeData : Detail::TChangeDeltaBase<T>
 	{
 		template <CDefaultInitializable = T>
 		TChangeData() : Next() {}
@@ -35,10 +45,18 @@ namespace Mcro::Observable
 		TChangeData(T&& value) : Next(FWD(value)) {}
 
 		template <CCopyConstructible = T>
-		TChangeData(const TChangeData& from) : Next(from.Next), Previous(from.Previous) {}
+		TChangeData(const TChangeData& from)
+			: Detail::TChangeDeltaBase<T>(from)
+			, Next(from.Next)
+			, Previous(from.Previous)
+		{}
 		
 		template <CMoveConstructible = T>
-		TChangeData(TChangeData&& from) noexcept : Next(MoveTemp(from.Next)), Previous(MoveTemp(from.Previous)) {}
+		TChangeData(TChangeData&& from) noexcept
+			: Detail::TChangeDeltaBase<T>(MoveTemp(from))
+			, Next(MoveTemp(from.Next))
+			, Previous(MoveTemp(from.Previous))
+		{}
 		
 		template <typename Arg>
 		requires (!CSameAs<Arg, TChangeData> && !CSameAs<Arg, T>)
@@ -52,13 +70,52 @@ namespace Mcro::Observable
 		TOptional<T> Previous;
 	};
 
+	/**
+	 *	@brief
+	 *	Scope lock returned by states for reading or writing them. It doesn't hold anything for states which are not
+	 *	thread-safe, and it never allocates.
+	 */
+	template <bool Write>
+	class TStateLock : FNoncopyable
+	{
+	public:
+		TStateLock() = default;
+
+		explicit TStateLock(FRWLock* lock) : Lock(lock)
+		{
+			if (!Lock) return;
+			if constexpr (Write) Lock->WriteLock();
+			else Lock->ReadLock();
+		}
+
+		TStateLock(TStateLock&& other) noexcept : Lock(other.Lock) { other.Lock = nullptr; }
+
+		~TStateLock() { Release(); }
+
+		/** @brief Release the lock before the end of the scope */
+		void Release()
+		{
+			if (!Lock) return;
+			if constexpr (Write) Lock->WriteUnlock();
+			else Lock->ReadUnlock();
+			Lock = nullptr;
+		}
+
+		/** @brief Is a real lock held, false for states which are not thread-safe */
+		bool IsLocked() const { return Lock != nullptr; }
+
+	private:
+		FRWLock* Lock = nullptr;
+	};
+
+	using FStateReadLock = TStateLock<false>;
+	using FStateWriteLock = TStateLock<true>;
+
 	/** @brief Public API and base class for `TState` which shouldn't concern with policy flags or thread safety */
 	template <typename T>
 	struct IState : IStateTag
 	{
 		using Type = T;
-		using ReadLockVariant = TVariant<FReadScopeLock, FVoid>;
-		using WriteLockVariant = TVariant<FWriteScopeLock, FVoid>;
 		
 		virtual ~IState() = default;
 		
@@ -106,6 +163,12 @@ namespace Mcro::Observable
 		}
 		
 		virtual FDelegateHandle OnChangeImpl(TDelegate<void(TChangeData<T> const&)>&& onChange, FEventPolicy const& eventPolicy = {}) = 0;
+		
+		virtual FDelegateHandle OnChangeInThreadImpl(
+			ENamedThreads::Type thread,
+			TDelegate<void(TChangeData<T> const&)>&& onChange,
+			FEventPolicy const& eventPolicy = {}
+		) = 0;
 	public:
 		
 		/** @brief Add a delegate which gets a `TChangeData<T> const&` if this state has been set. */
@@ -142,6 +205,52 @@ namespace Mcro::Observable
 			return OnChange(InferDelegate::From(FWD(object), DelegateValueArgument(onChange)), eventPolicy);
 		}
 
+		/**
+		 *	@brief
+		 *	Add a delegate which gets a `TChangeData<T> const&` on the given thread, when this state has been set.
+		 *
+		 *	Listeners of the same thread are notified together, with a single task and a single copy of the change
+		 *	data per change. If the state changes again before that task runs, listeners are only notified once with the
+		 *	latest change. When this state is set on the given thread already, its listeners are notified immediately.
+		 *	Belated listeners are notified on the given thread as well, together with the others listening on it. Only
+		 *	available when T is copyable, otherwise it's a compile error.
+		 */
+		FDelegateHandle OnChangeInThread(
+			ENamedThreads::Type thread,
+			TDelegate<void(TChangeData<T> const&)> onChange,
+			FEventPolicy const& eventPolicy = {}
+		) requires CCopyConstructible<T> {
+			return OnChangeInThreadImpl(thread, MoveTemp(onChange), eventPolicy);
+		}
+
+		/**
+		 *	@brief
+		 *	Add a function without object binding listening to changes on the given thread, see the other overload for
+		 *	details. The function either has one or two arguments: `[](T const& next, [TOptional<T> const& previous])`
+		 */
+		template <CChangeListener<T> Function>
+		requires CCopyConstructible<T>
+		FDelegateHandle OnChangeInThread(ENamedThreads::Type thread, Function const& onChange, FEventPolicy const& eventPolicy = {})
+		{
+			return OnChangeInThread(thread, InferDelegate::From(DelegateValueArgument(onChange)), eventPolicy);
+		}
+
+		/**
+		 *	@brief
+		 *	Add a function with an object binding listening to changes on the given thread, see the other overloads for
+		 *	details. The function either has one or two arguments: `[](T const& next, [TOptional<T> const& previous])`
+		 */
+		template <typename Object, CChangeListener<T> Function>
+		requires CCopyConstructible<T>
+		FDelegateHandle OnChangeInThread(
+			ENamedThreads::Type thread,
+			Object&& object,
+			Function const& onChange,
+			FEventPolicy const& eventPolicy = {}
+		) {
+			return OnChangeInThread(thread, InferDelegate::From(FWD(object), DelegateValueArgument(onChange)), eventPolicy);
+		}
+
 		/**
 		 *	@brief  Pull changes from another state, syncing the value between the two. Values will be copied.
 		 *
@@ -220,28 +329,15 @@ namespace Mcro::Observable
 		 *	See https://godbolt.org/z/jn918fKfd
 		 *
 		 *	@return
-		 *	The lock is returned as TUniquePtr it's slightly more expensive because of ref-counting but it makes the API
-		 *	so much easier to use as TState can decide to return a real lock or just a dummy.
+		 *	The value and a scope lock, which doesn't hold anything when thread safety is not enabled.
 		 */
-		virtual TTuple<T const&, TUniquePtr<ReadLockVariant>> GetOnAnyThread() const = 0;
+		virtual TTuple<T const&, FStateReadLock> GetOnAnyThread() const = 0;
 
-		/**
-		 *	@brief  Lock this state for reading for the current scope.
-		 *
-		 *	@return
-		 *	The lock is returned as TUniquePtr it's slightly more expensive because of ref-counting but it makes the API
-		 *	so much easier to use as TState can decide to return a real lock or just a dummy.
-		 */
-		virtual TUniquePtr<ReadLockVariant> ReadLock() const = 0;
+		/** @brief Lock this state for reading for the current scope. The lock is empty when it's not thread-safe. */
+		virtual FStateReadLock ReadLock() const = 0;
 		
-		/**
-		 *	@brief  Lock this state for writing for the current scope.
-		 *	
-		 *	@return
-		 *	The lock is returned as TUniquePtr it's slightly more expensive because of ref-counting but it makes the API
-		 *	so much easier to use as TState can decide to return a real lock or just a dummy.
-		 */
-		virtual TUniquePtr<WriteLockVariant> WriteLock() = 0;
+		/** @brief Lock this state for writing for the current scope. The lock is empty when it's not thread-safe. */
+		virtual FStateWriteLock WriteLock() = 0;
 
 		/** @brief Get the previous value if StorePrevious is enabled and there was at least one change */
 		virtual TOptional<T> const& GetPrevious() const = 0;
@@ -362,22 +458,34 @@ namespace Mcro::Observable
 	 *	If given value is equality comparable, TState will only trigger change events when the previous and the current
 	 *	values are different. Unless that behavior is overridden by `FStatePolicy` flags. A default set of flags are
 	 *	determined by `StatePolicyFor` template for any given type.
+	 *
+	 *	Change notifications are deferred while an FStateTransaction is active on the modifying thread.
 	 */
 	template <typename T, FStatePolicy DefaultPolicy>
-	struct TState : IState<T>
+	struct TState : IState<T>, Detail::IDeferredStateNotify, Detail::IStateDependency
 	{
 		template <typename ThreadSafeType, typename NaiveType>
 		using ThreadSafeSwitch = std::conditional_t<DefaultPolicy.ThreadSafe, ThreadSafeType, NaiveType>;
 		
 		using StateBase = IState<T>;
 
-		using typename StateBase::ReadLockVariant;
-		using typename StateBase::WriteLockVariant;
 		
 		using ReadLockType = ThreadSafeSwitch<FReadScopeLock, FVoid>;
 		using WriteLockType = ThreadSafeSwitch<FWriteScopeLock, FVoid>;
 		
 		static constexpr FStatePolicy DefaultPolicyFlags = DefaultPolicy;
+
+		/** @brief Is the value published for lock-free reads */
+		static constexpr bool IsReadMostly = DefaultPolicy.ThreadSafe && DefaultPolicy.ReadMostly;
+
+		/** @brief Does this state provide TStateSnapshot via GetSnapshotOnAnyThread */
+		static constexpr bool HasSnapshots = IsReadMostly && !CSeqLockable<T>;
+
+		static_assert(!IsReadMostly || CCopyConstructible<T>, "ReadMostly states require copy constructible values");
+		static_assert(DefaultPolicy.History <= 0 || CCopyable<T>, "States with History require copyable values");
+
+		/** @brief Type of the ring buffer storing the last values of this state */
+		using HistoryType = Detail::TStateHistoryFor<T, DefaultPolicy.History>;
 		
 		/** @brief Enable default constructor only when T is default initializable */
 		template <CDefaultInitializable = T>
@@ -409,43 +517,105 @@ namespace Mcro::Observable
 		requires (sizeof...(Args) > 1)
 		TState(Args&&... args) : Value(FWD(args)...) {}
 		
-		virtual T const& Get() const override { return Value.Next; }
+		virtual ~TState() override
+		{
+			if (NotificationPending) FStateTransaction::Forget(this);
+			if (CoalescedPending) Detail::ForgetCoalescedNotification(this);
+		}
+
+		virtual T const& Get() const override final
+		{
+			return GetFast();
+		}
+
+		/** @brief Non-virtual `Get` for code holding the concrete state type */
+		FORCEINLINE T const& GetFast() const
+		{
+			// Subscribing to changes doesn't modify the value of this state
+			Detail::ReportStateRead(const_cast<TState*>(this));
+			return Value.Next;
+		}
 		
-		virtual TTuple<T const&, TUniquePtr<ReadLockVariant>> GetOnAnyThread() const override
+		virtual TTuple<T const&, FStateReadLock> GetOnAnyThread() const override final
 		{
 			return { Value.Next, ReadLock() };
 		}
+
+		/**
+		 *	@brief
+		 *	Get a copy of the current value on any thread. With the ReadMostly policy this doesn't take a lock and
+		 *	doesn't allocate, otherwise the state is read-locked while copying when it's thread-safe.
+		 */
+		template <CCopyConstructible = T>
+		T GetCopyOnAnyThread() const
+		{
+			if constexpr (IsReadMostly)
+				return ReadMostlyValue.Read();
+			else if constexpr (DefaultPolicy.ThreadSafe)
+			{
+				FReadScopeLock lock(Mutex.Get());
+				return Value.Next;
+			}
+			else return Value.Next;
+		}
+
+		/**
+		 *	@brief
+		 *	Pin an immutable snapshot of the current value without taking a lock and without copying the value.
+		 *	Only available for ReadMostly states which values are not small enough for the seqlock.
+		 */
+		TStateSnapshot<T> GetSnapshotOnAnyThread() const requires HasSnapshots
+		{
+			return TStateSnapshot<T>(ReadMostlyValue.Pin());
+		}
 		
-		virtual void Set(T const& value) override
+		virtual void Set(T const& value) override final
+		{
+			SetFast(value);
+		}
+
+		/**
+		 *	@brief
+		 *	Non-virtual `Set` for code holding the concrete state type, so the entire compare and notify path can be
+		 *	inlined. It also accepts values to be moved in.
+		 */
+		template <typename Arg>
+		requires CSameAs<std::decay_t<Arg>, T>
+		FORCEINLINE void SetFast(Arg&& value)
 		{
+			MCRO_TRACE_SCOPE(State, "TState::Set");
 			ASSERT_QUIT(!Modifying, ,
 				->WithMessage(TEXT_"Attempting to set this state while this state is already being set from somewhere else.")
 			);
 			TGuardValue modifyingGuard(Modifying, true);
-			auto lock = WriteLock();
+			WriteLockType lock(Mutex.Get());
 			bool allow = true;
 
 			if constexpr (CCoreEqualityComparable<T>)
 				allow = PolicyFlags.AlwaysNotify || Value.Next != value;
 			
 			if constexpr (CCopyable<T>)
-			if (PolicyFlags.StorePrevious && (allow || PolicyFlags.AlwaysStorePrevious))
+			if (PolicyFlags.StorePrevious && (allow || PolicyFlags.AlwaysStorePrevious) && !IsNotificationPending())
 				Value.Previous = Value.Next;
 
 			if (allow)
 			{
-				Value.Next = value;
-				OnChangeEvent.Broadcast(Value);
+				Instrumentation::OnStateChanged<T>();
+				Value.Next = FWD(value);
+				ClearDelta();
+				ReadMostlyValue.Publish(Value.Next);
+				BroadcastChange();
 			}
 		}
 		
-		virtual void Modify(TUniqueFunction<void(T&)>&& modifier, bool alwaysNotify = true) override
+		virtual void Modify(TUniqueFunction<void(T&)>&& modifier, bool alwaysNotify = true) override final
 		{
+			MCRO_TRACE_SCOPE(State, "TState::Modify");
 			ASSERT_QUIT(!Modifying, ,
 				->WithMessage(TEXT_"Attempting to set this state while this state is already being set from somewhere else.")
 			);
 			TGuardValue modifyingGuard(Modifying, true);
-			auto lock = WriteLock();
+			WriteLockType lock(Mutex.Get());
 			bool allow = true;
 			TOptional<T> previous;
 			
@@ -454,39 +624,212 @@ namespace Mcro::Observable
 				previous = Value.Next;
 			
 			modifier(Value.Next);
+			ClearDelta();
+			ReadMostlyValue.Publish(Value.Next);
 
 			if constexpr (CCopyable<T> && CCoreEqualityComparable<T>)
 				allow = alwaysNotify
 					||  PolicyFlags.AlwaysNotify
-					|| !Value.Previous.IsSet()
+					|| !previous.IsSet()
 					||  previous.GetValue() != Value.Next;
 			
 			if constexpr (CCopyable<T>)
-			if (PolicyFlags.StorePrevious && (allow || PolicyFlags.AlwaysStorePrevious))
-				Value.Previous = previous;
+			if (PolicyFlags.StorePrevious && (allow || PolicyFlags.AlwaysStorePrevious) && !IsNotificationPending())
+				Value.Previous = MoveTemp(previous);
 			
 			if (allow)
-				OnChangeEvent.Broadcast(Value);
+			{
+				Instrumentation::OnStateChanged<T>();
+				BroadcastChange();
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Construct an element at the end of an array state. Listeners get an insertion delta instead of having to
+		 *	compare the entire array. Element operations don't store the previous value even with StorePrevious.
+		 *
+		 *	@return Index of the new element
+		 */
+		template <typename... Args>
+		requires CDeltaArray<T>
+		int32 Emplace(Args&&... args)
+		{
+			int32 index = INDEX_NONE;
+			ModifyContainer([&](T& array, auto&& record)
+			{
+				index = array.Emplace(FWD(args)...);
+				record(index, EContainerDelta::Inserted);
+				return true;
+			});
+			return index;
+		}
+
+		/** @brief Add an element to the end of an array state with an insertion delta. @see Emplace */
+		template <typename Item>
+		requires CDeltaArray<T>
+		int32 Add(Item&& item)
+		{
+			return Emplace(FWD(item));
+		}
+
+		/** @brief Insert an element into an array state with an insertion delta. @see Emplace */
+		template <typename Item>
+		requires CDeltaArray<T>
+		void Insert(Item&& item, int32 index)
+		{
+			ModifyContainer([&](T& array, auto&& record)
+			{
+				array.Insert(FWD(item), index);
+				record(index, EContainerDelta::Inserted);
+				return true;
+			});
+		}
+
+		/** @brief Replace an element of an array state with an update delta. @see Emplace */
+		template <typename Item>
+		requires CDeltaArray<T>
+		void SetAt(int32 index, Item&& item)
+		{
+			ModifyContainer([&](T& array, auto&& record)
+			{
+				array[index] = FWD(item);
+				record(index, EContainerDelta::Updated);
+				return true;
+			});
+		}
+
+		/** @brief Remove an element from an array state with a removal delta. @see Emplace */
+		void RemoveAt(int32 index) requires CDeltaArray<T>
+		{
+			ModifyContainer([&](T& array, auto&& record)
+			{
+				array.RemoveAt(index);
+				record(index, EContainerDelta::Removed);
+				return true;
+			});
+		}
+
+		/**
+		 *	@brief
+		 *	Add or replace a value in a map state. Listeners get an insertion or update delta instead of having to
+		 *	compare the entire map. Element operations don't store the previous value even with StorePrevious.
+		 */
+		template <typename Key, typename Item>
+		requires CDeltaMap<T>
+		void Add(Key&& key, Item&& item)
+		{
+			ModifyContainer([&](T& map, auto&& record)
+			{
+				const bool existed = map.Contains(key);
+				typename T::KeyType keyCopy(key);
+				map.Add(FWD(key), FWD(item));
+				record(MoveTemp(keyCopy), existed ? EContainerDelta::Updated : EContainerDelta::Inserted);
+				return true;
+			});
+		}
+
+		/**
+		 *	@brief  Remove a value from a map state with a removal delta. @see Add
+		 *	@return True if the key was present. Listeners are not notified otherwise.
+		 */
+		template <typename Key>
+		requires CDeltaMap<T>
+		bool RemoveKey(Key const& key)
+		{
+			bool removed = false;
+			ModifyContainer([&](T& map, auto&& record)
+			{
+				removed = map.Remove(key) > 0;
+				if (removed) record(key, EContainerDelta::Removed);
+				return removed;
+			});
+			return removed;
 		}
 
 	protected:
+		virtual void NotifyDeferred() override
+		{
+			TGuardValue modifyingGuard(Modifying, true);
+			WriteLockType lock(Mutex.Get());
+			NotificationPending = false;
+			if (ShouldCoalesce())
+				Detail::CoalesceNotification(this, CoalescedPending, LastCoalescedNotification + PolicyFlags.ThrottleSeconds);
+			else
+				BroadcastNow();
+		}
+
+		virtual void NotifyCoalesced() override
+		{
+			TGuardValue modifyingGuard(Modifying, true);
+			WriteLockType lock(Mutex.Get());
+			CoalescedPending = false;
+			LastCoalescedNotification = FPlatformTime::Seconds();
+			FStateTransaction::Propagate(this, [this] { BroadcastNow(); });
+		}
+
 		virtual FDelegateHandle OnChangeImpl(TDelegate<void(TChangeData<T> const&)>&& onChange, FEventPolicy const& eventPolicy = {}) override
 		{
-			auto lock = WriteLock();
+			WriteLockType lock(Mutex.Get());
 			return OnChangeEvent.Add(onChange, eventPolicy);
 		}
 
+		virtual FDelegateHandle OnChangeInThreadImpl(
+			ENamedThreads::Type thread,
+			TDelegate<void(TChangeData<T> const&)>&& onChange,
+			FEventPolicy const& eventPolicy = {}
+		) override {
+			if constexpr (CCopyConstructible<T>)
+			{
+				WriteLockType lock(Mutex.Get());
+				auto* listeners = ThreadListeners.Find(thread);
+				if (!listeners) listeners = &ThreadListeners.Add(thread, MakeShared<FThreadListeners>());
+
+				FEventPolicy policy = eventPolicy;
+				policy.Belated = false;
+				FDelegateHandle handle = (*listeners)->Event.Add(MoveTemp(onChange), policy);
+				
+				if (eventPolicy.Belated && OnChangeEvent.IsBroadcasted())
+					DispatchToThread(thread, *listeners);
+				return handle;
+			}
+			else
+			{
+				// Unreachable, the public OnChangeInThread overloads are constrained to copyable states
+				checkNoEntry();
+				return {};
+			}
+		}
+
 	public:
+		virtual FDelegateHandle OnDependencyChange(FSimpleDelegate&& onChange) override
+		{
+			return OnChangeImpl(TDelegate<void(TChangeData<T> const&)>::CreateLambda(
+				[onChange = MoveTemp(onChange)](TChangeData<T> const&) { onChange.ExecuteIfBound(); }
+			));
+		}
+
+		virtual void RemoveDependencyListener(FDelegateHandle const& handle) override
+		{
+			Remove(handle);
+		}
+
 		virtual bool Remove(FDelegateHandle const& handle) override
 		{
-			auto lock = WriteLock();
-			return OnChangeEvent.Remove(handle);
+			WriteLockType lock(Mutex.Get());
+			bool removed = OnChangeEvent.Remove(handle);
+			for (auto const& listeners : ThreadListeners)
+				removed |= listeners.Value->Event.Remove(handle);
+			return removed;
 		}
 
 		virtual int32 RemoveAll(const void* object) override
 		{
-			auto lock = WriteLock();
-			return OnChangeEvent.RemoveAll(object);
+			WriteLockType lock(Mutex.Get());
+			int32 removed = OnChangeEvent.RemoveAll(object);
+			for (auto const& listeners : ThreadListeners)
+				removed += listeners.Value->Event.RemoveAll(object);
+			return removed;
 		}
 
 		virtual bool HasChangedFrom(const T& nextValue) override
@@ -509,14 +852,20 @@ namespace Mcro::Observable
 			return OnChangeEvent.IsBroadcasted();
 		}
 		
-		virtual TUniquePtr<ReadLockVariant> ReadLock() const override
+		virtual FStateReadLock ReadLock() const override final
 		{
-			return MakeUnique<ReadLockVariant>(TInPlaceType<ReadLockType>(), Mutex.Get());
+			if constexpr (DefaultPolicy.ThreadSafe)
+				return FStateReadLock(&Mutex.Get());
+			else
+				return {};
 		}
 		
-		virtual TUniquePtr<WriteLockVariant> WriteLock() override
+		virtual FStateWriteLock WriteLock() override final
 		{
-			return MakeUnique<WriteLockVariant>(TInPlaceType<WriteLockType>(), Mutex.Get());
+			if constexpr (DefaultPolicy.ThreadSafe)
+				return FStateWriteLock(&Mutex.Get());
+			else
+				return {};
 		}
 
 		virtual TOptional<T> const& GetPrevious() const override
@@ -534,6 +883,16 @@ namespace Mcro::Observable
 			return Value.Previous.IsSet() ? Value.Previous.GetValue() : Value.Next;
 		}
 
+		/**
+		 *	@brief
+		 *	Get the most recent values of this state, the first one is the current value. Use ReadLock before
+		 *	accessing it on multiple threads.
+		 */
+		HistoryType const& GetHistory() const requires (DefaultPolicy.History > 0)
+		{
+			return HistoryValues;
+		}
+
 		virtual void NormalizePrevious() override
 		{
 			if (!PolicyFlags.StorePrevious) return;
@@ -541,7 +900,7 @@ namespace Mcro::Observable
 				->WithMessage(TEXT_"Attempting to set this state while this state is already being set from somewhere else.")
 			);
 			TGuardValue modifyingGuard(Modifying, true);
-			auto lock = WriteLock();
+			WriteLockType lock(Mutex.Get());
 			Value.Previous = Value.Next;
 		}
 		
@@ -549,7 +908,9 @@ namespace Mcro::Observable
 		requires (!CState<Other>)
 		TState& operator = (Other&& value)
 		{
-			if constexpr (CCopyable<Other>)
+			if constexpr (CSameAs<std::decay_t<Other>, T>)
+				SetFast(FWD(value));
+			else if constexpr (CCopyable<Other>)
 				Set(value);
 			else if constexpr (CMovable<Other>)
 				Set(MoveTemp(value));
@@ -559,12 +920,130 @@ namespace Mcro::Observable
 		FStatePolicy PolicyFlags { DefaultPolicy };
 		
 	private:
+		void ClearDelta()
+		{
+			if constexpr (CDeltaContainer<T>)
+			{
+				Value.HasDelta = false;
+				Value.Delta.Reset();
+			}
+		}
+
+		template <typename Function>
+		void ModifyContainer(Function&& modify)
+		{
+			ASSERT_QUIT(!Modifying, ,
+				->WithMessage(TEXT_"Attempting to set this state while this state is already being set from somewhere else.")
+			);
+			TGuardValue modifyingGuard(Modifying, true);
+			WriteLockType lock(Mutex.Get());
+
+			// Pending deltas are merged, unless the state was Set in the meantime. Otherwise the delta of the last
+			// notification is only replaced once something actually changes, a no-op modification leaves it intact.
+			bool startDelta = !IsNotificationPending();
+			auto beginDelta = [&]
+			{
+				if (!startDelta) return;
+				startDelta = false;
+				Value.Delta.Reset();
+				Value.HasDelta = true;
+				if constexpr (CCopyable<T>)
+					Value.Previous.Reset();
+			};
+			const bool changed = modify(Value.Next, [&](auto&& key, EContainerDelta change)
+			{
+				beginDelta();
+				if (Value.HasDelta) Value.Delta.Add({ FWD(key), change });
+			});
+			if (!changed) return;
+			beginDelta();
+
+			ReadMostlyValue.Publish(Value.Next);
+			BroadcastChange();
+		}
+
+		bool ShouldCoalesce() const
+		{
+			return PolicyFlags.CoalescePerFrame || PolicyFlags.ThrottleSeconds > 0;
+		}
+
+		bool IsNotificationPending() const
+		{
+			return NotificationPending || CoalescedPending;
+		}
+
+		void BroadcastChange()
+		{
+			HistoryValues.Record(Value.Next);
+
+			// Nobody to notify. Belated listeners added later get the current value from the cache anyway.
+			if (OnChangeEvent.IsBroadcasted() && !OnChangeEvent.IsBound() && ThreadListeners.IsEmpty())
+				return;
+			if (FStateTransaction::Defer(this, NotificationPending))
+				return;
+			if (ShouldCoalesce())
+				Detail::CoalesceNotification(this, CoalescedPending, LastCoalescedNotification + PolicyFlags.ThrottleSeconds);
+			else
+				FStateTransaction::Propagate(this, [this] { BroadcastNow(); });
+		}
+
+		void BroadcastNow()
+		{
+			OnChangeEvent.Broadcast(Value);
+			if constexpr (CCopyConstructible<T>)
+			{
+				for (auto const& listeners : ThreadListeners)
+					DispatchToThread(listeners.Key, listeners.Value);
+			}
+		}
+
+		using FThreadEvent = TEventDelegate<void(TChangeData<T> const&), FEventPolicy {.ThreadSafe = true}>;
+
+		struct FThreadListeners
+		{
+			FThreadEvent Event;
+			FCriticalSection Lock;
+			TOptional<TChangeData<T>> Pending;
+			bool Queued = false;
+		};
+
+		void DispatchToThread(ENamedThreads::Type thread, TSharedRef<FThreadListeners> const& listeners)
+		{
+			{
+				FScopeLock lock(&listeners->Lock);
+				listeners->Pending.Emplace(Value);
+				if (listeners->Queued) return;
+				listeners->Queued = true;
+			}
+			RunInThreadInline(thread, [listeners]
+			{
+				TOptional<TChangeData<T>> change;
+				{
+					FScopeLock lock(&listeners->Lock);
+					change = MoveTemp(listeners->Pending);
+					listeners->Pending.Reset();
+					listeners->Queued = false;
+				}
+				if (change.IsSet()) listeners->Event.Broadcast(change.GetValue());
+			});
+		}
+
 		TEventDelegate<void(TChangeData<T> const&)> OnChangeEvent;
+		TMap<ENamedThreads::Type, TSharedRef<FThreadListeners>> ThreadListeners;
 		TChangeData<T> Value;
+		Detail::TReadMostlyStorageFor<T, IsReadMostly> ReadMostlyValue { Value.Next };
+		HistoryType HistoryValues { Value.Next };
 		bool Modifying = false;
-		mutable TInitializeOnCopy<FRWLock> Mutex;
+		bool NotificationPending = false;
+		bool CoalescedPending = false;
+		double LastCoalescedNotification = 0;
+		UE_NO_UNIQUE_ADDRESS
+		mutable TInitializeOnCopyIf<DefaultPolicy.ThreadSafe, FRWLock> Mutex;
 	};
 
+	/** @brief Boolean states are instantiated once inside MCRO, so dependant modules don't compile them again */
+	extern template struct MCRO_API TState<bool>;
+
 	template <typename LeftValue, CWeaklyEqualityComparableWith<LeftValue> RightValue>
 	bool operator == (IState<LeftValue> const& left, IState<RightValue> const& right)
 	{
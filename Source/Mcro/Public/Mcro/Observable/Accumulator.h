@@ -0,0 +1,259 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/ScopeLock.h"
+#include "Mcro/Observable.h"
+
+#include <atomic>
+
+namespace Mcro::Observable
+{
+	/** @brief Reducer of accumulator states summing up accumulated values */
+	template <typename T>
+	struct TSumReducer
+	{
+		static T Identity() { return T(); }
+
+		template <typename Value>
+		static void Accumulate(T& into, Value&& value) { into += FWD(value); }
+
+		static void Combine(T& into, T const& from) { into += from; }
+	};
+
+	/** @brief Reducer of accumulator states keeping the largest accumulated value */
+	template <typename T>
+	struct TMaxReducer
+	{
+		static T Identity() { return TNumericLimits<T>::Lowest(); }
+
+		template <typename Value>
+		static void Accumulate(T& into, Value&& value) { into = FMath::Max<T>(into, FWD(value)); }
+
+		static void Combine(T& into, T const& from) { into = FMath::Max<T>(into, from); }
+	};
+
+	/** @brief Reducer of accumulator states keeping the smallest accumulated value */
+	template <typename T>
+	struct TMinReducer
+	{
+		static T Identity() { return TNumericLimits<T>::Max(); }
+
+		template <typename Value>
+		static void Accumulate(T& into, Value&& value) { into = FMath::Min<T>(into, FWD(value)); }
+
+		static void Combine(T& into, T const& from) { into = FMath::Min<T>(into, from); }
+	};
+
+	/**
+	 *	@brief
+	 *	Reducers tell accumulator states how to start a shard, how to accumulate a value into a shard and how to
+	 *	combine shards. Combining must be associative and commutative, because shards are combined in no particular
+	 *	order.
+	 */
+	template <typename Reducer, typename T>
+	concept CAccumulatorReducer = requires(T& into, T const& from)
+	{
+		{ Reducer::Identity() } -> CConvertibleTo<T>;
+		Reducer::Combine(into, from);
+	};
+
+	/** @brief Options for accumulator states */
+	struct FAccumulatorStateOptions
+	{
+		/**
+		 *	@brief
+		 *	Flush the shards into the state periodically on the game thread, via the core ticker. Set it to a negative
+		 *	value to only flush manually.
+		 */
+		float FlushIntervalSeconds = 0.f;
+	};
+
+	namespace Detail
+	{
+		/** @brief A slot assigned to the calling thread on its first use, spreading threads evenly across shards */
+		inline uint32 GetAccumulatorShardSlot()
+		{
+			static std::atomic<uint32> nextSlot { 0 };
+			thread_local uint32 slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+			return slot;
+		}
+	}
+
+	/**
+	 *	@brief
+	 *	A thread-safe state for high contention counters and aggregates. Updates via `Accumulate` go into one of
+	 *	multiple shards padded to separate cache lines, selected by the calling thread, so concurrent updaters don't
+	 *	contend on a single lock or cache line. The shards are reduced into a regular thread-safe TState on `Flush`,
+	 *	which happens periodically on the game thread by default, and only then are its listeners notified.
+	 *
+	 *	The flushed state is exposed as an IState, so it can be used like any other observable. `Read` reduces the
+	 *	not-yet flushed shards on top of it for the most up-to-date value, without notifying anyone.
+	 *	@code
+	 *	TAccumulatorState<int64> bytesLoaded;
+	 *	bytesLoaded.GetState().OnChange([](int64 total) { UE_LOG(LogTemp, Display, TEXT("%lld"), total); });
+	 *
+	 *	// on any thread, as often as needed
+	 *	bytesLoaded.Accumulate(chunk.Num());
+	 *	@endcode
+	 *
+	 *	@tparam T           Type of the accumulated value
+	 *	@tparam Reducer     How values are accumulated and shards are combined. @see CAccumulatorReducer
+	 *	@tparam ShardCount  Number of shards, threads beyond this count share shards with other threads
+	 *
+	 *	@warning
+	 *	Accumulator states cannot be moved, as their periodic flush refers to them.
+	 */
+	template <typename T, typename Reducer = TSumReducer<T>, int32 ShardCount = 16>
+	requires CAccumulatorReducer<Reducer, T> && (ShardCount > 0)
+	class TAccumulatorState : FNoncopyable
+	{
+	public:
+		using Type = T;
+		using FState = TState<T, StatePolicyFor<T>.With({.ThreadSafe = true})>;
+
+		explicit TAccumulatorState(FAccumulatorStateOptions const& options = {})
+			: State(Reducer::Identity())
+		{
+			StartFlushing(options);
+		}
+
+		explicit TAccumulatorState(T const& initial, FAccumulatorStateOptions const& options = {})
+			: State(initial)
+		{
+			StartFlushing(options);
+		}
+
+		~TAccumulatorState()
+		{
+			if (TickerHandle.IsValid())
+			{
+				// RemoveTicker doesn't stop a tick which is already running on the game thread, so wait for it to
+				// finish and make sure a tick starting afterwards won't touch this object anymore.
+				{
+					FScopeLock lock(&FlushGuard->Mutex);
+					FlushGuard->bAlive = false;
+				}
+				FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+			}
+		}
+
+		/** @brief Accumulate a value into the shard of the calling thread. Listeners are notified on next flush. */
+		template <typename Value>
+		void Accumulate(Value&& value)
+		{
+			FShard& shard = Shards[Detail::GetAccumulatorShardSlot() % ShardCount];
+			shard.Lock();
+			Reducer::Accumulate(shard.Value, FWD(value));
+			shard.bDirty = true;
+			shard.Unlock();
+		}
+
+		/**
+		 *	@brief
+		 *	Reduce all shards into the state, notifying its listeners if anything was accumulated since the last
+		 *	flush. This can be called from any thread, listeners are notified on the calling thread.
+		 *
+		 *	@return True if anything was accumulated since the last flush
+		 */
+		bool Flush()
+		{
+			T pending = Reducer::Identity();
+			bool any = false;
+			for (FShard& shard : Shards)
+			{
+				if (!shard.bDirty.load(std::memory_order_relaxed)) continue;
+				shard.Lock();
+				Reducer::Combine(pending, shard.Value);
+				shard.Value = Reducer::Identity();
+				shard.bDirty = false;
+				shard.Unlock();
+				any = true;
+			}
+			if (any)
+				State.Modify([&](T& value) { Reducer::Combine(value, pending); });
+			return any;
+		}
+
+		/** @brief Get the flushed value reduced with the not-yet flushed shards, without flushing them */
+		T Read() const
+		{
+			T result = State.GetCopyOnAnyThread();
+			for (FShard const& shard : Shards)
+			{
+				if (!shard.bDirty.load(std::memory_order_relaxed)) continue;
+				shard.Lock();
+				Reducer::Combine(result, shard.Value);
+				shard.Unlock();
+			}
+			return result;
+		}
+
+		/** @brief The state holding the flushed value. Don't set it directly while values are accumulated. */
+		FState& GetState() { return State; }
+		FState const& GetState() const { return State; }
+
+		operator IState<T>& () { return State; }
+		operator IState<T> const& () const { return State; }
+
+	private:
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FShard
+		{
+			T Value = Reducer::Identity();
+			std::atomic<bool> bDirty { false };
+			mutable std::atomic<bool> bLocked { false };
+
+			void Lock() const
+			{
+				while (bLocked.exchange(true, std::memory_order_acquire))
+				{
+					while (bLocked.load(std::memory_order_relaxed))
+						FPlatformProcess::Yield();
+				}
+			}
+
+			void Unlock() const
+			{
+				bLocked.store(false, std::memory_order_release);
+			}
+		};
+
+		/** @brief Shared with the periodic flush, so it can outlive this object while a tick is in progress */
+		struct FFlushGuard
+		{
+			FCriticalSection Mutex;
+			bool bAlive = true;
+		};
+
+		void StartFlushing(FAccumulatorStateOptions const& options)
+		{
+			if (options.FlushIntervalSeconds < 0.f) return;
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateLambda([this, guard = FlushGuard](float)
+				{
+					FScopeLock lock(&guard->Mutex);
+					if (!guard->bAlive) return false;
+					Flush();
+					return true;
+				}),
+				options.FlushIntervalSeconds
+			);
+		}
+
+		FShard Shards[ShardCount];
+		FState State;
+		TSharedRef<FFlushGuard, ESPMode::ThreadSafe> FlushGuard = MakeShared<FFlushGuard>();
+		FTSTicker::FDelegateHandle TickerHandle;
+	};
+}
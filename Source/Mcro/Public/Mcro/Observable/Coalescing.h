@@ -0,0 +1,40 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+/**
+ *	@file
+ *	Notifications of states with the CoalescePerFrame or ThrottleSeconds policies are collected here and flushed at
+ *	the end of game thread frames.
+ */
+
+#include "CoreMinimal.h"
+#include "Mcro/Observable/Transaction.h"
+
+namespace Mcro::Observable::Detail
+{
+	/**
+	 *	@brief  Used by states to defer their notification at least until the end of the current frame.
+	 *
+	 *	@param  state    The state to be notified with NotifyCoalesced on the game thread
+	 *	@param  pending  Flag of the state which is true while it's waiting for notification
+	 *	@param  dueTime  Don't notify the state before this time in FPlatformTime::Seconds
+	 */
+	MCRO_API void CoalesceNotification(IDeferredStateNotify* state, bool& pending, double dueTime);
+
+	/** @brief Used by states to remove themselves from pending coalesced notifications when they're destroyed */
+	MCRO_API void ForgetCoalescedNotification(IDeferredStateNotify* state);
+
+	/** @brief Notify states which coalesced notifications are due. Called at the end of game thread frames. */
+	MCRO_API void FlushCoalescedNotifications();
+}
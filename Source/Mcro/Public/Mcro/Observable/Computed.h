@@ -0,0 +1,209 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Observable.h"
+
+namespace Mcro::Observable
+{
+	/** @brief Options for computed states */
+	struct FComputedStateOptions
+	{
+		/**
+		 *	@brief
+		 *	Cache the result until any of the dependencies change. When false the function is evaluated on every
+		 *	read, but dependencies are still tracked for notifying listeners.
+		 */
+		bool Memoize = true;
+	};
+
+	/**
+	 *	@brief
+	 *	A read-only state derived from other states, via a function reading them. The states read during the last
+	 *	evaluation are recorded as dependencies, and change in any of them marks this state dirty. The function is
+	 *	evaluated again only on the next `Get`, or immediately when this state has listeners.
+	 *
+	 *	Both TState and TComputedState can be dependencies, so computed states can be chained. Listeners of computed
+	 *	states are notified after the dependencies are all invalidated, within the propagation of the original change,
+	 *	so they never observe a partially updated dependency graph.
+	 *	@code
+	 *	TState<int> width(2), height(3);
+	 *	TComputedState<int> area([&] { return width.Get() * height.Get(); });
+	 *	area.Get(); // 6
+	 *	width = 4;  // area is dirty but not evaluated
+	 *	area.Get(); // 12
+	 *	@endcode
+	 *
+	 *	@warning
+	 *	Computed states are not thread-safe, and their dependencies must outlive them.
+	 */
+	template <typename T>
+	class TComputedState : public Detail::IStateDependency, public Detail::IDeferredStateNotify, FNoncopyable
+	{
+	public:
+		using Type = T;
+
+		template <CFunctorObject Function>
+		requires CConvertibleTo<TFunction_ReturnDecay<Function>, T>
+		TComputedState(Function&& compute, FComputedStateOptions const& options = {})
+			: Compute(FWD(compute))
+			, Options(options)
+		{}
+
+		virtual ~TComputedState() override
+		{
+			if (NotificationPending) FStateTransaction::Forget(this);
+			for (auto const& dependency : Dependencies)
+				dependency.Key->RemoveDependencyListener(dependency.Value);
+		}
+
+		/** @brief Get the result of the function, evaluating it only if it's dirty */
+		T const& Get() const
+		{
+			Detail::ReportStateRead(const_cast<TComputedState*>(this));
+			Evaluate();
+			return Value.GetValue();
+		}
+
+		operator T const& () const { return Get(); }
+		T const* operator -> () const { return &Get(); }
+
+		/** @brief Does the function need to be evaluated on next read */
+		bool IsDirty() const { return bDirty; }
+
+		/**
+		 *	@brief
+		 *	Get the result of the last evaluation without evaluating it, if there was any. It is unset while a
+		 *	notification of listeners is pending.
+		 */
+		TOptional<T> const& GetLast() const { return Value; }
+
+		/**
+		 *	@brief
+		 *	Add a listener which is called with the new result, when any of the dependencies change. While this state
+		 *	has listeners it is evaluated eagerly. When T is equality comparable listeners are only called when the
+		 *	result is different.
+		 */
+		FDelegateHandle OnChange(TDelegate<void(T const&)> onChange, FEventPolicy const& eventPolicy = {})
+		{
+			FDelegateHandle handle = OnChangeEvent.Add(MoveTemp(onChange), eventPolicy);
+			if (bDirty) Evaluate();
+			return handle;
+		}
+
+		/** @brief Add a function without object binding listening to changes of the result */
+		template <CFunctorObject Function>
+		FDelegateHandle OnChange(Function&& onChange, FEventPolicy const& eventPolicy = {})
+		{
+			return OnChange(InferDelegate::From(FWD(onChange)), eventPolicy);
+		}
+
+		/** @brief Add a function with an object binding listening to changes of the result */
+		template <typename Object, CFunctorObject Function>
+		FDelegateHandle OnChange(Object&& object, Function&& onChange, FEventPolicy const& eventPolicy = {})
+		{
+			return OnChange(InferDelegate::From(FWD(object), FWD(onChange)), eventPolicy);
+		}
+
+		bool Remove(FDelegateHandle const& handle) { return OnChangeEvent.Remove(handle); }
+		int32 RemoveAll(const void* object) { return OnChangeEvent.RemoveAll(object); }
+
+		virtual FDelegateHandle OnDependencyChange(FSimpleDelegate&& onChange) override
+		{
+			return OnInvalidated.Add(MoveTemp(onChange));
+		}
+
+		virtual void RemoveDependencyListener(FDelegateHandle const& handle) override
+		{
+			OnInvalidated.Remove(handle);
+		}
+
+	protected:
+		virtual void NotifyDeferred() override
+		{
+			NotificationPending = false;
+			Evaluate();
+			if constexpr (CCoreEqualityComparable<T>)
+			{
+				TOptional<T> previous = MoveTemp(PendingPrevious);
+				PendingPrevious.Reset();
+				if (previous.IsSet() && previous.GetValue() == Value.GetValue()) return;
+			}
+			OnChangeEvent.Broadcast(Value.GetValue());
+		}
+
+		virtual void NotifyCoalesced() override {}
+
+	private:
+		void Evaluate() const
+		{
+			if (!bDirty && Options.Memoize && Value.IsSet()) return;
+
+			Detail::FDependencyTracker tracker;
+			Value = Compute();
+			bDirty = false;
+			UpdateDependencies(tracker.Dependencies);
+		}
+
+		void UpdateDependencies(TArrayView<Detail::IStateDependency* const> current) const
+		{
+			for (auto it = Dependencies.CreateIterator(); it; ++it)
+			{
+				if (!current.Contains(it->Key))
+				{
+					it->Key->RemoveDependencyListener(it->Value);
+					it.RemoveCurrent();
+				}
+			}
+			for (Detail::IStateDependency* dependency : current)
+			{
+				if (dependency == this || Dependencies.Contains(dependency)) continue;
+				Dependencies.Add(dependency, dependency->OnDependencyChange(
+					FSimpleDelegate::CreateRaw(const_cast<TComputedState*>(this), &TComputedState::Invalidate)
+				));
+			}
+		}
+
+		void Invalidate()
+		{
+			if (bDirty) return;
+			bDirty = true;
+			OnInvalidated.Broadcast();
+
+			if (!OnChangeEvent.IsBound()) return;
+
+			// The value is not readable while dirty, so it can be kept for comparison after the next evaluation
+			if constexpr (CCoreEqualityComparable<T>)
+			if (!PendingPrevious.IsSet())
+			{
+				PendingPrevious = MoveTemp(Value);
+				Value.Reset();
+			}
+
+			// Evaluate only after the entire wave of invalidations, so all dependencies are dirty by then
+			if (!FStateTransaction::Defer(this, NotificationPending))
+				NotifyDeferred();
+		}
+
+		TUniqueFunction<T()> Compute;
+		FComputedStateOptions Options;
+		mutable TOptional<T> Value;
+		TOptional<T> PendingPrevious;
+		mutable bool bDirty = true;
+		bool NotificationPending = false;
+		mutable TMap<Detail::IStateDependency*, FDelegateHandle> Dependencies;
+		TEventDelegate<void()> OnInvalidated;
+		TEventDelegate<void(T const&)> OnChangeEvent;
+	};
+}
@@ -0,0 +1,88 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Mcro::Observable
+{
+	/** @brief The kind of change of a single element in a container state */
+	enum class EContainerDelta : uint8
+	{
+		Inserted,
+		Removed,
+		Updated
+	};
+
+	/**
+	 *	@brief
+	 *	A single element change in a container state. For arrays the key is the index of the element at the time of
+	 *	the change, so entries have to be applied in order.
+	 */
+	template <typename Key>
+	struct TContainerDeltaEntry
+	{
+		Key Key;
+		EContainerDelta Change;
+	};
+
+	namespace Detail
+	{
+		template <typename T>
+		struct TContainerDeltaKey {};
+
+		template <typename Element, typename Allocator>
+		struct TContainerDeltaKey<TArray<Element, Allocator>>
+		{
+			using Type = int32;
+			static constexpr bool IsArray = true;
+		};
+
+		template <typename Key, typename Value, typename Allocator, typename KeyFuncs>
+		struct TContainerDeltaKey<TMap<Key, Value, Allocator, KeyFuncs>>
+		{
+			using Type = Key;
+			static constexpr bool IsArray = false;
+		};
+
+		template <typename T>
+		struct TChangeDeltaBase {};
+
+		template <typename T>
+		requires requires { typename TContainerDeltaKey<T>::Type; }
+		struct TChangeDeltaBase<T>
+		{
+			/**
+			 *	@brief
+			 *	Element changes made since the last notification, if the state was only modified via its container
+			 *	operations. Empty when HasDelta is false, then listeners need to consider the entire container.
+			 */
+			TArray<TContainerDeltaEntry<typename TContainerDeltaKey<T>::Type>> Delta;
+
+			/** @brief Is Delta describing every change since the last notification */
+			bool HasDelta = false;
+		};
+	}
+
+	/** @brief Values of states which provide element-wise delta change data */
+	template <typename T>
+	concept CDeltaContainer = requires { typename Detail::TContainerDeltaKey<T>::Type; };
+
+	/** @brief Array values of states which provide Add/Emplace/RemoveAt operations with delta change data */
+	template <typename T>
+	concept CDeltaArray = CDeltaContainer<T> && Detail::TContainerDeltaKey<T>::IsArray;
+
+	/** @brief Map values of states which provide Add/Remove operations with delta change data */
+	template <typename T>
+	concept CDeltaMap = CDeltaContainer<T> && !Detail::TContainerDeltaKey<T>::IsArray;
+}
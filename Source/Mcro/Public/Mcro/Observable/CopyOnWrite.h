@@ -0,0 +1,87 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/Observable.Fwd.h"
+
+namespace Mcro::Observable
+{
+	using namespace Mcro::Concepts;
+
+	/**
+	 *	@brief
+	 *	A refcounted immutable value which is only copied when it's mutated while it's shared. Use it as the value of
+	 *	a TState storing large objects, so storing the previous value, or snapshots of ReadMostly states, cost only a
+	 *	reference instead of a copy. Modifications which don't call Mutate don't copy anything, and compare equal to
+	 *	the previous value without comparing their contents.
+	 *	@code
+	 *	TState<TCow<FBigStruct>> state;
+	 *	state.Modify([](TCow<FBigStruct>& value) { value.Mutate().Member = 1; });
+	 *	@endcode
+	 */
+	template <typename T>
+	class TCow
+	{
+	public:
+		template <CDefaultInitializable = T>
+		TCow() : Storage(MakeShared<T>()) {}
+
+		template <CCopyConstructible = T>
+		TCow(T const& value) : Storage(MakeShared<T>(value)) {}
+
+		template <CMoveConstructible = T>
+		TCow(T&& value) : Storage(MakeShared<T>(MoveTemp(value))) {}
+
+		/** @brief Construct value in-place with multiple argument constructor */
+		template <typename... Args>
+		requires (sizeof...(Args) > 1)
+		TCow(Args&&... args) : Storage(MakeShared<T>(FWD(args)...)) {}
+
+		T const& Get() const { return *Storage; }
+		T const& operator * () const { return *Storage; }
+		T const* operator -> () const { return &Storage.Get(); }
+		operator T const& () const { return *Storage; }
+
+		/** @brief Get a mutable reference to the value, copying it first if it's shared with other instances */
+		template <CCopyConstructible = T>
+		T& Mutate()
+		{
+			if (!Storage.IsUnique())
+				Storage = MakeShared<T>(*Storage);
+			return *Storage;
+		}
+
+		/** @brief Is the value shared with other instances */
+		bool IsShared() const { return !Storage.IsUnique(); }
+
+		/** @brief Do the two instances share the same value */
+		bool SharesWith(TCow const& other) const { return Storage == other.Storage; }
+
+		template <CCoreEqualityComparable = T>
+		friend bool operator == (TCow const& lhs, TCow const& rhs)
+		{
+			return lhs.Storage == rhs.Storage || *lhs.Storage == *rhs.Storage;
+		}
+
+		template <CCoreEqualityComparable = T>
+		friend bool operator != (TCow const& lhs, TCow const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		TSharedRef<T> Storage;
+	};
+}
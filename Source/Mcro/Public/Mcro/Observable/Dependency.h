@@ -0,0 +1,64 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+/**
+ *	@file
+ *	Implicit dependency tracking between states. Reads of states are recorded while a tracker is active on the
+ *	reading thread, which is used by TComputedState to know which states it depends on.
+ */
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+namespace Mcro::Observable::Detail
+{
+	/** @brief Non-template interface of anything which can be a dependency of a TComputedState */
+	class IStateDependency
+	{
+	public:
+		virtual ~IStateDependency() = default;
+
+		/** @brief Call given delegate whenever this dependency changes */
+		virtual FDelegateHandle OnDependencyChange(FSimpleDelegate&& onChange) = 0;
+
+		/** @brief Remove a listener added with OnDependencyChange */
+		virtual void RemoveDependencyListener(FDelegateHandle const& handle) = 0;
+	};
+
+	/** @brief Collect the unique dependencies read on the current thread during the lifespan of this scope */
+	class MCRO_API FDependencyTracker : FNoncopyable
+	{
+	public:
+		FDependencyTracker();
+		~FDependencyTracker();
+
+		TArray<IStateDependency*, TInlineAllocator<8>> Dependencies;
+
+	private:
+		FDependencyTracker* Outer;
+	};
+
+	/** @brief Number of active dependency trackers on all threads, so reads don't need to check thread locals */
+	extern MCRO_API std::atomic<int32> GActiveDependencyTrackers;
+
+	MCRO_API void RecordStateRead(IStateDependency* state);
+
+	/** @brief Called by states when they're read */
+	FORCEINLINE void ReportStateRead(IStateDependency* state)
+	{
+		if (GActiveDependencyTrackers.load(std::memory_order_relaxed) > 0) [[unlikely]]
+			RecordStateRead(state);
+	}
+}
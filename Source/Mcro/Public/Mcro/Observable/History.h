@@ -0,0 +1,102 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <iterator>
+
+namespace Mcro::Observable
+{
+	/**
+	 *	@brief
+	 *	Fixed capacity ring buffer of the last values of a state with the History policy. Entries are reused in place
+	 *	so recording a value never allocates. Index 0 is the most recent value. It can be iterated from the most recent
+	 *	to the oldest value, and it can be used as a range for Mcro::Range.
+	 */
+	template <typename T, int32 Capacity>
+	class TStateHistory
+	{
+		static_assert(Capacity > 0, "TStateHistory needs a positive capacity");
+
+	public:
+		class FIterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = T const*;
+			using reference = T const&;
+
+			FIterator() = default;
+			FIterator(TStateHistory const* history, int32 index) : History(history), Index(index) {}
+
+			reference operator * () const { return (*History)[Index]; }
+			pointer operator -> () const { return &(*History)[Index]; }
+			FIterator& operator ++ () { ++Index; return *this; }
+			FIterator operator ++ (int) { FIterator result = *this; ++Index; return result; }
+			bool operator == (FIterator const& other) const { return Index == other.Index; }
+			bool operator != (FIterator const& other) const { return Index != other.Index; }
+
+		private:
+			TStateHistory const* History = nullptr;
+			int32 Index = 0;
+		};
+
+		TStateHistory(T const& initial) { Record(initial); }
+
+		/** @brief Record a new value, overwriting the oldest one when the history is full */
+		void Record(T const& value)
+		{
+			if (Items.Num() < Capacity)
+				Items.Add(value);
+			else
+				Items[Head] = value;
+			Head = (Head + 1) % Capacity;
+		}
+
+		/** @brief Get a recorded value, where 0 is the most recent, Num() - 1 is the oldest one */
+		T const& operator [] (int32 index) const
+		{
+			check(index >= 0 && index < Items.Num());
+			return Items[(Head - 1 - index + Capacity * 2) % Capacity];
+		}
+
+		int32 Num() const { return Items.Num(); }
+		static constexpr int32 Max() { return Capacity; }
+
+		FIterator begin() const { return FIterator(this, 0); }
+		FIterator end() const { return FIterator(this, Items.Num()); }
+
+	private:
+		TArray<T, TFixedAllocator<Capacity>> Items;
+		int32 Head = 0;
+	};
+
+	namespace Detail
+	{
+		/** @brief History storage of states which doesn't have the History policy */
+		struct FNoStateHistory
+		{
+			template <typename T>
+			FNoStateHistory(T const&) {}
+
+			template <typename T>
+			void Record(T const&) {}
+		};
+
+		template <typename T, int32 Capacity>
+		using TStateHistoryFor = std::conditional_t<(Capacity > 0), TStateHistory<T, (Capacity > 0 ? Capacity : 1)>, FNoStateHistory>;
+	}
+}
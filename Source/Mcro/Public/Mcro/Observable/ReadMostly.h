@@ -0,0 +1,138 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+/**
+ *	@file
+ *	Lock-free read storage for thread-safe TState's with the ReadMostly policy. Readers of these never take the
+ *	state's lock and never allocate. Writers are still serialized by the write lock of the state.
+ */
+
+#include "CoreMinimal.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/Threading/Snapshot.h"
+
+#include <atomic>
+#include <new>
+
+namespace Mcro::Observable
+{
+	using namespace Mcro::Concepts;
+
+	/** @brief Largest trivially copyable state value which is read through a seqlock instead of snapshots */
+	inline constexpr size_t MaxSeqLockStateSize = 64;
+
+	/** @brief Values which can be read through a seqlock by ReadMostly states */
+	template <typename T>
+	concept CSeqLockable = std::is_trivially_copyable_v<T> && sizeof(T) <= MaxSeqLockStateSize;
+
+	namespace Detail
+	{
+		/** @brief Storage of ReadMostly states for types which doesn't need it */
+		struct FNoReadMostlyStorage
+		{
+			template <typename T>
+			FNoReadMostlyStorage(T const&) {}
+
+			template <typename T>
+			void Publish(T const&) {}
+		};
+
+		/**
+		 *	@brief
+		 *	Seqlock storing a copy of a small trivially copyable value. Readers retry when they observe a write in
+		 *	progress, so they never block writers and never write shared memory.
+		 */
+		template <CSeqLockable T>
+		struct TSeqLockStorage
+		{
+			static constexpr size_t WordCount = (sizeof(T) + sizeof(uint64) - 1) / sizeof(uint64);
+
+			TSeqLockStorage(T const& value) { Publish(value); }
+
+			/** @brief Only a single writer is allowed at a time */
+			void Publish(T const& value)
+			{
+				uint64 words[WordCount] {};
+				FMemory::Memcpy(words, &value, sizeof(T));
+
+				const uint32 sequence = Sequence.load(std::memory_order_relaxed);
+				Sequence.store(sequence + 1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				for (size_t i = 0; i < WordCount; ++i)
+					Words[i].store(words[i], std::memory_order_relaxed);
+				Sequence.store(sequence + 2, std::memory_order_release);
+			}
+
+			T Read() const
+			{
+				alignas(T) alignas(uint64) uint64 words[WordCount];
+				for (;;)
+				{
+					const uint32 begin = Sequence.load(std::memory_order_acquire);
+					if (begin & 1) continue;
+
+					for (size_t i = 0; i < WordCount; ++i)
+						words[i] = Words[i].load(std::memory_order_relaxed);
+
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (Sequence.load(std::memory_order_relaxed) == begin)
+						break;
+				}
+				return *std::launder(reinterpret_cast<T const*>(words));
+			}
+
+		private:
+			std::atomic<uint32> Sequence { 0 };
+			std::atomic<uint64> Words[WordCount];
+		};
+
+		using Mcro::Threading::TSnapshotNode;
+		using Mcro::Threading::TSnapshotStorage;
+
+		template <typename T, bool ReadMostly>
+		using TReadMostlyStorageFor = std::conditional_t<
+			ReadMostly,
+			std::conditional_t<CSeqLockable<T>, TSeqLockStorage<T>, TSnapshotStorage<T>>,
+			FNoReadMostlyStorage
+		>;
+	}
+
+	/**
+	 *	@brief
+	 *	A pinned immutable snapshot of the value of a ReadMostly state. The snapshot keeps its value even when the
+	 *	state is changed in the meantime. Don't keep it around longer than necessary, or longer than the state itself.
+	 */
+	template <typename T>
+	class TStateSnapshot
+	{
+	public:
+		explicit TStateSnapshot(Detail::TSnapshotNode<T> const* node) : Node(node) {}
+		TStateSnapshot(TStateSnapshot&& other) noexcept : Node(other.Node) { other.Node = nullptr; }
+		TStateSnapshot(TStateSnapshot const&) = delete;
+		TStateSnapshot& operator = (TStateSnapshot const&) = delete;
+		TStateSnapshot& operator = (TStateSnapshot&&) = delete;
+
+		~TStateSnapshot()
+		{
+			if (Node) Detail::TSnapshotStorage<T>::Unpin(Node);
+		}
+
+		T const& Get() const { return Node->Value.GetValue(); }
+		T const& operator * () const { return Get(); }
+		T const* operator -> () const { return &Get(); }
+
+	private:
+		Detail::TSnapshotNode<T> const* Node;
+	};
+}
@@ -0,0 +1,237 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+/**
+ *	@file
+ *	Binary replication of observable states between processes. A FStateReplicator on one side tracks a version for
+ *	every registered state, and writes the values of states which changed since a version acknowledged by the other
+ *	side, as a single batch. A FStateReplica on the other side applies these batches to its own states. Transport is
+ *	left to the user, batches can be shipped over anything accepting an FArchive or a byte array.
+ *
+ *	@code
+ *	// sender
+ *	FStateReplicator replicator;
+ *	replicator.Register(TEXT_"Health", Health);
+ *	uint64 version;
+ *	Socket->Send(replicator.WriteDelta(LastAcknowledged, version));
+ *
+ *	// receiver
+ *	FStateReplica replica;
+ *	replica.Register(TEXT_"Health", Health);
+ *	if (auto acknowledged = replica.ApplyDelta(received)) SendAcknowledgement(acknowledged.GetValue());
+ *	@endcode
+ */
+
+#include "CoreMinimal.h"
+#include "Mcro/Observable.h"
+
+#include <atomic>
+
+namespace Mcro::Observable
+{
+	using namespace Mcro::Error;
+
+	/** @brief Types which can be written into and read from an FArchive */
+	template <typename T>
+	concept CArchiveSerializable = requires(FArchive& archive, T& value) { archive << value; };
+
+	/**
+	 *	@brief
+	 *	Binary codec of replicated state values. Specialize it for types which have no FArchive serialization, or
+	 *	which can be encoded more compactly than that.
+	 */
+	template <typename T>
+	struct TStateCodec;
+
+	/** @brief Codec for types which are serializable with FArchive */
+	template <CArchiveSerializable T>
+	struct TStateCodec<T>
+	{
+		// Saving archives don't modify their input
+		static void Write(FArchive& archive, T const& value) { archive << const_cast<T&>(value); }
+
+		static void Read(FArchive& archive, T& value) { archive << value; }
+	};
+
+	/** @brief Types which have a codec for replicating states of them */
+	template <typename T>
+	concept CStateCodec = requires(FArchive& archive, T const& in, T& out)
+	{
+		TStateCodec<T>::Write(archive, in);
+		TStateCodec<T>::Read(archive, out);
+	};
+
+	namespace StateReplication
+	{
+		/** @brief Identifies a state replication batch ("MCSD") */
+		constexpr uint32 Magic = 0x4453434D;
+
+		/** @brief Version of the batch encoding, replicas reject batches made with a newer version */
+		constexpr uint16 Version = 1;
+
+		/** @brief Replicas reject encoded states larger than this, so corrupted sizes can't force huge allocations */
+		constexpr int32 MaxStateBytes = 64 * 1024 * 1024;
+	}
+
+	/**
+	 *	@brief
+	 *	Tracks changes of registered states, and encodes the values of the ones which changed since a given version.
+	 *	Registered states are identified by name on both sides. Values are encoded on `WriteDelta` only, so multiple
+	 *	changes between two batches cost only one encoding, and only the latest value is sent.
+	 *
+	 *	Registering and writing deltas are thread-safe, and registered states may change on any thread.
+	 *
+	 *	@warning
+	 *	Registered states must outlive the replicator, or they need to be unregistered before they're destroyed.
+	 */
+	class MCRO_API FStateReplicator : FNoncopyable
+	{
+	public:
+		~FStateReplicator();
+
+		/** @brief Start tracking a state. Its current value is included in the next delta. */
+		template <CStateCodec T>
+		void Register(FName id, IState<T>& state)
+		{
+			FEntryRef entry = AddEntry(id, [&state](FArchive& archive)
+			{
+				auto [value, lock] = state.GetOnAnyThread();
+				TStateCodec<T>::Write(archive, value);
+			});
+
+			// Notifications may still be running on other threads while the entry is unregistered
+			FDelegateHandle handle = state.OnChange(
+				TDelegate<void(TChangeData<T> const&)>::CreateLambda([weakEntry = FEntryWeakPtr(entry)](TChangeData<T> const&)
+				{
+					if (FEntryPtr entry = weakEntry.Pin())
+						entry->MarkChanged();
+				})
+			);
+			entry->Unbind = [&state, handle] { state.Remove(handle); };
+		}
+
+		/** @return True if a state was registered with this id */
+		bool Unregister(FName id);
+
+		/** @brief The version of the most recent change of any registered state */
+		uint64 GetVersion() const { return Version->load(std::memory_order_acquire); }
+
+		/** @brief Has any registered state changed since the given version */
+		bool HasChangesSince(uint64 acknowledged) const { return GetVersion() > acknowledged; }
+
+		/**
+		 *	@brief  Write the values of states which have changed since a version acknowledged by the other side.
+		 *
+		 *	@param  archive       An archive which is saving
+		 *	@param  acknowledged  The last version the other side has applied. Use 0 to include every state.
+		 *	@return The version of the written delta, which the other side should acknowledge when applied.
+		 */
+		uint64 WriteDelta(FArchive& archive, uint64 acknowledged);
+
+		/** @brief Convenience function writing a delta into a new byte array. @see WriteDelta */
+		TArray<uint8> WriteDelta(uint64 acknowledged, uint64& version);
+
+	private:
+		using FVersionRef = TSharedRef<std::atomic<uint64>, ESPMode::ThreadSafe>;
+
+		struct FEntry
+		{
+			FEntry(FName id, uint32 wireId, FVersionRef const& replicatorVersion)
+				: Id(id)
+				, WireId(wireId)
+				, ReplicatorVersion(replicatorVersion)
+			{}
+
+			FName Id;
+			uint32 WireId;
+			FVersionRef ReplicatorVersion;
+			std::atomic<uint64> Version { 0 };
+			TUniqueFunction<void(FArchive&)> Encode;
+			TUniqueFunction<void()> Unbind;
+
+			void MarkChanged();
+		};
+
+		using FEntryRef = TSharedRef<FEntry, ESPMode::ThreadSafe>;
+		using FEntryPtr = TSharedPtr<FEntry, ESPMode::ThreadSafe>;
+		using FEntryWeakPtr = TWeakPtr<FEntry, ESPMode::ThreadSafe>;
+
+		FEntryRef AddEntry(FName id, TUniqueFunction<void(FArchive&)>&& encode);
+
+		mutable FCriticalSection Lock;
+		FVersionRef Version = MakeShared<std::atomic<uint64>, ESPMode::ThreadSafe>(0);
+		TArray<FEntryRef> Entries;
+	};
+
+	/**
+	 *	@brief
+	 *	Applies deltas written by a FStateReplicator to the states registered with the same names. Values of states
+	 *	unknown to the replica are skipped, so both sides can have different sets of states. Changed states are set
+	 *	on the thread applying the delta.
+	 *
+	 *	Replicas are not thread-safe, register states and apply deltas on the same thread.
+	 *
+	 *	@warning
+	 *	Registered states must outlive the replica, or they need to be unregistered before they're destroyed.
+	 */
+	class MCRO_API FStateReplica : FNoncopyable
+	{
+	public:
+		template <CStateCodec T>
+		requires CDefaultInitializable<T>
+		void Register(FName id, IState<T>& state)
+		{
+			AddEntry(id, [&state](FArchive& archive)
+			{
+				T value {};
+				TStateCodec<T>::Read(archive, value);
+				if (!archive.IsError()) state.Set(value);
+			});
+		}
+
+		/** @return True if a state was registered with this id */
+		bool Unregister(FName id);
+
+		/** @brief The version of the last applied delta, which should be acknowledged to the replicator */
+		uint64 GetVersion() const { return Version; }
+
+		/**
+		 *	@brief
+		 *	Forget the last applied version, so the next full batch is applied regardless of its version. Call it when
+		 *	the replicator on the other side is recreated, as its versions start over.
+		 */
+		void Reset() { Version = 0; }
+
+		/**
+		 *	@brief
+		 *	Apply a delta from an archive which is loading. Deltas (full batches included) which are not newer than the
+		 *	last applied one are ignored, so a late batch can't overwrite newer values.
+		 *
+		 *	@return
+		 *	The version to acknowledge to the replicator. Fails if the input is not a state replication batch, it's
+		 *	corrupted, or it was made against a version which this replica hasn't received yet. In the latter case
+		 *	acknowledge 0 to receive every state again.
+		 */
+		TMaybe<uint64> ApplyDelta(FArchive& archive);
+
+		/** @brief Convenience function applying a delta from a byte array. @see ApplyDelta */
+		TMaybe<uint64> ApplyDelta(TArrayView<const uint8> data);
+
+	private:
+		void AddEntry(FName id, TUniqueFunction<void(FArchive&)>&& decode);
+
+		uint64 Version = 0;
+		TMap<uint32, TUniqueFunction<void(FArchive&)>> Entries;
+	};
+}
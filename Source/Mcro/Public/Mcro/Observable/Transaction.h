@@ -0,0 +1,133 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+
+namespace Mcro::Observable
+{
+	namespace Detail
+	{
+		/** @brief Non-template interface of states which to flush their deferred change notifications */
+		class IDeferredStateNotify
+		{
+		public:
+			IDeferredStateNotify() = default;
+
+			// The rank belongs to the place of a state in the graph, copies learn their own
+			IDeferredStateNotify(IDeferredStateNotify const&) {}
+			IDeferredStateNotify& operator = (IDeferredStateNotify const&) { return *this; }
+
+			virtual ~IDeferredStateNotify() = default;
+
+			/** @brief Broadcast the change which was deferred by the current transaction */
+			virtual void NotifyDeferred() = 0;
+
+			/** @brief Broadcast the change which was coalesced until the end of the frame */
+			virtual void NotifyCoalesced() = 0;
+
+			/**
+			 *	@brief
+			 *	Depth of this state in the graph of states modifying each other from their listeners. It is learned
+			 *	during propagation, and states are notified in increasing order of it. Transactions on different threads
+			 *	may propagate through the same state, so it's atomic.
+			 */
+			std::atomic<int32> PropagationRank = 0;
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Defer change notifications of every state modified on the current thread, until the end of this scope.
+	 *
+	 *	States still store their new value immediately, but their listeners are only notified once per state when the
+	 *	transaction is committed. Change data reports the value before the transaction as previous. Listeners of
+	 *	committed states may modify other states, those get notified in the same commit after their dependencies, so
+	 *	every listener observes all the states of the transaction already updated.
+	 *
+	 *	States are notified in topological order of how they modify each other, exactly once per commit. This order is
+	 *	learned as states modify each other, because states don't declare their dependents upfront. In diamond shaped
+	 *	dependencies, the state at the bottom is only notified once all of its dependencies are notified. Changes on
+	 *	states outside of transactions are propagated like this as well, in an implicit transaction around the
+	 *	notification of the modified state.
+	 *
+	 *	Transactions can be nested, the outermost one commits everything.
+	 *	@code
+	 *	{
+	 *		FStateTransaction transaction;
+	 *		Width = 1920;
+	 *		Height = 1080;
+	 *	} // listeners of Width and Height are called here
+	 *	@endcode
+	 *
+	 *	@warning
+	 *	A state which has pending notifications must not be destroyed on another thread than the transaction's.
+	 */
+	class MCRO_API FStateTransaction : FNoncopyable
+	{
+	public:
+		FStateTransaction();
+		~FStateTransaction();
+
+		/** @brief Notify listeners of pending states now. Nested transactions cannot commit on their own. */
+		void Commit();
+
+		/** @brief Is there an active transaction on the current thread */
+		static bool IsActive();
+
+		/**
+		 *	@brief
+		 *	Used by states to defer their notification to the active transaction of the current thread, if any.
+		 *
+		 *	@param  state    The state to be notified on commit
+		 *	@param  pending  Flag of the state which is true while it's waiting for notification
+		 *
+		 *	@return
+		 *	True if the notification has been deferred, or it has been deferred already. The state shouldn't broadcast
+		 *	its change in that case.
+		 */
+		static bool Defer(Detail::IDeferredStateNotify* state, bool& pending);
+
+		/** @brief Used by states to remove themselves from the active transaction when they're destroyed */
+		static void Forget(Detail::IDeferredStateNotify* state);
+
+		/**
+		 *	@brief
+		 *	Used by states to notify their listeners outside of transactions. States modified by the listeners are
+		 *	deferred until the broadcast is finished, and then they're notified in topological order.
+		 */
+		static void Propagate(Detail::IDeferredStateNotify* state, TFunctionRef<void()> broadcast);
+
+	private:
+		struct FPendingState
+		{
+			Detail::IDeferredStateNotify* State;
+			int32 Rank;
+			int32 Order;
+
+			bool operator < (FPendingState const& other) const
+			{
+				return Rank != other.Rank ? Rank < other.Rank : Order < other.Order;
+			}
+		};
+
+		void Notify(Detail::IDeferredStateNotify* state);
+
+		FStateTransaction* Outer;
+		Detail::IDeferredStateNotify* Notifying = nullptr;
+		int32 NextOrder = 0;
+		TArray<FPendingState> Pending;
+	};
+}
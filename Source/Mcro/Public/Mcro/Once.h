@@ -13,6 +13,8 @@
 
 #include "CoreMinimal.h"
 
+#include <atomic>
+
 namespace Mcro::Once
 {
 	/**
@@ -66,4 +68,115 @@ namespace Mcro::Once
 			bIsValid = true;
 		}
 	};
+
+	/**
+	 *	@brief
+	 *	Same as FOnce but its gate can be consumed from any thread, and only one of the racing threads gets true.
+	 *	After it has been triggered, checking it is only a relaxed load.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	static FAtomicOnce GWarnOnce;
+	 *	if (bSomethingIsWrong && GWarnOnce)
+	 *	{
+	 *	    UE_LOG(LogTemp, Warning, TEXT("Something is wrong"));
+	 *	}
+	 *	@endcode
+	 */
+	struct FAtomicOnce
+	{
+	private:
+		std::atomic<bool> bIsValid { true };
+
+	public:
+		FORCEINLINE FAtomicOnce() {}
+		FORCEINLINE FAtomicOnce(const FAtomicOnce& from) : bIsValid(from.bIsValid.load(std::memory_order_relaxed)) {}
+		FORCEINLINE FAtomicOnce(FAtomicOnce&& from) noexcept
+		{
+			from.bIsValid.store(false, std::memory_order_relaxed);
+		}
+
+		FORCEINLINE operator bool()
+		{
+			return bIsValid.load(std::memory_order_relaxed)
+				&& bIsValid.exchange(false, std::memory_order_acq_rel);
+		}
+
+		FORCEINLINE bool IsTriggered() const
+		{
+			return !bIsValid.load(std::memory_order_relaxed);
+		}
+
+		FORCEINLINE void Reset()
+		{
+			bIsValid.store(true, std::memory_order_release);
+		}
+	};
+
+	/**
+	 *	@brief
+	 *	Stores a value which is initialized exactly once by the first thread getting it, while other racing threads
+	 *	wait for that initialization. Afterwards getting the value is lock-free.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	static TOnceValue<FMyTable> GTable;
+	 *	FMyTable const& table = GTable.Get([] { return BuildMyTable(); });
+	 *	@endcode
+	 */
+	template <typename T>
+	struct TOnceValue
+	{
+		TOnceValue() = default;
+		TOnceValue(TOnceValue const&) = delete;
+		TOnceValue& operator = (TOnceValue const&) = delete;
+
+		~TOnceValue()
+		{
+			if (State.load(std::memory_order_acquire) == Ready)
+				Storage.GetTypedPtr()->~T();
+		}
+
+		/** @brief Get the value, initializing it with the result of the given function if it's not initialized yet. */
+		template <typename Initializer>
+		T& Get(Initializer&& initializer)
+		{
+			if (State.load(std::memory_order_acquire) == Ready) [[likely]]
+				return *Storage.GetTypedPtr();
+
+			uint8 expected = Empty;
+			if (State.compare_exchange_strong(expected, Initializing, std::memory_order_acquire))
+			{
+				new (Storage.GetTypedPtr()) T(initializer());
+				State.store(Ready, std::memory_order_release);
+				State.notify_all();
+			}
+			else
+			{
+				while ((expected = State.load(std::memory_order_acquire)) != Ready)
+					State.wait(expected, std::memory_order_acquire);
+			}
+			return *Storage.GetTypedPtr();
+		}
+
+		/** @brief Get the value if it has been initialized already, or nullptr otherwise */
+		T* TryGet()
+		{
+			return State.load(std::memory_order_acquire) == Ready ? Storage.GetTypedPtr() : nullptr;
+		}
+
+		/** @copydoc TryGet */
+		const T* TryGet() const
+		{
+			return State.load(std::memory_order_acquire) == Ready ? Storage.GetTypedPtr() : nullptr;
+		}
+
+		bool IsSet() const { return State.load(std::memory_order_acquire) == Ready; }
+
+	private:
+		enum : uint8 { Empty, Initializing, Ready };
+
+		TTypeCompatibleBytes<T> Storage;
+		std::atomic<uint8> State { Empty };
+	};
 }
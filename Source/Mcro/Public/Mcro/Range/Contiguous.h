@@ -0,0 +1,299 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Traits/IsContiguousContainer.h"
+#include "Mcro/Range/Iterators.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include "range/v3/all.hpp"
+#include "Mcro/LibraryIncludes/End.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Algorithms which have a dedicated path for contiguous ranges (TArray, TArrayView, TStaticArray, TResourceArray,
+ *	FString, etc...). Fusing the transform or filter step into the reducing loop, and iterating contiguous input with
+ *	an index over a raw pointer, allows the compiler to auto-vectorize these the same way as hand-written loops.
+ *	Non-contiguous input is still accepted via a regular range based for loop.
+ */
+
+namespace Mcro::Range
+{
+	using namespace Mcro::Concepts;
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Containers which iterate over something else than what their data pointer points to. For example
+		 *	TBitArray::GetData points to 32 bit words while Num counts and iteration yields bits.
+		 */
+		template <typename T>
+		concept CIteratesOtherThanData = requires(T& range)
+		{
+			{ *range.begin() };
+			{ range.GetData() } -> CPointer;
+		}
+		&& !CSameAs<
+			std::decay_t<decltype(*std::declval<T&>().begin())>,
+			std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<T&>().GetData())>>
+		>;
+
+		template <typename T>
+		concept CHasDataAndNum = requires(T& range)
+		{
+			{ range.GetData() } -> CPointer;
+			{ range.Num() } -> CConvertibleTo<int64>;
+		}
+		&& !CIteratesOtherThanData<T>;
+	}
+
+	/**
+	 *	@brief
+	 *	A range which stores its elements next to each other in memory, so it can be accessed as a pointer and a size.
+	 *	This includes Unreal contiguous containers, their derivatives (like TResourceArray or TMRUArray) and
+	 *	range-v3 contiguous views over them. Packed containers like TBitArray are not contiguous ranges of their
+	 *	elements, even though they have GetData and Num.
+	 */
+	template <typename T>
+	concept CContiguousRange =
+		TIsContiguousContainer<std::decay_t<T>>::Value
+		|| Detail::CHasDataAndNum<std::decay_t<T>>
+		|| (ranges::contiguous_range<T> && ranges::sized_range<T>)
+	;
+
+	/** @brief Get the pointer to the first element of a contiguous range */
+	template <CContiguousRange Range>
+	auto GetContiguousData(Range&& range)
+	{
+		if constexpr (TIsContiguousContainer<std::decay_t<Range>>::Value)
+			return GetData(range);
+		else if constexpr (Detail::CHasDataAndNum<std::decay_t<Range>>)
+			return range.GetData();
+		else
+			return ranges::data(range);
+	}
+
+	/** @brief Get the number of elements of a contiguous range */
+	template <CContiguousRange Range>
+	int64 GetContiguousNum(Range&& range)
+	{
+		if constexpr (TIsContiguousContainer<std::decay_t<Range>>::Value)
+			return static_cast<int64>(GetNum(range));
+		else if constexpr (Detail::CHasDataAndNum<std::decay_t<Range>>)
+			return static_cast<int64>(range.Num());
+		else
+			return static_cast<int64>(ranges::size(range));
+	}
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Boundaries of slices over a contiguous range, either fixed size chunks (the last one may be smaller) or a
+		 *	given number of batches with sizes differing by at most one.
+		 */
+		struct FSliceLayout
+		{
+			int32 Num = 0;
+			int32 ChunkSize = 0;
+			int32 Count = 0;
+
+			static FSliceLayout Chunks(int32 num, int32 chunkSize)
+			{
+				chunkSize = FMath::Max(chunkSize, 1);
+				return { num, chunkSize, FMath::DivideAndRoundUp(num, chunkSize) };
+			}
+
+			static FSliceLayout Batches(int32 num, int32 count)
+			{
+				return { num, 0, FMath::Min(FMath::Max(count, 1), num) };
+			}
+
+			int32 GetStart(int32 index) const
+			{
+				return ChunkSize > 0
+					? static_cast<int32>(FMath::Min<int64>(static_cast<int64>(index) * ChunkSize, Num))
+					: static_cast<int32>(static_cast<int64>(index) * Num / Count);
+			}
+
+			template <typename T>
+			TArrayView<T> GetSlice(T* data, int32 index) const
+			{
+				const int32 start = GetStart(index);
+				return TArrayView<T>(data + start, GetStart(index + 1) - start);
+			}
+		};
+	}
+
+	/** @brief View a contiguous range as a TArrayView64 */
+	template <CContiguousRange Range>
+	auto AsArrayView(Range&& range)
+	{
+		using ElementType = std::remove_pointer_t<decltype(GetContiguousData(range))>;
+		return TArrayView64<ElementType>(GetContiguousData(range), GetContiguousNum(range));
+	}
+
+	/**
+	 *	@brief  Fold a range into a single value from left to right.
+	 *	@param    range  Input range
+	 *	@param     init  Initial value of the accumulator
+	 *	@param   reduce  Function combining the accumulator and an element into the next accumulator
+	 *	@return  The final accumulator
+	 */
+	template <CRangeMember Range, typename Value, CFunctionLike Reducer>
+	Value Reduce(Range&& range, Value init, Reducer&& reduce)
+	{
+		if constexpr (CContiguousRange<Range>)
+		{
+			const auto* data = GetContiguousData(range);
+			const int64 num = GetContiguousNum(range);
+			for (int64 i = 0; i < num; ++i)
+				init = reduce(init, data[i]);
+		}
+		else
+		{
+			for (auto&& item : range)
+				init = reduce(init, item);
+		}
+		return init;
+	}
+
+	/** @copydoc Reduce */
+	template <typename Value, CFunctionLike Reducer>
+	auto Reduce(Value init, Reducer&& reduce)
+	{
+		return ranges::make_pipeable([init, reduce]<CRangeMember Input>(Input&& range)
+		{
+			return Mcro::Range::Reduce(FWD(range), init, reduce);
+		});
+	}
+
+	/**
+	 *	@brief  Transform each element of a range then fold the results into a single value, in a single loop.
+	 *	@param      range  Input range
+	 *	@param       init  Initial value of the accumulator
+	 *	@param     reduce  Function combining the accumulator and a transformed element into the next accumulator
+	 *	@param  transform  Function transforming each element of the input
+	 *	@return  The final accumulator
+	 */
+	template <CRangeMember Range, typename Value, CFunctionLike Reducer, CFunctionLike Transformer>
+	Value TransformReduce(Range&& range, Value init, Reducer&& reduce, Transformer&& transform)
+	{
+		return Mcro::Range::Reduce(FWD(range), init, [&](Value const& accumulator, auto const& item)
+		{
+			return reduce(accumulator, transform(item));
+		});
+	}
+
+	/** @copydoc TransformReduce */
+	template <typename Value, CFunctionLike Reducer, CFunctionLike Transformer>
+	auto TransformReduce(Value init, Reducer&& reduce, Transformer&& transform)
+	{
+		return ranges::make_pipeable([init, reduce, transform]<CRangeMember Input>(Input&& range)
+		{
+			return Mcro::Range::TransformReduce(FWD(range), init, reduce, transform);
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Fold only the elements of a range which satisfy a predicate, in a single loop. The predicate is applied as a
+	 *	select instead of a branch, so this can be vectorized for arithmetic elements.
+	 *	
+	 *	@param      range  Input range
+	 *	@param       init  Initial value of the accumulator
+	 *	@param     reduce  Function combining the accumulator and an element into the next accumulator
+	 *	@param  predicate  Only elements for which this returns true are folded
+	 *	@return  The final accumulator
+	 */
+	template <CRangeMember Range, typename Value, CFunctionLike Reducer, CFunctionLike PredicateFunction>
+	Value FilterReduce(Range&& range, Value init, Reducer&& reduce, PredicateFunction&& predicate)
+	{
+		return Mcro::Range::Reduce(FWD(range), init, [&](Value const& accumulator, auto const& item)
+		{
+			return predicate(item) ? reduce(accumulator, item) : accumulator;
+		});
+	}
+
+	/** @copydoc FilterReduce */
+	template <typename Value, CFunctionLike Reducer, CFunctionLike PredicateFunction>
+	auto FilterReduce(Value init, Reducer&& reduce, PredicateFunction&& predicate)
+	{
+		return ranges::make_pipeable([init, reduce, predicate]<CRangeMember Input>(Input&& range)
+		{
+			return Mcro::Range::FilterReduce(FWD(range), init, reduce, predicate);
+		});
+	}
+
+	/** @brief Count the elements of a range which satisfy a predicate */
+	template <CRangeMember Range, CFunctionLike PredicateFunction>
+	int64 CountIf(Range&& range, PredicateFunction&& predicate)
+	{
+		return Mcro::Range::Reduce(FWD(range), int64(0), [&](int64 count, auto const& item)
+		{
+			return count + (predicate(item) ? 1 : 0);
+		});
+	}
+
+	/** @copydoc CountIf */
+	template <CFunctionLike PredicateFunction>
+	auto CountIf(PredicateFunction&& predicate)
+	{
+		return ranges::make_pipeable([predicate]<CRangeMember Input>(Input&& range)
+		{
+			return Mcro::Range::CountIf(FWD(range), predicate);
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Transform each element of a range into an existing TArray, replacing its content but keeping its allocation.
+	 *	When both the input is contiguous and the output elements are trivial, the output is written by index into
+	 *	uninitialized storage, which can be vectorized.
+	 *
+	 *	@return  The output array
+	 */
+	template <CRangeMember Range, CFunctionLike Transformer, typename Output, typename Allocator>
+	TArray<Output, Allocator>& TransformTo(Range&& range, TArray<Output, Allocator>& output, Transformer&& transform)
+	{
+		if constexpr (CContiguousRange<Range> && std::is_trivially_copyable_v<Output> && std::is_trivially_destructible_v<Output>)
+		{
+			const auto* data = GetContiguousData(range);
+			const int64 num = GetContiguousNum(range);
+			output.SetNumUninitialized(static_cast<typename TArray<Output, Allocator>::SizeType>(num), EAllowShrinking::No);
+			Output* result = output.GetData();
+			for (int64 i = 0; i < num; ++i)
+				result[i] = transform(data[i]);
+		}
+		else
+		{
+			output.Reset();
+			for (auto&& item : range)
+				output.Add(transform(item));
+		}
+		return output;
+	}
+
+	/** @copydoc TransformTo */
+	template <CFunctionLike Transformer, typename Output, typename Allocator>
+	auto TransformTo(TArray<Output, Allocator>& output, Transformer&& transform)
+	{
+		return ranges::make_pipeable([&output, transform]<CRangeMember Input>(Input&& range) -> TArray<Output, Allocator>&
+		{
+			return Mcro::Range::TransformTo(FWD(range), output, transform);
+		});
+	}
+}
@@ -15,9 +15,11 @@
 #include <ranges>
 
 #include "CoreMinimal.h"
+#include "Misc/StringBuilder.h"
 
 #include "Mcro/Concepts.h"
 #include "Mcro/Range/Iterators.h"
+#include "Mcro/Range/Contiguous.h"
 #include "Mcro/Text/TupleAsString.h"
 #include "Mcro/Templates.h"
 #include "Mcro/Text.h"
@@ -30,6 +32,7 @@ namespace Mcro::Range
 {
 	using namespace Mcro::Templates;
 	using namespace Mcro::Concepts;
+	using namespace Mcro::Tuples;
 
 	struct FRangeStringFormatOptions
 	{
@@ -50,6 +53,8 @@ namespace Mcro::Range
 			
 			auto begin() const { return Storage.begin(); }
 			auto end() const { return Storage.end(); }
+
+			Range const& GetStorage() const { return Storage; }
 			
 			FRangeStringFormatOptions Options;
 		private:
@@ -135,113 +140,341 @@ namespace Mcro::Range
 
 	namespace Detail
 	{
-		template <typename CharType>
-		void CopyCharactersToBuffer(CharType const& value, int32 chunks, int32& position, TArray<CharType>& buffer)
+		template <typename T>
+		concept CReservable = requires(T& container, int32 count) { container.Reserve(count); };
+
+		/** @brief Get the number of elements in a range when it is known without iterating it, or INDEX_NONE */
+		template <typename Range>
+		int32 GetSizeHint(Range&& range)
 		{
-			if (buffer.Num() == position) buffer.AddZeroed(chunks);
-			buffer[position] = value;
-			++position;
+			if constexpr (CCountableRange<Range>)
+				return static_cast<int32>(size(range));
+			else if constexpr (ranges::sized_range<Range>)
+				return static_cast<int32>(ranges::size(range));
+			else
+				return INDEX_NONE;
 		}
 
-		template <CStringOrView String>
-		void CopyStringToBufferUnsafe(String const& value, int32& position, TArray<TCHAR>& buffer)
+		/** @brief Make room for at least `count` elements in a container in total, when it supports that */
+		template <typename Target>
+		void ReserveFor(Target& target, int32 count)
 		{
-			FMemory::Memcpy(buffer.GetData() + position, GetData(value), value.Len() * sizeof(TCHAR));
-			position += value.Len();
+			if constexpr (CReservable<Target>)
+			{
+				if (count > 0) target.Reserve(count);
+			}
 		}
 
-		template <CStringOrView String>
-		void CopyStringItemToBuffer(String const& value, FString const& separator, int32 chunks, int32& position, TArray<TCHAR>& buffer)
+		/**
+		 *	@brief
+		 *	Add all the elements of a range to a container. Elements of owning containers passed as r-value are moved,
+		 *	r-value elements (like the output of transforms) are moved naturally, other elements are copied. Views are
+		 *	never moved from as they may refer to elements of other containers.
+		 */
+		template <typename Target, typename From>
+		void AppendRange(Target& target, From&& range)
 		{
-			int nextLength = value.Len() + separator.Len();
-				
-			if (buffer.Num() <= position + nextLength) buffer.AddZeroed(chunks);
-			if (!separator.IsEmpty())
-				CopyStringToBufferUnsafe(separator, position, buffer);
-			CopyStringToBufferUnsafe(value, position, buffer);
+			if constexpr (!std::is_lvalue_reference_v<From> && CUnrealRange<std::decay_t<From>>)
+			{
+				for (auto& value : range)
+					target.Add(MoveTempIfPossible(value));
+			}
+			else
+			{
+				for (auto&& value : range)
+					target.Add(FWD(value));
+			}
 		}
 	}
 
 	/**
-	 *	@brief  Render an input range as a string.
-	 *
-	 *	For ranges of any char type, the output is an uninterrupted string of them. Other char types than TCHAR will
-	 *	be converted to the encoding of the current TCHAR.
-	 *
-	 *	For ranges of strings and string-views individual items will be directly copy-appended to the output separated
-	 *	by `, ` (unless another separator sequence is set via `Separator`)
-	 *
-	 *	For anything else, `Mcro::Text::AsString` is used. In fact this function serves as the basis for `AsString` for
-	 *	any range type. Like for strings, any other type is separated by `, ` (unless another separator sequence is set
-	 *	via `Separator`). For convenience a piped version is also provided of this function.
+	 *	@brief
+	 *	A text output `RenderStringTo` can stream characters into, without collecting them into an intermediate string
+	 *	first. `FString`, `TStringBuilder` and `FArchiveStringSink` all satisfy it.
 	 */
-	template <CRangeMember Range>
-	FString RenderAsString(Range&& range)
+	template <typename T>
+	concept CStringSink = requires(T& sink, const TCHAR* characters, int32 length, TCHAR character)
 	{
-		using ElementType = TRangeElementType<Range>;
-		
-		if (IteratorEquals(range.begin(), range.end()))
-			return {};
+		sink.Append(characters, length);
+		sink.AppendChar(character);
+	};
 
-		constexpr int chunks = 16384;
-		int32 position = 0;
-		FRangeStringFormatOptions rangeFormatOptions;
-		
-		if constexpr (CIsTemplate<Range, Detail::TRangeWithStringFormat>)
-			rangeFormatOptions = range.Options;
+	/** @brief Stream rendered text into an archive encoded as UTF-8 */
+	struct FArchiveStringSink
+	{
+		FArchiveStringSink(FArchive& archive) : Archive(archive) {}
 
-		if constexpr (CChar<ElementType>)
+		void Append(const TCHAR* characters, int32 length)
 		{
-			TArray<ElementType> buffer;
-			for (ElementType const& character : range)
-				Detail::CopyCharactersToBuffer(character, chunks, position, buffer);
-			
-			if constexpr (CCurrentChar<ElementType>)
-				return FString::ConstructFromPtrSize(buffer.GetData(), position);
+			if (length <= 0) return;
+			auto converted = StringCast<UTF8CHAR>(characters, length);
+			Archive.Serialize(const_cast<UTF8CHAR*>(converted.Get()), converted.Length() * sizeof(UTF8CHAR));
+		}
+
+		void AppendChar(TCHAR character) { Append(&character, 1); }
+
+	private:
+		FArchive& Archive;
+	};
+
+	namespace Detail
+	{
+		template <typename Range>
+		decltype(auto) UnwrapStringFormat(Range&& range)
+		{
+			if constexpr (CIsTemplate<Range, TRangeWithStringFormat>)
+				return range.GetStorage();
 			else
+				return FWD(range);
+		}
+
+		/**
+		 *	@brief
+		 *	Guess how many characters rendering a range will take without iterating it. Only contiguous ranges of strings
+		 *	are measured exactly, as they can be cheaply iterated twice. Returns 0 when no reasonable guess can be made.
+		 */
+		template <typename Range>
+		int32 EstimateRenderedLength(Range const& range, FRangeStringFormatOptions const& options)
+		{
+			using ElementType = TRangeElementType<Range>;
+			auto&& storage = UnwrapStringFormat(range);
+			using Storage = decltype(storage);
+
+			int32 decorators = options.Start.Len() + options.End.Len();
+			if constexpr (CChar<ElementType>)
 			{
-				TStdStringView<ElementType> stringView(buffer.GetData(), position);
-				return UnrealConvert(stringView);
+				int32 count = GetSizeHint(storage);
+				return count > 0 ? count : 0;
 			}
+			else if constexpr (CStringOrView<ElementType> && CContiguousRange<Storage>)
+			{
+				int32 count = GetContiguousNum(storage);
+				if (count <= 0) return 0;
+				int32 length = decorators + (count - 1) * options.Separator.Len();
+				for (ElementType const& value : AsArrayView(storage))
+					length += value.Len();
+				return length;
+			}
+			else
+			{
+				int32 count = GetSizeHint(storage);
+				if (count <= 0) return 0;
+				constexpr int32 elementGuess = CStringOrView<ElementType> ? 16 : 8;
+				return decorators + count * (elementGuess + options.Separator.Len());
+			}
+		}
+
+		/** @brief Make room for `length` more characters in a sink, when it supports that */
+		template <CStringSink Sink>
+		void ReserveAdditional(Sink& sink, int32 length)
+		{
+			if (length <= 0) return;
+			if constexpr (requires { sink.Reserve(sink.Len() + length); })
+				sink.Reserve(sink.Len() + length);
+			else if constexpr (requires { sink.AddUninitialized(length); sink.RemoveSuffix(length); })
+			{
+				// String builders can only grow by adding characters, but they keep their capacity afterwards
+				sink.AddUninitialized(length);
+				sink.RemoveSuffix(length);
+			}
+		}
+
+		template <CStringSink Sink, CStringOrView String>
+		void AppendString(Sink& sink, String const& value)
+		{
+			if (!value.IsEmpty()) sink.Append(GetData(value), value.Len());
 		}
-		else if constexpr (CStringOrView<ElementType>)
+
+		template <CStringSink Sink, typename Value>
+		void AppendValueText(Sink& sink, Value const& value);
+
+		template <CStringSink Sink, typename Range>
+		void AppendRangeText(Sink& sink, Range&& range, FRangeStringFormatOptions const& options);
+
+		template <CStringSink Sink, typename Tuple, size_t... Indices>
+		void AppendTupleText(Sink& sink, Tuple const& tuple, std::index_sequence<Indices...>&&)
 		{
-			TArray<TCHAR> buffer;
-			for (auto it = range.begin(); !IteratorEquals(it, range.end()); ++it)
+			sink.Append(TEXT_"(", 1);
+			([&]
+			{
+				if constexpr (Indices > 0) sink.Append(TEXT_", ", 2);
+				AppendValueText(sink, GetItem<Indices>(tuple));
+			}(), ...);
+			sink.Append(TEXT_")", 1);
+		}
+
+		/**
+		 *	@brief
+		 *	Append the string representation of a single value to a sink. Strings, names, numbers, tuples and nested
+		 *	ranges are written directly, other types go through `AsFormatArgument`, which only creates a temporary string
+		 *	if the type itself can only provide one.
+		 */
+		template <CStringSink Sink, typename Value>
+		void AppendValueText(Sink& sink, Value const& value)
+		{
+			using Decayed = std::decay_t<Value>;
+			if constexpr (CStringOrView<Decayed>)
+				AppendString(sink, value);
+			else if constexpr (CCurrentCharPtr<Decayed> && std::is_pointer_v<Decayed>)
+			{
+				if (value) sink.Append(value, FCString::Strlen(value));
+			}
+			else if constexpr (CSameAs<Decayed, bool>)
+				value ? sink.Append(TEXT_"true", 4) : sink.Append(TEXT_"false", 5);
+			else if constexpr (std::is_integral_v<Decayed> && !CChar<Decayed>)
 			{
-				ElementType const& value = *it;
-				bool isFirst = IteratorEquals(it, range.begin());
-				Detail::CopyStringItemToBuffer(
-					value,
-					isFirst ? FString() : rangeFormatOptions.Separator,
-					chunks,
-					position, buffer
-				);
+				TStringBuilder<32> number;
+				if constexpr (std::is_signed_v<Decayed>)
+					number << static_cast<int64>(value);
+				else
+					number << static_cast<uint64>(value);
+				sink.Append(number.GetData(), number.Len());
+			}
+			else if constexpr (std::is_floating_point_v<Decayed>)
+			{
+				TStringBuilder<64> number;
+				number.Appendf(TEXT_"%f", static_cast<double>(value));
+				sink.Append(number.GetData(), number.Len());
+			}
+			else if constexpr (requires { value.AppendString(sink); })
+				value.AppendString(sink);
+			else if constexpr (requires(FStringBuilderBase& builder) { value.AppendString(builder); })
+			{
+				TStringBuilder<NAME_SIZE> name;
+				value.AppendString(name);
+				sink.Append(name.GetData(), name.Len());
+			}
+			else if constexpr (CTuple<Decayed>)
+				AppendTupleText(sink, value, TIndexSequenceForTuple<Decayed>());
+			else if constexpr (CRangeMember<Decayed> && !CHasToString<Decayed>)
+			{
+				if (!IteratorEquals(value.begin(), value.end()))
+					AppendRangeText(sink, value, {});
+			}
+			else
+			{
+				auto&& argument = AsFormatArgument(value);
+				if constexpr (CStringOrView<std::decay_t<decltype(argument)>>)
+					AppendString(sink, argument);
+				else if constexpr (CCurrentCharPtr<std::decay_t<decltype(argument)>>)
+					AppendValueText(sink, argument);
+				else
+					AppendString(sink, AsString(value));
 			}
-			FString output = FString::ConstructFromPtrSize(buffer.GetData(), position);
-			return rangeFormatOptions.Start + output + rangeFormatOptions.End;
 		}
-		else
+
+		template <CStringSink Sink, typename Range>
+		void AppendRangeText(Sink& sink, Range&& range, FRangeStringFormatOptions const& options)
 		{
-			TArray<TCHAR> buffer;
-			for (auto it = range.begin(); !IteratorEquals(it, range.end()); ++it)
+			using ElementType = TRangeElementType<Range>;
+
+			if constexpr (CChar<ElementType>)
 			{
-				ElementType const& value = *it;
-				FString valueString = AsString(value);
-
-				bool isFirst = IteratorEquals(it, range.begin());
-				Detail::CopyStringItemToBuffer(
-					valueString,
-					isFirst ? FString() : rangeFormatOptions.Separator,
-					chunks,
-					position, buffer
-				);
+				if constexpr (CCurrentChar<ElementType>)
+				{
+					for (ElementType const& character : range)
+						sink.AppendChar(character);
+				}
+				else
+				{
+					// Characters of other encodings may span multiple elements, so they're converted in one go
+					TArray<std::decay_t<ElementType>, TInlineAllocator<256>> buffer;
+					for (ElementType const& character : range)
+						buffer.Add(character);
+					auto converted = StringCast<TCHAR>(buffer.GetData(), buffer.Num());
+					sink.Append(converted.Get(), converted.Length());
+				}
+			}
+			else
+			{
+				AppendString(sink, options.Start);
+				bool isFirst = true;
+				for (auto&& value : range)
+				{
+					if (!isFirst) AppendString(sink, options.Separator);
+					isFirst = false;
+					AppendValueText(sink, value);
+				}
+				AppendString(sink, options.End);
 			}
-			FString output = FString::ConstructFromPtrSize(buffer.GetData(), position);
-			return rangeFormatOptions.Start + output + rangeFormatOptions.End;
 		}
 	}
 
+	/**
+	 *	@brief
+	 *	Render an input range as text directly into a string sink (like an `FString`, a `TStringBuilder`, or an
+	 *	`FArchive` via `FArchiveStringSink`), following the same rules as `RenderAsString`.
+	 *
+	 *	Room for the output is estimated and reserved up-front, and elements are written into the sink directly, so
+	 *	strings, names, numbers, tuples and nested ranges don't create temporary `FString`s. For empty ranges nothing
+	 *	is written. This is the preferred way to render large ranges in hot diagnostics code. For convenience a piped
+	 *	version is also provided of this function.
+	 *
+	 *	usage:
+	 *	@code
+	 *	TStringBuilder<1024> builder;
+	 *	myArray | Separator(TEXT_"\n") | RenderStringTo(builder);
+	 *
+	 *	FArchiveStringSink fileSink(*fileArchive);
+	 *	RenderStringTo(myArray, fileSink);
+	 *	@endcode
+	 */
+	template <CRangeMember Range, CStringSink Sink>
+	void RenderStringTo(Range&& range, Sink& sink)
+	{
+		if (IteratorEquals(range.begin(), range.end()))
+			return;
+
+		FRangeStringFormatOptions rangeFormatOptions;
+		if constexpr (CIsTemplate<Range, Detail::TRangeWithStringFormat>)
+			rangeFormatOptions = range.Options;
+
+		Detail::ReserveAdditional(sink, Detail::EstimateRenderedLength(range, rangeFormatOptions));
+		Detail::AppendRangeText(sink, FWD(range), rangeFormatOptions);
+	}
+
+	/** @brief Render an input range as UTF-8 text directly into an archive. */
+	template <CRangeMember Range>
+	void RenderStringTo(Range&& range, FArchive& archive)
+	{
+		FArchiveStringSink sink(archive);
+		RenderStringTo(FWD(range), sink);
+	}
+
+	template <typename Sink>
+	requires (CStringSink<Sink> || CDerivedFrom<Sink, FArchive>)
+	FORCEINLINE auto RenderStringTo(Sink& sink)
+	{
+		return ranges::make_pipeable([&sink] <CRangeMember Input> (Input&& range)
+		{
+			RenderStringTo(FWD(range), sink);
+		});
+	}
+
+	/**
+	 *	@brief  Render an input range as a string.
+	 *
+	 *	For ranges of any char type, the output is an uninterrupted string of them. Other char types than TCHAR will
+	 *	be converted to the encoding of the current TCHAR.
+	 *
+	 *	For ranges of strings and string-views individual items will be directly copy-appended to the output separated
+	 *	by `, ` (unless another separator sequence is set via `Separator`)
+	 *
+	 *	For anything else, `Mcro::Text::AsString` is used. In fact this function serves as the basis for `AsString` for
+	 *	any range type. Like for strings, any other type is separated by `, ` (unless another separator sequence is set
+	 *	via `Separator`). For convenience a piped version is also provided of this function.
+	 *
+	 *	This is implemented with `RenderStringTo`, use that directly to render into an existing string builder or
+	 *	archive instead.
+	 */
+	template <CRangeMember Range>
+	FString RenderAsString(Range&& range)
+	{
+		FString output;
+		RenderStringTo(FWD(range), output);
+		return output;
+	}
+
 	FORCEINLINE auto RenderAsString()
 	{
 		return ranges::make_pipeable([]<CRangeMember Input>(Input&& range)
@@ -249,13 +482,15 @@ namespace Mcro::Range
 			return RenderAsString(FWD(range));
 		});
 	}
-	
+
 	/**
 	 *	@brief  Render a range as the given container.
 	 *
 	 *	This functor will iterate over the entire input range and copy its values to the newly created container
-	 *	one-by-one with its `Add` function. If you want a more optimised way to do that use `OutputTo` where you can
-	 *	supply your own container as an l-value.
+	 *	one-by-one with its `Add` function. When the size of the input range is known without iterating it (for example
+	 *	transforms over Unreal containers) the result is reserved up-front. Elements of r-value containers are moved,
+	 *	and r-value containers which are already of the target type are simply moved into the result. If you want to
+	 *	reuse the allocation of a container between conversions use `OutputTo` with `EOutputMode::Reuse`.
 	 *
 	 *	usage:
 	 *	@code
@@ -279,10 +514,15 @@ namespace Mcro::Range
 		requires CUnrealRange<Target<Value>>
 		Target<Value> Convert(From&& range) const
 		{
-			Target<Value> result;
-			for (Value const& value : range)
-				result.Add(value);
-			return result;
+			if constexpr (!std::is_lvalue_reference_v<From> && CSameAsDecayed<From, Target<Value>>)
+				return MoveTemp(range);
+			else
+			{
+				Target<Value> result;
+				Detail::ReserveFor(result, Detail::GetSizeHint(range));
+				Detail::AppendRange(result, FWD(range));
+				return result;
+			}
 		}
 		
 	public:
@@ -301,12 +541,33 @@ namespace Mcro::Range
 		}
 	};
 
+	/** @brief How `OutputTo` treats the existing content of its target container */
+	enum class EOutputMode
+	{
+		/**
+		 *	@brief
+		 *	Assign existing items from the start, and add the rest of the input. Existing items beyond the size of the
+		 *	input are kept.
+		 */
+		Overwrite,
+
+		/**
+		 *	@brief
+		 *	Remove existing items but keep their allocation, and add the entire input. Use this for storage which is
+		 *	reused for the same purpose over and over again (like per-frame results), so it stops allocating once it
+		 *	has grown large enough.
+		 */
+		Reuse
+	};
+
 	/**
 	 *	@brief  Render a range to an already existing container.
 	 *
 	 *	This functor will iterate over the entire input range and copy its values to the given container one-by-one.
-	 *	Target container must expose iterators which allows modifying its content. If the input range has more items
-	 *	than the target container current size, then start using its `Add` function. 
+	 *	With `EOutputMode::Overwrite` (the default) target container must expose iterators which allows modifying its
+	 *	content. If the input range has more items than the target container current size, then start using its `Add`
+	 *	function. With `EOutputMode::Reuse` the target is emptied first without releasing its memory. In both cases
+	 *	the target is reserved up-front when the size of the input range is known.
 	 *
 	 *	usage:
 	 *	@code
@@ -330,10 +591,20 @@ namespace Mcro::Range
 	{
 		using ElementType = TRangeElementType<Target>;
 		Target& Storage;
+		EOutputMode Mode;
 
 		template <CRangeMember From, CConvertibleToDecayed<ElementType> Value = TRangeElementType<From>>
 		void Convert(From&& range)
 		{
+			if (Mode == EOutputMode::Reuse)
+			{
+				Storage.Reset();
+				Detail::ReserveFor(Storage, Detail::GetSizeHint(range));
+				Detail::AppendRange(Storage, FWD(range));
+				return;
+			}
+			
+			Detail::ReserveFor(Storage, Detail::GetSizeHint(range));
 			auto it = Storage.begin();
 			auto endIt = Storage.end(); 
 			for (Value const& value : range)
@@ -349,7 +620,7 @@ namespace Mcro::Range
 		}
 
 	public:
-		OutputTo(Target& target) : Storage(target) {}
+		OutputTo(Target& target, EOutputMode mode = EOutputMode::Overwrite) : Storage(target), Mode(mode) {}
 
 		template <CRangeMember From>
 		friend Target& operator | (From&& range, OutputTo&& functor)
@@ -359,12 +630,93 @@ namespace Mcro::Range
 		}
 	};
 
+	/**
+	 *	@brief
+	 *	A map key with its hash already computed, as the first element of tuples given to RenderAsMap or OutputToMap.
+	 *	Those add the entry with `AddByHash` instead of hashing the key again, and the key type of the resulting map is
+	 *	`K`. Use this when the hash is known anyway, for example carried over from another map, or cached next to the key
+	 *	(like `TTypeHash` for type keyed maps).
+	 */
+	template <typename K>
+	struct THashedKey
+	{
+		K Key;
+		uint32 Hash;
+	};
+
+	/** @brief Pair a map key with its precomputed hash, see THashedKey */
+	template <typename K>
+	THashedKey<std::decay_t<K>> WithKeyHash(K&& key, uint32 hash)
+	{
+		return { FWD(key), hash };
+	}
+
+	/** @brief Pair a map key with its hash computed via `GetTypeHash`, see THashedKey */
+	template <typename K>
+	THashedKey<std::decay_t<K>> WithKeyHash(K&& key)
+	{
+		const uint32 hash = GetTypeHash(key);
+		return { FWD(key), hash };
+	}
+
+	namespace Detail
+	{
+		template <typename T>
+		struct TMapKeyType_Struct { using Type = std::decay_t<T>; };
+
+		template <typename K>
+		struct TMapKeyType_Struct<THashedKey<K>> { using Type = K; };
+
+		/** @brief Key type of a map rendered from tuples starting with the given element type */
+		template <typename T>
+		using TMapKeyType = typename TMapKeyType_Struct<std::decay_t<T>>::Type;
+
+		template <typename T>
+		concept CHashedKey = CIsTemplate<std::decay_t<T>, THashedKey>;
+
+		/** @brief Tuples which can be added to a TMap<Key, Value> with their first two elements */
+		template <typename Tuple, typename Key, typename Value>
+		concept CMapEntryTupleFor = CTupleConvertsToArgs<Tuple, Key, Value>
+			|| (CTuple<Tuple> && GetSize<Tuple>() >= 2
+				&& CHashedKey<TTypeAt<0, std::decay_t<Tuple>>>
+				&& CConvertibleToDecayed<TTypeAtDecayed<1, std::decay_t<Tuple>>, Value>
+			)
+		;
+
+		/**
+		 *	@brief
+		 *	Add a key-value tuple to a map, moving its elements when the tuple is an r-value. References stored in
+		 *	the tuple (like the ones range-v3 zip yields) are not moved from.
+		 */
+		template <typename MapType, CTuple Tuple>
+		void AddTupleToMap(MapType& result, Tuple&& entry)
+		{
+			decltype(auto) key = GetItem<0>(FWD(entry));
+			decltype(auto) value = GetItem<1>(FWD(entry));
+			if constexpr (CHashedKey<decltype(key)>)
+				result.AddByHash(key.Hash, FWD(key).Key, FWD(value));
+			else
+				result.Add(FWD(key), FWD(value));
+		}
+
+		/** @brief Make room for the elements of a range in a map, on top of what it already has */
+		template <typename MapType, typename Range>
+		void ReserveMapFor(MapType& result, Range&& range)
+		{
+			const int32 count = GetSizeHint(range);
+			if (count > 0) result.Reserve(result.Num() + count);
+		}
+	}
+
 	/**
 	 *	@brief
 	 *	Render a range of tuples or range of ranges with at least 2 elements as a TMap.
 	 *
-	 *	This functor will iterate over the entire input range and copy its values to the newly created container
-	 *	one-by-one with its `Add` function.
+	 *	This functor will iterate over the entire input range and add its values to the newly created container
+	 *	one-by-one. The map is reserved up-front when the size of the input range is known. Keys and values are moved
+	 *	out of r-value owning containers (like a temporary TArray of pairs) and out of tuples yielded by value (like the
+	 *	output of transforms), otherwise they're copied. Tuples starting with a THashedKey are added by their
+	 *	precomputed hash.
 	 *
 	 *	When working with range-of-ranges then ranges which doesn't have at least two elements will be silently ignored.
 	 *
@@ -396,13 +748,22 @@ namespace Mcro::Range
 		template <
 			CRangeMember From,
 			CTuple Value = TRangeElementType<From>,
-			typename MapType = TMap<TTypeAtDecayed<0, Value>, TTypeAtDecayed<1, Value>>
+			typename MapType = TMap<Detail::TMapKeyType<TTypeAt<0, std::decay_t<Value>>>, TTypeAtDecayed<1, Value>>
 		>
 		requires (GetSize<Value>() >= 2)
 		static void Convert(From&& range, MapType& result)
 		{
-			for (Value const& value : range)
-				result.Add(GetItem<0>(value), GetItem<1>(value));
+			Detail::ReserveMapFor(result, range);
+			if constexpr (!std::is_lvalue_reference_v<From> && CUnrealRange<std::decay_t<From>>)
+			{
+				for (auto& value : range)
+					Detail::AddTupleToMap(result, MoveTemp(value));
+			}
+			else
+			{
+				for (auto&& value : range)
+					Detail::AddTupleToMap(result, FWD(value));
+			}
 		}
 		
 		template <
@@ -413,6 +774,7 @@ namespace Mcro::Range
 		>
 		static void Convert(From&& range, MapType& result)
 		{
+			Detail::ReserveMapFor(result, range);
 			for (InnerRange const& innerRange : range)
 			{
 				// TODO: support TMultiMap
@@ -429,7 +791,7 @@ namespace Mcro::Range
 		template <
 			CRangeMember From,
 			CTuple Value = TRangeElementType<From>,
-			typename MapType = TMap<TTypeAtDecayed<0, Value>, TTypeAtDecayed<1, Value>>
+			typename MapType = TMap<Detail::TMapKeyType<TTypeAt<0, std::decay_t<Value>>>, TTypeAtDecayed<1, Value>>
 		>
 		requires (GetSize<Value>() >= 2)
 		MapType Convert(From&& range) const
@@ -475,8 +837,8 @@ namespace Mcro::Range
 	 *	@brief
 	 *	Output a range of tuples or range of ranges with at least 2 elements to an already existing TMap.
 	 *
-	 *	This functor will iterate over the entire input range and copy its values to the existing TMap one-by-one with
-	 *	its `Add` function.
+	 *	This functor will iterate over the entire input range and add its values to the existing TMap one-by-one, the
+	 *	same way as RenderAsMap does (reserving, moving and adding by precomputed hashes).
 	 *
 	 *	When working with range-of-ranges then ranges which doesn't have at least two elements will be silently ignored.
 	 *
@@ -517,7 +879,7 @@ namespace Mcro::Range
 
 		template <
 			CRangeMember From,
-			CTupleConvertsToArgs<KeyType, ValueType> = TRangeElementType<From>
+			Detail::CMapEntryTupleFor<KeyType, ValueType> = TRangeElementType<From>
 		>
 		friend Target& operator | (From&& range, OutputToMap&& functor)
 		{
@@ -0,0 +1,347 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/StableSort.h"
+#include "Mcro/Ansi/ArenaAllocator.h"
+#include "Mcro/Range/Conversion.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include "range/v3/all.hpp"
+#include "Mcro/LibraryIncludes/End.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Sorting, grouping and deduplicating terminals for any range, producing Unreal containers. Their temporary working
+ *	storage is taken from an optional `Ansi::FArena`, so with a thread-local arena, recurring queries reuse the same
+ *	memory every frame (only the returned containers are allocated normally):
+ *
+ *	@code
+ *	static thread_local Ansi::FArena scratch;
+ *	TArray<AActor*> closest = actors
+ *		| TopK(8, [&](AActor* actor) { return FVector::DistSquared(actor->GetActorLocation(), origin); }, &scratch);
+ *	TArray<FItem> sorted = items | OrderBy([](FItem const& item) { return item.Priority; }, ESortOrder::Descending, &scratch);
+ *	@endcode
+ *
+ *	Elements are moved out of r-value owning containers, and copied otherwise. Integral and enum keys are sorted with
+ *	an LSD radix sort, other keys with a stable comparison sort using `operator <`.
+ */
+namespace Mcro::Range
+{
+	using namespace Mcro::Concepts;
+
+	/** @brief Direction of OrderBy and TopK */
+	enum class ESortOrder : uint8
+	{
+		Ascending,
+		Descending
+	};
+
+	namespace Detail
+	{
+		/** @brief Redirect container allocations on this thread to an arena, if one is given */
+		class FOptionalArenaScope
+		{
+		public:
+			FOptionalArenaScope(Ansi::FArena* arena)
+			{
+				if (arena) Scope.Emplace(*arena);
+			}
+
+		private:
+			TOptional<Ansi::FArenaScope> Scope;
+		};
+
+		template <typename Key>
+		concept CRadixSortKey = (std::is_integral_v<Key> && !std::is_same_v<Key, bool>) || std::is_enum_v<Key>;
+
+		/** @brief Map a key to unsigned bits with the same order */
+		template <CRadixSortKey Key>
+		uint64 ToRadixBits(Key key)
+		{
+			if constexpr (std::is_enum_v<Key>)
+				return ToRadixBits(static_cast<std::underlying_type_t<Key>>(key));
+			else
+			{
+				uint64 bits = static_cast<uint64>(static_cast<std::make_unsigned_t<Key>>(key));
+				if constexpr (std::is_signed_v<Key>)
+					bits ^= uint64(1) << (sizeof(Key) * 8 - 1);
+				return bits;
+			}
+		}
+
+		struct FRadixEntry
+		{
+			uint64 Bits;
+			int32 Index;
+		};
+
+		/**
+		 *	@brief
+		 *	Stable LSD radix sort by 8 bit digits, only sorting the lowest `keyBytes` bytes. Passes where every entry
+		 *	has the same digit are skipped, so small key ranges only pay for the digits they use.
+		 */
+		MCRO_API void RadixSort(TArray<FRadixEntry, Ansi::FArenaAllocator>& entries, int32 keyBytes);
+
+		template <typename KeyFunction, typename Value>
+		using TSortKey = std::decay_t<std::invoke_result_t<std::decay_t<KeyFunction> const&, Value const&>>;
+
+		/** @brief Collect the elements of a range into scratch storage */
+		template <CRangeMember Range>
+		auto Materialize(Range&& range)
+		{
+			TArray<TRangeElementType<Range>, Ansi::FArenaAllocator> items;
+			ReserveFor(items, GetSizeHint(range));
+			AppendRange(items, FWD(range));
+			return items;
+		}
+
+		/** @returns Indices of items in sorted order by their keys, equal keys keep their original order */
+		template <typename Item, typename KeyFunction>
+		TArray<int32, Ansi::FArenaAllocator> SortedIndices(
+			TArray<Item, Ansi::FArenaAllocator> const& items,
+			KeyFunction const& key,
+			ESortOrder order
+		) {
+			using FKey = TSortKey<KeyFunction, Item>;
+			TArray<int32, Ansi::FArenaAllocator> indices;
+			indices.SetNumUninitialized(items.Num());
+
+			if constexpr (CRadixSortKey<FKey>)
+			{
+				TArray<FRadixEntry, Ansi::FArenaAllocator> entries;
+				entries.SetNumUninitialized(items.Num());
+				for (int32 i = 0; i < items.Num(); ++i)
+				{
+					const uint64 bits = ToRadixBits(key(items[i]));
+					entries[i] = { order == ESortOrder::Ascending ? bits : ~bits, i };
+				}
+				RadixSort(entries, sizeof(FKey));
+				for (int32 i = 0; i < entries.Num(); ++i)
+					indices[i] = entries[i].Index;
+			}
+			else
+			{
+				TArray<FKey, Ansi::FArenaAllocator> keys;
+				keys.Reserve(items.Num());
+				for (int32 i = 0; i < items.Num(); ++i)
+				{
+					keys.Add(key(items[i]));
+					indices[i] = i;
+				}
+				if (order == ESortOrder::Ascending)
+					Algo::StableSort(indices, [&](int32 a, int32 b) { return keys[a] < keys[b]; });
+				else
+					Algo::StableSort(indices, [&](int32 a, int32 b) { return keys[b] < keys[a]; });
+			}
+			return indices;
+		}
+	}
+
+	/**
+	 *	@brief  Sort the elements of a range by a key into a new TArray. The sort is stable.
+	 *	@param      key  Function returning the key of an element
+	 *	@param    order  Ascending or descending order of keys
+	 *	@param  scratch  Optional arena for the working storage
+	 */
+	template <typename KeyFunction>
+	auto OrderBy(KeyFunction&& key, ESortOrder order = ESortOrder::Ascending, Ansi::FArena* scratch = nullptr)
+	{
+		return ranges::make_pipeable([key = FWD(key), order, scratch] <CRangeMember Input> (Input&& range)
+		{
+			using FValue = TRangeElementType<Input>;
+			TArray<FValue> result;
+			{
+				Detail::FOptionalArenaScope scope(scratch);
+				auto items = Detail::Materialize(FWD(range));
+				auto indices = Detail::SortedIndices(items, key, order);
+				result.Reserve(items.Num());
+				for (int32 index : indices)
+					result.Add(MoveTemp(items[index]));
+			}
+			return result;
+		});
+	}
+
+	/** @brief Sort the elements of a range by their own value into a new TArray, see OrderBy */
+	FORCEINLINE auto OrderBy(ESortOrder order = ESortOrder::Ascending, Ansi::FArena* scratch = nullptr)
+	{
+		return OrderBy([](auto const& value) -> decltype(auto) { return value; }, order, scratch);
+	}
+
+	/**
+	 *	@brief
+	 *	Select the K elements with the smallest (or with Descending order the largest) keys into a new TArray, sorted
+	 *	by their keys. Only K candidates are kept while iterating the input in a single pass, so this is O(N log K)
+	 *	instead of sorting the entire range. Ties are resolved in favor of earlier elements.
+	 *	
+	 *	@param        k  Maximum number of elements to return
+	 *	@param      key  Function returning the key of an element
+	 *	@param    order  Ascending selects the smallest keys, Descending selects the largest ones
+	 *	@param  scratch  Optional arena for the working storage
+	 */
+	template <typename KeyFunction>
+	auto TopK(int32 k, KeyFunction&& key, ESortOrder order = ESortOrder::Ascending, Ansi::FArena* scratch = nullptr)
+	{
+		return ranges::make_pipeable([k, key = FWD(key), order, scratch] <CRangeMember Input> (Input&& range)
+		{
+			using FValue = TRangeElementType<Input>;
+			using FKey = Detail::TSortKey<KeyFunction, FValue>;
+			struct FCandidate
+			{
+				FKey Key;
+				int64 Sequence;
+				FValue Value;
+			};
+
+			// Strict weak order where the "best" candidate is the smallest
+			auto better = [order](FCandidate const& l, FCandidate const& r)
+			{
+				if (order == ESortOrder::Ascending ? l.Key < r.Key : r.Key < l.Key) return true;
+				if (order == ESortOrder::Ascending ? r.Key < l.Key : l.Key < r.Key) return false;
+				return l.Sequence < r.Sequence;
+			};
+
+			// Unreal heaps keep the smallest element by the predicate on top, inverting it puts the worst on top
+			auto worse = [&better](FCandidate const& l, FCandidate const& r) { return better(r, l); };
+
+			TArray<FValue> result;
+			if (k <= 0) return result;
+			{
+				Detail::FOptionalArenaScope scope(scratch);
+
+				// A heap with the worst candidate on top
+				TArray<FCandidate, Ansi::FArenaAllocator> heap;
+				heap.Reserve(k);
+				int64 sequence = 0;
+				auto consider = [&](auto&& value)
+				{
+					FKey itemKey = key(value);
+					if (heap.Num() < k)
+					{
+						heap.HeapPush(FCandidate { MoveTemp(itemKey), sequence++, FWD(value) }, worse);
+						return;
+					}
+					if (order == ESortOrder::Ascending ? itemKey < heap.HeapTop().Key : heap.HeapTop().Key < itemKey)
+					{
+						heap.HeapPopDiscard(worse, EAllowShrinking::No);
+						heap.HeapPush(FCandidate { MoveTemp(itemKey), sequence, FWD(value) }, worse);
+					}
+					++sequence;
+				};
+
+				if constexpr (!std::is_lvalue_reference_v<Input> && CUnrealRange<std::decay_t<Input>>)
+				{
+					for (auto& value : range)
+						consider(MoveTemp(value));
+				}
+				else
+				{
+					for (auto&& value : range)
+						consider(FWD(value));
+				}
+
+				heap.Sort(better);
+				result.Reserve(heap.Num());
+				for (FCandidate& candidate : heap)
+					result.Add(MoveTemp(candidate.Value));
+			}
+			return result;
+		});
+	}
+
+	/** @brief Select the K smallest (or largest) elements by their own value, see TopK */
+	FORCEINLINE auto TopK(int32 k, ESortOrder order = ESortOrder::Ascending, Ansi::FArena* scratch = nullptr)
+	{
+		return TopK(k, [](auto const& value) -> decltype(auto) { return value; }, order, scratch);
+	}
+
+	/**
+	 *	@brief
+	 *	Keep only the first element for each distinct key into a new TArray, preserving their order.
+	 *	@param      key  Function returning the key of an element, it must be hashable with `GetTypeHash`
+	 *	@param  scratch  Optional arena for the set of keys seen so far
+	 */
+	template <typename KeyFunction>
+	auto Distinct(KeyFunction&& key, Ansi::FArena* scratch = nullptr)
+	{
+		return ranges::make_pipeable([key = FWD(key), scratch] <CRangeMember Input> (Input&& range)
+		{
+			using FValue = TRangeElementType<Input>;
+			using FKey = Detail::TSortKey<KeyFunction, FValue>;
+
+			TArray<FValue> result;
+			{
+				Detail::FOptionalArenaScope scope(scratch);
+				TAnsiArenaSet<FKey> seen;
+				const int32 sizeHint = Detail::GetSizeHint(range);
+				if (sizeHint > 0) seen.Reserve(sizeHint);
+
+				auto consider = [&](auto&& value)
+				{
+					bool alreadySeen = false;
+					seen.Add(key(value), &alreadySeen);
+					if (!alreadySeen) result.Add(FWD(value));
+				};
+
+				if constexpr (!std::is_lvalue_reference_v<Input> && CUnrealRange<std::decay_t<Input>>)
+				{
+					for (auto& value : range)
+						consider(MoveTemp(value));
+				}
+				else
+				{
+					for (auto&& value : range)
+						consider(FWD(value));
+				}
+			}
+			return result;
+		});
+	}
+
+	/** @brief Keep only the first of equal elements, see Distinct */
+	FORCEINLINE auto Distinct(Ansi::FArena* scratch = nullptr)
+	{
+		return Distinct([](auto const& value) -> decltype(auto) { return value; }, scratch);
+	}
+
+	/**
+	 *	@brief
+	 *	Group the elements of a range by a key into a `TMap<Key, TArray<Element>>`. Groups are in the order their
+	 *	keys first appear, and elements of a group keep their order.
+	 *	@param  key  Function returning the key of an element, it must be hashable with `GetTypeHash`
+	 */
+	template <typename KeyFunction>
+	auto GroupBy(KeyFunction&& key)
+	{
+		return ranges::make_pipeable([key = FWD(key)] <CRangeMember Input> (Input&& range)
+		{
+			using FValue = TRangeElementType<Input>;
+			using FKey = Detail::TSortKey<KeyFunction, FValue>;
+
+			TMap<FKey, TArray<FValue>> result;
+			if constexpr (!std::is_lvalue_reference_v<Input> && CUnrealRange<std::decay_t<Input>>)
+			{
+				for (auto& value : range)
+					result.FindOrAdd(key(value)).Add(MoveTemp(value));
+			}
+			else
+			{
+				for (auto&& value : range)
+					result.FindOrAdd(key(value)).Add(FWD(value));
+			}
+			return result;
+		});
+	}
+}
@@ -406,6 +406,10 @@ namespace Mcro::Range
 	 *	@brief
 	 *	Allows range-v3 and std::ranges to iterate over temporary string objects and keep the string alive during view
 	 *	and action operators.
+	 *
+	 *	@remarks
+	 *	This moves the string into a shared storage which needs an extra allocation for each temporary string. Prefer
+	 *	`Mcro::Range::AsOwningView` in pipelines, which keeps the string inline and iterates it with raw pointers.
 	 */
 	struct MCRO_API FTempStringIterator : std::random_access_iterator_tag
 	{
@@ -0,0 +1,220 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Error.h"
+#include "Mcro/Range/Contiguous.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include "range/v3/all.hpp"
+#include "Mcro/LibraryIncludes/End.h"
+
+#include <cstring>
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ *	@file
+ *	@brief
+ *	Ranges reading directly from memory-mapped files, so huge files can be processed with range views without reading
+ *	them into memory first. Mapped pages are backed by the file, the OS can evict them as soon as they're not needed
+ *	anymore, so memory usage stays bounded regardless of the size of the file.
+ *
+ *	@code
+ *	auto lines = MappedFileLines(FPaths::ProjectLogDir() / TEXT_"Game.log");
+ *	if (lines.HasError()) return lines.GetErrorRef();
+ *
+ *	int64 warnings = lines.GetValue() | CountIf([](FUtf8StringView line) { return line.Contains("Warning:"); });
+ *
+ *	// Split into sub-ranges at line boundaries for parallel processing
+ *	lines.GetValue().Split(16) | ParallelForEach([](FMappedFileLines const& part) { for (FUtf8StringView line : part) ... });
+ *
+ *	// Fixed size records are contiguous, so they work with ParallelChunks directly
+ *	auto samples = MappedFileRecords<FSample>(path);
+ *	samples.GetValue() | ParallelChunks(4096, [](TArrayView<const FSample> chunk) { ... });
+ *	@endcode
+ */
+namespace Mcro::Range
+{
+	/** @brief How the mapped file is going to be accessed, forwarded to the OS as a paging hint where supported */
+	enum class EMappedFileAccess : uint8
+	{
+		/** @brief Mostly front-to-back, pages ahead are read eagerly and pages behind are released early */
+		Sequential,
+
+		/** @brief Unpredictable, don't read ahead */
+		Random,
+
+		/** @brief No hint, leave the default behavior of the OS */
+		Normal
+	};
+
+	/**
+	 *	@brief
+	 *	Read-only contents of a memory-mapped file, shared between the ranges reading it. When the platform can't map
+	 *	files (or the file is empty) the contents are read into memory instead.
+	 */
+	class MCRO_API FMappedFile : public FNoncopyable
+	{
+	public:
+		static Mcro::Error::TMaybe<TSharedRef<const FMappedFile>> Open(FString const& path, EMappedFileAccess access = EMappedFileAccess::Sequential);
+
+		~FMappedFile();
+
+		/** @brief The contents of the file */
+		TArrayView64<const uint8> GetBytes() const { return Contents; }
+
+		/** @brief Whether the contents are mapped from the file instead of being read into memory */
+		bool IsMapped() const { return Region.IsValid(); }
+
+	private:
+		FMappedFile();
+
+		TUniquePtr<IMappedFileHandle> File;
+		TUniquePtr<IMappedFileRegion> Region;
+		TArray64<uint8> Owned;
+		TArrayView64<const uint8> Contents;
+	};
+
+	/**
+	 *	@brief
+	 *	A range of the lines of a mapped text file, as UTF-8 string views pointing into the mapping. Lines are
+	 *	separated by `\n`, a `\r` before it is not included in the line. A trailing line separator doesn't produce an
+	 *	extra empty line, and a UTF-8 BOM at the start of the file is skipped.
+	 */
+	class MCRO_API FMappedFileLines : public ranges::view_base
+	{
+	public:
+		class FIterator
+		{
+		public:
+			using value_type = FUtf8StringView;
+			using reference = FUtf8StringView;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::forward_iterator_tag;
+
+			FIterator() = default;
+			FIterator(const UTF8CHAR* current, const UTF8CHAR* end) : Current(current), End(end)
+			{
+				FindLineEnd();
+			}
+
+			FUtf8StringView operator * () const
+			{
+				const UTF8CHAR* lineEnd = LineEnd > Current && LineEnd[-1] == '\r' ? LineEnd - 1 : LineEnd;
+				return FUtf8StringView(Current, static_cast<int32>(lineEnd - Current));
+			}
+
+			FIterator& operator ++ ()
+			{
+				Current = LineEnd < End ? LineEnd + 1 : End;
+				FindLineEnd();
+				return *this;
+			}
+
+			FIterator operator ++ (int)
+			{
+				FIterator result = *this;
+				++*this;
+				return result;
+			}
+
+			friend bool operator == (FIterator const& lhs, FIterator const& rhs) { return lhs.Current == rhs.Current; }
+			friend bool operator != (FIterator const& lhs, FIterator const& rhs) { return lhs.Current != rhs.Current; }
+
+		private:
+			void FindLineEnd()
+			{
+				const void* newLine = Current < End ? std::memchr(Current, '\n', static_cast<size_t>(End - Current)) : nullptr;
+				LineEnd = newLine ? static_cast<const UTF8CHAR*>(newLine) : End;
+			}
+
+			const UTF8CHAR* Current = nullptr;
+			const UTF8CHAR* LineEnd = nullptr;
+			const UTF8CHAR* End = nullptr;
+		};
+
+		FMappedFileLines() = default;
+		FMappedFileLines(TSharedRef<const FMappedFile> const& file);
+
+		FIterator begin() const { return FIterator(Begin, End); }
+		FIterator end() const { return FIterator(End, End); }
+
+		/** @brief Size of the text covered by this range in bytes */
+		int64 NumBytes() const { return End - Begin; }
+
+		/**
+		 *	@brief
+		 *	Split this range into at most `count` consecutive ranges of roughly the same size in bytes. Boundaries are
+		 *	moved to the start of the next line, so every line is in exactly one of the results. The results keep the
+		 *	file mapped, they can be processed on any thread.
+		 */
+		TArray<FMappedFileLines> Split(int32 count) const;
+
+	private:
+		FMappedFileLines(TSharedPtr<const FMappedFile> const& file, const UTF8CHAR* begin, const UTF8CHAR* end)
+			: File(file), Begin(begin), End(end)
+		{}
+
+		TSharedPtr<const FMappedFile> File;
+		const UTF8CHAR* Begin = nullptr;
+		const UTF8CHAR* End = nullptr;
+	};
+
+	/**
+	 *	@brief
+	 *	A contiguous range of trivially copyable records stored back to back in a mapped file, read in place. Trailing
+	 *	bytes not making up a whole record are ignored. The records are in the byte order of the file, it is up to the
+	 *	caller to make sure it matches the platform.
+	 */
+	template <typename T>
+	class TMappedFileRecords : public ranges::view_base
+	{
+		static_assert(std::is_trivially_copyable_v<T>, "Mapped records are read in place, they must be trivially copyable");
+		static_assert(alignof(T) <= 16, "Mapped records can be aligned to at most 16 bytes");
+
+	public:
+		TMappedFileRecords() = default;
+		TMappedFileRecords(TSharedRef<const FMappedFile> const& file)
+			: File(file)
+			, Data(reinterpret_cast<const T*>(file->GetBytes().GetData()))
+			, Count(file->GetBytes().Num() / static_cast<int64>(sizeof(T)))
+		{}
+
+		const T* begin() const { return Data; }
+		const T* end() const { return Data + Count; }
+		size_t size() const { return static_cast<size_t>(Count); }
+		const T* GetData() const { return Data; }
+		int64 Num() const { return Count; }
+
+		T const& operator [] (int64 index) const { return Data[index]; }
+
+	private:
+		TSharedPtr<const FMappedFile> File;
+		const T* Data = nullptr;
+		int64 Count = 0;
+	};
+
+	/** @brief Open a text file as a range of its lines, see FMappedFileLines */
+	MCRO_API Mcro::Error::TMaybe<FMappedFileLines> MappedFileLines(FString const& path, EMappedFileAccess access = EMappedFileAccess::Sequential);
+
+	/** @brief Open a binary file as a contiguous range of records, see TMappedFileRecords */
+	template <typename T>
+	Mcro::Error::TMaybe<TMappedFileRecords<T>> MappedFileRecords(FString const& path, EMappedFileAccess access = EMappedFileAccess::Sequential)
+	{
+		auto file = FMappedFile::Open(path, access);
+		if (file.HasError()) return file.GetErrorRef();
+		return TMappedFileRecords<T>(file.GetValue());
+	}
+}
@@ -0,0 +1,175 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Mcro/Macros.h"
+#include "Mcro/TextMacros.h"
+#include "Mcro/Range/Iterators.h"
+#include "Mcro/Range/Contiguous.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include "range/v3/all.hpp"
+#include "Mcro/LibraryIncludes/End.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Parallel terminal operations for random-access ranges, splitting the work over ParallelFor. The input range (and
+ *	every function used in its pipeline, like the ones given to `views::transform`) must be safe to read from multiple
+ *	threads at the same time. The order of the output is the same as the order of the input.
+ */
+namespace Mcro::Range
+{
+	using namespace Mcro::Concepts;
+
+	/** @brief Ranges which can be processed in parallel, they need to be random-access and know their size */
+	template <typename T>
+	concept CParallelRange = CRangeMember<T> && (
+		requires(T& range) { GetData(range); GetNum(range); }
+		|| (ranges::random_access_range<T> && ranges::sized_range<T>)
+	);
+
+	namespace Detail
+	{
+		template <CParallelRange Range>
+		int32 GetParallelRangeNum(Range& range)
+		{
+			if constexpr (requires { GetNum(range); }) return GetNum(range);
+			else return static_cast<int32>(ranges::size(range));
+		}
+
+		template <CParallelRange Range>
+		decltype(auto) GetParallelRangeItem(Range& range, int32 index)
+		{
+			if constexpr (requires { GetData(range); }) return GetData(range)[index];
+			else return ranges::begin(range)[index];
+		}
+	}
+
+	/**
+	 *	@brief  Execute a function for each element of a random-access range in parallel.
+	 *
+	 *	usage:
+	 *	@code
+	 *	using namespace ranges;
+	 *	MyActors
+	 *		| views::transform([](AActor* actor) { return actor->GetActorLocation(); })
+	 *		| ParallelForEach([&](FVector const& location) { ... });
+	 *	@endcode
+	 *
+	 *	@param function      Called with each element, from multiple threads
+	 *	@param minBatchSize  Minimum number of consecutive elements processed by a single task
+	 */
+	template <typename Function>
+	auto ParallelForEach(Function&& function, int32 minBatchSize = 64)
+	{
+		return ranges::make_pipeable([function = FWD(function), minBatchSize] <CParallelRange Input> (Input&& range)
+		{
+			int32 num = Detail::GetParallelRangeNum(range);
+			ParallelFor(TEXT_"Mcro::Range::ParallelForEach", num, FMath::Max(minBatchSize, 1), [&](int32 index)
+			{
+				function(Detail::GetParallelRangeItem(range, index));
+			});
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Split a contiguous range into TArrayView slices of `chunkSize` elements, and call a function with each slice in
+	 *	parallel. The function may also take the index of the slice as its second argument.
+	 *
+	 *	usage:
+	 *	@code
+	 *	MyParticles | ParallelChunks(1024, [](TArrayView<FParticle> chunk)
+	 *	{
+	 *		for (FParticle& particle : chunk) particle.Integrate();
+	 *	});
+	 *	@endcode
+	 *	
+	 *	@param chunkSize  Number of consecutive elements processed by a single task (the last one may get less)
+	 *	@param function   Called with each slice, from multiple threads
+	 */
+	template <typename Function>
+	auto ParallelChunks(int32 chunkSize, Function&& function)
+	{
+		return ranges::make_pipeable([function = FWD(function), chunkSize] <CContiguousRange Input> (Input&& range)
+		{
+			auto* data = GetContiguousData(range);
+			auto layout = Detail::FSliceLayout::Chunks(static_cast<int32>(GetContiguousNum(range)), chunkSize);
+			ParallelFor(TEXT_"Mcro::Range::ParallelChunks", layout.Count, 1, [&](int32 index)
+			{
+				if constexpr (std::is_invocable_v<Function, decltype(layout.GetSlice(data, 0)), int32>)
+					function(layout.GetSlice(data, index), index);
+				else
+					function(layout.GetSlice(data, index));
+			});
+		});
+	}
+
+	/**
+	 *	@brief  Render a random-access range as the given array-like container in parallel.
+	 *
+	 *	Elements are evaluated and constructed at their final place on multiple threads, the order of elements is
+	 *	preserved.
+	 *
+	 *	usage:
+	 *	@code
+	 *	using namespace ranges;
+	 *	auto result = MyAssets
+	 *		| views::transform([](FAssetData const& asset) { return ExpensiveDigest(asset); })
+	 *		| ParallelRenderAs<TArray>();
+	 *	@endcode
+	 *
+	 *	@tparam Target
+	 *	An Unreal array-like container template which has `AddUninitialized` and `GetData`, the element-type of which will
+	 *	be deduced from the input left side range.
+	 */
+	template <template <typename> typename Target>
+	class ParallelRenderAs
+	{
+		int32 MinBatchSize;
+
+		template <CParallelRange From, typename Value = TRangeElementType<From>>
+		requires requires(Target<Value>& target) { target.AddUninitialized(1); target.GetData(); }
+		Target<Value> Convert(From&& range) const
+		{
+			int32 num = Detail::GetParallelRangeNum(range);
+			Target<Value> result;
+			result.AddUninitialized(num);
+			Value* output = result.GetData();
+			ParallelFor(TEXT_"Mcro::Range::ParallelRenderAs", num, FMath::Max(MinBatchSize, 1), [&](int32 index)
+			{
+				new (output + index) Value(Detail::GetParallelRangeItem(range, index));
+			});
+			return result;
+		}
+
+	public:
+		/** @param minBatchSize  Minimum number of consecutive elements processed by a single task */
+		ParallelRenderAs(int32 minBatchSize = 64) : MinBatchSize(minBatchSize) {}
+
+		template <CParallelRange From>
+		friend auto operator | (From&& range, ParallelRenderAs&& functor)
+		{
+			return functor.Convert(FWD(range));
+		}
+
+		template <CParallelRange From>
+		auto Render(From&& range) const
+		{
+			return Convert(FWD(range));
+		}
+	};
+}
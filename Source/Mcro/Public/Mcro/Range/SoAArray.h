@@ -0,0 +1,280 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/Tuples.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include "range/v3/all.hpp"
+#include "Mcro/LibraryIncludes/End.h"
+
+namespace Mcro::Range
+{
+	using namespace Mcro::Concepts;
+	using namespace Mcro::Tuples;
+
+	namespace Detail
+	{
+		template <typename T>
+		constexpr uint32 SoAFieldAlignment = alignof(T) > PLATFORM_CACHE_LINE_SIZE ? alignof(T) : PLATFORM_CACHE_LINE_SIZE;
+
+		template <typename T>
+		using TSoAField = TArray<T, TAlignedHeapAllocator<SoAFieldAlignment<T>>>;
+	}
+
+	/**
+	 *	@brief
+	 *	A structure-of-arrays container, where each field is stored in its own contiguous array aligned to at least
+	 *	a cache line. Elements are addressed by a common index across all fields.
+	 *
+	 *	Use `Field` to get a `TArrayView` over a single column (for example to hand it to an ISPC or SIMD kernel),
+	 *	`Each` to get a range of tuples of references, which works with `TransformTuple`, `FilterTuple` and the rest of
+	 *	the tuple range views, or `ForEach` for a plain indexed loop over all fields.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	TSoAArray<FVector3f, FVector3f, float> particles;
+	 *	particles.Add(FVector3f::ZeroVector, FVector3f::UpVector, 1.f);
+	 *
+	 *	particles.ForEach([&](FVector3f& position, FVector3f const& velocity, float lifetime)
+	 *	{
+	 *		position += velocity * deltaTime;
+	 *	});
+	 *	TArrayView<float> lifetimes = particles.Field<2>();
+	 *
+	 *	auto alive = particles.Each()
+	 *		| FilterTuple([](FVector3f const&, FVector3f const&, float lifetime) { return lifetime > 0.f; })
+	 *	;
+	 *	@endcode
+	 *
+	 *	@warning
+	 *	Views and references acquired from this container are invalidated by any operation changing the number of
+	 *	elements or the capacity.
+	 *
+	 *	@tparam Fields  Types of the fields of a logical element
+	 */
+	template <typename... Fields>
+	class TSoAArray
+	{
+		static_assert(sizeof...(Fields) > 0, "A structure-of-arrays needs at least one field");
+		static_assert((CSameAs<Fields, std::decay_t<Fields>> && ...), "Fields must be plain value types");
+
+		template <typename T, size_t... Indices>
+		static consteval int32 FindIndex(std::index_sequence<Indices...>&&)
+		{
+			int32 result = INDEX_NONE;
+			((result = result == INDEX_NONE && CSameAs<T, Fields> ? static_cast<int32>(Indices) : result), ...);
+			return result;
+		}
+
+	public:
+		using FStorage = TTuple<Detail::TSoAField<Fields>...>;
+		using FReference = TTuple<Fields&...>;
+		using FConstReference = TTuple<Fields const&...>;
+
+		/** @brief Number of fields */
+		static constexpr int32 FieldCount = sizeof...(Fields);
+
+		/** @brief Index of the field with type T, or INDEX_NONE */
+		template <typename T>
+		static constexpr int32 IndexOf = FindIndex<T>(std::index_sequence_for<Fields...>());
+
+		/** @brief Can a field be addressed unambiguously by its type */
+		template <typename T>
+		static constexpr bool HasUnique = (0 + ... + (CSameAs<T, Fields> ? 1 : 0)) == 1;
+
+		TSoAArray() = default;
+
+		/** @brief Number of elements */
+		int32 Num() const { return Storage.template Get<0>().Num(); }
+
+		/** @brief Is this container empty */
+		bool IsEmpty() const { return Num() == 0; }
+
+		/** @brief Is given index addressing an existing element */
+		bool IsValidIndex(int32 index) const { return index >= 0 && index < Num(); }
+
+		/** @brief Reserve memory for the given number of elements in all fields */
+		void Reserve(int32 count)
+		{
+			ForEachField([count](auto& field) { field.Reserve(count); });
+		}
+
+		/** @brief Remove all elements, keeping the allocated memory */
+		void Reset()
+		{
+			ForEachField([](auto& field) { field.Reset(); });
+		}
+
+		/** @brief Remove all elements, optionally keeping memory for the given number of elements */
+		void Empty(int32 slack = 0)
+		{
+			ForEachField([slack](auto& field) { field.Empty(slack); });
+		}
+
+		/** @brief Resize all fields, new elements are default constructed */
+		void SetNum(int32 count)
+			requires (CDefaultInitializable<Fields> && ...)
+		{
+			ForEachField([count](auto& field) { field.SetNum(count); });
+		}
+
+		/**
+		 *	@brief  Add a new element constructing each field from the argument at the same position
+		 *	@return The index of the new element
+		 */
+		template <typename... Args>
+		requires (sizeof...(Args) == sizeof...(Fields) && (CConstructibleFrom<Fields, Args> && ...))
+		int32 Add(Args&&... args)
+		{
+			int32 index = Num();
+			[&, this] <size_t... Indices> (std::index_sequence<Indices...>&&)
+			{
+				(Storage.template Get<Indices>().Emplace(FWD(args)), ...);
+			}(std::index_sequence_for<Fields...>());
+			return index;
+		}
+
+		/** @brief Add a default constructed element and return its index */
+		int32 AddDefaulted()
+			requires (CDefaultInitializable<Fields> && ...)
+		{
+			int32 index = Num();
+			ForEachField([](auto& field) { field.AddDefaulted(); });
+			return index;
+		}
+
+		/** @brief Remove an element by moving the last one in its place. This doesn't preserve order */
+		void RemoveAtSwap(int32 index)
+		{
+			ForEachField([index](auto& field) { field.RemoveAtSwap(index, EAllowShrinking::No); });
+		}
+
+		/** @brief Remove an element and shift the following ones, preserving order */
+		void RemoveAt(int32 index)
+		{
+			ForEachField([index](auto& field) { field.RemoveAt(index, EAllowShrinking::No); });
+		}
+
+		/** @brief Get references to all fields of the element at given index */
+		FReference operator [] (int32 index)
+		{
+			return GetElement<FReference>(Storage, index, std::index_sequence_for<Fields...>());
+		}
+
+		/** @copydoc operator[] */
+		FConstReference operator [] (int32 index) const
+		{
+			return GetElement<FConstReference>(Storage, index, std::index_sequence_for<Fields...>());
+		}
+
+		/** @brief View of a single field of all elements. The view starts at an address aligned to a cache line */
+		template <size_t I>
+		requires (I < sizeof...(Fields))
+		auto Field() { return MakeArrayView(Storage.template Get<I>()); }
+
+		/** @copydoc Field */
+		template <size_t I>
+		requires (I < sizeof...(Fields))
+		auto Field() const { return MakeArrayView(Storage.template Get<I>()); }
+
+		/** @brief View of a single field of all elements, addressed by its type */
+		template <typename T>
+		requires HasUnique<T>
+		TArrayView<T> Field() { return Field<IndexOf<T>>(); }
+
+		/** @copydoc Field */
+		template <typename T>
+		requires HasUnique<T>
+		TArrayView<const T> Field() const { return Field<IndexOf<T>>(); }
+
+		/**
+		 *	@brief
+		 *	A range of tuples of references to the fields of each element. It is compatible with the tuple range views
+		 *	like `TransformTuple` or `FilterTuple`, and with structured bindings in range based for loops.
+		 */
+		auto Each()
+		{
+			return EachImpl(*this, std::index_sequence_for<Fields...>());
+		}
+
+		/** @copydoc Each */
+		auto Each() const
+		{
+			return EachImpl(*this, std::index_sequence_for<Fields...>());
+		}
+
+		/**
+		 *	@brief
+		 *	Call a function with references to the fields of each element, in order. This is a plain indexed loop over
+		 *	the field pointers, so it is friendlier to the optimizer than iterating `Each`.
+		 */
+		template <typename Function>
+		requires CInvocable<Function, Fields&...>
+		void ForEach(Function&& function)
+		{
+			ForEachImpl(*this, function, std::index_sequence_for<Fields...>());
+		}
+
+		/** @copydoc ForEach */
+		template <typename Function>
+		requires CInvocable<Function, Fields const&...>
+		void ForEach(Function&& function) const
+		{
+			ForEachImpl(*this, function, std::index_sequence_for<Fields...>());
+		}
+
+		/** @brief Direct access to the underlying arrays */
+		FStorage& GetStorage() { return Storage; }
+
+		/** @copydoc GetStorage */
+		FStorage const& GetStorage() const { return Storage; }
+
+	private:
+		FStorage Storage;
+
+		template <typename Function>
+		void ForEachField(Function&& function)
+		{
+			[&, this] <size_t... Indices> (std::index_sequence<Indices...>&&)
+			{
+				(function(Storage.template Get<Indices>()), ...);
+			}(std::index_sequence_for<Fields...>());
+		}
+
+		template <typename Result, typename Self, size_t... Indices>
+		static Result GetElement(Self& storage, int32 index, std::index_sequence<Indices...>&&)
+		{
+			return Result(storage.template Get<Indices>()[index]...);
+		}
+
+		template <typename Self, size_t... Indices>
+		static auto EachImpl(Self& self, std::index_sequence<Indices...>&&)
+		{
+			return ranges::views::zip(ranges::make_subrange(
+				self.Storage.template Get<Indices>().GetData(),
+				self.Storage.template Get<Indices>().GetData() + self.Num()
+			)...);
+		}
+
+		template <typename Self, typename Function, size_t... Indices>
+		static void ForEachImpl(Self& self, Function& function, std::index_sequence<Indices...>&&)
+		{
+			auto data = MakeTuple(self.Storage.template Get<Indices>().GetData()...);
+			const int32 num = self.Num();
+			for (int32 i = 0; i < num; ++i)
+				function(data.template Get<Indices>()[i]...);
+		}
+	};
+}
@@ -13,6 +13,7 @@
 
 #include "CoreMinimal.h"
 #include "Mcro/Range/Iterators.h"
+#include "Mcro/Range/Contiguous.h"
 
 #include "Mcro/LibraryIncludes/Start.h"
 #include "range/v3/all.hpp"
@@ -26,6 +27,45 @@ namespace Mcro::Range
 	template <typename T>
 	decltype(auto) Literal(std::initializer_list<T>&& input) { return FWD(input); }
 
+	/**
+	 *	@brief
+	 *	A view which owns a string given to it as an r-value. The string is stored inline in the view object, and it is
+	 *	iterated with raw `const TCHAR*` pointers, so pipelines over temporary strings don't need any extra allocation
+	 *	(unlike the `FTempStringIterator` which `begin(FString&&)` returns) and they can be optimized like any other
+	 *	contiguous range. Copying the view copies the string, moving it keeps existing iterators valid.
+	 *
+	 *	usage:
+	 *	@code
+	 *	auto upper = AsOwningView(GetSomeString())
+	 *		| views::transform([](TCHAR c) { return FChar::ToUpper(c); })
+	 *		| RenderAsString();
+	 *	@endcode
+	 */
+	class FOwningStringView : public ranges::view_base
+	{
+	public:
+		FOwningStringView() = default;
+		explicit FOwningStringView(FString&& string) : Storage(MoveTemp(string)) {}
+
+		auto begin()   const -> const TCHAR* { return *Storage; }
+		auto end()     const -> const TCHAR* { return *Storage + Storage.Len(); }
+		auto size()    const -> size_t       { return static_cast<size_t>(Storage.Len()); }
+		auto GetData() const -> const TCHAR* { return *Storage; }
+		auto Num()     const -> int32        { return Storage.Len(); }
+
+		/** @brief Give up ownership of the string */
+		FString Release() && { return MoveTemp(Storage); }
+
+	private:
+		FString Storage;
+	};
+
+	/** @brief Take ownership of a temporary string to use it as a view in pipelines. */
+	FORCEINLINE FOwningStringView AsOwningView(FString&& string)
+	{
+		return FOwningStringView(MoveTemp(string));
+	}
+
 	/** @brief pipeable version of `ranges::views::zip` */
 	template <CRangeMember... Ranges>
 	auto Zip(Ranges&&...right)
@@ -46,6 +86,83 @@ namespace Mcro::Range
 		});
 	}
 
+	namespace Detail
+	{
+		template <typename Input>
+		auto SliceView(Input&& range, FSliceLayout const& layout)
+		{
+			static_assert(std::is_lvalue_reference_v<Input> || !CUnrealRange<std::decay_t<Input>>,
+				"Slices of a temporary container would outlive it."
+			);
+			auto* data = GetContiguousData(range);
+			return ranges::views::iota(0, layout.Count)
+				| ranges::views::transform([data, layout](int32 index) { return layout.GetSlice(data, index); });
+		}
+	}
+
+	/**
+	 *	@brief
+	 *	View a contiguous range as consecutive TArrayView slices of `chunkSize` elements (the last one may be smaller)
+	 *	without copying. Useful for cache-blocked processing. The result is a random-access range, so it can be
+	 *	further piped into `ParallelForEach` for example.
+	 *
+	 *	@code
+	 *	for (TArrayView<FVector> block : MyLocations | Chunk(256))
+	 *		ProcessBlock(block);
+	 *	@endcode
+	 */
+	template <CContiguousRange Input>
+	auto Chunk(Input&& range, int32 chunkSize)
+	{
+		return Detail::SliceView(FWD(range), Detail::FSliceLayout::Chunks(static_cast<int32>(GetContiguousNum(range)), chunkSize));
+	}
+
+	/** @copydoc Chunk */
+	FORCEINLINE auto Chunk(int32 chunkSize)
+	{
+		return ranges::make_pipeable([chunkSize] <CContiguousRange Input> (Input&& range)
+		{
+			return Chunk(FWD(range), chunkSize);
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	View a contiguous range as `count` consecutive TArrayView slices of nearly equal size without copying. If the
+	 *	range has less elements than `count`, then each slice has a single element.
+	 */
+	template <CContiguousRange Input>
+	auto Batch(Input&& range, int32 count)
+	{
+		return Detail::SliceView(FWD(range), Detail::FSliceLayout::Batches(static_cast<int32>(GetContiguousNum(range)), count));
+	}
+
+	/** @copydoc Batch */
+	FORCEINLINE auto Batch(int32 count)
+	{
+		return ranges::make_pipeable([count] <CContiguousRange Input> (Input&& range)
+		{
+			return Batch(FWD(range), count);
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Call a function with every element of multiple ranges one after the other, same as iterating
+	 *	`left | Concat(right...)`. Unlike iterating a concatenated view, which has to dispatch on the currently active
+	 *	range for every element, this runs a separate loop for each input range, so each of them is compiled for its
+	 *	own concrete iterator type.
+	 */
+	template <CFunctionLike Function, CRangeMember... Ranges>
+	void ForEachConcat(Function&& function, Ranges&&... inputs)
+	{
+		([&]
+		{
+			for (auto&& item : inputs)
+				function(FWD(item));
+		}(), ...);
+	}
+
 	/** @brief Check if range is empty */
 	template <CRangeMember Input>
 	bool IsEmpty(Input&& range)
@@ -97,6 +214,97 @@ namespace Mcro::Range
 		return ranges::make_pipeable([&](auto&& left){ return FirstOrDefault(left); });
 	}
 
+	namespace Detail
+	{
+		template <typename Range>
+		using TContiguousElement = std::remove_cv_t<std::remove_pointer_t<
+			decltype(GetContiguousData(DeclVal<Range&>()))
+		>>;
+
+		/**
+		 *	@brief
+		 *	Two contiguous ranges of the same element type, which compares equal exactly when the bytes representing
+		 *	them are equal (so no floating point numbers or padded structs), can be compared with a single `memcmp`.
+		 */
+		template <typename Left, typename Right>
+		concept CBitwiseComparableRanges =
+			CContiguousRange<Left> && CContiguousRange<Right>
+			&& CSameAs<TContiguousElement<Left>, TContiguousElement<Right>>
+			&& std::has_unique_object_representations_v<TContiguousElement<Left>>
+		;
+
+		/**
+		 *	@brief
+		 *	A predicate on trivially copyable elements of a contiguous range, which can be evaluated for a whole block
+		 *	of elements without branching on each of them.
+		 */
+		template <typename Range, typename Predicate>
+		concept CBlockPredicate =
+			CContiguousRange<Range>
+			&& std::is_trivially_copyable_v<TContiguousElement<Range>>
+			&& requires(Predicate& predicate, TContiguousElement<Range> const& element)
+			{
+				{ predicate(element) } -> CConvertibleTo<bool>;
+			}
+		;
+
+		inline constexpr int32 PredicateBlockSize = 64;
+
+		/** @brief The element by element reference implementation of `MatchOrdered` for any kind of ranges */
+		template <typename Left, typename Right>
+		bool MatchOrderedScalar(Left&& left, Right&& right, bool matchOnlyBeginning)
+		{
+			if (IsEmpty(left) && IsEmpty(right)) return true;
+			
+			if constexpr (CCountableRange<Left> && CCountableRange<Right>)
+				if (!matchOnlyBeginning && size(left) != size(right))
+					return false;
+			
+			auto leftIt = left.begin();
+			auto rightIt = right.begin();
+			for (;;)
+			{
+				if (IteratorEquals(leftIt, left.end()) || IteratorEquals(rightIt, right.end()))
+					return matchOnlyBeginning || (
+						IteratorEquals(leftIt, left.end()) && IteratorEquals(rightIt, right.end())
+					);
+
+				if (*leftIt != *rightIt) return false;
+				++leftIt;
+				++rightIt;
+			}
+		}
+
+		/**
+		 *	@brief
+		 *	Test a predicate on a contiguous range in fixed size blocks. Within a block, results are combined without
+		 *	early exit, so the compiler can vectorize the block for the target instruction set (SSE/AVX2/NEON), and the
+		 *	range is only left early between blocks.
+		 *
+		 *	@tparam bAll  When true this tests if all elements satisfy the predicate, otherwise whether any of them does
+		 */
+		template <bool bAll, typename Range, typename Predicate>
+		bool TestBlockwise(Range&& range, Predicate& predicate)
+		{
+			auto* data = GetContiguousData(range);
+			const int64 num = GetContiguousNum(range);
+			int64 i = 0;
+			for (; i + PredicateBlockSize <= num; i += PredicateBlockSize)
+			{
+				bool block = bAll;
+				for (int32 j = 0; j < PredicateBlockSize; ++j)
+				{
+					if constexpr (bAll) block &= static_cast<bool>(predicate(data[i + j]));
+					else                block |= static_cast<bool>(predicate(data[i + j]));
+				}
+				if (block != bAll) return !bAll;
+			}
+			for (; i < num; ++i)
+				if (static_cast<bool>(predicate(data[i])) != bAll) return !bAll;
+			return bAll;
+		}
+	}
+
 	/**
 	 *	@brief
 	 *	Return true if input ranges match their values and their order.
@@ -104,6 +312,10 @@ namespace Mcro::Range
 	 *	This runs in O(N) time when result is true, unless both input ranges are `CCountableRange`, `matchOnlyBeginning`
 	 *	is false and the two input ranges have different size.
 	 *
+	 *	Contiguous ranges of the same element type which can be compared bitwise (like `TCHAR` or `uint8` arrays and
+	 *	strings) are compared with a single `FMemory::Memcmp`, which is vectorized by the platform. Other ranges are
+	 *	compared element by element with `Detail::MatchOrderedScalar`.
+	 *
 	 *	@param  left  Input range
 	 *	@param right  Range to compare with
 	 *	
@@ -114,25 +326,21 @@ namespace Mcro::Range
 	requires CCoreHalfEqualityComparable<TRangeElementType<Left>, TRangeElementType<Right>>
 	bool MatchOrdered(Left&& left, Right&& right, bool matchOnlyBeginning = false)
 	{
-		if (IsEmpty(left) && IsEmpty(right)) return true;
-		
-		if constexpr (CCountableRange<Left> && CCountableRange<Right>)
-			if (!matchOnlyBeginning && size(left) != size(right))
-				return false;
-		
-		auto leftIt = left.begin();
-		auto rightIt = right.begin();
-		for (;;)
+		if constexpr (Detail::CBitwiseComparableRanges<Left, Right>)
 		{
-			if (IteratorEquals(leftIt, left.end()) || IteratorEquals(rightIt, right.end()))
-				return matchOnlyBeginning || (
-					IteratorEquals(leftIt, left.end()) && IteratorEquals(rightIt, right.end())
-				);
-
-			if (*leftIt != *rightIt) return false;
-			++leftIt;
-			++rightIt;
+			const int64 leftNum = GetContiguousNum(left);
+			const int64 rightNum = GetContiguousNum(right);
+			if (!matchOnlyBeginning && leftNum != rightNum)
+				return false;
+
+			const int64 num = FMath::Min(leftNum, rightNum);
+			return num == 0 || FMemory::Memcmp(
+				GetContiguousData(left),
+				GetContiguousData(right),
+				num * sizeof(Detail::TContiguousElement<Left>)
+			) == 0;
 		}
+		else return Detail::MatchOrderedScalar(left, right, matchOnlyBeginning);
 	}
 
 	template <CRangeMember Left, typename Value>
@@ -166,16 +374,52 @@ namespace Mcro::Range
 		return ranges::make_pipeable([&](auto&& left){ return MatchOrdered(left, right, matchOnlyBeginning); });
 	}
 
+	/**
+	 *	@brief
+	 *	Return true if all elements of a range satisfy a predicate.
+	 *
+	 *	Contiguous ranges of trivially copyable elements are tested in blocks which the compiler can vectorize. In that
+	 *	case the predicate may be called for a couple more elements after the first one failing it, so it should be
+	 *	free of side effects. Other ranges use `ranges::all_of`.
+	 */
+	template <CRangeMember Range, CFunctionLike Predicate>
+	bool AllOf(Range&& range, Predicate&& pred)
+	{
+		if constexpr (Detail::CBlockPredicate<Range, Predicate>)
+			return Detail::TestBlockwise<true>(range, pred);
+		else
+			return ranges::all_of(range, pred);
+	}
+
+	/**
+	 *	@brief
+	 *	Return true if any element of a range satisfies a predicate.
+	 *
+	 *	Contiguous ranges of trivially copyable elements are tested in blocks which the compiler can vectorize. In that
+	 *	case the predicate may be called for a couple more elements after the first one satisfying it, so it should be
+	 *	free of side effects. Other ranges use `ranges::any_of`.
+	 */
+	template <CRangeMember Range, CFunctionLike Predicate>
+	bool AnyOf(Range&& range, Predicate&& pred)
+	{
+		if constexpr (Detail::CBlockPredicate<Range, Predicate>)
+			return Detail::TestBlockwise<false>(range, pred);
+		else
+			return ranges::any_of(range, pred);
+	}
+
+	/** @brief Pipeable version of `AllOf` */
 	template <CFunctionLike Predicate>
 	auto AllOf(Predicate&& pred)
 	{
-		return ranges::make_pipeable([&](auto&& left){ return ranges::all_of(left, pred); });
+		return ranges::make_pipeable([&](auto&& left){ return AllOf(left, pred); });
 	}
 
+	/** @brief Pipeable version of `AnyOf` */
 	template <CFunctionLike Predicate>
 	auto AnyOf(Predicate&& pred)
 	{
-		return ranges::make_pipeable([&](auto&& left){ return ranges::any_of(left, pred); });
+		return ranges::make_pipeable([&](auto&& left){ return AnyOf(left, pred); });
 	}
 
 	FORCEINLINE auto FilterValid()
@@ -285,7 +529,7 @@ namespace Mcro::Range
 	auto FilterTuple(Left&& left, Predicate&& predicate)
 	{
 		using Tuple = TRangeElementType<Left>;
-		return ranges::views::transform(FWD(left), [predicate](Tuple const& tuple)
+		return ranges::views::filter(FWD(left), [predicate](Tuple const& tuple)
 		{
 			return InvokeWithTuple(predicate, tuple);
 		});
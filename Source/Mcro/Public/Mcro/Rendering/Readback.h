@@ -0,0 +1,96 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Mcro/Error.h"
+#include "Mcro/Rendering/Textures.h"
+
+#include <atomic>
+
+class FRHIGPUTextureReadback;
+
+namespace Mcro::Rendering::Textures
+{
+	using namespace Mcro::Error;
+
+	/** @brief CPU copy of the first mip of a texture read back from the GPU */
+	struct FTextureReadbackResult
+	{
+		FUnrealTextureSize Size;
+
+		/** @brief Tightly packed rows of pixels, the texture may have wider rows on the GPU */
+		TArray<uint8> Data;
+
+		/** @brief Number of bytes in a row of Data */
+		int32 RowBytes = 0;
+	};
+
+	/**
+	 *	@brief
+	 *	Read back textures from the GPU without stalling the render thread. Requests are copied into a ring of staging
+	 *	buffers and their completion is polled once per frame, until the GPU is done with them. At most a configured
+	 *	amount of readbacks can be in flight at the same time, further requests fail until a staging buffer is free.
+	 *
+	 *	This object must be created with MakeShared, the result future is fulfilled on the render thread.
+	 *
+	 *	@code
+	 *	TSharedRef<FTextureReadbackQueue> readbacks = MakeShared<FTextureReadbackQueue>(3);
+	 *	readbacks->Read(renderTarget).Then([](TFuture<TMaybe<FTextureReadbackResult>> result) { ... });
+	 *	@endcode
+	 */
+	class MCRO_API FTextureReadbackQueue : public TSharedFromThis<FTextureReadbackQueue>
+	{
+	public:
+		using FResult = TMaybe<FTextureReadbackResult>;
+
+		/** @param maxInFlight  The number of staging buffers, that is how many readbacks can be pending at once */
+		FTextureReadbackQueue(int32 maxInFlight = 3);
+		~FTextureReadbackQueue();
+
+		FTextureReadbackQueue(FTextureReadbackQueue const&) = delete;
+		FTextureReadbackQueue& operator = (FTextureReadbackQueue const&) = delete;
+
+		/** @brief Read back the current content of a texture which has a render resource, from any thread */
+		TFuture<FResult> Read(UTexture* texture);
+
+		/** @brief Read back an RHI texture, on the render thread */
+		TFuture<FResult> Read(FRHICommandListImmediate& cmdList, FRHITexture* texture);
+
+		/** @brief Number of readbacks waiting for the GPU */
+		int32 NumInFlight() const { return InFlight.load(std::memory_order_relaxed); }
+
+		/** @brief Maximum number of readbacks waiting for the GPU at the same time */
+		int32 GetMaxInFlight() const { return MaxInFlight; }
+
+	private:
+		struct FStagingBuffer
+		{
+			TUniquePtr<FRHIGPUTextureReadback> Readback;
+			TOptional<TPromise<FResult>> Promise;
+			FUnrealTextureSize Size;
+		};
+
+		int32 MaxInFlight;
+		std::atomic<int32> InFlight { 0 };
+
+		/** @brief Only accessed on the render thread */
+		TArray<FStagingBuffer> Ring;
+		int32 NextBuffer = 0;
+
+		FTSTicker::FDelegateHandle TickerHandle;
+
+		bool Tick(float deltaTime);
+		void Poll(FRHICommandListImmediate& cmdList);
+	};
+}
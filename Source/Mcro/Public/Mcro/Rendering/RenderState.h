@@ -0,0 +1,134 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Threading.h"
+#include "Mcro/Delegates/EventDelegate.h"
+
+namespace Mcro::Rendering
+{
+	using namespace Mcro::Delegates;
+
+	namespace Detail
+	{
+		class IRenderStateFlip
+		{
+		public:
+			virtual ~IRenderStateFlip() = default;
+
+			/** @brief Called on the game thread at the end of the frame, enqueue the flip of the buffers */
+			virtual void EnqueueFlip() = 0;
+		};
+
+		/** @brief Enqueue the flip of given state at the end of the current game thread frame */
+		MCRO_API void QueueRenderStateFlip(TSharedRef<IRenderStateFlip> const& state);
+
+		/** @brief Enqueue the flips of render states changed during this frame. Called at the end of game thread frames. */
+		MCRO_API void FlushRenderStateFlips();
+	}
+
+	/**
+	 *	@brief
+	 *	A value owned by the game thread and mirrored on the render thread, without a lock between them. The game
+	 *	thread modifies a back buffer, and at the end of a frame where it has changed, a copy of it is sent to the
+	 *	render thread in a single render command (batched when render command batching is enabled). Only that render
+	 *	command writes the front buffer, so the render thread reads it without synchronization.
+	 *
+	 *	The render thread sees the changes of a frame at once, in the same order relative to other render commands
+	 *	enqueued at the end of that frame.
+	 *
+	 *	@code
+	 *	auto state = MakeShared<TRenderState<FMyViewParams>>();
+	 *	state->Modify([](FMyViewParams& params) { params.Exposure = 1.5f; });    // game thread
+	 *	
+	 *	FMyViewParams const& params = state->GetRenderThread();                 // render thread
+	 *	@endcode
+	 *
+	 *	This object must be created with MakeShared.
+	 */
+	template <typename T>
+	class TRenderState
+		: public Detail::IRenderStateFlip
+		, public TSharedFromThis<TRenderState<T>>
+	{
+	public:
+		template <typename... Args>
+		requires std::is_constructible_v<T, Args...>
+		explicit TRenderState(Args&&... args)
+			: Back(Forward<Args>(args)...)
+			, Front(Back)
+		{}
+
+		TRenderState(TRenderState const&) = delete;
+		TRenderState& operator = (TRenderState const&) = delete;
+
+		/** @brief The value as the game thread sees it, including changes of the current frame */
+		T const& GetGameThread() const
+		{
+			check(IsInGameThread());
+			return Back;
+		}
+
+		/** @brief The value as the render thread sees it, changes arrive at the end of game thread frames */
+		T const& GetRenderThread() const
+		{
+			check(IsInRenderingThread());
+			return Front;
+		}
+
+		/** @brief Set the value on the game thread, it reaches the render thread at the end of the frame */
+		template <typename Value>
+		requires std::is_assignable_v<T&, Value>
+		void Set(Value&& value)
+		{
+			check(IsInGameThread());
+			Back = Forward<Value>(value);
+			MarkDirty();
+		}
+
+		/** @brief Modify the value on the game thread, it reaches the render thread at the end of the frame */
+		template <typename Function>
+		requires std::is_invocable_v<Function, T&>
+		void Modify(Function&& modifier)
+		{
+			check(IsInGameThread());
+			modifier(Back);
+			MarkDirty();
+		}
+
+		/** @brief Broadcast on the render thread after the front buffer has been updated */
+		TEventDelegate<void(T const&)> OnFlipped;
+
+	private:
+		void MarkDirty()
+		{
+			if (bFlipQueued) return;
+			bFlipQueued = true;
+			Detail::QueueRenderStateFlip(this->AsShared());
+		}
+
+		virtual void EnqueueFlip() override
+		{
+			bFlipQueued = false;
+			Threading::EnqueueRenderCommand([self = this->AsShared(), value = T(Back)](FRHICommandListImmediate&) mutable
+			{
+				self->Front = MoveTemp(value);
+				self->OnFlipped.Broadcast(self->Front);
+			});
+		}
+
+		T Back;
+		T Front;
+		bool bFlipQueued = false;
+	};
+}
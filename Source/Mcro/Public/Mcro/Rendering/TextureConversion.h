@@ -0,0 +1,198 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphFwd.h"
+#include "Mcro/Error.h"
+#include "Mcro/Rendering/Textures.h"
+
+/**
+ *	@brief
+ *	RDG compute passes converting textures on the GPU. Every function here must be called on the render thread while
+ *	building a render graph, the results are only valid within the same graph (or after extracting them).
+ *
+ *	Target descriptors are FUnrealTextureSize, any other CTextureSize (for example FDXGITextureSize) converts to it
+ *	implicitly. Target formats must support typed UAV stores, block compressed and depth formats are rejected.
+ *
+ *	@code
+ *	auto bgra = AddConvertTexturePass(graph, source, FDXGITextureSize(1920, 1080, DXGI_FORMAT_B8G8R8A8_UNORM));
+ *	if (bgra.HasError()) return;
+ *	auto nv12 = AddRgbToYuvPass(graph, bgra.GetValue(), { .Layout = EYuvLayout::NV12 });
+ *	@endcode
+ */
+namespace Mcro::Rendering::Textures
+{
+	using namespace Mcro::Error;
+
+	/** @brief Where a channel of the converted texture is taken from */
+	enum class ETextureChannel : uint8
+	{
+		R, G, B, A,
+		Zero,
+		One
+	};
+
+	/** @brief Select for each target channel which source channel it reads */
+	struct FTextureSwizzle
+	{
+		ETextureChannel R = ETextureChannel::R;
+		ETextureChannel G = ETextureChannel::G;
+		ETextureChannel B = ETextureChannel::B;
+		ETextureChannel A = ETextureChannel::A;
+
+		static constexpr FTextureSwizzle Identity() { return {}; }
+
+		/** @brief Swap red and blue, converting between RGBA and BGRA channel orders */
+		static constexpr FTextureSwizzle SwapRedBlue()
+		{
+			return { ETextureChannel::B, ETextureChannel::G, ETextureChannel::R, ETextureChannel::A };
+		}
+
+		/** @brief Keep the color channels but force the alpha to be opaque */
+		static constexpr FTextureSwizzle Opaque()
+		{
+			return { ETextureChannel::R, ETextureChannel::G, ETextureChannel::B, ETextureChannel::One };
+		}
+	};
+
+	enum class ETextureFilter : uint8
+	{
+		Point,
+		Bilinear
+	};
+
+	struct FTextureConversionSettings
+	{
+		FTextureSwizzle Swizzle {};
+
+		/** @brief Used only when the source and target sizes differ */
+		ETextureFilter Filter = ETextureFilter::Bilinear;
+
+		bool bFlipVertically = false;
+	};
+
+	/**
+	 *	@brief
+	 *	Convert the format, channel order and size of a texture in a single compute pass. Minifying more than 2x with
+	 *	bilinear filtering skips source texels, use AddDownsampleTexturePass first for large reductions.
+	 *
+	 *	@param graph     The render graph being built
+	 *	@param source    Its first mip is read
+	 *	@param target    Size and format of the new texture
+	 *	@param settings  Swizzle, filtering and orientation
+	 *	@param name      Debug name of the created texture
+	 *	@return  The new texture, or an error when the target is invalid or its format cannot be written by a compute shader
+	 */
+	MCRO_API TMaybe<FRDGTextureRef> AddConvertTexturePass(
+		FRDGBuilder& graph,
+		FRDGTextureRef source,
+		FUnrealTextureSize const& target,
+		FTextureConversionSettings const& settings = {},
+		const TCHAR* name = TEXT_"Mcro.ConvertedTexture"
+	);
+
+	/**
+	 *	@brief  Same as AddConvertTexturePass but write into an existing texture created with TexCreate_UAV.
+	 *	@return  An error if the target cannot be written by a compute shader
+	 */
+	MCRO_API FCanFail AddConvertIntoTexturePass(
+		FRDGBuilder& graph,
+		FRDGTextureRef source,
+		FRDGTextureRef target,
+		FTextureConversionSettings const& settings = {}
+	);
+
+	/**
+	 *	@brief
+	 *	Halve the size of a texture repeatedly with a 2x2 box filter, keeping its format. Each halving is a separate
+	 *	pass, odd sizes are rounded down with edge texels clamped.
+	 *
+	 *	@param graph   The render graph being built
+	 *	@param source  Its first mip is read
+	 *	@param steps   Number of halvings, the result is at least 1x1
+	 *	@return  The downsampled texture, the source if steps is 0, or an error if the source format cannot be written
+	 *	         by a compute shader
+	 */
+	MCRO_API TMaybe<FRDGTextureRef> AddDownsampleTexturePass(FRDGBuilder& graph, FRDGTextureRef source, int32 steps = 1);
+
+	enum class EYuvLayout : uint8
+	{
+		/** @brief Full resolution luma plane followed by a half resolution interleaved UV plane */
+		NV12,
+
+		/** @brief Full resolution luma plane and two half resolution chroma planes, U then V (also known as YUV420p) */
+		I420
+	};
+
+	enum class EYuvColorSpace : uint8
+	{
+		Rec601,
+		Rec709
+	};
+
+	struct FYuvConversionSettings
+	{
+		EYuvLayout Layout = EYuvLayout::NV12;
+		EYuvColorSpace ColorSpace = EYuvColorSpace::Rec709;
+
+		/** @brief Use the complete 0-255 range instead of the 16-235 (luma) and 16-240 (chroma) video range */
+		bool bFullRange = false;
+
+		bool bFlipVertically = false;
+	};
+
+	/** @brief Planes of a 4:2:0 YUV image, only the planes of the chosen layout are valid */
+	struct FRDGYuvPlanes
+	{
+		/** @brief PF_G8, the size of the source */
+		FRDGTextureRef Luma = nullptr;
+
+		/** @brief PF_R8G8 with half the size of the source rounded up, only for EYuvLayout::NV12 */
+		FRDGTextureRef Chroma = nullptr;
+
+		/** @brief PF_G8 with half the size of the source rounded up, only for EYuvLayout::I420 */
+		FRDGTextureRef U = nullptr;
+		FRDGTextureRef V = nullptr;
+
+		bool IsValid() const { return Luma && (Chroma || (U && V)); }
+	};
+
+	/**
+	 *	@brief
+	 *	Convert a packed RGB texture into planar 4:2:0 YUV in one compute pass, for example to feed a video encoder.
+	 *	Chroma is the average of the 2x2 block of source texels it covers. YUV is defined over gamma encoded values,
+	 *	so sRGB sources are read without decoding them to linear.
+	 *
+	 *	@return  The planes of the requested layout, or an error if the source is missing
+	 */
+	MCRO_API TMaybe<FRDGYuvPlanes> AddRgbToYuvPass(
+		FRDGBuilder& graph,
+		FRDGTextureRef source,
+		FYuvConversionSettings const& settings = {}
+	);
+
+	namespace Detail
+	{
+		/** @brief Rows of an RGB to Y'CbCr matrix, the w components are the offsets of the chosen range */
+		struct FYuvMatrix
+		{
+			FVector4f Y, U, V;
+		};
+
+		/** @brief BT.601 / BT.709 RGB to Y'CbCr, with the offsets of the requested range folded into w */
+		MCRO_API FYuvMatrix GetYuvMatrix(EYuvColorSpace colorSpace, bool fullRange);
+
+		/** @brief Make the plugin shaders available under /Plugin/Mcro, must happen before shaders are compiled */
+		MCRO_API void RegisterShaderDirectory();
+	}
+}
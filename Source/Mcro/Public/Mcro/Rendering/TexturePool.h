@@ -0,0 +1,242 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Mcro/Rendering/Textures.h"
+
+namespace Mcro::Rendering::Textures
+{
+	/** @brief Counters of a texture pool, either accumulated during the current frame or captured at its end */
+	struct FTexturePoolStats
+	{
+		/** @brief Number of acquisitions served from the pool */
+		int32 Hits = 0;
+
+		/** @brief Number of acquisitions which had to create a new resource */
+		int32 Misses = 0;
+
+		/** @brief Number of pooled resources released because of the memory budget or being idle for too long */
+		int32 Evictions = 0;
+
+		/** @brief Number of resources currently waiting in the pool */
+		int32 Pooled = 0;
+
+		/** @brief Number of resources currently acquired and not yet given back */
+		int32 InUse = 0;
+
+		/** @brief Estimated memory of the resources waiting in the pool */
+		int64 PooledBytes = 0;
+
+		/** @brief Estimated memory of the resources currently acquired */
+		int64 InUseBytes = 0;
+	};
+
+	/** @brief Estimate the memory a single mip 2D texture of given size and format occupies */
+	MCRO_API int64 GetTextureMemorySize(FUnrealTextureSize const& size);
+
+	/**
+	 *	@brief
+	 *	Reuse texture resources which are frequently recreated with alternating sizes or formats. Given back resources
+	 *	are kept in the pool until a request arrives with the same `TTextureSize`, or until they get evicted, least
+	 *	recently used first, when the pool exceeds its memory budget or they haven't been used for a number of frames.
+	 *
+	 *	The bookkeeping of the pool is safe to use from multiple threads, but resources are created (by `Acquire`) and
+	 *	destroyed (by `Release`, `Trim`, `SetBudget` and the end of frame eviction) on the calling thread, outside of
+	 *	the pool's lock. So the pool is only as thread-safe as creating and destroying its resources are: pools of
+	 *	UObjects, like FRenderTargetPool, must only be used on the game thread. The pool must be constructed and
+	 *	destroyed on the game thread, as it hooks into `FCoreDelegates::OnEndFrame`. The created resources are owned
+	 *	by the pool while they're pooled. Frame statistics are captured at the end of each game thread frame.
+	 *
+	 *	@tparam      Size  A texture size type, like `FUnrealTextureSize`
+	 *	@tparam  Resource  A copyable owning handle of the texture resource, like a strong object pointer
+	 */
+	template <CTextureSize Size, typename Resource>
+	class TTexturePool
+	{
+	public:
+		using FCreate = TFunction<Resource(Size const&)>;
+
+		/**
+		 *	@param        create  Make a new resource when there's no matching one in the pool
+		 *	@param  budgetBytes  Maximum estimated memory of the resources waiting in the pool
+		 *	@param maxIdleFrames  Evict pooled resources which haven't been used for this many frames, 0 to keep them
+		 */
+		TTexturePool(FCreate&& create, int64 budgetBytes = 256 * 1024 * 1024, int32 maxIdleFrames = 120)
+			: Create(MoveTemp(create))
+			, BudgetBytes(budgetBytes)
+			, MaxIdleFrames(maxIdleFrames)
+		{
+			OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &TTexturePool::EndFrame);
+		}
+
+		TTexturePool(TTexturePool const&) = delete;
+		TTexturePool& operator = (TTexturePool const&) = delete;
+
+		~TTexturePool()
+		{
+			FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+		}
+
+		/** @brief Get a resource with given size and format from the pool, or create one if none available */
+		Resource Acquire(Size const& size)
+		{
+			const int64 bytes = GetTextureMemorySize(FUnrealTextureSize(size));
+			{
+				FScopeLock lock(&Lock);
+				Current.InUse++;
+				Current.InUseBytes += bytes;
+
+				// Prefer the most recently released, it's most likely still warm in caches and memory
+				for (int32 i = Free.Num() - 1; i >= 0; --i)
+				{
+					if (Free[i].TextureSize == size)
+					{
+						Resource result = MoveTemp(Free[i].Handle);
+						Free.RemoveAt(i, EAllowShrinking::No);
+						Current.Hits++;
+						Current.Pooled--;
+						Current.PooledBytes -= bytes;
+						return result;
+					}
+				}
+				Current.Misses++;
+			}
+			return Create(size);
+		}
+
+		/** @brief Give back a resource previously acquired from this pool with the same size */
+		void Release(Size const& size, Resource resource)
+		{
+			const int64 bytes = GetTextureMemorySize(FUnrealTextureSize(size));
+			FEvicted evicted;
+			FScopeLock lock(&Lock);
+			Current.InUse--;
+			Current.InUseBytes -= bytes;
+			Current.Pooled++;
+			Current.PooledBytes += bytes;
+			Free.Add({size, MoveTemp(resource), bytes, FrameCounter});
+			EvictOverBudget(BudgetBytes, evicted);
+		}
+
+		/** @brief Release pooled resources until their estimated memory is at most `targetBytes` */
+		void Trim(int64 targetBytes = 0)
+		{
+			FEvicted evicted;
+			FScopeLock lock(&Lock);
+			EvictOverBudget(targetBytes, evicted);
+		}
+
+		/** @brief Change the memory budget, evicting resources if the pool is over the new one */
+		void SetBudget(int64 budgetBytes)
+		{
+			FEvicted evicted;
+			FScopeLock lock(&Lock);
+			BudgetBytes = budgetBytes;
+			EvictOverBudget(BudgetBytes, evicted);
+		}
+
+		/** @brief Counters of the last completed frame */
+		FTexturePoolStats GetLastFrameStats() const
+		{
+			FScopeLock lock(&Lock);
+			return LastFrame;
+		}
+
+		/** @brief Counters accumulated so far during the current frame */
+		FTexturePoolStats GetCurrentStats() const
+		{
+			FScopeLock lock(&Lock);
+			return Current;
+		}
+
+	private:
+		struct FPooled
+		{
+			Size TextureSize;
+			Resource Handle;
+			int64 Bytes;
+			uint64 LastUsedFrame;
+		};
+
+		/** @brief Free list in release order, so the least recently used resources are at the front */
+		TArray<FPooled> Free;
+		FCreate Create;
+		int64 BudgetBytes;
+		int32 MaxIdleFrames;
+		uint64 FrameCounter = 0;
+		FTexturePoolStats Current;
+		FTexturePoolStats LastFrame;
+		mutable FCriticalSection Lock;
+		FDelegateHandle OnEndFrameHandle;
+
+		/**
+		 *	@brief
+		 *	Evicted resources are moved out of the free list under the lock, and destroyed with this (declared before
+		 *	the lock) only after it's released, so destroying them doesn't block or deadlock other users of the pool.
+		 */
+		using FEvicted = TArray<Resource, TInlineAllocator<4>>;
+
+		void EvictOverBudget(int64 targetBytes, FEvicted& evicted)
+		{
+			int32 count = 0;
+			for (int64 pooledBytes = Current.PooledBytes; count < Free.Num() && pooledBytes > targetBytes; ++count)
+				pooledBytes -= Free[count].Bytes;
+			EvictFront(count, evicted);
+		}
+
+		void EvictFront(int32 count, FEvicted& evicted)
+		{
+			if (count <= 0) return;
+			for (int32 i = 0; i < count; ++i)
+			{
+				Current.PooledBytes -= Free[i].Bytes;
+				evicted.Add(MoveTemp(Free[i].Handle));
+			}
+			Current.Pooled -= count;
+			Current.Evictions += count;
+			Free.RemoveAt(0, count, EAllowShrinking::No);
+		}
+
+		void EndFrame()
+		{
+			FEvicted evicted;
+			FScopeLock lock(&Lock);
+			++FrameCounter;
+			if (MaxIdleFrames > 0)
+			{
+				int32 count = 0;
+				while (count < Free.Num() && FrameCounter - Free[count].LastUsedFrame > static_cast<uint64>(MaxIdleFrames))
+					++count;
+				EvictFront(count, evicted);
+			}
+			LastFrame = Current;
+			Current.Hits = 0;
+			Current.Misses = 0;
+			Current.Evictions = 0;
+		}
+	};
+
+	/** @brief Create a transient 2D render target with given size and format. Only call it on the game thread. */
+	MCRO_API TStrongObjectPtr<UTextureRenderTarget2D> CreateRenderTarget2D(FUnrealTextureSize const& size);
+
+	/** @brief A pool of transient 2D render targets, keyed by their size and pixel format. Use it on the game thread. */
+	class FRenderTargetPool : public TTexturePool<FUnrealTextureSize, TStrongObjectPtr<UTextureRenderTarget2D>>
+	{
+	public:
+		FRenderTargetPool(int64 budgetBytes = 256 * 1024 * 1024, int32 maxIdleFrames = 120)
+			: TTexturePool(&CreateRenderTarget2D, budgetBytes, maxIdleFrames)
+		{}
+	};
+}
@@ -178,6 +178,16 @@ namespace Mcro::Rendering::Textures
 	template <CTextureSize Left, CTextureSize Right>
 	bool operator != (Left const& l, Right const& r) { return !(l == r); }
 
+	/** @brief Texture sizes can be used as keys of maps and sets */
+	template <CTextureSize T>
+	uint32 GetTypeHash(T const& size)
+	{
+		return HashCombineFast(
+			HashCombineFast(::GetTypeHash(size.Width), ::GetTypeHash(size.Height)),
+			::GetTypeHash(static_cast<uint32>(size.Format))
+		);
+	}
+
 	using FUnrealTextureSize = TTextureSize<uint32, EPixelFormat>;
 
 	MCRO_API FUnrealTextureSize GetTextureSize(UTexture* texture);
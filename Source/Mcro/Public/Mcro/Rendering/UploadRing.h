@@ -0,0 +1,139 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Rendering/Textures.h"
+
+#include <atomic>
+
+namespace Mcro::Rendering::Textures
+{
+	class FTextureUploadRing;
+
+	namespace Detail
+	{
+		/** @brief Let go of every shared upload ring, called on module shutdown */
+		MCRO_API void ReleaseSharedUploadRings();
+	}
+
+	/**
+	 *	@brief
+	 *	A staging buffer of an upload ring, acquired for writing the pixels of the next texture update. If it's
+	 *	destroyed without being submitted the staging buffer is simply given back to the ring.
+	 */
+	class MCRO_API FTextureUploadSlot
+	{
+	public:
+		FTextureUploadSlot() = default;
+		FTextureUploadSlot(FTextureUploadSlot&& other) noexcept;
+		FTextureUploadSlot& operator = (FTextureUploadSlot&& other) noexcept;
+		~FTextureUploadSlot();
+
+		/** @brief The memory of the staging buffer, rows of pixels are placed RowBytes apart */
+		TArrayView<uint8> GetData() const { return Data; }
+
+		int32 GetRowBytes() const { return RowBytes; }
+
+		explicit operator bool() const { return Ring.IsValid(); }
+
+	private:
+		friend class FTextureUploadRing;
+
+		TSharedPtr<FTextureUploadRing> Ring;
+		TArrayView<uint8> Data;
+		int32 RowBytes = 0;
+		int32 Index = INDEX_NONE;
+	};
+
+	/**
+	 *	@brief
+	 *	A persistent ring of CPU staging buffers for updating textures of the same size and format every frame,
+	 *	without allocating and copying the pixels into a fresh buffer for each render command.
+	 *
+	 *	Producers on any thread acquire a free staging buffer, write the pixels directly into it and submit it for a
+	 *	target texture. The render thread then updates the texture from the staging buffer, which is reused as soon
+	 *	as the RHI has taken the data. When all the staging buffers are in flight acquisition fails instead of
+	 *	blocking, so producers can skip or retry a frame.
+	 *
+	 *	This object must be created with MakeShared, or retrieved with `Get` for a shared ring of a size class.
+	 */
+	class MCRO_API FTextureUploadRing : public TSharedFromThis<FTextureUploadRing>
+	{
+	public:
+		/**
+		 *	@param    size  Size and format of the target textures
+		 *	@param   depth  Number of staging buffers, that is how many uploads can be in flight at the same time
+		 */
+		FTextureUploadRing(FUnrealTextureSize const& size, int32 depth = 3);
+
+		FTextureUploadRing(FTextureUploadRing const&) = delete;
+		FTextureUploadRing& operator = (FTextureUploadRing const&) = delete;
+
+		/**
+		 *	@brief
+		 *	Get the upload ring shared by everyone updating textures of given size and format. Shared rings persist
+		 *	until they're trimmed with `TrimShared` or the Mcro module is shut down.
+		 */
+		static TSharedRef<FTextureUploadRing> Get(FUnrealTextureSize const& size);
+
+		/**
+		 *	@brief
+		 *	Release the shared rings which are not referenced by anyone else and have no uploads in flight, for example
+		 *	after the size of updated textures has changed.
+		 *
+		 *	@return  The number of released rings
+		 */
+		static int32 TrimShared();
+
+		/** @brief Get a free staging buffer to write pixels into, from any thread. Invalid if all are in flight. */
+		FTextureUploadSlot Acquire();
+
+		/**
+		 *	@brief
+		 *	Update the first mip of a texture with the pixels of a staging buffer on the render thread. The target
+		 *	must have the same size and format as this ring, like an `UTexture2DDynamic`. Call it from any thread.
+		 */
+		void Submit(FTextureUploadSlot&& slot, UTexture* target);
+
+		/** @copydoc Submit */
+		void Submit(FTextureUploadSlot&& slot, FTextureRHIRef const& target);
+
+		FUnrealTextureSize const& GetSize() const { return Size; }
+
+		/** @brief Number of staging buffers currently acquired or waiting for the render thread */
+		int32 NumInFlight() const;
+
+	private:
+		friend class FTextureUploadSlot;
+
+		enum class ESlotState : uint8
+		{
+			Free,
+			Writing,
+			Pending
+		};
+
+		FUnrealTextureSize Size;
+		int32 RowBytes;
+		int64 SlotBytes;
+
+		/** @brief One allocation for all staging buffers, made on construction */
+		TArray64<uint8> Memory;
+		TUniquePtr<std::atomic<ESlotState>[]> States;
+		int32 Depth;
+		std::atomic<uint32> NextSlot { 0 };
+
+		void Free(int32 index);
+		void Upload(FRHICommandListImmediate& cmdList, int32 index, FRHITexture* target);
+	};
+}
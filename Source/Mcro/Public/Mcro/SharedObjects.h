@@ -48,6 +48,85 @@ namespace Mcro::SharedObjects
 		object.Initialize(FWD(args)...);
 	};
 
+	/**
+	 *	@brief
+	 *	Counters of the pool serving MakeSharedPooled. Blocks are first recycled via thread-local caches (which are
+	 *	not counted) then via a shared pool of size classes.
+	 */
+	struct FSharedObjectPoolStats
+	{
+		/** @brief Number of blocks allocated from the general heap because no pooled one was available */
+		uint64 HeapAllocations = 0;
+
+		/** @brief Number of batches taken from the shared pool because a thread-local cache was empty */
+		uint64 SharedPoolHits = 0;
+
+		/** @brief Memory of the blocks waiting in the shared pool */
+		SIZE_T SharedPooledBytes = 0;
+	};
+
+	/** @returns Counters of the shared object pool since startup */
+	MCRO_API FSharedObjectPoolStats GetSharedObjectPoolStats();
+
+	/** @brief Give the blocks waiting in the shared pool back to the general heap */
+	MCRO_API void TrimSharedObjectPool();
+
+	namespace Detail
+	{
+		/** @brief Size classes of the shared object pool are multiples of this */
+		inline constexpr SIZE_T PooledSharedGranularity = 16;
+
+		/** @brief Alignment of pooled blocks, over-aligned types are allocated from the general heap */
+		inline constexpr SIZE_T PooledSharedAlignment = 16;
+
+		/** @brief Bigger blocks are allocated from the general heap */
+		inline constexpr SIZE_T MaxPooledSharedSize = 512;
+
+		MCRO_API void* AllocatePooledShared(SIZE_T size);
+		MCRO_API void FreePooledShared(void* block, SIZE_T size);
+
+		/** @brief Destroys objects of MakeSharedPooled and gives their memory back to the pool */
+		template <typename T>
+		struct TPooledSharedDeleter
+		{
+			void operator () (T* object) const
+			{
+				DestructItem(object);
+				if constexpr (alignof(T) > PooledSharedAlignment)
+					FMemory::Free(object);
+				else
+					FreePooledShared(object, sizeof(T));
+			}
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Drop-in replacement of MakeShared for objects which are created and destroyed frequently. The object is
+	 *	allocated from a pool of size classes with thread-local caches, instead of the general heap. TSharedFromThis
+	 *	works the same way as with MakeShared.
+	 *
+	 *	@code
+	 *	TSharedStateRef<int32> state = MakeSharedPooled<TState<int32>>(0);
+	 *	@endcode
+	 *
+	 *	@remarks
+	 *	Only the public API of shared pointers is used, so the reference controller is allocated separately by the
+	 *	engine, the same way as with MakeShareable and a custom deleter. Unlike with MakeShared, the memory of the
+	 *	object is recycled with the last shared reference, regardless of remaining weak pointers.
+	 */
+	template <typename T, ESPMode Mode = ESPMode::ThreadSafe, typename... Args>
+	TSharedRef<T, Mode> MakeSharedPooled(Args&&... args)
+	{
+		void* block;
+		if constexpr (alignof(T) > Detail::PooledSharedAlignment)
+			block = FMemory::Malloc(sizeof(T), alignof(T));
+		else
+			block = Detail::AllocatePooledShared(sizeof(T));
+
+		return TSharedRef<T, Mode>(new (block) T(FWD(args)...), Detail::TPooledSharedDeleter<T>());
+	}
+
 	/**
 	 *	@brief
 	 *	A wrapper around MakeShareable that automatically calls an initializer method Initialize on the
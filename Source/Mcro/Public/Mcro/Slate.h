@@ -18,6 +18,7 @@
 #include "SlotBase.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/Range/Iterators.h"
+#include "Mcro/Range/Conversion.h"
 #include "Mcro/Range/Views.h"
 
 /**
@@ -61,6 +62,18 @@ namespace Mcro::Slate
 	template <typename T>
 	concept CWidgetWithSlots = requires(typename T::FSlot& t) { t; };
 
+	/**
+	 *	@brief
+	 *	Constraining given type to widget arguments which store their slot arguments in a `_Slots` array, declared via
+	 *	`SLATE_SLOT_ARGUMENT(FSlot, Slots)`. This is the case for most Slate panels.
+	 */
+	template <typename Arguments, typename SlotArguments>
+	concept CWidgetArgumentsWithSlotArray = requires(Arguments& args, SlotArguments&& slot, int32 count)
+	{
+		args._Slots.Reserve(count);
+		args._Slots.Emplace(MoveTemp(slot));
+	};
+
 	template <typename T>
 	concept CBoxPanelWidget = CWidgetWithSlots<T>
 		&& CDerivedFrom<T, SBoxPanel>
@@ -197,7 +210,7 @@ namespace Mcro::Slate
 		CRangeMember Range,
 		CFunctionLike Transform,
 		CFunctionLike OnEmpty = TUniqueFunction<TFunction_Return<Transform>()>,
-		CSlotArguments = TFunction_Return<Transform>
+		CSlotArguments SlotArguments = TFunction_Return<Transform>
 	>
 	requires (TFunction_ArgCount<Transform> == 1)
 	struct TSlots
@@ -242,8 +255,22 @@ namespace Mcro::Slate
 				return;
 			}
 
-			for (auto it = RangeRef.begin(); !IteratorEquals(it, RangeRef.end()); ++it)
-				args + TransformStorage(*it);
+			if constexpr (CWidgetArgumentsWithSlotArray<Arguments, SlotArguments>)
+			{
+				// The panel reserves its children for all the slot arguments at once when it is constructed, so
+				// pre-sizing the argument array is enough to avoid growing either of them slot by slot.
+				const int32 sizeHint = Mcro::Range::Detail::GetSizeHint(RangeRef);
+				if (sizeHint > 0)
+					args._Slots.Reserve(args._Slots.Num() + sizeHint);
+
+				for (auto it = RangeRef.begin(); !IteratorEquals(it, RangeRef.end()); ++it)
+					args._Slots.Emplace(TransformStorage(*it));
+			}
+			else
+			{
+				for (auto it = RangeRef.begin(); !IteratorEquals(it, RangeRef.end()); ++it)
+					args + TransformStorage(*it);
+			}
 		}
 
 		/** @copydoc TSlots */
@@ -16,9 +16,11 @@
 #include "Mcro/AssertMacros.h"
 #include "Mcro/Observable.h"
 #include "Mcro/Threading.h"
+#include "Mcro/Trace.h"
 #include "Mcro/Range.h"
 #include "Mcro/Range/Views.h"
 #include "Mcro/Range/Conversion.h"
+#include "Widgets/Views/SListView.h"
 
 namespace Mcro::Slate
 {
@@ -29,6 +31,14 @@ namespace Mcro::Slate
 
 	namespace Detail
 	{
+		/**
+		 *	@brief
+		 *	Find the longest strictly increasing subsequence of a sequence of distinct numbers in O(n log n).
+		 *
+		 *	@return  A mask with the same length as the sequence, where set bits mark the items of the subsequence
+		 */
+		MCRO_API TBitArray<> LongestIncreasingSubsequence(TConstArrayView<int32> sequence);
+
 		template <
 			typename Item,
 			CRangeMember Range,
@@ -59,6 +69,18 @@ namespace Mcro::Slate
 				TSharedRef<ChildWidget> const& child,
 				IndexType const& at
 			)>;
+
+			/**
+			 *	@brief
+			 *	Put a previously removed child back into the container for a different item. It should add the slot
+			 *	the same way CreateChild does, with `recycled` as its content, and rebind `recycled` to `from`.
+			 */
+			using FRecycleChild = TDelegate<ContainerSlotArguments(
+				TSharedRef<ContainerWidget> const& container,
+				TSharedRef<ChildWidget> const& recycled,
+				Item const& from,
+				IndexType const& at
+			)>;
 			
 		protected:
 			
@@ -66,10 +88,110 @@ namespace Mcro::Slate
 			FCreateChild CreateChild;
 			FUpdateChild UpdateChild;
 			FRemoveChild RemoveChild;
+			FRecycleChild RecycleChild;
 			TSharedPtr<ContainerWidget> Container;
+
+			/** @brief Removed children waiting to be recycled, only used when RecycleChild is bound */
+			TArray<TSharedRef<ChildWidget>> Pool;
+			int32 MaxPooledChildren = 0;
 			ChildrenRange Children;
+			bool bReconcilePending = false;
+
+			/** @brief A reconciliation is being planned on a worker thread */
+			bool bPlanInFlight = false;
+
+			/** @brief The state changed while a plan was in flight, reconcile again once it's applied */
+			bool bReplanRequested = false;
 			virtual void OnStateChange(Range const& next) = 0;
+
+			/**
+			 *	@brief
+			 *	Changes of the state only mark this widget dirty, and it's reconciled once with the latest state before
+			 *	the next time it's painted. Many changes in a single frame cost a single reconciliation.
+			 */
+			void RequestReconcile()
+			{
+				if (bReconcilePending) return;
+				bReconcilePending = true;
+				this->RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &TReactiveWidgetBase::ReconcileLatest));
+			}
+
+			EActiveTimerReturnType ReconcileLatest(double currentTime, float deltaTime)
+			{
+				MCRO_TRACE_SCOPE(Slate, "TReactiveWidget::Reconcile");
+				bReconcilePending = false;
+				if (bPlanInFlight)
+				{
+					bReplanRequested = true;
+					return EActiveTimerReturnType::Stop;
+				}
+				if (auto state = State.Pin())
+					ReconcileWith(*state);
+				return EActiveTimerReturnType::Stop;
+			}
+
+			void OnNotified(TChangeData<Range> const& change)
+			{
+				OnStateNotified(change);
+				RequestReconcile();
+			}
+
+			/** @brief Called on the game thread with every notification of the state, before reconciliation */
+			virtual void OnStateNotified(TChangeData<Range> const& change) {}
+
+			/** @brief Reconcile with the current value of the state, by default with a copy of the entire range */
+			virtual void ReconcileWith(IState<Range> const& state)
+			{
+				Range latest;
+				{
+					auto [value, lock] = state.GetOnAnyThread();
+					latest = value;
+				}
+				OnStateChange(latest);
+			}
 			
+			/**
+			 *	@brief
+			 *	Compute a reconciliation plan on a background thread, then apply it on the game thread through the
+			 *	time-sliced game thread queue. Reconciliations requested meanwhile are postponed until the plan is
+			 *	applied, so `plan` may safely read data which only `apply` modifies.
+			 *
+			 *	@param plan   Runs on a worker thread, it must not touch the widget
+			 *	@param apply  Runs on the game thread with the result of `plan`, only when this widget is still alive
+			 */
+			template <typename PlanFunction, typename ApplyFunction>
+			void PlanOffGameThread(PlanFunction&& plan, ApplyFunction&& apply)
+			{
+				bPlanInFlight = true;
+				TWeakPtr<SWidget> weakThis = this->AsShared();
+				RunInThread(ENamedThreads::AnyBackgroundThreadNormalTask, [
+					this, weakThis,
+					plan = Forward<PlanFunction>(plan),
+					apply = Forward<ApplyFunction>(apply)
+				]() mutable {
+					auto result = [&]
+					{
+						MCRO_TRACE_SCOPE(Slate, "TReactiveWidget::Plan");
+						return plan();
+					}();
+					QueueInGameThread([this, weakThis, result = MoveTemp(result), apply = MoveTemp(apply)]() mutable
+					{
+						TSharedPtr<SWidget> self = weakThis.Pin();
+						if (!self) return;
+						{
+							MCRO_TRACE_SCOPE(Slate, "TReactiveWidget::ApplyPlan");
+							apply(result);
+						}
+						bPlanInFlight = false;
+						if (bReplanRequested)
+						{
+							bReplanRequested = false;
+							RequestReconcile();
+						}
+					}, EGameThreadQueuePriority::High);
+				});
+			}
+
 			static void DefaultRemoveChild(FRemoveChild& delegate)
 			{
 				if constexpr (requires(ContainerWidget& container, TSharedRef<SWidget> child)
@@ -86,14 +208,37 @@ namespace Mcro::Slate
 				}
 			}
 
+			/** @brief Create a child for an item, or recycle one from the pool when there's any */
+			TSharedRef<ChildWidget> AddChild(TSharedRef<ContainerWidget> const& container, Item const& item, IndexType const& at)
+			{
+				typename ContainerWidget::FSlot* newSlot = nullptr;
+				if (RecycleChild.IsBound() && !Pool.IsEmpty())
+				{
+					TSharedRef<ChildWidget> recycled = Pool.Pop(EAllowShrinking::No);
+					RecycleChild.Execute(container, recycled, item, at).Expose(newSlot);
+				}
+				else CreateChild.Execute(container, item, at).Expose(newSlot);
+				return StaticCastSharedRef<ChildWidget>(newSlot->GetWidget());
+			}
+
+			/** @brief Remove a child from the container, and park it in the pool when it can be recycled later */
+			void DismissChild(TSharedRef<ContainerWidget> const& container, TSharedRef<ChildWidget> const& child, IndexType const& at)
+			{
+				RemoveChild.Execute(container, child, at);
+				if (RecycleChild.IsBound() && Pool.Num() < MaxPooledChildren)
+					Pool.Add(child);
+			}
+
 			template <CWidgetArguments ThisArguments>
 			requires requires(ThisArguments& args)
 			{
-				{ args._State }       -> CSameAsDecayed< IStatePtr<Range> >;
-				{ args._Container }   -> CSameAsDecayed< TSharedPtr<ContainerWidget> >;
-				{ args._CreateChild } -> CSameAsDecayed< FCreateChild >;
-				{ args._UpdateChild } -> CSameAsDecayed< FUpdateChild >;
-				{ args._RemoveChild } -> CSameAsDecayed< FRemoveChild >;
+				{ args._State }             -> CSameAsDecayed< IStatePtr<Range> >;
+				{ args._Container }         -> CSameAsDecayed< TSharedPtr<ContainerWidget> >;
+				{ args._CreateChild }       -> CSameAsDecayed< FCreateChild >;
+				{ args._UpdateChild }       -> CSameAsDecayed< FUpdateChild >;
+				{ args._RemoveChild }       -> CSameAsDecayed< FRemoveChild >;
+				{ args._RecycleChild }      -> CSameAsDecayed< FRecycleChild >;
+				{ args._MaxPooledChildren } -> CSameAsDecayed< int32 >;
 			}
 			void ConstructBase(ThisArguments const& args)
 			{
@@ -107,24 +252,15 @@ namespace Mcro::Slate
 				CreateChild = args._CreateChild;
 				UpdateChild = args._UpdateChild;
 				RemoveChild = args._RemoveChild;
+				RecycleChild = args._RecycleChild;
+				MaxPooledChildren = args._MaxPooledChildren;
 		
 				ChildSlot[Container.ToSharedRef()];
 
-				args._State->OnChange(this, [this](Range const& next)
-				{
-					if (IsInGameThread()) OnStateChange(next);
-					else
-					{
-						RunInGameThread(WeakSelf(this), [this]
-						{
-							if (auto state = State.Pin())
-							{
-								auto [value, lock] = state->GetOnAnyThread();
-								OnStateChange(value);
-							}
-						});
-					}
-				});
+				args._State->OnChangeInThread(
+					ENamedThreads::GameThread,
+					TDelegate<void(TChangeData<Range> const&)>::CreateSP(this, &TReactiveWidgetBase::OnNotified)
+				);
 			}
 		};
 	}
@@ -133,10 +269,24 @@ namespace Mcro::Slate
 	 *	@brief
 	 *	A widget template which can automatically handle changes in an input array state, with given delegates which
 	 *	tell this widget how children are supposed to be created, updated and removed.
+	 *
+	 *	By default children are matched with items by their index, so inserting or removing an item updates every
+	 *	child after it. When a `KeyOf` selector is given, children are matched by the key of their item instead, and
+	 *	only the affected slots are touched: children of removed items are removed, new items are created at their
+	 *	index (so `CreateChild` should insert the slot at `at`), and the minimum number of children are moved, keeping
+	 *	the longest run which is already in order. Moves are done by `MoveChild` (with the current and the target
+	 *	index of the slot) or when that's not bound, by removing and re-creating the moved children. Keys should be
+	 *	unique, children of repeated keys are re-created on every change.
+	 *
+	 *	With `PlanOffGameThread` (and a `KeyOf` selector) the state is copied and diffed on a worker thread, which
+	 *	produces an edit script of removals, moves and insertions. Only executing that script (calling the child
+	 *	delegates) happens on the game thread, through the time-sliced QueueInGameThread. `KeyOf` must be safe to call
+	 *	from any thread then.
 	 *	
 	 *	@tparam            Item  The type of the items which are transformed into child widgets. 
 	 *	@tparam ContainerWidget  The panel which provides the slots for the child widgets.
 	 *	@tparam     ChildWidget  The storage type of child widgets, it's fine to leave it SWidget
+	 *	@tparam             Key  The type `KeyOf` identifies items with
 	 */
 	template <
 		typename Item,
@@ -145,7 +295,8 @@ namespace Mcro::Slate
 		typename Base = Detail::TReactiveWidgetBase<
 			Item, TArray<Item>,
 			ContainerWidget, ChildWidget, TArray<TSharedRef<ChildWidget>>, int32
-		>
+		>,
+		typename Key = uint64
 	>
 	class TArrayReactiveWidget : public Base
 	{
@@ -153,9 +304,19 @@ namespace Mcro::Slate
 		using FCreateChild = Base::FCreateChild;
 		using FUpdateChild = Base::FUpdateChild;
 		using FRemoveChild = Base::FRemoveChild;
+		using FRecycleChild = Base::FRecycleChild;
 		using ContainerSlotArguments = Base::ContainerSlotArguments;
+
+		using FKeyOf = TDelegate<Key(Item const& item)>;
+		using FMoveChild = TDelegate<void(
+			TSharedRef<ContainerWidget> const& container,
+			TSharedRef<ChildWidget> const& child,
+			int32 from, int32 to
+		)>;
 		
 		SLATE_BEGIN_ARGS(TArrayReactiveWidget)
+			: _MaxPooledChildren(64)
+			, _PlanOffGameThread(false)
 			{
 				Base::DefaultRemoveChild(_RemoveChild);
 			}
@@ -164,13 +325,104 @@ namespace Mcro::Slate
 			SLATE_EVENT(FCreateChild, CreateChild);
 			SLATE_EVENT(FUpdateChild, UpdateChild);
 			SLATE_EVENT(FRemoveChild, RemoveChild);
+			SLATE_EVENT(FRecycleChild, RecycleChild);
+
+			/** @brief How many removed children are kept for recycling, when RecycleChild is bound */
+			SLATE_ARGUMENT(int32, MaxPooledChildren);
+			SLATE_EVENT(FKeyOf, KeyOf);
+			SLATE_EVENT(FMoveChild, MoveChild);
+
+			/** @brief Diff keyed states on a worker thread, and only apply the result on the game thread */
+			SLATE_ARGUMENT(bool, PlanOffGameThread);
 		SLATE_END_ARGS()
 
-		void Construct(FArguments const& args) { Base::ConstructBase(args); }
+		void Construct(FArguments const& args)
+		{
+			KeyOf = args._KeyOf;
+			MoveChild = args._MoveChild;
+			bPlanOffGameThread = args._PlanOffGameThread;
+			Base::ConstructBase(args);
+		}
 
 	protected:
+		FKeyOf KeyOf;
+		FMoveChild MoveChild;
+		bool bPlanOffGameThread = false;
+
+		/**
+		 *	@brief
+		 *	Keys of the items the children were created from, in the order of the children. It's shared with plans in
+		 *	flight, and it's replaced (not modified) when a plan is applied.
+		 */
+		TSharedRef<TArray<Key>> ChildKeys = MakeShared<TArray<Key>>();
+
+		/** @brief The edit script transforming the children of one keyed state into the children of the next */
+		struct FKeyedPlan
+		{
+			struct FMove
+			{
+				/** @brief Index of the moving child before this plan */
+				int32 Child;
+				int32 From;
+
+				/** @brief INDEX_NONE when the child is re-created instead, because MoveChild is not bound */
+				int32 To;
+			};
+
+			/** @brief Indices of the children without a matching item, in descending order */
+			TArray<int32> Removed;
+			TArray<FMove> Moves;
+
+			/** @brief For each next item the index of the child reused for it, or INDEX_NONE for new children */
+			TArray<int32> Sources;
+			TArray<Key> NextKeys;
+		};
+
+		virtual void ReconcileWith(IState<typename Base::StateRangeType> const& state) override
+		{
+			if (!bPlanOffGameThread || !KeyOf.IsBound())
+			{
+				Base::ReconcileWith(state);
+				return;
+			}
+
+			using FRange = typename Base::StateRangeType;
+			struct FResult
+			{
+				TSharedPtr<const FRange> Next;
+				FKeyedPlan Plan;
+			};
+			Base::PlanOffGameThread(
+				[weakState = Base::State, previousKeys = ChildKeys, keyOf = KeyOf, canMove = MoveChild.IsBound()]
+				{
+					FResult result;
+					if (auto state = weakState.Pin())
+					{
+						auto [value, lock] = state->GetOnAnyThread();
+						result.Next = MakeShared<const FRange>(value);
+					}
+					if (result.Next)
+						result.Plan = PlanByKey(*previousKeys, *result.Next, keyOf, canMove);
+					return result;
+				},
+				[this](FResult& result)
+				{
+					if (result.Next) ApplyPlan(result.Plan, *result.Next);
+				}
+			);
+		}
+
 		virtual void OnStateChange(Base::StateRangeType const& next) override
 		{
+			if (KeyOf.IsBound())
+				ReconcileByKey(next);
+			else
+				ReconcileByIndex(next);
+		}
+
+		void ReconcileByIndex(Base::StateRangeType const& next)
+		{
+			auto container = Base::Container.ToSharedRef();
 			for (int i = 0; i < FMath::Max(next.Num(), Base::Children.Num()); ++i)
 			{
 				if (next.IsValidIndex(i) && Base::Children.IsValidIndex(i))
@@ -180,19 +432,165 @@ namespace Mcro::Slate
 				}
 				if (next.IsValidIndex(i))
 				{
-					typename ContainerWidget::FSlot* newSlot = nullptr;
-					Base::CreateChild.Execute(Base::Container, next[i], i).Expose(newSlot);
-					Base::Children.Add(StaticCastSharedRef<ChildWidget>(newSlot->GetWidget()));
+					Base::Children.Add(Base::AddChild(container, next[i], i));
 					continue;
 				}
 				if (Base::Children.IsValidIndex(i))
 				{
-					Base::RemoveChild.Execute(Base::Container, Base::Children[i], i);
+					Base::DismissChild(container, Base::Children[i], i);
 				}
 			}
 			if (Base::Children.Num() > next.Num()) Base::Children.SetNum(next.Num());
 		}
+
+		void ReconcileByKey(Base::StateRangeType const& next)
+		{
+			FKeyedPlan plan = PlanByKey(*ChildKeys, next, KeyOf, MoveChild.IsBound());
+			ApplyPlan(plan, next);
+		}
+
+		/** @brief Diff the keys of the current children with the next items, it doesn't touch any widget */
+		static FKeyedPlan PlanByKey(
+			TArray<Key> const& previousKeys,
+			typename Base::StateRangeType const& next,
+			FKeyOf const& keyOf,
+			bool canMove
+		) {
+			FKeyedPlan plan;
+			const int32 previousNum = previousKeys.Num();
+			const int32 nextNum = next.Num();
+
+			TMap<Key, int32> previousIndices;
+			previousIndices.Reserve(previousNum);
+			for (int32 i = 0; i < previousNum; ++i)
+			{
+				if (!previousIndices.Contains(previousKeys[i]))
+					previousIndices.Add(previousKeys[i], i);
+			}
+
+			// Match items with the children of the same key
+			TArray<Key>& nextKeys = plan.NextKeys;
+			nextKeys.Reserve(nextNum);
+			TArray<int32>& sources = plan.Sources;
+			sources.Init(INDEX_NONE, nextNum);
+			TBitArray<> kept(false, previousNum);
+			for (int32 i = 0; i < nextNum; ++i)
+			{
+				Key key = keyOf.Execute(next[i]);
+				if (const int32* previous = previousIndices.Find(key); previous && !kept[*previous])
+				{
+					sources[i] = *previous;
+					kept[*previous] = true;
+				}
+				nextKeys.Add(MoveTemp(key));
+			}
+
+			// Remove children without a matching item, backwards so indices of the remaining ones stay valid
+			for (int32 i = previousNum - 1; i >= 0; --i)
+			{
+				if (!kept[i]) plan.Removed.Add(i);
+			}
+
+			// Order of the kept children in the container, and the order they should be in
+			TArray<int32> working;
+			TArray<int32> compacted;
+			compacted.Init(INDEX_NONE, previousNum);
+			for (int32 i = 0; i < previousNum; ++i)
+			{
+				if (!kept[i]) continue;
+				compacted[i] = working.Num();
+				working.Add(i);
+			}
+			TArray<int32> targetOrder;
+			TArray<int32> targetItems;
+			for (int32 i = 0; i < nextNum; ++i)
+			{
+				if (sources[i] == INDEX_NONE) continue;
+				targetOrder.Add(compacted[sources[i]]);
+				targetItems.Add(i);
+			}
+
+			// Children in the longest increasing run stay, the rest move in front of their successor
+			const TBitArray<> stable = Detail::LongestIncreasingSubsequence(targetOrder);
+			int32 anchor = INDEX_NONE;
+			for (int32 k = targetOrder.Num() - 1; k >= 0; --k)
+			{
+				const int32 moving = sources[targetItems[k]];
+				if (!stable[k])
+				{
+					const int32 from = working.Find(moving);
+					working.RemoveAt(from, EAllowShrinking::No);
+					if (!canMove)
+					{
+						plan.Moves.Add({ moving, from, INDEX_NONE });
+						sources[targetItems[k]] = INDEX_NONE;
+						continue;
+					}
+					const int32 to = anchor == INDEX_NONE ? working.Num() : working.Find(anchor);
+					working.Insert(moving, to);
+					plan.Moves.Add({ moving, from, to });
+				}
+				anchor = moving;
+			}
+			return plan;
+		}
+
+		/** @brief Execute an edit script made by PlanByKey with the child delegates */
+		void ApplyPlan(FKeyedPlan& plan, typename Base::StateRangeType const& next)
+		{
+			auto container = Base::Container.ToSharedRef();
+			auto& children = Base::Children;
+
+			for (int32 removed : plan.Removed)
+				Base::DismissChild(container, children[removed], removed);
+
+			// MoveChild may have been unbound since an off-thread plan was made, re-create these children instead
+			TBitArray<> recreated(false, children.Num());
+			const bool canMove = MoveChild.IsBound();
+			for (typename FKeyedPlan::FMove const& move : plan.Moves)
+			{
+				if (move.To == INDEX_NONE || !canMove)
+				{
+					Base::DismissChild(container, children[move.Child], move.From);
+					recreated[move.Child] = true;
+				}
+				else MoveChild.Execute(container, children[move.Child], move.From, move.To);
+			}
+
+			// Kept children are in order now, new children can be inserted at their final index
+			TArray<TSharedRef<ChildWidget>> nextChildren;
+			nextChildren.Reserve(next.Num());
+			for (int32 i = 0; i < next.Num(); ++i)
+			{
+				const int32 source = plan.Sources[i];
+				if (source == INDEX_NONE || recreated[source])
+				{
+					nextChildren.Add(Base::AddChild(container, next[i], i));
+					continue;
+				}
+				Base::UpdateChild.ExecuteIfBound(children[source], next[i], i);
+				nextChildren.Add(children[source]);
+			}
+			children = MoveTemp(nextChildren);
+			ChildKeys = MakeShared<TArray<Key>>(MoveTemp(plan.NextKeys));
+		}
 	};
+
+	/** @brief A TArrayReactiveWidget keeping children matched with items by a `Key` type other than uint64 */
+	template <
+		typename Item,
+		typename Key,
+		CWidgetWithSlots ContainerWidget = SWidget,
+		CWidget ChildWidget = SWidget
+	>
+	using TKeyedArrayReactiveWidget = TArrayReactiveWidget<
+		Item, ContainerWidget, ChildWidget,
+		Detail::TReactiveWidgetBase<
+			Item, TArray<Item>,
+			ContainerWidget, ChildWidget, TArray<TSharedRef<ChildWidget>>, int32
+		>,
+		Key
+	>;
 	
 	/**
 	 *	@brief
@@ -219,8 +617,10 @@ namespace Mcro::Slate
 		using FCreateChild = Base::FCreateChild;
 		using FUpdateChild = Base::FUpdateChild;
 		using FRemoveChild = Base::FRemoveChild;
+		using FRecycleChild = Base::FRecycleChild;
 		
 		SLATE_BEGIN_ARGS(TMapReactiveWidget)
+			: _MaxPooledChildren(64)
 			{
 				Base::DefaultRemoveChild(_RemoveChild);
 			}
@@ -229,11 +629,73 @@ namespace Mcro::Slate
 			SLATE_EVENT(FCreateChild, CreateChild);
 			SLATE_EVENT(FUpdateChild, UpdateChild);
 			SLATE_EVENT(FRemoveChild, RemoveChild);
+			SLATE_EVENT(FRecycleChild, RecycleChild);
+
+			/** @brief How many removed children are kept for recycling, when RecycleChild is bound */
+			SLATE_ARGUMENT(int32, MaxPooledChildren);
 		SLATE_END_ARGS()
 
 		void Construct(FArguments const& args) { Base::ConstructBase(args); }
 
 	protected:
+		/** @brief Keys changed since the last reconciliation, when every change came with delta data */
+		TSet<Key> PendingKeys;
+		bool bPendingFullReconcile = false;
+
+		virtual void OnStateNotified(TChangeData<typename Base::StateRangeType> const& change) override
+		{
+			if (!change.HasDelta)
+			{
+				bPendingFullReconcile = true;
+				PendingKeys.Reset();
+			}
+			else if (!bPendingFullReconcile)
+			{
+				for (auto const& entry : change.Delta)
+					PendingKeys.Add(entry.Key);
+			}
+		}
+
+		/** @brief Only look at the changed keys when the state was modified through its element operations */
+		virtual void ReconcileWith(IState<typename Base::StateRangeType> const& state) override
+		{
+			if (bPendingFullReconcile)
+			{
+				bPendingFullReconcile = false;
+				Base::ReconcileWith(state);
+				return;
+			}
+
+			TArray<TTuple<Key, TOptional<Item>>> changes;
+			changes.Reserve(PendingKeys.Num());
+			{
+				auto [value, lock] = state.GetOnAnyThread();
+				for (Key const& changed : PendingKeys)
+				{
+					Item const* item = value.Find(changed);
+					changes.Emplace(changed, item ? TOptional<Item>(*item) : TOptional<Item>());
+				}
+			}
+			PendingKeys.Reset();
+
+			auto container = Base::Container.ToSharedRef();
+			for (auto const& [changed, item] : changes)
+			{
+				if (TSharedRef<ChildWidget>* child = Base::Children.Find(changed))
+				{
+					if (item.IsSet())
+						Base::UpdateChild.ExecuteIfBound(*child, item.GetValue(), changed);
+					else
+					{
+						Base::DismissChild(container, *child, changed);
+						Base::Children.Remove(changed);
+					}
+				}
+				else if (item.IsSet())
+					Base::Children.Add(changed, Base::AddChild(container, item.GetValue(), changed));
+			}
+		}
+
 		virtual void OnStateChange(Base::StateRangeType const& next) override
 		{
 			auto update = next
@@ -257,7 +719,7 @@ namespace Mcro::Slate
 			;
 			for (Key const& dismissing : dismiss)
 			{
-				Base::RemoveChild.Execute(Base::Container, Base::Children[dismissing], dismissing);
+				Base::DismissChild(Base::Container.ToSharedRef(), Base::Children[dismissing], dismissing);
 				Base::Children.Remove(dismissing);
 			}
 			auto add = next
@@ -269,10 +731,107 @@ namespace Mcro::Slate
 			;
 			for (Key const& adding : add)
 			{
-				typename ContainerWidget::FSlot* newSlot = nullptr;
-				Base::CreateChild.Execute(Base::Container, next[adding], adding).Expose(newSlot);
-				Base::Children.Add(adding, StaticCastSharedRef<ChildWidget>(newSlot->GetWidget()));
+				Base::Children.Add(adding, Base::AddChild(Base::Container.ToSharedRef(), next[adding], adding));
+			}
+		}
+	};
+
+	/**
+	 *	@brief
+	 *	A virtualized list following an input array state. Unlike TArrayReactiveWidget it doesn't create a widget for
+	 *	every item, it's built on SListView so rows are only generated for the items in view, and they're released
+	 *	again when scrolled out of it.
+	 *
+	 *	On a state change rows keep their widget as long as the item at their index stays the same (when Item has an
+	 *	equality operator), and only changed items in view are generated again. Like the other reactive widgets, rows
+	 *	are refreshed at most once per frame, before the list is painted.
+	 *
+	 *	@tparam Item  The type of the items which are displayed in rows
+	 */
+	template <typename Item>
+	class TListReactiveWidget : public SCompoundWidget
+	{
+	public:
+		using FRowItem = TSharedPtr<Item>;
+		using FListView = SListView<FRowItem>;
+		using FGenerateRow = TDelegate<TSharedRef<ITableRow>(
+			Item const& item,
+			TSharedRef<STableViewBase> const& owner
+		)>;
+
+		SLATE_BEGIN_ARGS(TListReactiveWidget)
+			: _SelectionMode(ESelectionMode::None)
+		{}
+			SLATE_ARGUMENT(IStatePtr<TArray<Item>>, State);
+			SLATE_ARGUMENT(TSharedPtr<SHeaderRow>, HeaderRow);
+			SLATE_ARGUMENT(ESelectionMode::Type, SelectionMode);
+			SLATE_EVENT(FGenerateRow, GenerateRow);
+		SLATE_END_ARGS()
+
+		void Construct(FArguments const& args)
+		{
+			ASSERT_CRASH(args._State);
+			ASSERT_CRASH(args._GenerateRow.IsBound());
+
+			State = args._State.ToWeakPtr();
+			GenerateRow = args._GenerateRow;
+
+			ChildSlot
+			[
+				SAssignNew(ListView, FListView)
+				. ListItemsSource(&Rows)
+				. SelectionMode(args._SelectionMode)
+				. HeaderRow(args._HeaderRow)
+				. OnGenerateRow(this, &TListReactiveWidget::OnGenerateRow)
+			];
+
+			OnStateChange(args._State->Get());
+			args._State->OnChangeInThread(ENamedThreads::GameThread, this, [this](TArray<Item> const&)
+			{
+				if (bRefreshPending) return;
+				bRefreshPending = true;
+				RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &TListReactiveWidget::RefreshLatest));
+			});
+		}
+
+		TSharedPtr<FListView> GetListView() const { return ListView; }
+
+	protected:
+		IStateWeakPtr<TArray<Item>> State;
+		FGenerateRow GenerateRow;
+		TSharedPtr<FListView> ListView;
+		TArray<FRowItem> Rows;
+		bool bRefreshPending = false;
+
+		EActiveTimerReturnType RefreshLatest(double currentTime, float deltaTime)
+		{
+			bRefreshPending = false;
+			if (auto state = State.Pin())
+			{
+				auto [value, lock] = state->GetOnAnyThread();
+				OnStateChange(value);
+			}
+			return EActiveTimerReturnType::Stop;
+		}
+
+		TSharedRef<ITableRow> OnGenerateRow(FRowItem item, TSharedRef<STableViewBase> const& owner)
+		{
+			return GenerateRow.Execute(*item, owner);
+		}
+
+		void OnStateChange(TArray<Item> const& next)
+		{
+			Rows.SetNum(next.Num());
+			for (int32 i = 0; i < next.Num(); ++i)
+			{
+				if constexpr (requires(Item const& a, Item const& b) { { a == b } -> CConvertibleTo<bool>; })
+				{
+					if (Rows[i] && *Rows[i] == next[i]) continue;
+				}
+				// A new row item makes the list view generate a new widget for it, when it's in view
+				Rows[i] = MakeShared<Item>(next[i]);
 			}
+			ListView->RequestListRefresh();
 		}
 	};
 }
@@ -0,0 +1,105 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Slate.h"
+#include "Mcro/Observable.h"
+#include "Templates/Invoke.h"
+
+/**
+ *	@file
+ *	Push state changes into Slate widgets instead of letting Slate poll bound attributes. Widgets bound this way can
+ *	stay cached inside invalidation panels (or with global invalidation) until the data they show actually changes.
+ *
+ *	@code
+ *	TSharedPtr<STextBlock> label;
+ *	ChildSlot
+ *	[
+ *		SAssignNew(label, STextBlock)
+ *		. Text(AttributeFromState(Model->Title))
+ *	];
+ *	BindState(label.ToSharedRef(), Model->Title, &STextBlock::SetText, EInvalidateWidgetReason::Layout);
+ *	@endcode
+ */
+namespace Mcro::Slate
+{
+	using namespace Mcro::Observable;
+
+	/**
+	 *	@brief
+	 *	Get the current value of a state as an attribute which is not bound to a getter. Slate doesn't need to poll
+	 *	such attributes, use `BindState` to update the widget when the state changes.
+	 */
+	template <typename T>
+	TAttribute<T> AttributeFromState(IStateRef<T> const& state)
+	{
+		return TAttribute<T>(state->Get());
+	}
+
+	/**
+	 *	@brief
+	 *	Invalidate a widget with the given reason every time a state changes. Use it for widgets which read the state
+	 *	themselves during paint or layout. Notifications are received on the game thread and the widget is only
+	 *	weakly referenced.
+	 *
+	 *	@return  The handle of the listener on the state
+	 */
+	template <CWidget Widget, typename T>
+	FDelegateHandle InvalidateOnChange(
+		TSharedRef<Widget> const& widget,
+		IStateRef<T> const& state,
+		EInvalidateWidgetReason reason = EInvalidateWidgetReason::Paint
+	) {
+		return state->OnChangeInThread(
+			ENamedThreads::GameThread,
+			TDelegate<void(TChangeData<T> const&)>::CreateSPLambda(widget, [weakWidget = widget.ToWeakPtr(), reason](TChangeData<T> const&)
+			{
+				if (auto pinned = weakWidget.Pin())
+					pinned->Invalidate(reason);
+			})
+		);
+	}
+
+	/**
+	 *	@brief
+	 *	Apply the value of a state to a widget via `setter` and invalidate it with the given reason, every time the
+	 *	state changes. Notifications are received on the game thread and the widget is only weakly referenced. The
+	 *	current value is not applied immediately, use `AttributeFromState` for that in the declarative syntax.
+	 *
+	 *	@param   widget  The widget receiving the value
+	 *	@param    state  The source of the value
+	 *	@param   setter  Called as `setter(Widget&, T const&)`, member functions like `&STextBlock::SetText` work too
+	 *	@param   reason  How the widget is invalidated after a new value has been set
+	 *	@return  The handle of the listener on the state
+	 */
+	template <CWidget Widget, typename T, typename Setter>
+	requires std::is_invocable_v<Setter, Widget&, T const&>
+	FDelegateHandle BindState(
+		TSharedRef<Widget> const& widget,
+		IStateRef<T> const& state,
+		Setter&& setter,
+		EInvalidateWidgetReason reason = EInvalidateWidgetReason::Paint
+	) {
+		return state->OnChangeInThread(
+			ENamedThreads::GameThread,
+			TDelegate<void(TChangeData<T> const&)>::CreateSPLambda(widget, [weakWidget = widget.ToWeakPtr(), setter = FWD(setter), reason](TChangeData<T> const& change)
+			{
+				if (auto pinned = weakWidget.Pin())
+				{
+					Invoke(setter, *pinned, change.Next);
+					pinned->Invalidate(reason);
+				}
+			})
+		);
+	}
+}
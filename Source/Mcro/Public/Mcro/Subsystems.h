@@ -23,6 +23,8 @@
 #include "Mcro/AssertMacros.h"
 #include "Kismet/GameplayStatics.h"
 
+#include <atomic>
+
 namespace Mcro::Subsystems
 {
 	using namespace Mcro::Concepts;
@@ -49,6 +51,19 @@ namespace Mcro::Subsystems
 		UseFirstWorldContext,
 	};
 
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Incremented when a world is initialized or cleaned up, a game instance is started or garbage has been
+		 *	collected, invalidating every TSubsystemCache entry.
+		 */
+		extern MCRO_API std::atomic<uint32> GSubsystemCacheEpoch;
+
+		MCRO_API void StartSubsystemCacheInvalidation();
+		MCRO_API void StopSubsystemCacheInvalidation();
+	}
+
 	/** @brief Extra namespace encapsulates common vocabulary */
 	namespace Subsystems
 	{
@@ -217,4 +232,71 @@ namespace Mcro::Subsystems
 			return cdo->ShouldCreateSubsystem(outer);
 		}
 	}
+
+	/**
+	 *	@brief
+	 *	Memoizes the result of `Subsystems::Get<T>` until worlds or game instances change, or garbage is collected, so
+	 *	repeated lookups are a small map lookup. The result is kept for each context object (its world if it has one),
+	 *	so looking up subsystems of multiple worlds or PIE instances doesn't evict each other. It is meant to be used
+	 *	from the game thread only.
+	 *
+	 *	@code
+	 *	UMyGameInstanceSubsystem* subsystem = TSubsystemCache<UMyGameInstanceSubsystem>::Get(this);
+	 *	@endcode
+	 *
+	 *	@tparam T  UGameInstanceSubsystem or UWorldSubsystem derivative
+	 */
+	template <CSubsystem T>
+	requires CGameInstanceSubsystem<T> || CWorldSubsystem<T>
+	struct TSubsystemCache
+	{
+		/**
+		 *	@brief  Cached version of `Subsystems::Get<T>` accepting the same arguments
+		 *	@return Subsystem if exists or nullptr
+		 */
+		template <typename... Args>
+		static T* Get(const UObject* worldContextObject = nullptr, Args... args)
+		{
+			// Actors, components and worlds are resolved to their world, so they share the cache entry
+			const UObject* key = worldContextObject ? worldContextObject->GetWorld() : nullptr;
+			if (!key) key = worldContextObject;
+
+			const uint32 epoch = Detail::GSubsystemCacheEpoch.load(std::memory_order_relaxed);
+			FCache& cache = GetCache();
+			if (cache.Epoch != epoch)
+			{
+				cache.Epoch = epoch;
+				cache.Entries.Reset();
+			}
+			if (T* const* cached = cache.Entries.Find(key)) [[likely]]
+				return *cached;
+
+			T* result = Subsystems::Get<T>(worldContextObject, args...);
+			if (result) cache.Entries.Add(key, result);
+			return result;
+		}
+
+	private:
+		struct FCache
+		{
+			uint32 Epoch = 0;
+			TMap<const UObject*, T*, TInlineSetAllocator<4>> Entries;
+		};
+
+		static FCache& GetCache()
+		{
+			static FCache cache;
+			return cache;
+		}
+	};
+
+	namespace Subsystems
+	{
+		/** @brief Shorthand for TSubsystemCache<T>::Get */
+		template <CSubsystem T, typename... Args>
+		T* GetCached(Args... args)
+		{
+			return TSubsystemCache<T>::Get(args...);
+		}
+	}
 }
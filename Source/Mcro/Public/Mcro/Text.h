@@ -14,10 +14,12 @@
 #include <string>
 
 #include "CoreMinimal.h"
+#include "Misc/StringBuilder.h"
 
 #include "Mcro/Concepts.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/TypeName.h"
+#include "Mcro/Text/Transcode.h"
 
 #ifndef MCRO_TEXT_ALLOW_UNSUPPORTED_STRING_CONVERSION
 /**
@@ -144,6 +146,17 @@ namespace Mcro::Text
 					getLength()
 				);
 			}
+			else if constexpr (CTranscodable<CharOutput, CharFrom>)
+			{
+				const int32 length = static_cast<int32>(getLength());
+				TArray<CharOutput, TInlineAllocator<512>> buffer;
+				buffer.SetNumUninitialized(MaxTranscodedLength<CharOutput, CharFrom>(length));
+				const int32 written = Transcode(
+					buffer.GetData(), buffer.Num(),
+					reinterpret_cast<const CharFrom*>(getPtr()), length
+				);
+				return construct(buffer.GetData(), written);
+			}
 			else
 			{
 				auto conversion = StringCast<CharOutput>(
@@ -194,19 +207,55 @@ namespace Mcro::Text
 		);
 	}
 	
-	/** @brief Create a copy of an input STL string as an FName */
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Get an FName from a thread-local cache keyed by the XXH3 hash of the raw characters of a string, and only
+		 *	call `makeName` (which goes through the global name table) when the current thread hasn't seen that string
+		 *	yet.
+		 *
+		 *	The cache is direct-mapped and fixed size, so colliding strings simply evict each other. Entries are
+		 *	matched by their hash and character type first, then by comparing their bytes. Strings longer than 256
+		 *	bytes are not cached.
+		 *
+		 *	@param     data  Pointer to the characters of the string
+		 *	@param     size  Size of the string in bytes
+		 *	@param charType  Compile time hash of the character type, so the same bytes in different encodings don't
+		 *	                 share an entry
+		 *	@param makeName  Construct the FName on a cache miss
+		 */
+		MCRO_API FName FindOrAddCachedName(const void* data, int32 size, FTypeHash charType, TFunctionRef<FName()> makeName);
+	}
+
+	/**
+	 *	@brief
+	 *	Create a copy of an input STL string as an FName. Repeated conversions of the same string on the same thread
+	 *	are served from a thread-local cache instead of the global name table.
+	 */
 	MCRO_API FName UnrealNameCopy(FStdStringView const& stdStr);
-	
 
-	/** @brief Create a copy and convert an input STL string to TCHAR as an FName */
+	/**
+	 *	@brief
+	 *	Create a copy and convert an input STL string to TCHAR as an FName. Repeated conversions of the same string on
+	 *	the same thread are served from a thread-local cache, skipping both the conversion and the global name table.
+	 */
 	template <CStdStringOrViewInvariant T>
 	FName UnrealNameConvert(T const& stdStr)
 	{
-		return Detail::HighLevelStringCast<typename T::value_type, TCHAR>(
-			stdStr,
-			[&] { return stdStr.data(); },
-			[&] { return stdStr.length(); },
-			[](const TCHAR* ptr, int32 len) { return FName(len, ptr); }
+		using CharType = typename T::value_type;
+		return Detail::FindOrAddCachedName(
+			stdStr.data(), static_cast<int32>(stdStr.length() * sizeof(CharType)),
+			GetCompileTimeTypeHash<CharType>(),
+			[&]
+			{
+				return Detail::HighLevelStringCast<CharType, TCHAR>(
+					stdStr,
+					[&] { return stdStr.data(); },
+					[&] { return stdStr.length(); },
+					[](const TCHAR* ptr, int32 len) { return FName(len, ptr); }
+				);
+			}
 		);
 	}
 
@@ -257,6 +306,196 @@ namespace Mcro::Text
 		return StdConvert<ConvertTo>(name.ToString());
 	}
 
+	/**
+	 *	@brief
+	 *	A character buffer on the stack which only falls back to the heap for longer strings. Use it as the output of
+	 *	the buffer overloads of `UnrealConvert`, `UnrealCopy` and `StdConvert`. It is not null-terminated.
+	 */
+	template <typename CharType, int32 InlineCount = 128>
+	using TInlineCharBuffer = TArray<CharType, TInlineAllocator<InlineCount>>;
+
+	/** @brief View the characters of a character buffer via an STL string view */
+	template <CChar CharType, typename Allocator>
+	auto StdView(TArray<CharType, Allocator> const& buffer)
+	{
+		return TStdStringView<CharType>(buffer.GetData(), buffer.Num());
+	}
+
+	namespace Detail
+	{
+		template <typename Target>
+		struct TBufferCharType { using Type = typename Target::ElementType; };
+
+		template <typename CharType, typename Traits, typename Allocator>
+		struct TBufferCharType<TStdString<CharType, Traits, Allocator>> { using Type = CharType; };
+
+		/**
+		 *	@brief
+		 *	Append characters of any encoding to a character buffer, converted to the character type of the buffer.
+		 *	Arrays, STL strings and string builders are grown once and converted into in-place. Other targets (like
+		 *	FString) get the result of a `StringCast` appended, which only allocates for strings longer than 128
+		 *	characters. Conversions between TCHAR and UTF-8 or ANSI go through `Transcode` instead of the platform
+		 *	converter, so runs of ASCII characters are converted with vector instructions.
+		 */
+		template <typename CharFrom, typename Target>
+		void AppendConvertedChars(Target& target, const CharFrom* source, int32 length)
+		{
+			using CharTo = typename TBufferCharType<Target>::Type;
+			if (length <= 0) return;
+
+			auto convertInPlace = [&](CharTo* destination, int32 destinationLength)
+			{
+				if constexpr (CSameAs<CharFrom, CharTo>)
+					FMemory::Memcpy(destination, source, length * sizeof(CharTo));
+				else
+					FPlatformString::Convert(destination, destinationLength, source, length);
+			};
+			auto getConvertedLength = [&]
+			{
+				if constexpr (CSameAs<CharFrom, CharTo>)
+					return length;
+				else
+					return FPlatformString::ConvertedLength<CharTo>(source, length);
+			};
+
+			if constexpr (CTranscodable<CharTo, CharFrom>)
+			{
+				// Grow by the worst case, convert in-place, then give back what wasn't used
+				const int32 capacity = MaxTranscodedLength<CharTo, CharFrom>(length);
+				if constexpr (requires { target.resize(target.size()); target.data(); })
+				{
+					const size_t start = target.size();
+					target.resize(start + capacity);
+					target.resize(start + Transcode(target.data() + start, capacity, source, length));
+				}
+				else if constexpr (requires { target.GetCharArray(); })
+				{
+					TArray<TCHAR>& chars = target.GetCharArray();
+					const int32 start = target.Len();
+					chars.SetNumUninitialized(start + capacity + 1, EAllowShrinking::No);
+					const int32 written = Transcode(chars.GetData() + start, capacity, source, length);
+					chars[start + written] = CHARTEXT(TCHAR, '\0');
+					chars.SetNum(start + written + 1, EAllowShrinking::No);
+				}
+				else if constexpr (requires { target.AddUninitialized(length); target.GetData(); target.Len(); })
+				{
+					const int32 start = target.Len();
+					target.AddUninitialized(capacity);
+					target.RemoveSuffix(capacity - Transcode(target.GetData() + start, capacity, source, length));
+				}
+				else if constexpr (requires { target.AddUninitialized(length); target.GetData(); target.Num(); })
+				{
+					const int32 start = target.Num();
+					target.AddUninitialized(capacity);
+					const int32 written = Transcode(target.GetData() + start, capacity, source, length);
+					target.SetNum(start + written, EAllowShrinking::No);
+				}
+				else
+				{
+					TInlineCharBuffer<CharTo> buffer;
+					buffer.SetNumUninitialized(capacity);
+					target.Append(buffer.GetData(), Transcode(buffer.GetData(), capacity, source, length));
+				}
+			}
+			else if constexpr (requires { target.resize(target.size()); target.data(); })
+			{
+				// STL strings
+				const size_t start = target.size();
+				const int32 convertedLength = getConvertedLength();
+				target.resize(start + convertedLength);
+				convertInPlace(target.data() + start, convertedLength);
+			}
+			else if constexpr (requires { target.AddUninitialized(length); target.GetData(); target.Len(); })
+			{
+				// String builders
+				const int32 start = target.Len();
+				const int32 convertedLength = getConvertedLength();
+				target.AddUninitialized(convertedLength);
+				convertInPlace(target.GetData() + start, convertedLength);
+			}
+			else if constexpr (requires { target.AddUninitialized(length); target.GetData(); target.Num(); })
+			{
+				// Arrays
+				const int32 start = target.Num();
+				const int32 convertedLength = getConvertedLength();
+				target.AddUninitialized(convertedLength);
+				convertInPlace(target.GetData() + start, convertedLength);
+			}
+			else if constexpr (CSameAs<CharFrom, CharTo>)
+				target.Append(source, length);
+			else
+			{
+				auto conversion = StringCast<CharTo>(source, length);
+				target.Append(conversion.Get(), conversion.Length());
+			}
+		}
+	}
+
+	/**
+	 *	@brief
+	 *	Append a copy of an input STL string to a caller provided Unreal character buffer, like `TStringBuilder`,
+	 *	`FString` or `TArray<TCHAR>`. Reuse the buffer (`Reset()` it between conversions) to avoid heap allocations.
+	 */
+	template <typename Target>
+	void UnrealCopy(FStdStringView const& stdStr, Target& output)
+	{
+		Detail::AppendConvertedChars(output, stdStr.data(), static_cast<int32>(stdStr.size()));
+	}
+
+	/**
+	 *	@brief
+	 *	Append an input STL string of any character type converted to TCHAR to a caller provided Unreal character
+	 *	buffer, like `TStringBuilder`, `FString` or `TArray<TCHAR>`. The conversion is done in-place in the buffer (via
+	 *	a stack buffer for `FString`), reuse the buffer to avoid heap allocations.
+	 */
+	template <CStdStringOrViewInvariant T, typename Target>
+	void UnrealConvert(T const& stdStr, Target& output)
+	{
+		Detail::AppendConvertedChars(output, stdStr.data(), static_cast<int32>(stdStr.length()));
+	}
+
+	/**
+	 *	@brief
+	 *	Append an input Unreal string converted to the character type of a caller provided buffer. The buffer can be
+	 *	a `TArray` of characters (like `TInlineCharBuffer`), an STL string or a string builder of any character type.
+	 *	The conversion is done in-place in the buffer, reuse it to avoid heap allocations.
+	 *
+	 *	@code
+	 *	TInlineCharBuffer<UTF8CHAR> buffer;
+	 *	for (FString const& field : fields)
+	 *	{
+	 *		buffer.Reset();
+	 *		StdConvert(field, buffer);
+	 *		Send(buffer.GetData(), buffer.Num());
+	 *	}
+	 *	@endcode
+	 *
+	 *	The STL and FName overloads only accept exactly those types, so string literals and other types merely
+	 *	convertible to them unambiguously pick this overload.
+	 */
+	template <typename Target>
+	void StdConvert(FStringView const& unrealStr, Target& output)
+	{
+		Detail::AppendConvertedChars(output, unrealStr.GetData(), unrealStr.Len());
+	}
+
+	/** @brief Append an input STL string of any character type converted to the character type of a caller buffer */
+	template <typename T, typename Target>
+	requires CStdStringInvariant<T> || CStdStringViewInvariant<T>
+	void StdConvert(T const& stdStr, Target& output)
+	{
+		Detail::AppendConvertedChars(output, stdStr.data(), static_cast<int32>(stdStr.size()));
+	}
+
+	/** @brief Append an FName converted to the character type of a caller provided buffer, without allocations */
+	template <CSameAsDecayed<FName> T, typename Target>
+	void StdConvert(T const& name, Target& output)
+	{
+		TStringBuilder<NAME_SIZE> nameString;
+		name.AppendString(nameString);
+		StdConvert(nameString.ToView(), output);
+	}
+
 	/** @brief Join the given string arguments with a delimiter and skip empty entries */
 	template <CStringOrView... Args>
 	FString Join(const TCHAR* separator, Args... args)
@@ -267,9 +506,19 @@ namespace Mcro::Text
 		);
 	}
 
-	/** @brief Copy of FString::PrintfImpl but not private so it can work with strings which were not literals */
+	/**
+	 *	@brief
+	 *	Like FString::Printf but it also works with format strings which are not literals.
+	 *
+	 *	Where the platform can measure the output up-front, the result is formatted in a single pass directly into the
+	 *	returned string. Otherwise a thread-local scratch buffer is used which retains its size across calls, so only
+	 *	the first longer string on a thread needs to be formatted multiple times.
+	 */
 	MCRO_API FString DynamicPrintf(const TCHAR* fmt, ...);
 
+	/** @brief Same as `DynamicPrintf` but the result is appended to the storage of an existing string */
+	MCRO_API void DynamicPrintfTo(FString& output, const TCHAR* fmt, ...);
+
 	/** @brief A type which is directly convertible to FStringFormatArg */
 	template <typename T>
 	concept CDirectStringFormatArgument = CConvertibleTo<T, FStringFormatArg>;
@@ -0,0 +1,396 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "CoreMinimal.h"
+#include "Misc/StringBuilder.h"
+#include "Mcro/Text.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Format strings parsed at compile time for the `FMT` macros. The format string is split into literal segments and
+ *	argument slots when the program is compiled, and ordered slots referring to non-existing arguments are compile
+ *	errors. Named slots without a matching argument are kept as they are, like `FString::Format` does.
+ *	At runtime arguments are appended directly to a string builder, without boxing them into `FStringFormatArg` or
+ *	collecting named arguments into a `TMap`.
+ *
+ *	The syntax is the same as of `FString::Format`: `{0}` refers to ordered arguments, `{Name}` refers to named arguments
+ *	(case-insensitive), and braces can be escaped with a back-tick, like `` `{ `` or `` `} ``. Braces not enclosing an
+ *	identifier (like in `{}` or `{ "a": 1 }`) are kept as they are.
+ */
+
+namespace Mcro::Text
+{
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	A named format argument, its name is provided by the call operator of a captureless lambda type. Temporaries
+		 *	are moved into the argument, only lvalues are referenced.
+		 */
+		template <typename Key, typename T>
+		struct TNamedFormatArgument
+		{
+			static constexpr std::basic_string_view<TCHAR> GetName() { return Key{}(); }
+			T Value;
+		};
+
+		template <typename T>
+		constexpr bool TIsNamedFormatArgument = false;
+
+		template <typename Key, typename T>
+		constexpr bool TIsNamedFormatArgument<TNamedFormatArgument<Key, T>> = true;
+
+		template <typename Key, typename T>
+		TNamedFormatArgument<Key, T> MakeNamedFormatArgument(Key, T&& value)
+		{
+			return { FWD(value) };
+		}
+
+		/** @brief A literal part of the format string, or an argument slot when `Argument` is not INDEX_NONE */
+		struct FFormatSegment
+		{
+			int32 Start = 0;
+			int32 Length = 0;
+			int32 Argument = INDEX_NONE;
+		};
+
+		inline constexpr int32 MaxFormatSegments = 32;
+
+		constexpr bool IsFormatIdentifierChar(TCHAR c)
+		{
+			return (c >= TCHAR('0') && c <= TCHAR('9'))
+				|| (c >= TCHAR('a') && c <= TCHAR('z'))
+				|| (c >= TCHAR('A') && c <= TCHAR('Z'))
+				|| c == TCHAR('_');
+		}
+
+		constexpr TCHAR ToLowerAscii(TCHAR c)
+		{
+			return c >= TCHAR('A') && c <= TCHAR('Z') ? c - TCHAR('A') + TCHAR('a') : c;
+		}
+
+		constexpr bool EqualsIgnoreCaseAscii(std::basic_string_view<TCHAR> left, std::basic_string_view<TCHAR> right)
+		{
+			if (left.size() != right.size()) return false;
+			for (size_t i = 0; i < left.size(); ++i)
+				if (ToLowerAscii(left[i]) != ToLowerAscii(right[i])) return false;
+			return true;
+		}
+
+		/**
+		 *	Calling this at compile time stops compilation, the name of the function is the error message. A format string
+		 *	refers to an ordered argument which is not provided.
+		 */
+		inline void FormatStringRefersToMissingArgument() {}
+
+		/**
+		 *	@brief
+		 *	Get the argument index of an argument slot name, or INDEX_NONE if the name cannot be an argument slot in the
+		 *	current mode (non-numeric slots for ordered arguments, numeric slots or unknown names for named arguments).
+		 */
+		template <typename... Args>
+		constexpr int32 ResolveFormatSlot(std::basic_string_view<TCHAR> name)
+		{
+			constexpr bool isNamed = sizeof...(Args) > 0 && (TIsNamedFormatArgument<std::decay_t<Args>> && ...);
+			const bool isNumeric = name[0] >= TCHAR('0') && name[0] <= TCHAR('9');
+			if constexpr (isNamed)
+			{
+				if (isNumeric) return INDEX_NONE;
+				int32 index = 0;
+				int32 result = INDEX_NONE;
+				((result == INDEX_NONE && EqualsIgnoreCaseAscii(std::decay_t<Args>::GetName(), name)
+					? (void)(result = index) : (void)0, ++index), ...);
+				return result;
+			}
+			else
+			{
+				int32 result = 0;
+				for (TCHAR c : name)
+				{
+					if (c < TCHAR('0') || c > TCHAR('9')) return INDEX_NONE;
+					result = result * 10 + (c - TCHAR('0'));
+					if (result >= static_cast<int32>(sizeof...(Args))) break;
+				}
+				if (result >= static_cast<int32>(sizeof...(Args))) FormatStringRefersToMissingArgument();
+				return result;
+			}
+		}
+
+		/** @brief Split a format string into literal segments and argument slots, calling `emit` with each of them */
+		template <typename... Args, typename Emit>
+		constexpr void ParseFormat(const TCHAR* format, int32 length, Emit&& emit)
+		{
+			int32 literalStart = 0;
+			auto emitLiteral = [&](int32 end)
+			{
+				if (end > literalStart) emit(FFormatSegment { literalStart, end - literalStart, INDEX_NONE });
+			};
+
+			int32 i = 0;
+			while (i < length)
+			{
+				const TCHAR c = format[i];
+				if (c == TCHAR('`') && i + 1 < length && (format[i + 1] == TCHAR('{') || format[i + 1] == TCHAR('}')))
+				{
+					emitLiteral(i);
+					literalStart = i + 1;
+					i += 2;
+					continue;
+				}
+				if (c == TCHAR('{'))
+				{
+					int32 end = i + 1;
+					while (end < length && IsFormatIdentifierChar(format[end])) ++end;
+					if (end > i + 1 && end < length && format[end] == TCHAR('}'))
+					{
+						const int32 argument = ResolveFormatSlot<Args...>({ format + i + 1, static_cast<size_t>(end - i - 1) });
+						if (argument != INDEX_NONE)
+						{
+							emitLiteral(i);
+							emit(FFormatSegment { i, end + 1 - i, argument });
+							i = end + 1;
+							literalStart = i;
+							continue;
+						}
+					}
+				}
+				++i;
+			}
+			emitLiteral(length);
+		}
+	}
+
+	/**
+	 *	@brief
+	 *	Arguments of a format string given to the `FMT` macros. Temporaries (including named arguments) are moved into
+	 *	it, lvalues are referenced, so they're meant to be formatted within the scope of the referenced variables.
+	 *	Convert them to vanilla format arguments, which own copies of the values, for deferred formatting.
+	 */
+	template <typename... Args>
+	struct TFormatArguments
+	{
+		TTuple<Args...> Arguments;
+
+		/** @brief Convert to vanilla ordered arguments for `FString::Format` */
+		FStringFormatOrderedArguments ToOrderedArguments() const
+		{
+			return Arguments.ApplyAfter([](auto&&... args)
+			{
+				return FStringFormatOrderedArguments { FStringFormatArg(AsFormatArgument(args)) ... };
+			});
+		}
+
+		/** @brief Convert to vanilla named arguments for `FString::Format` */
+		FStringFormatNamedArguments ToNamedArguments() const
+		{
+			return Arguments.ApplyAfter([](auto&&... args)
+			{
+				return FStringFormatNamedArguments {
+					{
+						FString::ConstructFromPtrSize(
+							std::decay_t<decltype(args)>::GetName().data(),
+							static_cast<int32>(std::decay_t<decltype(args)>::GetName().size())
+						),
+						FStringFormatArg(AsFormatArgument(args.Value))
+					} ...
+				};
+			});
+		}
+	};
+
+	/** @brief Collect format arguments for `TFormatString`. For named arguments use `Detail::MakeNamedFormatArgument`. */
+	template <typename... Args>
+	TFormatArguments<Args...> FormatArguments(Args&&... args)
+	{
+		return { { FWD(args)... } };
+	}
+
+	/**
+	 *	@brief
+	 *	A format string literal parsed at compile time for a given set of format arguments. This is implicitly
+	 *	constructed from string literals in a consteval context, so parsing errors stop compilation.
+	 *
+	 *	Format strings with more than `Detail::MaxFormatSegments` segments are still validated at compile time, but
+	 *	they're split again at runtime when formatting.
+	 */
+	template <typename... Args>
+	class TFormatString
+	{
+	public:
+		template <size_t N>
+		consteval TFormatString(const TCHAR(& format)[N])
+			: Format(format)
+			, Length(static_cast<int32>(N) - 1)
+		{
+			Detail::ParseFormat<Args...>(Format, Length, [this](Detail::FFormatSegment const& segment)
+			{
+				if (segment.Argument == INDEX_NONE)
+					LiteralLength += segment.Length;
+				else
+					++SlotCount;
+
+				if (SegmentCount < Detail::MaxFormatSegments)
+					Segments[SegmentCount] = segment;
+				++SegmentCount;
+			});
+		}
+
+		/** @brief Estimated length of the formatted string */
+		int32 EstimateLength() const { return LiteralLength + SlotCount * 16; }
+
+		/** @brief Call a function for each segment of the format string */
+		template <typename Function>
+		void ForEachSegment(Function&& function) const
+		{
+			if (SegmentCount <= Detail::MaxFormatSegments)
+			{
+				for (int32 i = 0; i < SegmentCount; ++i)
+					function(Segments[i]);
+			}
+			else Detail::ParseFormat<Args...>(Format, Length, function);
+		}
+
+		const TCHAR* GetFormat() const { return Format; }
+		int32 Len() const { return Length; }
+
+	private:
+		const TCHAR* Format;
+		int32 Length;
+		int32 LiteralLength = 0;
+		int32 SlotCount = 0;
+		int32 SegmentCount = 0;
+		std::array<Detail::FFormatSegment, Detail::MaxFormatSegments> Segments {};
+	};
+
+	namespace Detail
+	{
+		template <typename Builder, typename T>
+		void AppendDirectFormatArgument(Builder& builder, T const& value)
+		{
+			using Decayed = std::decay_t<T>;
+			if constexpr (CStringOrView<Decayed>)
+				builder.Append(GetData(value), value.Len());
+			else if constexpr (std::is_pointer_v<Decayed> && CCurrentCharPtr<Decayed>)
+			{
+				if (value) builder.Append(value, FCString::Strlen(value));
+			}
+			else if constexpr (std::is_pointer_v<Decayed> && CCharPtr<Decayed>)
+			{
+				if (!value) return;
+				auto converted = StringCast<TCHAR>(value);
+				builder.Append(converted.Get(), converted.Length());
+			}
+			else if constexpr (std::is_integral_v<Decayed> && std::is_signed_v<Decayed>)
+				builder << static_cast<int64>(value);
+			else if constexpr (std::is_integral_v<Decayed>)
+				builder << static_cast<uint64>(value);
+			else if constexpr (std::is_floating_point_v<Decayed>)
+				builder.Appendf(TEXT_"%f", static_cast<double>(value));
+			else
+			{
+				FString formatted = FString::Format(TEXT_"{0}", FStringFormatOrderedArguments { FStringFormatArg(value) });
+				builder.Append(*formatted, formatted.Len());
+			}
+		}
+
+		template <typename Builder, typename T>
+		void AppendFormatArgument(Builder& builder, T const& value)
+		{
+			if constexpr (TIsNamedFormatArgument<std::decay_t<T>>)
+				AppendFormatArgument(builder, value.Value);
+			else if constexpr (
+				CStringOrView<std::decay_t<T>>
+				|| std::is_arithmetic_v<std::decay_t<T>>
+				|| (std::is_pointer_v<std::decay_t<T>> && CCharPtr<std::decay_t<T>>)
+			)
+				AppendDirectFormatArgument(builder, value);
+			else
+				AppendDirectFormatArgument(builder, AsFormatArgument(value));
+		}
+
+		template <typename Builder, typename Tuple, size_t... Indices>
+		void AppendFormatArgumentAt(Builder& builder, Tuple const& arguments, int32 index, std::index_sequence<Indices...>&&)
+		{
+			((index == static_cast<int32>(Indices) ? AppendFormatArgument(builder, arguments.template Get<Indices>()) : void()), ...);
+		}
+	}
+
+	/**
+	 *	@brief
+	 *	Append a formatted string to a string builder, the format string literal is parsed and validated at compile
+	 *	time. This is what `FMT` macros use, but it can be called directly to format into an existing builder:
+	 *	@code
+	 *	TStringBuilder<256> builder;
+	 *	FormatTo(builder, TEXT_"Hi {0}, your number is {1}", FormatArguments(name, 42));
+	 *	@endcode
+	 */
+	template <typename Builder, typename... Args>
+	void FormatTo(Builder& builder, TFormatString<std::type_identity_t<Args>...> const& format, TFormatArguments<Args...> const& args)
+	{
+		const TCHAR* text = format.GetFormat();
+		format.ForEachSegment([&](Detail::FFormatSegment const& segment)
+		{
+			if (segment.Argument == INDEX_NONE)
+				builder.Append(text + segment.Start, segment.Length);
+			else
+				Detail::AppendFormatArgumentAt(builder, args.Arguments, segment.Argument, std::index_sequence_for<Args...>());
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Format a string literal parsed at compile time. The result is built in a string builder on the stack (with
+	 *	capacity reserved for the estimated length when that doesn't fit) before it's copied into the output.
+	 */
+	template <typename... Args>
+	FString Format(TFormatString<std::type_identity_t<Args>...> const& format, TFormatArguments<Args...> const& args)
+	{
+		constexpr int32 inlineCapacity = 512;
+		TStringBuilder<inlineCapacity> builder;
+		const int32 estimate = format.EstimateLength();
+		if (estimate > inlineCapacity)
+		{
+			builder.AddUninitialized(estimate);
+			builder.RemoveSuffix(estimate);
+		}
+		FormatTo(builder, format, args);
+		return FString::ConstructFromPtrSize(builder.GetData(), builder.Len());
+	}
+}
+
+template <typename... Args>
+FString operator % (Mcro::Text::TFormatString<std::type_identity_t<Args>...> const& format, Mcro::Text::TFormatArguments<Args...>&& args)
+{
+	return Mcro::Text::Format(format, args);
+}
+
+template <typename... Args>
+FString operator % (Mcro::Text::TFormatArguments<Args...>&& args, Mcro::Text::TFormatString<std::type_identity_t<Args>...> const& format)
+{
+	return Mcro::Text::Format(format, args);
+}
+
+template <typename... Args>
+FText operator % (FText const& format, Mcro::Text::TFormatArguments<Args...>&& args)
+{
+	constexpr bool isNamed = sizeof...(Args) > 0 && (Mcro::Text::Detail::TIsNamedFormatArgument<std::decay_t<Args>> && ...);
+	if constexpr (isNamed)
+		return FText::FromString(FString::Format(*format.ToString(), args.ToNamedArguments()));
+	else
+		return FText::FromString(FString::Format(*format.ToString(), args.ToOrderedArguments()));
+}
@@ -0,0 +1,100 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Crc.h"
+#include "String/Find.h"
+#include "Mcro/Text.h"
+
+namespace Mcro::Text
+{
+	/**
+	 *	@brief
+	 *	A string which stores up to `InlineCapacity` characters (the terminator included) inside the object itself, and
+	 *	only allocates on the heap for longer texts. Use it for members which are usually short but would otherwise be
+	 *	an FString each.
+	 *
+	 *	It converts implicitly to `FStringView`, and explicitly via `ToString` to FString, and it can be used directly
+	 *	as a format argument or with `_FMT`. Its content is always null-terminated, so `operator *` can be passed to
+	 *	APIs expecting a C string.
+	 */
+	template <int32 InlineCapacity>
+	class TInlineString
+	{
+	public:
+		using ElementType = TCHAR;
+
+		TInlineString() = default;
+		TInlineString(FStringView input) { Assign(input); }
+		TInlineString(FString const& input) { Assign(input); }
+		TInlineString(const TCHAR* input) { if (input) Assign(input); }
+		TInlineString(const ANSICHAR* input)
+		{
+			if (!input) return;
+			auto converted = StringCast<TCHAR>(input);
+			Assign(FStringView(converted.Get(), converted.Length()));
+		}
+
+		int32 Len() const { return Data.Num() > 0 ? Data.Num() - 1 : 0; }
+		bool IsEmpty() const { return Data.Num() == 0; }
+
+		/** @brief Is the content stored inline, without an allocation */
+		bool IsInline() const { return Data.Max() <= InlineCapacity; }
+
+		void Reset() { Data.Reset(); }
+
+		const TCHAR* GetData() const { return Data.Num() > 0 ? Data.GetData() : TEXT_""; }
+		const TCHAR* operator * () const { return GetData(); }
+
+		FStringView View() const { return FStringView(GetData(), Len()); }
+		operator FStringView () const { return View(); }
+
+		FString ToString() const { return FString(View()); }
+
+		bool Equals(FStringView other, ESearchCase::Type searchCase = ESearchCase::CaseSensitive) const
+		{
+			return View().Equals(other, searchCase);
+		}
+
+		bool Contains(FStringView search, ESearchCase::Type searchCase = ESearchCase::IgnoreCase) const
+		{
+			return UE::String::FindFirst(View(), search, searchCase) != INDEX_NONE;
+		}
+
+		friend bool operator == (TInlineString const& left, FStringView right) { return left.Equals(right); }
+
+		/** @brief Same as the hash of an FString with the same content */
+		friend uint32 GetTypeHash(TInlineString const& self)
+		{
+			return FCrc::Strihash_DEPRECATED(self.Len(), self.GetData());
+		}
+
+	private:
+		void Assign(FStringView input)
+		{
+			Data.Reset();
+			if (input.IsEmpty()) return;
+			Data.Reserve(input.Len() + 1);
+			Data.Append(input.GetData(), input.Len());
+			Data.Add(TCHAR('\0'));
+		}
+
+		TArray<TCHAR, TInlineAllocator<InlineCapacity>> Data;
+	};
+
+	template <int32 InlineCapacity>
+	struct TAsFormatArgument<TInlineString<InlineCapacity>>
+	{
+		FStringView operator () (TInlineString<InlineCapacity> const& left) const { return left.View(); }
+	};
+}
@@ -0,0 +1,314 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/Enums.h"
+#include "Mcro/Error.h"
+#include "Mcro/Text.h"
+
+/**
+ *	@file
+ *	Structured logging with deferred formatting. Instead of formatting a message on the calling thread, `MCRO_SLOG`
+ *	records the identity of its call site and the raw bytes of its arguments into a ring buffer owned by the calling
+ *	thread. A background thread (`Mcro.StructuredLog`) drains these buffers, formats the messages with
+ *	`FString::Format` and sends them to the regular log. It can also write them into a compact binary log, which can be
+ *	turned into text later with `DecodeStructuredLog` or with the `Mcro.StructuredLog.Decode` console command.
+ *
+ *	The format string uses the ordered argument syntax of `FString::Format` and `_FMT`:
+ *	@code
+ *	MCRO_SLOG(LogTemp, Log, "Loaded {0} assets from {1} in {2}s", count, packageName, seconds);
+ *	@endcode
+ *
+ *	Arithmetic types, enums, strings and FNames are copied into the buffer as they are, enums are stored by their
+ *	name. Any other type which `AsString` can handle is converted to a string on the calling thread. When the buffer
+ *	of the calling thread is full, or a single record wouldn't fit into it, the message is formatted and logged
+ *	immediately on the calling thread instead, so messages are never dropped. Messages are ordered by their timestamp
+ *	within each drain, but a synchronously logged message may overtake buffered ones.
+ *
+ *	Each logging thread gets a 16KB ring buffer, which is reused by another thread once its thread has exited. Beyond
+ *	256 concurrently logging threads messages are logged synchronously. Call sites are copied into a registry when
+ *	they're first executed, so messages can be formatted even after the module which logged them is unloaded. On a
+ *	system error the messages which weren't logged yet are written to `FPlatformMisc::LowLevelOutputDebugString`
+ *	without locking or allocating.
+ *
+ *	Fatal verbosity is not supported, use UE_LOG for those as they need to stop execution immediately.
+ */
+namespace Mcro::Text
+{
+	/** @brief The static identity of an `MCRO_SLOG` call site, this is what the ring buffers refer to */
+	struct MCRO_API FStructuredLogSite
+	{
+		FStructuredLogSite(
+			const TCHAR* format,
+			FLogCategoryBase const& category,
+			ELogVerbosity::Type verbosity,
+			const ANSICHAR* file,
+			int32 line
+		);
+
+		const TCHAR* Format;
+		FName Category;
+		ELogVerbosity::Type Verbosity;
+		const ANSICHAR* File;
+		int32 Line;
+
+		/** @brief Unique in the process, assigned when the call site is executed the first time */
+		uint32 Id;
+	};
+
+	/** @brief A structured log message decoded from a binary structured log */
+	struct MCRO_API FStructuredLogEntry
+	{
+		FString Format;
+		FName Category;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		FString File;
+		int32 Line = 0;
+
+		/** @brief Seconds since the start of the logging process */
+		double Time = 0;
+		uint32 ThreadId = 0;
+		FStringFormatOrderedArguments Arguments;
+
+		/** @brief Format the message of this entry */
+		FString GetMessage() const;
+
+		/** @brief Format this entry as a line of a text log, including its timestamp, thread, category and verbosity */
+		FString ToLogLine() const;
+	};
+
+	/** @brief Format and log all messages recorded so far, on the calling thread */
+	MCRO_API void FlushStructuredLog();
+
+	/**
+	 *	@brief  Start writing structured log messages into a binary file, replacing the currently active binary log
+	 *	@param path  When empty `<ProjectLogDir>/<ProjectName>.mslog` is used
+	 *	@return  The path of the opened binary log or an error if it cannot be opened
+	 */
+	MCRO_API Error::TMaybe<FString> StartBinaryStructuredLog(FString const& path = {});
+
+	/** @brief Flush pending messages and close the current binary log if there's any */
+	MCRO_API void StopBinaryStructuredLog();
+
+	/** @brief Decide whether structured log messages are also sent to the regular log (they are by default) */
+	MCRO_API void SetStructuredLogTextOutput(bool enabled);
+
+	/**
+	 *	@brief  Decode the contents of a binary structured log
+	 *	@param binary   The entire contents of a binary log file
+	 *	@param onEntry  Called for every decoded message in the order they were written
+	 *	@return  The number of decoded messages, or an error if the data is not a (complete) structured log
+	 */
+	MCRO_API Error::TMaybe<int32> DecodeStructuredLog(
+		TArrayView<const uint8> binary,
+		TFunctionRef<void(FStructuredLogEntry const&)> onEntry
+	);
+
+	/** @brief Decode a binary structured log file into a text log file */
+	MCRO_API Error::TMaybe<int32> DecodeStructuredLogFile(FString const& binaryPath, FString const& textPath);
+
+	namespace Detail
+	{
+		/** @brief The type of an argument encoded in a structured log record */
+		enum class EStructuredLogArg : uint8
+		{
+			Int,
+			UInt,
+			Float,
+			Double,
+			String,
+			AnsiString,
+			Name
+		};
+
+		/**
+		 *	@brief
+		 *	Start a record of the calling thread, return the memory where `argumentBytes` amount of argument data can be
+		 *	written. Every call has to be followed by `EndStructuredLogRecord`.
+		 */
+		MCRO_API uint8* BeginStructuredLogRecord(FStructuredLogSite const& site, int32 argumentBytes);
+
+		/** @brief Publish the record started by the last `BeginStructuredLogRecord` of the calling thread */
+		MCRO_API void EndStructuredLogRecord();
+
+		MCRO_API void StartStructuredLog();
+		MCRO_API void StopStructuredLog();
+
+		template <typename T>
+		concept CStructuredLogWideString = CConvertibleToDecayed<T, FStringView>;
+
+		template <typename T>
+		concept CStructuredLogAnsiString = !CStructuredLogWideString<T> && CConvertibleToDecayed<T, FAnsiStringView>;
+
+		/** @brief Types which are copied into structured log records without converting them to a string first */
+		template <typename T>
+		concept CStructuredLogDirect =
+			CEnum<T>
+			|| std::is_arithmetic_v<std::decay_t<T>>
+			|| CSameAsDecayed<T, FName>
+			|| CStructuredLogWideString<T>
+			|| CStructuredLogAnsiString<T>
+		;
+
+		template <typename T>
+		concept CStructuredLogArgument = CStructuredLogDirect<T> || CStringFormatArgument<T>;
+
+		template <typename T>
+		FORCEINLINE decltype(auto) PrepareStructuredLogArg(T const& arg)
+		{
+			if constexpr (CStructuredLogDirect<T>) return (arg);
+			else return AsString(arg);
+		}
+
+		template <typename T>
+		FORCEINLINE FStringView StructuredLogWideView(T const& arg)
+		{
+			if constexpr (std::is_pointer_v<T> || std::is_array_v<T>)
+			{
+				const TCHAR* string = arg;
+				return string ? FStringView(string) : FStringView();
+			}
+			else return FStringView(arg);
+		}
+
+		template <typename T>
+		FORCEINLINE FAnsiStringView StructuredLogAnsiView(T const& arg)
+		{
+			if constexpr (std::is_pointer_v<T> || std::is_array_v<T>)
+			{
+				const ANSICHAR* string = arg;
+				return string ? FAnsiStringView(string) : FAnsiStringView();
+			}
+			else return FAnsiStringView(arg);
+		}
+
+		template <typename T>
+		FORCEINLINE int32 StructuredLogArgSize(T const& arg)
+		{
+			using FValue = std::decay_t<T>;
+			if constexpr (CEnum<T>)
+				return 1 + sizeof(int32) + static_cast<int32>(magic_enum::enum_name(arg).size());
+			else if constexpr (std::is_same_v<FValue, float>)
+				return 1 + sizeof(float);
+			else if constexpr (std::is_arithmetic_v<FValue>)
+				return 1 + sizeof(uint64);
+			else if constexpr (CSameAsDecayed<T, FName>)
+				return 1 + sizeof(FNameEntryId) + sizeof(int32);
+			else if constexpr (CStructuredLogWideString<T>)
+				return 1 + sizeof(int32) + StructuredLogWideView(arg).Len() * sizeof(TCHAR);
+			else
+				return 1 + sizeof(int32) + StructuredLogAnsiView(arg).Len();
+		}
+
+		template <typename T>
+		FORCEINLINE void WriteStructuredLogBytes(uint8*& cursor, T const& value)
+		{
+			FMemory::Memcpy(cursor, &value, sizeof(T));
+			cursor += sizeof(T);
+		}
+
+		template <typename Char>
+		FORCEINLINE void WriteStructuredLogString(uint8*& cursor, EStructuredLogArg tag, TStringView<Char> view)
+		{
+			*cursor++ = static_cast<uint8>(tag);
+			WriteStructuredLogBytes(cursor, view.Len());
+			FMemory::Memcpy(cursor, view.GetData(), view.Len() * sizeof(Char));
+			cursor += view.Len() * sizeof(Char);
+		}
+
+		template <typename T>
+		FORCEINLINE void WriteStructuredLogArg(uint8*& cursor, T const& arg)
+		{
+			using FValue = std::decay_t<T>;
+			if constexpr (CEnum<T>)
+			{
+				// Copied instead of pointing at it, as the module of the enum may be unloaded by the time it's formatted
+				const std::string_view name = magic_enum::enum_name(arg);
+				WriteStructuredLogString(
+					cursor, EStructuredLogArg::AnsiString, FAnsiStringView(name.data(), static_cast<int32>(name.size()))
+				);
+			}
+			else if constexpr (std::is_same_v<FValue, float>)
+			{
+				*cursor++ = static_cast<uint8>(EStructuredLogArg::Float);
+				WriteStructuredLogBytes(cursor, arg);
+			}
+			else if constexpr (std::is_floating_point_v<FValue>)
+			{
+				*cursor++ = static_cast<uint8>(EStructuredLogArg::Double);
+				WriteStructuredLogBytes(cursor, static_cast<double>(arg));
+			}
+			else if constexpr (std::is_signed_v<FValue>)
+			{
+				*cursor++ = static_cast<uint8>(EStructuredLogArg::Int);
+				WriteStructuredLogBytes(cursor, static_cast<int64>(arg));
+			}
+			else if constexpr (std::is_arithmetic_v<FValue>)
+			{
+				*cursor++ = static_cast<uint8>(EStructuredLogArg::UInt);
+				WriteStructuredLogBytes(cursor, static_cast<uint64>(arg));
+			}
+			else if constexpr (CSameAsDecayed<T, FName>)
+			{
+				*cursor++ = static_cast<uint8>(EStructuredLogArg::Name);
+				WriteStructuredLogBytes(cursor, arg.GetDisplayIndex());
+				WriteStructuredLogBytes(cursor, arg.GetNumber());
+			}
+			else if constexpr (CStructuredLogWideString<T>)
+				WriteStructuredLogString(cursor, EStructuredLogArg::String, StructuredLogWideView(arg));
+			else
+				WriteStructuredLogString(cursor, EStructuredLogArg::AnsiString, StructuredLogAnsiView(arg));
+		}
+
+		template <typename... Args>
+		void WritePreparedStructuredLog(FStructuredLogSite const& site, Args const&... args)
+		{
+			const int32 argumentBytes = (0 + ... + StructuredLogArgSize(args));
+			uint8* cursor = BeginStructuredLogRecord(site, argumentBytes);
+			(WriteStructuredLogArg(cursor, args), ...);
+			EndStructuredLogRecord();
+		}
+
+		template <CStructuredLogArgument... Args>
+		void WriteStructuredLog(FStructuredLogSite const& site, Args const&... args)
+		{
+			WritePreparedStructuredLog(site, PrepareStructuredLogArg(args)...);
+		}
+	}
+}
+
+#if NO_LOGGING
+#define MCRO_SLOG(categoryName, verbosity, format, ...) do {} while (false)
+#else
+/**
+ *	@brief
+ *	Log a message with deferred formatting, see Mcro/Text/StructuredLog.h. Arguments are referred to by the format
+ *	string in the ordered syntax of FString::Format (`{0}`, `{1}`). Verbosity and suppression of the category is
+ *	respected the same way as with UE_LOG.
+ */
+#define MCRO_SLOG(categoryName, verbosity, format, ...)                                                               \
+	do {                                                                                                              \
+		static_assert(                                                                                                \
+			(ELogVerbosity::verbosity & ELogVerbosity::VerbosityMask) != ELogVerbosity::Fatal,                        \
+			"MCRO_SLOG doesn't support Fatal verbosity, use UE_LOG instead"                                           \
+		);                                                                                                            \
+		if (UE_LOG_ACTIVE(categoryName, verbosity))                                                                   \
+		{                                                                                                             \
+			static const ::Mcro::Text::FStructuredLogSite MCRO_SLOG_Site(                                             \
+				TEXT(format), categoryName, ELogVerbosity::verbosity, __FILE__, __LINE__                              \
+			);                                                                                                        \
+			::Mcro::Text::Detail::WriteStructuredLog(MCRO_SLOG_Site __VA_OPT__(,) __VA_ARGS__);                       \
+		}                                                                                                             \
+	} while (false)
+#endif
@@ -0,0 +1,74 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Concepts.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Conversion between TCHAR and UTF-8 or ANSI strings with a vectorized fast path for ASCII text. Runs of ASCII
+ *	characters are widened or narrowed 16 characters at a time with SSE2 or NEON (or a scalar loop elsewhere), and
+ *	only the non-ASCII parts in between are converted by the regular `FPlatformString::Convert`. The results are the
+ *	same as the ones of `StringCast`.
+ *
+ *	This is used by `StdConvert`, `UnrealConvert` and everything built on them, like the `Yaml.h` stream operators.
+ */
+
+namespace Mcro::Text
+{
+	using namespace Mcro::Concepts;
+
+	/** @brief A pair of character types which `Transcode` can convert between */
+	template <typename CharTo, typename CharFrom>
+	concept CTranscodable =
+#if PLATFORM_TCHAR_IS_UTF8CHAR
+		false
+#else
+		(CCurrentChar<CharFrom> && (CSameAs<CharTo, UTF8CHAR> || CSameAs<CharTo, ANSICHAR>))
+		|| (CCurrentChar<CharTo> && (CSameAs<CharFrom, UTF8CHAR> || CSameAs<CharFrom, ANSICHAR>))
+#endif
+	;
+
+	/** @brief The number of characters a destination buffer for `Transcode` must have room for */
+	template <typename CharTo, typename CharFrom>
+	requires CTranscodable<CharTo, CharFrom>
+	constexpr int32 MaxTranscodedLength(int32 length)
+	{
+		if constexpr (CSameAs<CharTo, UTF8CHAR>)
+			return length * (sizeof(TCHAR) == 2 ? 3 : 4);
+		else
+			return length;
+	}
+
+#if !PLATFORM_TCHAR_IS_UTF8CHAR
+	/**
+	 *	@brief  Convert a string into a destination buffer
+	 *	@param  destination  Output buffer, which must have room for at least `MaxTranscodedLength(length)` characters
+	 *	@param     capacity  The size of the output buffer
+	 *	@param       source  Input characters
+	 *	@param       length  Number of input characters
+	 *	@return  The number of characters written to the destination buffer. There's no null-terminator added.
+	 */
+	MCRO_API int32 Transcode(UTF8CHAR* destination, int32 capacity, const TCHAR* source, int32 length);
+
+	/** @copydoc Transcode(UTF8CHAR*, int32, const TCHAR*, int32) */
+	MCRO_API int32 Transcode(ANSICHAR* destination, int32 capacity, const TCHAR* source, int32 length);
+
+	/** @copydoc Transcode(UTF8CHAR*, int32, const TCHAR*, int32) */
+	MCRO_API int32 Transcode(TCHAR* destination, int32 capacity, const UTF8CHAR* source, int32 length);
+
+	/** @copydoc Transcode(UTF8CHAR*, int32, const TCHAR*, int32) */
+	MCRO_API int32 Transcode(TCHAR* destination, int32 capacity, const ANSICHAR* source, int32 length);
+#endif
+}
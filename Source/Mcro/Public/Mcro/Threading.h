@@ -16,9 +16,13 @@
 #include "Async/Async.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/SharedObjects.h"
+#include "Mcro/Instrumentation.h"
+#include "Mcro/Threading/Scratch.h"
 #include "RHICommandList.h"
 #include "RenderingThread.h"
 
+#include <atomic>
+
 namespace Mcro::Threading
 {
 	using namespace Mcro::FunctionTraits;
@@ -31,10 +35,81 @@ namespace Mcro::Threading
 	 */
 	MCRO_API bool IsInThread(ENamedThreads::Type threadName);
 
+	/**
+	 *	@brief
+	 *	A cheap shareable flag for cancelling work submitted with RunInThread / PromiseInThread before it starts.
+	 *	Copies share the same state. Long running functions may also check IsCancelled cooperatively.
+	 */
+	class FCancellationToken
+	{
+	public:
+		FCancellationToken() : State(MakeShared<std::atomic<bool>>(false)) {}
+
+		/** @brief Cancel the work associated with this token, it can't be undone */
+		void Cancel() const { State->store(true, std::memory_order_release); }
+
+		bool IsCancelled() const { return State->load(std::memory_order_acquire); }
+
+		/** @brief Used as a lifetime check, keeps the work alive while it's not cancelled */
+		explicit operator bool() const { return !IsCancelled(); }
+
+	private:
+		TSharedRef<std::atomic<bool>> State;
+	};
+
+	/**
+	 *	@brief
+	 *	When enabled, render commands enqueued with EnqueueRenderCommand from the game thread are collected during the
+	 *	frame, and they're submitted together as a single render command at the end of the frame (or when
+	 *	FlushRenderCommandBatch is called). This saves the render command queue overhead for many small commands,
+	 *	like texture updates.
+	 *
+	 *	@warning
+	 *	Batched commands are executed after the render commands enqueued directly (via ENQUEUE_RENDER_COMMAND) during
+	 *	the same frame. Call FlushRenderCommandBatch before anything which expects them to be already enqueued, like
+	 *	FlushRenderingCommands or render command fences.
+	 *	
+	 *	Disabling batching flushes the pending commands.
+	 */
+	MCRO_API void SetRenderCommandBatching(bool enabled);
+
+	/** @returns Whether render commands enqueued from the game thread are batched */
+	MCRO_API bool IsRenderCommandBatchingEnabled();
+
+	/** @brief Submit the batched render commands as a single render command. This can be called only on the game thread. */
+	MCRO_API void FlushRenderCommandBatch();
+
 	namespace Detail
 	{
 		MCRO_API auto GetThreadCheck(ENamedThreads::Type threadName) -> bool(*)();
 
+		/**
+		 *	@brief
+		 *	Keeps the UObject a dispatched function is bound to alive while that function is executed, and tells if
+		 *	it's still valid. On the game thread the object is pushed to a single, permanently registered set of GC
+		 *	references for the duration of the scope, so high frequency dispatch doesn't register a GC root per task.
+		 *	On other threads the object is pinned with a TStrongObjectPtr.
+		 */
+		class MCRO_API FObjectLifetimeScope : public FNoncopyable
+		{
+		public:
+			FObjectLifetimeScope(FWeakObjectPtr const& object);
+			~FObjectLifetimeScope();
+
+			explicit operator bool() const { return bIsValid; }
+
+		private:
+			TStrongObjectPtr<UObject> Pin;
+			bool bIsValid = false;
+			bool bPinnedOnGameThread = false;
+		};
+
+		/** @returns True when a render command enqueued from the calling thread should be batched */
+		MCRO_API bool ShouldBatchRenderCommand();
+
+		/** @brief Add a render command to the current batch. Only call it when ShouldBatchRenderCommand returns true. */
+		MCRO_API void BatchRenderCommand(TUniqueFunction<void(FRHICommandListImmediate&)>&& func);
+
 		template <CFunctionLike When>
 		requires (TFunction_ArgCount<When> == 0)
 		void RunInThreadBoilerplate(
@@ -42,10 +117,16 @@ namespace Mcro::Threading
 			TUniqueFunction<void()>&& func, When&& when
 		) {
 			if (IsInThread(threadName)) func();
-			else AsyncTask(threadName, [when = MoveTemp(when), func = MoveTemp(func)]
+			else
 			{
-				if (auto keep = when()) func();
-			});
+				const uint64 hopId = Instrumentation::OnThreadHopEnqueued(threadName, TEXTVIEW("RunInThread"));
+				AsyncTask(threadName, [threadName, hopId, when = MoveTemp(when), func = MoveTemp(func)]
+				{
+					MCRO_TRACE_SCOPE(Threading, "Mcro::RunInThread");
+					Instrumentation::FThreadHopScope traceScope(threadName, hopId);
+					if (auto keep = when()) func();
+				});
+			}
 		}
 
 		template <CFunctionLike When>
@@ -53,6 +134,13 @@ namespace Mcro::Threading
 		void EnqueueRenderCommandBoilerplate(TUniqueFunction<void(FRHICommandListImmediate&)>&& func, When&& when)
 		{
 			if (IsInRenderingThread()) func(GetImmediateCommandList_ForRenderCommand());
+			else if (ShouldBatchRenderCommand())
+			{
+				BatchRenderCommand([when = MoveTemp(when), func = MoveTemp(func)](FRHICommandListImmediate& cmdList)
+				{
+					if (auto keep = when()) func(cmdList);
+				});
+			}
 			else
 			{
 				ENQUEUE_RENDER_COMMAND(FMcroThreading)([when = MoveTemp(when), func = MoveTemp(func)](FRHICommandListImmediate& cmdList)
@@ -78,8 +166,13 @@ namespace Mcro::Threading
 			TPromise<Result> promise;
 			auto future = promise.GetFuture();
 			
-			AsyncTask(threadName, [when = MoveTemp(when), func = MoveTemp(func), promise = MoveTemp(promise)]() mutable 
+			const uint64 hopId = Instrumentation::OnThreadHopEnqueued(threadName, TEXTVIEW("PromiseInThread"));
+			AsyncTask(threadName, [
+				threadName, hopId, when = MoveTemp(when), func = MoveTemp(func), promise = MoveTemp(promise)
+			]() mutable
 			{
+				MCRO_TRACE_SCOPE(Threading, "Mcro::PromiseInThread");
+				Instrumentation::FThreadHopScope traceScope(threadName, hopId);
 				if (auto keep = when()) promise.SetValue(func());
 				else promise.SetValue({});
 			});
@@ -92,25 +185,106 @@ namespace Mcro::Threading
 			&& CSameAs<FRHICommandListImmediate&, TFunction_Arg<Function, 0>>
 			&& TFunction_ArgCount<When> == 0
 		)
-		TFuture<Result> EnqueueRenderPromiseBoilerplate(
-			ENamedThreads::Type threadName,
-			Function&& func,
-			When&& when
-		) {
+		TFuture<Result> EnqueueRenderPromiseBoilerplate(Function&& func, When&& when)
+		{
 			if (IsInRenderingThread())
 				return MakeFulfilledPromise<Result>(func(GetImmediateCommandList_ForRenderCommand())).GetFuture();
 
 			TPromise<Result> promise;
 			auto future = promise.GetFuture();
-			
-			ENQUEUE_RENDER_COMMAND(FMcroThreading)([when = MoveTemp(when), func = MoveTemp(func), promise = MoveTemp(promise)](FRHICommandListImmediate& cmdList) mutable 
+
+			auto command = [when = MoveTemp(when), func = MoveTemp(func), promise = MoveTemp(promise)](FRHICommandListImmediate& cmdList) mutable 
 			{
 				if (auto keep = when())
 					promise.SetValue(func(cmdList));
 				else promise.SetValue({});
-			});
+			};
+			if (ShouldBatchRenderCommand())
+				BatchRenderCommand(MoveTemp(command));
+			else
+			{
+				ENQUEUE_RENDER_COMMAND(FMcroThreading)(MoveTemp(command));
+			}
 			return future;
 		}
+
+		template <typename Value, typename Function>
+		struct TContinuationResult_Struct { using Type = std::invoke_result_t<Function, Value>; };
+
+		template <typename Function>
+		struct TContinuationResult_Struct<void, Function> { using Type = std::invoke_result_t<Function>; };
+
+		/** @brief The result of a continuation function taking the value of a TFuture<Value> */
+		template <typename Value, typename Function>
+		using TContinuationResult = typename TContinuationResult_Struct<Value, std::decay_t<Function>>::Type;
+
+		template <typename Value, typename Function>
+		concept CContinuationOf =
+			(CVoid<Value> && std::is_invocable_v<Function>)
+			|| (!CVoid<Value> && std::is_invocable_v<Function, Value>);
+
+		/** @brief Fulfill a promise with the result of a continuation consuming the value of the preceding future */
+		template <typename Result, typename Value, typename Function>
+		void FulfillContinuation(TPromise<Result>& promise, Function& func, TFuture<Value>& input)
+		{
+			if constexpr (CVoid<Value>)
+			{
+				input.Get();
+				if constexpr (CVoid<Result>) { func(); promise.SetValue(); }
+				else promise.SetValue(func());
+			}
+			else
+			{
+				if constexpr (CVoid<Result>) { func(input.Consume()); promise.SetValue(); }
+				else promise.SetValue(func(input.Consume()));
+			}
+		}
+
+		template <typename Result>
+		void FulfillDefault(TPromise<Result>& promise)
+		{
+			if constexpr (CVoid<Result>) promise.SetValue();
+			else promise.SetValue({});
+		}
+
+		template <
+			typename Value,
+			CContinuationOf<Value> Function,
+			typename Result = TContinuationResult<Value, Function>,
+			CFunctionLike When
+		>
+		requires (TFunction_ArgCount<When> == 0)
+		TFuture<Result> ThenOnBoilerplate(
+			TFuture<Value>&& future,
+			ENamedThreads::Type threadName,
+			Function&& func,
+			When&& when
+		) {
+			TPromise<Result> promise;
+			TFuture<Result> result = promise.GetFuture();
+
+			auto run = [when = MoveTemp(when), func = MoveTemp(func), promise = MoveTemp(promise)](TFuture<Value>& input) mutable
+			{
+				if (auto keep = when()) FulfillContinuation(promise, func, input);
+				else FulfillDefault(promise);
+			};
+
+			// When the preceding future is already done, hop directly without attaching a continuation to it
+			if (future.IsReady())
+			{
+				if (IsInThread(threadName)) run(future);
+				else AsyncTask(threadName, [run = MoveTemp(run), future = MoveTemp(future)]() mutable { run(future); });
+				return result;
+			}
+
+			future.Then([threadName, run = MoveTemp(run)](TFuture<Value> input) mutable
+			{
+				// Promises fulfilled on the target thread already execute their continuation without another hop
+				if (IsInThread(threadName)) run(input);
+				else AsyncTask(threadName, [run = MoveTemp(run), input = MoveTemp(input)]() mutable { run(input); });
+			});
+			return result;
+		}
 	}
 	
 	/**
@@ -134,6 +308,13 @@ namespace Mcro::Threading
 	 */
 	MCRO_API void RunInThread(ENamedThreads::Type threadName, const FWeakObjectPtr& boundToObject, TUniqueFunction<void()>&& func);
 	
+	/**
+	 *	@brief
+	 *	Simply run a lambda function on the selected thread but only use AsyncTask if it's not on the selected thread
+	 *	already. The function is dropped if the token has been cancelled before it could start.
+	 */
+	MCRO_API void RunInThread(ENamedThreads::Type threadName, const FCancellationToken& token, TUniqueFunction<void()>&& func);
+
 	/**
 	 *	@brief
 	 *	Simply run a lambda function on the game thread but only use AsyncTask if it's not on the game thread already
@@ -154,9 +335,84 @@ namespace Mcro::Threading
 	 */
 	MCRO_API void RunInGameThread(const FWeakObjectPtr& boundToObject, TUniqueFunction<void()>&& func);
 	
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Run a function on the game thread, replacing the pending function submitted with the same object and key
+		 *	if it hasn't been executed yet.
+		 *	
+		 *	@param objectKey  Address identifying the object the function is bound to
+		 *	@param key        User key distinguishing different kinds of updates of the same object
+		 *	@param func       The function, already checking the validity of the object
+		 */
+		MCRO_API void RunInGameThreadCoalescedBoilerplate(const void* objectKey, FName key, TUniqueFunction<void()>&& func);
+	}
+
+	/**
+	 *	@brief
+	 *	Run a function on the game thread, but if a previous function with the same object and key is still waiting
+	 *	to be executed, it's replaced by this one. Only the latest submission is executed, which is useful for
+	 *	"latest value" kind of updates coming in at high frequency (like telemetry or UI feeds). When called on the
+	 *	game thread the function is executed immediately and any pending one with the same key is dropped.
+	 *	Check the validity of the target object first before running on the game thread.
+	 */
+	MCRO_API void RunInGameThreadCoalesced(const UObject* boundToObject, FName key, TUniqueFunction<void()>&& func);
+
+	/** @brief Order in which the time-sliced game thread queue executes its work */
+	enum class EGameThreadQueuePriority : uint8
+	{
+		High,
+		Normal,
+		Low,
+	};
+
+	/** @brief Statistics of the time-sliced game thread queue, also reported as STATGROUP_Mcro stats */
+	struct FGameThreadQueueStats
+	{
+		/** @brief Number of items waiting in the queue */
+		int32 Depth = 0;
+
+		/** @brief Number of items executed in the last frame */
+		int32 LastDrainedCount = 0;
+
+		/** @brief Time spent executing queued items in the last frame */
+		double LastDrainedMilliseconds = 0.0;
+	};
+
+	/**
+	 *	@brief
+	 *	Queue a function to be executed on the game thread at the end of a frame, in a time-sliced way. Every frame the
+	 *	queue is drained (in priority order) until `Mcro.GameThreadQueue.BudgetMs` is spent, the rest is left for the
+	 *	following frames. Use it instead of RunInGameThread for bursts of work from other threads which would otherwise
+	 *	land on the game thread in a single frame.
+	 *
+	 *	Unlike RunInGameThread, this never executes the function immediately, even when called on the game thread.
+	 *	At least one item is executed every frame, so a single long item doesn't block the queue.
+	 */
+	MCRO_API void QueueInGameThread(TUniqueFunction<void()>&& func, EGameThreadQueuePriority priority = EGameThreadQueuePriority::Normal);
+
+	/**
+	 *	@brief
+	 *	Queue a function to be executed on the game thread at the end of a frame, in a time-sliced way.
+	 *	Check the validity of a target object first before running on the game thread.
+	 *	@see QueueInGameThread
+	 */
+	MCRO_API void QueueInGameThread(const UObject* boundToObject, TUniqueFunction<void()>&& func, EGameThreadQueuePriority priority = EGameThreadQueuePriority::Normal);
+
+	/** @returns The current statistics of the time-sliced game thread queue */
+	MCRO_API FGameThreadQueueStats GetGameThreadQueueStats();
+
+	namespace Detail
+	{
+		/** @brief Drain the time-sliced game thread queue within the frame budget, called at the end of the frame */
+		MCRO_API void DrainGameThreadQueue();
+	}
+
 	/**
 	 *	@brief
 	 *	Simply run a lambda function on the render thread but only use AsyncTask if it's not on the render thread already
+	 *	Commands from the game thread may be batched, see SetRenderCommandBatching.
 	 */
 	MCRO_API void EnqueueRenderCommand(TUniqueFunction<void(FRHICommandListImmediate&)>&& func);
 	
@@ -199,6 +455,43 @@ namespace Mcro::Threading
 	{
 		RunInThread<Object>(ENamedThreads::GameThread, boundToObject, MoveTemp(func));
 	}
+
+	/**
+	 *	@brief
+	 *	Run a function on the game thread, but if a previous function with the same object and key is still waiting
+	 *	to be executed, it's replaced by this one.
+	 *	Check the validity of the target object first before running on the game thread.
+	 *	@see RunInGameThreadCoalesced
+	 */
+	template <CSharedOrWeak Object>
+	void RunInGameThreadCoalesced(const Object& boundToObject, FName key, TUniqueFunction<void()>&& func)
+	{
+		TWeakPtrFrom<Object> weakObject(boundToObject);
+		const void* objectKey = weakObject.Pin().Get();
+		Detail::RunInGameThreadCoalescedBoilerplate(objectKey, key, [weakObject = MoveTemp(weakObject), func = MoveTemp(func)]
+		{
+			if (auto keep = weakObject.Pin()) func();
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Queue a function to be executed on the game thread at the end of a frame, in a time-sliced way.
+	 *	Check the validity of a target object first before running on the game thread.
+	 *	@see QueueInGameThread
+	 */
+	template <CSharedOrWeak Object>
+	void QueueInGameThread(
+		const Object& boundToObject,
+		TUniqueFunction<void()>&& func,
+		EGameThreadQueuePriority priority = EGameThreadQueuePriority::Normal
+	) {
+		TWeakPtrFrom<Object> weakObject(boundToObject);
+		QueueInGameThread([weakObject = MoveTemp(weakObject), func = MoveTemp(func)]
+		{
+			if (auto keep = weakObject.Pin()) func();
+		}, priority);
+	}
 	
 	/**
 	 *	@brief
@@ -263,9 +556,28 @@ namespace Mcro::Threading
 	requires (TFunction_ArgCount<Function> == 0)
 	TFuture<Result> PromiseInThread(ENamedThreads::Type threadName, const Object* boundToObject, Function&& func)
 	{
-		return Detail::PromiseInThreadBoilerplate(threadName, MoveTemp(func), [boundToObject]
+		return Detail::PromiseInThreadBoilerplate(threadName, MoveTemp(func), [weakObject = FWeakObjectPtr(boundToObject)]
 		{
-			return IsValid(boundToObject) ? TStrongObjectPtr(boundToObject) : nullptr;
+			return Detail::FObjectLifetimeScope(weakObject);
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Simply run a lambda function on the selected thread but only use AsyncTask if it's not on the selected thread
+	 *	already. The function is dropped if the token has been cancelled before it could start, then the future is
+	 *	fulfilled with a default constructed value.
+	 */
+	template <
+		CFunctorObject Function,
+		typename Result = TFunction_Return<Function>
+	>
+	requires (TFunction_ArgCount<Function> == 0)
+	TFuture<Result> PromiseInThread(ENamedThreads::Type threadName, const FCancellationToken& token, Function&& func)
+	{
+		return Detail::PromiseInThreadBoilerplate(threadName, MoveTemp(func), [token]
+		{
+			return static_cast<bool>(token);
 		});
 	}
 
@@ -317,9 +629,9 @@ namespace Mcro::Threading
 	requires (TFunction_ArgCount<Function> == 0)
 	TFuture<Result> PromiseInGameThread(const Object* boundToObject, Function&& func)
 	{
-		return Detail::PromiseInThreadBoilerplate(ENamedThreads::GameThread, MoveTemp(func), [boundToObject]
+		return Detail::PromiseInThreadBoilerplate(ENamedThreads::GameThread, MoveTemp(func), [weakObject = FWeakObjectPtr(boundToObject)]
 		{
-			return IsValid(boundToObject) ? TStrongObjectPtr(boundToObject) : nullptr;
+			return Detail::FObjectLifetimeScope(weakObject);
 		});
 	}
 
@@ -338,7 +650,7 @@ namespace Mcro::Threading
 	)
 	TFuture<Result> EnqueueRenderPromise(Function&& func)
 	{
-		return Detail::EnqueueRenderPromiseBoilerplate(ENamedThreads::GameThread, MoveTemp(func), []{ return true; });
+		return Detail::EnqueueRenderPromiseBoilerplate(MoveTemp(func), []{ return true; });
 	}
 
 	/**
@@ -358,7 +670,7 @@ namespace Mcro::Threading
 	TFuture<Result> EnqueueRenderPromise(const Object& boundToObject, Function&& func)
 	{
 		TWeakPtrFrom<Object> weakObject(boundToObject);
-		return Detail::EnqueueRenderPromiseBoilerplate(ENamedThreads::GameThread, MoveTemp(func), [weakObject = MoveTemp(weakObject)]
+		return Detail::EnqueueRenderPromiseBoilerplate(MoveTemp(func), [weakObject = MoveTemp(weakObject)]
 		{
 			return weakObject.Pin();
 		});
@@ -380,9 +692,152 @@ namespace Mcro::Threading
 	)
 	TFuture<Result> EnqueueRenderPromise(const Object* boundToObject, Function&& func)
 	{
-		return Detail::EnqueueRenderPromiseBoilerplate(ENamedThreads::GameThread, MoveTemp(func), [boundToObject]
+		return Detail::EnqueueRenderPromiseBoilerplate(MoveTemp(func), [weakObject = FWeakObjectPtr(boundToObject)]
+		{
+			return Detail::FObjectLifetimeScope(weakObject);
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Run multiple lambda functions on the render thread in a single render command and get all their results in a
+	 *	single future, once all of them has been executed. This needs only one promise and one render command, instead
+	 *	of one for each function. Functions are executed in the order they're given.
+	 *	This overload doesn't check object lifespans.
+	 */
+	template <CFunctorObject... Functions>
+	requires (
+		sizeof...(Functions) > 0
+		&& (... && (
+			TFunction_ArgCount<Functions> == 1
+			&& CSameAs<FRHICommandListImmediate&, TFunction_Arg<Functions, 0>>
+		))
+	)
+	TFuture<TTuple<TFunction_Return<Functions>...>> EnqueueRenderPromises(Functions&&... funcs)
+	{
+		return Detail::EnqueueRenderPromiseBoilerplate(
+			[...funcs = Forward<Functions>(funcs)](FRHICommandListImmediate& cmdList) mutable
+			{
+				// braced initialization guarantees left to right evaluation
+				return TTuple<TFunction_Return<Functions>...> { funcs(cmdList)... };
+			},
+			[]{ return true; }
+		);
+	}
+
+	/**
+	 *	@brief
+	 *	Run multiple lambda functions on the render thread in a single render command and get all their results in a
+	 *	single future, once all of them has been executed. This needs only one promise and one render command, instead
+	 *	of one for each function. Functions are executed in the order they're given.
+	 *	Check the validity of a target object first before running on the render thread, if the object is gone
+	 *	none of the functions are executed.
+	 */
+	template <CSharedOrWeak Object, CFunctorObject... Functions>
+	requires (
+		sizeof...(Functions) > 0
+		&& (... && (
+			TFunction_ArgCount<Functions> == 1
+			&& CSameAs<FRHICommandListImmediate&, TFunction_Arg<Functions, 0>>
+		))
+	)
+	TFuture<TTuple<TFunction_Return<Functions>...>> EnqueueRenderPromises(const Object& boundToObject, Functions&&... funcs)
+	{
+		TWeakPtrFrom<Object> weakObject(boundToObject);
+		return Detail::EnqueueRenderPromiseBoilerplate(
+			[...funcs = Forward<Functions>(funcs)](FRHICommandListImmediate& cmdList) mutable
+			{
+				return TTuple<TFunction_Return<Functions>...> { funcs(cmdList)... };
+			},
+			[weakObject = MoveTemp(weakObject)]
+			{
+				return weakObject.Pin();
+			}
+		);
+	}
+
+	/**
+	 *	@brief
+	 *	Run multiple lambda functions on the render thread in a single render command and get all their results in a
+	 *	single future, once all of them has been executed. This needs only one promise and one render command, instead
+	 *	of one for each function. Functions are executed in the order they're given.
+	 *	Check the validity of a target object first before running on the render thread, if the object is gone
+	 *	none of the functions are executed.
+	 */
+	template <CUObject Object, CFunctorObject... Functions>
+	requires (
+		sizeof...(Functions) > 0
+		&& (... && (
+			TFunction_ArgCount<Functions> == 1
+			&& CSameAs<FRHICommandListImmediate&, TFunction_Arg<Functions, 0>>
+		))
+	)
+	TFuture<TTuple<TFunction_Return<Functions>...>> EnqueueRenderPromises(const Object* boundToObject, Functions&&... funcs)
+	{
+		return Detail::EnqueueRenderPromiseBoilerplate(
+			[...funcs = Forward<Functions>(funcs)](FRHICommandListImmediate& cmdList) mutable
+			{
+				return TTuple<TFunction_Return<Functions>...> { funcs(cmdList)... };
+			},
+			[weakObject = FWeakObjectPtr(boundToObject)]
+			{
+				return Detail::FObjectLifetimeScope(weakObject);
+			}
+		);
+	}
+
+	/**
+	 *	@brief
+	 *	Continue a future on the selected thread with a function taking its value (or nothing for TFuture<void>). The
+	 *	continuation is executed inline, without another AsyncTask, when the future is fulfilled on the selected thread
+	 *	already, so chaining "worker -> game thread -> render thread" costs one promise per step.
+	 *	This overload doesn't check object lifespans.
+	 *
+	 *	@code
+	 *	auto result = ThenOn(
+	 *		ThenOn(PromiseInThread(ENamedThreads::AnyThread, [] { return Compute(); }),
+	 *			ENamedThreads::GameThread, [](FComputed&& computed) { return Apply(computed); }
+	 *		),
+	 *		ENamedThreads::ActualRenderingThread, [](FApplied&& applied) { Upload(applied); }
+	 *	);
+	 *	@endcode
+	 */
+	template <typename Value, Detail::CContinuationOf<Value> Function>
+	auto ThenOn(TFuture<Value>&& future, ENamedThreads::Type threadName, Function&& func)
+	{
+		return Detail::ThenOnBoilerplate(MoveTemp(future), threadName, Forward<Function>(func), []{ return true; });
+	}
+
+	/**
+	 *	@brief
+	 *	Continue a future on the selected thread with a function taking its value (or nothing for TFuture<void>). The
+	 *	continuation is executed inline, without another AsyncTask, when the future is fulfilled on the selected thread
+	 *	already. Check the validity of a target object first before running on the selected thread, the resulting
+	 *	future gets a default value if it's gone.
+	 */
+	template <typename Value, CSharedOrWeak Object, Detail::CContinuationOf<Value> Function>
+	auto ThenOn(TFuture<Value>&& future, ENamedThreads::Type threadName, const Object& boundToObject, Function&& func)
+	{
+		TWeakPtrFrom<Object> weakObject(boundToObject);
+		return Detail::ThenOnBoilerplate(MoveTemp(future), threadName, Forward<Function>(func), [weakObject = MoveTemp(weakObject)]
+		{
+			return weakObject.Pin();
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Continue a future on the selected thread with a function taking its value (or nothing for TFuture<void>). The
+	 *	continuation is executed inline, without another AsyncTask, when the future is fulfilled on the selected thread
+	 *	already. Check the validity of a target object first before running on the selected thread, the resulting
+	 *	future gets a default value if it's gone.
+	 */
+	template <typename Value, CUObject Object, Detail::CContinuationOf<Value> Function>
+	auto ThenOn(TFuture<Value>&& future, ENamedThreads::Type threadName, const Object* boundToObject, Function&& func)
+	{
+		return Detail::ThenOnBoilerplate(MoveTemp(future), threadName, Forward<Function>(func), [weakObject = FWeakObjectPtr(boundToObject)]
 		{
-			return IsValid(boundToObject) ? TStrongObjectPtr(boundToObject) : nullptr;
+			return Detail::FObjectLifetimeScope(weakObject);
 		});
 	}
 }
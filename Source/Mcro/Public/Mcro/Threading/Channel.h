@@ -0,0 +1,344 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "Mcro/Delegates/EventDelegate.h"
+
+#include <atomic>
+
+namespace Mcro::Threading
+{
+	using namespace Mcro::Delegates;
+
+	namespace Detail
+	{
+		/** @brief Unbounded lock-free MPSC storage of TChannel, a node is allocated for each message */
+		template <typename T>
+		class TUnboundedChannelStorage
+		{
+		public:
+			bool Send(T&& value) { return Queue.Enqueue(MoveTemp(value)); }
+
+			/** @brief Move the received value out of the queue with `consume`, before it's destroyed */
+			template <typename Consume>
+			bool ReceiveWith(Consume&& consume)
+			{
+				T* value = Queue.Peek();
+				if (!value) return false;
+				consume(*value);
+				Queue.Pop();
+				return true;
+			}
+
+		private:
+			TQueue<T, EQueueMode::Mpsc> Queue;
+		};
+
+		/**
+		 *	@brief
+		 *	Bounded lock-free MPSC storage of TChannel on a preallocated ring buffer (after Dmitry Vyukov's bounded
+		 *	queue). Every slot has a sequence number telling whether it's free to write or ready to read at the
+		 *	current lap, so producers only contend on the write cursor.
+		 */
+		template <typename T, int32 Capacity>
+		class TBoundedChannelStorage
+		{
+			static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Channel capacity must be a power of two");
+
+		public:
+			TBoundedChannelStorage()
+			{
+				for (uint64 i = 0; i < Capacity; ++i)
+					Slots[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+
+			~TBoundedChannelStorage()
+			{
+				while (ReceiveWith([](T&) {})) {}
+			}
+
+			bool Send(T&& value)
+			{
+				uint64 position = WriteCursor.load(std::memory_order_relaxed);
+				FSlot* slot;
+				while (true)
+				{
+					slot = &Slots[position & (Capacity - 1)];
+					uint64 sequence = slot->Sequence.load(std::memory_order_acquire);
+					int64 difference = static_cast<int64>(sequence) - static_cast<int64>(position);
+					if (difference == 0)
+					{
+						if (WriteCursor.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+							break;
+					}
+					else if (difference < 0) return false; // full
+					else position = WriteCursor.load(std::memory_order_relaxed);
+				}
+				new (slot->Storage.GetTypedPtr()) T(MoveTemp(value));
+				slot->Sequence.store(position + 1, std::memory_order_release);
+				return true;
+			}
+
+			/** @brief Move the received value out of its slot with `consume`, before it's destroyed */
+			template <typename Consume>
+			bool ReceiveWith(Consume&& consume)
+			{
+				FSlot& slot = Slots[ReadCursor & (Capacity - 1)];
+				if (slot.Sequence.load(std::memory_order_acquire) != ReadCursor + 1)
+					return false;
+
+				T* value = slot.Storage.GetTypedPtr();
+				consume(*value);
+				value->~T();
+				slot.Sequence.store(ReadCursor + Capacity, std::memory_order_release);
+				++ReadCursor;
+				return true;
+			}
+
+		private:
+			struct FSlot
+			{
+				std::atomic<uint64> Sequence;
+				TTypeCompatibleBytes<T> Storage;
+			};
+
+			FSlot Slots[Capacity];
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> WriteCursor { 0 };
+			alignas(PLATFORM_CACHE_LINE_SIZE) uint64 ReadCursor = 0;
+		};
+
+		/**
+		 *	@brief
+		 *	Same as TBoundedChannelStorage, but multiple consumers may receive concurrently, at the cost of contending
+		 *	on the read cursor as well.
+		 */
+		template <typename T, int32 Capacity>
+		class TBoundedMpmcStorage
+		{
+			static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Channel capacity must be a power of two");
+
+		public:
+			TBoundedMpmcStorage()
+			{
+				for (uint64 i = 0; i < Capacity; ++i)
+					Slots[i].Sequence.store(i, std::memory_order_relaxed);
+			}
+
+			~TBoundedMpmcStorage()
+			{
+				while (TryReceive()) {}
+			}
+
+			/** @brief The value is only moved from when sending succeeds */
+			bool Send(T&& value)
+			{
+				uint64 position = WriteCursor.load(std::memory_order_relaxed);
+				FSlot* slot;
+				while (true)
+				{
+					slot = &Slots[position & (Capacity - 1)];
+					uint64 sequence = slot->Sequence.load(std::memory_order_acquire);
+					int64 difference = static_cast<int64>(sequence) - static_cast<int64>(position);
+					if (difference == 0)
+					{
+						if (WriteCursor.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+							break;
+					}
+					else if (difference < 0) return false; // full
+					else position = WriteCursor.load(std::memory_order_relaxed);
+				}
+				new (slot->Storage.GetTypedPtr()) T(MoveTemp(value));
+				slot->Sequence.store(position + 1, std::memory_order_release);
+				return true;
+			}
+
+			bool Receive(T& out)
+			{
+				return ReceiveWith([&](T& value) { out = MoveTemp(value); });
+			}
+
+			/** @brief Receive without requiring T to be default constructible */
+			TOptional<T> TryReceive()
+			{
+				TOptional<T> result;
+				ReceiveWith([&](T& value) { result.Emplace(MoveTemp(value)); });
+				return result;
+			}
+
+		private:
+			/** @brief Move the received value out of its slot with `consume`, before it's destroyed */
+			template <typename Consume>
+			bool ReceiveWith(Consume&& consume)
+			{
+				uint64 position = ReadCursor.load(std::memory_order_relaxed);
+				FSlot* slot;
+				while (true)
+				{
+					slot = &Slots[position & (Capacity - 1)];
+					uint64 sequence = slot->Sequence.load(std::memory_order_acquire);
+					int64 difference = static_cast<int64>(sequence) - static_cast<int64>(position + 1);
+					if (difference == 0)
+					{
+						if (ReadCursor.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+							break;
+					}
+					else if (difference < 0) return false; // empty
+					else position = ReadCursor.load(std::memory_order_relaxed);
+				}
+				T* value = slot->Storage.GetTypedPtr();
+				consume(*value);
+				value->~T();
+				slot->Sequence.store(position + Capacity, std::memory_order_release);
+				return true;
+			}
+
+			struct FSlot
+			{
+				std::atomic<uint64> Sequence;
+				TTypeCompatibleBytes<T> Storage;
+			};
+
+			FSlot Slots[Capacity];
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> WriteCursor { 0 };
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> ReadCursor { 0 };
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Lock-free multi-producer single-consumer queue of messages for cross-thread communication without allocating a
+	 *	closure and dispatching a task for each message. Any thread can send messages, while only one thread at a time
+	 *	may receive them.
+	 *
+	 *	@tparam T         Type of the messages
+	 *	@tparam Capacity  When 0 the channel is unbounded (allocating a node per message), otherwise the channel is a
+	 *	                  preallocated ring buffer of this many messages (power of two) and Send fails when it's full.
+	 */
+	template <typename T, int32 Capacity = 0>
+	class TChannel
+	{
+	public:
+		/** @returns False if the channel is bounded and it's full */
+		bool Send(T value)
+		{
+			if (!Storage.Send(MoveTemp(value))) return false;
+			Count.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/** @brief Try to take the next message, only call it from the consumer thread */
+		bool TryReceive(T& out)
+		{
+			if (!Storage.ReceiveWith([&](T& value) { out = MoveTemp(value); })) return false;
+			Count.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/** @brief Same as TryReceive(T&) but T doesn't need to be default constructible */
+		TOptional<T> TryReceive()
+		{
+			TOptional<T> result;
+			if (Storage.ReceiveWith([&](T& value) { result.Emplace(MoveTemp(value)); }))
+				Count.fetch_sub(1, std::memory_order_relaxed);
+			return result;
+		}
+
+		/**
+		 *	@brief  Take multiple messages at once, only call it from the consumer thread
+		 *	@param out  Received messages are appended to this array
+		 *	@param max  Receive at most this many messages
+		 *	@return  The number of received messages
+		 */
+		int32 Drain(TArray<T>& out, int32 max = MAX_int32)
+		{
+			int32 received = 0;
+			while (received < max && Storage.ReceiveWith([&](T& value) { out.Add(MoveTemp(value)); }))
+				++received;
+			Count.fetch_sub(received, std::memory_order_relaxed);
+			return received;
+		}
+
+		/**
+		 *	@brief  Consume multiple messages with a function, only call it from the consumer thread
+		 *	@param max  Receive at most this many messages
+		 *	@return  The number of received messages
+		 */
+		template <typename Function>
+		requires std::is_invocable_v<Function, T&&>
+		int32 Drain(Function&& function, int32 max = MAX_int32)
+		{
+			int32 received = 0;
+			while (received < max && Storage.ReceiveWith([&](T& value) { function(MoveTemp(value)); }))
+				++received;
+			Count.fetch_sub(received, std::memory_order_relaxed);
+			return received;
+		}
+
+		/** @returns The approximate number of messages waiting in the channel */
+		int32 Num() const { return Count.load(std::memory_order_relaxed); }
+
+		bool IsEmpty() const { return Num() <= 0; }
+
+	private:
+		using FStorage = std::conditional_t<
+			Capacity == 0,
+			Detail::TUnboundedChannelStorage<T>,
+			Detail::TBoundedChannelStorage<T, FMath::Max(Capacity, 1)>
+		>;
+
+		FStorage Storage;
+		std::atomic<int32> Count { 0 };
+	};
+
+	/**
+	 *	@brief
+	 *	A TChannel which is drained on the game thread every tick (via the core ticker), broadcasting the received
+	 *	messages of the tick in a single batch to a TEventDelegate. The game thread is the consumer of the channel so
+	 *	don't receive from it manually.
+	 */
+	template <typename T, int32 Capacity = 0>
+	class TGameThreadChannel : public TChannel<T, Capacity>
+	{
+	public:
+		/** @param maxPerTick  Broadcast at most this many messages per tick, the rest is left for the next tick */
+		explicit TGameThreadChannel(int32 maxPerTick = MAX_int32)
+		{
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateLambda([this, maxPerTick](float)
+				{
+					Batch.Reset();
+					if (this->Drain(Batch, maxPerTick) > 0)
+						OnReceived.Broadcast(TArrayView<const T>(Batch));
+					return true;
+				})
+			);
+		}
+
+		~TGameThreadChannel()
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		}
+
+		TGameThreadChannel(const TGameThreadChannel&) = delete;
+		TGameThreadChannel& operator = (const TGameThreadChannel&) = delete;
+
+		/** @brief Broadcasted on the game thread with the messages received during the last tick */
+		TEventDelegate<void(TArrayView<const T>)> OnReceived;
+
+	private:
+		TArray<T> Batch;
+		FTSTicker::FDelegateHandle TickerHandle;
+	};
+}
@@ -0,0 +1,99 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Mcro/Threading.h"
+#include "Mcro/Delegates/InlineFunction.h"
+
+namespace Mcro::Threading
+{
+	using Mcro::Delegates::DefaultInlineFunctionCapacity;
+	using Mcro::Delegates::TInlineFunction;
+
+	namespace Detail
+	{
+		/** @brief Graph task executing a TInlineFunction, so the closure lives inside the task allocation */
+		template <int32 Capacity>
+		class TInlineFunctionTask
+		{
+		public:
+			TInlineFunctionTask(ENamedThreads::Type threadName, TInlineFunction<void(), Capacity>&& function)
+				: Function(MoveTemp(function))
+				, ThreadName(threadName)
+			{}
+
+			static TStatId GetStatId() { RETURN_QUICK_DECLARE_CYCLE_STAT(TInlineFunctionTask, STATGROUP_TaskGraphTasks); }
+			static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::FireAndForget; }
+			ENamedThreads::Type GetDesiredThread() const { return ThreadName; }
+
+			void DoTask(ENamedThreads::Type, const FGraphEventRef&) { Function(); }
+
+		private:
+			TInlineFunction<void(), Capacity> Function;
+			ENamedThreads::Type ThreadName;
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Run a function on the selected thread like RunInThread, but the closure is stored inline in the dispatched graph
+	 *	task, instead of being wrapped in TUniqueFunctions (which may allocate twice per submission). Closures larger
+	 *	than Capacity fail to compile. The function runs immediately if it's called on the selected thread already.
+	 *
+	 *	@tparam Capacity  Maximum size of the closure in bytes
+	 */
+	template <int32 Capacity = DefaultInlineFunctionCapacity, typename Function>
+	requires std::is_invocable_v<std::decay_t<Function>&>
+	void RunInThreadInline(ENamedThreads::Type threadName, Function&& func)
+	{
+		if (IsInThread(threadName))
+		{
+			func();
+			return;
+		}
+		TGraphTask<Detail::TInlineFunctionTask<Capacity>>::CreateTask().ConstructAndDispatchWhenReady(
+			threadName, TInlineFunction<void(), Capacity>(Forward<Function>(func))
+		);
+	}
+
+	/**
+	 *	@brief
+	 *	Run a function on the selected thread like RunInThread, but the closure is stored inline in the dispatched graph
+	 *	task. Check the validity of a target object first before running on the selected thread.
+	 *
+	 *	@tparam Capacity  Maximum size of the closure (including the weak pointer to the object) in bytes
+	 */
+	template <int32 Capacity = DefaultInlineFunctionCapacity, typename Function>
+	requires std::is_invocable_v<std::decay_t<Function>&>
+	void RunInThreadInline(ENamedThreads::Type threadName, const UObject* boundToObject, Function&& func)
+	{
+		RunInThreadInline<Capacity>(threadName, [weakObject = FWeakObjectPtr(boundToObject), func = Forward<Function>(func)]() mutable
+		{
+			if (weakObject.IsValid()) func();
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Run a function on the game thread like RunInGameThread, but the closure is stored inline in the dispatched graph
+	 *	task. @see RunInThreadInline
+	 */
+	template <int32 Capacity = DefaultInlineFunctionCapacity, typename Function>
+	requires std::is_invocable_v<std::decay_t<Function>&>
+	void RunInGameThreadInline(Function&& func)
+	{
+		RunInThreadInline<Capacity>(ENamedThreads::GameThread, Forward<Function>(func));
+	}
+}
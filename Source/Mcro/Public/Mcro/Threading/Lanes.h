@@ -0,0 +1,186 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Threading.h"
+
+/**
+ *	@file
+ *	Work lanes are small, elastically sized thread pools separate from the task graph, for work which spends most of
+ *	its time blocked (file reads, network requests, DLL loading). Running such work with
+ *	`RunInThread(ENamedThreads::AnyThread, ...)` occupies task graph workers, starving ISPC launches and parallel-for
+ *	jobs. A lane starts threads on demand up to its concurrency cap (`Mcro.Lanes.IO.MaxThreads`,
+ *	`Mcro.Lanes.Background.MaxThreads`), and threads idle for a while exit.
+ */
+namespace Mcro::Threading
+{
+	enum class EWorkLane : uint8
+	{
+		/** @brief Blocking I/O, like file access, HTTP requests or loading DLLs */
+		IO,
+
+		/** @brief Long running, low priority background work which should not delay I/O */
+		Background,
+	};
+
+	/** @brief Statistics of a work lane */
+	struct FWorkLaneStats
+	{
+		/** @brief Number of functions waiting for a thread */
+		int32 Depth = 0;
+
+		/** @brief The highest Depth observed since the start of the process */
+		int32 PeakDepth = 0;
+
+		/** @brief Number of threads currently running in the lane, busy or idle */
+		int32 Threads = 0;
+
+		/** @brief Number of threads currently executing a function */
+		int32 BusyThreads = 0;
+
+		/** @brief At most this many threads may run in the lane at once */
+		int32 MaxConcurrency = 0;
+
+		/** @brief Total number of functions executed in the lane */
+		uint64 Executed = 0;
+	};
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Enqueue a function to a work lane. Work which is already queued when the lane is stopped is still
+		 *	executed, but once the lane has been stopped, new work is rejected.
+		 *
+		 *	@param func  Called with `cancelled = false` on a thread of the lane, or with `cancelled = true`
+		 *	             immediately on the calling thread when the lane has been stopped already. Promises must be
+		 *	             fulfilled in both cases.
+		 */
+		MCRO_API void EnqueueInLane(EWorkLane lane, TUniqueFunction<void(bool cancelled)>&& func);
+
+		/** @brief Finish the queued work and stop the threads of all lanes, called on module shutdown */
+		MCRO_API void ShutdownWorkLanes();
+
+		template <CFunctorObject Function, typename Result = TFunction_Return<Function>, CFunctionLike When>
+		requires (
+			TFunction_ArgCount<Function> == 0
+			&& TFunction_ArgCount<When> == 0
+		)
+		TFuture<Result> PromiseInLaneBoilerplate(EWorkLane lane, Function&& func, When&& when)
+		{
+			TPromise<Result> promise;
+			auto future = promise.GetFuture();
+
+			EnqueueInLane(lane, [
+				when = MoveTemp(when), func = MoveTemp(func), promise = MoveTemp(promise)
+			](bool cancelled) mutable
+			{
+				if (cancelled) FulfillDefault(promise);
+				else if (auto keep = when())
+				{
+					if constexpr (CVoid<Result>) { func(); promise.SetValue(); }
+					else promise.SetValue(func());
+				}
+				else FulfillDefault(promise);
+			});
+			return future;
+		}
+	}
+
+	/**
+	 *	@brief
+	 *	Run a function on a thread of the given work lane. This is never executed inline. Functions submitted after
+	 *	the lanes have been stopped on module shutdown are dropped (and the futures of PromiseInLane are fulfilled
+	 *	with a default value).
+	 */
+	MCRO_API void RunInLane(EWorkLane lane, TUniqueFunction<void()>&& func);
+
+	/**
+	 *	@brief
+	 *	Run a function on a thread of the given work lane. Check the validity of a target object first before
+	 *	running the function.
+	 */
+	MCRO_API void RunInLane(EWorkLane lane, const UObject* boundToObject, TUniqueFunction<void()>&& func);
+
+	/**
+	 *	@brief
+	 *	Run a function on a thread of the given work lane. Check the validity of a target object first before
+	 *	running the function.
+	 */
+	MCRO_API void RunInLane(EWorkLane lane, const FWeakObjectPtr& boundToObject, TUniqueFunction<void()>&& func);
+
+	/**
+	 *	@brief
+	 *	Run a function on a thread of the given work lane. The function is dropped if the token has been cancelled
+	 *	before it could start.
+	 */
+	MCRO_API void RunInLane(EWorkLane lane, const FCancellationToken& token, TUniqueFunction<void()>&& func);
+
+	/**
+	 *	@brief
+	 *	Run a function on a thread of the given work lane and get its result in a future.
+	 *	This overload doesn't check object lifespans.
+	 */
+	template <
+		CFunctorObject Function,
+		typename Result = TFunction_Return<Function>
+	>
+	requires (TFunction_ArgCount<Function> == 0)
+	TFuture<Result> PromiseInLane(EWorkLane lane, Function&& func)
+	{
+		return Detail::PromiseInLaneBoilerplate(lane, Forward<Function>(func), []{ return true; });
+	}
+
+	/**
+	 *	@brief
+	 *	Run a function on a thread of the given work lane and get its result in a future. The function is dropped if
+	 *	the token has been cancelled before it could start, then the future is fulfilled with a default value.
+	 */
+	template <
+		CFunctorObject Function,
+		typename Result = TFunction_Return<Function>
+	>
+	requires (TFunction_ArgCount<Function> == 0)
+	TFuture<Result> PromiseInLane(EWorkLane lane, const FCancellationToken& token, Function&& func)
+	{
+		return Detail::PromiseInLaneBoilerplate(lane, Forward<Function>(func), [token]
+		{
+			return static_cast<bool>(token);
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Run a function on a thread of the given work lane and get its result in a future. Check the validity of a
+	 *	target object first, the future is fulfilled with a default value if it's gone.
+	 */
+	template <
+		CUObject Object,
+		CFunctorObject Function,
+		typename Result = TFunction_Return<Function>
+	>
+	requires (TFunction_ArgCount<Function> == 0)
+	TFuture<Result> PromiseInLane(EWorkLane lane, const Object* boundToObject, Function&& func)
+	{
+		return Detail::PromiseInLaneBoilerplate(lane, Forward<Function>(func), [weakObject = FWeakObjectPtr(boundToObject)]
+		{
+			return Detail::FObjectLifetimeScope(weakObject);
+		});
+	}
+
+	/** @brief Override the concurrency cap of a lane, which is otherwise taken from its console variable */
+	MCRO_API void SetLaneMaxConcurrency(EWorkLane lane, int32 maxThreads);
+
+	/** @returns The current statistics of a work lane */
+	MCRO_API FWorkLaneStats GetLaneStats(EWorkLane lane);
+}
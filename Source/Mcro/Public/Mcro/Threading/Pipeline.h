@@ -0,0 +1,458 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/TextMacros.h"
+#include "Mcro/Threading.h"
+#include "Mcro/Threading/Channel.h"
+#include "Mcro/Threading/Lanes.h"
+#include "Containers/RingBuffer.h"
+
+#include <atomic>
+
+namespace Mcro::Threading
+{
+	/** @brief Where and how a stage of a TPipeline is executed */
+	struct FPipelineStageOptions
+	{
+		/** @brief Used in statistics */
+		const TCHAR* Name = TEXT_"Stage";
+
+		/** @brief The named thread executing the stage, ignored when Lane is set */
+		ENamedThreads::Type Thread = ENamedThreads::AnyThread;
+
+		/** @brief Execute the stage on a work lane instead of the task graph */
+		TOptional<EWorkLane> Lane;
+
+		/**
+		 *	@brief
+		 *	At most this many items are processed by the stage at once. Only meaningful with AnyThread or a work lane,
+		 *	as other named threads execute one task at a time anyway. With more than one the stage function is called
+		 *	concurrently, and items may leave the stage in a different order than they arrived.
+		 */
+		int32 Parallelism = 1;
+	};
+
+	/** @brief Statistics of a stage in a TPipeline */
+	struct FPipelineStageStats
+	{
+		const TCHAR* Name = nullptr;
+
+		/** @brief Number of items waiting in the input queue of the stage */
+		int32 Depth = 0;
+
+		/** @brief Number of tasks currently executing the stage */
+		int32 ActiveWorkers = 0;
+
+		/** @brief Number of items processed by the stage so far */
+		uint64 Processed = 0;
+
+		/** @brief How many times the stage had to stop because the input queue of the next stage was full */
+		uint64 Stalls = 0;
+
+		/** @brief Average time items spent waiting in the input queue of the stage */
+		double AverageQueueMilliseconds = 0.0;
+
+		/** @brief Average time spent in the function of the stage per item */
+		double AverageProcessMilliseconds = 0.0;
+	};
+
+	namespace Detail
+	{
+		class IPipelineStage
+		{
+		public:
+			virtual ~IPipelineStage() = default;
+
+			/** @brief Called by the next stage when it made room in its input queue, resumes this stage if it stalled */
+			virtual void OnRoomMade() = 0;
+
+			virtual FPipelineStageStats GetStats() const = 0;
+			virtual bool IsIdle() const = 0;
+		};
+
+		template <typename In>
+		class IPipelineInput
+		{
+		public:
+			virtual ~IPipelineInput() = default;
+
+			/** @brief The value is only moved from when it could be pushed */
+			virtual bool TryPush(In&& value) = 0;
+			virtual void SetUpstream(TWeakPtr<IPipelineStage> const& upstream) = 0;
+		};
+
+		struct FPipelineStageStatsAtomic
+		{
+			std::atomic<int32> Depth { 0 };
+			std::atomic<int32> Workers { 0 };
+			std::atomic<uint64> Processed { 0 };
+			std::atomic<uint64> Stalls { 0 };
+			std::atomic<uint64> QueueCycles { 0 };
+			std::atomic<uint64> ProcessCycles { 0 };
+		};
+
+		/**
+		 *	@brief
+		 *	A stage of a TPipeline, consuming its bounded input queue with at most Parallelism tasks. When the input
+		 *	queue of the next stage is full, the produced item is parked and the stage stops consuming (so its own
+		 *	input queue fills up, propagating backpressure towards the head of the pipeline). The next stage resumes
+		 *	it once it has made room. Tasks never block waiting for room.
+		 */
+		template <typename In, typename Out, int32 Capacity, typename Function>
+		class TPipelineStage
+			: public IPipelineStage
+			, public IPipelineInput<In>
+			, public TSharedFromThis<TPipelineStage<In, Out, Capacity, Function>>
+		{
+			/** @brief Placeholder output type of sink stages, so members can be declared uniformly */
+			using FOutput = std::conditional_t<CVoid<Out>, int32, Out>;
+
+			struct FItem
+			{
+				In Value;
+				uint64 Cycles = 0;
+			};
+
+		public:
+			template <typename FunctionArg>
+			TPipelineStage(FPipelineStageOptions const& options, FunctionArg&& function)
+				: Options(options)
+				, Func(Forward<FunctionArg>(function))
+			{
+				Options.Parallelism = FMath::Max(1, Options.Parallelism);
+			}
+
+			virtual bool TryPush(In&& value) override
+			{
+				FItem item { MoveTemp(value), FPlatformTime::Cycles64() };
+				if (!Queue.Send(MoveTemp(item)))
+				{
+					value = MoveTemp(item.Value);
+					return false;
+				}
+				// Sequentially consistent with Finish: either this sees the retiring worker gone, or that worker sees
+				// the new depth, so an item can't be left in the queue without a worker
+				Stats.Depth.fetch_add(1, std::memory_order_seq_cst);
+				Schedule();
+				return true;
+			}
+
+			virtual void SetUpstream(TWeakPtr<IPipelineStage> const& upstream) override
+			{
+				Upstream = upstream;
+			}
+
+			void SetNext(TSharedRef<IPipelineInput<FOutput>> const& next)
+			{
+				Next = next;
+				next->SetUpstream(this->AsShared());
+			}
+
+			virtual void OnRoomMade() override
+			{
+				if (bWaitingForRoom.exchange(false)) Schedule();
+			}
+
+			virtual FPipelineStageStats GetStats() const override
+			{
+				const uint64 processed = Stats.Processed.load(std::memory_order_relaxed);
+				auto average = [processed](uint64 cycles)
+				{
+					return processed ? FPlatformTime::ToMilliseconds64(cycles) / processed : 0.0;
+				};
+				return {
+					.Name = Options.Name,
+					.Depth = Stats.Depth.load(std::memory_order_relaxed),
+					.ActiveWorkers = Stats.Workers.load(std::memory_order_relaxed),
+					.Processed = processed,
+					.Stalls = Stats.Stalls.load(std::memory_order_relaxed),
+					.AverageQueueMilliseconds = average(Stats.QueueCycles.load(std::memory_order_relaxed)),
+					.AverageProcessMilliseconds = average(Stats.ProcessCycles.load(std::memory_order_relaxed)),
+				};
+			}
+
+			virtual bool IsIdle() const override
+			{
+				if (Stats.Depth.load(std::memory_order_acquire) > 0 || Stats.Workers.load(std::memory_order_acquire) > 0)
+					return false;
+				if constexpr (!CVoid<Out>)
+				{
+					FScopeLock lock(&OverflowLock);
+					return Overflow.IsEmpty();
+				}
+				return true;
+			}
+
+		private:
+			void Schedule()
+			{
+				int32 workers = Stats.Workers.load(std::memory_order_seq_cst);
+				while (workers < Options.Parallelism)
+				{
+					if (Stats.Workers.compare_exchange_weak(workers, workers + 1, std::memory_order_seq_cst))
+					{
+						Dispatch();
+						return;
+					}
+				}
+			}
+
+			void Dispatch()
+			{
+				auto self = this->AsShared();
+				if (Options.Lane)
+				{
+					// A stopped lane doesn't take new work, the queued items stay in the stage
+					EnqueueInLane(*Options.Lane, [self](bool cancelled)
+					{
+						if (cancelled) self->Stats.Workers.fetch_sub(1, std::memory_order_acq_rel);
+						else self->Run();
+					});
+				}
+				else AsyncTask(Options.Thread, [self] { self->Run(); });
+			}
+
+			/** @returns False if the next stage is still full */
+			bool FlushOverflow()
+			{
+				if constexpr (CVoid<Out>) return true;
+				else
+				{
+					FScopeLock lock(&OverflowLock);
+					while (!Overflow.IsEmpty())
+					{
+						if (!Next->TryPush(MoveTemp(Overflow.First()))) return false;
+						Overflow.PopFront();
+					}
+					return true;
+				}
+			}
+
+			/** @brief Park an item which couldn't be pushed to the next stage. Returns false if it's still stalled. */
+			bool Park(FOutput&& value)
+			{
+				if constexpr (!CVoid<Out>)
+				{
+					{
+						FScopeLock lock(&OverflowLock);
+						Overflow.Add(MoveTemp(value));
+					}
+					Stats.Stalls.fetch_add(1, std::memory_order_relaxed);
+					bWaitingForRoom.store(true);
+
+					// The next stage may have made room before it could see the flag
+					if (FlushOverflow())
+					{
+						bWaitingForRoom.store(false);
+						return true;
+					}
+				}
+				return false;
+			}
+
+			void NotifyUpstream()
+			{
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (auto upstream = Upstream.Pin())
+					upstream->OnRoomMade();
+			}
+
+			void Run()
+			{
+				if (FlushOverflow()) [[likely]]
+				{
+					while (TOptional<FItem> received = Queue.TryReceive())
+					{
+						FItem& item = received.GetValue();
+						Stats.Depth.fetch_sub(1, std::memory_order_relaxed);
+						NotifyUpstream();
+
+						const uint64 start = FPlatformTime::Cycles64();
+						Stats.QueueCycles.fetch_add(start - item.Cycles, std::memory_order_relaxed);
+
+						bool stalled = false;
+						if constexpr (CVoid<Out>) Func(MoveTemp(item.Value));
+						else
+						{
+							Out output = Func(MoveTemp(item.Value));
+							if (!Next->TryPush(MoveTemp(output)))
+								stalled = !Park(MoveTemp(output));
+						}
+
+						Stats.ProcessCycles.fetch_add(FPlatformTime::Cycles64() - start, std::memory_order_relaxed);
+						Stats.Processed.fetch_add(1, std::memory_order_relaxed);
+						if (stalled) break;
+					}
+				}
+				Finish();
+			}
+
+			void Finish()
+			{
+				Stats.Workers.fetch_sub(1, std::memory_order_seq_cst);
+
+				// An item may have been pushed after the last receive, but before this worker has retired
+				if (Stats.Depth.load(std::memory_order_seq_cst) > 0 && !bWaitingForRoom.load())
+					Schedule();
+			}
+
+			FPipelineStageOptions Options;
+			std::decay_t<Function> Func;
+			TBoundedMpmcStorage<FItem, Capacity> Queue;
+			FPipelineStageStatsAtomic Stats;
+			std::atomic<bool> bWaitingForRoom { false };
+			TWeakPtr<IPipelineStage> Upstream;
+
+			TSharedPtr<IPipelineInput<FOutput>> Next;
+			mutable FCriticalSection OverflowLock;
+			TRingBuffer<FOutput> Overflow;
+		};
+	}
+
+	template <typename In, typename Tail, int32 Capacity>
+	class TPipelineBuilder;
+
+	/**
+	 *	@brief
+	 *	A producer -> transform -> consumer chain of stages connected by bounded lock-free queues. Each stage runs on
+	 *	a named thread or a work lane, with its own parallelism. When a stage falls behind, the queues in front of it
+	 *	fill up and TryPush starts to fail, instead of piling up work in memory like chained PromiseInThread calls
+	 *	would. Build one with MakePipeline.
+	 *
+	 *	@code
+	 *	auto pipeline = MakePipeline<FEncodedFrame>()
+	 *		.Then({ .Name = TEXT_"Decode", .Parallelism = 4 }, [](FEncodedFrame&& frame) { return Decode(frame); })
+	 *		.Then({ .Name = TEXT_"Process", .Parallelism = 2 }, [](FDecodedFrame&& frame) { return Process(frame); })
+	 *		.Finally({ .Name = TEXT_"Upload", .Thread = ENamedThreads::GameThread }, [this](FProcessedFrame&& frame)
+	 *		{
+	 *			Upload(frame);
+	 *		});
+	 *	
+	 *	if (!pipeline.TryPush(MoveTemp(frame)))
+	 *	{
+	 *		// The first stage is full, drop the frame or try again later
+	 *	}
+	 *	@endcode
+	 *
+	 *	Items flowing through the pipeline must be movable. Copies of a TPipeline share the
+	 *	same stages, and stages finish their work in progress even when the pipeline itself is gone.
+	 */
+	template <typename In>
+	class TPipeline
+	{
+	public:
+		/** @returns False when the input queue of the first stage is full, `value` is left untouched then */
+		bool TryPush(In&& value) { return Head->TryPush(MoveTemp(value)); }
+
+		/** @returns False when the input queue of the first stage is full */
+		bool TryPush(In const& value)
+		{
+			In copy(value);
+			return Head->TryPush(MoveTemp(copy));
+		}
+
+		/** @returns True when no stage has work queued or in progress (approximately, while items are pushed) */
+		bool IsIdle() const
+		{
+			for (auto const& stage : Stages)
+				if (!stage->IsIdle()) return false;
+			return true;
+		}
+
+		/** @returns The statistics of each stage, in order */
+		TArray<FPipelineStageStats> GetStats() const
+		{
+			TArray<FPipelineStageStats> result;
+			result.Reserve(Stages.Num());
+			for (auto const& stage : Stages)
+				result.Add(stage->GetStats());
+			return result;
+		}
+
+	private:
+		template <typename, typename, int32>
+		friend class TPipelineBuilder;
+
+		TPipeline(TSharedRef<Detail::IPipelineInput<In>> const& head, TArray<TSharedRef<Detail::IPipelineStage>>&& stages)
+			: Head(head)
+			, Stages(MoveTemp(stages))
+		{}
+
+		TSharedRef<Detail::IPipelineInput<In>> Head;
+		TArray<TSharedRef<Detail::IPipelineStage>> Stages;
+	};
+
+	/** @brief Fluent builder of TPipeline, start it with MakePipeline */
+	template <typename In, typename Tail, int32 Capacity>
+	class TPipelineBuilder
+	{
+	public:
+		/** @brief Add a stage transforming the output of the previous stage */
+		template <typename Function, typename Result = std::invoke_result_t<Function, Tail&&>>
+		requires (std::is_invocable_v<Function, Tail&&> && !CVoid<Result>)
+		TPipelineBuilder<In, std::decay_t<Result>, Capacity> Then(FPipelineStageOptions const& options, Function&& function) &&
+		{
+			using FResult = std::decay_t<Result>;
+			TPipelineBuilder<In, FResult, Capacity> next;
+			next.Head = Head;
+			auto stage = AddStage<FResult>(options, Forward<Function>(function), next.Head);
+			next.Stages = MoveTemp(Stages);
+			next.ConnectTail = [stage](TSharedRef<Detail::IPipelineInput<FResult>> const& following)
+			{
+				stage->SetNext(following);
+			};
+			return next;
+		}
+
+		/** @brief Finish the pipeline with a stage consuming the output of the previous stage */
+		template <typename Function>
+		requires (std::is_invocable_v<Function, Tail&&> && CVoid<std::invoke_result_t<Function, Tail&&>>)
+		TPipeline<In> Finally(FPipelineStageOptions const& options, Function&& function) &&
+		{
+			TSharedPtr<Detail::IPipelineInput<In>> head = Head;
+			AddStage<void>(options, Forward<Function>(function), head);
+			return TPipeline<In>(head.ToSharedRef(), MoveTemp(Stages));
+		}
+
+	private:
+		template <typename, typename, int32>
+		friend class TPipelineBuilder;
+
+		template <typename Result, typename Function>
+		auto AddStage(FPipelineStageOptions const& options, Function&& function, TSharedPtr<Detail::IPipelineInput<In>>& head)
+		{
+			using FStage = Detail::TPipelineStage<Tail, Result, Capacity, std::decay_t<Function>>;
+			auto stage = MakeShared<FStage>(options, Forward<Function>(function));
+			if (ConnectTail) ConnectTail(stage);
+			else if constexpr (CSameAs<In, Tail>) head = stage;
+			Stages.Add(stage);
+			return stage;
+		}
+
+		TSharedPtr<Detail::IPipelineInput<In>> Head;
+		TFunction<void(TSharedRef<Detail::IPipelineInput<Tail>> const&)> ConnectTail;
+		TArray<TSharedRef<Detail::IPipelineStage>> Stages;
+	};
+
+	/**
+	 *	@brief  Start building a TPipeline
+	 *	@tparam In        Type of the items pushed into the pipeline
+	 *	@tparam Capacity  Size of the input queue of each stage (power of two)
+	 */
+	template <typename In, int32 Capacity = 64>
+	TPipelineBuilder<In, In, Capacity> MakePipeline()
+	{
+		return {};
+	}
+}
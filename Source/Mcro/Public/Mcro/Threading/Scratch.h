@@ -0,0 +1,54 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Ansi/ArenaAllocator.h"
+
+namespace Mcro::Threading
+{
+	/**
+	 *	@brief
+	 *	The scratch arena of the calling thread. Inside an FTaskScratchScope TScratchArray / TScratchMap / TScratchSet
+	 *	containers take memory from this arena with a pointer bump, and it's all given back when the scope ends.
+	 */
+	MCRO_API Ansi::FArena& GetThreadScratchArena();
+
+	/**
+	 *	@brief
+	 *	Make scratch containers allocate from the scratch arena of the calling thread, and rewind it when the scope
+	 *	ends. Functions dispatched via RunInThread, PromiseInThread, ThenOn or work lanes are not wrapped in one
+	 *	implicitly: arena containers made in them might outlive the function. Open a scope in the dispatched function
+	 *	around the work which only needs temporary containers. Without a scope they allocate from the heap.
+	 *
+	 *	@warning
+	 *	Any arena container allocated inside the scope must be destroyed or emptied before the scope ends, so they
+	 *	must not be returned from the scope or captured by work it dispatches further.
+	 */
+	class FTaskScratchScope : public Ansi::FArenaScope
+	{
+	public:
+		FTaskScratchScope() : FArenaScope(GetThreadScratchArena()) {}
+	};
+}
+
+/** @brief TArray alias allocating from the scratch arena of the current task */
+template <typename T>
+using TScratchArray = TAnsiArenaArray<T>;
+
+/** @brief TSet alias allocating from the scratch arena of the current task */
+template <typename T, typename KeyFuncs = DefaultKeyFuncs<T>>
+using TScratchSet = TAnsiArenaSet<T, KeyFuncs>;
+
+/** @brief TMap alias allocating from the scratch arena of the current task */
+template <typename K, typename V, typename KeyFuncs = TDefaultMapHashableKeyFuncs<K, V, false>>
+using TScratchMap = TAnsiArenaMap<K, V, KeyFuncs>;
@@ -0,0 +1,98 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+/**
+ *	@file
+ *	RCU-style publishing of immutable snapshots, for data which is read much more often than it's written, and which
+ *	readers may need to use for a longer time without blocking writers.
+ */
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+namespace Mcro::Threading
+{
+	/** @brief An immutable copy of a value which readers can pin */
+	template <typename T>
+	struct TSnapshotNode
+	{
+		TOptional<T> Value;
+		mutable std::atomic<int32> Pins { 0 };
+	};
+
+	/**
+	 *	@brief
+	 *	RCU-style storage publishing immutable snapshots of the value. Readers pin the current snapshot, writers
+	 *	recycle snapshots which are neither current nor pinned. Snapshot nodes are only freed with the storage so
+	 *	pinning a node which just got retired is still safe, the reader will just retry on the new one.
+	 */
+	template <typename T>
+	struct TSnapshotStorage
+	{
+		TSnapshotStorage() requires std::is_default_constructible_v<T> { Publish(T()); }
+		TSnapshotStorage(T const& value) { Publish(value); }
+
+		/** @brief Only a single writer is allowed at a time */
+		template <typename ValueArg>
+		void Publish(ValueArg&& value)
+		{
+			TSnapshotNode<T>* current = Current.load(std::memory_order_relaxed);
+			TSnapshotNode<T>* target = nullptr;
+			for (TUniquePtr<TSnapshotNode<T>> const& node : Nodes)
+			{
+				if (node.Get() != current && node->Pins.load() == 0)
+				{
+					target = node.Get();
+					break;
+				}
+			}
+			if (!target)
+				target = Nodes.Add_GetRef(MakeUnique<TSnapshotNode<T>>()).Get();
+
+			target->Value = Forward<ValueArg>(value);
+			Current.store(target);
+		}
+
+		/** @brief Pin the current snapshot. It has to be released with Unpin. */
+		TSnapshotNode<T> const* Pin() const
+		{
+			for (;;)
+			{
+				TSnapshotNode<T> const* node = Current.load();
+				node->Pins.fetch_add(1);
+				if (Current.load() == node)
+					return node;
+				Unpin(node);
+			}
+		}
+
+		static void Unpin(TSnapshotNode<T> const* node)
+		{
+			node->Pins.fetch_sub(1, std::memory_order_release);
+		}
+
+		T Read() const
+		{
+			TSnapshotNode<T> const* node = Pin();
+			T result = node->Value.GetValue();
+			Unpin(node);
+			return result;
+		}
+
+	private:
+		std::atomic<TSnapshotNode<T>*> Current { nullptr };
+		TArray<TUniquePtr<TSnapshotNode<T>>> Nodes;
+	};
+}
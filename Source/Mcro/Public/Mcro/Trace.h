@@ -0,0 +1,92 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Trace/Trace.h"
+
+/**
+ *	@file
+ *	Unreal Insights instrumentation of MCRO primitives. Each area has its own trace channel, so they can be enabled
+ *	separately, for example with `-trace=cpu,McroThreading,McroEvents`. Everything here is compiled out with the rest
+ *	of MCRO instrumentation (`MCRO_INSTRUMENTATION_ENABLED`, off in Shipping builds), or when CPU profiler tracing is
+ *	disabled. Counters are incremented through the hooks of Mcro/Instrumentation.h.
+ *
+ *	| Channel          | Instrumented                                           |
+ *	|------------------|--------------------------------------------------------|
+ *	| McroThreading    | RunInThread / PromiseInThread hops                     |
+ *	| McroEvents       | TEventDelegate::Broadcast                              |
+ *	| McroState        | TState::Set / Modify                                   |
+ *	| McroComposition  | IComposable::AddComponent / component lookup           |
+ *	| McroErrors       | IError::Make                                           |
+ *	| McroYaml         | Reflected YAML serialization, mapped YAML parsing      |
+ *	| McroSlate        | Reactive widget reconciliation                         |
+ */
+
+#define MCRO_TRACE_ENABLED (CPUPROFILERTRACE_ENABLED && MCRO_INSTRUMENTATION_ENABLED)
+
+#if MCRO_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(McroThreadingChannel, MCRO_API)
+UE_TRACE_CHANNEL_EXTERN(McroEventsChannel, MCRO_API)
+UE_TRACE_CHANNEL_EXTERN(McroStateChannel, MCRO_API)
+UE_TRACE_CHANNEL_EXTERN(McroCompositionChannel, MCRO_API)
+UE_TRACE_CHANNEL_EXTERN(McroErrorsChannel, MCRO_API)
+UE_TRACE_CHANNEL_EXTERN(McroYamlChannel, MCRO_API)
+UE_TRACE_CHANNEL_EXTERN(McroSlateChannel, MCRO_API)
+
+namespace Mcro::Trace
+{
+	/** @brief Counters of MCRO primitives shown in Unreal Insights under "Mcro/" */
+	enum class ECounter : uint8
+	{
+		ThreadHops,
+		Broadcasts,
+		StateChanges,
+		ErrorsMade,
+		BindingSweeps
+	};
+
+	namespace Detail
+	{
+		MCRO_API void IncrementCounter(ECounter counter);
+	}
+
+	FORCEINLINE void IncrementCounter(ECounter counter)
+	{
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(CountersChannel)) [[unlikely]]
+			Detail::IncrementCounter(counter);
+	}
+}
+
+/**
+ *	@brief
+ *	Named CPU scope on the trace channel of an MCRO area (Threading, Events, State, Composition, Errors, Yaml, Slate).
+ *	The name must be a string literal.
+ */
+#define MCRO_TRACE_SCOPE(area, name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(name, Mcro##area##Channel)
+
+/**
+ *	@brief
+ *	Increment one of the Mcro::Trace::ECounter counters (ThreadHops, Broadcasts, StateChanges, ErrorsMade,
+ *	BindingSweeps)
+ */
+#define MCRO_TRACE_COUNT(counter) ::Mcro::Trace::IncrementCounter(::Mcro::Trace::ECounter::counter)
+
+#else
+
+#define MCRO_TRACE_SCOPE(area, name)
+#define MCRO_TRACE_COUNT(counter)
+
+#endif
@@ -0,0 +1,156 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+/**
+ *	@file
+ *	Observation points inside MCRO (thread hops, event broadcasts, error creation) for external tracing backends like
+ *	ETW on Windows. There can be one ITraceHooks implementation installed at a time, and each kind of hook is enabled
+ *	separately. A disabled hook costs a relaxed atomic load and a branch at its call site. MCRO primitives don't call
+ *	these directly, they go through Mcro/Instrumentation.h, so hooks are never called when `MCRO_INSTRUMENTATION_ENABLED`
+ *	is 0.
+ */
+namespace Mcro::TraceHooks
+{
+	enum class ETraceHook : uint32
+	{
+		None = 0,
+
+		/** @brief RunInThread enqueue and execution */
+		Threading = 1 << 0,
+
+		/** @brief TEventDelegate::Broadcast duration */
+		Events = 1 << 1,
+
+		/** @brief IError::Make by type */
+		Errors = 1 << 2,
+	};
+	ENUM_CLASS_FLAGS(ETraceHook)
+
+	/** @brief Receiver of MCRO trace hooks, functions may be called from any thread */
+	class ITraceHooks
+	{
+	public:
+		virtual ~ITraceHooks() = default;
+
+		/**
+		 *	@param targetThread  The ENamedThreads::Type the function is enqueued to
+		 *	@param hopId         Identifies the same hop in OnThreadHopExecuted
+		 */
+		virtual void OnThreadHopEnqueued(int32 targetThread, uint64 hopId) {}
+
+		/** @brief Called after the function enqueued with given hopId has finished on its target thread */
+		virtual void OnThreadHopExecuted(int32 targetThread, uint64 hopId, uint64 startCycles, uint64 endCycles) {}
+
+		/** @brief Called after a TEventDelegate broadcast has finished */
+		virtual void OnEventBroadcast(FStringView signature, uint64 startCycles, uint64 endCycles) {}
+
+		/** @brief Called when an IError of given type is made */
+		virtual void OnErrorMade(FStringView typeName) {}
+	};
+
+	/**
+	 *	@brief
+	 *	Install the receiver of the trace hooks, or remove it with nullptr. The receiver must outlive its
+	 *	installation, it's only guaranteed not to be called for hooks which are disabled. 
+	 */
+	MCRO_API void SetTraceHooks(ITraceHooks* hooks);
+
+	/** @brief Select which hooks are reported to the installed receiver */
+	MCRO_API void SetEnabledTraceHooks(ETraceHook hooks);
+
+	namespace Detail
+	{
+		MCRO_API extern std::atomic<uint32> GEnabledTraceHooks;
+		MCRO_API extern std::atomic<ITraceHooks*> GTraceHooks;
+
+		MCRO_API uint64 NextThreadHopId();
+	}
+
+	FORCEINLINE bool IsTraceHookEnabled(ETraceHook hook)
+	{
+		return (Detail::GEnabledTraceHooks.load(std::memory_order_relaxed) & static_cast<uint32>(hook)) != 0;
+	}
+
+	FORCEINLINE ITraceHooks* GetTraceHooks()
+	{
+		return Detail::GTraceHooks.load(std::memory_order_acquire);
+	}
+
+	/** @returns An ID for a function about to be enqueued to another thread, or 0 if thread hops are not traced */
+	FORCEINLINE uint64 TraceThreadHopEnqueued(int32 targetThread)
+	{
+		if (!IsTraceHookEnabled(ETraceHook::Threading)) [[likely]] return 0;
+		if (ITraceHooks* hooks = GetTraceHooks())
+		{
+			uint64 hopId = Detail::NextThreadHopId();
+			hooks->OnThreadHopEnqueued(targetThread, hopId);
+			return hopId;
+		}
+		return 0;
+	}
+
+	FORCEINLINE void TraceErrorMade(FStringView typeName)
+	{
+		if (!IsTraceHookEnabled(ETraceHook::Errors)) [[likely]] return;
+		if (ITraceHooks* hooks = GetTraceHooks())
+			hooks->OnErrorMade(typeName);
+	}
+
+	/** @brief Measures the execution of a function enqueued with an ID from TraceThreadHopEnqueued */
+	class FThreadHopScope
+	{
+	public:
+		FORCEINLINE FThreadHopScope(int32 targetThread, uint64 hopId)
+			: TargetThread(targetThread)
+			, HopId(hopId)
+			, StartCycles(hopId ? FPlatformTime::Cycles64() : 0)
+		{}
+
+		FORCEINLINE ~FThreadHopScope()
+		{
+			if (!HopId) [[likely]] return;
+			if (ITraceHooks* hooks = GetTraceHooks())
+				hooks->OnThreadHopExecuted(TargetThread, HopId, StartCycles, FPlatformTime::Cycles64());
+		}
+
+	private:
+		int32 TargetThread;
+		uint64 HopId;
+		uint64 StartCycles;
+	};
+
+	/** @brief Measures a TEventDelegate broadcast */
+	class FBroadcastScope
+	{
+	public:
+		FORCEINLINE FBroadcastScope(FStringView signature)
+			: Signature(signature)
+			, StartCycles(IsTraceHookEnabled(ETraceHook::Events) ? FPlatformTime::Cycles64() : 0)
+		{}
+
+		FORCEINLINE ~FBroadcastScope()
+		{
+			if (!StartCycles) [[likely]] return;
+			if (ITraceHooks* hooks = GetTraceHooks())
+				hooks->OnEventBroadcast(Signature, StartCycles, FPlatformTime::Cycles64());
+		}
+
+	private:
+		FStringView Signature;
+		uint64 StartCycles;
+	};
+}
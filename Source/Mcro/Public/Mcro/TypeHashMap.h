@@ -0,0 +1,393 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/TypeName.h"
+
+#include <array>
+#include <utility>
+
+#if PLATFORM_CPU_X86_FAMILY
+	#include <emmintrin.h>
+	#define MCRO_TYPE_HASH_MAP_SSE2 1
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+	#include <arm_neon.h>
+	#define MCRO_TYPE_HASH_MAP_NEON 1
+#endif
+
+#ifndef MCRO_TYPE_HASH_MAP_SSE2
+	#define MCRO_TYPE_HASH_MAP_SSE2 0
+#endif
+#ifndef MCRO_TYPE_HASH_MAP_NEON
+	#define MCRO_TYPE_HASH_MAP_NEON 0
+#endif
+
+/**
+ *	@file
+ *	@brief
+ *	Associative containers keyed by `FTypeHash` (or any other already uniformly distributed 64 bit hash). As the keys
+ *	are XXH3 hashes themselves they're not hashed again, their bits are used directly to find their place in the table.
+ */
+
+namespace Mcro::TypeHashMap
+{
+	using namespace Mcro::TypeName;
+
+	namespace Detail
+	{
+		constexpr int32 GroupWidth = 16;
+		constexpr uint8 EmptyControl = 0x80;
+		constexpr uint8 DeletedControl = 0xFE;
+
+		/** @brief The 7 bits of a hash stored in the control bytes, the rest is used for finding the group */
+		constexpr uint8 GetTag(FTypeHash hash) { return static_cast<uint8>(hash >> 57); }
+
+		/**
+		 *	@brief
+		 *	Bit-mask of the slots in a group of 16 control bytes which are equal to `control`. Each slot is represented
+		 *	by `MatchStride` bits.
+		 */
+#if MCRO_TYPE_HASH_MAP_SSE2
+		constexpr int32 MatchStride = 1;
+
+		FORCEINLINE uint64 MatchGroup(const uint8* group, uint8 control)
+		{
+			const __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(static_cast<char>(control)))));
+		}
+#elif MCRO_TYPE_HASH_MAP_NEON
+		constexpr int32 MatchStride = 4;
+
+		FORCEINLINE uint64 MatchGroup(const uint8* group, uint8 control)
+		{
+			const uint8x16_t equal = vceqq_u8(vld1q_u8(group), vdupq_n_u8(control));
+			return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(equal), 4)), 0);
+		}
+#else
+		constexpr int32 MatchStride = 1;
+
+		FORCEINLINE uint64 MatchGroup(const uint8* group, uint8 control)
+		{
+			uint64 result = 0;
+			for (int32 i = 0; i < GroupWidth; ++i)
+				result |= static_cast<uint64>(group[i] == control) << i;
+			return result;
+		}
+#endif
+
+		/** @brief Pop the index of the first matching slot from a mask returned by `MatchGroup` */
+		FORCEINLINE int32 PopFirstMatch(uint64& mask)
+		{
+			const int32 slot = static_cast<int32>(FMath::CountTrailingZeros64(mask)) / MatchStride;
+			mask &= ~(((1ull << MatchStride) - 1) << (slot * MatchStride));
+			return slot;
+		}
+
+		/** @brief Calling this at compile time stops compilation, a frozen map was given the same key multiple times */
+		inline void FrozenTypeHashMapHasDuplicateKeys() {}
+	}
+
+	/**
+	 *	@brief
+	 *	Open addressing flat hash map, keyed by `FTypeHash`.
+	 *
+	 *	Elements are stored densely in insertion order (removal swaps the last element into the hole), next to a table
+	 *	of control bytes and indices. Lookups probe 16 control bytes at once with SSE2 or NEON, and only compare the
+	 *	actual keys where a 7 bit tag of the hash matches. Compared to `TMap` the keys are not re-hashed and there's no
+	 *	sparse array or hash bucket chain in between.
+	 *
+	 *	@code
+	 *	TTypeHashMap<FString> descriptions;
+	 *	descriptions.Add<FMyType>(TEXT_"My type");
+	 *	if (FString* description = descriptions.Find<FMyType>())
+	 *		UE_LOG(LogTemp, Display, TEXT_"%s", **description);
+	 *	@endcode
+	 *
+	 *	@tparam Value  The mapped type
+	 */
+	template <typename Value>
+	class TTypeHashMap
+	{
+	public:
+		using FEntry = TPair<FTypeHash, Value>;
+
+		TTypeHashMap() = default;
+
+		/** @brief Pre-allocate enough room for `count` elements so adding them doesn't rehash */
+		void Reserve(int32 count)
+		{
+			Entries.Reserve(count);
+			if (count > MaxLoad()) Rehash(CapacityFor(count));
+		}
+
+		/** @return Pointer to the value associated with `key` or nullptr if it's not in the map */
+		Value* Find(FTypeHash key)
+		{
+			const int32 entry = FindEntry(key).Key;
+			return entry != INDEX_NONE ? &Entries[entry].Value : nullptr;
+		}
+
+		/** @copydoc Find(FTypeHash) */
+		const Value* Find(FTypeHash key) const
+		{
+			return const_cast<TTypeHashMap*>(this)->Find(key);
+		}
+
+		/** @brief Find the value associated with type `T` */
+		template <typename T>
+		Value* Find() { return Find(TTypeHash<T>); }
+
+		/** @copydoc Find() */
+		template <typename T>
+		const Value* Find() const { return Find(TTypeHash<T>); }
+
+		bool Contains(FTypeHash key) const { return FindEntry(key).Key != INDEX_NONE; }
+
+		template <typename T>
+		bool Contains() const { return Contains(TTypeHash<T>); }
+
+		/** @brief Get the value associated with `key`, or construct one with `args` if it's not in the map yet */
+		template <typename... Args>
+		Value& FindOrAdd(FTypeHash key, Args&&... args)
+		{
+			const TPair<int32, int32> found = FindEntry(key);
+			if (found.Key != INDEX_NONE) return Entries[found.Key].Value;
+
+			const int32 entry = Entries.Emplace(key, Value(Forward<Args>(args)...));
+			Insert(key, entry);
+			return Entries[entry].Value;
+		}
+
+		/** @brief Associate `value` with `key`, replacing the previous value if `key` was already in the map */
+		template <typename ValueArg>
+		Value& Add(FTypeHash key, ValueArg&& value)
+		{
+			const TPair<int32, int32> found = FindEntry(key);
+			if (found.Key != INDEX_NONE)
+				return Entries[found.Key].Value = Forward<ValueArg>(value);
+			return FindOrAdd(key, Forward<ValueArg>(value));
+		}
+
+		/** @brief Associate `value` with type `T` */
+		template <typename T, typename ValueArg>
+		Value& Add(ValueArg&& value) { return Add(TTypeHash<T>, Forward<ValueArg>(value)); }
+
+		/** @return True if `key` was in the map and it has been removed */
+		bool Remove(FTypeHash key)
+		{
+			const TPair<int32, int32> found = FindEntry(key);
+			if (found.Key == INDEX_NONE) return false;
+
+			Controls[found.Value] = Detail::DeletedControl;
+			++DeletedCount;
+
+			const int32 last = Entries.Num() - 1;
+			if (found.Key != last)
+				Slots[FindEntry(Entries[last].Key).Value] = found.Key;
+			Entries.RemoveAtSwap(found.Key, EAllowShrinking::No);
+			return true;
+		}
+
+		int32 Num() const { return Entries.Num(); }
+		bool IsEmpty() const { return Entries.IsEmpty(); }
+
+		/** @brief Remove all elements but keep the allocated memory */
+		void Reset()
+		{
+			Entries.Reset();
+			FMemory::Memset(Controls.GetData(), Detail::EmptyControl, Controls.Num());
+			DeletedCount = 0;
+		}
+
+		/** @brief Remove all elements and free the allocated memory */
+		void Empty()
+		{
+			Entries.Empty();
+			Controls.Empty();
+			Slots.Empty();
+			DeletedCount = 0;
+		}
+
+		/** @brief The elements of the map in insertion order (until something is removed) */
+		TArrayView<const FEntry> GetEntries() const { return Entries; }
+
+		auto begin()       { return Entries.begin(); }
+		auto begin() const { return Entries.begin(); }
+		auto end()         { return Entries.end(); }
+		auto end()   const { return Entries.end(); }
+
+	private:
+		TArray<FEntry> Entries;
+		TArray<uint8> Controls;
+		TArray<int32> Slots;
+		int32 DeletedCount = 0;
+
+		int32 Capacity() const { return Controls.Num(); }
+		int32 MaxLoad() const { return Capacity() / 8 * 7; }
+
+		static int32 CapacityFor(int32 count)
+		{
+			return FMath::Max(
+				Detail::GroupWidth,
+				static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(count) * 8 / 7 + 1))
+			);
+		}
+
+		/** @return Index of the entry and index of its slot, or INDEX_NONE for both */
+		TPair<int32, int32> FindEntry(FTypeHash key) const
+		{
+			if (Entries.IsEmpty()) return { INDEX_NONE, INDEX_NONE };
+
+			const uint8 tag = Detail::GetTag(key);
+			const int32 groupMask = Capacity() / Detail::GroupWidth - 1;
+			int32 group = static_cast<int32>(key) & groupMask;
+			for (int32 step = 1; ; ++step)
+			{
+				const int32 groupStart = group * Detail::GroupWidth;
+				const uint8* controls = Controls.GetData() + groupStart;
+				for (uint64 matches = Detail::MatchGroup(controls, tag); matches;)
+				{
+					const int32 slot = groupStart + Detail::PopFirstMatch(matches);
+					if (Entries[Slots[slot]].Key == key) return { Slots[slot], slot };
+				}
+				if (Detail::MatchGroup(controls, Detail::EmptyControl)) return { INDEX_NONE, INDEX_NONE };
+				group = (group + step) & groupMask;
+			}
+		}
+
+		void Insert(FTypeHash key, int32 entry)
+		{
+			if (Entries.Num() + DeletedCount > MaxLoad())
+			{
+				// Rebuilding from the entries also gets rid of the deleted slots
+				Rehash(CapacityFor(Entries.Num()));
+				return;
+			}
+
+			const int32 groupMask = Capacity() / Detail::GroupWidth - 1;
+			int32 group = static_cast<int32>(key) & groupMask;
+			for (int32 step = 1; ; ++step)
+			{
+				const int32 groupStart = group * Detail::GroupWidth;
+				uint64 free = Detail::MatchGroup(Controls.GetData() + groupStart, Detail::EmptyControl)
+					| Detail::MatchGroup(Controls.GetData() + groupStart, Detail::DeletedControl);
+				if (free)
+				{
+					const int32 slot = groupStart + Detail::PopFirstMatch(free);
+					if (Controls[slot] == Detail::DeletedControl) --DeletedCount;
+					Controls[slot] = Detail::GetTag(key);
+					Slots[slot] = entry;
+					return;
+				}
+				group = (group + step) & groupMask;
+			}
+		}
+
+		void Rehash(int32 capacity)
+		{
+			Controls.SetNumUninitialized(capacity);
+			Slots.SetNumUninitialized(capacity);
+			FMemory::Memset(Controls.GetData(), Detail::EmptyControl, capacity);
+			DeletedCount = 0;
+			for (int32 i = 0; i < Entries.Num(); ++i)
+				Insert(Entries[i].Key, i);
+		}
+	};
+
+	/**
+	 *	@brief
+	 *	Fixed, immutable `FTypeHash` keyed map which can be built during compilation, for static registries. It uses
+	 *	linear probing in a power-of-two sized table, at most half full.
+	 *
+	 *	@code
+	 *	constexpr auto registry = MakeFrozenTypeHashMap<int32>(
+	 *		std::pair { TTypeHash<FFoo>, 1 },
+	 *		std::pair { TTypeHash<FBar>, 2 }
+	 *	);
+	 *	static_assert(*registry.Find<FBar>() == 2);
+	 *	@endcode
+	 *
+	 *	Giving the same key twice stops compilation when the map is built in a constant expression.
+	 *
+	 *	@tparam Value  The mapped type, it has to be default constructible
+	 *	@tparam Count  The number of elements
+	 */
+	template <typename Value, int32 Count>
+	class TFrozenTypeHashMap
+	{
+		static constexpr int32 Capacity = []
+		{
+			int32 result = 1;
+			while (result < Count * 2) result *= 2;
+			return result;
+		}();
+
+	public:
+		constexpr TFrozenTypeHashMap(std::array<std::pair<FTypeHash, Value>, Count> const& entries)
+		{
+			Slots.fill(INDEX_NONE);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				const FTypeHash key = entries[i].first;
+				int32 slot = static_cast<int32>(key & (Capacity - 1));
+				while (Slots[slot] != INDEX_NONE)
+				{
+					if (Keys[slot] == key) Detail::FrozenTypeHashMapHasDuplicateKeys();
+					slot = (slot + 1) & (Capacity - 1);
+				}
+				Keys[slot] = key;
+				Slots[slot] = i;
+				Values[i] = entries[i].second;
+			}
+		}
+
+		/** @return Pointer to the value associated with `key` or nullptr if it's not in the map */
+		constexpr const Value* Find(FTypeHash key) const
+		{
+			for (int32 slot = static_cast<int32>(key & (Capacity - 1)); Slots[slot] != INDEX_NONE; slot = (slot + 1) & (Capacity - 1))
+			{
+				if (Keys[slot] == key) return &Values[Slots[slot]];
+			}
+			return nullptr;
+		}
+
+		/** @brief Find the value associated with type `T` */
+		template <typename T>
+		constexpr const Value* Find() const { return Find(TTypeHash<T>); }
+
+		constexpr bool Contains(FTypeHash key) const { return Find(key) != nullptr; }
+
+		template <typename T>
+		constexpr bool Contains() const { return Contains(TTypeHash<T>); }
+
+		static constexpr int32 Num() { return Count; }
+
+		/** @brief The values in the order they were given */
+		constexpr std::array<Value, Count> const& GetValues() const { return Values; }
+
+	private:
+		std::array<FTypeHash, Capacity> Keys {};
+		std::array<int32, Capacity> Slots {};
+		std::array<Value, Count> Values {};
+	};
+
+	/** @brief Build a `TFrozenTypeHashMap` from key-value pairs, preferably in a constant expression */
+	template <typename Value, typename... Pairs>
+	constexpr auto MakeFrozenTypeHashMap(Pairs&&... pairs)
+	{
+		return TFrozenTypeHashMap<Value, sizeof...(Pairs)>(
+			std::array<std::pair<FTypeHash, Value>, sizeof...(Pairs)> { std::pair<FTypeHash, Value>(Forward<Pairs>(pairs))... }
+		);
+	}
+}
@@ -16,65 +16,106 @@
 #include "Mcro/TextMacros.h"
 #include "Mcro/TypeName.h"
 
+#include <array>
+
 namespace Mcro::TypeInfo
 {
 	using namespace Mcro::TypeName;
 	using namespace Mcro::Inheritance;
 	
+	namespace Detail
+	{
+		/** @brief Compile-time information about a type, FType points to one static instance of it for each type */
+		struct FTypeDescriptor
+		{
+			FStringView Name;
+			FTypeHash Hash = 0;
+			const FTypeHash* BaseTypeHashes = nullptr;
+			int32 BaseCount = 0;
+		};
+
+		template <typename T>
+		consteval int32 CountExplicitBases()
+		{
+			int32 result = 0;
+			if constexpr (CHasBases<T>)
+				ForEachExplicitBase<T>([&] <typename Base> () { ++result; });
+			return result;
+		}
+
+		template <typename T>
+		struct TTypeDescriptor
+		{
+			static constexpr int32 BaseCount = CountExplicitBases<T>();
+
+			static consteval std::array<FTypeHash, BaseCount> GetBaseTypeHashes()
+			{
+				std::array<FTypeHash, BaseCount> result {};
+				if constexpr (CHasBases<T>)
+				{
+					int32 index = 0;
+					ForEachExplicitBase<T>([&] <typename Base> ()
+					{
+						result[index] = TTypeHash<Base>;
+						++index;
+					});
+				}
+				return result;
+			}
+
+			static constexpr std::array<FTypeHash, BaseCount> BaseTypeHashes = GetBaseTypeHashes();
+
+			static constexpr FTypeDescriptor Value {
+				.Name = FStringView(GetCompileTimeTypeName<T>().data(), GetCompileTimeTypeName<T>().size()),
+				.Hash = GetCompileTimeTypeHash<T>(),
+				.BaseTypeHashes = BaseTypeHashes.data(),
+				.BaseCount = BaseCount
+			};
+		};
+	}
+	
 	/**
 	 *	@brief
 	 *	Group together type info for identification. Can have an invalid state when no type is specified.
 	 *
 	 *	If given type also explicitly list its inheritance (through `TInherit` for example) base types are also stored
 	 *	for type safety checks.
+	 *
+	 *	FType is only a pointer to a static compile-time descriptor of the type, so it's cheap to copy and store.
+	 *	Comparisons are done by type hash, because descriptors may be duplicated across module boundaries.
 	 */
 	struct MCRO_API FType
 	{
-		static constexpr int32 MaxBaseCount = 64;
-		
 		template <typename T>
 		struct TTag {};
 		
 		template <typename T>
 		constexpr FType(TTag<T>&&)
-			: Name(
-				GetCompileTimeTypeName<std::decay_t<T>>().data(),
-				GetCompileTimeTypeName<std::decay_t<T>>().size()
-			)
-			, Hash(GetCompileTimeTypeHash<std::decay_t<T>>())
-		{
-			if constexpr (CHasBases<T>)
-			{
-				ForEachExplicitBase<T>([this] <typename Base> ()
-				{
-					if (BaseCount >= MaxBaseCount) return;
-					BaseTypeHashes[BaseCount] = TTypeHash<Base>;
-					++BaseCount;
-				});
-			}
-		}
+			: Descriptor(&Detail::TTypeDescriptor<std::decay_t<T>>::Value)
+		{}
 		
 		constexpr FType() {}
-		
-		FStringView Name;
-		FTypeHash Hash = 0;
 
-		constexpr FStringView ToString() const { return Name; }
-		FORCEINLINE FString ToStringCopy() const { return FString(Name); }
+		constexpr FStringView ToString() const { return Descriptor ? Descriptor->Name : FStringView(); }
+		FORCEINLINE FString ToStringCopy() const { return FString(ToString()); }
 
-		constexpr bool IsValid() const { return Hash != 0; }
+		constexpr FTypeHash GetHash() const { return Descriptor ? Descriptor->Hash : 0; }
+
+		constexpr bool IsValid() const { return GetHash() != 0; }
 		constexpr operator bool() const { return IsValid(); }
 
 		/** @brief check to see if pointers of this and the other types are safe to cast between */
 		constexpr bool IsCompatibleWith(FType const& other) const
 		{
-			if (Hash == other.Hash) return true;
+			const FTypeHash hash = GetHash();
+			const FTypeHash otherHash = other.GetHash();
+			if (hash == otherHash) return true;
 			
 			for (const FTypeHash base : other)
-				if (base == Hash) return true;
+				if (base == hash) return true;
 			
 			for (const FTypeHash base : *this)
-				if (base == other.Hash) return true;
+				if (base == otherHash) return true;
 			
 			return false;
 		}
@@ -83,21 +124,24 @@ namespace Mcro::TypeInfo
 		template <typename Other>
 		constexpr bool IsCompatibleWith() const;
 		
-		friend constexpr bool operator == (FType const& left, FType const& right) { return left.Hash == right.Hash; }
-		friend constexpr bool operator != (FType const& left, FType const& right) { return left.Hash != right.Hash; }
+		friend constexpr bool operator == (FType const& left, FType const& right)
+		{
+			return left.Descriptor == right.Descriptor || left.GetHash() == right.GetHash();
+		}
+		friend constexpr bool operator != (FType const& left, FType const& right) { return !(left == right); }
 
 		friend constexpr uint32 GetTypeHash(FType const& self)
 		{
-			return static_cast<uint32>(self.Hash) ^ static_cast<uint32>(self.Hash >> 32);
+			const FTypeHash hash = self.GetHash();
+			return static_cast<uint32>(hash) ^ static_cast<uint32>(hash >> 32);
 		}
 
-		constexpr const FTypeHash* begin() const { return BaseTypeHashes; }
-		constexpr const FTypeHash* end() const { return BaseTypeHashes + BaseCount; }
-		constexpr size_t size() const { return BaseCount; }
+		constexpr const FTypeHash* begin() const { return Descriptor ? Descriptor->BaseTypeHashes : nullptr; }
+		constexpr const FTypeHash* end() const { return Descriptor ? Descriptor->BaseTypeHashes + Descriptor->BaseCount : nullptr; }
+		constexpr size_t size() const { return Descriptor ? Descriptor->BaseCount : 0; }
 		
 	private:
-		FTypeHash BaseTypeHashes[MaxBaseCount] {};
-		int32 BaseCount = 0;
+		const Detail::FTypeDescriptor* Descriptor = nullptr;
 	};
 
 	template <typename T>
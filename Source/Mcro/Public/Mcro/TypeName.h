@@ -173,22 +173,26 @@ namespace Mcro::TypeName
 
 	/**
 	 *	@brief
-	 *	Same as `TTypeName` converted to FName. This is not cached and a new FName is created every time this is called.
+	 *	Same as `TTypeName` converted to FName. The FName is created once per type on first use (thread-safe), later
+	 *	calls don't touch the global name table.
 	 */
 	template <typename T>
 	FName TTypeFName()
 	{
-		return FName(TTypeName<T>.Len(), TTypeName<T>.GetData());
+		static const FName name(TTypeName<T>.Len(), TTypeName<T>.GetData());
+		return name;
 	}
 
 	/**
 	 *	@brief
-	 *	Same as `TTypeName` converted to FString. This is not cached and a new FString is created every time this is called.
+	 *	Same as `TTypeName` converted to FString. The FString is created once per type on first use (thread-safe), and
+	 *	a reference to it is returned afterwards, so formatting type names into logs or errors doesn't allocate.
 	 */
 	template <typename T>
-	FString TTypeString()
+	const FString& TTypeString()
 	{
-		return FString::ConstructFromPtrSize(TTypeName<T>.GetData(), TTypeName<T>.Len());
+		static const FString string = FString::ConstructFromPtrSize(TTypeName<T>.GetData(), TTypeName<T>.Len());
+		return string;
 	}
 }
 
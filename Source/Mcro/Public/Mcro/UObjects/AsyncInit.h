@@ -0,0 +1,263 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "Async/ParallelFor.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Mcro/UObjects/Init.h"
+#include "Mcro/Threading.h"
+
+namespace Mcro::UObjects::Init
+{
+	using namespace Mcro::Threading;
+
+	/** @brief Options for constructing UObjects with their initialization prepared on a worker thread */
+	struct FAsyncConstructParameters
+	{
+		/** @brief Priority of the game thread step in the time-sliced game thread queue */
+		EGameThreadQueuePriority Priority = EGameThreadQueuePriority::Normal;
+
+		/**
+		 *	@brief
+		 *	Construct the objects on the worker thread too, flagged with `EInternalObjectFlags::Async` (like async
+		 *	loading does), so only the flag is cleared and the initializer is executed on the game thread. Only use it
+		 *	for classes which constructors and `PostInitProperties` are safe to run outside of the game thread.
+		 */
+		bool bConstructOnWorker = false;
+	};
+
+	namespace Detail
+	{
+		template <CUObject T>
+		T* ConstructForHandoff(FBulkObjectConstructor& constructor)
+		{
+			return static_cast<T*>(constructor.Construct());
+		}
+
+		template <CUObject T>
+		void HandoffToGameThread(T* object)
+		{
+			object->AtomicallyClearInternalFlags(EInternalObjectFlags::Async);
+		}
+
+		/**
+		 *	@brief
+		 *	Queue a game thread step of the construction in the time-sliced game thread queue. That queue is drained at
+		 *	the end of engine frames, which commandlets don't have, so there the step is dispatched as a regular game
+		 *	thread task instead.
+		 */
+		template <typename Function>
+		void QueueGameThreadStep(Function&& func, EGameThreadQueuePriority priority)
+		{
+			if (IsRunningCommandlet())
+				AsyncTask(ENamedThreads::GameThread, FWD(func));
+			else
+				QueueInGameThread(FWD(func), priority);
+		}
+
+		inline FConstructObjectParameters FlagForWorker(FConstructObjectParameters&& params, bool onWorker)
+		{
+			if (onWorker) params.InternalSetFlags |= EInternalObjectFlags::Async;
+			return MoveTemp(params);
+		}
+	}
+
+	/**
+	 *	@brief
+	 *	Construct a UObject in two steps: first an expensive preparation (like parsing or computing payload data) runs
+	 *	on a worker thread, then the object is constructed and initialized with the prepared payload on the game
+	 *	thread, executed by the time-sliced game thread queue (see QueueInGameThread).
+	 *
+	 *	The future is only fulfilled once the game thread executed its step, so never block the game thread waiting
+	 *	for it. In commandlets (which have no engine frames draining that queue) the game thread step is a regular
+	 *	game thread task, so the commandlet has to process game thread tasks meanwhile, for example with
+	 *	`FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread)`.
+	 *
+	 *	Usage:
+	 *	@code
+	 *	using namespace Mcro::UObjects::Init;
+	 *	
+	 *	TFuture<TStrongObjectPtr<UMyObject>> myObject = ConstructObjectAsync({},
+	 *		[path] { return ParseMyData(path); },
+	 *		[](UMyObject& _, FMyData&& data) { _.Data = MoveTemp(data); }
+	 *	);
+	 *	@endcode
+	 *
+	 *	@tparam  Preparation  Function returning the payload, executed on a worker thread
+	 *	@tparam  Initializer  Function receiving the new object and the payload, executed on the game thread
+	 *	@param        params  Parameters for the new object
+	 *	@param       prepare  The worker thread part of initialization
+	 *	@param          init  The game thread part of initialization
+	 *	@param   asyncParams  Options for the asynchronous construction
+	 *	@return  A future of the new object which is kept alive until the result is released
+	 */
+	template <
+		CFunctorObject Preparation,
+		CFunctorObject Initializer,
+		typename Payload = std::decay_t<TFunction_Return<Preparation>>,
+		typename TArg = TFunction_Arg<Initializer, 0>,
+		CUObject T = std::decay_t<TArg>
+	>
+	requires std::is_lvalue_reference_v<TArg> && std::is_invocable_v<Initializer, T&, Payload&&>
+	TFuture<TStrongObjectPtr<T>> ConstructObjectAsync(
+		FConstructObjectParameters&& params,
+		Preparation&& prepare,
+		Initializer&& init,
+		FAsyncConstructParameters const& asyncParams = {}
+	) {
+		TPromise<TStrongObjectPtr<T>> promise;
+		TFuture<TStrongObjectPtr<T>> result = promise.GetFuture();
+		Async(EAsyncExecution::TaskGraph, [
+			params = Detail::FlagForWorker(MoveTemp(params), asyncParams.bConstructOnWorker),
+			prepare = FWD(prepare),
+			init = FWD(init),
+			asyncParams,
+			promise = MoveTemp(promise)
+		] mutable
+		{
+			Payload payload = prepare();
+			T* object = nullptr;
+			if (asyncParams.bConstructOnWorker)
+			{
+				Detail::FBulkObjectConstructor constructor(params, T::StaticClass(), 1);
+				object = Detail::ConstructForHandoff<T>(constructor);
+			}
+			Detail::QueueGameThreadStep([
+				params = MoveTemp(params),
+				init = MoveTemp(init),
+				payload = MoveTemp(payload),
+				promise = MoveTemp(promise),
+				object
+			] mutable
+			{
+				if (object) Detail::HandoffToGameThread(object);
+				else
+				{
+					Detail::FBulkObjectConstructor constructor(params, T::StaticClass(), 1);
+					object = Detail::ConstructForHandoff<T>(constructor);
+				}
+				init(*object, MoveTemp(payload));
+				promise.SetValue(TStrongObjectPtr<T>(object));
+			}, asyncParams.Priority);
+		});
+		return result;
+	}
+
+	/**
+	 *	@brief
+	 *	Bulk variant of ConstructObjectAsync creating an object for each item. Payloads are prepared in parallel on
+	 *	worker threads, then each object is constructed and initialized as a separate item of the time-sliced game
+	 *	thread queue, so a large batch is spread over multiple frames. The same rules apply to waiting for the result
+	 *	as with ConstructObjectAsync.
+	 *
+	 *	@tparam  Preparation  Function receiving an item and returning the payload, executed on worker threads
+	 *	@tparam  Initializer  Function receiving the new object and the payload, executed on the game thread
+	 *	@param        params  Parameters for every new object
+	 *	@param         items  An object is created for each item
+	 *	@param       prepare  The worker thread part of initialization
+	 *	@param          init  The game thread part of initialization
+	 *	@param   asyncParams  Options for the asynchronous construction
+	 *	@return  A future of the new objects in the order of the items
+	 */
+	template <
+		typename Item,
+		CFunctorObject Preparation,
+		CFunctorObject Initializer,
+		typename Payload = std::decay_t<TFunction_Return<Preparation>>,
+		typename TArg = TFunction_Arg<Initializer, 0>,
+		CUObject T = std::decay_t<TArg>
+	>
+	requires std::is_lvalue_reference_v<TArg>
+		&& std::is_invocable_v<Preparation, Item const&>
+		&& std::is_invocable_v<Initializer, T&, Payload&&>
+	TFuture<TArray<TStrongObjectPtr<T>>> ConstructObjectsAsync(
+		FConstructObjectParameters&& params,
+		TArray<Item>&& items,
+		Preparation&& prepare,
+		Initializer&& init,
+		FAsyncConstructParameters const& asyncParams = {}
+	) {
+		struct FBatch
+		{
+			FConstructObjectParameters Params;
+			std::decay_t<Initializer> Init;
+			TPromise<TArray<TStrongObjectPtr<T>>> Promise;
+			TArray<TOptional<Payload>> Payloads;
+			TArray<T*> Objects;
+			TArray<TStrongObjectPtr<T>> Result;
+			TUniquePtr<Detail::FBulkObjectConstructor> GameThreadConstructor;
+			int32 Remaining = 0;
+		};
+
+		auto batch = MakeShared<FBatch>(FBatch {
+			.Params = Detail::FlagForWorker(MoveTemp(params), asyncParams.bConstructOnWorker),
+			.Init = FWD(init)
+		});
+		TFuture<TArray<TStrongObjectPtr<T>>> result = batch->Promise.GetFuture();
+
+		Async(EAsyncExecution::TaskGraph, [batch, items = MoveTemp(items), prepare = FWD(prepare), asyncParams] mutable
+		{
+			const int32 count = items.Num();
+			batch->Payloads.SetNum(count);
+			batch->Objects.SetNumZeroed(count);
+			batch->Result.SetNum(count);
+			batch->Remaining = count;
+			if (count == 0)
+			{
+				batch->Promise.SetValue({});
+				return;
+			}
+
+			ParallelFor(count, [&](int32 i) { batch->Payloads[i].Emplace(prepare(items[i])); });
+
+			if (asyncParams.bConstructOnWorker)
+			{
+				Detail::FBulkObjectConstructor constructor(batch->Params, T::StaticClass(), count);
+				for (int32 i = 0; i < count; ++i)
+					batch->Objects[i] = Detail::ConstructForHandoff<T>(constructor);
+			}
+
+			for (int32 i = 0; i < count; ++i)
+			{
+				Detail::QueueGameThreadStep([batch, i]
+				{
+					T* object = batch->Objects[i];
+					if (object) Detail::HandoffToGameThread(object);
+					else
+					{
+						if (!batch->GameThreadConstructor)
+						{
+							batch->GameThreadConstructor = MakeUnique<Detail::FBulkObjectConstructor>(
+								batch->Params, T::StaticClass(), batch->Objects.Num()
+							);
+						}
+						object = Detail::ConstructForHandoff<T>(*batch->GameThreadConstructor);
+					}
+					batch->Init(*object, MoveTemp(batch->Payloads[i].GetValue()));
+					batch->Payloads[i].Reset();
+					batch->Result[i] = TStrongObjectPtr<T>(object);
+
+					// Game thread items are executed one after the other, no need for atomics
+					if (--batch->Remaining == 0)
+					{
+						batch->GameThreadConstructor.Reset();
+						batch->Promise.SetValue(MoveTemp(batch->Result));
+					}
+				}, asyncParams.Priority);
+			}
+		});
+		return result;
+	}
+}
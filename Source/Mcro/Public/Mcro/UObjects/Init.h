@@ -14,6 +14,9 @@
 #include "CoreMinimal.h"
 #include "Mcro/FunctionTraits.h"
 
+struct FStaticConstructObjectParameters;
+class FGCScopeGuard;
+
 namespace Mcro::UObjects::Init
 {
 	using namespace Mcro::FunctionTraits;
@@ -83,10 +86,45 @@ namespace Mcro::UObjects::Init
 
 		/** @brief Callback for custom code to initialize properties before `PostInitProperties` runs */
 		TFunction<void()> PropertyInitCallback;
+
+		/**
+		 *	@brief
+		 *	Only used when constructing objects in bulk. Name the new objects `Name_N` (or `ClassName_N` when Name is
+		 *	`NAME_None`) with increasing numbers probed from a single base, instead of generating a unique name for
+		 *	each object separately. A given Name is always used this way in bulk construction.
+		 */
+		bool bSequentialNames = false;
 	};
 
 	namespace Detail
 	{
+		/**
+		 *	@brief
+		 *	Constructs many objects from the same parameters, resolving the class, the archetype and the name base only
+		 *	once. Garbage collection is blocked while it exists.
+		 */
+		class MCRO_API FBulkObjectConstructor
+		{
+		public:
+			FBulkObjectConstructor(FConstructObjectParameters const& params, const UClass* defaultClass, int32 count);
+			~FBulkObjectConstructor();
+
+			FBulkObjectConstructor(FBulkObjectConstructor const&) = delete;
+			FBulkObjectConstructor& operator = (FBulkObjectConstructor const&) = delete;
+
+			/** @brief Construct the next object */
+			UObject* Construct();
+
+		private:
+			FName MakeNextName();
+
+			TUniquePtr<FStaticConstructObjectParameters> Params;
+			FName BaseName = NAME_None;
+			int32 NextNumber = 0;
+			bool bResolveTemplate = false;
+			TUniquePtr<FGCScopeGuard> GCGuard;
+		};
+
 		template <CUObject T, typename... Args>
 		void InitObject(T* object, Args&&... args) {}
 		
@@ -224,4 +262,124 @@ namespace Mcro::UObjects::Init
 		Detail::InitObject(result, FWD(args)...);
 		return result;
 	}
+
+	/**
+	 *	@brief
+	 *	Create many new objects with the same parameters, which can also be initialized with an `Initialize` function
+	 *	if they have one. Class and archetype are resolved only once, use `bSequentialNames` for cheaper name
+	 *	generation. The same `args` are passed to every `Initialize` call.
+	 *	
+	 *	@tparam       T  Type of initializable UObject
+	 *	@tparam    Args  Arguments for the Initialize function
+	 *	@param    count  Number of objects to create
+	 *	@param   params  Parameters for every new object
+	 *	@param     args  Arguments for the Initialize function
+	 *	@return  The new objects
+	 */
+	template <CUObject T, typename... Args>
+	TArray<T*> NewInitBulk(int32 count, FConstructObjectParameters&& params, Args const&... args)
+	{
+		TArray<T*> result;
+		result.Reserve(count);
+		Detail::FBulkObjectConstructor constructor(params, T::StaticClass(), count);
+		for (int32 i = 0; i < count; ++i)
+		{
+			T* object = static_cast<T*>(constructor.Construct());
+			Detail::InitObject(object, args...);
+			result.Add(object);
+		}
+		return result;
+	}
+
+	/**
+	 *	@brief
+	 *	Bulk variant of ConstructObject creating `count` objects. The initializer also receives the index of the
+	 *	object being initialized.
+	 *	
+	 *	Usage:
+	 *	@code
+	 *	using namespace Mcro::UObjects::Init;
+	 *	
+	 *	TArray<UMyObject*> myObjects = ConstructObjects(1000, {.bSequentialNames = true}, [](UMyObject& _, int32 index)
+	 *	{
+	 *		_.Index = index;
+	 *	});
+	 *	@endcode
+	 *	
+	 *	@tparam  Initializer  Initializer function type
+	 *	@param         count  Number of objects to create
+	 *	@param        params  Parameters for every new object
+	 *	@param          init  A setup function for each newly created UObject
+	 *	@return  The new objects
+	 */
+	template <
+		CFunctorObject Initializer,
+		typename TArg = TFunction_Arg<Initializer, 0>,
+		CUObject T = std::decay_t<TArg>
+	>
+	requires std::is_lvalue_reference_v<TArg> && std::is_invocable_v<Initializer, T&, int32>
+	TArray<T*> ConstructObjects(int32 count, FConstructObjectParameters&& params, Initializer&& init)
+	{
+		TArray<T*> result;
+		result.Reserve(count);
+		Detail::FBulkObjectConstructor constructor(params, T::StaticClass(), count);
+		for (int32 i = 0; i < count; ++i)
+		{
+			T* object = static_cast<T*>(constructor.Construct());
+			init(*object, i);
+			result.Add(object);
+		}
+		return result;
+	}
+
+	/**
+	 *	@brief
+	 *	Bulk variant of ConstructObject creating an object for each item of a range, like records of a config
+	 *	import. The initializer receives the new object and the item it's created for.
+	 *	
+	 *	Usage:
+	 *	@code
+	 *	using namespace Mcro::UObjects::Init;
+	 *	
+	 *	TArray<UMyObject*> myObjects = ConstructObjectsFrom({}, myRecords, [](UMyObject& _, FMyRecord const& record)
+	 *	{
+	 *		_.Foo = record.Foo;
+	 *	});
+	 *	@endcode
+	 *	
+	 *	@tparam  Initializer  Initializer function type
+	 *	@param        params  Parameters for every new object
+	 *	@param         items  The range of items an object is created for each. Ranges without a known size are
+	 *	                      iterated twice (once for counting them), these should be multi-pass ranges.
+	 *	@param          init  A setup function for each newly created UObject
+	 *	@return  The new objects in the order of the items
+	 */
+	template <
+		typename Range,
+		CFunctorObject Initializer,
+		typename TArg = TFunction_Arg<Initializer, 0>,
+		CUObject T = std::decay_t<TArg>
+	>
+	requires std::is_lvalue_reference_v<TArg>
+	TArray<T*> ConstructObjectsFrom(FConstructObjectParameters&& params, Range&& items, Initializer&& init)
+	{
+		int32 count = 0;
+		if constexpr (requires { items.Num(); })
+			count = static_cast<int32>(items.Num());
+		else if constexpr (requires { std::size(items); })
+			count = static_cast<int32>(std::size(items));
+		else
+			for ([[maybe_unused]] auto&& item : items) ++count;
+
+		TArray<T*> result;
+		result.Reserve(count);
+		Detail::FBulkObjectConstructor constructor(params, T::StaticClass(), count);
+		for (auto&& item : items)
+		{
+			T* object = static_cast<T*>(constructor.Construct());
+			init(*object, item);
+			result.Add(object);
+		}
+		return result;
+	}
 }
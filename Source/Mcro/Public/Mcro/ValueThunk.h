@@ -14,6 +14,9 @@
 #include "Mcro/Concepts.h"
 #include "Mcro/FunctionTraits.h"
 #include "Mcro/Templates.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
 
 namespace Mcro::ValueThunk
 {
@@ -30,6 +33,20 @@ namespace Mcro::ValueThunk
 		 *	This makes it basically a "lazy value"
 		 */
 		bool Memoize = false;
+
+		/**
+		 *	@brief
+		 *	Only used together with Memoize. Make the first evaluation thread safe, so only one thread invokes the
+		 *	function, and racing threads wait for its result. Once the value is cached, reading it is lock-free.
+		 */
+		bool ThreadSafe = false;
+
+		/**
+		 *	@brief
+		 *	Start evaluating the function on the task graph as soon as the thunk is constructed with it, see
+		 *	TValueThunk::Prefetch. This implies Memoize and ThreadSafe.
+		 */
+		bool Prefetch = false;
 	};
 
 	/**
@@ -51,9 +68,17 @@ namespace Mcro::ValueThunk
 		template <CCopyConstructible = T>
 		TValueThunk(T const& value) : Storage(value), bIsSet(true) {};
 
+		TValueThunk(TValueThunk const& other) requires CCopyConstructible<T>
+			: bIsSet((other.JoinPrefetch(), other.bIsSet))
+			, Options(other.Options)
+			, Function(other.Function)
+		{
+			if (other.bIsSet) Storage = other.Storage;
+		};
+
 		template <CConvertibleTo<T> Other, CCopyConstructible = T>
 		TValueThunk(TValueThunk<Other> const& other)
-			: bIsSet(other.bIsSet)
+			: bIsSet((other.JoinPrefetch(), other.bIsSet))
 			, Options(other.Options)
 			, Function(other.Function)
 		{
@@ -65,7 +90,7 @@ namespace Mcro::ValueThunk
 		
 		template <CMoveConstructible = T>
 		TValueThunk(TValueThunk&& other)
-			: bIsSet(other.bIsSet)
+			: bIsSet((other.JoinPrefetch(), other.bIsSet))
 			, Options(MoveTemp(other.Options))
 			, Function(MoveTemp(other.Function))
 		{
@@ -77,19 +102,94 @@ namespace Mcro::ValueThunk
 		TValueThunk(Functor&& value, FValueThunkOptions const& options = {})
 			: Options(options)
 			, Function(FWD(value))
-		{};
+		{
+			if (Options.Prefetch) Prefetch();
+		};
+
+		~TValueThunk() { JoinPrefetch(); }
+
+		// Prefetch tasks capture the thunk they were started from, so both sides are joined before assignment
+
+		TValueThunk& operator = (TValueThunk const& other) requires CCopyConstructible<T>
+		{
+			if (this == &other) return *this;
+			JoinPrefetch();
+			other.JoinPrefetch();
+			PrefetchTask = {};
+			bIsSet = other.bIsSet;
+			Options = other.Options;
+			Function = other.Function;
+			if (other.bIsSet) Storage = other.Storage;
+			return *this;
+		}
+
+		TValueThunk& operator = (TValueThunk&& other) requires CMoveConstructible<T>
+		{
+			if (this == &other) return *this;
+			JoinPrefetch();
+			other.JoinPrefetch();
+			PrefetchTask = {};
+			bIsSet = other.bIsSet;
+			Options = MoveTemp(other.Options);
+			Function = MoveTemp(other.Function);
+			if (other.bIsSet) Storage = MoveTemp(other.Storage);
+			return *this;
+		}
 
 	private:
 		void Evaluate() const
 		{
-			if (Function && (!Options.Memoize || !bIsSet))
+			if (Function && Options.Memoize && Options.ThreadSafe)
+				EvaluateOnce();
+			else if (Function && (!Options.Memoize || !bIsSet))
 			{
 				Storage = Function();
 				bIsSet = true;
 			}
 		}
+
+		void JoinPrefetch() const
+		{
+			// Waiting on a task which hasn't started yet executes it inline
+			if (PrefetchTask.IsValid()) PrefetchTask.Wait();
+		}
+
+		void EvaluateOnce() const
+		{
+			std::atomic_ref isSet(bIsSet);
+			if (isSet.load(std::memory_order_acquire)) [[likely]] return;
+
+			std::atomic_ref initializing(bInitializing);
+			while (initializing.exchange(true, std::memory_order_acquire))
+			{
+				initializing.wait(true, std::memory_order_relaxed);
+				if (isSet.load(std::memory_order_acquire)) return;
+			}
+			if (!isSet.load(std::memory_order_relaxed))
+			{
+				Storage = Function();
+				isSet.store(true, std::memory_order_release);
+			}
+			initializing.store(false, std::memory_order_release);
+			initializing.notify_all();
+		}
 		
 	public:
+		/**
+		 *	@brief
+		 *	Start evaluating the functor on the task graph, so the value may be ready by the time it's first needed.
+		 *	This makes the thunk memoize its value thread safely. Calling Get before the task has started evaluates it
+		 *	inline instead, calling it while the task is running waits for its result.
+		 */
+		void Prefetch()
+		{
+			if (!Function || IsSet() || PrefetchTask.IsValid()) return;
+
+			Options.Memoize = true;
+			Options.ThreadSafe = true;
+			PrefetchTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this] { EvaluateOnce(); });
+		}
+
 		/** @brief Evaluate the optional functor and get the cached result */
 		T& Get() { Evaluate(); return Storage; }
 		
@@ -112,12 +212,19 @@ namespace Mcro::ValueThunk
 		operator T const& () const { return Get(); }
 		operator T&&      () &&    { return Steal(); }
 
-		bool IsSet() const { return bIsSet; }
+		bool IsSet() const
+		{
+			return Options.ThreadSafe
+				? std::atomic_ref(bIsSet).load(std::memory_order_acquire)
+				: bIsSet;
+		}
 
 		template <CFunctorObject Functor>
 		requires CConvertibleTo<TFunction_ReturnDecay<Functor>, T>
 		TValueThunk& operator = (Functor&& value)
 		{
+			JoinPrefetch();
+			PrefetchTask = {};
 			bIsSet = false;
 			Function = value;
 			return *this;
@@ -127,6 +234,8 @@ namespace Mcro::ValueThunk
 		requires (!CIsTemplate<Other, TValueThunk>)
 		TValueThunk& operator = (Other&& value)
 		{
+			JoinPrefetch();
+			PrefetchTask = {};
 			bIsSet = true;
 			Function.Reset();
 			Storage = value;
@@ -136,7 +245,9 @@ namespace Mcro::ValueThunk
 	private:
 		mutable T Storage {};
 		mutable bool bIsSet = false;
+		mutable bool bInitializing = false;
 		FValueThunkOptions Options {};
 		FunctionStorage Function {};
+		UE::Tasks::FTask PrefetchTask {};
 	};
 }
@@ -0,0 +1,32 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+/**
+ *	@file
+ *	This is a forward declaration for yaml-cpp and Mcro/Yaml.h. Headers which only pass emitters or nodes by
+ *	reference should include this instead of the full yaml-cpp library.
+ */
+
+namespace YAML
+{
+	class Emitter;
+	class Node;
+}
+
+namespace Mcro::Yaml
+{
+	class FOutputStreamBuffer;
+	class FStreamingEmitter;
+	class FRetainedStreamBuffer;
+	class FPooledEmitter;
+}
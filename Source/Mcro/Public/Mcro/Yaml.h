@@ -13,6 +13,7 @@
 
 #include "CoreMinimal.h"
 #include "Mcro/Text.h"
+#include "Mcro/Yaml.Fwd.h"
 
 #include "Mcro/LibraryIncludes/Start.h"
 #include "PreMagicEnum.h"
@@ -20,10 +21,180 @@
 #include "yaml-cpp/yaml.h"
 #include "Mcro/LibraryIncludes/End.h"
 
+#include <ostream>
+#include <streambuf>
+
+class IFileHandle;
+
 namespace Mcro::Yaml
 {
 	using namespace Mcro::Text;
 
+	/**
+	 *	@brief
+	 *	A `std::streambuf` which collects output in a small fixed buffer and writes it into an FArchive or a file
+	 *	handle whenever the buffer is full. The target must outlive this object.
+	 */
+	class FOutputStreamBuffer : public std::streambuf
+	{
+	public:
+		static constexpr int32 ChunkSize = 4096;
+
+		MCRO_API FOutputStreamBuffer(FArchive& archive);
+		MCRO_API FOutputStreamBuffer(IFileHandle& file);
+		MCRO_API virtual ~FOutputStreamBuffer() override;
+
+		FOutputStreamBuffer(FOutputStreamBuffer const&) = delete;
+		FOutputStreamBuffer& operator = (FOutputStreamBuffer const&) = delete;
+
+		/** @brief Number of bytes written into the target so far, not counting what is still buffered */
+		int64 GetWrittenSize() const { return WrittenSize; }
+
+	protected:
+		MCRO_API virtual int_type overflow(int_type character) override;
+		MCRO_API virtual std::streamsize xsputn(const char_type* data, std::streamsize count) override;
+		MCRO_API virtual int sync() override;
+
+	private:
+		void WriteToTarget(const char* data, int64 count);
+		bool FlushBuffer();
+
+		FArchive* Archive = nullptr;
+		IFileHandle* File = nullptr;
+		int64 WrittenSize = 0;
+		char Buffer[ChunkSize];
+	};
+
+	namespace Detail
+	{
+		/** @brief Storage of FStreamingEmitter, it has to be constructed before the YAML::Emitter base */
+		struct FStreamingEmitterStorage
+		{
+			template <typename Target>
+			FStreamingEmitterStorage(Target& target) : StreamBuffer(target), Stream(&StreamBuffer) {}
+
+			FOutputStreamBuffer StreamBuffer;
+			std::ostream Stream;
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	A YAML::Emitter which writes the document into an FArchive or a file handle in 4KB chunks while it's being
+	 *	emitted, instead of buffering the entire document in memory. As it's a YAML::Emitter itself, it can be used with
+	 *	`FMap`, `FSeq`, `IError::SerializeYaml` and the stream operators the same way.
+	 *
+	 *	@code
+	 *	TUniquePtr<FArchive> file(IFileManager::Get().CreateFileWriter(*path));
+	 *	FStreamingEmitter emitter(*file);
+	 *	{
+	 *		FMap map(emitter);
+	 *		map << YAML::Key << "Errors" << YAML::Value;
+	 *		for (auto const& error : errors) emitter << error;
+	 *	}
+	 *	emitter.Flush();
+	 *	@endcode
+	 *
+	 *	@remarks
+	 *	`c_str()` and `size()` of this emitter don't represent the document, because it's not stored.
+	 */
+	class FStreamingEmitter : private Detail::FStreamingEmitterStorage, public YAML::Emitter
+	{
+	public:
+		MCRO_API FStreamingEmitter(FArchive& archive);
+		MCRO_API FStreamingEmitter(IFileHandle& file);
+
+		/** @brief Flushes the rest of the document into the target */
+		MCRO_API ~FStreamingEmitter();
+
+		/** @brief Write out the still buffered part of the document into the target */
+		MCRO_API void Flush();
+
+		/** @brief Number of bytes written into the target so far */
+		int64 GetWrittenSize() const { return StreamBuffer.GetWrittenSize(); }
+	};
+
+	/**
+	 *	@brief
+	 *	A `std::streambuf` appending into a growing memory buffer, which keeps its capacity when it's reset. Used by
+	 *	FPooledEmitter.
+	 */
+	class FRetainedStreamBuffer : public std::streambuf
+	{
+	public:
+		/** @brief Forget the contents but keep the allocated capacity, unless it's larger than `maxRetained` */
+		MCRO_API void Reset(int32 maxRetained);
+
+		std::string_view GetView() const { return { Buffer.GetData(), static_cast<size_t>(Buffer.Num()) }; }
+		int32 GetCapacity() const { return Buffer.Max(); }
+
+	protected:
+		MCRO_API virtual int_type overflow(int_type character) override;
+		MCRO_API virtual std::streamsize xsputn(const char_type* data, std::streamsize count) override;
+
+	private:
+		TArray<char> Buffer;
+	};
+
+	namespace Detail
+	{
+		/** @brief Retained storage of a pooled emitter, see FPooledEmitter */
+		struct FPooledEmitterEntry
+		{
+			FPooledEmitterEntry() : Stream(&StreamBuffer) {}
+
+			FRetainedStreamBuffer StreamBuffer;
+			std::ostream Stream;
+			TOptional<YAML::Emitter> Emitter;
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	A YAML::Emitter borrowed from a small pool of the calling thread for the lifetime of this object. The output
+	 *	buffer of pooled emitters keep their capacity between uses, so frequently serialized documents (like errors
+	 *	being logged) don't grow a fresh string every time. Nested uses on the same thread get separate emitters.
+	 *
+	 *	@code
+	 *	FPooledEmitter emitter;
+	 *	error->SerializeYamlDocument(*emitter);
+	 *	return emitter.ToString();
+	 *	@endcode
+	 *
+	 *	@remarks
+	 *	yaml-cpp can't reset the state of an emitter, so the YAML::Emitter object itself is reconstructed in place for
+	 *	each use, only its output buffer is retained. Like with FStreamingEmitter, use the accessors of this class
+	 *	instead of `c_str()` and `size()` of the emitter.
+	 */
+	class MCRO_API FPooledEmitter
+	{
+	public:
+		/** @brief Pooled buffers larger than this are released instead of being retained */
+		static constexpr int32 MaxRetainedCapacity = 64 * 1024;
+
+		/** @brief Number of idle emitters kept by each thread */
+		static constexpr int32 MaxPooledPerThread = 4;
+
+		FPooledEmitter();
+		~FPooledEmitter();
+
+		FPooledEmitter(FPooledEmitter const&) = delete;
+		FPooledEmitter& operator = (FPooledEmitter const&) = delete;
+
+		YAML::Emitter& Get() { return Entry->Emitter.GetValue(); }
+		YAML::Emitter& operator * () { return Get(); }
+		YAML::Emitter* operator -> () { return &Get(); }
+
+		/** @brief The document emitted so far, it's not null-terminated */
+		std::string_view GetView() const { return Entry->StreamBuffer.GetView(); }
+
+		std::string ToStringUtf8() const { return std::string(GetView()); }
+		FString ToString() const;
+
+	private:
+		TUniquePtr<Detail::FPooledEmitterEntry> Entry;
+	};
+
 	/**
 	 *	@brief  RAII friendly region annotation for YAML::Emitter streams
 	 *	@tparam Begin  The YAML region begin tag
@@ -0,0 +1,241 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Error.h"
+
+/**
+ *	@file
+ *	@brief
+ *	Fast, read-only YAML loading for large configuration files. The file is memory-mapped through the platform file
+ *	API and parsed into a flat node tree stored in a few contiguous arrays. Scalars which appear unchanged in the source
+ *	(plain and simple quoted scalars, so most of them) are string views pointing into the mapped file. Only scalars
+ *	needing unescaping or line folding are decoded into an arena owned by the document.
+ *
+ *	The parser supports the subset of YAML used by configuration files: block and flow maps and sequences, plain
+ *	(including multi-line), single and double quoted scalars, literal and folded block scalars, comments and `---` / `...` document markers.
+ *	Anchors, aliases, tags and complex keys are reported as errors. Use yaml-cpp for anything beyond that.
+ *
+ *	Streams of many documents can be parsed concurrently with `LoadAll`.
+ *
+ *	@code
+ *	auto document = FMappedYamlDocument::Load(FPaths::ProjectConfigDir() / TEXT_"Items.yaml");
+ *	if (document.HasError()) return document.GetErrorRef();
+ *
+ *	for (FMappedYamlNode item : document.GetValue()->GetRoot()["Items"])
+ *		Items.Add(item["Name"].AsName(), item["Weight"].AsDouble().Get(1.0));
+ *	@endcode
+ */
+
+namespace Mcro::Yaml
+{
+	using namespace Mcro::Error;
+
+	class FMappedYamlDocument;
+
+	enum class EMappedYamlNodeType : uint8
+	{
+		Null,
+		Scalar,
+		Sequence,
+		Map
+	};
+
+	namespace Detail
+	{
+		/** @brief Mapped or owned contents of a file, shared by the documents of a stream */
+		struct FMappedYamlSource;
+
+		struct FMappedYamlNodeData
+		{
+			EMappedYamlNodeType Type = EMappedYamlNodeType::Null;
+
+			/** @brief Plain (unquoted) scalars can be interpreted as null, booleans or numbers */
+			bool bPlain = false;
+
+			int32 Line = 0;
+			int32 FirstChild = 0;
+
+			/** @brief Number of elements for sequences, keys and values together for maps */
+			int32 ChildCount = 0;
+			FUtf8StringView Scalar;
+		};
+	}
+
+	/**
+	 *	@brief
+	 *	Lightweight handle of a node in an FMappedYamlDocument. It's only valid as long as the document is alive.
+	 *	Accessing missing children yields an invalid node (instead of asserting), which converts to nothing.
+	 */
+	class MCRO_API FMappedYamlNode
+	{
+	public:
+		FMappedYamlNode() = default;
+
+		bool IsValid() const { return Document != nullptr; }
+		explicit operator bool () const { return IsValid(); }
+
+		EMappedYamlNodeType GetType() const;
+
+		/** @brief Explicit nulls, empty values, and plain `~`, `null`, `Null` or `NULL` scalars */
+		bool IsNull() const;
+		bool IsScalar() const   { return GetType() == EMappedYamlNodeType::Scalar; }
+		bool IsSequence() const { return GetType() == EMappedYamlNodeType::Sequence; }
+		bool IsMap() const      { return GetType() == EMappedYamlNodeType::Map; }
+
+		/** @brief The 1-based line this node starts at in the source */
+		int32 GetLine() const;
+
+		/** @brief The UTF-8 content of a scalar, or an empty view if this is not a scalar */
+		FUtf8StringView GetScalar() const;
+
+		/** @brief Number of elements of a sequence or number of entries of a map */
+		int32 Num() const;
+
+		/** @brief Element of a sequence, or value of the map entry at the given index */
+		FMappedYamlNode operator [] (int32 index) const;
+
+		/** @brief Value of a map entry by its key, or an invalid node if there's no such key */
+		FMappedYamlNode operator [] (FUtf8StringView key) const;
+
+		/** @copydoc operator[](FUtf8StringView) const */
+		FMappedYamlNode operator [] (const ANSICHAR* key) const { return (*this)[FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(key))]; }
+
+		/** @brief Key of the map entry at the given index */
+		FMappedYamlNode GetKey(int32 index) const;
+
+		/** @brief Scalar converted to TCHAR, or an empty string for non-scalars */
+		FString AsString() const;
+
+		FName AsName() const;
+		FText AsText() const;
+
+		/** @brief Booleans in YAML 1.1 and 1.2 spelling (`true`, `False`, `yes`, `off`, etc...) */
+		TOptional<bool> AsBool() const;
+
+		/** @brief Decimal, `0x` hexadecimal or `0o` octal integers */
+		TOptional<int64> AsInt() const;
+
+		/** @brief Floating point numbers, including `.inf`, `-.inf` and `.nan` */
+		TOptional<double> AsDouble() const;
+
+		/**
+		 *	@brief
+		 *	Iterates the elements of a sequence, or the values of a map. The iterator keeps its own copy of the node
+		 *	handle, so iterating a temporary (like `for (auto item : document.GetRoot()["Items"])`) is safe.
+		 */
+		class FIterator
+		{
+		public:
+			FIterator(FMappedYamlNode parent, int32 index) : Parent(parent), Index(index) {}
+
+			FMappedYamlNode operator * () const { return Parent[Index]; }
+			FIterator& operator ++ () { ++Index; return *this; }
+			bool operator == (FIterator const& other) const { return Index == other.Index; }
+
+			/** @brief The key of the current map entry */
+			FMappedYamlNode Key() const { return Parent.GetKey(Index); }
+
+		private:
+			FMappedYamlNode Parent;
+			int32 Index;
+		};
+
+		FIterator begin() const { return FIterator(*this, 0); }
+		FIterator end() const { return FIterator(*this, Num()); }
+
+	private:
+		friend class FMappedYamlDocument;
+
+		FMappedYamlNode(const FMappedYamlDocument* document, int32 index) : Document(document), Index(index) {}
+
+		Detail::FMappedYamlNodeData const* GetData() const;
+		FMappedYamlNode GetChild(int32 childIndex) const;
+
+		const FMappedYamlDocument* Document = nullptr;
+		int32 Index = INDEX_NONE;
+	};
+
+	/**
+	 *	@brief
+	 *	An immutable YAML document parsed from a memory-mapped file (or an owned buffer). Nodes reference the contents
+	 *	of the document, so it's only handed out as a shared reference.
+	 */
+	class MCRO_API FMappedYamlDocument
+	{
+	public:
+		/**
+		 *	@brief
+		 *	Memory-map and parse a YAML file. When the platform can't map files, the file is read into memory
+		 *	instead. Only the first document of a stream is parsed, use `LoadAll` for the rest.
+		 */
+		static TMaybe<TSharedRef<FMappedYamlDocument>> Load(FString const& path);
+
+		/**
+		 *	@brief
+		 *	Same as `Load`, but keep a binary copy of the parsed tree in a cache directory, keyed by the XXH3 hash of
+		 *	the file contents. Later loads of unchanged contents only hash the file and read back the cached tree
+		 *	instead of parsing it again. Changed contents simply produce a different key, stale or corrupted entries
+		 *	are ignored. Only the 256 most recently used trees are kept in a cache directory.
+		 *
+		 *	@param cacheDirectory  Where cached trees are stored, `Saved/Mcro/YamlCache` by default
+		 */
+		static TMaybe<TSharedRef<FMappedYamlDocument>> LoadCached(FString const& path, FString const& cacheDirectory = {});
+
+		/** @brief Parse YAML from a UTF-8 buffer, the document takes ownership of it */
+		static TMaybe<TSharedRef<FMappedYamlDocument>> Parse(TArray<uint8>&& contents);
+
+		/**
+		 *	@brief
+		 *	Memory-map a stream of `---` separated documents and parse them concurrently on the task graph. The
+		 *	documents share the mapped file, and they're returned in the order of the stream. Line numbers of nodes
+		 *	and errors are counted from the start of the stream.
+		 */
+		static TMaybe<TArray<TSharedRef<FMappedYamlDocument>>> LoadAll(FString const& path);
+
+		/** @brief Parse a stream of `---` separated documents from a UTF-8 buffer concurrently */
+		static TMaybe<TArray<TSharedRef<FMappedYamlDocument>>> ParseAll(TArray<uint8>&& contents);
+
+		~FMappedYamlDocument();
+
+		FMappedYamlNode GetRoot() const { return FMappedYamlNode(this, Root); }
+
+		/** @brief Number of nodes in the document, including map keys */
+		int32 NumNodes() const { return Nodes.Num(); }
+
+		/** @brief Whether the node tree was read back from the binary cache instead of being parsed */
+		bool IsFromCache() const { return bFromCache; }
+
+	private:
+		friend class FMappedYamlNode;
+		friend class FMappedYamlParser;
+
+		FMappedYamlDocument() = default;
+		static TMaybe<TArray<TSharedRef<FMappedYamlDocument>>> ParseStream(
+			TSharedRef<Detail::FMappedYamlSource> const& source,
+			FString const& sourceName
+		);
+		FCanFail ParseContents(FString const& sourceName, int32 firstLine = 1);
+		bool ReadCache(TArray<uint8> const& cache, uint64 contentHash);
+		TArray<uint8> WriteCache(uint64 contentHash) const;
+
+		TSharedPtr<Detail::FMappedYamlSource> Source;
+		TArrayView<const uint8> Contents;
+
+		TArray<Detail::FMappedYamlNodeData> Nodes;
+		TArray<int32> Children;
+		TArray<TUniquePtr<UTF8CHAR[]>> DecodedChunks;
+		int32 Root = INDEX_NONE;
+		bool bFromCache = false;
+	};
+}
@@ -0,0 +1,177 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Concepts.h"
+#include "Mcro/Tuples.h"
+#include "Mcro/Yaml.h"
+
+/**
+ *	@file
+ *	Emit ranges into YAML::Emitter streams while iterating them, so views don't need to be rendered into an
+ *	intermediate container first.
+ *
+ *	@code
+ *	using namespace Mcro::Yaml;
+ *
+ *	// A complete sequence, or a complete map when the elements are pairs/2-tuples
+ *	out << (items | views::transform(&FItem::Name));
+ *	out << views::zip(names, weights);
+ *
+ *	// Flatten elements into an already open region, next to other entries
+ *	FMap map(out);
+ *	out << YAML::Key << "Version" << YAML::Value << 2;
+ *	out << Entries(views::zip(names, weights));
+ *	@endcode
+ */
+namespace Mcro::Yaml
+{
+	using namespace Mcro::Tuples;
+
+	/** @brief Ranges which are emitted element by element, strings and YAML nodes are emitted as they are */
+	template <typename T>
+	concept CYamlRange =
+		CRangeMember<T>
+		&& !CStringOrViewOrName<T>
+		&& !CStdStringOrView<T>
+		&& !CSameAsDecayed<T, YAML::Node>
+	;
+
+	/** @brief Tuples which are not ranges themselves (unlike std::array or subranges) */
+	template <typename T>
+	concept CYamlTuple = CTuple<T> && !CRangeMember<T>;
+
+	template <typename T>
+	using TYamlRangeElement = decltype(*std::declval<std::decay_t<T>&>().begin());
+
+	/** @brief Ranges of 2-tuples which are emitted as YAML maps */
+	template <typename T>
+	concept CYamlMapRange = CYamlRange<T> && CYamlTuple<TYamlRangeElement<T>> && GetSize<TYamlRangeElement<T>>() == 2;
+
+	/** @brief Emit a range as a YAML sequence, or as a YAML map if its elements are pairs */
+	template <CYamlRange Range>
+	YAML::Emitter& operator << (YAML::Emitter& out, Range&& range);
+
+	namespace Detail
+	{
+		template <typename Element>
+		void EmitYamlElement(YAML::Emitter& out, Element&& element);
+
+		/** @brief Tuples of other arities than 2 are emitted as flow sequences */
+		template <CYamlTuple Tuple, size_t... Indices>
+		void EmitYamlTuple(YAML::Emitter& out, Tuple&& tuple, std::index_sequence<Indices...>)
+		{
+			out << YAML::Flow << YAML::BeginSeq;
+			(EmitYamlElement(out, GetItem<Indices>(tuple)), ...);
+			out << YAML::EndSeq;
+		}
+
+		template <typename Element>
+		void EmitYamlElement(YAML::Emitter& out, Element&& element)
+		{
+			if constexpr (CYamlTuple<Element>)
+				EmitYamlTuple(out, FWD(element), TIndexSequenceForTuple<Element>());
+			else
+				out << FWD(element);
+		}
+
+		template <typename Range>
+		void EmitYamlElements(YAML::Emitter& out, Range& range)
+		{
+			for (auto&& element : range)
+				EmitYamlElement(out, FWD(element));
+		}
+
+		template <typename Range>
+		void EmitYamlEntries(YAML::Emitter& out, Range& range)
+		{
+			for (auto&& entry : range)
+			{
+				out << YAML::Key;
+				EmitYamlElement(out, GetItem<0>(entry));
+				out << YAML::Value;
+				EmitYamlElement(out, GetItem<1>(entry));
+			}
+		}
+
+		/** @brief Keeps ranges passed as rvalues alive (like temporary views) and refers to lvalue ranges */
+		template <typename Range>
+		using TYamlRangeStorage = std::conditional_t<std::is_lvalue_reference_v<Range>, Range, std::decay_t<Range>>;
+	}
+
+	/**
+	 *	@brief
+	 *	Emit the elements of a range one by one into the current region of a YAML stream (usually an FSeq), without
+	 *	opening a new sequence for them. Pass it directly to the stream, it is consumed by emitting it.
+	 */
+	template <CYamlRange Range>
+	struct TYamlElements
+	{
+		Detail::TYamlRangeStorage<Range> Storage;
+	};
+
+	/**
+	 *	@brief
+	 *	Emit a range of pairs one by one as key-value entries into the current map of a YAML stream (usually an FMap),
+	 *	without opening a new map for them. Pass it directly to the stream, it is consumed by emitting it.
+	 */
+	template <CYamlMapRange Range>
+	struct TYamlEntries
+	{
+		Detail::TYamlRangeStorage<Range> Storage;
+	};
+
+	/** @copydoc TYamlElements */
+	template <CYamlRange Range>
+	TYamlElements<Range> Elements(Range&& range)
+	{
+		return { FWD(range) };
+	}
+
+	/** @copydoc TYamlEntries */
+	template <CYamlMapRange Range>
+	TYamlEntries<Range> Entries(Range&& range)
+	{
+		return { FWD(range) };
+	}
+
+	template <typename Range>
+	YAML::Emitter& operator << (YAML::Emitter& out, TYamlElements<Range>&& elements)
+	{
+		Detail::EmitYamlElements(out, elements.Storage);
+		return out;
+	}
+
+	template <typename Range>
+	YAML::Emitter& operator << (YAML::Emitter& out, TYamlEntries<Range>&& entries)
+	{
+		Detail::EmitYamlEntries(out, entries.Storage);
+		return out;
+	}
+
+	template <CYamlRange Range>
+	YAML::Emitter& operator << (YAML::Emitter& out, Range&& range)
+	{
+		if constexpr (CYamlMapRange<Range>)
+		{
+			FMap map(out);
+			Detail::EmitYamlEntries(out, range);
+		}
+		else
+		{
+			FSeq seq(out);
+			Detail::EmitYamlElements(out, range);
+		}
+		return out;
+	}
+}
@@ -0,0 +1,98 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Yaml.h"
+
+class UStruct;
+class UObject;
+
+/**
+ *	@file
+ *	@brief
+ *	Generic YAML serialization of reflected structs and objects, so types with UPROPERTY members don't need a hand
+ *	written `operator <<`.
+ *
+ *	On the first use of a `UStruct` a flat serialization plan is built from its properties (offsets, keys and the kind
+ *	of reader / writer each property needs). Serializing or deserializing an instance then only runs through that
+ *	plan without iterating `FProperty` objects or going through their virtual functions. Properties without a
+ *	dedicated step in the plan (maps, sets, object references, etc...) are written as their Unreal text export.
+ *	Transient and deprecated properties are neither written nor read. Plans are rebuilt after hot reload or live
+ *	coding reinstanced any types.
+ *
+ *	@code
+ *	YAML::Emitter out;
+ *	out << AsYaml(myStruct);
+ *
+ *	FMyStruct parsed;
+ *	DeserializeStruct(YAML::Load(out.c_str()), parsed);
+ *	@endcode
+ */
+
+namespace Mcro::Yaml
+{
+	using namespace Mcro::Concepts;
+
+	/** @brief Write all properties of a struct instance of a given type as a YAML map */
+	MCRO_API void SerializeStruct(YAML::Emitter& emitter, const UStruct* type, const void* instance);
+
+	/**
+	 *	@brief
+	 *	Read the properties of a struct instance from a YAML map. Properties missing from the map are left untouched.
+	 *	@return False if any of the properties present in the map couldn't be read
+	 */
+	MCRO_API bool DeserializeStruct(YAML::Node const& node, const UStruct* type, void* instance);
+
+	/** @brief Write all properties of an object as a YAML map, according to its class */
+	MCRO_API void SerializeObject(YAML::Emitter& emitter, const UObject* object);
+
+	/** @copydoc DeserializeStruct(YAML::Node const&, const UStruct*, void*) */
+	MCRO_API bool DeserializeObject(YAML::Node const& node, UObject* object);
+
+	/** @brief A USTRUCT type */
+	template <typename T>
+	concept CReflectedStruct = requires { { T::StaticStruct() } -> CConvertibleTo<const UStruct*>; };
+
+	/** @brief Write all properties of a USTRUCT instance as a YAML map */
+	template <CReflectedStruct T>
+	void SerializeStruct(YAML::Emitter& emitter, T const& value)
+	{
+		SerializeStruct(emitter, T::StaticStruct(), &value);
+	}
+
+	/** @copydoc DeserializeStruct(YAML::Node const&, const UStruct*, void*) */
+	template <CReflectedStruct T>
+	bool DeserializeStruct(YAML::Node const& node, T& value)
+	{
+		return DeserializeStruct(node, T::StaticStruct(), &value);
+	}
+
+	/** @brief Wraps a reference to a USTRUCT instance, so it can be appended to YAML::Emitter streams */
+	template <CReflectedStruct T>
+	struct TReflectedYaml
+	{
+		T const& Value;
+	};
+
+	/** @brief Append a USTRUCT instance to a YAML::Emitter stream via its reflection data */
+	template <CReflectedStruct T>
+	TReflectedYaml<T> AsYaml(T const& value) { return { value }; }
+
+	template <CReflectedStruct T>
+	YAML::Emitter& operator << (YAML::Emitter& out, TReflectedYaml<T> const& value)
+	{
+		SerializeStruct(out, value.Value);
+		return out;
+	}
+}
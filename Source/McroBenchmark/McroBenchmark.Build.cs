@@ -0,0 +1,43 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+using UnrealBuildTool;
+using McroBuild;
+
+/// <summary>
+/// A micro-benchmark harness with built-in suites for MCRO, runnable from automation tests and a commandlet
+/// </summary>
+public class McroBenchmark : ModuleRules
+{
+	public McroBenchmark(ReadOnlyTargetRules Target) : base(Target)
+	{
+		// C++23
+		bUseUnity = false;
+		CppStandard = CppStandardVersion.Latest;
+
+		PublicDependencyModuleNames.AddRange(new[]
+		{
+			"Core",
+			"Mcro",
+		});
+
+		PrivateDependencyModuleNames.AddRange(new[]
+		{
+			"CoreUObject",
+			"Engine",
+			"Json",
+			"Projects",
+			"Slate",
+			"SlateCore",
+			"McroISPC",
+		});
+	}
+}
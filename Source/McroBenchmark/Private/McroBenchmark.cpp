@@ -0,0 +1,45 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "Modules/ModuleManager.h"
+#include "McroBenchmark/BenchmarkSuite.h"
+#include "McroBenchmark/Suites/Suites.h"
+#include "Mcro/TextMacros.h"
+
+class FMcroBenchmarkModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		using namespace Mcro::Benchmark;
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Threading", &Suites::RunThreading));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Observable", &Suites::RunObservable));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"EventDelegate", &Suites::RunEventDelegate));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Composition", &Suites::RunComposition));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Range", &Suites::RunRange));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"TypeHashMap", &Suites::RunTypeHashMap));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Text", &Suites::RunText));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Error", &Suites::RunError));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"ISPC", &Suites::RunIspc));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Contention", &Suites::RunContention));
+		BuiltinSuites.Add(MakeUnique<FBenchmarkSuite>(TEXT_"Slate", &Suites::RunSlate));
+	}
+
+	virtual void ShutdownModule() override
+	{
+		BuiltinSuites.Reset();
+	}
+
+private:
+	TArray<TUniquePtr<Mcro::Benchmark::FBenchmarkSuite>> BuiltinSuites;
+};
+
+IMPLEMENT_MODULE(FMcroBenchmarkModule, McroBenchmark);
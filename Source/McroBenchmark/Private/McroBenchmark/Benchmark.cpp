@@ -0,0 +1,429 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Benchmark.h"
+#include "McroBenchmark/HardwareCounters.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Mcro/TextMacros.h"
+
+#include <atomic>
+
+DECLARE_LOG_CATEGORY_CLASS(LogMcroBenchmark, Log, All);
+
+namespace Mcro::Benchmark
+{
+	using namespace Mcro::Benchmark::Detail;
+
+	namespace
+	{
+		/** @brief Linearly interpolated percentile of sorted samples */
+		double Percentile(TArrayView<const double> sorted, double fraction)
+		{
+			const double position = fraction * (sorted.Num() - 1);
+			const int32 lower = FMath::FloorToInt32(position);
+			const int32 upper = FMath::Min(lower + 1, sorted.Num() - 1);
+			return FMath::Lerp(sorted[lower], sorted[upper], position - lower);
+		}
+
+		double SecondsSince(uint64 startCycles)
+		{
+			return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - startCycles);
+		}
+
+		/**
+		 *	@brief
+		 *	Log-linear histogram of timestamp counter deltas, exact below 16 ticks and within 1/16 of the value above
+		 *	that. Recording an operation doesn't allocate and it has constant memory regardless of the duration.
+		 */
+		class FLatencyHistogram
+		{
+		public:
+			static constexpr int32 SubBucketBits = 4;
+			static constexpr int32 SubBuckets = 1 << SubBucketBits;
+			static constexpr int32 Buckets = (64 - SubBucketBits + 1) * SubBuckets;
+
+			FORCEINLINE void Add(uint64 ticks)
+			{
+				++Counts[GetBucket(ticks)];
+				++Total;
+			}
+
+			void Append(FLatencyHistogram const& other)
+			{
+				for (int32 i = 0; i < Buckets; ++i) Counts[i] += other.Counts[i];
+				Total += other.Total;
+			}
+
+			uint64 Num() const { return Total; }
+
+			/** @returns The middle of the bucket containing the given fraction of the recorded values */
+			double GetPercentile(double fraction) const
+			{
+				const uint64 target = FMath::Max<uint64>(1, FMath::CeilToInt64(fraction * Total));
+				uint64 cumulative = 0;
+				for (int32 i = 0; i < Buckets; ++i)
+				{
+					cumulative += Counts[i];
+					if (cumulative >= target)
+					{
+						if (i < SubBuckets) return i;
+						const int32 shift = i / SubBuckets - 1;
+						return static_cast<double>(static_cast<uint64>(SubBuckets + i % SubBuckets) << shift) + ((1ull << shift) - 1) * 0.5;
+					}
+				}
+				return 0;
+			}
+
+		private:
+			static FORCEINLINE int32 GetBucket(uint64 ticks)
+			{
+				if (ticks < SubBuckets) return static_cast<int32>(ticks);
+				const int32 shift = static_cast<int32>(FPlatformMath::FloorLog2_64(ticks)) - SubBucketBits;
+				return (shift + 1) * SubBuckets + static_cast<int32>((ticks >> shift) & (SubBuckets - 1));
+			}
+
+			uint64 Counts[Buckets] {};
+			uint64 Total = 0;
+		};
+
+		enum class EContentionPhase : int32
+		{
+			Starting,
+			Warmup,
+			Measure,
+			Stop
+		};
+
+		/**
+		 *	@brief
+		 *	Dedicated thread of a contention benchmark. Real threads are used instead of tasks, so the requested amount
+		 *	of threads are guaranteed to run the operation at the same time.
+		 */
+		class FContentionWorker : public FRunnable
+		{
+		public:
+			FContentionWorker(
+				int32 index,
+				std::atomic<EContentionPhase> const& phase,
+				std::atomic<int32>& warmedUp,
+				TFunctionRef<void(int32, int64)> operation
+			)
+				: Index(index)
+				, Phase(phase)
+				, WarmedUp(warmedUp)
+				, Operation(operation)
+			{}
+
+			virtual uint32 Run() override
+			{
+				while (Phase.load(std::memory_order_acquire) == EContentionPhase::Starting)
+					FPlatformProcess::YieldThread();
+
+				// The warmup phase only ends after every thread has executed the operation at least once, so a thread
+				// which is scheduled late still takes part in the measurement
+				int64 iteration = 0;
+				Operation(Index, iteration++);
+				WarmedUp.fetch_add(1, std::memory_order_release);
+				while (Phase.load(std::memory_order_relaxed) == EContentionPhase::Warmup)
+					Operation(Index, iteration++);
+
+				// One timestamp per operation, the delta includes the loop and reading the phase, but it doesn't leave
+				// gaps between operations
+				const uint64 start = ReadTimestampCounter();
+				uint64 previous = start;
+				while (Phase.load(std::memory_order_relaxed) == EContentionPhase::Measure)
+				{
+					Operation(Index, iteration++);
+					const uint64 now = ReadTimestampCounter();
+					Latencies.Add(now - previous);
+					previous = now;
+				}
+				Ticks = previous - start;
+				return 0;
+			}
+
+			FLatencyHistogram Latencies;
+			uint64 Ticks = 0;
+
+		private:
+			int32 Index;
+			std::atomic<EContentionPhase> const& Phase;
+			std::atomic<int32>& WarmedUp;
+			TFunctionRef<void(int32, int64)> Operation;
+		};
+	}
+
+	FBenchmarkStatistics ComputeStatistics(TArrayView<double> samples)
+	{
+		if (samples.IsEmpty()) return {};
+		samples.Sort();
+
+		FBenchmarkStatistics result {
+			.Median = Percentile(samples, 0.5),
+			.Min = samples[0],
+			.Max = samples.Last(),
+			.Samples = samples.Num()
+		};
+
+		TArray<double, TInlineAllocator<64>> deviations;
+		deviations.Reserve(samples.Num());
+		for (double sample : samples)
+			deviations.Add(FMath::Abs(sample - result.Median));
+		deviations.Sort();
+		result.MedianAbsoluteDeviation = Percentile(deviations, 0.5);
+
+		const double lowerQuartile = Percentile(samples, 0.25);
+		const double upperQuartile = Percentile(samples, 0.75);
+		const double fence = (upperQuartile - lowerQuartile) * 1.5;
+		const double lowerFence = lowerQuartile - fence;
+		const double upperFence = upperQuartile + fence;
+
+		double sum = 0;
+		int32 inliers = 0;
+		for (double sample : samples)
+		{
+			if (sample < lowerFence || sample > upperFence) continue;
+			sum += sample;
+			++inliers;
+		}
+		result.Outliers = samples.Num() - inliers;
+		result.Mean = sum / inliers;
+
+		double squares = 0;
+		for (double sample : samples)
+		{
+			if (sample < lowerFence || sample > upperFence) continue;
+			squares += FMath::Square(sample - result.Mean);
+		}
+		result.StandardDeviation = inliers > 1 ? FMath::Sqrt(squares / (inliers - 1)) : 0;
+		return result;
+	}
+
+	void Detail::UseCharPointer(char const volatile*) {}
+
+	FBenchmarkContext::FBenchmarkContext(FString const& suite, FBenchmarkSettings const& settings)
+		: Suite(suite)
+		, Settings(settings)
+	{}
+
+	FBenchmarkResult FBenchmarkContext::MeasureContended(
+		FStringView benchmark,
+		FStringView parameter,
+		int32 threads,
+		TFunctionRef<void(int32 thread, int64 iteration)> operation
+	) {
+		threads = FMath::Max(threads, 1);
+		std::atomic<EContentionPhase> phase { EContentionPhase::Starting };
+		std::atomic<int32> warmedUp { 0 };
+
+		TArray<TUniquePtr<FContentionWorker>> workers;
+		TArray<FRunnableThread*> runnableThreads;
+		for (int32 i = 0; i < threads; ++i)
+		{
+			FContentionWorker* worker = workers.Add_GetRef(MakeUnique<FContentionWorker>(i, phase, warmedUp, operation)).Get();
+			runnableThreads.Add(FRunnableThread::Create(
+				worker, *FString::Printf(TEXT_"McroBenchmark Contention %d", i), 0, TPri_Normal
+			));
+		}
+
+		phase.store(EContentionPhase::Warmup, std::memory_order_release);
+		while (warmedUp.load(std::memory_order_acquire) < threads)
+			FPlatformProcess::Sleep(0.0001f);
+		FPlatformProcess::Sleep(static_cast<float>(FMath::Max(Settings.WarmupSeconds, 0.0)));
+
+		const bool countAllocations = Settings.bCountAllocations && GetTotalAllocationCalls() > 0;
+		const uint64 allocationsBefore = countAllocations ? GetTotalAllocationCalls() : 0;
+		const uint64 ticksStart = ReadTimestampCounter();
+		const uint64 start = FPlatformTime::Cycles64();
+		phase.store(EContentionPhase::Measure, std::memory_order_release);
+
+		FPlatformProcess::Sleep(static_cast<float>(FMath::Max(Settings.ContentionSeconds, 0.001)));
+
+		phase.store(EContentionPhase::Stop, std::memory_order_release);
+		const double seconds = SecondsSince(start);
+		const uint64 ticksEnd = ReadTimestampCounter();
+		const uint64 allocations = countAllocations ? GetTotalAllocationCalls() - allocationsBefore : 0;
+
+		for (FRunnableThread* thread : runnableThreads)
+		{
+			thread->WaitForCompletion();
+			delete thread;
+		}
+
+		// The timestamp counter has no reliable API for its frequency, calibrate it with the measured period instead
+		const double nanosecondsPerTick = ticksEnd > ticksStart ? seconds * 1'000'000'000.0 / (ticksEnd - ticksStart) : 0;
+
+		FLatencyHistogram latencies;
+		TArray<double, TInlineAllocator<64>> perThread;
+		double operationsSum = 0;
+		double operationsSquareSum = 0;
+		for (TUniquePtr<FContentionWorker> const& worker : workers)
+		{
+			latencies.Append(worker->Latencies);
+			const double workerOperations = worker->Latencies.Num();
+			operationsSum += workerOperations;
+			operationsSquareSum += FMath::Square(workerOperations);
+			if (worker->Latencies.Num() > 0)
+				perThread.Add(worker->Ticks * nanosecondsPerTick / workerOperations);
+		}
+
+		const bool measured = latencies.Num() > 0 && nanosecondsPerTick > 0;
+		FBenchmarkResult& result = Results.Add_GetRef({
+			.Suite = Suite,
+			.Benchmark = FString(benchmark),
+			.Parameter = FString(parameter),
+			.OperationsPerBatch = static_cast<int64>(latencies.Num()),
+			.BatchesPerSample = 1,
+			.Nanoseconds = ComputeStatistics(perThread),
+			.AllocationsPerOp = countAllocations && latencies.Num() > 0 ? allocations / operationsSum : -1,
+			.Threads = threads,
+			.Throughput = seconds > 0 ? operationsSum / seconds : 0,
+			.LatencyP50 = measured ? latencies.GetPercentile(0.5) * nanosecondsPerTick : -1,
+			.LatencyP99 = measured ? latencies.GetPercentile(0.99) * nanosecondsPerTick : -1,
+			.LatencyP999 = measured ? latencies.GetPercentile(0.999) * nanosecondsPerTick : -1,
+			.Fairness = operationsSquareSum > 0 ? FMath::Square(operationsSum) / (threads * operationsSquareSum) : -1
+		});
+
+		UE_LOG(LogMcroBenchmark, Log,
+			TEXT_"%s %s [%s] on %d threads: %.0f op/s, p50 %.1f ns, p99 %.1f ns, p999 %.1f ns, fairness %.3f",
+			*result.Suite, *result.Benchmark, *result.Parameter, result.Threads,
+			result.Throughput, result.LatencyP50, result.LatencyP99, result.LatencyP999, result.Fairness
+		);
+		return result;
+	}
+
+	FBenchmarkResult FBenchmarkContext::MeasureWithSetup(
+		FStringView benchmark,
+		FStringView parameter,
+		int64 operations,
+		int32 samples,
+		TFunctionRef<void()> setup,
+		TFunctionRef<void()> batch
+	) {
+		operations = FMath::Max<int64>(operations, 1);
+		samples = FMath::Max(samples, 1);
+		const bool countAllocations = Settings.bCountAllocations && GetTotalAllocationCalls() > 0;
+
+		TArray<double, TInlineAllocator<64>> nanoseconds;
+		nanoseconds.Reserve(samples);
+		uint64 allocations = 0;
+		for (int32 i = 0; i < samples; ++i)
+		{
+			setup();
+			const uint64 allocationsBefore = countAllocations ? GetTotalAllocationCalls() : 0;
+			const uint64 start = FPlatformTime::Cycles64();
+
+			batch();
+
+			const uint64 end = FPlatformTime::Cycles64();
+			if (countAllocations) allocations += GetTotalAllocationCalls() - allocationsBefore;
+			nanoseconds.Add(FPlatformTime::ToSeconds64(end - start) * 1'000'000'000.0 / operations);
+		}
+
+		const double totalOperations = static_cast<double>(samples) * operations;
+		FBenchmarkResult& result = Results.Add_GetRef({
+			.Suite = Suite,
+			.Benchmark = FString(benchmark),
+			.Parameter = FString(parameter),
+			.OperationsPerBatch = operations,
+			.BatchesPerSample = 1,
+			.Nanoseconds = ComputeStatistics(nanoseconds),
+			.AllocationsPerOp = countAllocations ? allocations / totalOperations : -1
+		});
+		result.Throughput = result.Nanoseconds.Median > 0 ? 1'000'000'000.0 / result.Nanoseconds.Median : 0;
+
+		UE_LOG(LogMcroBenchmark, Log,
+			TEXT_"%s %s [%s]: %.2f ns/op (MAD %.1f%%, %d samples), %.3f allocations/op",
+			*result.Suite, *result.Benchmark, *result.Parameter,
+			result.Nanoseconds.Median, result.Nanoseconds.GetRelativeDeviation() * 100.0, result.Nanoseconds.Samples,
+			result.AllocationsPerOp
+		);
+		return result;
+	}
+
+	FBenchmarkResult FBenchmarkContext::Measure(FStringView benchmark, FStringView parameter, int64 operations, TFunctionRef<void()> batch)
+	{
+		operations = FMath::Max<int64>(operations, 1);
+
+		// The fastest warmup batch estimates how many batches a sample needs to last at least MinSampleSeconds, the
+		// first batches are usually slower because of cold caches
+		int32 warmupBatches = 0;
+		double fastestBatch = MAX_dbl;
+		const uint64 warmupStart = FPlatformTime::Cycles64();
+		do
+		{
+			const uint64 start = FPlatformTime::Cycles64();
+			batch();
+			fastestBatch = FMath::Min(fastestBatch, SecondsSince(start));
+			++warmupBatches;
+		}
+		while (warmupBatches < Settings.MinWarmupIterations || SecondsSince(warmupStart) < Settings.WarmupSeconds);
+
+		const int64 batchesPerSample = fastestBatch > 0
+			? FMath::Max<int64>(1, FMath::CeilToInt64(Settings.MinSampleSeconds / fastestBatch))
+			: 1;
+
+		TOptional<FThreadHardwareCounters> counters;
+		if (Settings.bCountHardware) counters.Emplace();
+		const bool countAllocations = Settings.bCountAllocations && GetTotalAllocationCalls() > 0;
+
+		const int32 maxSamples = FMath::Max(Settings.Samples, 1);
+		TArray<double, TInlineAllocator<64>> samples;
+		samples.Reserve(maxSamples);
+		uint64 allocations = 0;
+		FHardwareCounterReading hardware;
+
+		const uint64 measureStart = FPlatformTime::Cycles64();
+		while (samples.Num() < maxSamples)
+		{
+			const uint64 allocationsBefore = countAllocations ? GetTotalAllocationCalls() : 0;
+			const FHardwareCounterReading before = counters ? counters->Read() : FHardwareCounterReading();
+			const uint64 start = FPlatformTime::Cycles64();
+
+			for (int64 i = 0; i < batchesPerSample; ++i) batch();
+
+			const uint64 end = FPlatformTime::Cycles64();
+			const FHardwareCounterReading after = counters ? counters->Read() : FHardwareCounterReading();
+			if (countAllocations) allocations += GetTotalAllocationCalls() - allocationsBefore;
+			hardware.Instructions += after.Instructions - before.Instructions;
+			hardware.Cycles += after.Cycles - before.Cycles;
+
+			samples.Add(FPlatformTime::ToSeconds64(end - start) * 1'000'000'000.0 / (batchesPerSample * operations));
+			if (samples.Num() >= 3 && SecondsSince(measureStart) > Settings.MaxSecondsPerBenchmark)
+				break;
+		}
+
+		const double totalOperations = static_cast<double>(samples.Num()) * batchesPerSample * operations;
+		FBenchmarkResult& result = Results.Add_GetRef({
+			.Suite = Suite,
+			.Benchmark = FString(benchmark),
+			.Parameter = FString(parameter),
+			.OperationsPerBatch = operations,
+			.BatchesPerSample = batchesPerSample,
+			.Nanoseconds = ComputeStatistics(samples),
+			.AllocationsPerOp = countAllocations ? allocations / totalOperations : -1,
+			.InstructionsPerOp = counters && counters->HasInstructions() ? hardware.Instructions / totalOperations : -1,
+			.CyclesPerOp = counters && counters->HasCycles() ? hardware.Cycles / totalOperations : -1
+		});
+		result.Throughput = result.Nanoseconds.Median > 0 ? 1'000'000'000.0 / result.Nanoseconds.Median : 0;
+
+		UE_LOG(LogMcroBenchmark, Log,
+			TEXT_"%s %s [%s]: %.2f ns/op (MAD %.1f%%, %d outliers), %.3f allocations/op, %.1f instructions/op",
+			*result.Suite, *result.Benchmark, *result.Parameter,
+			result.Nanoseconds.Median, result.Nanoseconds.GetRelativeDeviation() * 100.0, result.Nanoseconds.Outliers,
+			result.AllocationsPerOp, result.InstructionsPerOp
+		);
+		return result;
+	}
+}
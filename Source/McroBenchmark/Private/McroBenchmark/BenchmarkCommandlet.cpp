@@ -0,0 +1,82 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/BenchmarkCommandlet.h"
+#include "Misc/Paths.h"
+#include "McroBenchmark/BenchmarkSuite.h"
+#include "Mcro/TextMacros.h"
+
+DECLARE_LOG_CATEGORY_CLASS(LogMcroBenchmarkCommandlet, Log, All);
+
+UMcroBenchmarkCommandlet::UMcroBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UMcroBenchmarkCommandlet::Main(FString const& params)
+{
+	using namespace Mcro::Benchmark;
+
+	if (FParse::Param(*params, TEXT_"List"))
+	{
+		for (IBenchmarkSuite* suite : FindBenchmarkSuites())
+			UE_LOG(LogMcroBenchmarkCommandlet, Display, TEXT_"%s", *suite->GetName());
+		return 0;
+	}
+
+	FString suitesParam;
+	TArray<FString> suites;
+	if (FParse::Value(*params, TEXT_"Suites=", suitesParam, false))
+		suitesParam.ParseIntoArray(suites, TEXT_",");
+
+	if (!suites.IsEmpty() && FindBenchmarkSuites(suites).Num() != suites.Num())
+	{
+		UE_LOG(LogMcroBenchmarkCommandlet, Error,
+			TEXT_"Some of the requested suites (%s) are not available, see -List for the available ones",
+			*suitesParam
+		);
+		return 1;
+	}
+
+	FBenchmarkSettings settings;
+	FParse::Value(*params, TEXT_"Samples=", settings.Samples);
+	FParse::Value(*params, TEXT_"WarmupSeconds=", settings.WarmupSeconds);
+	FParse::Value(*params, TEXT_"MinSampleSeconds=", settings.MinSampleSeconds);
+	FParse::Value(*params, TEXT_"MaxSecondsPerBenchmark=", settings.MaxSecondsPerBenchmark);
+	FParse::Value(*params, TEXT_"ContentionSeconds=", settings.ContentionSeconds);
+
+	FString label;
+	FParse::Value(*params, TEXT_"Label=", label);
+
+	FString output = FPaths::ProjectSavedDir() / TEXT_"McroBenchmark" / TEXT_"Benchmarks.csv";
+	FParse::Value(*params, TEXT_"Output=", output);
+
+	FBenchmarkReport report = RunBenchmarkSuites(suites, settings, label);
+	for (FBenchmarkResult const& result : report.Results)
+	{
+		UE_LOG(LogMcroBenchmarkCommandlet, Display,
+			TEXT_"%s %s [%s]: %.2f ns/op, %.3f allocations/op",
+			*result.Suite, *result.Benchmark, *result.Parameter, result.Nanoseconds.Median, result.AllocationsPerOp
+		);
+	}
+
+	auto saved = report.Save(output);
+	if (saved.HasError())
+	{
+		UE_LOG(LogMcroBenchmarkCommandlet, Error, TEXT_"%s", *saved.GetError()->ToString());
+		return 1;
+	}
+	UE_LOG(LogMcroBenchmarkCommandlet, Display, TEXT_"%d benchmark results were saved to %s", report.Results.Num(), *output);
+	return 0;
+}
@@ -0,0 +1,42 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "BenchmarkCommandlet.generated.h"
+
+/**
+ *	@brief
+ *	Run MCRO benchmark suites and save their report. For example:
+ *	@code
+ *	UnrealEditor-Cmd.exe MyProject.uproject -run=McroBenchmark -Suites=Threading,Text -Label=v0.5.0 -Output=Bench.csv
+ *	@endcode
+ *	Arguments:
+ *	- `-Suites=` comma separated names of suites to run, all suites are run when omitted
+ *	- `-Output=` path of the report, `.csv` files are appended, anything else is written as JSON. By default results
+ *	  are appended to `Saved/McroBenchmark/Benchmarks.csv`
+ *	- `-Label=` identifier of this run stored in the report, like a commit hash
+ *	- `-Samples=`, `-WarmupSeconds=`, `-MinSampleSeconds=`, `-MaxSecondsPerBenchmark=`, `-ContentionSeconds=`
+ *	  override FBenchmarkSettings
+ *	- `-List` only list the available suites
+ */
+UCLASS()
+class UMcroBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMcroBenchmarkCommandlet();
+
+	virtual int32 Main(FString const& params) override;
+};
@@ -0,0 +1,184 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/BenchmarkReport.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "McroISPC/IspcTarget.h"
+#include "Mcro/TextMacros.h"
+
+namespace Mcro::Benchmark
+{
+	namespace
+	{
+		using FJsonWriter = TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>;
+
+		void WriteStatistics(FJsonWriter& writer, const TCHAR* name, FBenchmarkStatistics const& statistics)
+		{
+			writer.WriteObjectStart(name);
+			writer.WriteValue(TEXT_"Median", statistics.Median);
+			writer.WriteValue(TEXT_"MedianAbsoluteDeviation", statistics.MedianAbsoluteDeviation);
+			writer.WriteValue(TEXT_"Mean", statistics.Mean);
+			writer.WriteValue(TEXT_"StandardDeviation", statistics.StandardDeviation);
+			writer.WriteValue(TEXT_"Min", statistics.Min);
+			writer.WriteValue(TEXT_"Max", statistics.Max);
+			writer.WriteValue(TEXT_"Samples", statistics.Samples);
+			writer.WriteValue(TEXT_"Outliers", statistics.Outliers);
+			writer.WriteObjectEnd();
+		}
+
+		FString QuoteCsv(FString const& value)
+		{
+			return TEXT_"\"" + value.Replace(TEXT_"\"", TEXT_"\"\"") + TEXT_"\"";
+		}
+	}
+
+	EBenchmarkReportFormat GetBenchmarkReportFormat(FString const& path)
+	{
+		return FPaths::GetExtension(path).Equals(TEXT_"csv", ESearchCase::IgnoreCase)
+			? EBenchmarkReportFormat::Csv
+			: EBenchmarkReportFormat::Json;
+	}
+
+	FBenchmarkReport FBenchmarkReport::Make(FString const& label, FBenchmarkSettings const& settings)
+	{
+		TSharedPtr<IPlugin> plugin = IPluginManager::Get().FindPlugin(TEXT_"Mcro");
+		return {
+			.Label = label,
+			.PluginVersion = plugin ? plugin->GetDescriptor().VersionName : FString(),
+			.EngineVersion = FEngineVersion::Current().ToString(),
+			.Platform = FString(FPlatformProperties::IniPlatformName()),
+			.Configuration = LexToString(FApp::GetBuildConfiguration()),
+			.Cpu = FPlatformMisc::GetCPUBrand().TrimStartAndEnd(),
+			.Cores = FPlatformMisc::NumberOfCoresIncludingHyperthreads(),
+			.IspcTarget = ISPC::GetIspcTargetName(ISPC::GetIspcTarget()),
+			.Time = FDateTime::UtcNow(),
+			.Settings = settings
+		};
+	}
+
+	FString FBenchmarkReport::ToJson() const
+	{
+		FString output;
+		TSharedRef<FJsonWriter> writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&output);
+		writer->WriteObjectStart();
+		writer->WriteValue(TEXT_"Label", Label);
+		writer->WriteValue(TEXT_"PluginVersion", PluginVersion);
+		writer->WriteValue(TEXT_"EngineVersion", EngineVersion);
+		writer->WriteValue(TEXT_"Platform", Platform);
+		writer->WriteValue(TEXT_"Configuration", Configuration);
+		writer->WriteValue(TEXT_"Cpu", Cpu);
+		writer->WriteValue(TEXT_"Cores", Cores);
+		writer->WriteValue(TEXT_"IspcTarget", IspcTarget);
+		writer->WriteValue(TEXT_"Time", Time.ToIso8601());
+
+		writer->WriteObjectStart(TEXT_"Settings");
+		writer->WriteValue(TEXT_"WarmupSeconds", Settings.WarmupSeconds);
+		writer->WriteValue(TEXT_"MinWarmupIterations", Settings.MinWarmupIterations);
+		writer->WriteValue(TEXT_"Samples", Settings.Samples);
+		writer->WriteValue(TEXT_"MinSampleSeconds", Settings.MinSampleSeconds);
+		writer->WriteValue(TEXT_"MaxSecondsPerBenchmark", Settings.MaxSecondsPerBenchmark);
+		writer->WriteValue(TEXT_"ContentionSeconds", Settings.ContentionSeconds);
+		writer->WriteObjectEnd();
+
+		writer->WriteArrayStart(TEXT_"Results");
+		for (FBenchmarkResult const& result : Results)
+		{
+			writer->WriteObjectStart();
+			writer->WriteValue(TEXT_"Suite", result.Suite);
+			writer->WriteValue(TEXT_"Benchmark", result.Benchmark);
+			writer->WriteValue(TEXT_"Parameter", result.Parameter);
+			writer->WriteValue(TEXT_"OperationsPerBatch", result.OperationsPerBatch);
+			writer->WriteValue(TEXT_"BatchesPerSample", result.BatchesPerSample);
+			WriteStatistics(*writer, TEXT_"Nanoseconds", result.Nanoseconds);
+			writer->WriteValue(TEXT_"AllocationsPerOp", result.AllocationsPerOp);
+			writer->WriteValue(TEXT_"InstructionsPerOp", result.InstructionsPerOp);
+			writer->WriteValue(TEXT_"CyclesPerOp", result.CyclesPerOp);
+			writer->WriteValue(TEXT_"Threads", result.Threads);
+			writer->WriteValue(TEXT_"Throughput", result.Throughput);
+			writer->WriteValue(TEXT_"LatencyP50Ns", result.LatencyP50);
+			writer->WriteValue(TEXT_"LatencyP99Ns", result.LatencyP99);
+			writer->WriteValue(TEXT_"LatencyP999Ns", result.LatencyP999);
+			writer->WriteValue(TEXT_"Fairness", result.Fairness);
+			writer->WriteObjectEnd();
+		}
+		writer->WriteArrayEnd();
+
+		writer->WriteObjectEnd();
+		writer->Close();
+		return output;
+	}
+
+	FString FBenchmarkReport::ToCsv(bool withHeader) const
+	{
+		FString output;
+		if (withHeader)
+		{
+			output = TEXT_"Label,PluginVersion,EngineVersion,Platform,Configuration,Cpu,Cores,IspcTarget,Time"
+				TEXT_",Suite,Benchmark,Parameter,OperationsPerBatch,BatchesPerSample"
+				TEXT_",MedianNs,MedianAbsoluteDeviationNs,MeanNs,StandardDeviationNs,MinNs,MaxNs,Samples,Outliers"
+				TEXT_",AllocationsPerOp,InstructionsPerOp,CyclesPerOp"
+				TEXT_",Threads,Throughput,LatencyP50Ns,LatencyP99Ns,LatencyP999Ns,Fairness\n";
+		}
+
+		const FString environment = FString::Printf(
+			TEXT_"%s,%s,%s,%s,%s,%s,%d,%s,%s",
+			*QuoteCsv(Label), *QuoteCsv(PluginVersion), *QuoteCsv(EngineVersion), *QuoteCsv(Platform),
+			*QuoteCsv(Configuration), *QuoteCsv(Cpu), Cores, *QuoteCsv(IspcTarget), *Time.ToIso8601()
+		);
+		for (FBenchmarkResult const& result : Results)
+		{
+			FBenchmarkStatistics const& time = result.Nanoseconds;
+			output += FString::Printf(
+				TEXT_"%s,%s,%s,%s,%lld,%lld,%f,%f,%f,%f,%f,%f,%d,%d,%f,%f,%f,%d,%f,%f,%f,%f,%f\n",
+				*environment, *QuoteCsv(result.Suite), *QuoteCsv(result.Benchmark), *QuoteCsv(result.Parameter),
+				result.OperationsPerBatch, result.BatchesPerSample,
+				time.Median, time.MedianAbsoluteDeviation, time.Mean, time.StandardDeviation, time.Min, time.Max,
+				time.Samples, time.Outliers,
+				result.AllocationsPerOp, result.InstructionsPerOp, result.CyclesPerOp,
+				result.Threads, result.Throughput, result.LatencyP50, result.LatencyP99, result.LatencyP999,
+				result.Fairness
+			);
+		}
+		return output;
+	}
+
+	FCanFail FBenchmarkReport::Save(FString const& path, EBenchmarkReportFormat format) const
+	{
+		const bool append = format == EBenchmarkReportFormat::Csv && IFileManager::Get().FileExists(*path);
+		const FString contents = format == EBenchmarkReportFormat::Csv ? ToCsv(!append) : ToJson();
+		const bool saved = FFileHelper::SaveStringToFile(
+			contents, *path,
+			FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+			&IFileManager::Get(),
+			append ? FILEWRITE_Append : FILEWRITE_None
+		);
+		if (!saved)
+		{
+			return IError::Make(new FUnavailable())
+				->AsRecoverable()
+				->WithMessage(TEXT_"Couldn't save the benchmark report")
+				->WithAppendix(TEXT_"File", path);
+		}
+		return Success();
+	}
+
+	FCanFail FBenchmarkReport::Save(FString const& path) const
+	{
+		return Save(path, GetBenchmarkReportFormat(path));
+	}
+}
@@ -0,0 +1,47 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/BenchmarkSuite.h"
+#include "Mcro/TextMacros.h"
+
+DECLARE_LOG_CATEGORY_CLASS(LogMcroBenchmarkSuite, Log, All);
+
+namespace Mcro::Benchmark
+{
+	TArray<IBenchmarkSuite*> FindBenchmarkSuites(TConstArrayView<FString> names)
+	{
+		TArray<IBenchmarkSuite*> result;
+		for (IBenchmarkSuite* suite : IBenchmarkSuite::GetAllView())
+		{
+			const FString name = suite->GetName();
+			if (names.IsEmpty() || names.ContainsByPredicate([&](FString const& filter) { return filter.Equals(name, ESearchCase::IgnoreCase); }))
+				result.Add(suite);
+		}
+		result.Sort([](IBenchmarkSuite const& left, IBenchmarkSuite const& right)
+		{
+			return left.GetName() < right.GetName();
+		});
+		return result;
+	}
+
+	FBenchmarkReport RunBenchmarkSuites(TConstArrayView<FString> names, FBenchmarkSettings const& settings, FString const& label)
+	{
+		FBenchmarkReport report = FBenchmarkReport::Make(label, settings);
+		for (IBenchmarkSuite* suite : FindBenchmarkSuites(names))
+		{
+			UE_LOG(LogMcroBenchmarkSuite, Display, TEXT_"Running benchmark suite %s", *suite->GetName());
+			FBenchmarkContext context(suite->GetName(), settings);
+			suite->Run(context);
+			report.Results.Append(context.ConsumeResults());
+		}
+		return report;
+	}
+}
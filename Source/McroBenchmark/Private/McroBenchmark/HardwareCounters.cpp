@@ -0,0 +1,107 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/HardwareCounters.h"
+#include "HAL/MemoryBase.h"
+
+#if PLATFORM_LINUX
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif PLATFORM_WINDOWS
+#include "Mcro/LibraryIncludes/Start.h"
+#include <Windows.h>
+#include "Mcro/LibraryIncludes/End.h"
+#endif
+
+namespace Mcro::Benchmark::Detail
+{
+#if PLATFORM_LINUX
+	namespace
+	{
+		int OpenPerfCounter(uint64 config)
+		{
+			perf_event_attr attributes {};
+			attributes.type = PERF_TYPE_HARDWARE;
+			attributes.size = sizeof(perf_event_attr);
+			attributes.config = config;
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+
+			// Measure the calling thread on any CPU
+			int file = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+			if (file >= 0)
+			{
+				ioctl(file, PERF_EVENT_IOC_RESET, 0);
+				ioctl(file, PERF_EVENT_IOC_ENABLE, 0);
+			}
+			return file;
+		}
+
+		uint64 ReadPerfCounter(int file)
+		{
+			uint64 value = 0;
+			return file >= 0 && read(file, &value, sizeof(value)) == sizeof(value) ? value : 0;
+		}
+	}
+
+	FThreadHardwareCounters::FThreadHardwareCounters()
+		: InstructionsFile(OpenPerfCounter(PERF_COUNT_HW_INSTRUCTIONS))
+		, CyclesFile(OpenPerfCounter(PERF_COUNT_HW_CPU_CYCLES))
+	{
+		bHasInstructions = InstructionsFile >= 0;
+		bHasCycles = CyclesFile >= 0;
+	}
+
+	FThreadHardwareCounters::~FThreadHardwareCounters()
+	{
+		if (InstructionsFile >= 0) close(InstructionsFile);
+		if (CyclesFile >= 0) close(CyclesFile);
+	}
+
+	FHardwareCounterReading FThreadHardwareCounters::Read() const
+	{
+		return {
+			.Instructions = ReadPerfCounter(InstructionsFile),
+			.Cycles = ReadPerfCounter(CyclesFile)
+		};
+	}
+#elif PLATFORM_WINDOWS
+	FThreadHardwareCounters::FThreadHardwareCounters()
+	{
+		ULONG64 cycles = 0;
+		bHasCycles = QueryThreadCycleTime(GetCurrentThread(), &cycles) != 0;
+	}
+
+	FThreadHardwareCounters::~FThreadHardwareCounters() {}
+
+	FHardwareCounterReading FThreadHardwareCounters::Read() const
+	{
+		ULONG64 cycles = 0;
+		QueryThreadCycleTime(GetCurrentThread(), &cycles);
+		return { .Cycles = cycles };
+	}
+#else
+	FThreadHardwareCounters::FThreadHardwareCounters() {}
+	FThreadHardwareCounters::~FThreadHardwareCounters() {}
+	FHardwareCounterReading FThreadHardwareCounters::Read() const { return {}; }
+#endif
+
+	uint64 GetTotalAllocationCalls()
+	{
+#if STATS
+		return FMalloc::TotalMallocCalls + FMalloc::TotalReallocCalls;
+#else
+		return 0;
+#endif
+	}
+}
@@ -0,0 +1,85 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#if PLATFORM_WINDOWS
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace Mcro::Benchmark::Detail
+{
+	/** @brief A reading of the hardware counters of the current thread */
+	struct FHardwareCounterReading
+	{
+		uint64 Instructions = 0;
+		uint64 Cycles = 0;
+	};
+
+	/**
+	 *	@brief
+	 *	Hardware performance counters of the thread which created this object. Linux exposes retired instructions and
+	 *	cycles via perf events (unless forbidden by `perf_event_paranoid`), Windows only exposes the cycles of a
+	 *	thread. Elsewhere no counters are available.
+	 */
+	class FThreadHardwareCounters
+	{
+	public:
+		FThreadHardwareCounters();
+		~FThreadHardwareCounters();
+
+		FThreadHardwareCounters(FThreadHardwareCounters const&) = delete;
+		FThreadHardwareCounters& operator = (FThreadHardwareCounters const&) = delete;
+
+		bool HasInstructions() const { return bHasInstructions; }
+		bool HasCycles() const { return bHasCycles; }
+
+		FHardwareCounterReading Read() const;
+
+	private:
+		bool bHasInstructions = false;
+		bool bHasCycles = false;
+
+#if PLATFORM_LINUX
+		int InstructionsFile = -1;
+		int CyclesFile = -1;
+#endif
+	};
+
+	/**
+	 *	@brief
+	 *	Read the timestamp counter of the CPU, which is much finer grained than `FPlatformTime::Cycles64` on Windows.
+	 *	Its frequency is unknown, calibrate it against `FPlatformTime` over the measured period. Falls back to
+	 *	`FPlatformTime::Cycles64` on CPUs without an accessible counter.
+	 */
+	FORCEINLINE uint64 ReadTimestampCounter()
+	{
+#if PLATFORM_CPU_X86_FAMILY
+		return __rdtsc();
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS && !PLATFORM_WINDOWS
+		uint64 result;
+		asm volatile("mrs %0, cntvct_el0" : "=r"(result));
+		return result;
+#else
+		return FPlatformTime::Cycles64();
+#endif
+	}
+
+	/** @returns Number of heap allocations so far on all threads, or 0 when it's not tracked in this build */
+	uint64 GetTotalAllocationCalls();
+}
@@ -0,0 +1,97 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Async/ParallelFor.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		constexpr int32 Operations = 100'000;
+
+		struct FComposable : IComposable {};
+		struct FPooledComposable : IComposable { static constexpr bool PoolComponents = true; };
+		struct FCopyOnWriteComposable : IComposable { static constexpr bool ShareComponentsOnCopy = true; };
+		struct FConcurrentComposable : IComposable { static constexpr bool ConcurrentReads = true; };
+
+		struct IMovement { float Speed = 1; };
+		struct FPosition { FVector Value = FVector::ZeroVector; };
+		struct FVelocity : TInherit<IMovement> { FVector Value = FVector::OneVector; };
+		struct FHealth { float Value = 100; };
+		struct FLabel { FString Value = TEXT_"Component"; };
+
+		template <typename Composable>
+		Composable MakeComposable()
+		{
+			return Composable()
+				.template With<FPosition>()
+				.template With<FVelocity>()
+				.template With<FHealth>()
+				.template With<FLabel>();
+		}
+
+		template <typename Composable>
+		void MeasureComposable(FBenchmarkContext& context, const TCHAR* kind)
+		{
+			context.MeasureEach(TEXT_"IComposable::With", FString::Printf(TEXT_"%s, 4 components", kind), Operations / 10, [](int32)
+			{
+				DoNotOptimize(MakeComposable<Composable>());
+			});
+
+			Composable composable = MakeComposable<Composable>();
+			context.MeasureEach(TEXT_"IComposable::TryGet", FString::Printf(TEXT_"%s, exact type", kind), Operations, [&](int32)
+			{
+				DoNotOptimize(composable.template TryGet<FHealth>());
+			});
+			context.MeasureEach(TEXT_"IComposable::TryGet", FString::Printf(TEXT_"%s, alias", kind), Operations, [&](int32)
+			{
+				DoNotOptimize(composable.template TryGet<IMovement>());
+			});
+			context.MeasureEach(TEXT_"IComposable::TryGet", FString::Printf(TEXT_"%s, missing", kind), Operations, [&](int32)
+			{
+				DoNotOptimize(composable.template TryGet<FVector>());
+			});
+			context.MeasureEach(TEXT_"IComposable copy", FString::Printf(TEXT_"%s, 4 components", kind), Operations / 10, [&](int32)
+			{
+				Composable copy = composable;
+				DoNotOptimize(copy);
+			});
+		}
+	}
+
+	void RunComposition(FBenchmarkContext& context)
+	{
+		MeasureComposable<FComposable>(context, TEXT_"Default");
+		MeasureComposable<FPooledComposable>(context, TEXT_"PoolComponents");
+		MeasureComposable<FCopyOnWriteComposable>(context, TEXT_"ShareComponentsOnCopy");
+		MeasureComposable<FConcurrentComposable>(context, TEXT_"ConcurrentReads");
+
+		FConcurrentComposable const concurrent = MakeComposable<FConcurrentComposable>();
+		const int32 threads = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+		context.Measure(
+			TEXT_"IComposable::TryGet",
+			FString::Printf(TEXT_"ConcurrentReads, %d threads", threads),
+			static_cast<int64>(Operations) * threads,
+			[&]
+			{
+				ParallelFor(threads, [&](int32)
+				{
+					for (int32 i = 0; i < Operations; ++i)
+						DoNotOptimize(concurrent.TryGet<FHealth>());
+				});
+			}
+		);
+	}
+}
@@ -0,0 +1,175 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "McroISPC/Numeric.h"
+#include "McroISPC/TaskSystem.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		/** @brief Percentage of writing operations in a mix of readers and writers */
+		constexpr int32 WritePercentages[] { 0, 10, 50 };
+
+		/** @brief Error signatures shared by the threads, a single one contends on the same slot of the table */
+		constexpr int32 SignatureCounts[] { 1, 256 };
+
+		constexpr int32 IspcItems = 100'000;
+
+		/** @returns Powers of two up to the number of logical cores, and the number of logical cores itself */
+		TArray<int32> GetThreadCounts()
+		{
+			const int32 cores = FMath::Max(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 1);
+			TArray<int32> result;
+			for (int32 threads = 1; threads < cores; threads *= 2)
+				result.Add(threads);
+			result.Add(cores);
+			return result;
+		}
+
+		/**
+		 *	Writes are scattered over the iterations with a hash, seeded by the thread, so the writes of different
+		 *	threads don't come in bursts aligned to each other.
+		 */
+		FORCEINLINE bool IsWriting(int32 thread, int64 iteration, int32 writePercentage)
+		{
+			uint64 hash = static_cast<uint64>(iteration) ^ (static_cast<uint64>(thread) << 48);
+			hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+			hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+			hash ^= hash >> 31;
+			return static_cast<int32>(hash % 100) < writePercentage;
+		}
+
+		FString GetMixName(int32 writePercentage)
+		{
+			return writePercentage == 0
+				? FString(TEXT_"read only")
+				: FString::Printf(TEXT_"%d%% writes", writePercentage);
+		}
+
+		template <typename State>
+		void MeasureState(FBenchmarkContext& context, TConstArrayView<int32> threadCounts, const TCHAR* policyName)
+		{
+			for (int32 writePercentage : WritePercentages)
+			{
+				const FString parameter = FString::Printf(TEXT_"%s, %s", policyName, *GetMixName(writePercentage));
+				for (int32 threads : threadCounts)
+				{
+					State state(0);
+					context.MeasureContended(TEXT_"TState::GetCopyOnAnyThread/Set", parameter, threads, [&](int32 thread, int64 i)
+					{
+						if (IsWriting(thread, i, writePercentage))
+							state.Set(static_cast<int32>(i));
+						else
+							DoNotOptimize(state.GetCopyOnAnyThread());
+					});
+				}
+			}
+		}
+
+		template <typename Event>
+		void MeasureEvent(FBenchmarkContext& context, TConstArrayView<int32> threadCounts, const TCHAR* policyName)
+		{
+			for (int32 writePercentage : WritePercentages)
+			{
+				const FString parameter = FString::Printf(TEXT_"%s, 10 listeners, %s", policyName, *GetMixName(writePercentage));
+				for (int32 threads : threadCounts)
+				{
+					Event event;
+					for (int32 i = 0; i < 10; ++i)
+						event.Add(InferDelegate::From([](int32 value) { DoNotOptimize(value); }));
+
+					context.MeasureContended(TEXT_"TEventDelegate::Broadcast/Add+Remove", parameter, threads, [&](int32 thread, int64 i)
+					{
+						if (IsWriting(thread, i, writePercentage))
+							event.Remove(event.Add(InferDelegate::From([](int32 value) { DoNotOptimize(value); })));
+						else
+							event.Broadcast(static_cast<int32>(i));
+					});
+				}
+			}
+		}
+
+		void MeasureErrorFrequency(FBenchmarkContext& context, TConstArrayView<int32> threadCounts)
+		{
+			const IErrorRef prototype = IError::Make(new FUnavailable());
+			for (int32 signatures : SignatureCounts)
+			{
+				for (int32 writePercentage : WritePercentages)
+				{
+					const FString parameter = FString::Printf(
+						TEXT_"%d signatures, %s", signatures, *GetMixName(writePercentage)
+					);
+					for (int32 threads : threadCounts)
+					{
+						// A private table, so the global one consulted by ERROR_LOG and FErrorManager is not polluted
+						TUniquePtr<FErrorFrequency> frequency = MakeUnique<FErrorFrequency>();
+						context.MeasureContended(TEXT_"FErrorFrequency::GetCount/Record", parameter, threads, [&](int32 thread, int64 i)
+						{
+							const uint64 signature = i % signatures + 1;
+							if (IsWriting(thread, i, writePercentage))
+								DoNotOptimize(frequency->Record(signature, prototype->GetType()));
+							else
+								DoNotOptimize(frequency->GetCount(signature));
+						});
+					}
+				}
+			}
+
+			for (int32 threads : threadCounts)
+			{
+				TUniquePtr<FErrorFrequency> frequency = MakeUnique<FErrorFrequency>();
+				context.MeasureContended(TEXT_"IError::Make+ShouldLog", TEXT_"1 signature", threads, [&](int32, int64)
+				{
+					IErrorRef error = IError::Make(new FUnavailable())->WithSignature(1);
+					DoNotOptimize(frequency->ShouldLog(*error));
+				});
+			}
+		}
+
+		void MeasureIspcLaunches(FBenchmarkContext& context, TConstArrayView<int32> threadCounts)
+		{
+			TArray<float> values;
+			values.SetNumUninitialized(IspcItems);
+			for (int32 i = 0; i < IspcItems; ++i) values[i] = static_cast<float>(i % 1000) * 0.001f;
+
+			const FString parameter = FString::Printf(
+				TEXT_"%d items, %s (%d workers)",
+				IspcItems, ISPC::GetTaskSystemName(), ISPC::GetTaskSystemWorkerCount()
+			);
+			for (int32 threads : threadCounts)
+			{
+				context.MeasureContended(TEXT_"ISPC::Sum", parameter, threads, [&](int32, int64)
+				{
+					DoNotOptimize(ISPC::Sum(values));
+				});
+			}
+		}
+	}
+
+	void RunContention(FBenchmarkContext& context)
+	{
+		const TArray<int32> threadCounts = GetThreadCounts();
+
+		MeasureState<TStateTS<int32>>(context, threadCounts, TEXT_"ThreadSafe");
+		MeasureState<TStateRM<int32>>(context, threadCounts, TEXT_"ReadMostly");
+
+		MeasureEvent<TEventDelegate<void(int32), {.ThreadSafe = true}>>(context, threadCounts, TEXT_"ThreadSafe");
+		MeasureEvent<TLockFreeEventDelegate<void(int32)>>(context, threadCounts, TEXT_"LockFreeBroadcast");
+
+		MeasureErrorFrequency(context, threadCounts);
+		MeasureIspcLaunches(context, threadCounts);
+	}
+}
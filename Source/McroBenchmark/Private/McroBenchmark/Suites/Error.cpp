@@ -0,0 +1,92 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		constexpr int32 Operations = 10'000;
+
+		TMaybe<int32> Succeed(int32 value)
+		{
+			return value;
+		}
+
+		TMaybe<int32> FailWithCode(int32)
+		{
+			return FErrorCode { 1, TEXT_"Benchmark error code" };
+		}
+
+		TMaybe<int32> FailWithError(int32 value)
+		{
+			return IError::Make(new FUnavailable())
+				->AsRecoverable()
+				->WithMessageF(TEXT_"Benchmark error {0}", value);
+		}
+
+		template <auto Function>
+		TMaybe<int32> Propagate(int32 value)
+		{
+			PROPAGATE_FAIL(result, Function(value));
+			return result.GetValue() + 1;
+		}
+	}
+
+	void RunError(FBenchmarkContext& context)
+	{
+		context.MeasureEach(TEXT_"TMaybe return", TEXT_"Success", Operations, [](int32 i)
+		{
+			DoNotOptimize(Succeed(i).HasValue());
+		});
+		context.MeasureEach(TEXT_"TMaybe return", TEXT_"FErrorCode", Operations, [](int32 i)
+		{
+			DoNotOptimize(FailWithCode(i).HasValue());
+		});
+		context.MeasureEach(TEXT_"TMaybe return", TEXT_"IError", Operations, [](int32 i)
+		{
+			DoNotOptimize(FailWithError(i).HasValue());
+		});
+
+		context.MeasureEach(TEXT_"PROPAGATE_FAIL", TEXT_"Success", Operations, [](int32 i)
+		{
+			DoNotOptimize(Propagate<&Succeed>(i).HasValue());
+		});
+		context.MeasureEach(TEXT_"PROPAGATE_FAIL", TEXT_"FErrorCode", Operations, [](int32 i)
+		{
+			DoNotOptimize(Propagate<&FailWithCode>(i).HasValue());
+		});
+		context.MeasureEach(TEXT_"PROPAGATE_FAIL", TEXT_"IError", Operations, [](int32 i)
+		{
+			DoNotOptimize(Propagate<&FailWithError>(i).HasValue());
+		});
+
+		context.MeasureEach(TEXT_"TMaybe::Map+ValueOr", TEXT_"Success", Operations, [](int32 i)
+		{
+			DoNotOptimize(Succeed(i).Map([](int32 value) { return value * 2; }).ValueOr(0));
+		});
+
+		IErrorRef error = IError::Make(new FUnavailable())
+			->AsRecoverable()
+			->WithMessage(TEXT_"Benchmark error")
+			->WithDetails(TEXT_"An error with a couple of inner errors, serialized as it would be when it's logged")
+			->WithError(IError::Make(new FAssertion())->WithMessage(TEXT_"Inner error"))
+			->WithAppendix(TEXT_"Appendix", TEXT_"Some plain text");
+		context.MeasureEach(TEXT_"IError::ToString", TEXT_"2 inner errors", Operations / 10, [&](int32)
+		{
+			DoNotOptimize(error->ToString().Len());
+		});
+	}
+}
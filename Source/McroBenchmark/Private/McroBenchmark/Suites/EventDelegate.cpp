@@ -0,0 +1,76 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		constexpr int32 Operations = 10'000;
+
+		template <typename Event>
+		void MeasureBroadcast(FBenchmarkContext& context, const TCHAR* policyName)
+		{
+			for (int32 listeners : { 0, 1, 10, 100, 1000 })
+			{
+				Event event;
+				int64 sink = 0;
+				for (int32 i = 0; i < listeners; ++i)
+					event.Add(InferDelegate::From([&sink](int32 value) { sink += value; }));
+
+				context.MeasureEach(
+					TEXT_"TEventDelegate::Broadcast",
+					FString::Printf(TEXT_"%s, %d listeners", policyName, listeners),
+					Operations,
+					[&](int32 i) { event.Broadcast(i); }
+				);
+				DoNotOptimize(sink);
+			}
+		}
+	}
+
+	void RunEventDelegate(FBenchmarkContext& context)
+	{
+		MeasureBroadcast<TEventDelegate<void(int32)>>(context, TEXT_"Default");
+		MeasureBroadcast<TEventDelegate<void(int32), {.ThreadSafe = true}>>(context, TEXT_"ThreadSafe");
+		MeasureBroadcast<TLockFreeEventDelegate<void(int32)>>(context, TEXT_"LockFreeBroadcast");
+
+		TEventDelegate<void()> parameterless;
+		parameterless.Add(InferDelegate::From([] {}));
+		context.MeasureEach(TEXT_"TEventDelegate::Broadcast", TEXT_"Parameterless, 1 listener", Operations, [&](int32)
+		{
+			parameterless.Broadcast();
+		});
+
+		TEventDelegate<void(int32)> event;
+		TArray<FDelegateHandle> handles;
+		handles.Reserve(Operations);
+		context.Measure(TEXT_"TEventDelegate::Add+Remove", TEXT_"", Operations, [&]
+		{
+			for (int32 i = 0; i < Operations; ++i)
+				handles.Add(event.Add(InferDelegate::From([](int32) {})));
+			for (FDelegateHandle const& handle : handles)
+				event.Remove(handle);
+			handles.Reset();
+		});
+
+		TEventDelegate<void(int32)> onceEvent;
+		context.MeasureEach(TEXT_"TEventDelegate::Add+Broadcast", TEXT_"Once", Operations, [&](int32 i)
+		{
+			onceEvent.Add(InferDelegate::From([](int32) {}), {.Once = true});
+			onceEvent.Broadcast(i);
+		});
+	}
+}
@@ -0,0 +1,88 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "McroISPC/TaskSystem.h"
+#include "McroISPC/IspcTarget.h"
+#include "McroISPC/Numeric.h"
+#include "Mcro/TextMacros.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::ISPC;
+
+	namespace
+	{
+		constexpr int32 Sizes[] { 1'000, 100'000, 4'000'000 };
+	}
+
+	void RunIspc(FBenchmarkContext& context)
+	{
+		const TCHAR* target = GetIspcTargetName(GetIspcTarget());
+		for (int32 size : Sizes)
+		{
+			const FString parameter = FString::Printf(
+				TEXT_"%d items, %s, %s (%d workers)",
+				size, target, GetTaskSystemName(), GetTaskSystemWorkerCount()
+			);
+
+			TArray<float> values;
+			values.SetNumUninitialized(size);
+			for (int32 i = 0; i < size; ++i) values[i] = static_cast<float>(i % 1000) * 0.001f;
+			TArray<float> other = values;
+			TArray<float> result;
+			result.SetNumUninitialized(size);
+
+			context.Measure(TEXT_"Raw loop: sum", parameter, size, [&]
+			{
+				float sum = 0;
+				for (float value : values) sum += value;
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"Sum", parameter, size, [&]
+			{
+				DoNotOptimize(Sum(values));
+			});
+
+			context.Measure(TEXT_"Raw loop: dot", parameter, size, [&]
+			{
+				float sum = 0;
+				for (int32 i = 0; i < size; ++i) sum += values[i] * other[i];
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"Dot", parameter, size, [&]
+			{
+				DoNotOptimize(Dot(values, other));
+			});
+
+			context.Measure(TEXT_"Raw loop: transform affine", parameter, size, [&]
+			{
+				for (int32 i = 0; i < size; ++i) result[i] = values[i] * 2.f + 1.f;
+				DoNotOptimize(result[size - 1]);
+			});
+			context.Measure(TEXT_"TransformAffine", parameter, size, [&]
+			{
+				TransformAffine(values, result, 2.f, 1.f);
+				DoNotOptimize(result[size - 1]);
+			});
+
+			context.Measure(TEXT_"PrefixSum", parameter, size, [&]
+			{
+				PrefixSum(values, result);
+				DoNotOptimize(result[size - 1]);
+			});
+			context.Measure(TEXT_"MinMax", parameter, size, [&]
+			{
+				DoNotOptimize(MinMax(values).IsSet());
+			});
+		}
+	}
+}
@@ -0,0 +1,106 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Async/ParallelFor.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		constexpr int32 Operations = 100'000;
+
+		template <FStatePolicy Policy>
+		void MeasureSetAndModify(FBenchmarkContext& context, const TCHAR* policyName)
+		{
+			TState<int32, Policy> state(0);
+			int64 sink = 0;
+			state.OnChange([&sink](int32 next) { sink += next; });
+
+			context.MeasureEach(TEXT_"TState::Set", policyName, Operations, [&](int32 i)
+			{
+				state.Set(i);
+			});
+			context.MeasureEach(TEXT_"TState::Modify", policyName, Operations, [&](int32 i)
+			{
+				state.Modify([i](int32& value) { value = i; });
+			});
+			DoNotOptimize(sink);
+		}
+
+		template <typename State, typename Function>
+		void MeasureContendedRead(FBenchmarkContext& context, const TCHAR* benchmark, const TCHAR* policyName, Function&& read)
+		{
+			State state(1);
+			const int32 threads = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+			context.Measure(
+				benchmark,
+				FString::Printf(TEXT_"%s, %d threads", policyName, threads),
+				static_cast<int64>(Operations) * threads,
+				[&]
+				{
+					ParallelFor(threads, [&](int32)
+					{
+						int64 sum = 0;
+						for (int32 i = 0; i < Operations; ++i) sum += read(state);
+						DoNotOptimize(sum);
+					});
+				}
+			);
+		}
+	}
+
+	void RunObservable(FBenchmarkContext& context)
+	{
+		MeasureSetAndModify<FStatePolicy {.NotifyOnChangeOnly = true}>(context, TEXT_"NotifyOnChangeOnly");
+		MeasureSetAndModify<FStatePolicy {.AlwaysNotify = true}>(context, TEXT_"AlwaysNotify");
+		MeasureSetAndModify<FStatePolicy {.NotifyOnChangeOnly = true, .StorePrevious = true}>(context, TEXT_"StorePrevious");
+		MeasureSetAndModify<FStatePolicy {.NotifyOnChangeOnly = true, .ThreadSafe = true}>(context, TEXT_"ThreadSafe");
+		MeasureSetAndModify<FStatePolicy {.NotifyOnChangeOnly = true, .ThreadSafe = true, .ReadMostly = true}>(context, TEXT_"ReadMostly");
+
+		FBool flag(false);
+		context.MeasureEach(TEXT_"TState::Set", TEXT_"bool", Operations, [&](int32 i)
+		{
+			flag.Set(i % 2 == 0);
+		});
+
+		MeasureContendedRead<TStateTS<int32>>(context, TEXT_"TState::GetOnAnyThread", TEXT_"ThreadSafe", [](TStateTS<int32> const& state)
+		{
+			auto [value, lock] = state.GetOnAnyThread();
+			return value;
+		});
+		MeasureContendedRead<TStateTS<int32>>(context, TEXT_"TState::GetCopyOnAnyThread", TEXT_"ThreadSafe", [](TStateTS<int32> const& state)
+		{
+			return state.GetCopyOnAnyThread();
+		});
+		MeasureContendedRead<TStateRM<int32>>(context, TEXT_"TState::GetCopyOnAnyThread", TEXT_"ReadMostly", [](TStateRM<int32> const& state)
+		{
+			return state.GetCopyOnAnyThread();
+		});
+
+		for (int32 listeners : { 0, 1, 10, 100, 1000 })
+		{
+			TState<int32, FStatePolicy {.AlwaysNotify = true}> state(0);
+			int64 sink = 0;
+			for (int32 i = 0; i < listeners; ++i)
+				state.OnChange([&sink](int32 next) { sink += next; });
+
+			context.MeasureEach(TEXT_"TState::Set", FString::Printf(TEXT_"AlwaysNotify, %d listeners", listeners), Operations / 10, [&](int32 i)
+			{
+				state.Set(i);
+			});
+			DoNotOptimize(sink);
+		}
+	}
+}
@@ -0,0 +1,190 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		constexpr int32 Sizes[] { 1'000, 100'000 };
+
+		TArray<int32> MakeInput(int32 size)
+		{
+			TArray<int32> result;
+			result.SetNumUninitialized(size);
+			for (int32 i = 0; i < size; ++i) result[i] = i % 1000;
+			return result;
+		}
+
+		TMap<int32, int32> MakeMap(int32 size)
+		{
+			TMap<int32, int32> result;
+			result.Reserve(size);
+			for (int32 i = 0; i < size; ++i) result.Add(i, i % 1000);
+			return result;
+		}
+	}
+
+	void RunRange(FBenchmarkContext& context)
+	{
+		for (int32 size : Sizes)
+		{
+			const FString items = FString::Printf(TEXT_"%d items", size);
+			TArray<int32> input = MakeInput(size);
+			TArray<int32> other = MakeInput(size);
+			TMap<int32, int32> map = MakeMap(size);
+
+			context.Measure(TEXT_"Raw loop: filter + transform + sum", items, size, [&]
+			{
+				int64 sum = 0;
+				for (int32 i = 0; i < input.Num(); ++i)
+					if (input[i] % 2 == 0) sum += input[i] * 3;
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"FilterReduce: filter + transform + sum", items, size, [&]
+			{
+				DoNotOptimize(input | FilterReduce(int64(0),
+					[](int64 sum, int32 i) { return sum + i * 3; },
+					[](int32 i) { return i % 2 == 0; }
+				));
+			});
+			context.Measure(TEXT_"range-v3: filter + transform + sum", items, size, [&]
+			{
+				DoNotOptimize(ranges::accumulate(input
+					| ranges::views::filter([](int32 i) { return i % 2 == 0; })
+					| ranges::views::transform([](int32 i) { return int64(i) * 3; }),
+					int64(0)
+				));
+			});
+
+			TArray<int32> output;
+			context.Measure(TEXT_"Raw loop: transform into array", items, size, [&]
+			{
+				output.SetNumUninitialized(input.Num(), EAllowShrinking::No);
+				for (int32 i = 0; i < input.Num(); ++i) output[i] = input[i] * 3 + 1;
+				DoNotOptimize(output.GetData());
+			});
+			context.Measure(TEXT_"TransformTo: transform into array", items, size, [&]
+			{
+				input | TransformTo(output, [](int32 i) { return i * 3 + 1; });
+				DoNotOptimize(output.GetData());
+			});
+
+			context.Measure(TEXT_"Raw loop: filter + transform into new array", items, size, [&]
+			{
+				TArray<int32> result;
+				for (int32 i : input)
+					if (i % 2 == 0) result.Add(i * 3);
+				DoNotOptimize(result.Num());
+			});
+			context.Measure(TEXT_"RenderAs: filter + transform into new array", items, size, [&]
+			{
+				DoNotOptimize((input
+					| ranges::views::filter([](int32 i) { return i % 2 == 0; })
+					| ranges::views::transform([](int32 i) { return i * 3; })
+					| RenderAs<TArray>()
+				).Num());
+			});
+
+			context.Measure(TEXT_"Raw loop: zip", items, size, [&]
+			{
+				int64 sum = 0;
+				for (int32 i = 0; i < input.Num(); ++i) sum += input[i] * other[i];
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"Zip", items, size, [&]
+			{
+				int64 sum = 0;
+				for (auto [left, right] : input | Zip(other)) sum += left * right;
+				DoNotOptimize(sum);
+			});
+
+			context.Measure(TEXT_"Raw loop: concat", items, size * 2, [&]
+			{
+				int64 sum = 0;
+				for (int32 i : input) sum += i;
+				for (int32 i : other) sum += i;
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"Concat", items, size * 2, [&]
+			{
+				int64 sum = 0;
+				for (int32 i : input | Concat(other)) sum += i;
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"ForEachConcat", items, size * 2, [&]
+			{
+				int64 sum = 0;
+				ForEachConcat([&](int32 i) { sum += i; }, input, other);
+				DoNotOptimize(sum);
+			});
+
+			context.Measure(TEXT_"Raw loop: filter TMap pairs", items, size, [&]
+			{
+				int64 sum = 0;
+				for (auto const& pair : map)
+					if (pair.Value < 500) sum += pair.Key;
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"FilterTuple: filter TMap pairs", items, size, [&]
+			{
+				int64 sum = 0;
+				for (auto const& pair : map | FilterTuple([](int32, int32 value) { return value < 500; }))
+					sum += pair.Key;
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"TMap::GenerateKeyArray", items, size, [&]
+			{
+				TArray<int32> keys;
+				map.GenerateKeyArray(keys);
+				DoNotOptimize(keys.Num());
+			});
+			context.Measure(TEXT_"GetKeys: into new array", items, size, [&]
+			{
+				DoNotOptimize((map | GetKeys() | RenderAs<TArray>()).Num());
+			});
+			context.Measure(TEXT_"Raw loop: sum of TMap values", items, size, [&]
+			{
+				int64 sum = 0;
+				for (auto const& pair : map) sum += pair.Value;
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"GetValues: sum of TMap values", items, size, [&]
+			{
+				int64 sum = 0;
+				for (int32 value : map | GetValues()) sum += value;
+				DoNotOptimize(sum);
+			});
+
+			TArray<int32> copy = input;
+			context.Measure(TEXT_"Scalar: MatchOrdered", items, size, [&]
+			{
+				DoNotOptimize(Detail::MatchOrderedScalar(input, copy, false));
+			});
+			context.Measure(TEXT_"MatchOrdered", items, size, [&]
+			{
+				DoNotOptimize(MatchOrdered(input, copy));
+			});
+			context.Measure(TEXT_"range-v3: AllOf", items, size, [&]
+			{
+				DoNotOptimize(ranges::all_of(input, [](int32 i) { return i < 1000; }));
+			});
+			context.Measure(TEXT_"AllOf", items, size, [&]
+			{
+				DoNotOptimize(input | AllOf([](int32 i) { return i < 1000; }));
+			});
+		}
+	}
+}
@@ -0,0 +1,253 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Math/RandomStream.h"
+#include "Widgets/Layout/SSpacer.h"
+#include "Widgets/SBoxPanel.h"
+#include "Mcro/Common.h"
+#include "Mcro/Slate/ReactiveWidget.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		/** @brief Reconcile a reactive widget immediately instead of waiting for it to be painted */
+		template <typename Widget>
+		class TBenchmarkedReactiveWidget : public Widget
+		{
+		public:
+			void ReconcileNow()
+			{
+				if (auto state = this->State.Pin())
+				{
+					typename Widget::StateRangeType latest;
+					{
+						auto [value, lock] = state->GetOnAnyThread();
+						latest = value;
+					}
+					this->OnStateChange(latest);
+				}
+			}
+		};
+
+		using FArrayWidget = TBenchmarkedReactiveWidget<TKeyedArrayReactiveWidget<int32, int32, SVerticalBox>>;
+		using FMapWidget = TBenchmarkedReactiveWidget<TMapReactiveWidget<int32, int32, SVerticalBox, SWidget>>;
+
+		constexpr int32 Sizes[] { 1'000, 10'000, 100'000 };
+
+		int32 SamplesFor(int32 size)
+		{
+			return size >= 100'000 ? 3 : 10;
+		}
+
+		enum class EArrayChange : uint8
+		{
+			Append,
+			Prepend,
+			MiddleInsert,
+			Shuffle,
+			BulkReplace
+		};
+
+		enum class EMapChange : uint8
+		{
+			Insert,
+			Shuffle,
+			BulkReplace
+		};
+
+		TArray<int32> MakeItems(int32 count)
+		{
+			TArray<int32> result;
+			result.SetNumUninitialized(count);
+			for (int32 i = 0; i < count; ++i) result[i] = i;
+			return result;
+		}
+
+		template <typename Range>
+		void ShuffleItems(Range& items)
+		{
+			FRandomStream random(1234);
+			for (int32 i = items.Num() - 1; i > 0; --i)
+				items.Swap(i, random.RandRange(0, i));
+		}
+
+		TArray<int32> ChangeItems(TArray<int32> const& items, EArrayChange change)
+		{
+			const int32 count = items.Num();
+			TArray<int32> result = items;
+			switch (change)
+			{
+			case EArrayChange::Append:       result.Add(count); break;
+			case EArrayChange::Prepend:      result.Insert(count, 0); break;
+			case EArrayChange::MiddleInsert: result.Insert(count, count / 2); break;
+			case EArrayChange::Shuffle:      ShuffleItems(result); break;
+			case EArrayChange::BulkReplace:
+				for (int32& item : result) item += count;
+				break;
+			}
+			return result;
+		}
+
+		TMap<int32, int32> ChangeEntries(TMap<int32, int32> const& entries, EMapChange change)
+		{
+			const int32 count = entries.Num();
+			TMap<int32, int32> result;
+			switch (change)
+			{
+			case EMapChange::Insert:
+				result = entries;
+				result.Add(count, count);
+				break;
+			case EMapChange::Shuffle:
+				{
+					TArray<int32> values;
+					entries.GenerateValueArray(values);
+					ShuffleItems(values);
+					int32 i = 0;
+					result.Reserve(count);
+					for (auto const& entry : entries) result.Add(entry.Key, values[i++]);
+					break;
+				}
+			case EMapChange::BulkReplace:
+				result.Reserve(count);
+				for (int32 i = 0; i < count; ++i) result.Add(i + count, i);
+				break;
+			}
+			return result;
+		}
+
+		TSharedRef<FArrayWidget> MakeArrayWidget(IStatePtr<TArray<int32>> const& state, bool keyed)
+		{
+			return SNew(FArrayWidget)
+				. State(state)
+				. Container(SNew(SVerticalBox))
+				. CreateChild_Lambda([](TSharedRef<SVerticalBox> const& container, int32 const&, int32 const& at)
+				{
+					return MoveTemp(container->InsertSlot(at)[SNew(SSpacer)]);
+				})
+				. RemoveChild_Lambda([](TSharedRef<SVerticalBox> const& container, TSharedRef<SWidget> const& child, int32 const&)
+				{
+					container->RemoveSlot(child);
+				})
+				. KeyOf(keyed
+					? FArrayWidget::FKeyOf::CreateLambda([](int32 const& item) { return item; })
+					: FArrayWidget::FKeyOf()
+				)
+			;
+		}
+
+		TSharedRef<FMapWidget> MakeMapWidget(IStatePtr<TMap<int32, int32>> const& state)
+		{
+			return SNew(FMapWidget)
+				. State(state)
+				. Container(SNew(SVerticalBox))
+				. CreateChild_Lambda([](TSharedRef<SVerticalBox> const& container, int32 const&, int32 const&)
+				{
+					return MoveTemp(container->AddSlot()[SNew(SSpacer)]);
+				})
+				. RemoveChild_Lambda([](TSharedRef<SVerticalBox> const& container, TSharedRef<SWidget> const& child, int32 const&)
+				{
+					container->RemoveSlot(child);
+				})
+			;
+		}
+
+		void MeasureArrayWidget(FBenchmarkContext& context, const TCHAR* benchmark, bool keyed)
+		{
+			for (int32 size : Sizes)
+			{
+				const TArray<int32> items = MakeItems(size);
+				for (EArrayChange change : magic_enum::enum_values<EArrayChange>())
+				{
+					const TArray<int32> next = ChangeItems(items, change);
+					TSharedPtr<TState<TArray<int32>>> state;
+					TSharedPtr<FArrayWidget> widget;
+					context.MeasureWithSetup(
+						benchmark,
+						FString::Printf(TEXT_"%d items, %s", size, *EnumToStringCopy(change)),
+						1, SamplesFor(size),
+						[&]
+						{
+							state = MakeShared<TState<TArray<int32>>>(items);
+							widget = MakeArrayWidget(state, keyed);
+							widget->ReconcileNow();
+							state->Set(next);
+						},
+						[&] { widget->ReconcileNow(); }
+					);
+				}
+			}
+		}
+	}
+
+	void RunSlate(FBenchmarkContext& context)
+	{
+		MeasureArrayWidget(context, TEXT_"TArrayReactiveWidget by index", false);
+		MeasureArrayWidget(context, TEXT_"TArrayReactiveWidget keyed", true);
+
+		for (int32 size : Sizes)
+		{
+			TMap<int32, int32> entries;
+			entries.Reserve(size);
+			for (int32 i = 0; i < size; ++i) entries.Add(i, i);
+
+			for (EMapChange change : magic_enum::enum_values<EMapChange>())
+			{
+				const TMap<int32, int32> next = ChangeEntries(entries, change);
+				TSharedPtr<TState<TMap<int32, int32>>> state;
+				TSharedPtr<FMapWidget> widget;
+				context.MeasureWithSetup(
+					TEXT_"TMapReactiveWidget",
+					FString::Printf(TEXT_"%d items, %s", size, *EnumToStringCopy(change)),
+					1, SamplesFor(size),
+					[&]
+					{
+						state = MakeShared<TState<TMap<int32, int32>>>(entries);
+						widget = MakeMapWidget(state);
+						widget->ReconcileNow();
+						state->Set(next);
+					},
+					[&] { widget->ReconcileNow(); }
+				);
+			}
+		}
+
+		// Baseline: rebuilding the whole panel with TSlots instead of reconciling it
+		for (int32 size : Sizes)
+		{
+			const TArray<int32> items = MakeItems(size);
+			for (EArrayChange change : magic_enum::enum_values<EArrayChange>())
+			{
+				const TArray<int32> next = ChangeItems(items, change);
+				auto build = [](TArray<int32> const& from)
+				{
+					return SNew(SVerticalBox)
+						+ TSlots(from, [](int32 const&)
+						{
+							return MoveTemp(SVerticalBox::Slot()[SNew(SSpacer)]);
+						});
+				};
+				TSharedPtr<SVerticalBox> panel;
+				context.MeasureWithSetup(
+					TEXT_"TSlots rebuild",
+					FString::Printf(TEXT_"%d items, %s", size, *EnumToStringCopy(change)),
+					1, SamplesFor(size),
+					[&] { panel = build(items); },
+					[&] { panel = build(next); }
+				);
+			}
+		}
+	}
+}
@@ -0,0 +1,31 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "McroBenchmark/Benchmark.h"
+
+/** @brief Built-in benchmark suites of MCRO, registered by the McroBenchmark module */
+namespace Mcro::Benchmark::Suites
+{
+	void RunThreading(FBenchmarkContext& context);
+	void RunObservable(FBenchmarkContext& context);
+	void RunEventDelegate(FBenchmarkContext& context);
+	void RunComposition(FBenchmarkContext& context);
+	void RunRange(FBenchmarkContext& context);
+	void RunTypeHashMap(FBenchmarkContext& context);
+	void RunText(FBenchmarkContext& context);
+	void RunError(FBenchmarkContext& context);
+	void RunIspc(FBenchmarkContext& context);
+	void RunContention(FBenchmarkContext& context);
+	void RunSlate(FBenchmarkContext& context);
+}
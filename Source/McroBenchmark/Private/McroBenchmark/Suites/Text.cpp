@@ -0,0 +1,150 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		constexpr int32 Operations = 10'000;
+
+		FString MakeText(int32 length, bool ascii)
+		{
+			FString result;
+			result.Reserve(length);
+			for (int32 i = 0; i < length; ++i)
+				result.AppendChar(ascii || i % 8 ? TCHAR('a' + i % 26) : TCHAR(0x00E9 + i % 16));
+			return result;
+		}
+
+		struct FTypeNameSubject {};
+	}
+
+	void RunText(FBenchmarkContext& context)
+	{
+		const FString name = TEXT_"Bob";
+		context.MeasureEach(TEXT_"_FMT ordered", TEXT_"2 arguments", Operations, [&](int32 i)
+		{
+			DoNotOptimize((TEXT_"Hi {0}, your number is {1}" _FMT(name, i)).Len());
+		});
+		context.MeasureEach(TEXT_"_FMT named", TEXT_"2 arguments", Operations, [&](int32 i)
+		{
+			DoNotOptimize((TEXT_"Hi {Name}, your number is {Number}" _FMT((Name, name)(Number, i))).Len());
+		});
+		context.MeasureEach(TEXT_"FString::Format", TEXT_"2 arguments", Operations, [&](int32 i)
+		{
+			DoNotOptimize(FString::Format(TEXT_"Hi {0}, your number is {1}", { name, i }).Len());
+		});
+		context.MeasureEach(TEXT_"DynamicPrintf", TEXT_"2 arguments", Operations, [&](int32 i)
+		{
+			DoNotOptimize(DynamicPrintf(TEXT_"Hi %s, your number is %d", *name, i).Len());
+		});
+		FString reused;
+		context.MeasureEach(TEXT_"DynamicPrintfTo", TEXT_"2 arguments, reused buffer", Operations, [&](int32 i)
+		{
+			reused.Reset();
+			DynamicPrintfTo(reused, TEXT_"Hi %s, your number is %d", *name, i);
+			DoNotOptimize(reused.Len());
+		});
+
+		const TArray<int32> range { 1, 2, 3, 4, 5, 6, 7, 8 };
+		context.MeasureEach(TEXT_"AsString", TEXT_"Range of 8 integers", Operations, [&](int32)
+		{
+			DoNotOptimize(AsString(range).Len());
+		});
+		const FVector vector(1, 2, 3);
+		context.MeasureEach(TEXT_"AsString", TEXT_"ToString-able", Operations, [&](int32)
+		{
+			DoNotOptimize(AsString(vector).Len());
+		});
+		context.MeasureEach(TEXT_"_FMT", TEXT_"Range of 8 integers", Operations, [&](int32)
+		{
+			DoNotOptimize((TEXT_"{0}" _FMT(range)).Len());
+		});
+
+		for (int32 size : { 16, 256, 4096 })
+		{
+			for (bool ascii : { true, false })
+			{
+				const FString input = MakeText(size, ascii);
+				const std::string std8 = StdConvert<ANSICHAR>(input);
+				const FString parameter = FString::Printf(TEXT_"%d characters, %s", size, ascii ? TEXT_"ASCII" : TEXT_"mixed");
+
+				context.MeasureEach(TEXT_"StdConvert", parameter, Operations / 10, [&](int32)
+				{
+					DoNotOptimize(StdConvert<UTF8CHAR>(input).size());
+				});
+				context.MeasureEach(TEXT_"UnrealConvert", parameter, Operations / 10, [&](int32)
+				{
+					DoNotOptimize(UnrealConvert(std8).Len());
+				});
+				context.MeasureEach(TEXT_"StringCast", parameter, Operations / 10, [&](int32)
+				{
+					DoNotOptimize(StringCast<UTF8CHAR>(*input, input.Len()).Length());
+				});
+
+				TInlineCharBuffer<UTF8CHAR> buffer;
+				context.MeasureEach(TEXT_"StdConvert into buffer", parameter, Operations / 10, [&](int32)
+				{
+					buffer.Reset();
+					StdConvert(FStringView(input), buffer);
+					DoNotOptimize(buffer.Num());
+				});
+				FString string;
+				context.MeasureEach(TEXT_"UnrealConvert into buffer", parameter, Operations / 10, [&](int32)
+				{
+					string.Reset();
+					UnrealConvert(std8, string);
+					DoNotOptimize(string.Len());
+				});
+			}
+		}
+
+		context.MeasureEach(TEXT_"TTypeName", TEXT_"", Operations, [&](int32)
+		{
+			DoNotOptimize(TTypeName<FTypeNameSubject>.Len());
+		});
+		context.MeasureEach(TEXT_"TTypeString", TEXT_"", Operations, [&](int32)
+		{
+			DoNotOptimize(TTypeString<FTypeNameSubject>().Len());
+		});
+		context.MeasureEach(TEXT_"TTypeFName", TEXT_"", Operations, [&](int32)
+		{
+			DoNotOptimize(TTypeFName<FTypeNameSubject>());
+		});
+
+		const std::string identifier = "Mcro_BenchmarkIdentifier";
+		context.MeasureEach(TEXT_"UnrealNameConvert", TEXT_"Cached", Operations, [&](int32)
+		{
+			DoNotOptimize(UnrealNameConvert(identifier));
+		});
+		context.MeasureEach(TEXT_"FName", TEXT_"Global name table", Operations, [&](int32)
+		{
+			DoNotOptimize(FName(static_cast<int32>(identifier.size()), identifier.data()));
+		});
+
+		const FString message = TEXT_"The quick brown fox jumps over the lazy dog";
+		context.MeasureEach(TEXT_"TInlineString", TEXT_"43 characters", Operations, [&](int32)
+		{
+			TInlineString<48> text(message);
+			DoNotOptimize(text.Len());
+		});
+		context.MeasureEach(TEXT_"FString copy", TEXT_"43 characters", Operations, [&](int32)
+		{
+			FString text = message;
+			DoNotOptimize(text.Len());
+		});
+	}
+}
@@ -0,0 +1,117 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Async/ParallelFor.h"
+#include "Mcro/Common.h"
+#include "Mcro/Threading/Channel.h"
+#include "Mcro/Threading/Snapshot.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+	using namespace Mcro::Threading;
+
+	namespace
+	{
+		constexpr int32 Operations = 100'000;
+
+		int32 GetThreadCount()
+		{
+			return FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+		}
+
+		template <typename Channel>
+		void MeasureChannel(FBenchmarkContext& context, const TCHAR* parameter, int32 messages)
+		{
+			Channel channel;
+			context.Measure(TEXT_"TChannel::Send+TryReceive", parameter, messages, [&]
+			{
+				for (int32 i = 0; i < messages; ++i) channel.Send(i);
+				int32 value = 0;
+				int64 sum = 0;
+				while (channel.TryReceive(value)) sum += value;
+				DoNotOptimize(sum);
+			});
+
+			const int32 threads = GetThreadCount();
+			const int32 messagesPerThread = messages / threads;
+			context.Measure(
+				TEXT_"TChannel::Send+Drain",
+				FString::Printf(TEXT_"%s, %d producers", parameter, threads),
+				messagesPerThread * threads,
+				[&]
+				{
+					ParallelFor(threads, [&](int32)
+					{
+						for (int32 i = 0; i < messagesPerThread; ++i) channel.Send(i);
+					});
+					DoNotOptimize(channel.Drain([](int32&&) {}));
+				}
+			);
+		}
+	}
+
+	void RunThreading(FBenchmarkContext& context)
+	{
+		TSnapshotStorage<TArray<int32>> snapshot(TArray<int32> { 1, 2, 3, 4, 5, 6, 7, 8 });
+		context.MeasureEach(TEXT_"TSnapshotStorage::Pin+Unpin", TEXT_"", Operations, [&](int32)
+		{
+			auto const* node = snapshot.Pin();
+			DoNotOptimize(node->Value->Num());
+			snapshot.Unpin(node);
+		});
+		context.MeasureEach(TEXT_"TSnapshotStorage::Read", TEXT_"8 integers", Operations, [&](int32)
+		{
+			DoNotOptimize(snapshot.Read().Num());
+		});
+		context.MeasureEach(TEXT_"TSnapshotStorage::Publish", TEXT_"8 integers", Operations, [&](int32 i)
+		{
+			snapshot.Publish(TArray<int32> { i, 2, 3, 4, 5, 6, 7, 8 });
+		});
+
+		const int32 threads = GetThreadCount();
+		context.Measure(
+			TEXT_"TSnapshotStorage::Pin+Unpin",
+			FString::Printf(TEXT_"%d threads", threads),
+			static_cast<int64>(Operations) * threads,
+			[&]
+			{
+				ParallelFor(threads, [&](int32)
+				{
+					int64 sum = 0;
+					for (int32 i = 0; i < Operations; ++i)
+					{
+						auto const* node = snapshot.Pin();
+						sum += node->Value->Num();
+						snapshot.Unpin(node);
+					}
+					DoNotOptimize(sum);
+				});
+			}
+		);
+
+		MeasureChannel<TChannel<int32>>(context, TEXT_"Unbounded", 10'000);
+		MeasureChannel<TChannel<int32, 16'384>>(context, TEXT_"Bounded", 10'000);
+
+		for (int32 tasks : { 1, 100 })
+		{
+			context.Measure(TEXT_"RunInThread", FString::Printf(TEXT_"AnyThread, %d tasks", tasks), tasks, [&]
+			{
+				std::atomic<int32> finished = 0;
+				for (int32 i = 0; i < tasks; ++i)
+					RunInThread(ENamedThreads::AnyThread, [&finished] { finished.fetch_add(1, std::memory_order_release); });
+				while (finished.load(std::memory_order_acquire) < tasks)
+					FPlatformProcess::YieldThread();
+			});
+		}
+	}
+}
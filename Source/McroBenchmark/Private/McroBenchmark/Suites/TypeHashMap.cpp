@@ -0,0 +1,60 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroBenchmark/Suites/Suites.h"
+#include "Mcro/Common.h"
+
+namespace Mcro::Benchmark::Suites
+{
+	using namespace Mcro::Common;
+
+	namespace
+	{
+		constexpr int32 Sizes[] { 16, 1'000, 100'000 };
+		constexpr int32 Lookups = 10'000;
+
+		// Spread like XXH3 type hashes
+		uint64 MakeKey(int32 i)
+		{
+			return Hash::HashBytes(&i, sizeof(i));
+		}
+	}
+
+	void RunTypeHashMap(FBenchmarkContext& context)
+	{
+		for (int32 size : Sizes)
+		{
+			const FString items = FString::Printf(TEXT_"%d items", size);
+			TTypeHashMap<int32> map;
+			TMap<uint64, int32> reference;
+			TArray<uint64> keys;
+			for (int32 i = 0; i < size; ++i)
+			{
+				keys.Add(MakeKey(i));
+				map.Add(keys.Last(), i);
+				reference.Add(keys.Last(), i);
+			}
+
+			context.Measure(TEXT_"TTypeHashMap::Find", items, Lookups, [&]
+			{
+				int64 sum = 0;
+				for (int32 i = 0; i < Lookups; ++i) sum += *map.Find(keys[i % size]);
+				DoNotOptimize(sum);
+			});
+			context.Measure(TEXT_"TMap::Find", items, Lookups, [&]
+			{
+				int64 sum = 0;
+				for (int32 i = 0; i < Lookups; ++i) sum += *reference.Find(keys[i % size]);
+				DoNotOptimize(sum);
+			});
+		}
+	}
+}
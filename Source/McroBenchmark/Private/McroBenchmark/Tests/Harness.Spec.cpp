@@ -0,0 +1,136 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "McroBenchmark/BenchmarkReport.h"
+#include "Mcro/TextMacros.h"
+
+#include <atomic>
+
+using namespace Mcro::Benchmark;
+
+DEFINE_SPEC(
+	FMcroBenchmarkHarness_Spec,
+	TEXT_"McroBenchmark.Harness",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::ProductFilter
+)
+END_DEFINE_SPEC(FMcroBenchmarkHarness_Spec)
+
+void FMcroBenchmarkHarness_Spec::Define()
+{
+	Describe(TEXT_"Statistics", [this]
+	{
+		It(TEXT_"should be robust against outliers", [this]
+		{
+			TArray<double> samples { 10, 12, 11, 10, 1000, 11, 12, 10, 11, 11 };
+			FBenchmarkStatistics statistics = ComputeStatistics(samples);
+			TestEqual(TEXT_"Samples", statistics.Samples, 10);
+			TestEqual(TEXT_"Outliers", statistics.Outliers, 1);
+			TestEqual(TEXT_"Median", statistics.Median, 11.0);
+			TestEqual(TEXT_"Median absolute deviation", statistics.MedianAbsoluteDeviation, 1.0);
+			TestEqual(TEXT_"Min", statistics.Min, 10.0);
+			TestEqual(TEXT_"Max", statistics.Max, 1000.0);
+			TestTrue(TEXT_"Mean excludes outliers", statistics.Mean < 12.0);
+		});
+
+		It(TEXT_"should handle empty and single samples", [this]
+		{
+			TestEqual(TEXT_"Empty", ComputeStatistics({}).Samples, 0);
+
+			TArray<double> single { 5 };
+			FBenchmarkStatistics statistics = ComputeStatistics(single);
+			TestEqual(TEXT_"Median", statistics.Median, 5.0);
+			TestEqual(TEXT_"Standard deviation", statistics.StandardDeviation, 0.0);
+		});
+	});
+
+	Describe(TEXT_"Context", [this]
+	{
+		It(TEXT_"should measure a batch", [this]
+		{
+			FBenchmarkContext context(TEXT_"Harness", {
+				.WarmupSeconds = 0,
+				.Samples = 5,
+				.MinSampleSeconds = 0.0001
+			});
+
+			int32 calls = 0;
+			FBenchmarkResult result = context.Measure(TEXT_"Increment", TEXT_"", 100, [&]
+			{
+				for (int32 i = 0; i < 100; ++i) DoNotOptimize(++calls);
+			});
+
+			TestEqual(TEXT_"Result is collected", context.GetResults().Num(), 1);
+			TestEqual(TEXT_"Suite", result.Suite, FString(TEXT_"Harness"));
+			TestEqual(TEXT_"Samples", result.Nanoseconds.Samples, 5);
+			TestTrue(TEXT_"Batches are repeated for each sample", calls >= 100 * (1 + 5 * result.BatchesPerSample));
+			TestTrue(TEXT_"Time is measured", result.Nanoseconds.Median >= 0);
+		});
+
+		It(TEXT_"should measure contended operations", [this]
+		{
+			FBenchmarkContext context(TEXT_"Harness", {
+				.WarmupSeconds = 0.01,
+				.ContentionSeconds = 0.05
+			});
+
+			std::atomic<int64> calls { 0 };
+			std::atomic<int32> threadMask { 0 };
+			FBenchmarkResult result = context.MeasureContended(TEXT_"Increment", TEXT_"", 4, [&](int32 thread, int64)
+			{
+				calls.fetch_add(1, std::memory_order_relaxed);
+				threadMask.fetch_or(1 << thread, std::memory_order_relaxed);
+			});
+
+			TestEqual(TEXT_"Threads", result.Threads, 4);
+			TestEqual(TEXT_"Every thread executed the operation", threadMask.load(), 0b1111);
+			TestTrue(TEXT_"Measured operations were executed", calls.load() >= result.OperationsPerBatch);
+			TestTrue(TEXT_"Throughput is measured", result.Throughput > 0);
+			TestTrue(TEXT_"Latency percentiles are ordered",
+				result.LatencyP50 >= 0
+				&& result.LatencyP50 <= result.LatencyP99
+				&& result.LatencyP99 <= result.LatencyP999
+			);
+			TestTrue(TEXT_"Fairness is within range", result.Fairness >= 0.25 && result.Fairness <= 1.0 + UE_DOUBLE_KINDA_SMALL_NUMBER);
+		});
+	});
+
+	Describe(TEXT_"Report", [this]
+	{
+		It(TEXT_"should serialize results", [this]
+		{
+			FBenchmarkReport report = FBenchmarkReport::Make(TEXT_"Test label");
+			report.Results.Add({
+				.Suite = TEXT_"Harness",
+				.Benchmark = TEXT_"Quoted \"benchmark\"",
+				.Parameter = TEXT_"1, 2"
+			});
+
+			FString json = report.ToJson();
+			TestTrue(TEXT_"JSON has the label", json.Contains(TEXT_"\"Test label\""));
+			TestTrue(TEXT_"JSON has results", json.Contains(TEXT_"\"Results\""));
+
+			TArray<FString> lines;
+			report.ToCsv().ParseIntoArrayLines(lines);
+			TestEqual(TEXT_"CSV has a header and a row", lines.Num(), 2);
+			TestTrue(TEXT_"CSV quotes are escaped", lines[1].Contains(TEXT_"\"Quoted \"\"benchmark\"\"\""));
+
+			report.ToCsv(false).ParseIntoArrayLines(lines);
+			TestEqual(TEXT_"CSV without header", lines.Num(), 1);
+
+			TestTrue(TEXT_"CSV format from extension", GetBenchmarkReportFormat(TEXT_"Results.CSV") == EBenchmarkReportFormat::Csv);
+			TestTrue(TEXT_"JSON format by default", GetBenchmarkReportFormat(TEXT_"Results.json") == EBenchmarkReportFormat::Json);
+		});
+	});
+}
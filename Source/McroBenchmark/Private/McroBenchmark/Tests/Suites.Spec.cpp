@@ -0,0 +1,56 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "McroBenchmark/BenchmarkSuite.h"
+#include "Mcro/TextMacros.h"
+
+using namespace Mcro::Benchmark;
+
+/**
+ *	Run every registered benchmark suite as a separate test. Results are reported in the test log and saved into the
+ *	transient directory of automation tests, so test runs don't pollute the history kept by the McroBenchmark
+ *	commandlet in `Saved/McroBenchmark/Benchmarks.csv`.
+ */
+DEFINE_SPEC(
+	FMcroBenchmarkSuites_Spec,
+	TEXT_"McroBenchmark.Suites",
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::PerfFilter
+)
+END_DEFINE_SPEC(FMcroBenchmarkSuites_Spec)
+
+void FMcroBenchmarkSuites_Spec::Define()
+{
+	for (IBenchmarkSuite* suite : FindBenchmarkSuites())
+	{
+		const FString name = suite->GetName();
+		It(FString::Printf(TEXT_"should measure %s", *name), [this, name]
+		{
+			FBenchmarkReport report = RunBenchmarkSuites({ name });
+			for (FBenchmarkResult const& result : report.Results)
+			{
+				AddInfo(FString::Printf(
+					TEXT_"%s [%s]: %.2f ns/op (MAD %.1f%%), %.3f allocations/op",
+					*result.Benchmark, *result.Parameter, result.Nanoseconds.Median,
+					result.Nanoseconds.GetRelativeDeviation() * 100.0, result.AllocationsPerOp
+				));
+			}
+			TestFalse(TEXT_"Suite produced results", report.Results.IsEmpty());
+
+			auto saved = report.Save(FPaths::AutomationTransientDir() / TEXT_"McroBenchmark" / TEXT_"Benchmarks.csv");
+			TestFalse(TEXT_"Report is saved", saved.HasError());
+		});
+	}
+}
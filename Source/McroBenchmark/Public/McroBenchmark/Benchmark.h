@@ -0,0 +1,246 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	@brief
+ *	A micro-benchmark harness for MCRO and its dependants. A benchmark is a function running a batch of operations,
+ *	which is warmed up then repeated until a sample lasts long enough to be timed reliably. Many samples are taken and
+ *	summarized with robust statistics, so results can be compared across versions. For example:
+ *	@code
+ *	using namespace Mcro::Benchmark;
+ *	void RunMyBenchmarks(FBenchmarkContext& context)
+ *	{
+ *		TArray<int32> values = ...;
+ *		context.Measure(TEXT_"Sum", TEXT_"1000 items", values.Num(), [&]
+ *		{
+ *			int64 sum = 0;
+ *			for (int32 value : values) sum += value;
+ *			DoNotOptimize(sum);
+ *		});
+ *	}
+ *	@endcode
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <type_traits>
+
+namespace Mcro::Benchmark
+{
+	/** @brief Settings of how benchmarks are measured */
+	struct FBenchmarkSettings
+	{
+		/** @brief Run the batch at least for this long before measuring, to warm up caches and branch predictors */
+		double WarmupSeconds = 0.05;
+
+		/** @brief Run the batch at least this many times before measuring, regardless of WarmupSeconds */
+		int32 MinWarmupIterations = 1;
+
+		/** @brief The number of samples taken for each benchmark */
+		int32 Samples = 30;
+
+		/**
+		 *	@brief
+		 *	A sample repeats the batch until it takes at least this long, so tiny batches are not dominated by the
+		 *	resolution of the timer.
+		 */
+		double MinSampleSeconds = 0.002;
+
+		/** @brief Stop taking samples when a single benchmark takes longer than this, but take at least 3 samples */
+		double MaxSecondsPerBenchmark = 5;
+
+		/** @brief How long the threads of a contention benchmark execute the operation after they've warmed up */
+		double ContentionSeconds = 0.5;
+
+		/** @brief Count heap allocations during the samples, when the build tracks them */
+		bool bCountAllocations = true;
+
+		/** @brief Count retired instructions and CPU cycles of the measuring thread, when the platform exposes them */
+		bool bCountHardware = true;
+	};
+
+	/**
+	 *	@brief
+	 *	Summary of benchmark samples. Samples outside of the Tukey fences (1.5 times the interquartile range away
+	 *	from the quartiles) are counted as outliers, and they're excluded from the mean and the standard deviation.
+	 *	Median and median absolute deviation are computed from all samples.
+	 */
+	struct FBenchmarkStatistics
+	{
+		double Median = 0;
+		double MedianAbsoluteDeviation = 0;
+		double Mean = 0;
+		double StandardDeviation = 0;
+		double Min = 0;
+		double Max = 0;
+		int32 Samples = 0;
+		int32 Outliers = 0;
+
+		/** @returns The median absolute deviation relative to the median, a measure of how noisy the benchmark was */
+		double GetRelativeDeviation() const { return Median > 0 ? MedianAbsoluteDeviation / Median : 0; }
+	};
+
+	/**
+	 *	@brief  Summarize samples with outlier rejection
+	 *	@param samples  Sorted in-place
+	 */
+	MCROBENCHMARK_API FBenchmarkStatistics ComputeStatistics(TArrayView<double> samples);
+
+	/** @brief Result of a single benchmark */
+	struct FBenchmarkResult
+	{
+		FString Suite;
+		FString Benchmark;
+		FString Parameter;
+
+		/** @brief Number of operations a single batch does */
+		int64 OperationsPerBatch = 1;
+
+		/** @brief Number of batches a single sample has repeated */
+		int64 BatchesPerSample = 1;
+
+		/** @brief Wall time of a single operation in nanoseconds */
+		FBenchmarkStatistics Nanoseconds;
+
+		/** @brief Heap allocations on average per operation on all threads, or negative if it can't be measured */
+		double AllocationsPerOp = -1;
+
+		/** @brief Retired instructions of the measuring thread per operation, or negative if it can't be measured */
+		double InstructionsPerOp = -1;
+
+		/** @brief CPU cycles of the measuring thread per operation, or negative if it can't be measured */
+		double CyclesPerOp = -1;
+
+		/** @brief Number of threads executing the operation concurrently */
+		int32 Threads = 1;
+
+		/** @brief Operations per second summed over all threads */
+		double Throughput = 0;
+
+		/** @brief Percentiles of the latency of a single operation in nanoseconds, or negative if it's not measured */
+		double LatencyP50 = -1;
+		double LatencyP99 = -1;
+		double LatencyP999 = -1;
+
+		/**
+		 *	@brief
+		 *	Jain's fairness index of the operations completed by each thread. It's 1 when every thread completed the
+		 *	same amount, and 1 / Threads when a single thread did all the work. Negative if it's not measured.
+		 */
+		double Fairness = -1;
+	};
+
+	namespace Detail
+	{
+		MCROBENCHMARK_API void UseCharPointer(char const volatile*);
+	}
+
+	/** @brief Prevent the optimizer from removing the computation of a value which is otherwise unused */
+	template <typename T>
+	FORCEINLINE void DoNotOptimize(T const& value)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		Detail::UseCharPointer(&reinterpret_cast<char const volatile&>(value));
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	/**
+	 *	@brief
+	 *	Measures the benchmarks of a suite and collects their results. It's given to IBenchmarkSuite::Run, but it can
+	 *	also be used on its own.
+	 */
+	class MCROBENCHMARK_API FBenchmarkContext
+	{
+	public:
+		FBenchmarkContext(FString const& suite, FBenchmarkSettings const& settings = {});
+
+		/**
+		 *	@brief  Measure a function running a batch of operations
+		 *	@param   benchmark  Name of the measured operation
+		 *	@param   parameter  Describes the variant of the benchmark, like input size or policy. It may be empty
+		 *	@param  operations  The number of operations a single call to batch does
+		 *	@param       batch  The measured function. Its results should be passed to DoNotOptimize
+		 *	@return  The result which is also added to the results of this context
+		 */
+		FBenchmarkResult Measure(FStringView benchmark, FStringView parameter, int64 operations, TFunctionRef<void()> batch);
+
+		/**
+		 *	@brief
+		 *	Measure a batch which consumes its input, like reconciling a widget with a new state. Each sample calls
+		 *	`setup` without timing it, then calls `batch` exactly once. There's no warmup, so samples should be
+		 *	expensive enough on their own to be timed reliably.
+		 *
+		 *	@param     samples  The number of samples to take, it replaces `FBenchmarkSettings::Samples` for this benchmark
+		 *	@param       setup  Prepares the input of the next sample
+		 *	@param       batch  The measured function. Its results should be passed to DoNotOptimize
+		 */
+		FBenchmarkResult MeasureWithSetup(
+			FStringView benchmark,
+			FStringView parameter,
+			int64 operations,
+			int32 samples,
+			TFunctionRef<void()> setup,
+			TFunctionRef<void()> batch
+		);
+
+		/**
+		 *	@brief
+		 *	Measure an operation executed concurrently by dedicated threads, for `ContentionSeconds` after they've been
+		 *	warmed up for `WarmupSeconds`. Warmup only starts counting once every thread executed the operation. The
+		 *	latency of every operation is recorded with the timestamp counter of the CPU, so throughput and latency
+		 *	percentiles include the overhead of reading it (a couple of nanoseconds). Nanoseconds of the result
+		 *	summarize the average time of an operation on each thread, and OperationsPerBatch is the total number of
+		 *	measured operations.
+		 *
+		 *	@param    threads  The number of threads executing the operation at the same time
+		 *	@param  operation  Called with the index of the thread and the index of the operation within that thread.
+		 *	                   It's called from multiple threads at the same time.
+		 */
+		FBenchmarkResult MeasureContended(
+			FStringView benchmark,
+			FStringView parameter,
+			int32 threads,
+			TFunctionRef<void(int32 thread, int64 iteration)> operation
+		);
+
+		/**
+		 *	@brief
+		 *	Measure a function doing a single operation, called with the index of the operation within the batch for
+		 *	this many times.
+		 */
+		template <typename Function>
+		requires std::is_invocable_v<Function, int32>
+		FBenchmarkResult MeasureEach(FStringView benchmark, FStringView parameter, int32 operations, Function&& function)
+		{
+			return Measure(benchmark, parameter, operations, [&]
+			{
+				for (int32 i = 0; i < operations; ++i) function(i);
+			});
+		}
+
+		FString const& GetSuite() const { return Suite; }
+		FBenchmarkSettings const& GetSettings() const { return Settings; }
+		TArray<FBenchmarkResult> const& GetResults() const { return Results; }
+
+		/** @brief Take the results collected so far */
+		TArray<FBenchmarkResult> ConsumeResults() { return MoveTemp(Results); }
+
+	private:
+		FString Suite;
+		FBenchmarkSettings Settings;
+		TArray<FBenchmarkResult> Results;
+	};
+}
@@ -0,0 +1,81 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Error.h"
+#include "McroBenchmark/Benchmark.h"
+
+namespace Mcro::Benchmark
+{
+	using namespace Mcro::Error;
+
+	/** @brief File formats of FBenchmarkReport */
+	enum class EBenchmarkReportFormat
+	{
+		/** @brief A single JSON document containing the environment and all results */
+		Json,
+
+		/**
+		 *	@brief
+		 *	A row for each result, also containing the environment. Rows are appended to existing files, so runs of
+		 *	different versions can accumulate in the same table.
+		 */
+		Csv
+	};
+
+	/** @returns The report format matching the extension of given file path, Json unless it's a .csv file */
+	MCROBENCHMARK_API EBenchmarkReportFormat GetBenchmarkReportFormat(FString const& path);
+
+	/** @brief Results of benchmarks together with the environment they were measured in */
+	struct MCROBENCHMARK_API FBenchmarkReport
+	{
+		/** @brief User provided identifier of the run, like a commit hash or a branch name */
+		FString Label;
+
+		/** @brief Version of the MCRO plugin */
+		FString PluginVersion;
+
+		FString EngineVersion;
+		FString Platform;
+		FString Configuration;
+		FString Cpu;
+		int32 Cores = 0;
+
+		/** @brief The ISPC target selected for this CPU */
+		FString IspcTarget;
+
+		/** @brief Start of the run in UTC */
+		FDateTime Time;
+
+		FBenchmarkSettings Settings;
+		TArray<FBenchmarkResult> Results;
+
+		/** @brief Create an empty report filled with the current environment */
+		static FBenchmarkReport Make(FString const& label = {}, FBenchmarkSettings const& settings = {});
+
+		FString ToJson() const;
+
+		/** @param withHeader  Start the table with a line of column names */
+		FString ToCsv(bool withHeader = true) const;
+
+		/**
+		 *	@brief
+		 *	Save the report to given file. CSV reports are appended to existing files without repeating the header,
+		 *	JSON reports replace existing files.
+		 */
+		FCanFail Save(FString const& path, EBenchmarkReportFormat format) const;
+
+		/** @brief Save the report to given file in the format deduced from its extension */
+		FCanFail Save(FString const& path) const;
+	};
+}
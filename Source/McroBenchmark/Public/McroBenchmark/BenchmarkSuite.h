@@ -0,0 +1,82 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/AutoModularFeature.h"
+#include "McroBenchmark/Benchmark.h"
+#include "McroBenchmark/BenchmarkReport.h"
+
+namespace Mcro::Benchmark
+{
+	using namespace Mcro::AutoModularFeature;
+
+	/**
+	 *	@brief
+	 *	A named group of benchmarks, registered as an auto modular feature. Suites of any module are run by the
+	 *	`McroBenchmark` commandlet and the `McroBenchmark.Suites` automation tests. Use FBenchmarkSuite for suites
+	 *	defined by a single function.
+	 */
+	class MCROBENCHMARK_API IBenchmarkSuite : public TAutoModularFeature<IBenchmarkSuite>
+	{
+	public:
+		virtual FString GetName() const = 0;
+
+		/** @brief Measure all benchmarks of this suite into given context */
+		virtual void Run(FBenchmarkContext& context) = 0;
+	};
+
+	/**
+	 *	@brief
+	 *	A benchmark suite defined by a function. It's registered while it's alive, so store it in a module or as
+	 *	a `TModuleBoundObject`:
+	 *	@code
+	 *	TModuleBoundObject<FMyModule, FBenchmarkSuite> GMySuite {
+	 *		.Create = [] { return new FBenchmarkSuite(TEXT_"MySuite", &RunMyBenchmarks); }
+	 *	};
+	 *	@endcode
+	 */
+	class FBenchmarkSuite : public IBenchmarkSuite, public IFeatureImplementation
+	{
+	public:
+		FBenchmarkSuite(FString const& name, TFunction<void(FBenchmarkContext&)>&& run)
+			: Name(name)
+			, RunFunction(MoveTemp(run))
+		{
+			Register();
+		}
+
+		virtual FString GetName() const override { return Name; }
+		virtual void Run(FBenchmarkContext& context) override { RunFunction(context); }
+
+	private:
+		FString Name;
+		TFunction<void(FBenchmarkContext&)> RunFunction;
+	};
+
+	/**
+	 *	@brief  Get registered suites sorted by their name
+	 *	@param names  Only get suites matching these names (case-insensitive). Get all suites when it's empty.
+	 */
+	MCROBENCHMARK_API TArray<IBenchmarkSuite*> FindBenchmarkSuites(TConstArrayView<FString> names = {});
+
+	/**
+	 *	@brief  Run registered suites into a single report
+	 *	@param    names  Only run suites matching these names (case-insensitive). Run all suites when it's empty.
+	 *	@param    label  Identifier of this run stored in the report
+	 */
+	MCROBENCHMARK_API FBenchmarkReport RunBenchmarkSuites(
+		TConstArrayView<FString> names = {},
+		FBenchmarkSettings const& settings = {},
+		FString const& label = {}
+	);
+}
@@ -0,0 +1,71 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ * @file
+ * Unreal's ISPC toolchain compiles every `.ispc` source of a module for multiple instruction sets on platforms which
+ * have more than one, and links them together with a dispatch function selecting the best one the CPU supports at
+ * runtime. It doesn't tell the module though which instruction sets it has compiled for, these utilities make that
+ * known to C++ code.
+ */
+
+using System.Collections.Generic;
+using System.Linq;
+using UnrealBuildTool;
+
+namespace McroBuild;
+
+/// <summary>
+/// Utilities for modules containing ISPC sources
+/// </summary>
+public static partial class ModuleRuleExtensions
+{
+	/// <summary>
+	/// The ISPC targets `.ispc` sources are compiled for with the current platform and architecture, in the order of
+	/// preference of the ISPC dispatcher. This follows the defaults of Unreal's ISPC toolchain, limited by the
+	/// `MinCpuArchX64` of the target, as there's no need for targets below the minimum supported instruction set.
+	/// </summary>
+	/// <returns>Pairs of the ISPC target name and the matching `Mcro::ISPC::EIspcTarget` enumerator name</returns>
+	public static IEnumerable<(string Target, string Enum)> GetIspcTargets(this ModuleRules self)
+	{
+		if (self.Target.Architecture == UnrealArch.Arm64)
+			return new[] { ("neon", "NEON") };
+
+		(string Target, string Enum)[] x64Targets = self.Target.Platform == UnrealTargetPlatform.Win64
+			|| self.Target.Platform == UnrealTargetPlatform.Linux
+				? new[] { ("avx512skx-i32x8", "AVX512SKX"), ("avx2", "AVX2"), ("avx", "AVX"), ("sse4", "SSE4") }
+				: new[] { ("avx2", "AVX2"), ("sse4", "SSE4") };
+
+		var minimum = self.Target.MinCpuArchX64 switch
+		{
+			MinimumCpuArchitectureX64.AVX512 => "AVX512SKX",
+			MinimumCpuArchitectureX64.AVX2 => "AVX2",
+			MinimumCpuArchitectureX64.AVX => "AVX",
+			_ => null
+		};
+		if (minimum == null || x64Targets.All(t => t.Enum != minimum))
+			return x64Targets;
+		
+		return x64Targets.TakeWhile(t => t.Enum != minimum).Append(x64Targets.First(t => t.Enum == minimum));
+	}
+	
+	/// <summary>
+	/// Propagate the ISPC targets of the current build to C++ source via the preprocessor definition
+	/// `*_ISPC_TARGETS`, where `*` is the capitalized module name. Its value is a comma separated list of
+	/// `Mcro::ISPC::EIspcTarget` enumerator names, McroISPC uses it to tell which one is selected at runtime.
+	/// </summary>
+	/// <param name="self"></param>
+	public static void DefineIspcTargets(this ModuleRules self)
+	{
+		var targets = string.Join(',', self.GetIspcTargets().Select(t => t.Enum));
+		self.PrivateDefinitions.Add($"{self.GetBaseModuleName().ToUpper()}_ISPC_TARGETS={targets}");
+	}
+}
@@ -19,15 +19,20 @@ public class McroISPC : ModuleRules
 {
 	public McroISPC(ReadOnlyTargetRules Target) : base(Target)
 	{
+		// C++23
 		bUseUnity = false;
+		CppStandard = CppStandardVersion.Latest;
 		
 		PublicDependencyModuleNames.AddRange(new[] {
 			"Core",
+			"Mcro",
 		});
 			
 		
 		PrivateDependencyModuleNames.AddRange(new[] {
 			"CoreUObject",
 		});
+
+		this.DefineIspcTargets();
 	}
 }
@@ -10,7 +10,29 @@
  */
 
 #include "Modules/ModuleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "McroISPC/FrameArena.h"
 
-class FMcroISPCModule : public IModuleInterface {};
+class FMcroISPCModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		// End of frame is the sync point where ISPC work of the frame is expected to be done. This also applies
+		// pending capacity changes of the arena, so it's called even when the arena is disabled.
+		OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddLambda([]
+		{
+			Mcro::ISPC::ResetFrameArena();
+		});
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+	}
+
+private:
+	FDelegateHandle OnEndFrameHandle;
+};
 
 IMPLEMENT_MODULE(FMcroISPCModule, McroISPC);
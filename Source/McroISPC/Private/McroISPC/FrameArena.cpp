@@ -0,0 +1,182 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroISPC/FrameArena.h"
+
+#include <atomic>
+
+namespace Mcro::ISPC
+{
+	namespace
+	{
+		/** @brief Set in LiveGroups while the arena is being reset, task groups cannot acquire the arena then. */
+		constexpr uint64 ResettingFlag = 1ull << 63;
+
+		struct FFrameArenaState
+		{
+			uint8* Memory = nullptr;
+			uint64 Capacity = 0;
+			uint64 PendingCapacity = 0;
+			FFrameArenaMemory Source;
+			FFrameArenaMemory PendingSource;
+
+			std::atomic<uint64> Offset { 0 };
+			std::atomic<uint64> LiveGroups { 0 };
+			std::atomic<uint64> HighWaterMark { 0 };
+			std::atomic<uint64> LastFrameHighWaterMark { 0 };
+			std::atomic<uint64> Overflows { 0 };
+			std::atomic<uint64> DeferredResets { 0 };
+			std::atomic<bool> Enabled { false };
+
+			FCriticalSection ConfigLock;
+		};
+
+		FFrameArenaState& GetState()
+		{
+			static FFrameArenaState state;
+			return state;
+		}
+
+		void* AllocateArenaMemory(FFrameArenaMemory const& source, uint64 size)
+		{
+			return source.Allocate
+				? source.Allocate(size)
+				: FMemory::Malloc(size, PLATFORM_CACHE_LINE_SIZE);
+		}
+
+		void FreeArenaMemory(FFrameArenaMemory const& source, void* memory, uint64 size)
+		{
+			if (source.Free) source.Free(memory, size);
+			else FMemory::Free(memory);
+		}
+
+		void UpdateMax(std::atomic<uint64>& target, uint64 value)
+		{
+			uint64 current = target.load(std::memory_order_relaxed);
+			while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+		}
+	}
+
+	void EnableFrameArena(uint64 capacity)
+	{
+		auto& state = GetState();
+		{
+			FScopeLock lock(&state.ConfigLock);
+			state.PendingCapacity = capacity;
+		}
+		ResetFrameArena();
+	}
+
+	void SetFrameArenaMemory(FFrameArenaMemory const& memory)
+	{
+		auto& state = GetState();
+		FScopeLock lock(&state.ConfigLock);
+		state.PendingSource = memory;
+	}
+
+	void DisableFrameArena()
+	{
+		EnableFrameArena(0);
+	}
+
+	bool IsFrameArenaEnabled()
+	{
+		auto& state = GetState();
+		FScopeLock lock(&state.ConfigLock);
+		return state.PendingCapacity > 0;
+	}
+
+	bool ResetFrameArena()
+	{
+		auto& state = GetState();
+		uint64 noLiveGroups = 0;
+		if (!state.LiveGroups.compare_exchange_strong(noLiveGroups, ResettingFlag, std::memory_order_acquire))
+		{
+			state.DeferredResets.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		// From here on no task group can acquire the arena until the flag is cleared
+		uint64 used = state.Offset.load(std::memory_order_relaxed);
+		state.LastFrameHighWaterMark.store(used, std::memory_order_relaxed);
+		UpdateMax(state.HighWaterMark, used);
+		state.Offset.store(0, std::memory_order_relaxed);
+		{
+			FScopeLock lock(&state.ConfigLock);
+			const bool sourceChanged = state.PendingSource.Allocate != state.Source.Allocate
+				|| state.PendingSource.Free != state.Source.Free;
+
+			if (state.PendingCapacity != state.Capacity || sourceChanged)
+			{
+				if (state.Memory) FreeArenaMemory(state.Source, state.Memory, state.Capacity);
+				state.Source = state.PendingSource;
+				state.Memory = state.PendingCapacity > 0
+					? static_cast<uint8*>(AllocateArenaMemory(state.Source, state.PendingCapacity))
+					: nullptr;
+				state.Capacity = state.Memory ? state.PendingCapacity : 0;
+				state.HighWaterMark.store(0, std::memory_order_relaxed);
+			}
+			state.Enabled.store(state.Capacity > 0, std::memory_order_relaxed);
+		}
+		// Task groups which tried to acquire meanwhile are backing off their increment concurrently
+		state.LiveGroups.fetch_sub(ResettingFlag, std::memory_order_release);
+		return true;
+	}
+
+	FFrameArenaStats GetFrameArenaStats()
+	{
+		auto& state = GetState();
+		FScopeLock lock(&state.ConfigLock);
+		return {
+			.Capacity = state.Capacity,
+			.Used = FMath::Min(state.Offset.load(std::memory_order_relaxed), state.Capacity),
+			.LastFrameHighWaterMark = state.LastFrameHighWaterMark.load(std::memory_order_relaxed),
+			.HighWaterMark = state.HighWaterMark.load(std::memory_order_relaxed),
+			.Overflows = state.Overflows.load(std::memory_order_relaxed),
+			.DeferredResets = state.DeferredResets.load(std::memory_order_relaxed),
+		};
+	}
+
+	bool Detail::AcquireFrameArena()
+	{
+		auto& state = GetState();
+		if (!state.Enabled.load(std::memory_order_relaxed)) return false;
+
+		uint64 previous = state.LiveGroups.fetch_add(1, std::memory_order_acquire);
+		if ((previous & ResettingFlag) || !state.Enabled.load(std::memory_order_relaxed))
+		{
+			state.LiveGroups.fetch_sub(1, std::memory_order_relaxed);
+			return false;
+		}
+		return true;
+	}
+
+	void Detail::ReleaseFrameArena()
+	{
+		GetState().LiveGroups.fetch_sub(1, std::memory_order_release);
+	}
+
+	void* Detail::AllocFromFrameArena(int64 size, int32 alignment)
+	{
+		auto& state = GetState();
+		if (!state.Memory) return nullptr;
+
+		// Reserve the worst case padding, this keeps the bump a single atomic add
+		uint64 reserved = static_cast<uint64>(size) + FMath::Max(alignment, 1) - 1;
+		uint64 offset = state.Offset.fetch_add(reserved, std::memory_order_relaxed);
+		if (offset + reserved > state.Capacity)
+		{
+			state.Overflows.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		return Align(state.Memory + offset, FMath::Max(alignment, 1));
+	}
+}
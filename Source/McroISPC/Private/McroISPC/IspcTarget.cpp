@@ -0,0 +1,152 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroISPC/IspcTarget.h"
+
+#if PLATFORM_CPU_X86_FAMILY && defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#elif PLATFORM_CPU_X86_FAMILY
+#include <cpuid.h>
+#endif
+
+// Defined by the module rules via McroBuild DefineIspcTargets, this is only a fallback with the toolchain defaults
+#ifndef MCROISPC_ISPC_TARGETS
+#define MCROISPC_ISPC_TARGETS AVX512SKX, AVX2, AVX, SSE4
+#endif
+
+namespace Mcro::ISPC
+{
+	namespace
+	{
+		using enum EIspcTarget;
+
+#if PLATFORM_CPU_ARM_FAMILY
+		// ISPC only has NEON targets on ARM, and module rules of multi-architecture builds may describe another slice
+		constexpr EIspcTarget GCompiledTargets[] { NEON };
+#else
+		constexpr EIspcTarget GCompiledTargets[] { MCROISPC_ISPC_TARGETS };
+#endif
+
+		struct FCpuFeatures
+		{
+			bool SSE4 = false;
+			bool AVX = false;
+			bool AVX2 = false;
+			bool AVX512SKX = false;
+		};
+
+#if PLATFORM_CPU_X86_FAMILY
+		void Cpuid(uint32 (&registers)[4], uint32 leaf, uint32 subLeaf)
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			int32 result[4];
+			__cpuidex(result, leaf, subLeaf);
+			for (int32 i = 0; i < 4; ++i)
+				registers[i] = static_cast<uint32>(result[i]);
+#else
+			__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+		}
+
+		uint64 ReadXcr0()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			return _xgetbv(0);
+#else
+			uint32 low, high;
+			__asm__ volatile ("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+			return (static_cast<uint64>(high) << 32) | low;
+#endif
+		}
+#endif
+
+		/** @brief The same checks as the ones of the ISPC dispatcher, including the OS saving the vector registers */
+		FCpuFeatures DetectCpuFeatures()
+		{
+			FCpuFeatures result;
+#if PLATFORM_CPU_X86_FAMILY
+			uint32 leaf0[4], leaf1[4], leaf7[4] {};
+			Cpuid(leaf0, 0, 0);
+			Cpuid(leaf1, 1, 0);
+			if (leaf0[0] >= 7) Cpuid(leaf7, 7, 0);
+
+			auto hasBits = [](uint32 value, uint32 bits) { return (value & bits) == bits; };
+			const uint32 ecx1 = leaf1[2];
+			const uint32 ebx7 = leaf7[1];
+			const uint64 xcr0 = hasBits(ecx1, 1u << 27) ? ReadXcr0() : 0;
+
+			// SSE4.1, SSE4.2
+			result.SSE4 = hasBits(ecx1, (1u << 19) | (1u << 20));
+			// AVX with YMM state enabled by the OS
+			result.AVX = result.SSE4 && hasBits(ecx1, 1u << 28) && (xcr0 & 0x6) == 0x6;
+			// AVX2, FMA, F16C
+			result.AVX2 = result.AVX && hasBits(ebx7, 1u << 5) && hasBits(ecx1, (1u << 12) | (1u << 29));
+			// AVX-512 F, DQ, CD, BW, VL with opmask and ZMM state enabled by the OS
+			result.AVX512SKX = result.AVX2
+				&& hasBits(ebx7, (1u << 16) | (1u << 17) | (1u << 28) | (1u << 30) | (1u << 31))
+				&& (xcr0 & 0xE6) == 0xE6;
+#endif
+			return result;
+		}
+
+		FCpuFeatures const& GetCpuFeatures()
+		{
+			static const FCpuFeatures features = DetectCpuFeatures();
+			return features;
+		}
+	}
+
+	TConstArrayView<EIspcTarget> GetCompiledIspcTargets()
+	{
+		return GCompiledTargets;
+	}
+
+	bool IsIspcTargetSupported(EIspcTarget target)
+	{
+		auto const& features = GetCpuFeatures();
+		switch (target)
+		{
+		case SSE4:      return features.SSE4;
+		case AVX:       return features.AVX;
+		case AVX2:      return features.AVX2;
+		case AVX512SKX: return features.AVX512SKX;
+		case NEON:      return PLATFORM_CPU_ARM_FAMILY;
+		default:        return false;
+		}
+	}
+
+	EIspcTarget GetIspcTarget()
+	{
+		static const EIspcTarget selected = []
+		{
+			for (EIspcTarget target : GCompiledTargets)
+			{
+				if (IsIspcTargetSupported(target))
+					return target;
+			}
+			return Unknown;
+		}();
+		return selected;
+	}
+
+	const TCHAR* GetIspcTargetName(EIspcTarget target)
+	{
+		switch (target)
+		{
+		case SSE4:      return TEXT("sse4");
+		case AVX:       return TEXT("avx");
+		case AVX2:      return TEXT("avx2");
+		case AVX512SKX: return TEXT("avx512skx-i32x8");
+		case NEON:      return TEXT("neon");
+		default:        return TEXT("unknown");
+		}
+	}
+}
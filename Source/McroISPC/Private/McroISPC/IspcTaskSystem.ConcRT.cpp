@@ -0,0 +1,20 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+// Microsoft Concurrency Runtime
+
+#include "HAL/Platform.h"
+
+#if PLATFORM_WINDOWS
+#define ISPC_USE_CONCRT
+#define ISPC_TASK_SYSTEM ConcRT
+#include "IspcTaskSystem.inl"
+#endif
@@ -0,0 +1,20 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+// Apple Grand Central Dispatch
+
+#include "HAL/Platform.h"
+
+#if PLATFORM_MAC || PLATFORM_IOS
+#define ISPC_USE_GCD
+#define ISPC_TASK_SYSTEM GCD
+#include "IspcTaskSystem.inl"
+#endif
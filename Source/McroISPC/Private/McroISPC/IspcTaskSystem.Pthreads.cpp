@@ -0,0 +1,20 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+// The original pthreads task system of ISPC with a global task queue
+
+#include "HAL/Platform.h"
+
+#if PLATFORM_LINUX || PLATFORM_MAC
+#define ISPC_USE_PTHREADS
+#define ISPC_TASK_SYSTEM Pthreads
+#include "IspcTaskSystem.inl"
+#endif
@@ -0,0 +1,16 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+// Runs ISPC tasks on the worker threads of the engine
+
+#define ISPC_USE_UE_TASKS
+#define ISPC_TASK_SYSTEM UETasks
+#include "IspcTaskSystem.inl"
@@ -0,0 +1,16 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+// Dedicated worker threads stealing task ranges from each other
+
+#define ISPC_USE_PTHREADS_WORK_STEALING
+#define ISPC_TASK_SYSTEM WorkStealing
+#include "IspcTaskSystem.inl"
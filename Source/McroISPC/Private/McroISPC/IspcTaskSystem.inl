@@ -0,0 +1,2075 @@
+/*
+  Copyright (c) 2011-2023, Intel Corporation
+
+  SPDX-License-Identifier: BSD-3-Clause
+*/
+
+/*
+  This file implements simple task systems that provide the three
+  entrypoints used by ispc-generated to code to handle 'launch' and 'sync'
+  statements in ispc programs.  See the section "Task Parallelism: Language
+  Syntax" in the ispc documentation for information about using task
+  parallelism in ispc programs, and see the section "Task Parallelism:
+  Runtime Requirements" for information about the task-related entrypoints
+  that are implemented here.
+
+  There are several task systems in this file, built using:
+    - Unreal Engine's task system (ISPC_USE_UE_TASKS)
+    - Microsoft's Concurrency Runtime (ISPC_USE_CONCRT)
+    - Apple's Grand Central Dispatch (ISPC_USE_GCD)
+    - bare pthreads (ISPC_USE_PTHREADS, ISPC_USE_PTHREADS_FULLY_SUBSCRIBED)
+    - work-stealing standard threads (ISPC_USE_PTHREADS_WORK_STEALING)
+    - TBB (ISPC_USE_TBB_TASK_GROUP, ISPC_USE_TBB_PARALLEL_FOR)
+    - OpenMP (ISPC_USE_OMP)
+    - HPX (ISPC_USE_HPX)
+
+  Inside MCRO this file is compiled once per task system: every IspcTaskSystem.*.cpp defines
+  one of the preprocessor symbols below and ISPC_TASK_SYSTEM, the namespace (inside
+  Mcro::ISPC::Detail) and name of the task system, then includes this file. Each of them
+  provides an FTaskSystemInterface and the extern "C" entrypoints in IspcParallelism.cpp
+  dispatch to the one selected at startup (see Mcro::ISPC::SetTaskSystem). Other task
+  systems can be compiled in the same way, given their dependencies are available.
+  Not all combinations of platform and task system are meaningful.
+  Here are the task systems that can be selected:
+
+#define ISPC_USE_UE_TASKS
+#define ISPC_USE_GCD
+#define ISPC_USE_CONCRT
+#define ISPC_USE_PTHREADS
+#define ISPC_USE_PTHREADS_FULLY_SUBSCRIBED
+#define ISPC_USE_PTHREADS_WORK_STEALING
+#define ISPC_USE_OMP
+#define ISPC_USE_TBB_TASK_GROUP
+#define ISPC_USE_TBB_PARALLEL_FOR
+
+  The ISPC_USE_PTHREADS_FULLY_SUBSCRIBED model (not supported by the MCRO dispatcher, its entrypoints
+  predate the 3D launch signature) essentially takes over the machine
+  by assigning one pthread to each hyper-thread, and then uses spinlocks and atomics
+  for task management.  This model is useful for KNC where tasks can take over
+  the machine, but less so when there are other tasks that need running on the machine.
+
+  Syncing is cooperative in every task system: while the tasks of a group are not all finished,
+  Sync() runs tasks of the same group which weren't started yet on the calling thread. The
+  ISPC_USE_PTHREADS and ISPC_USE_PTHREADS_WORK_STEALING models also run tasks of other groups
+  while there's nothing left to do from their own. This allows deeply
+  nested launches (like recursive sorting or tree building) without starving the thread pool.
+
+  The ISPC_USE_UE_TASKS model is the default inside MCRO. It runs ispc tasks on the worker
+  threads of Unreal's LowLevelTasks scheduler (through UE::Tasks) so ispc kernels don't spin
+  up a second thread pool competing with the engine for the same cores. The priority of the
+  launched UE tasks can be overridden with ISPC_UE_TASKS_PRIORITY, and for frame-critical and
+  background launches with ISPC_UE_TASKS_CRITICAL_PRIORITY and ISPC_UE_TASKS_BACKGROUND_PRIORITY.
+
+  Launches are tagged with the Mcro::ISPC::ELaunchPriority of the launching thread (tasks inherit
+  the priority of their launch). The UE tasks, GCD, pthreads and work-stealing models queue the
+  priorities separately and drain higher priorities first, tasks of background launches give way
+  to queued higher priority work at task boundaries. ConcRT ignores launch priorities.
+
+  The ISPC_USE_PTHREADS_WORK_STEALING model is the ISPC_USE_PTHREADS model without its global
+  task system mutex. Every thread launching or running tasks owns a Chase-Lev deque of launched
+  task ranges, idle workers steal ranges from the deques of other threads, and individual tasks
+  inside a range are claimed with an atomic counter. It uses standard C++ threads so it is also
+  available on Windows.
+
+#define ISPC_USE_CREW
+#define ISPC_USE_HPX
+  The HPX model requires the HPX runtime environment to be set up. This can be
+  done manually, e.g. with hpx::init, or by including hpx/hpx_main.hpp which
+  uses the main() function as entry point and sets up the runtime system.
+  Number of threads can be specified as commandline parameter with
+  --hpx:threads, use "all" to spawn one thread per processing unit.
+
+*/
+
+#pragma warning(disable: 4530)
+#pragma warning(disable: 4505)
+
+#ifndef ISPC_TASK_SYSTEM
+#error "Define ISPC_TASK_SYSTEM before including IspcTaskSystem.inl"
+#endif
+
+#include "McroISPC/TaskSystemInterface.h"
+#include "McroISPC/FrameArena.h"
+#include "McroISPC/TaskSystem.h"
+#include "McroISPC/TaskTrace.h"
+#include "HAL/PlatformTime.h"
+
+#if !(defined ISPC_USE_UE_TASKS || defined ISPC_USE_CONCRT || defined ISPC_USE_GCD || defined ISPC_USE_PTHREADS ||     \
+      defined ISPC_USE_PTHREADS_FULLY_SUBSCRIBED || defined ISPC_USE_PTHREADS_WORK_STEALING ||                         \
+      defined ISPC_USE_TBB_TASK_GROUP || defined ISPC_USE_TBB_PARALLEL_FOR || defined ISPC_USE_OMP || defined ISPC_USE_HPX)
+
+// If no task model chosen from the compiler cmdline, share the worker pool of Unreal Engine
+#define ISPC_USE_UE_TASKS
+#endif // No task model specified on compiler cmdline
+
+#if defined(_WIN32) || defined(_WIN64)
+#define ISPC_IS_WINDOWS
+#elif defined(__linux__) || defined(__FreeBSD__) // pretty much the same for these purposes
+#define ISPC_IS_LINUX
+#elif defined(__APPLE__)
+#define ISPC_IS_APPLE
+#endif
+
+#define DBG(x)
+
+#ifdef ISPC_USE_UE_TASKS
+#include "Async/Fundamental/Scheduler.h"
+#include "Tasks/Task.h"
+#include "McroISPC/UETaskPriority.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+#endif // ISPC_USE_UE_TASKS
+
+#ifdef ISPC_IS_WINDOWS
+#define NOMINMAX
+#include <windows.h>
+#endif // ISPC_IS_WINDOWS
+#ifdef ISPC_USE_CONCRT
+#include <concrt.h>
+using namespace Concurrency;
+#endif // ISPC_USE_CONCRT
+#ifdef ISPC_USE_GCD
+#include <dispatch/dispatch.h>
+#include <pthread.h>
+#endif // ISPC_USE_GCD
+#ifdef ISPC_USE_PTHREADS
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/param.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <vector>
+#endif // ISPC_USE_PTHREADS
+#ifdef ISPC_USE_PTHREADS_FULLY_SUBSCRIBED
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/param.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <vector>
+//#include <stdexcept>
+#include <stack>
+#endif // ISPC_USE_PTHREADS_FULLY_SUBSCRIBED
+#ifdef ISPC_USE_PTHREADS_WORK_STEALING
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif // ISPC_USE_PTHREADS_WORK_STEALING
+#ifdef ISPC_USE_TBB_PARALLEL_FOR
+#include <tbb/parallel_for.h>
+#endif // ISPC_USE_TBB_PARALLEL_FOR
+#ifdef ISPC_USE_TBB_TASK_GROUP
+#include <tbb/task_group.h>
+#endif // ISPC_USE_TBB_TASK_GROUP
+#ifdef ISPC_USE_OMP
+#include <omp.h>
+#endif // ISPC_USE_OMP
+#ifdef ISPC_USE_HPX
+#include <hpx/include/async.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#endif // ISPC_USE_HPX
+#ifdef ISPC_IS_LINUX
+#include <stdlib.h>
+#endif // ISPC_IS_LINUX
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+namespace Mcro::ISPC::Detail::ISPC_TASK_SYSTEM {
+
+// Signature of ispc-generated 'task' functions
+typedef void (*TaskFuncType)(void *data, int threadIndex, int threadCount, int taskIndex, int taskCount, int taskIndex0,
+                             int taskIndex1, int taskIndex2, int taskCount0, int taskCount1, int taskCount2);
+
+// Small structure used to hold the data for each task.  When tasks are
+// coalesced a single TaskInfo runs taskSpan consecutive task indices
+// starting from taskIndex.
+struct TaskInfo {
+    TaskFuncType func;
+    void *data;
+    int taskIndex;
+    int taskSpan;
+    int taskCount3d[3];
+    // Where to record execution time when coalescing, nullptr otherwise
+    Mcro::ISPC::Detail::FTaskTimingStats *timingStats;
+    // Insights event types of this launch, nullptr when not tracing
+    const Mcro::ISPC::Detail::FTaskTraceSpecs *traceSpecs;
+    // Priority of the launch, launches made from inside the task inherit it
+    Mcro::ISPC::ELaunchPriority priority;
+    // Task systems which queue every TaskInfo individually let Sync() run
+    // tasks which haven't been picked up yet.  Whoever claims the task
+    // first runs it.
+    std::atomic<bool> claimed;
+#if defined(ISPC_USE_CONCRT)
+    event taskEvent;
+#endif
+    int taskCount() const { return taskCount3d[0] * taskCount3d[1] * taskCount3d[2]; }
+    int taskIndex0() const { return taskIndex % taskCount3d[0]; }
+    int taskIndex1() const { return (taskIndex / taskCount3d[0]) % taskCount3d[1]; }
+    int taskIndex2() const { return taskIndex / (taskCount3d[0] * taskCount3d[1]); }
+    int taskCount0() const { return taskCount3d[0]; }
+    int taskCount1() const { return taskCount3d[1]; }
+    int taskCount2() const { return taskCount3d[2]; }
+    TaskInfo() = default;
+};
+
+// Returns true for exactly one of the threads racing to run this task
+static inline bool lClaimTask(TaskInfo *ti) { return !ti->claimed.exchange(true, std::memory_order_acq_rel); }
+
+// Run a single task (or a chunk of coalesced tasks), every task system
+// goes through here
+static inline void lExecuteTask(TaskInfo *ti, int threadIndex, int threadCount) {
+    Mcro::ISPC::Detail::FTaskTraceScope traceScope(ti->traceSpecs, Mcro::ISPC::Detail::ETraceSpan::Task);
+    Mcro::ISPC::FScopedLaunchPriority priorityScope(ti->priority);
+    if (ti->taskSpan == 1 && ti->timingStats == nullptr) {
+        ti->func(ti->data, threadIndex, threadCount, ti->taskIndex, ti->taskCount(), ti->taskIndex0(),
+                 ti->taskIndex1(), ti->taskIndex2(), ti->taskCount0(), ti->taskCount1(), ti->taskCount2());
+        return;
+    }
+
+    uint64_t startCycles = FPlatformTime::Cycles64();
+    const int count0 = ti->taskCount0(), count1 = ti->taskCount1(), count2 = ti->taskCount2();
+    const int count = ti->taskCount();
+    for (int index = ti->taskIndex; index < ti->taskIndex + ti->taskSpan; ++index) {
+        ti->func(ti->data, threadIndex, threadCount, index, count, index % count0, (index / count0) % count1,
+                 index / (count0 * count1), count0, count1, count2);
+    }
+    Mcro::ISPC::Detail::RecordTaskTiming(ti->timingStats, ti->taskSpan, FPlatformTime::Cycles64() - startCycles);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// TaskGroupBase
+
+#define LOG_TASK_QUEUE_CHUNK_SIZE 14
+#define MAX_TASK_QUEUE_CHUNKS 128
+#define TASK_QUEUE_CHUNK_SIZE (1 << LOG_TASK_QUEUE_CHUNK_SIZE)
+
+#define MAX_LAUNCHED_TASKS (MAX_TASK_QUEUE_CHUNKS * TASK_QUEUE_CHUNK_SIZE)
+
+#define NUM_MEM_BUFFERS 16
+
+class TaskGroup;
+
+/** The TaskGroupBase structure provides common functionality for "task
+    groups"; a task group is the set of tasks launched from within a single
+    ispc function.  When the function is ready to return, it waits for all
+    of the tasks in its task group to finish before it actually returns.
+ */
+class TaskGroupBase {
+  public:
+    void Reset();
+
+    int AllocTaskInfo(int count);
+    TaskInfo *GetTaskInfo(int index);
+
+    void *AllocMemory(int64_t size, int32_t alignment);
+
+    // Insights event types of the last launch, used for tracing Sync()
+    const Mcro::ISPC::Detail::FTaskTraceSpecs *traceSpecs;
+
+    // Intrusive link used while this group is in the shared free list
+    std::atomic<TaskGroup *> poolNext;
+
+    // The last launch is expected to be long-running, see
+    // Mcro::ISPC::ECorePreference::PerformanceForLongTasks
+    bool preferPerformanceCores;
+
+    // Taken from the thread allocating the group, every launch of the
+    // group has this priority
+    Mcro::ISPC::ELaunchPriority priority;
+
+  protected:
+    void *AllocFrameArenaMemory(int64_t size, int32_t alignment);
+
+    TaskGroupBase();
+    ~TaskGroupBase();
+
+    int nextTaskInfoIndex;
+
+  private:
+    /* We allocate blocks of TASK_QUEUE_CHUNK_SIZE TaskInfo structures as
+       needed by the calling function.  We hold up to MAX_TASK_QUEUE_CHUNKS
+       of these (and then exit at runtime if more than this many tasks are
+       launched.)
+     */
+    TaskInfo *taskInfo[MAX_TASK_QUEUE_CHUNKS];
+
+    /* We also allocate chunks of memory to service ISPCAlloc() calls.  The
+       memBuffers[] array holds pointers to this memory.  The first element
+       of this array is initialized to point to mem and then any subsequent
+       elements required are initialized with dynamic allocation.
+     */
+    int curMemBuffer, curMemBufferOffset;
+    int memBufferSize[NUM_MEM_BUFFERS];
+    char *memBuffers[NUM_MEM_BUFFERS];
+    char mem[256];
+
+    /* Allocations not fitting into the current buffer are served from the
+       shared frame arena first (see McroISPC/FrameArena.h) if it's enabled.
+       This is set while this group holds memory from the arena.
+     */
+    bool usesFrameArena;
+};
+
+inline TaskGroupBase::TaskGroupBase() {
+    nextTaskInfoIndex = 0;
+    usesFrameArena = false;
+    traceSpecs = nullptr;
+    preferPerformanceCores = false;
+    priority = Mcro::ISPC::ELaunchPriority::Normal;
+
+    curMemBuffer = 0;
+    curMemBufferOffset = 0;
+    memBuffers[0] = mem;
+    memBufferSize[0] = sizeof(mem) / sizeof(mem[0]);
+    for (int i = 1; i < NUM_MEM_BUFFERS; ++i) {
+        memBuffers[i] = nullptr;
+        memBufferSize[i] = 0;
+    }
+
+    for (int i = 0; i < MAX_TASK_QUEUE_CHUNKS; ++i)
+        taskInfo[i] = nullptr;
+}
+
+inline TaskGroupBase::~TaskGroupBase() {
+    // Note: don't delete memBuffers[0], since it points to the start of
+    // the "mem" member!
+    for (int i = 1; i < NUM_MEM_BUFFERS; ++i)
+        delete[](memBuffers[i]);
+
+    if (usesFrameArena)
+        Mcro::ISPC::Detail::ReleaseFrameArena();
+}
+
+inline void TaskGroupBase::Reset() {
+    nextTaskInfoIndex = 0;
+    traceSpecs = nullptr;
+    curMemBuffer = 0;
+    curMemBufferOffset = 0;
+
+    // The group is synced, whatever it got from the frame arena is free now
+    if (usesFrameArena) {
+        Mcro::ISPC::Detail::ReleaseFrameArena();
+        usesFrameArena = false;
+    }
+}
+
+inline int TaskGroupBase::AllocTaskInfo(int count) {
+    int ret = nextTaskInfoIndex;
+    nextTaskInfoIndex += count;
+    return ret;
+}
+
+inline TaskInfo *TaskGroupBase::GetTaskInfo(int index) {
+    int chunk = (index >> LOG_TASK_QUEUE_CHUNK_SIZE);
+    int offset = index & (TASK_QUEUE_CHUNK_SIZE - 1);
+
+    if (chunk == MAX_TASK_QUEUE_CHUNKS) {
+        fprintf(stderr,
+                "A total of %d tasks have been launched from the "
+                "current function--the simple built-in task system can handle "
+                "no more. You can increase the values of TASK_QUEUE_CHUNK_SIZE "
+                "and LOG_TASK_QUEUE_CHUNK_SIZE to work around this limitation.  "
+                "Sorry!  Exiting.\n",
+                index);
+        exit(1);
+    }
+
+    if (taskInfo[chunk] == nullptr)
+        taskInfo[chunk] = new TaskInfo[TASK_QUEUE_CHUNK_SIZE];
+    return &taskInfo[chunk][offset];
+}
+
+inline void *TaskGroupBase::AllocMemory(int64_t size, int32_t alignment) {
+    char *basePtr = memBuffers[curMemBuffer];
+    intptr_t iptr = (intptr_t)(basePtr + curMemBufferOffset);
+    iptr = (iptr + (alignment - 1)) & ~(alignment - 1);
+
+    int newOffset = int(iptr - (intptr_t)basePtr + size);
+    if (newOffset < memBufferSize[curMemBuffer]) {
+        curMemBufferOffset = newOffset;
+        return (char *)iptr;
+    }
+
+    if (void *arenaPtr = AllocFrameArenaMemory(size, alignment))
+        return arenaPtr;
+
+    ++curMemBuffer;
+    curMemBufferOffset = 0;
+    assert(curMemBuffer < NUM_MEM_BUFFERS);
+
+    int allocSize = 1 << (12 + curMemBuffer);
+    allocSize = std::max(int(size + alignment), allocSize);
+    char *newBuf = new char[allocSize];
+    memBufferSize[curMemBuffer] = allocSize;
+    memBuffers[curMemBuffer] = newBuf;
+    return AllocMemory(size, alignment);
+}
+
+inline void *TaskGroupBase::AllocFrameArenaMemory(int64_t size, int32_t alignment) {
+    if (!usesFrameArena) {
+        if (!Mcro::ISPC::Detail::AcquireFrameArena())
+            return nullptr;
+        usesFrameArena = true;
+    }
+    return Mcro::ISPC::Detail::AllocFromFrameArena(size, alignment);
+}
+
+///////////////////////////////////////////////////////////////////////////
+// Atomics and the like
+
+static inline void lMemFence() {
+    // Windows atomic functions already contain the fence
+#if !defined ISPC_IS_WINDOWS
+    __sync_synchronize();
+#endif
+}
+
+static void *lAtomicCompareAndSwapPointer(void **v, void *newValue, void *oldValue) {
+#ifdef ISPC_IS_WINDOWS
+    return InterlockedCompareExchangePointer(v, newValue, oldValue);
+#else
+    void *result = __sync_val_compare_and_swap(v, oldValue, newValue);
+    lMemFence();
+    return result;
+#endif // ISPC_IS_WINDOWS
+}
+
+static int32_t lAtomicCompareAndSwap32(volatile int32_t *v, int32_t newValue, int32_t oldValue) {
+#ifdef ISPC_IS_WINDOWS
+    return InterlockedCompareExchange((volatile LONG *)v, newValue, oldValue);
+#else
+    int32_t result = __sync_val_compare_and_swap(v, oldValue, newValue);
+    lMemFence();
+    return result;
+#endif // ISPC_IS_WINDOWS
+}
+
+static inline int32_t lAtomicAdd(volatile int32_t *v, int32_t delta) {
+#ifdef ISPC_IS_WINDOWS
+    return InterlockedExchangeAdd((volatile LONG *)v, delta) + delta;
+#else
+    return __sync_fetch_and_add(v, delta);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+#ifdef ISPC_USE_UE_TASKS
+/* With Unreal's task system each Launch() call is recorded as a range of
+   task indices, and at most one UE task per scheduler worker is launched
+   for it.  Those UE tasks (and the thread calling Sync()) then claim
+   individual ispc tasks from the range with an atomic counter, so a launch
+   of N tasks doesn't translate into N engine tasks.
+ */
+class TaskGroup : public TaskGroupBase {
+  public:
+    TaskGroup() {
+        numRanges = 0;
+        ueTasks.reserve(16);
+    }
+
+    void Reset() {
+        TaskGroupBase::Reset();
+        numRanges = 0;
+        ueTasks.clear();
+    }
+
+    void Launch(int baseIndex, int count);
+    void Sync();
+
+  private:
+    struct TaskRange {
+        int baseIndex;
+        int count;
+        int threadCount;
+        std::atomic<int32_t> nextTask;
+        // Frame-critical or normal launch, counted in lUrgentRanges until
+        // all of its tasks are claimed
+        bool urgent;
+        std::atomic<bool> drained;
+    };
+
+    bool RunNextTask(TaskRange *range, int threadIndex);
+    void RunRange(TaskRange *range, int threadIndex, UE::Tasks::ETaskPriority uePriority, bool yielding);
+
+    // Ranges are kept allocated across Reset() so their address stays
+    // stable while UE tasks are still referring to them.
+    std::vector<std::unique_ptr<TaskRange>> ranges;
+    int numRanges;
+    std::vector<UE::Tasks::FTask> ueTasks;
+};
+#endif // ISPC_USE_UE_TASKS
+
+#ifdef ISPC_USE_CONCRT
+// With ConcRT, we don't need to extend TaskGroupBase at all.
+class TaskGroup : public TaskGroupBase {
+  public:
+    void Launch(int baseIndex, int count);
+    void Sync();
+};
+#endif // ISPC_USE_CONCRT
+
+#ifdef ISPC_USE_GCD
+/* With Grand Central Dispatch, we associate a GCD dispatch group with each
+   task group.  (We'll later wait on this dispatch group when we need to
+   wait on all of the tasks in the group to finish.)
+ */
+class TaskGroup : public TaskGroupBase {
+  public:
+    TaskGroup() { gcdGroup = dispatch_group_create(); }
+
+    void Launch(int baseIndex, int count);
+    void Sync();
+
+  private:
+    dispatch_group_t gcdGroup;
+};
+#endif // ISPC_USE_GCD
+
+#ifdef ISPC_USE_PTHREADS
+static void *lTaskEntry(void *arg);
+
+class TaskGroup : public TaskGroupBase {
+  public:
+    TaskGroup() {
+        numUnfinishedTasks = 0;
+        waitingTasks.reserve(128);
+        inActiveList = false;
+    }
+
+    void Reset() {
+        TaskGroupBase::Reset();
+        numUnfinishedTasks = 0;
+        assert(inActiveList == false);
+        lMemFence();
+    }
+
+    void Launch(int baseIndex, int count);
+    void Sync();
+
+  private:
+    friend void *lTaskEntry(void *arg);
+
+    int32_t numUnfinishedTasks;
+    int32_t pad[3];
+    std::vector<int> waitingTasks;
+    bool inActiveList;
+};
+
+#endif // ISPC_USE_PTHREADS
+
+#ifdef ISPC_USE_PTHREADS_WORK_STEALING
+class TaskGroup;
+
+/* A single Launch() call as it's stored in the work-stealing deques.  The
+   same range is pushed multiple times so multiple threads can work on it,
+   the actual tasks are claimed with nextTask.
+ */
+struct WorkRange {
+    TaskGroup *group;
+    int baseIndex;
+    int count;
+    bool preferPerformanceCores;
+    // Mcro::ISPC::ELaunchPriority of the group, selects the deque
+    int priority;
+    std::atomic<int32_t> nextTask;
+};
+
+class TaskGroup : public TaskGroupBase {
+  public:
+    TaskGroup() {
+        numUnfinishedTasks = 0;
+        numQueuedRanges = 0;
+        numRanges = 0;
+    }
+
+    void Reset() {
+        TaskGroupBase::Reset();
+        assert(numUnfinishedTasks == 0 && numQueuedRanges == 0);
+        numRanges = 0;
+    }
+
+    void Launch(int baseIndex, int count);
+    void Sync();
+
+  private:
+    friend bool lRunWorkRange(WorkRange *range, int threadIndex);
+
+    // Tasks not finished yet
+    std::atomic<int32_t> numUnfinishedTasks;
+
+    // Copies of our ranges still sitting in (or being processed from) a
+    // deque.  The group cannot be reused until this drops to zero.
+    std::atomic<int32_t> numQueuedRanges;
+
+    // Kept allocated across Reset() so pointers in deques remain valid
+    std::vector<std::unique_ptr<WorkRange>> ranges;
+    int numRanges;
+};
+
+#endif // ISPC_USE_PTHREADS_WORK_STEALING
+
+#ifdef ISPC_USE_OMP
+
+class TaskGroup : public TaskGroupBase {
+  public:
+    void Launch(int baseIndex, int count);
+    void Sync();
+};
+
+#endif // ISPC_USE_OMP
+
+#ifdef ISPC_USE_TBB_PARALLEL_FOR
+
+class TaskGroup : public TaskGroupBase {
+  public:
+    void Launch(int baseIndex, int count);
+    void Sync();
+};
+
+#endif // ISPC_USE_TBB_PARALLEL_FOR
+
+#ifdef ISPC_USE_TBB_TASK_GROUP
+
+class TaskGroup : public TaskGroupBase {
+  public:
+    void Launch(int baseIndex, int count);
+    void Sync();
+
+  private:
+    tbb::task_group tbbTaskGroup;
+};
+
+#endif // ISPC_USE_TBB_TASK_GROUP
+
+#ifdef ISPC_USE_HPX
+
+class TaskGroup : public TaskGroupBase {
+  public:
+    void Launch(int baseIndex, int count);
+    void Sync();
+
+  private:
+    std::vector<hpx::future<void>> futures;
+};
+
+#endif // ISPC_USE_HPX
+
+///////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////
+// Unreal Engine tasks
+
+#ifdef ISPC_USE_UE_TASKS
+
+static void InitTaskSystem() {
+    // The LowLevelTasks scheduler is owned and started by the engine
+}
+
+// Ranges of frame-critical and normal launches which still have tasks to
+// claim, background ranges give way while there are any
+static std::atomic<int32_t> lUrgentRanges{0};
+
+// Incremented by every frame-critical or normal launch.  A background
+// range only yields to urgent launches made since it last started running,
+// otherwise one long urgent range would make it relaunch itself after
+// every single task.
+static std::atomic<uint32_t> lUrgentGeneration{0};
+
+static std::atomic<uint64_t> lBackgroundYields{0};
+
+Mcro::ISPC::FLaunchPriorityStats GetLaunchPriorityStats() {
+    return {
+        .BackgroundYields = lBackgroundYields.load(std::memory_order_relaxed),
+        .UnclaimedUrgentRanges = lUrgentRanges.load(std::memory_order_relaxed),
+    };
+}
+
+inline bool TaskGroup::RunNextTask(TaskRange *range, int threadIndex) {
+    int taskNumber = range->nextTask.fetch_add(1, std::memory_order_relaxed);
+
+    // The range stops being urgent as soon as its last task is claimed,
+    // not when some thread happens to find it empty later
+    if (taskNumber >= range->count - 1 && range->urgent &&
+        !range->drained.exchange(true, std::memory_order_relaxed))
+        lUrgentRanges.fetch_sub(1, std::memory_order_relaxed);
+    if (taskNumber >= range->count)
+        return false;
+
+    lExecuteTask(GetTaskInfo(range->baseIndex + taskNumber), threadIndex, range->threadCount);
+    return true;
+}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+    if (numRanges == (int)ranges.size())
+        ranges.push_back(std::make_unique<TaskRange>());
+    TaskRange *range = ranges[numRanges++].get();
+
+    // One dispatched UE task per worker is enough, they claim ispc tasks
+    // until the range is exhausted.  The thread calling Sync() will also
+    // join in, it gets the last thread index.
+    int numWorkers = std::max(1, (int)LowLevelTasks::FScheduler::Get().GetNumWorkers());
+    int dispatchCount = std::min(count, numWorkers);
+
+    const bool background = priority == Mcro::ISPC::ELaunchPriority::Background;
+    const UE::Tasks::ETaskPriority uePriority = Mcro::ISPC::Detail::GetUETaskPriority(priority);
+
+    range->baseIndex = baseIndex;
+    range->count = count;
+    range->threadCount = dispatchCount + 1;
+    range->urgent = !background && count > 0;
+    range->drained.store(false, std::memory_order_relaxed);
+    range->nextTask.store(0, std::memory_order_release);
+    if (range->urgent) {
+        lUrgentRanges.fetch_add(1, std::memory_order_relaxed);
+        lUrgentGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    for (int i = 0; i < dispatchCount; ++i) {
+        ueTasks.push_back(UE::Tasks::Launch(
+            TEXT("ISPC Task"),
+            [this, range, i, uePriority, background] { RunRange(range, i, uePriority, background); },
+            uePriority));
+    }
+}
+
+inline void TaskGroup::RunRange(TaskRange *range, int threadIndex, UE::Tasks::ETaskPriority uePriority, bool yielding) {
+    const uint32_t generation = lUrgentGeneration.load(std::memory_order_relaxed);
+    while (RunNextTask(range, threadIndex)) {
+        if (!yielding || lUrgentRanges.load(std::memory_order_relaxed) == 0 ||
+            lUrgentGeneration.load(std::memory_order_relaxed) == generation ||
+            range->nextTask.load(std::memory_order_relaxed) >= range->count)
+            continue;
+
+        // Give the worker to higher priority work, the rest of the range
+        // continues in a nested task so the one Sync() waits for doesn't
+        // complete before it.
+        lBackgroundYields.fetch_add(1, std::memory_order_relaxed);
+        UE::Tasks::AddNested(UE::Tasks::Launch(
+            TEXT("ISPC Task"),
+            [this, range, threadIndex, uePriority] { RunRange(range, threadIndex, uePriority, true); },
+            uePriority));
+        return;
+    }
+}
+
+inline void TaskGroup::Sync() {
+    // Help executing the remaining tasks of this group first, instead of
+    // blocking the calling thread right away.
+    for (int i = 0; i < numRanges; ++i) {
+        TaskRange *range = ranges[i].get();
+        while (RunNextTask(range, range->threadCount - 1))
+            ;
+    }
+
+    // Whatever is left are tasks already being executed by workers.  UE
+    // Wait() also retracts UE tasks which haven't been picked up yet and
+    // runs them inline.
+    for (UE::Tasks::FTask &task : ueTasks)
+        task.Wait();
+    ueTasks.clear();
+}
+
+#endif // ISPC_USE_UE_TASKS
+
+///////////////////////////////////////////////////////////////////////////
+// Grand Central Dispatch
+
+#ifdef ISPC_USE_GCD
+
+/* A simple task system for ispc programs based on Apple's Grand Central
+   Dispatch. */
+
+// One global queue for each Mcro::ISPC::ELaunchPriority
+static dispatch_queue_t gcdQueues[Mcro::ISPC::LaunchPriorityCount];
+static volatile int32_t lock = 0;
+
+static void InitTaskSystem() {
+    if (gcdQueues[0] != nullptr)
+        return;
+
+    while (1) {
+        if (lAtomicCompareAndSwap32(&lock, 1, 0) == 0) {
+            if (gcdQueues[0] == nullptr) {
+                gcdQueues[2] = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_BACKGROUND, 0);
+                gcdQueues[1] = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+                lMemFence();
+                gcdQueues[0] = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0);
+                assert(gcdQueues[0] != nullptr && gcdQueues[1] != nullptr && gcdQueues[2] != nullptr);
+                lMemFence();
+            }
+            lock = 0;
+            break;
+        }
+    }
+}
+
+static void lRunTask(void *ti) {
+    TaskInfo *taskInfo = (TaskInfo *)ti;
+    // FIXME: these are bogus values; may cause bugs in code that depends
+    // on them having unique values in different threads.
+    int threadIndex = 0;
+    int threadCount = 1;
+
+    // Actually run the task, unless Sync() got to it first
+    if (lClaimTask(taskInfo))
+        lExecuteTask(taskInfo, threadIndex, threadCount);
+}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+    dispatch_queue_t gcdQueue = gcdQueues[(int)priority];
+    for (int i = 0; i < count; ++i) {
+        TaskInfo *ti = GetTaskInfo(baseIndex + i);
+        dispatch_group_async_f(gcdGroup, gcdQueue, ti, lRunTask);
+    }
+}
+
+inline void TaskGroup::Sync() {
+    // Run the tasks of this group the queue hasn't started yet in this
+    // thread, instead of blocking it while there's work to do.  The queued
+    // blocks of those tasks will return immediately.
+    for (int i = 0; i < nextTaskInfoIndex; ++i) {
+        TaskInfo *ti = GetTaskInfo(i);
+        if (lClaimTask(ti))
+            lExecuteTask(ti, 0, 1);
+    }
+    dispatch_group_wait(gcdGroup, DISPATCH_TIME_FOREVER);
+}
+
+#endif // ISPC_USE_GCD
+
+///////////////////////////////////////////////////////////////////////////
+// Concurrency Runtime
+
+#ifdef ISPC_USE_CONCRT
+
+static void InitTaskSystem() {
+    // No initialization needed
+}
+
+static void __cdecl lRunTask(LPVOID param) {
+    TaskInfo *ti = (TaskInfo *)param;
+
+    // Actually run the task.
+    // FIXME: like the GCD implementation for OS X, this is passing bogus
+    // values for the threadIndex and threadCount builtins, which in turn
+    // will cause bugs in code that uses those.
+    int threadIndex = 0;
+    int threadCount = 1;
+    if (lClaimTask(ti))
+        lExecuteTask(ti, threadIndex, threadCount);
+
+    // Signal the event that this task is done (or it has been done by
+    // Sync()), either way the scheduler doesn't refer to it anymore.
+    ti->taskEvent.set();
+}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+    for (int i = 0; i < count; ++i)
+        CurrentScheduler::ScheduleTask(lRunTask, GetTaskInfo(baseIndex + i));
+}
+
+inline void TaskGroup::Sync() {
+    // Run tasks which weren't picked up by the scheduler yet on this thread
+    // first, so nested launches can progress even when the pool is busy.
+    for (int i = 0; i < nextTaskInfoIndex; ++i) {
+        TaskInfo *ti = GetTaskInfo(i);
+        if (lClaimTask(ti))
+            lExecuteTask(ti, 0, 1);
+    }
+
+    // ConcRT events block cooperatively, the scheduler keeps running other
+    // work on this context while waiting.
+    for (int i = 0; i < nextTaskInfoIndex; ++i) {
+        TaskInfo *ti = GetTaskInfo(i);
+        ti->taskEvent.wait();
+        ti->taskEvent.reset();
+    }
+}
+
+#endif // ISPC_USE_CONCRT
+
+///////////////////////////////////////////////////////////////////////////
+// pthreads
+
+#ifdef ISPC_USE_PTHREADS
+
+static volatile int32_t lock = 0;
+
+static int nThreads;
+static pthread_t *threads = nullptr;
+
+static pthread_mutex_t taskSysMutex;
+// Task groups with tasks waiting to be run, one list for each
+// Mcro::ISPC::ELaunchPriority.  Tasks are taken from the highest priority
+// list which isn't empty.
+static std::vector<TaskGroup *> activeTaskGroups[Mcro::ISPC::LaunchPriorityCount];
+static sem_t *workerSemaphore;
+
+// Must be called with taskSysMutex held
+static std::vector<TaskGroup *> *lFindActiveTaskGroups() {
+    for (std::vector<TaskGroup *> &groups : activeTaskGroups)
+        if (!groups.empty())
+            return &groups;
+    return nullptr;
+}
+
+static void *lTaskEntry(void *arg) {
+    int threadIndex = (int)((int64_t)arg);
+    int threadCount = nThreads;
+    Mcro::ISPC::Detail::PlaceWorkerThread(threadIndex);
+
+    while (1) {
+        int err;
+        //
+        // Wait on the semaphore until we're woken up due to the arrival of
+        // more work.
+        //
+        if ((err = sem_wait(workerSemaphore)) != 0) {
+            fprintf(stderr, "Error from sem_wait: %s\n", strerror(err));
+            exit(1);
+        }
+
+        //
+        // Acquire the mutex
+        //
+        if ((err = pthread_mutex_lock(&taskSysMutex)) != 0) {
+            fprintf(stderr, "Error from pthread_mutex_lock: %s\n", strerror(err));
+            exit(1);
+        }
+
+        std::vector<TaskGroup *> *active = lFindActiveTaskGroups();
+        if (active == nullptr) {
+            //
+            // Task queue is empty, go back and wait on the semaphore
+            //
+            if ((err = pthread_mutex_unlock(&taskSysMutex)) != 0) {
+                fprintf(stderr, "Error from pthread_mutex_unlock: %s\n", strerror(err));
+                exit(1);
+            }
+            continue;
+        }
+
+        //
+        // Get the last task group on the active list and the last task
+        // from its waiting tasks list.
+        //
+        TaskGroup *tg = active->back();
+        assert(tg->waitingTasks.size() > 0);
+        int taskNumber = tg->waitingTasks.back();
+        tg->waitingTasks.pop_back();
+
+        if (tg->waitingTasks.size() == 0) {
+            // We just took the last task from this task group, so remove
+            // it from the active list.
+            active->pop_back();
+            tg->inActiveList = false;
+        }
+
+        if ((err = pthread_mutex_unlock(&taskSysMutex)) != 0) {
+            fprintf(stderr, "Error from pthread_mutex_unlock: %s\n", strerror(err));
+            exit(1);
+        }
+
+        //
+        // And now actually run the task
+        //
+        DBG(fprintf(stderr, "running task %d from group %p\n", taskNumber, tg));
+        TaskInfo *myTask = tg->GetTaskInfo(taskNumber);
+        lExecuteTask(myTask, threadIndex, threadCount);
+
+        //
+        // Decrement the "number of unfinished tasks" counter in the task
+        // group.
+        //
+        lMemFence();
+        lAtomicAdd(&tg->numUnfinishedTasks, -1);
+    }
+
+    pthread_exit(nullptr);
+    return 0;
+}
+
+static void InitTaskSystem() {
+    if (threads == nullptr) {
+        while (1) {
+            if (lAtomicCompareAndSwap32(&lock, 1, 0) == 0) {
+                if (threads == nullptr) {
+                    // We launch one fewer thread than there are cores,
+                    // since the main thread here will also grab jobs from
+                    // the task queue itself.
+                    nThreads = Mcro::ISPC::Detail::GetWorkerCount(sysconf(_SC_NPROCESSORS_ONLN) - 1);
+
+                    int err;
+                    if ((err = pthread_mutex_init(&taskSysMutex, nullptr)) != 0) {
+                        fprintf(stderr, "Error creating mutex: %s\n", strerror(err));
+                        exit(1);
+                    }
+
+                    constexpr std::size_t FILENAME_MAX_LEN{1024UL};
+                    char name[FILENAME_MAX_LEN];
+                    bool success = false;
+                    srand(time(nullptr));
+                    for (int i = 0; i < 10; i++) {
+                        // Some platforms (e.g. FreeBSD) require the name to begin with a slash
+                        snprintf(name, FILENAME_MAX_LEN, "/ispc_task.%d.%d", static_cast<int>(getpid()), static_cast<int>(rand()));
+                        workerSemaphore = sem_open(name, O_CREAT, S_IRUSR | S_IWUSR, 0);
+                        if (workerSemaphore != SEM_FAILED) {
+                            success = true;
+                            break;
+                        }
+                        fprintf(stderr, "Failed to create %s\n", name);
+                    }
+
+                    if (!success) {
+                        fprintf(stderr, "Error creating semaphore (%s): %s\n", name, strerror(errno));
+                        exit(1);
+                    }
+
+                    threads = (pthread_t *)malloc(nThreads * sizeof(pthread_t));
+                    if (threads == nullptr) {
+                        fprintf(stderr, "Error creating pthreads: %s\n", strerror(err));
+                        exit(1);
+                    }
+
+                    for (int i = 0; i < nThreads; ++i) {
+                        err = pthread_create(&threads[i], nullptr, &lTaskEntry, (void *)((long long)i));
+                        if (err != 0) {
+                            fprintf(stderr, "Error creating pthread %d: %s\n", i, strerror(err));
+                            exit(1);
+                        }
+                    }
+
+                    for (std::vector<TaskGroup *> &groups : activeTaskGroups)
+                        groups.reserve(64);
+                }
+
+                // Make sure all of the above goes to memory before we
+                // clear the lock.
+                lMemFence();
+                lock = 0;
+                break;
+            }
+        }
+    }
+}
+
+inline void TaskGroup::Launch(int baseCoord, int count) {
+    //
+    // Acquire mutex, add task
+    //
+    int err;
+    if ((err = pthread_mutex_lock(&taskSysMutex)) != 0) {
+        fprintf(stderr, "Error from pthread_mutex_lock: %s\n", strerror(err));
+        exit(1);
+    }
+
+    // Add the corresponding set of tasks to the waiting-to-be-run list for
+    // this task group.
+    //
+    // FIXME: it's a little ugly to hold a global mutex for this when we
+    // only need to make sure no one else is accessing this task group's
+    // waitingTasks list.  (But a small experiment in switching to a
+    // per-TaskGroup mutex showed worse performance!)
+    for (int i = 0; i < count; ++i)
+        waitingTasks.push_back(baseCoord + i);
+
+    // Add the task group to the global active list if it isn't there
+    // already.
+    if (inActiveList == false) {
+        activeTaskGroups[(int)priority].push_back(this);
+        inActiveList = true;
+    }
+
+    if ((err = pthread_mutex_unlock(&taskSysMutex)) != 0) {
+        fprintf(stderr, "Error from pthread_mutex_unlock: %s\n", strerror(err));
+        exit(1);
+    }
+
+    //
+    // Update the count of the number of tasks left to run in this task
+    // group.
+    //
+    lMemFence();
+    lAtomicAdd(&numUnfinishedTasks, count);
+
+    //
+    // Post to the worker semaphore to wake up worker threads that are
+    // sleeping waiting for tasks to show up
+    //
+    for (int i = 0; i < count; ++i)
+        if ((err = sem_post(workerSemaphore)) != 0) {
+            fprintf(stderr, "Error from sem_post: %s\n", strerror(err));
+            exit(1);
+        }
+}
+
+inline void TaskGroup::Sync() {
+    DBG(fprintf(stderr, "syncing %p - %d unfinished\n", tg, numUnfinishedTasks));
+
+    while (numUnfinishedTasks > 0) {
+        // All of the tasks in this group aren't finished yet.  We'll try
+        // to help out here since we don't have anything else to do...
+
+        DBG(fprintf(stderr, "while syncing %p - %d unfinished\n", tg, numUnfinishedTasks));
+
+        //
+        // Acquire the global task system mutex to grab a task to work on
+        //
+        int err;
+        if ((err = pthread_mutex_lock(&taskSysMutex)) != 0) {
+            fprintf(stderr, "Error from pthread_mutex_lock: %s\n", strerror(err));
+            exit(1);
+        }
+
+        TaskInfo *myTask = nullptr;
+        TaskGroup *runtg = this;
+        if (waitingTasks.size() > 0) {
+            int taskNumber = waitingTasks.back();
+            waitingTasks.pop_back();
+
+            if (waitingTasks.size() == 0) {
+                // There's nothing left to start running from this group,
+                // so remove it from the active task list.
+                std::vector<TaskGroup *> &groups = activeTaskGroups[(int)priority];
+                groups.erase(std::find(groups.begin(), groups.end(), this));
+                inActiveList = false;
+            }
+            myTask = GetTaskInfo(taskNumber);
+            DBG(fprintf(stderr, "running task %d from group %p in sync\n", taskNumber, tg));
+        } else {
+            // Other threads are already working on all of the tasks in
+            // this group, so we can't help out by running one ourself.
+            // We'll try to run one from another group to make ourselves
+            // useful here.
+            std::vector<TaskGroup *> *active = lFindActiveTaskGroups();
+            if (active == nullptr) {
+                // No active task groups left--there's nothing for us to do.
+                if ((err = pthread_mutex_unlock(&taskSysMutex)) != 0) {
+                    fprintf(stderr, "Error from pthread_mutex_unlock: %s\n", strerror(err));
+                    exit(1);
+                }
+                // FIXME: We basically end up busy-waiting here, which is
+                // extra wasteful in a world with hyper-threading.  It would
+                // be much better to put this thread to sleep on a
+                // condition variable that was signaled when the last task
+                // in this group was finished.
+                usleep(1);
+                continue;
+            }
+
+            // Get a task to run from another task group.
+            runtg = active->back();
+            assert(runtg->waitingTasks.size() > 0);
+
+            int taskNumber = runtg->waitingTasks.back();
+            runtg->waitingTasks.pop_back();
+            if (runtg->waitingTasks.size() == 0) {
+                // There's left to start running from this group, so remove
+                // it from the active task list.
+                active->pop_back();
+                runtg->inActiveList = false;
+            }
+            myTask = runtg->GetTaskInfo(taskNumber);
+            DBG(fprintf(stderr, "running task %d from other group %p in sync\n", taskNumber, runtg));
+        }
+
+        if ((err = pthread_mutex_unlock(&taskSysMutex)) != 0) {
+            fprintf(stderr, "Error from pthread_mutex_unlock: %s\n", strerror(err));
+            exit(1);
+        }
+
+        //
+        // Do work for _myTask_
+        //
+        // FIXME: bogus values for thread index/thread count here as well..
+        lExecuteTask(myTask, 0, 1);
+
+        //
+        // Decrement the number of unfinished tasks counter
+        //
+        lMemFence();
+        lAtomicAdd(&runtg->numUnfinishedTasks, -1);
+    }
+    DBG(fprintf(stderr, "sync for %p done!n", tg));
+}
+
+#endif // ISPC_USE_PTHREADS
+
+///////////////////////////////////////////////////////////////////////////
+// Work-stealing threads
+
+#ifdef ISPC_USE_PTHREADS_WORK_STEALING
+
+#define LOG_WORK_DEQUE_SIZE 12
+#define WORK_DEQUE_SIZE (1 << LOG_WORK_DEQUE_SIZE)
+
+// Worker threads and every other thread launching ispc tasks get a deque,
+// this is the maximum number of such threads.
+#define MAX_WORK_DEQUES 512
+
+/* Fixed capacity Chase-Lev deque as described in "Correct and Efficient
+   Work-Stealing for Weak Memory Models" (Le, Pop, Cohen, Zappa Nardelli
+   2013).  Only the owning thread may Push() and Pop(), any thread may
+   Steal().  When the deque is full Push() fails and the caller is expected
+   to run the work itself.
+ */
+class WorkDeque {
+  public:
+    WorkDeque() : top(0), bottom(0) {
+        for (int i = 0; i < WORK_DEQUE_SIZE; ++i)
+            buffer[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    bool Push(WorkRange *range) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= WORK_DEQUE_SIZE)
+            return false;
+        buffer[b & (WORK_DEQUE_SIZE - 1)].store(range, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    WorkRange *Pop() {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // Empty
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        WorkRange *range = buffer[b & (WORK_DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last item, race against thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                range = nullptr;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return range;
+    }
+
+    // Look at the item a Steal() would take without taking it.  Ranges are
+    // never freed so the result is safe to inspect even if it's stale.
+    WorkRange *PeekTop() {
+        int64_t t = top.load(std::memory_order_acquire);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return nullptr;
+        return buffer[t & (WORK_DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+    }
+
+    WorkRange *Steal() {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return nullptr;
+
+        WorkRange *range = buffer[t & (WORK_DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return range;
+    }
+
+  private:
+    // Keep the indices written by thieves and by the owner on separate
+    // cache lines
+    alignas(64) std::atomic<int64_t> top;
+    alignas(64) std::atomic<int64_t> bottom;
+    alignas(64) std::atomic<WorkRange *> buffer[WORK_DEQUE_SIZE];
+};
+
+// Every thread has a deque for each Mcro::ISPC::ELaunchPriority, work is
+// looked for in priority order
+struct ThreadWorkDeques {
+    WorkDeque byPriority[Mcro::ISPC::LaunchPriorityCount];
+};
+
+#define BACKGROUND_PRIORITY ((int)Mcro::ISPC::ELaunchPriority::Background)
+
+static std::atomic<bool> lTaskSystemReady{false};
+static std::mutex lInitMutex;
+static int nThreads;
+
+static std::atomic<ThreadWorkDeques *> lWorkDeques[MAX_WORK_DEQUES];
+static std::atomic<int32_t> lNumWorkDeques{0};
+static thread_local ThreadWorkDeques *tlWorkDeque = nullptr;
+static thread_local int tlThreadIndex = -1;
+
+// Upper bound of range copies sitting in the deques of each priority.  It's
+// incremented before a push and decremented after a successful pop or
+// steal, so priorities with nothing queued can be skipped cheaply, and
+// background ranges know when to give way.
+static std::atomic<int32_t> lQueuedCopies[Mcro::ISPC::LaunchPriorityCount];
+
+static bool lPushRange(ThreadWorkDeques *own, WorkRange *range) {
+    lQueuedCopies[range->priority].fetch_add(1, std::memory_order_seq_cst);
+    if (own->byPriority[range->priority].Push(range))
+        return true;
+    lQueuedCopies[range->priority].fetch_sub(1, std::memory_order_relaxed);
+    return false;
+}
+
+static bool lHasUrgentWork() {
+    for (int priority = 0; priority < BACKGROUND_PRIORITY; ++priority)
+        if (lQueuedCopies[priority].load(std::memory_order_relaxed) > 0)
+            return true;
+    return false;
+}
+
+// Sleeping workers wait for lWorkEpoch to change
+static std::mutex lSleepMutex;
+static std::condition_variable lSleepCondition;
+static std::atomic<int32_t> lWorkEpoch{0};
+static std::atomic<int32_t> lNumSleepers{0};
+
+/* Get the deque of the current thread, registering one on first use.
+   Returns nullptr when the registry is full, in which case the calling
+   thread has to run its tasks inline.
+ */
+static ThreadWorkDeques *lGetThreadDeque() {
+    if (tlWorkDeque != nullptr || tlThreadIndex == MAX_WORK_DEQUES)
+        return tlWorkDeque;
+
+    int index = lNumWorkDeques.fetch_add(1);
+    if (index >= MAX_WORK_DEQUES) {
+        lNumWorkDeques.fetch_sub(1);
+        tlThreadIndex = MAX_WORK_DEQUES;
+        return nullptr;
+    }
+
+    // Deques are never freed, a thread exiting leaves a drained deque behind
+    tlWorkDeque = new ThreadWorkDeques();
+    tlThreadIndex = index;
+    lWorkDeques[index].store(tlWorkDeque, std::memory_order_release);
+    return tlWorkDeque;
+}
+
+static int lGetThreadIndex() {
+    lGetThreadDeque();
+    return tlThreadIndex < MAX_WORK_DEQUES ? tlThreadIndex : 0;
+}
+
+static void lWakeWorkers() {
+    lWorkEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (lNumSleepers.load(std::memory_order_seq_cst) > 0) {
+        // Taking the lock ensures a worker which is about to sleep either
+        // sees the new epoch or is already waiting on the condition.
+        { std::lock_guard<std::mutex> guard(lSleepMutex); }
+        lSleepCondition.notify_all();
+    }
+}
+
+/* For each priority, from the highest: try the deque of the current thread
+   first (most recently launched work, good for locality) then steal from
+   the other threads starting at a pseudo random victim.  Workers on
+   efficiency cores may ask to leave long-running ranges for workers on
+   performance cores.
+ */
+static WorkRange *lFindWork(ThreadWorkDeques *own, uint32_t &seed, bool skipLongRunning = false) {
+    int numDeques = std::min((int)lNumWorkDeques.load(std::memory_order_acquire), MAX_WORK_DEQUES);
+    seed = seed * 1664525u + 1013904223u;
+    int start = numDeques > 0 ? (int)(seed % (uint32_t)numDeques) : 0;
+
+    for (int priority = 0; priority < Mcro::ISPC::LaunchPriorityCount; ++priority) {
+        if (lQueuedCopies[priority].load(std::memory_order_seq_cst) <= 0)
+            continue;
+
+        if (own != nullptr) {
+            if (WorkRange *range = own->byPriority[priority].Pop()) {
+                lQueuedCopies[priority].fetch_sub(1, std::memory_order_relaxed);
+                return range;
+            }
+        }
+
+        for (int i = 0; i < numDeques; ++i) {
+            ThreadWorkDeques *victim = lWorkDeques[(start + i) % numDeques].load(std::memory_order_acquire);
+            if (victim == nullptr || victim == own)
+                continue;
+            WorkDeque &deque = victim->byPriority[priority];
+            if (skipLongRunning) {
+                WorkRange *top = deque.PeekTop();
+                if (top != nullptr && top->preferPerformanceCores)
+                    continue;
+            }
+            if (WorkRange *range = deque.Steal()) {
+                lQueuedCopies[priority].fetch_sub(1, std::memory_order_relaxed);
+                return range;
+            }
+        }
+    }
+    return nullptr;
+}
+
+/* Run tasks of a range until it has no more tasks to claim.  This consumes
+   the copy of the range which was taken from a deque.
+ */
+bool lRunWorkRange(WorkRange *range, int threadIndex) {
+    TaskGroup *tg = range->group;
+    bool ranAny = false;
+    while (1) {
+        int taskNumber = range->nextTask.fetch_add(1, std::memory_order_relaxed);
+        if (taskNumber >= range->count)
+            break;
+
+        lExecuteTask(tg->GetTaskInfo(range->baseIndex + taskNumber), threadIndex, MAX_WORK_DEQUES);
+
+        tg->numUnfinishedTasks.fetch_sub(1, std::memory_order_release);
+        ranAny = true;
+
+        // Background work gives way to queued higher priority work.  The
+        // copy of the range goes back to our deque so it stays claimable,
+        // and it's still counted in numQueuedRanges.
+        if (range->priority == BACKGROUND_PRIORITY && tlWorkDeque != nullptr && lHasUrgentWork() &&
+            range->nextTask.load(std::memory_order_relaxed) < range->count && lPushRange(tlWorkDeque, range))
+            return ranAny;
+    }
+
+    // After this the group may be recycled by its owner, don't touch tg
+    tg->numQueuedRanges.fetch_sub(1, std::memory_order_release);
+    return ranAny;
+}
+
+// Workers on efficiency cores leave long-running ranges alone for this
+// many rounds without work before taking them anyway
+#define EFFICIENCY_WORKER_PATIENCE 32
+
+static void lWorkerEntry(int workerIndex) {
+    bool efficiencyWorker = Mcro::ISPC::Detail::PlaceWorkerThread(workerIndex);
+    ThreadWorkDeques *own = lGetThreadDeque();
+    int threadIndex = lGetThreadIndex();
+    uint32_t seed = (uint32_t)threadIndex * 2654435761u + 1;
+    int idleRounds = 0;
+
+    while (1) {
+        bool skipLongRunning = efficiencyWorker && idleRounds < EFFICIENCY_WORKER_PATIENCE;
+        if (WorkRange *range = lFindWork(own, seed, skipLongRunning)) {
+            lRunWorkRange(range, threadIndex);
+            idleRounds = 0;
+            continue;
+        }
+
+        if (++idleRounds < 64) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nothing to do for a while, go to sleep until new work is launched.
+        int32_t epoch = lWorkEpoch.load(std::memory_order_seq_cst);
+        if (WorkRange *range = lFindWork(own, seed)) {
+            lRunWorkRange(range, threadIndex);
+            idleRounds = 0;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(lSleepMutex);
+        lNumSleepers.fetch_add(1, std::memory_order_seq_cst);
+        lSleepCondition.wait(lock, [epoch] { return lWorkEpoch.load(std::memory_order_seq_cst) != epoch; });
+        lNumSleepers.fetch_sub(1, std::memory_order_seq_cst);
+        idleRounds = 0;
+    }
+}
+
+static void InitTaskSystem() {
+    if (lTaskSystemReady.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> guard(lInitMutex);
+    if (lTaskSystemReady.load(std::memory_order_relaxed))
+        return;
+
+    // We launch one fewer thread than there are cores, since the thread
+    // calling Sync() will also work on tasks.
+    nThreads = Mcro::ISPC::Detail::GetWorkerCount((int)std::thread::hardware_concurrency() - 1);
+    for (int i = 0; i < nThreads; ++i)
+        std::thread(lWorkerEntry, i).detach();
+
+    lTaskSystemReady.store(true, std::memory_order_release);
+}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+    if (numRanges == (int)ranges.size())
+        ranges.push_back(std::make_unique<WorkRange>());
+    WorkRange *range = ranges[numRanges++].get();
+
+    range->group = this;
+    range->baseIndex = baseIndex;
+    range->count = count;
+    range->preferPerformanceCores = preferPerformanceCores;
+    range->priority = (int)priority;
+    range->nextTask.store(0, std::memory_order_relaxed);
+    numUnfinishedTasks.fetch_add(count, std::memory_order_relaxed);
+
+    // Push one copy of the range for each thread which could work on it,
+    // every thread stealing a copy will claim tasks until it's exhausted.
+    ThreadWorkDeques *own = lGetThreadDeque();
+    int copies = std::min(count, nThreads + 1);
+    int pushed = 0;
+    for (; own != nullptr && pushed < copies; ++pushed) {
+        numQueuedRanges.fetch_add(1, std::memory_order_relaxed);
+        if (!lPushRange(own, range)) {
+            numQueuedRanges.fetch_sub(1, std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    if (pushed == 0) {
+        // No deque or it's full, just do the work here
+        numQueuedRanges.fetch_add(1, std::memory_order_relaxed);
+        lRunWorkRange(range, lGetThreadIndex());
+        return;
+    }
+    lWakeWorkers();
+}
+
+inline void TaskGroup::Sync() {
+    ThreadWorkDeques *own = lGetThreadDeque();
+    int threadIndex = lGetThreadIndex();
+    uint32_t seed = (uint32_t)threadIndex * 2654435761u + 7;
+
+    // We're not done until all tasks have finished and no deque refers to
+    // our ranges anymore.  Until then help out with whatever work there is,
+    // in priority order, and within the same priority our own deque comes
+    // first so this prefers our own tasks.
+    while (numUnfinishedTasks.load(std::memory_order_acquire) > 0 ||
+           numQueuedRanges.load(std::memory_order_acquire) > 0) {
+        if (WorkRange *range = lFindWork(own, seed))
+            lRunWorkRange(range, threadIndex);
+        else
+            std::this_thread::yield();
+    }
+}
+
+#endif // ISPC_USE_PTHREADS_WORK_STEALING
+
+///////////////////////////////////////////////////////////////////////////
+// OpenMP
+
+#ifdef ISPC_USE_OMP
+
+static void InitTaskSystem() {
+    // No initialization needed
+}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+#pragma omp parallel
+    {
+        const int threadIndex = omp_get_thread_num();
+        const int threadCount = omp_get_num_threads();
+
+#pragma omp for schedule(runtime)
+        for (int i = 0; i < count; i++) {
+            TaskInfo *ti = GetTaskInfo(baseIndex + i);
+
+            // Actually run the task.
+            lExecuteTask(ti, threadIndex, threadCount);
+        }
+    }
+}
+
+inline void TaskGroup::Sync() {}
+
+#endif // ISPC_USE_OMP
+
+///////////////////////////////////////////////////////////////////////////
+// Thread Building Blocks
+
+#ifdef ISPC_USE_TBB_PARALLEL_FOR
+
+static void InitTaskSystem() {
+    // No initialization needed by default
+    // tbb::task_scheduler_init();
+}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+    tbb::parallel_for(0, count, [=](int i) {
+        TaskInfo *ti = GetTaskInfo(baseIndex + i);
+
+        // Actually run the task.
+        // TBB does not expose the task -> thread mapping so we pretend it's 1:1
+        int threadIndex = ti->taskIndex;
+        int threadCount = ti->taskCount();
+
+        lExecuteTask(ti, threadIndex, threadCount);
+    });
+}
+
+inline void TaskGroup::Sync() {}
+
+#endif // ISPC_USE_TBB_PARALLEL_FOR
+
+#ifdef ISPC_USE_TBB_TASK_GROUP
+
+static void InitTaskSystem() {
+    // No initialization needed by default
+    // tbb::task_scheduler_init();
+}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+    for (int i = 0; i < count; i++) {
+        tbbTaskGroup.run([=]() {
+            TaskInfo *ti = GetTaskInfo(baseIndex + i);
+
+            // TBB does not expose the task -> thread mapping so we pretend it's 1:1
+            int threadIndex = ti->taskIndex;
+            int threadCount = ti->taskCount();
+            lExecuteTask(ti, threadIndex, threadCount);
+        });
+    }
+}
+
+inline void TaskGroup::Sync() { tbbTaskGroup.wait(); }
+
+#endif // ISPC_USE_TBB_TASK_GROUP
+
+///////////////////////////////////////////////////////////////////////////
+// ISPC_USE_HPX
+
+#ifdef ISPC_USE_HPX
+
+static void InitTaskSystem() {}
+
+inline void TaskGroup::Launch(int baseIndex, int count) {
+    for (int i = 0; i < count; ++i) {
+        TaskInfo *ti = GetTaskInfo(baseIndex + i);
+        int threadIndex = i;
+        int threadCount = count;
+        futures.push_back(hpx::async(lExecuteTask, ti, threadIndex, threadCount));
+    }
+}
+
+inline void TaskGroup::Sync() {
+    hpx::wait_all(futures);
+    futures.clear();
+}
+#endif
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef ISPC_USE_PTHREADS_FULLY_SUBSCRIBED
+
+/* Task groups are recycled through a small per-thread cache first, so the
+   common case of launching and syncing on the same thread doesn't touch
+   any shared state.  Groups overflowing the cache (or left behind by
+   exiting threads) go to a shared lock-free stack.
+
+   Once created, task groups are never deleted, which makes reading the
+   link of a group already popped by another thread harmless.  ABA on the
+   shared stack is prevented by a 16 bit tag in the upper bits of its head,
+   the lower 48 bits hold the pointer (enough for user space addresses on
+   all supported 64 bit platforms).
+ */
+#define TASK_GROUP_CACHE_SIZE 16
+#define TASK_GROUP_POINTER_MASK ((1ull << 48) - 1)
+
+static std::atomic<uint64_t> lFreeTaskGroupsHead{0};
+
+static inline TaskGroup *lUnpackTaskGroup(uint64_t head) { return (TaskGroup *)(uintptr_t)(head & TASK_GROUP_POINTER_MASK); }
+
+static inline uint64_t lPackTaskGroup(TaskGroup *tg, uint64_t previousHead) {
+    return ((previousHead & ~TASK_GROUP_POINTER_MASK) + (1ull << 48)) | ((uint64_t)(uintptr_t)tg & TASK_GROUP_POINTER_MASK);
+}
+
+static void lPushSharedTaskGroup(TaskGroup *tg) {
+    uint64_t head = lFreeTaskGroupsHead.load(std::memory_order_relaxed);
+    do {
+        tg->poolNext.store(lUnpackTaskGroup(head), std::memory_order_relaxed);
+    } while (!lFreeTaskGroupsHead.compare_exchange_weak(head, lPackTaskGroup(tg, head), std::memory_order_release,
+                                                        std::memory_order_relaxed));
+}
+
+static TaskGroup *lPopSharedTaskGroup() {
+    uint64_t head = lFreeTaskGroupsHead.load(std::memory_order_acquire);
+    while (TaskGroup *tg = lUnpackTaskGroup(head)) {
+        TaskGroup *next = tg->poolNext.load(std::memory_order_relaxed);
+        if (lFreeTaskGroupsHead.compare_exchange_weak(head, lPackTaskGroup(next, head), std::memory_order_acquire,
+                                                      std::memory_order_acquire))
+            return tg;
+    }
+    return nullptr;
+}
+
+struct ThreadTaskGroupCache {
+    TaskGroup *groups[TASK_GROUP_CACHE_SIZE];
+    int count = 0;
+
+    ~ThreadTaskGroupCache() {
+        // Don't lose cached groups when the thread exits
+        while (count > 0)
+            lPushSharedTaskGroup(groups[--count]);
+    }
+};
+
+static thread_local ThreadTaskGroupCache tlTaskGroupCache;
+
+static inline TaskGroup *AllocTaskGroup() {
+    ThreadTaskGroupCache &cache = tlTaskGroupCache;
+    if (cache.count > 0)
+        return cache.groups[--cache.count];
+
+    if (TaskGroup *tg = lPopSharedTaskGroup()) {
+        Mcro::ISPC::Detail::CountTaskGroupPoolEvent(Mcro::ISPC::Detail::ETaskGroupPoolEvent::SharedPoolHit);
+        return tg;
+    }
+
+    Mcro::ISPC::Detail::CountTaskGroupPoolEvent(Mcro::ISPC::Detail::ETaskGroupPoolEvent::Created);
+    return new TaskGroup;
+}
+
+static inline void FreeTaskGroup(TaskGroup *tg) {
+    tg->Reset();
+
+    ThreadTaskGroupCache &cache = tlTaskGroupCache;
+    if (cache.count < TASK_GROUP_CACHE_SIZE) {
+        cache.groups[cache.count++] = tg;
+        return;
+    }
+
+    Mcro::ISPC::Detail::CountTaskGroupPoolEvent(Mcro::ISPC::Detail::ETaskGroupPoolEvent::SharedPoolReturn);
+    lPushSharedTaskGroup(tg);
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+// Number of threads the current task system runs tasks on
+static inline int lWorkerCount() {
+#if defined ISPC_USE_UE_TASKS
+    return (int)LowLevelTasks::FScheduler::Get().GetNumWorkers() + 1;
+#elif defined ISPC_USE_PTHREADS || defined ISPC_USE_PTHREADS_WORK_STEALING
+    return nThreads + 1;
+#else
+    return std::max(1, (int)std::thread::hardware_concurrency());
+#endif
+}
+
+void ISPCLaunch(void **taskGroupPtr, void *func, void *data, int count0, int count1, int count2) {
+    const int count = count0 * count1 * count2;
+    TaskGroup *taskGroup;
+    if (*taskGroupPtr == nullptr) {
+        InitTaskSystem();
+        taskGroup = AllocTaskGroup();
+        taskGroup->priority = Mcro::ISPC::GetLaunchPriority();
+        *taskGroupPtr = taskGroup;
+    } else
+        taskGroup = (TaskGroup *)(*taskGroupPtr);
+
+    const Mcro::ISPC::Detail::FTaskTraceSpecs *traceSpecs = Mcro::ISPC::Detail::GetTaskTraceSpecs(func);
+    Mcro::ISPC::Detail::FTaskTraceScope traceScope(traceSpecs, Mcro::ISPC::Detail::ETraceSpan::Launch);
+    Mcro::ISPC::Detail::TraceLaunch(traceSpecs, func, count0, count1, count2);
+    taskGroup->traceSpecs = traceSpecs;
+
+    // Many tiny tasks may be coalesced into fewer chunks of consecutive
+    // task indices, see Mcro::ISPC::FTaskCoalescingSettings
+    const Mcro::ISPC::Detail::FLaunchPlan plan = Mcro::ISPC::Detail::PlanLaunch(func, count, lWorkerCount());
+    const int chunks = plan.Chunks;
+    Mcro::ISPC::Detail::FTaskTimingStats *timingStats = plan.TimingStats;
+    taskGroup->preferPerformanceCores = plan.bPreferPerformanceCores;
+
+    int baseIndex = taskGroup->AllocTaskInfo(chunks);
+    for (int i = 0; i < chunks; ++i) {
+        TaskInfo *ti = taskGroup->GetTaskInfo(baseIndex + i);
+        ti->func = (TaskFuncType)func;
+        ti->data = data;
+        ti->taskIndex = (int)((int64_t)count * i / chunks);
+        ti->taskSpan = (int)((int64_t)count * (i + 1) / chunks) - ti->taskIndex;
+        ti->taskCount3d[0] = count0;
+        ti->taskCount3d[1] = count1;
+        ti->taskCount3d[2] = count2;
+        ti->timingStats = timingStats;
+        ti->traceSpecs = traceSpecs;
+        ti->priority = taskGroup->priority;
+        ti->claimed.store(false, std::memory_order_relaxed);
+    }
+    taskGroup->Launch(baseIndex, chunks);
+}
+
+void ISPCSync(void *h) {
+    TaskGroup *taskGroup = (TaskGroup *)h;
+    if (taskGroup != nullptr) {
+        {
+            Mcro::ISPC::Detail::FTaskTraceScope traceScope(taskGroup->traceSpecs, Mcro::ISPC::Detail::ETraceSpan::Sync);
+            taskGroup->Sync();
+        }
+        FreeTaskGroup(taskGroup);
+    }
+}
+
+void *ISPCAlloc(void **taskGroupPtr, int64_t size, int32_t alignment) {
+    TaskGroup *taskGroup;
+    if (*taskGroupPtr == nullptr) {
+        InitTaskSystem();
+        taskGroup = AllocTaskGroup();
+        taskGroup->priority = Mcro::ISPC::GetLaunchPriority();
+        *taskGroupPtr = taskGroup;
+    } else
+        taskGroup = (TaskGroup *)(*taskGroupPtr);
+
+    return taskGroup->AllocMemory(size, alignment);
+}
+
+#else // ISPC_USE_PTHREADS_FULLY_SUBSCRIBED
+
+#define MAX_LIVE_TASKS 1024
+
+pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Small structure used to hold the data for each task
+struct Task {
+  public:
+    TaskFuncType func;
+    void *data;
+    volatile int32_t taskIndex;
+    int taskCount;
+
+    volatile int numDone;
+    int liveIndex; // index in live task queue
+
+    inline int noMoreWork() { return taskIndex >= taskCount; }
+    /*! given thread is done working on this task --> decrease num locks */
+    // inline void lock() { lAtomicAdd(&locks,1); }
+    // inline void unlock() { lAtomicAdd(&locks,-1); }
+    inline int nextJob() { return lAtomicAdd(&taskIndex, 1); }
+    inline int numJobs() { return taskCount; }
+    inline void schedule(int idx) {
+        taskIndex = 0;
+        numDone = 0;
+        liveIndex = idx;
+    }
+    inline void run(int idx, int threadIdx);
+    inline void markOneDone() { lAtomicAdd(&numDone, 1); }
+    inline void wait() {
+        while (!noMoreWork()) {
+            int next = nextJob();
+            if (next < numJobs())
+                run(next, 0);
+        }
+        while (numDone != taskCount) {
+            usleep(1);
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////
+class TaskSys {
+    static int numThreadsRunning;
+    struct LiveTask {
+        volatile int locks;  /*!< num locks on this task. gets
+                                  initialized to NUM_THREADS+1, then counted
+                                  down by every thread that sees this. this
+                                  value is only valid when 'active' is set
+                                  to true */
+        volatile int active; /*! workers will spin on this until it
+                                 becomes active */
+        Task *task;
+
+        inline void doneWithThis() { lAtomicAdd(&locks, -1); }
+        LiveTask() : active(0), locks(-1) {}
+    };
+
+  public:
+    volatile int nextScheduleIndex; /*! next index in the task queue
+                                        where we'll insert a live task */
+
+    // inline int inc_begin() { int old = begin; begin = (begin+1)%MAX_TASKS; return old; }
+    // inline int inc_end() { int old = end; end = (end+1)%MAX_TASKS; return old; }
+
+    LiveTask taskQueue[MAX_LIVE_TASKS];
+    std::stack<Task *> taskMem;
+
+    static TaskSys *global;
+
+    TaskSys() : nextScheduleIndex(0) {
+        TaskSys::global = this;
+        Task *mem = new Task[MAX_LIVE_TASKS]; //< could actually be more than _live_ tasks
+        for (int i = 0; i < MAX_LIVE_TASKS; i++) {
+            taskMem.push(mem + i);
+        }
+        createThreads();
+    }
+
+    inline Task *allocOne() {
+        pthread_mutex_lock(&mutex);
+        if (taskMem.empty()) {
+            fprintf(stderr, "Too many live tasks.  "
+                            "Change the value of MAX_LIVE_TASKS and recompile.\n");
+            exit(1);
+        }
+        Task *task = taskMem.top();
+        taskMem.pop();
+        pthread_mutex_unlock(&mutex);
+        return task;
+    }
+
+    static inline void init() {
+        if (global)
+            return;
+        pthread_mutex_lock(&mutex);
+        if (global == nullptr)
+            global = new TaskSys;
+        pthread_mutex_unlock(&mutex);
+    }
+
+    void createThreads();
+    int nThreads;
+    pthread_t *thread;
+
+    void threadFct();
+
+    inline void schedule(Task *t) {
+        pthread_mutex_lock(&mutex);
+        int liveIndex = nextScheduleIndex;
+        nextScheduleIndex = (nextScheduleIndex + 1) % MAX_LIVE_TASKS;
+        if (taskQueue[liveIndex].active) {
+            fprintf(stderr, "Out of task queue resources.  "
+                            "Change the value of MAX_LIVE_TASKS and recompile.\n");
+            exit(1);
+        }
+        taskQueue[liveIndex].task = t;
+        t->schedule(liveIndex);
+        taskQueue[liveIndex].locks = numThreadsRunning + 1; // num _worker_ threads plus creator
+        taskQueue[liveIndex].active = true;
+        pthread_mutex_unlock(&mutex);
+    }
+
+    void sync(Task *task) {
+        task->wait();
+        int liveIndex = task->liveIndex;
+        while (taskQueue[liveIndex].locks > 1) {
+            usleep(1);
+        }
+        _mm_free(task->data);
+        pthread_mutex_lock(&mutex);
+        taskMem.push(task); // recycle task index
+        taskQueue[liveIndex].active = false;
+        pthread_mutex_unlock(&mutex);
+    }
+};
+
+void TaskSys::threadFct() {
+    int myIndex = 0; // lAtomicAdd(&threadIdx,1);
+    while (1) {
+        while (!taskQueue[myIndex].active) {
+            usleep(4);
+            continue;
+        }
+
+        Task *mine = taskQueue[myIndex].task;
+        while (!mine->noMoreWork()) {
+            int job = mine->nextJob();
+            if (job >= mine->numJobs())
+                break;
+            mine->run(job, myIndex);
+        }
+        taskQueue[myIndex].doneWithThis();
+        myIndex = (myIndex + 1) % MAX_LIVE_TASKS;
+    }
+}
+
+inline void Task::run(int idx, int threadIdx) {
+    (*this->func)(data, threadIdx, TaskSys::global->nThreads, idx, taskCount);
+    markOneDone();
+}
+
+void *_threadFct(void *data) {
+    ((TaskSys *)data)->threadFct();
+    return nullptr;
+}
+
+void TaskSys::createThreads() {
+    init();
+    int reserved = 4;
+    int minid = 2;
+    nThreads = sysconf(_SC_NPROCESSORS_ONLN) - reserved;
+
+    thread = (pthread_t *)malloc(nThreads * sizeof(pthread_t));
+
+    numThreadsRunning = 0;
+    for (int i = 0; i < nThreads; ++i) {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setstacksize(&attr, 2 * 1024 * 1024);
+
+        int threadID = minid + i;
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(threadID, &cpuset);
+        int ret = pthread_attr_setaffinity_np(&attr, sizeof(cpuset), &cpuset);
+
+        int err = pthread_create(&thread[i], &attr, &_threadFct, this);
+        ++numThreadsRunning;
+        if (err != 0) {
+            fprintf(stderr, "Error creating pthread %d: %s\n", i, strerror(err));
+            exit(1);
+        }
+    }
+}
+
+TaskSys *TaskSys::global = nullptr;
+int TaskSys::numThreadsRunning = 0;
+
+///////////////////////////////////////////////////////////////////////////
+
+void ISPCLaunch(void **taskGroupPtr, void *func, void *data, int count) {
+    Task *ti = *(Task **)taskGroupPtr;
+    ti->func = (TaskFuncType)func;
+    ti->data = data;
+    ti->taskIndex = 0;
+    ti->taskCount = count;
+    TaskSys::global->schedule(ti);
+}
+
+void ISPCSync(void *h) {
+    Task *task = (Task *)h;
+    assert(task);
+    TaskSys::global->sync(task);
+}
+
+void *ISPCAlloc(void **taskGroupPtr, int64_t size, int32_t alignment) {
+    TaskSys::init();
+    Task *task = TaskSys::global->allocOne();
+    *taskGroupPtr = task;
+    task->data = _mm_malloc(size, alignment);
+    return task->data; //*taskGroupPtr;
+}
+
+#endif // ISPC_USE_PTHREADS_FULLY_SUBSCRIBED
+
+///////////////////////////////////////////////////////////////////////////
+
+#ifndef ISPC_USE_PTHREADS_FULLY_SUBSCRIBED
+static int lTaskSystemWorkerCount() {
+    InitTaskSystem();
+    return lWorkerCount();
+}
+
+extern const FTaskSystemInterface Interface{
+    TEXT(PREPROCESSOR_TO_STRING(ISPC_TASK_SYSTEM)), ISPCLaunch, ISPCAlloc, ISPCSync, lTaskSystemWorkerCount};
+#else
+#error "ISPC_USE_PTHREADS_FULLY_SUBSCRIBED is not supported by the MCRO task system dispatcher"
+#endif
+
+} // namespace Mcro::ISPC::Detail::ISPC_TASK_SYSTEM
@@ -0,0 +1,143 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroISPC/LaunchGraph.h"
+#include "McroISPC/IspcParallelism.h"
+#include "McroISPC/TaskTrace.h"
+#include "McroISPC/UETaskPriority.h"
+#include "Mcro/AssertMacros.h"
+#include "Mcro/TextMacros.h"
+
+namespace Mcro::ISPC
+{
+	FLaunchGraph::~FLaunchGraph()
+	{
+		if (!Tasks.IsEmpty()) UE::Tasks::Wait(Sinks);
+	}
+
+	FLaunchNode FLaunchGraph::Add(
+		const TCHAR* name,
+		FTaskFunction taskFunction, void* data,
+		int32 countX, int32 countY, int32 countZ,
+		TConstArrayView<FLaunchNode> prerequisites
+	) {
+		ASSERT_CRASH(taskFunction);
+		return AddNode(
+			{
+				.Name = name,
+				.TaskFunction = taskFunction,
+				.Data = data,
+				.Count = { countX, countY, countZ }
+			},
+			prerequisites
+		);
+	}
+
+	FLaunchNode FLaunchGraph::Add(
+		const TCHAR* name,
+		int32 taskCount,
+		FTaskBody&& body,
+		TConstArrayView<FLaunchNode> prerequisites
+	) {
+		ASSERT_CRASH(body);
+		return AddNode(
+			{
+				.Name = name,
+				.TaskFunction = &FLaunchGraph::RunBody,
+				.Count = { taskCount, 1, 1 },
+				.Body = MoveTemp(body)
+			},
+			prerequisites
+		);
+	}
+
+	FLaunchNode FLaunchGraph::AddNode(FNode&& node, TConstArrayView<FLaunchNode> prerequisites)
+	{
+		ASSERT_CRASH(Tasks.IsEmpty(),
+			->WithMessage(TEXT_"Nodes cannot be added to an ISPC launch graph after it has been run")
+		);
+		for (FLaunchNode prerequisite : prerequisites)
+		{
+			ASSERT_CRASH(prerequisite.IsValid() && prerequisite.Index < Nodes.Num(),
+				->WithMessage(TEXT_"Prerequisites of an ISPC launch graph node must be added to the same graph before it")
+				->WithAppendix(TEXT_"Prerequisite", FString::FromInt(prerequisite.Index))
+				->WithAppendix(TEXT_"Node count", FString::FromInt(Nodes.Num()))
+			);
+			node.Prerequisites.AddUnique(prerequisite.Index);
+			Nodes[prerequisite.Index].bHasDependents = true;
+		}
+		node.Priority = GetLaunchPriority();
+		return { Nodes.Add(MoveTemp(node)) };
+	}
+
+	void FLaunchGraph::RunBody(
+		void* data, int threadIndex, int threadCount,
+		int taskIndex, int taskCount,
+		int taskIndex0, int taskIndex1, int taskIndex2,
+		int taskCount0, int taskCount1, int taskCount2
+	) {
+		static_cast<const FNode*>(data)->Body(taskIndex, taskCount);
+	}
+
+	void FLaunchGraph::Run()
+	{
+		if (!Tasks.IsEmpty() || Nodes.IsEmpty()) return;
+
+		Tasks.Reserve(Nodes.Num());
+		for (const FNode& node : Nodes)
+		{
+			TArray<UE::Tasks::FTask, TInlineAllocator<4>> prerequisites;
+			for (int32 prerequisite : node.Prerequisites)
+				prerequisites.Add(Tasks[prerequisite]);
+
+			Tasks.Add(UE::Tasks::Launch(
+				node.Name ? node.Name : TEXT("Mcro.IspcLaunchGraph"),
+				[&node]
+				{
+					const int32 taskCount = node.Count[0] * node.Count[1] * node.Count[2];
+					if (taskCount <= 0) return;
+
+					MCRO_ISPC_TASK_NAME(node.Name);
+					MCRO_ISPC_LAUNCH_PRIORITY(node.Priority);
+					void* data = node.Body ? const_cast<FNode*>(&node) : node.Data;
+					void* taskGroup = nullptr;
+					ISPCLaunch(&taskGroup, reinterpret_cast<void*>(node.TaskFunction), data, node.Count[0], node.Count[1], node.Count[2]);
+
+					// Sync is cooperative, this thread runs tasks of the node until all of them finished
+					ISPCSync(taskGroup);
+				},
+				UE::Tasks::Prerequisites(prerequisites),
+				Detail::GetUETaskPriority(node.Priority)
+			));
+		}
+
+		for (int32 i = 0; i < Nodes.Num(); ++i)
+		{
+			if (!Nodes[i].bHasDependents) Sinks.Add(Tasks[i]);
+		}
+	}
+
+	void FLaunchGraph::Wait()
+	{
+		Run();
+		UE::Tasks::Wait(Sinks);
+	}
+
+	bool FLaunchGraph::IsCompleted() const
+	{
+		if (Tasks.IsEmpty()) return Nodes.IsEmpty();
+		for (const UE::Tasks::FTask& sink : Sinks)
+		{
+			if (!sink.IsCompleted()) return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,346 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroISPC/Numeric.h"
+
+#if INTEL_ISPC
+#include "Numeric.ispc.generated.h"
+#else
+#include "Async/ParallelFor.h"
+#endif
+
+namespace Mcro::ISPC
+{
+	namespace
+	{
+		/** @brief Partial results of reductions are kept on the stack, so the task count is capped */
+		constexpr int32 GMaxNumericTasks = 64;
+
+		template <typename T>
+		using TPartials = TArray<T, TInlineAllocator<GMaxNumericTasks>>;
+
+		int32 GetTaskCount(int32 num)
+		{
+			return FMath::Clamp(num / NumericElementsPerTask, 1, GMaxNumericTasks);
+		}
+
+#if !INTEL_ISPC
+		/** @brief Run the same slices as the ISPC kernels would, with ParallelFor */
+		template <typename Function>
+		void ForEachSlice(int32 num, int32 taskCount, Function&& function)
+		{
+			ParallelFor(taskCount, [&](int32 task)
+			{
+				const int32 begin = static_cast<int32>(static_cast<int64>(num) * task / taskCount);
+				const int32 end = static_cast<int32>(static_cast<int64>(num) * (task + 1) / taskCount);
+				function(task, begin, end);
+			});
+		}
+#endif
+
+		template <typename T>
+		T SumPartials(TPartials<T> const& partials)
+		{
+			T result = 0;
+			for (T partial : partials)
+				result += partial;
+			return result;
+		}
+
+		template <typename T>
+		TMinMax<T> CombineMinMax(TPartials<T> const& mins, TPartials<T> const& maxs)
+		{
+			TMinMax<T> result { mins[0], maxs[0] };
+			for (int32 i = 1; i < mins.Num(); ++i)
+			{
+				result.Min = FMath::Min(result.Min, mins[i]);
+				result.Max = FMath::Max(result.Max, maxs[i]);
+			}
+			return result;
+		}
+
+		/** @brief Turn per-slice sums into the sum of all slices before each one */
+		template <typename T>
+		void ExclusiveScan(TPartials<T>& partials)
+		{
+			T carry = 0;
+			for (T& partial : partials)
+			{
+				T sum = partial;
+				partial = carry;
+				carry += sum;
+			}
+		}
+	}
+
+	float Sum(TConstArrayView<float> values)
+	{
+		const int32 num = values.Num();
+		const int32 taskCount = GetTaskCount(num);
+		TPartials<float> partials;
+		partials.SetNumZeroed(taskCount);
+#if INTEL_ISPC
+		ispc::SumFloat(values.GetData(), num, partials.GetData(), taskCount);
+#else
+		ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+		{
+			for (int32 i = begin; i < end; ++i)
+				partials[task] += values[i];
+		});
+#endif
+		return SumPartials(partials);
+	}
+
+	int64 Sum(TConstArrayView<int32> values)
+	{
+		const int32 num = values.Num();
+		const int32 taskCount = GetTaskCount(num);
+		TPartials<int64> partials;
+		partials.SetNumZeroed(taskCount);
+#if INTEL_ISPC
+		ispc::SumInt(values.GetData(), num, partials.GetData(), taskCount);
+#else
+		ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+		{
+			for (int32 i = begin; i < end; ++i)
+				partials[task] += values[i];
+		});
+#endif
+		return SumPartials(partials);
+	}
+
+	namespace
+	{
+		template <typename T>
+		TOptional<TMinMax<T>> MinMaxImpl(TConstArrayView<T> values)
+		{
+			const int32 num = values.Num();
+			if (num == 0) return {};
+
+			const int32 taskCount = GetTaskCount(num);
+			TPartials<T> mins;
+			TPartials<T> maxs;
+			mins.SetNumUninitialized(taskCount);
+			maxs.SetNumUninitialized(taskCount);
+#if INTEL_ISPC
+			if constexpr (std::is_same_v<T, float>)
+				ispc::MinMaxFloat(values.GetData(), num, mins.GetData(), maxs.GetData(), taskCount);
+			else
+				ispc::MinMaxInt(values.GetData(), num, mins.GetData(), maxs.GetData(), taskCount);
+#else
+			ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+			{
+				T low = values[begin];
+				T high = values[begin];
+				for (int32 i = begin + 1; i < end; ++i)
+				{
+					low = FMath::Min(low, values[i]);
+					high = FMath::Max(high, values[i]);
+				}
+				mins[task] = low;
+				maxs[task] = high;
+			});
+#endif
+			return CombineMinMax(mins, maxs);
+		}
+
+		template <typename T>
+		void PrefixSumImpl(TConstArrayView<T> values, TArrayView<T> result)
+		{
+			const int32 num = values.Num();
+			check(result.Num() == num);
+			if (num == 0) return;
+
+			const int32 taskCount = GetTaskCount(num);
+			TPartials<std::conditional_t<std::is_same_v<T, float>, float, int64>> sums;
+			sums.SetNumZeroed(taskCount);
+			TPartials<T> offsets;
+#if INTEL_ISPC
+			if constexpr (std::is_same_v<T, float>)
+				ispc::SumFloat(values.GetData(), num, sums.GetData(), taskCount);
+			else
+				ispc::SumInt(values.GetData(), num, sums.GetData(), taskCount);
+#else
+			ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+			{
+				for (int32 i = begin; i < end; ++i)
+					sums[task] += values[i];
+			});
+#endif
+			for (auto sum : sums)
+				offsets.Add(static_cast<T>(sum));
+			ExclusiveScan(offsets);
+
+#if INTEL_ISPC
+			if constexpr (std::is_same_v<T, float>)
+				ispc::PrefixSumFloat(values.GetData(), result.GetData(), offsets.GetData(), num, taskCount);
+			else
+				ispc::PrefixSumInt(values.GetData(), result.GetData(), offsets.GetData(), num, taskCount);
+#else
+			ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+			{
+				T carry = offsets[task];
+				for (int32 i = begin; i < end; ++i)
+				{
+					if constexpr (std::is_same_v<T, float>) carry += values[i];
+					else carry = static_cast<T>(static_cast<uint32>(carry) + static_cast<uint32>(values[i]));
+					result[i] = carry;
+				}
+			});
+#endif
+		}
+
+		template <typename T>
+		void GatherImpl(TConstArrayView<T> source, TConstArrayView<int32> indices, TArrayView<T> result)
+		{
+			static_assert(sizeof(T) == sizeof(int32));
+			const int32 num = indices.Num();
+			check(result.Num() == num);
+			if (num == 0) return;
+
+#if DO_GUARD_SLOW
+			for (int32 index : indices)
+				checkSlow(source.IsValidIndex(index));
+#endif
+			const int32 taskCount = GetTaskCount(num);
+#if INTEL_ISPC
+			ispc::Gather32(
+				reinterpret_cast<const int32*>(source.GetData()),
+				indices.GetData(),
+				reinterpret_cast<int32*>(result.GetData()),
+				num, taskCount
+			);
+#else
+			ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+			{
+				for (int32 i = begin; i < end; ++i)
+					result[i] = source[indices[i]];
+			});
+#endif
+		}
+
+		template <typename T>
+		void TransformAffineImpl(TConstArrayView<T> values, TArrayView<T> result, T scale, T offset)
+		{
+			const int32 num = values.Num();
+			check(result.Num() == num);
+			if (num == 0) return;
+
+			const int32 taskCount = GetTaskCount(num);
+#if INTEL_ISPC
+			if constexpr (std::is_same_v<T, float>)
+				ispc::AffineFloat(values.GetData(), result.GetData(), scale, offset, num, taskCount);
+			else
+				ispc::AffineInt(values.GetData(), result.GetData(), scale, offset, num, taskCount);
+#else
+			ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+			{
+				for (int32 i = begin; i < end; ++i)
+				{
+					if constexpr (std::is_same_v<T, float>)
+						result[i] = values[i] * scale + offset;
+					else
+						result[i] = static_cast<T>(static_cast<uint32>(values[i]) * static_cast<uint32>(scale) + static_cast<uint32>(offset));
+				}
+			});
+#endif
+		}
+	}
+
+	TOptional<TMinMax<float>> MinMax(TConstArrayView<float> values) { return MinMaxImpl(values); }
+	TOptional<TMinMax<int32>> MinMax(TConstArrayView<int32> values) { return MinMaxImpl(values); }
+
+	float Dot(TConstArrayView<float> a, TConstArrayView<float> b)
+	{
+		const int32 num = a.Num();
+		check(b.Num() == num);
+		const int32 taskCount = GetTaskCount(num);
+		TPartials<float> partials;
+		partials.SetNumZeroed(taskCount);
+#if INTEL_ISPC
+		ispc::DotFloat(a.GetData(), b.GetData(), num, partials.GetData(), taskCount);
+#else
+		ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+		{
+			for (int32 i = begin; i < end; ++i)
+				partials[task] += a[i] * b[i];
+		});
+#endif
+		return SumPartials(partials);
+	}
+
+	void PrefixSum(TConstArrayView<float> values, TArrayView<float> result) { PrefixSumImpl(values, result); }
+	void PrefixSum(TConstArrayView<int32> values, TArrayView<int32> result) { PrefixSumImpl(values, result); }
+
+	void Histogram(TConstArrayView<float> values, float low, float high, TArrayView<int32> bins)
+	{
+		FMemory::Memzero(bins.GetData(), bins.NumBytes());
+		const int32 binCount = bins.Num();
+		const int32 num = values.Num();
+		if (binCount == 0 || num == 0 || !(high >= low)) return;
+
+		// A degenerate interval (or one too narrow to divide into bins) puts everything equal to low or high into the
+		// last bin, like values equal to high are counted otherwise
+		const float binsPerUnit = binCount / (high - low);
+		if (!FMath::IsFinite(binsPerUnit))
+		{
+			for (const float value : values)
+			{
+				if (value >= low && value <= high) ++bins[binCount - 1];
+			}
+			return;
+		}
+
+		const float lastBin = static_cast<float>(binCount - 1);
+		const int32 taskCount = GetTaskCount(num);
+		TArray<int32> scratch;
+		scratch.SetNumZeroed(taskCount * binCount);
+#if INTEL_ISPC
+		ispc::HistogramFloat(values.GetData(), num, low, high, binsPerUnit, binCount, scratch.GetData(), taskCount);
+#else
+		ForEachSlice(num, taskCount, [&](int32 task, int32 begin, int32 end)
+		{
+			int32* taskBins = scratch.GetData() + task * binCount;
+			for (int32 i = begin; i < end; ++i)
+			{
+				const float value = values[i];
+				if (value >= low && value <= high)
+					++taskBins[static_cast<int32>(FMath::Min((value - low) * binsPerUnit, lastBin))];
+			}
+		});
+#endif
+		for (int32 task = 0; task < taskCount; ++task)
+		{
+			for (int32 bin = 0; bin < binCount; ++bin)
+				bins[bin] += scratch[task * binCount + bin];
+		}
+	}
+
+	void Gather(TConstArrayView<float> source, TConstArrayView<int32> indices, TArrayView<float> result)
+	{
+		GatherImpl(source, indices, result);
+	}
+
+	void Gather(TConstArrayView<int32> source, TConstArrayView<int32> indices, TArrayView<int32> result)
+	{
+		GatherImpl(source, indices, result);
+	}
+
+	void TransformAffine(TConstArrayView<float> values, TArrayView<float> result, float scale, float offset)
+	{
+		TransformAffineImpl(values, result, scale, offset);
+	}
+
+	void TransformAffine(TConstArrayView<int32> values, TArrayView<int32> result, int32 scale, int32 offset)
+	{
+		TransformAffineImpl(values, result, scale, offset);
+	}
+}
@@ -0,0 +1,233 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroISPC/PixelFormats.h"
+
+#if INTEL_ISPC
+#include "PixelFormats.ispc.generated.h"
+#else
+#include "Async/ParallelFor.h"
+#endif
+
+namespace Mcro::Rendering::Textures
+{
+	namespace Detail
+	{
+		/** @brief Memory layouts the kernels understand, same order as in PixelFormats.ispc */
+		enum class EPixelLayout : int32
+		{
+			BGRA8,
+			RGBA8,
+			RGBA16F,
+			RGB10A2,
+			Unsupported
+		};
+
+		EPixelLayout GetPixelLayout(EPixelFormat format)
+		{
+			switch (format)
+			{
+			case PF_B8G8R8A8: return EPixelLayout::BGRA8;
+			case PF_R8G8B8A8: return EPixelLayout::RGBA8;
+			case PF_FloatRGBA: return EPixelLayout::RGBA16F;
+			case PF_A2B10G10R10: return EPixelLayout::RGB10A2;
+			default: return EPixelLayout::Unsupported;
+			}
+		}
+
+		int32 GetPixelBytes(EPixelLayout layout)
+		{
+			return layout == EPixelLayout::RGBA16F ? 8 : 4;
+		}
+
+		/** @brief Aim for at least this many pixels per task, so tiny images are not split at all */
+		constexpr int32 GPixelsPerTask = 64 * 1024;
+
+		int32 GetTaskCount(int32 width, int32 height)
+		{
+			return FMath::Clamp(static_cast<int32>(static_cast<int64>(width) * height / GPixelsPerTask), 1, height);
+		}
+
+#if !INTEL_ISPC
+		struct FPixel { float R, G, B, A; };
+
+		float SrgbToLinear(float c)
+		{
+			return c <= 0.04045f ? c * (1.0f / 12.92f) : FMath::Pow((c + 0.055f) * (1.0f / 1.055f), 2.4f);
+		}
+
+		float LinearToSrgb(float c)
+		{
+			c = FMath::Clamp(c, 0.0f, 1.0f);
+			return c <= 0.0031308f ? c * 12.92f : 1.055f * FMath::Pow(c, 1.0f / 2.4f) - 0.055f;
+		}
+
+		uint32 ToUnorm(float c, float scale)
+		{
+			return static_cast<uint32>(FMath::Clamp(c, 0.0f, 1.0f) * scale + 0.5f);
+		}
+
+		FPixel Decode(const uint8* pixel, EPixelLayout layout)
+		{
+			if (layout == EPixelLayout::RGBA16F)
+			{
+				const FFloat16* halves = reinterpret_cast<const FFloat16*>(pixel);
+				return { halves[0].GetFloat(), halves[1].GetFloat(), halves[2].GetFloat(), halves[3].GetFloat() };
+			}
+
+			uint32 packed;
+			FMemory::Memcpy(&packed, pixel, sizeof(uint32));
+			if (layout == EPixelLayout::RGB10A2)
+			{
+				return {
+					(packed & 0x3FF) / 1023.0f,
+					((packed >> 10) & 0x3FF) / 1023.0f,
+					((packed >> 20) & 0x3FF) / 1023.0f,
+					(packed >> 30) / 3.0f
+				};
+			}
+
+			const float first = (packed & 0xFF) / 255.0f;
+			const float third = ((packed >> 16) & 0xFF) / 255.0f;
+			return {
+				layout == EPixelLayout::BGRA8 ? third : first,
+				((packed >> 8) & 0xFF) / 255.0f,
+				layout == EPixelLayout::BGRA8 ? first : third,
+				(packed >> 24) / 255.0f
+			};
+		}
+
+		void Encode(uint8* pixel, EPixelLayout layout, FPixel const& color)
+		{
+			if (layout == EPixelLayout::RGBA16F)
+			{
+				FFloat16* halves = reinterpret_cast<FFloat16*>(pixel);
+				halves[0] = color.R;
+				halves[1] = color.G;
+				halves[2] = color.B;
+				halves[3] = color.A;
+				return;
+			}
+
+			uint32 packed;
+			if (layout == EPixelLayout::RGB10A2)
+			{
+				packed = ToUnorm(color.R, 1023.0f)
+					| (ToUnorm(color.G, 1023.0f) << 10)
+					| (ToUnorm(color.B, 1023.0f) << 20)
+					| (ToUnorm(color.A, 3.0f) << 30);
+			}
+			else
+			{
+				const uint32 first = ToUnorm(layout == EPixelLayout::BGRA8 ? color.B : color.R, 255.0f);
+				const uint32 third = ToUnorm(layout == EPixelLayout::BGRA8 ? color.R : color.B, 255.0f);
+				packed = first
+					| (ToUnorm(color.G, 255.0f) << 8)
+					| (third << 16)
+					| (ToUnorm(color.A, 255.0f) << 24);
+			}
+			FMemory::Memcpy(pixel, &packed, sizeof(uint32));
+		}
+#endif
+	}
+
+	bool CanConvertPixels(EPixelFormat from, EPixelFormat to)
+	{
+		using namespace Detail;
+		return GetPixelLayout(from) != EPixelLayout::Unsupported && GetPixelLayout(to) != EPixelLayout::Unsupported;
+	}
+
+	bool ConvertPixels(const void* source, void* destination, int32 width, int32 height, FPixelConversion const& conversion)
+	{
+		using namespace Detail;
+		const EPixelLayout sourceLayout = GetPixelLayout(conversion.SourceFormat);
+		const EPixelLayout destinationLayout = GetPixelLayout(conversion.DestinationFormat);
+		if (sourceLayout == EPixelLayout::Unsupported || destinationLayout == EPixelLayout::Unsupported)
+			return false;
+		if (width <= 0 || height <= 0)
+			return true;
+
+		const uint8* sourceBytes = static_cast<const uint8*>(source);
+		uint8* destinationBytes = static_cast<uint8*>(destination);
+		const int32 sourceRowBytes = conversion.SourceRowBytes > 0
+			? conversion.SourceRowBytes
+			: width * GetPixelBytes(sourceLayout);
+		const int32 destinationRowBytes = conversion.DestinationRowBytes > 0
+			? conversion.DestinationRowBytes
+			: width * GetPixelBytes(destinationLayout);
+
+		// Decoding then encoding with the same transfer function gives back the same values
+		const bool transferChanges = conversion.bSourceSrgb != conversion.bDestinationSrgb;
+		if (sourceLayout == destinationLayout && !transferChanges)
+		{
+			if (sourceBytes == destinationBytes && sourceRowBytes == destinationRowBytes)
+				return true;
+			const int32 rowBytes = width * GetPixelBytes(sourceLayout);
+			for (int32 y = 0; y < height; ++y)
+				FMemory::Memcpy(destinationBytes + int64(y) * destinationRowBytes, sourceBytes + int64(y) * sourceRowBytes, rowBytes);
+			return true;
+		}
+
+		const int32 taskCount = GetTaskCount(width, height);
+		const bool swizzleOnly = !transferChanges
+			&& (sourceLayout == EPixelLayout::BGRA8 || sourceLayout == EPixelLayout::RGBA8)
+			&& (destinationLayout == EPixelLayout::BGRA8 || destinationLayout == EPixelLayout::RGBA8);
+
+#if INTEL_ISPC
+		if (swizzleOnly)
+		{
+			ispc::SwapRedBlue(
+				sourceBytes, sourceRowBytes,
+				destinationBytes, destinationRowBytes,
+				width, height, taskCount
+			);
+		}
+		else
+		{
+			ispc::ConvertPixels(
+				sourceBytes, static_cast<int32>(sourceLayout), sourceRowBytes, conversion.bSourceSrgb,
+				destinationBytes, static_cast<int32>(destinationLayout), destinationRowBytes, conversion.bDestinationSrgb,
+				width, height, taskCount
+			);
+		}
+#else
+		ParallelFor(taskCount, [&](int32 task)
+		{
+			const int32 begin = static_cast<int32>(static_cast<int64>(height) * task / taskCount);
+			const int32 end = static_cast<int32>(static_cast<int64>(height) * (task + 1) / taskCount);
+			for (int32 y = begin; y < end; ++y)
+			{
+				const uint8* sourceRow = sourceBytes + int64(y) * sourceRowBytes;
+				uint8* destinationRow = destinationBytes + int64(y) * destinationRowBytes;
+				for (int32 x = 0; x < width; ++x)
+				{
+					if (swizzleOnly)
+					{
+						uint32 packed;
+						FMemory::Memcpy(&packed, sourceRow + x * 4, sizeof(uint32));
+						packed = (packed & 0xFF00FF00) | ((packed & 0xFF) << 16) | ((packed >> 16) & 0xFF);
+						FMemory::Memcpy(destinationRow + x * 4, &packed, sizeof(uint32));
+						continue;
+					}
+
+					FPixel pixel = Decode(sourceRow + x * GetPixelBytes(sourceLayout), sourceLayout);
+					if (conversion.bSourceSrgb)
+						pixel = { SrgbToLinear(pixel.R), SrgbToLinear(pixel.G), SrgbToLinear(pixel.B), pixel.A };
+					if (conversion.bDestinationSrgb)
+						pixel = { LinearToSrgb(pixel.R), LinearToSrgb(pixel.G), LinearToSrgb(pixel.B), pixel.A };
+					Encode(destinationRow + x * GetPixelBytes(destinationLayout), destinationLayout, pixel);
+				}
+			}
+		});
+#endif
+		return true;
+	}
+}
@@ -0,0 +1,373 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroISPC/TaskSystem.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+#include <atomic>
+#include <bit>
+
+static TAutoConsoleVariable<int32> CVarIspcWorkerCount(
+	TEXT("McroISPC.WorkerCount"), 0,
+	TEXT("Number of ISPC worker threads, 0 means one less than the selected logical processors."),
+	ECVF_ReadOnly
+);
+
+static TAutoConsoleVariable<FString> CVarIspcAffinityMask(
+	TEXT("McroISPC.AffinityMask"), TEXT(""),
+	TEXT("Logical processors the ISPC workers may run on (like 0xFF00), empty means it's decided by McroISPC.CorePreference."),
+	ECVF_ReadOnly
+);
+
+static TAutoConsoleVariable<int32> CVarIspcWorkerPriority(
+	TEXT("McroISPC.WorkerPriority"), TPri_Normal,
+	TEXT("EThreadPriority of the ISPC worker threads."),
+	ECVF_ReadOnly
+);
+
+static TAutoConsoleVariable<int32> CVarIspcCorePreference(
+	TEXT("McroISPC.CorePreference"), 0,
+	TEXT("On hybrid CPUs: 0 run ISPC workers on any core, 1 only on performance cores,")
+	TEXT(" 2 long-running launches prefer workers on performance cores."),
+	ECVF_ReadOnly
+);
+
+static TAutoConsoleVariable<float> CVarIspcLongTaskMicroseconds(
+	TEXT("McroISPC.LongTaskMicroseconds"), 500.f,
+	TEXT("Tasks taking longer than this on average are considered long-running by McroISPC.CorePreference 2."),
+	ECVF_Default
+);
+
+namespace Mcro::ISPC
+{
+	struct Detail::FTaskTimingStats
+	{
+		std::atomic<const void*> TaskFunction { nullptr };
+
+		/** @brief Exponential moving average of the execution time of a single task, 0 when not measured yet */
+		std::atomic<float> NanosPerTask { 0.f };
+	};
+
+	namespace
+	{
+		constexpr int32 TimingStatsSlots = 1024;
+		constexpr int32 MaxTimingStatsProbes = 16;
+
+		struct FTaskSystemState
+		{
+			FCriticalSection SettingsLock;
+			FTaskCoalescingSettings Coalescing;
+			std::atomic<bool> bCoalescingEnabled { false };
+			std::atomic<double> MinUnitNanos { 20'000.0 };
+			std::atomic<int32> UnitsPerWorker { 8 };
+
+			Detail::FTaskTimingStats TimingStats[TimingStatsSlots];
+
+			std::atomic<uint64> CreatedTaskGroups { 0 };
+			std::atomic<uint64> SharedPoolHits { 0 };
+			std::atomic<uint64> SharedPoolReturns { 0 };
+
+			TOptional<FWorkerPlacementSettings> PlacementOverride;
+			std::atomic<bool> bPreferPerformanceForLongTasks { false };
+			std::atomic<double> LongTaskNanos { 500'000.0 };
+		};
+
+		FTaskSystemState& GetState()
+		{
+			static FTaskSystemState state;
+			return state;
+		}
+
+		/** @brief Find or claim the timing slot of a task function in a fixed size, lock-free open addressed table */
+		Detail::FTaskTimingStats* FindTimingStats(const void* taskFunction)
+		{
+			auto& state = GetState();
+			uint32 hash = GetTypeHash(taskFunction);
+			for (int32 i = 0; i < MaxTimingStatsProbes; ++i)
+			{
+				auto& slot = state.TimingStats[(hash + i) % TimingStatsSlots];
+				const void* current = slot.TaskFunction.load(std::memory_order_acquire);
+				if (current == taskFunction) return &slot;
+				if (!current && slot.TaskFunction.compare_exchange_strong(current, taskFunction, std::memory_order_acq_rel))
+					return &slot;
+				if (current == taskFunction) return &slot;
+			}
+			// Table is too crowded, this function will not be coalesced
+			return nullptr;
+		}
+	}
+
+	namespace
+	{
+		uint64 ParseCpuList(const FString& cpuList)
+		{
+			// Linux cpulist format like "0-7,16,18-19"
+			uint64 result = 0;
+			TArray<FString> ranges;
+			cpuList.TrimStartAndEnd().ParseIntoArray(ranges, TEXT(","));
+			for (const FString& range : ranges)
+			{
+				FString first, last;
+				if (!range.Split(TEXT("-"), &first, &last)) first = last = range;
+				int32 from = FCString::Atoi(*first);
+				int32 to = FMath::Min(FCString::Atoi(*last), 63);
+				for (int32 i = from; i <= to; ++i) result |= 1ull << i;
+			}
+			return result;
+		}
+
+		FCpuTopology DetectCpuTopology()
+		{
+			FCpuTopology result;
+#if PLATFORM_WINDOWS
+			DWORD length = 0;
+			GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &length);
+			TArray<uint8> buffer;
+			buffer.SetNumZeroed(length);
+			if (!GetLogicalProcessorInformationEx(
+				RelationProcessorCore,
+				reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.GetData()),
+				&length
+			)) return result;
+
+			// Higher efficiency class means more performant (and power hungry) cores
+			TArray<TPair<BYTE, uint64>> cores;
+			BYTE maxEfficiencyClass = 0;
+			for (DWORD offset = 0; offset < length;)
+			{
+				auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer.GetData() + offset);
+				if (info->Processor.GroupCount > 0 && info->Processor.GroupMask[0].Group == 0)
+				{
+					cores.Emplace(info->Processor.EfficiencyClass, info->Processor.GroupMask[0].Mask);
+					maxEfficiencyClass = FMath::Max(maxEfficiencyClass, info->Processor.EfficiencyClass);
+				}
+				offset += info->Size;
+			}
+			for (const auto& core : cores)
+			{
+				if (core.Key == maxEfficiencyClass) result.PerformanceCoreMask |= core.Value;
+				else result.EfficiencyCoreMask |= core.Value;
+			}
+#elif PLATFORM_LINUX
+			// Intel hybrid CPUs expose separate PMUs for the core types
+			FString performanceCores, efficiencyCores;
+			if (FFileHelper::LoadFileToString(performanceCores, TEXT("/sys/devices/cpu_core/cpus")))
+				result.PerformanceCoreMask = ParseCpuList(performanceCores);
+			if (FFileHelper::LoadFileToString(efficiencyCores, TEXT("/sys/devices/cpu_atom/cpus")))
+				result.EfficiencyCoreMask = ParseCpuList(efficiencyCores);
+#endif
+			result.bHybrid = result.PerformanceCoreMask != 0 && result.EfficiencyCoreMask != 0;
+			if (!result.bHybrid)
+			{
+				result.PerformanceCoreMask |= result.EfficiencyCoreMask;
+				result.EfficiencyCoreMask = 0;
+			}
+			return result;
+		}
+
+		uint64 GetAllCoresMask()
+		{
+			int32 cores = FMath::Min(FPlatformMisc::NumberOfCoresIncludingHyperthreads(), 64);
+			return cores >= 64 ? ~0ull : (1ull << cores) - 1;
+		}
+	}
+
+	void SetWorkerPlacement(const FWorkerPlacementSettings& settings)
+	{
+		auto& state = GetState();
+		FScopeLock lock(&state.SettingsLock);
+		state.PlacementOverride = settings;
+	}
+
+	FWorkerPlacementSettings GetWorkerPlacement()
+	{
+		auto& state = GetState();
+		{
+			FScopeLock lock(&state.SettingsLock);
+			if (state.PlacementOverride.IsSet()) return state.PlacementOverride.GetValue();
+		}
+
+		FString mask = CVarIspcAffinityMask.GetValueOnAnyThread().TrimStartAndEnd();
+		return {
+			.WorkerCount = FMath::Max(CVarIspcWorkerCount.GetValueOnAnyThread(), 0),
+			.AffinityMask = mask.IsEmpty() ? 0 : FCString::Strtoui64(*mask, nullptr, 0),
+			.Priority = static_cast<EThreadPriority>(CVarIspcWorkerPriority.GetValueOnAnyThread()),
+			.CorePreference = static_cast<ECorePreference>(FMath::Clamp(CVarIspcCorePreference.GetValueOnAnyThread(), 0, 2)),
+			.LongTaskMicroseconds = CVarIspcLongTaskMicroseconds.GetValueOnAnyThread(),
+		};
+	}
+
+	const FCpuTopology& GetCpuTopology()
+	{
+		static FCpuTopology topology = DetectCpuTopology();
+		return topology;
+	}
+
+	int32 Detail::GetWorkerCount(int32 defaultCount)
+	{
+		FWorkerPlacementSettings settings = GetWorkerPlacement();
+		if (settings.WorkerCount > 0) return settings.WorkerCount;
+
+		const FCpuTopology& topology = GetCpuTopology();
+		if (settings.AffinityMask != 0)
+			return FMath::Max(std::popcount(settings.AffinityMask) - 1, 1);
+		if (settings.CorePreference == ECorePreference::PerformanceOnly && topology.bHybrid)
+			return FMath::Max(std::popcount(topology.PerformanceCoreMask) - 1, 1);
+		return FMath::Max(defaultCount, 1);
+	}
+
+	bool Detail::PlaceWorkerThread(int32 workerIndex)
+	{
+		auto& state = GetState();
+		FWorkerPlacementSettings settings = GetWorkerPlacement();
+		const FCpuTopology& topology = GetCpuTopology();
+
+		FPlatformProcess::SetThreadName(*FString::Printf(TEXT("McroISPC Worker %d"), workerIndex));
+		FPlatformProcess::SetThreadPriority(settings.Priority);
+
+		bool efficiencyWorker = false;
+		uint64 mask = settings.AffinityMask;
+		if (mask == 0 && topology.bHybrid)
+		{
+			switch (settings.CorePreference)
+			{
+			case ECorePreference::PerformanceOnly:
+				mask = topology.PerformanceCoreMask;
+				break;
+			case ECorePreference::PerformanceForLongTasks:
+				// Fill the performance cores first, the rest of the workers go to efficiency cores
+				efficiencyWorker = workerIndex >= std::popcount(topology.PerformanceCoreMask);
+				mask = efficiencyWorker ? topology.EfficiencyCoreMask : topology.PerformanceCoreMask;
+				state.LongTaskNanos.store(settings.LongTaskMicroseconds * 1000.0, std::memory_order_relaxed);
+				state.bPreferPerformanceForLongTasks.store(true, std::memory_order_release);
+				break;
+			default: break;
+			}
+		}
+		if (mask != 0 && mask != GetAllCoresMask())
+			FPlatformProcess::SetThreadAffinityMask(mask);
+		return efficiencyWorker;
+	}
+
+	void SetTaskCoalescing(const FTaskCoalescingSettings& settings)
+	{
+		auto& state = GetState();
+		FScopeLock lock(&state.SettingsLock);
+		state.Coalescing = settings;
+		state.MinUnitNanos.store(FMath::Max(settings.MinUnitMicroseconds, 0.0) * 1000.0, std::memory_order_relaxed);
+		state.UnitsPerWorker.store(FMath::Max(settings.UnitsPerWorker, 1), std::memory_order_relaxed);
+		state.bCoalescingEnabled.store(settings.bEnabled, std::memory_order_release);
+	}
+
+	FTaskCoalescingSettings GetTaskCoalescing()
+	{
+		auto& state = GetState();
+		FScopeLock lock(&state.SettingsLock);
+		return state.Coalescing;
+	}
+
+	namespace
+	{
+		thread_local ELaunchPriority GLaunchPriority = ELaunchPriority::Normal;
+	}
+
+	ELaunchPriority GetLaunchPriority()
+	{
+		return GLaunchPriority;
+	}
+
+	FScopedLaunchPriority::FScopedLaunchPriority(ELaunchPriority priority)
+		: Previous(GLaunchPriority)
+	{
+		GLaunchPriority = priority;
+	}
+
+	FScopedLaunchPriority::~FScopedLaunchPriority()
+	{
+		GLaunchPriority = Previous;
+	}
+
+	FTaskGroupPoolStats GetTaskGroupPoolStats()
+	{
+		auto& state = GetState();
+		return {
+			.Created = state.CreatedTaskGroups.load(std::memory_order_relaxed),
+			.SharedPoolHits = state.SharedPoolHits.load(std::memory_order_relaxed),
+			.SharedPoolReturns = state.SharedPoolReturns.load(std::memory_order_relaxed),
+		};
+	}
+
+	void Detail::CountTaskGroupPoolEvent(ETaskGroupPoolEvent event)
+	{
+		auto& state = GetState();
+		switch (event)
+		{
+		case ETaskGroupPoolEvent::Created:          state.CreatedTaskGroups.fetch_add(1, std::memory_order_relaxed); break;
+		case ETaskGroupPoolEvent::SharedPoolHit:    state.SharedPoolHits.fetch_add(1, std::memory_order_relaxed); break;
+		case ETaskGroupPoolEvent::SharedPoolReturn: state.SharedPoolReturns.fetch_add(1, std::memory_order_relaxed); break;
+		}
+	}
+
+	Detail::FLaunchPlan Detail::PlanLaunch(const void* taskFunction, int32 taskCount, int32 workerCount)
+	{
+		FLaunchPlan plan { .Chunks = taskCount, .TimingStats = nullptr, .bPreferPerformanceCores = false };
+		auto& state = GetState();
+		bool coalescing = state.bCoalescingEnabled.load(std::memory_order_acquire);
+		bool longTaskPreference = state.bPreferPerformanceForLongTasks.load(std::memory_order_acquire);
+		if (!coalescing && !longTaskPreference) return plan;
+
+		workerCount = FMath::Max(workerCount, 1);
+		int32 unitsForBalance = workerCount * state.UnitsPerWorker.load(std::memory_order_relaxed);
+		coalescing &= taskCount > unitsForBalance;
+		if (!coalescing && !longTaskPreference) return plan;
+
+		plan.TimingStats = FindTimingStats(taskFunction);
+		if (!plan.TimingStats) return plan;
+
+		float nanosPerTask = plan.TimingStats->NanosPerTask.load(std::memory_order_relaxed);
+		plan.bPreferPerformanceCores = longTaskPreference
+			&& nanosPerTask > state.LongTaskNanos.load(std::memory_order_relaxed);
+
+		if (!coalescing) return plan;
+
+		// Not measured yet, only coalesce as much as load balancing allows, and learn from it
+		if (nanosPerTask <= 0.f)
+		{
+			plan.Chunks = unitsForBalance;
+			return plan;
+		}
+
+		double totalNanos = static_cast<double>(nanosPerTask) * taskCount;
+		double minUnitNanos = FMath::Max(state.MinUnitNanos.load(std::memory_order_relaxed), 1.0);
+		int64 chunks = static_cast<int64>(totalNanos / minUnitNanos);
+		plan.Chunks = static_cast<int32>(FMath::Clamp<int64>(chunks, FMath::Min(workerCount, taskCount), taskCount));
+		return plan;
+	}
+
+	void Detail::RecordTaskTiming(FTaskTimingStats* stats, int32 taskCount, uint64 cycles)
+	{
+		if (!stats || taskCount <= 0) return;
+
+		float sample = static_cast<float>(FPlatformTime::ToMilliseconds64(cycles) * 1'000'000.0 / taskCount);
+		float current = stats->NanosPerTask.load(std::memory_order_relaxed);
+
+		// Racing updates may lose a sample, that's fine for a moving average
+		float next = current <= 0.f ? sample : current + (sample - current) * 0.125f;
+		stats->NanosPerTask.store(next, std::memory_order_relaxed);
+	}
+}
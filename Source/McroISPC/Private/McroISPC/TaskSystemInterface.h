@@ -0,0 +1,36 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <cstdint>
+
+namespace Mcro::ISPC::Detail
+{
+	/**
+	 *	@brief
+	 *	Entrypoints of a task system compiled from IspcTaskSystem.inl. The extern "C" ISPCLaunch, ISPCAlloc and
+	 *	ISPCSync dispatch to the selected one.
+	 */
+	struct FTaskSystemInterface
+	{
+		/** @brief Name of the task system used for selecting it */
+		const TCHAR* Name;
+
+		void (*Launch)(void** taskGroupPtr, void* func, void* data, int count0, int count1, int count2);
+		void* (*Alloc)(void** taskGroupPtr, int64_t size, int32_t alignment);
+		void (*Sync)(void* taskGroup);
+
+		/** @brief Initialize the task system if needed and return the number of threads it runs tasks on */
+		int (*WorkerCount)();
+	};
+}
@@ -0,0 +1,165 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroISPC/TaskTrace.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <atomic>
+
+#if MCRO_ISPC_TRACE
+UE_TRACE_CHANNEL_DEFINE(McroISPCChannel)
+
+UE_TRACE_EVENT_BEGIN(McroISPC, Launch)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TaskFunction)
+	UE_TRACE_EVENT_FIELD(uint32, TaskSpecId)
+	UE_TRACE_EVENT_FIELD(int32, CountX)
+	UE_TRACE_EVENT_FIELD(int32, CountY)
+	UE_TRACE_EVENT_FIELD(int32, CountZ)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+#endif
+
+namespace Mcro::ISPC
+{
+	namespace
+	{
+		thread_local const TCHAR* GCurrentTaskName = nullptr;
+		std::atomic<FLaunchObserver> GLaunchObserver { nullptr };
+
+		struct FTaskTraceRegistry
+		{
+			FRWLock Lock;
+			TMap<const void*, const TCHAR*> RegisteredNames;
+
+			// Specs are referred to by pointer from in-flight tasks, so they're never moved or removed
+			TMap<TPair<const void*, const TCHAR*>, TUniquePtr<Detail::FTaskTraceSpecs>> Specs;
+		};
+
+		FTaskTraceRegistry& GetRegistry()
+		{
+			static FTaskTraceRegistry registry;
+			return registry;
+		}
+
+		const TCHAR* FindTaskName(const void* taskFunction)
+		{
+			if (GCurrentTaskName) return GCurrentTaskName;
+
+			auto& registry = GetRegistry();
+			FReadScopeLock lock(registry.Lock);
+			auto registeredName = registry.RegisteredNames.Find(taskFunction);
+			return registeredName ? *registeredName : nullptr;
+		}
+	}
+
+	void RegisterTaskName(const void* taskFunction, const TCHAR* name)
+	{
+		auto& registry = GetRegistry();
+		FWriteScopeLock lock(registry.Lock);
+		registry.RegisteredNames.Add(taskFunction, name);
+	}
+
+	void SetLaunchObserver(FLaunchObserver observer)
+	{
+		GLaunchObserver.store(observer, std::memory_order_release);
+	}
+
+	FScopedTaskName::FScopedTaskName(const TCHAR* name)
+		: Previous(GCurrentTaskName)
+	{
+		GCurrentTaskName = name;
+	}
+
+	FScopedTaskName::~FScopedTaskName()
+	{
+		GCurrentTaskName = Previous;
+	}
+
+	const Detail::FTaskTraceSpecs* Detail::GetTaskTraceSpecs(const void* taskFunction)
+	{
+#if MCRO_ISPC_TRACE
+		if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(McroISPCChannel)) return nullptr;
+
+		auto& registry = GetRegistry();
+		const TCHAR* name = GCurrentTaskName;
+		{
+			FReadScopeLock lock(registry.Lock);
+			if (!name)
+			{
+				if (auto registeredName = registry.RegisteredNames.Find(taskFunction))
+					name = *registeredName;
+			}
+			if (auto specs = registry.Specs.Find({taskFunction, name}))
+				return specs->Get();
+		}
+
+		FWriteScopeLock lock(registry.Lock);
+		auto& specs = registry.Specs.FindOrAdd({taskFunction, name});
+		if (!specs)
+		{
+			FString displayName = name ? FString(name) : FString::Printf(TEXT("ISPC 0x%p"), taskFunction);
+			specs = MakeUnique<FTaskTraceSpecs>(FTaskTraceSpecs {
+				.Name = name,
+				.Launch = FCpuProfilerTrace::OutputEventType(*(displayName + TEXT(" Launch"))),
+				.Task   = FCpuProfilerTrace::OutputEventType(*(displayName + TEXT(" Task"))),
+				.Sync   = FCpuProfilerTrace::OutputEventType(*(displayName + TEXT(" Sync"))),
+			});
+		}
+		return specs.Get();
+#else
+		return nullptr;
+#endif
+	}
+
+	void Detail::TraceLaunch(const FTaskTraceSpecs* specs, const void* taskFunction, int countx, int county, int countz)
+	{
+		if (FLaunchObserver observer = GLaunchObserver.load(std::memory_order_acquire)) [[unlikely]]
+			observer(specs ? specs->Name : FindTaskName(taskFunction), taskFunction, countx, county, countz);
+
+#if MCRO_ISPC_TRACE
+		if (!specs) return;
+		const TCHAR* name = specs->Name ? specs->Name : TEXT("");
+		UE_TRACE_LOG(McroISPC, Launch, McroISPCChannel)
+			<< Launch.Cycle(FPlatformTime::Cycles64())
+			<< Launch.TaskFunction(reinterpret_cast<uint64>(taskFunction))
+			<< Launch.TaskSpecId(specs->Task)
+			<< Launch.CountX(countx)
+			<< Launch.CountY(county)
+			<< Launch.CountZ(countz)
+			<< Launch.Name(name, FCString::Strlen(name));
+#endif
+	}
+
+	Detail::FTaskTraceScope::FTaskTraceScope(const FTaskTraceSpecs* specs, ETraceSpan span)
+#if MCRO_ISPC_TRACE
+		: Scope(
+			!specs ? 0
+			: span == ETraceSpan::Launch ? specs->Launch
+			: span == ETraceSpan::Task ? specs->Task
+			: specs->Sync,
+			McroISPCChannel,
+			specs != nullptr
+		)
+		, PreviousName(GCurrentTaskName)
+#else
+		: PreviousName(GCurrentTaskName)
+#endif
+		, bNamesTasks(specs && span == ETraceSpan::Task)
+	{
+		if (bNamesTasks) GCurrentTaskName = specs->Name;
+	}
+
+	Detail::FTaskTraceScope::~FTaskTraceScope()
+	{
+		if (bNamesTasks) GCurrentTaskName = PreviousName;
+	}
+}
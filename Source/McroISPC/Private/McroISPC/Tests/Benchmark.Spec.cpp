@@ -0,0 +1,164 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+*/
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "McroISPC/TaskSystem.h"
+
+#if INTEL_ISPC
+#include "Benchmark.ispc.generated.h"
+
+/**
+ *	Compares ISPC task systems on a couple of representative workloads. Results are reported in the test log and
+ *	appended to `Saved/McroISPC/TaskSystemBenchmark.csv`, so running it with different task systems or worker
+ *	counts (like `-dpcvars=McroISPC.WorkerCount=4`) accumulates the data to compare.
+ */
+DEFINE_SPEC(
+	FMcroIspcBenchmark_Spec,
+	TEXT("McroISPC.Benchmark"),
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::PerfFilter
+)
+	int32 Workers = 1;
+
+	/** @returns The median wall time of the given function in microseconds, after a warmup run */
+	template <typename Function>
+	static double Measure(int32 repeats, Function&& function)
+	{
+		function();
+		TArray<double> samples;
+		samples.Reserve(repeats);
+		for (int32 i = 0; i < repeats; ++i)
+		{
+			double start = FPlatformTime::Seconds();
+			function();
+			samples.Add((FPlatformTime::Seconds() - start) * 1'000'000.0);
+		}
+		samples.Sort();
+		return samples[samples.Num() / 2];
+	}
+
+	void Report(const TCHAR* kernel, const FString& parameter, double microseconds, double items)
+	{
+		double itemsPerSecond = microseconds > 0.0 ? items / microseconds * 1'000'000.0 : 0.0;
+		AddInfo(FString::Printf(
+			TEXT("%s (%d workers) %s [%s]: %.2f us, %.0f items/s"),
+			Mcro::ISPC::GetTaskSystemName(), Workers, kernel, *parameter, microseconds, itemsPerSecond
+		));
+
+		FString path = FPaths::ProjectSavedDir() / TEXT("McroISPC") / TEXT("TaskSystemBenchmark.csv");
+		FString line;
+		if (!IFileManager::Get().FileExists(*path))
+			line = TEXT("TaskSystem,Workers,Kernel,Parameter,MedianMicroseconds,ItemsPerSecond\n");
+		line += FString::Printf(
+			TEXT("%s,%d,%s,\"%s\",%f,%f\n"),
+			Mcro::ISPC::GetTaskSystemName(), Workers, kernel, *parameter, microseconds, itemsPerSecond
+		);
+		FFileHelper::SaveStringToFile(line, *path, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	}
+END_DEFINE_SPEC(FMcroIspcBenchmark_Spec)
+
+void FMcroIspcBenchmark_Spec::Define()
+{
+	BeforeEach([this]
+	{
+		Workers = Mcro::ISPC::GetTaskSystemWorkerCount();
+	});
+
+	Describe(TEXT("Launch overhead"), [this]
+	{
+		It(TEXT("should measure a single empty launch"), [this]
+		{
+			double time = Measure(1000, [] { ispc::BenchEmptyLaunch(); });
+			Report(TEXT("EmptyLaunch"), TEXT("1 task"), time, 1);
+		});
+	});
+
+	Describe(TEXT("Embarrassingly parallel"), [this]
+	{
+		It(TEXT("should measure scaling with the number of tasks"), [this]
+		{
+			constexpr int32 count = 1 << 20;
+			TArray<float> data;
+			data.Init(1.f, count);
+
+			double singleTask = 0.0;
+			for (int32 tasks = 1; tasks <= Workers * 4; tasks *= 2)
+			{
+				double time = Measure(10, [&] { ispc::BenchParallelBlocks(data.GetData(), count, tasks, 16); });
+				if (tasks == 1) singleTask = time;
+				Report(TEXT("ParallelBlocks"), FString::Printf(TEXT("%d tasks, %.2fx speedup"), tasks, singleTask / time), time, count);
+			}
+		});
+	});
+
+	Describe(TEXT("Many tiny tasks"), [this]
+	{
+		It(TEXT("should measure throughput with and without coalescing"), [this]
+		{
+			using namespace Mcro::ISPC;
+			constexpr int32 count = 100'000;
+			TArray<float> data;
+			data.Init(0.f, count);
+
+			FTaskCoalescingSettings previous = GetTaskCoalescing();
+			for (bool coalescing : { false, true })
+			{
+				FTaskCoalescingSettings settings = previous;
+				settings.bEnabled = coalescing;
+				SetTaskCoalescing(settings);
+
+				double time = Measure(20, [&] { ispc::BenchTinyTasks(data.GetData(), count); });
+				Report(TEXT("TinyTasks"), FString::Printf(TEXT("%d tasks, coalescing %s"), count, coalescing ? TEXT("on") : TEXT("off")), time, count);
+			}
+			SetTaskCoalescing(previous);
+		});
+	});
+
+	Describe(TEXT("Nested launch"), [this]
+	{
+		It(TEXT("should measure a deep tree of launches"), [this]
+		{
+			for (int32 fanout : { 2, 8 })
+			{
+				int32 depth = fanout == 2 ? 14 : 5;
+				int32 leafCount = 0;
+				double time = Measure(10, [&]
+				{
+					leafCount = 0;
+					ispc::BenchNestedFanout(depth, fanout, &leafCount);
+				});
+				Report(TEXT("NestedFanout"), FString::Printf(TEXT("fanout %d, depth %d"), fanout, depth), time, leafCount);
+			}
+		});
+	});
+
+	Describe(TEXT("Allocation heavy"), [this]
+	{
+		It(TEXT("should measure many launches with large parameters"), [this]
+		{
+			constexpr int32 tasks = 256;
+			constexpr int32 launchesPerTask = 64;
+			TArray<float> output;
+			output.Init(0.f, tasks * launchesPerTask);
+
+			double time = Measure(10, [&] { ispc::BenchAllocHeavy(tasks, launchesPerTask, output.GetData()); });
+			Report(TEXT("AllocHeavy"), FString::Printf(TEXT("%d x %d launches"), tasks, launchesPerTask), time, tasks * launchesPerTask);
+		});
+	});
+}
+
+#endif
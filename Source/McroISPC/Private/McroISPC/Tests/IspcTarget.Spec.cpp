@@ -0,0 +1,45 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "McroISPC/IspcTarget.h"
+
+using namespace Mcro::ISPC;
+
+DEFINE_SPEC(
+	FMcroIspcTarget_Spec,
+	TEXT("McroISPC.Target"),
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroIspcTarget_Spec::Define()
+{
+	Describe(TEXT("Runtime dispatch"), [this]
+	{
+		It(TEXT("should select the best supported compiled target"), [this]
+		{
+			EIspcTarget selected = GetIspcTarget();
+			TestNotEqual(TEXT("A target is selected"), selected, EIspcTarget::Unknown);
+			TestTrue(TEXT("Selected target is supported"), IsIspcTargetSupported(selected));
+
+			auto compiled = GetCompiledIspcTargets();
+			int32 index = compiled.Find(selected);
+			TestTrue(TEXT("Selected target is compiled"), index != INDEX_NONE);
+			for (int32 i = 0; i < index; ++i)
+				TestFalse(TEXT("Preferred targets are not supported"), IsIspcTargetSupported(compiled[i]));
+
+			AddInfo(FString::Printf(TEXT("ISPC kernels are running with %s"), GetIspcTargetName(selected)));
+		});
+	});
+}
@@ -0,0 +1,282 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "McroISPC/IspcParallelism.h"
+#include "McroISPC/LaunchGraph.h"
+#include "McroISPC/TaskSystem.h"
+#include "Tasks/Task.h"
+
+#include <atomic>
+
+using namespace Mcro::ISPC;
+
+namespace
+{
+	struct FRawTaskData
+	{
+		std::atomic<int32> Calls { 0 };
+		std::atomic<int32> IndexSum { 0 };
+		std::atomic<bool> CountsMatch { true };
+	};
+
+	void RawTask(
+		void* data, int threadIndex, int threadCount,
+		int taskIndex, int taskCount,
+		int taskIndex0, int taskIndex1, int taskIndex2,
+		int taskCount0, int taskCount1, int taskCount2
+	) {
+		auto& raw = *static_cast<FRawTaskData*>(data);
+		raw.Calls.fetch_add(1);
+		raw.IndexSum.fetch_add(taskIndex);
+		if (taskCount != taskCount0 * taskCount1 * taskCount2 || taskIndex != taskIndex0 + taskCount0 * (taskIndex1 + taskCount1 * taskIndex2))
+			raw.CountsMatch = false;
+	}
+
+	struct FPriorityTaskData
+	{
+		std::atomic<int32> Finished { 0 };
+		std::atomic<int32> ObservedUrgentRanges { -1 };
+		double SpinSeconds = 0;
+	};
+
+	void SpinningTask(
+		void* data, int threadIndex, int threadCount,
+		int taskIndex, int taskCount,
+		int taskIndex0, int taskIndex1, int taskIndex2,
+		int taskCount0, int taskCount1, int taskCount2
+	) {
+		auto& task = *static_cast<FPriorityTaskData*>(data);
+		const double end = FPlatformTime::Seconds() + task.SpinSeconds;
+		while (FPlatformTime::Seconds() < end) FPlatformProcess::YieldThread();
+		task.ObservedUrgentRanges = GetLaunchPriorityStats().UnclaimedUrgentRanges;
+		task.Finished.fetch_add(1);
+	}
+
+	void LaunchAndSync(FPriorityTaskData& data, int32 count)
+	{
+		void* handle = nullptr;
+		ISPCLaunch(&handle, reinterpret_cast<void*>(&SpinningTask), &data, count, 1, 1);
+		ISPCSync(handle);
+	}
+}
+
+DEFINE_SPEC(
+	FMcroIspcLaunchGraph_Spec,
+	TEXT("McroISPC.LaunchGraph"),
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroIspcLaunchGraph_Spec::Define()
+{
+	Describe(TEXT("Launch graph"), [this]
+	{
+		It(TEXT("should run build, prefix sum and scatter stages in dependency order"), [this]
+		{
+			constexpr int32 binCount = 64;
+			constexpr int32 count = 100'000;
+			TArray<int32> keys;
+			for (int32 i = 0; i < count; ++i)
+				keys.Add((i * 7919) % binCount);
+
+			// Each task of the build stage counts a slice of the keys into its own histogram
+			constexpr int32 slices = 16;
+			TArray<int32> histograms;
+			histograms.SetNumZeroed(slices * binCount);
+			TArray<int32> offsets;
+			offsets.SetNumZeroed(slices * binCount);
+			TArray<int32> sorted;
+			sorted.SetNumZeroed(count);
+
+			auto sliceRange = [&](int32 slice)
+			{
+				return TPair<int32, int32>(count * slice / slices, count * (slice + 1) / slices);
+			};
+
+			FLaunchGraph graph;
+			FLaunchNode build = graph.Add(TEXT("Test.Build"), slices, [&](int32 slice, int32)
+			{
+				auto [begin, end] = sliceRange(slice);
+				for (int32 i = begin; i < end; ++i)
+					++histograms[slice * binCount + keys[i]];
+			});
+			FLaunchNode scan = graph.Add(TEXT("Test.PrefixSum"), 1, [&](int32, int32)
+			{
+				int32 running = 0;
+				for (int32 bin = 0; bin < binCount; ++bin)
+				{
+					for (int32 slice = 0; slice < slices; ++slice)
+					{
+						offsets[slice * binCount + bin] = running;
+						running += histograms[slice * binCount + bin];
+					}
+				}
+			}, { build });
+			graph.Add(TEXT("Test.Scatter"), slices, [&](int32 slice, int32)
+			{
+				auto [begin, end] = sliceRange(slice);
+				for (int32 i = begin; i < end; ++i)
+					sorted[offsets[slice * binCount + keys[i]]++] = keys[i];
+			}, { scan });
+
+			graph.Wait();
+
+			TArray<int32> expected = keys;
+			expected.Sort();
+			TestTrue(TEXT("Graph is completed"), graph.IsCompleted());
+			TestTrue(TEXT("Keys are sorted by the counting sort stages"), sorted == expected);
+		});
+
+		It(TEXT("should start dependents only after all of their prerequisites finished"), [this]
+		{
+			std::atomic<int32> clock { 0 };
+			int32 finishedLeft = -1, finishedRight = -1, startedJoin = -1;
+
+			FLaunchGraph graph;
+			FLaunchNode root = graph.Add(TEXT("Test.Root"), 8, [&](int32, int32) { clock.fetch_add(1); });
+			FLaunchNode left = graph.Add(TEXT("Test.Left"), 1, [&](int32, int32)
+			{
+				FPlatformProcess::Sleep(0.01f);
+				finishedLeft = clock.fetch_add(1);
+			}, { root });
+			FLaunchNode right = graph.Add(TEXT("Test.Right"), 1, [&](int32, int32)
+			{
+				finishedRight = clock.fetch_add(1);
+			}, { root });
+			graph.Add(TEXT("Test.Join"), 1, [&](int32, int32)
+			{
+				startedJoin = clock.fetch_add(1);
+			}, { left, right });
+
+			graph.Run();
+			graph.Wait();
+
+			TestTrue(TEXT("Left branch finished before the join"), finishedLeft >= 8 && finishedLeft < startedJoin);
+			TestTrue(TEXT("Right branch finished before the join"), finishedRight >= 8 && finishedRight < startedJoin);
+		});
+
+		It(TEXT("should launch raw ISPC task functions with 3D task counts"), [this]
+		{
+			FRawTaskData raw;
+			FLaunchGraph graph;
+			FLaunchNode first = graph.Add(TEXT("Test.Raw"), &RawTask, &raw, 4, 3, 2);
+			graph.Add(TEXT("Test.Empty"), &RawTask, &raw, 0, 1, 1, { first });
+			graph.Wait();
+
+			TestEqual(TEXT("Every task ran once"), raw.Calls.load(), 24);
+			TestEqual(TEXT("Every task index was visited"), raw.IndexSum.load(), 23 * 24 / 2);
+			TestTrue(TEXT("3D indices are consistent with the flat index"), raw.CountsMatch.load());
+		});
+	});
+
+	Describe(TEXT("Launch priority"), [this]
+	{
+		It(TEXT("should be scoped to the current thread"), [this]
+		{
+			TestEqual(TEXT("Default priority"), GetLaunchPriority(), ELaunchPriority::Normal);
+			{
+				MCRO_ISPC_LAUNCH_PRIORITY(ELaunchPriority::Background);
+				TestEqual(TEXT("Outer scope"), GetLaunchPriority(), ELaunchPriority::Background);
+				{
+					MCRO_ISPC_LAUNCH_PRIORITY(ELaunchPriority::FrameCritical);
+					TestEqual(TEXT("Inner scope"), GetLaunchPriority(), ELaunchPriority::FrameCritical);
+				}
+				TestEqual(TEXT("Restored outer scope"), GetLaunchPriority(), ELaunchPriority::Background);
+			}
+			TestEqual(TEXT("Restored default"), GetLaunchPriority(), ELaunchPriority::Normal);
+		});
+
+		It(TEXT("should be inherited by the tasks of a launch"), [this]
+		{
+			std::atomic<int32> backgroundTasks { 0 };
+			std::atomic<int32> criticalTasks { 0 };
+			std::atomic<int32> mismatches { 0 };
+
+			FLaunchGraph graph;
+			{
+				MCRO_ISPC_LAUNCH_PRIORITY(ELaunchPriority::Background);
+				graph.Add(TEXT("Test.Background"), 256, [&](int32, int32)
+				{
+					if (GetLaunchPriority() != ELaunchPriority::Background) ++mismatches;
+					FPlatformProcess::YieldThread();
+					++backgroundTasks;
+				});
+			}
+			{
+				MCRO_ISPC_LAUNCH_PRIORITY(ELaunchPriority::FrameCritical);
+				graph.Add(TEXT("Test.FrameCritical"), 64, [&](int32, int32)
+				{
+					if (GetLaunchPriority() != ELaunchPriority::FrameCritical) ++mismatches;
+					++criticalTasks;
+				});
+			}
+			graph.Wait();
+
+			TestEqual(TEXT("Every background task ran"), backgroundTasks.load(), 256);
+			TestEqual(TEXT("Every frame-critical task ran"), criticalTasks.load(), 64);
+			TestEqual(TEXT("Tasks ran with the priority of their launch"), mismatches.load(), 0);
+			TestEqual(TEXT("The calling thread is not affected"), GetLaunchPriority(), ELaunchPriority::Normal);
+		});
+
+		It(TEXT("should stop counting a range as urgent once its last task is claimed"), [this]
+		{
+			if (FCString::Strcmp(GetTaskSystemName(), TEXT("UETasks")) != 0) return;
+
+			const int32 before = GetLaunchPriorityStats().UnclaimedUrgentRanges;
+			FPriorityTaskData single;
+			LaunchAndSync(single, 1);
+
+			TestTrue(TEXT("The only task of the range ran"), single.Finished.load() == 1);
+			TestTrue(
+				TEXT("While the last task ran its range was not waiting for workers anymore"),
+				single.ObservedUrgentRanges.load() <= before
+			);
+		});
+
+		It(TEXT("should drain frame-critical launches before background ones, yielding once per launch"), [this]
+		{
+			if (FCString::Strcmp(GetTaskSystemName(), TEXT("UETasks")) != 0) return;
+
+			constexpr int32 backgroundCount = 4096;
+			FPriorityTaskData background;
+			background.SpinSeconds = 0.0001;
+			const uint64 yieldsBefore = GetLaunchPriorityStats().BackgroundYields;
+
+			UE::Tasks::FTask backgroundLaunch = UE::Tasks::Launch(TEXT("Test.BackgroundLaunch"), [&]
+			{
+				MCRO_ISPC_LAUNCH_PRIORITY(ELaunchPriority::Background);
+				LaunchAndSync(background, backgroundCount);
+			});
+			while (background.Finished.load() == 0) FPlatformProcess::YieldThread();
+
+			FPriorityTaskData critical;
+			critical.SpinSeconds = 0.0001;
+			{
+				MCRO_ISPC_LAUNCH_PRIORITY(ELaunchPriority::FrameCritical);
+				LaunchAndSync(critical, 64);
+			}
+			const int32 backgroundFinishedBeforeCritical = background.Finished.load();
+			backgroundLaunch.Wait();
+
+			const uint64 yields = GetLaunchPriorityStats().BackgroundYields - yieldsBefore;
+			TestEqual(TEXT("Every frame-critical task ran"), critical.Finished.load(), 64);
+			TestEqual(TEXT("Every background task ran"), background.Finished.load(), backgroundCount);
+			TestTrue(TEXT("Frame-critical launch finished first"), backgroundFinishedBeforeCritical < backgroundCount);
+			TestTrue(
+				TEXT("Background workers yielded at most once for the single frame-critical launch"),
+				yields <= static_cast<uint64>(GetTaskSystemWorkerCount())
+			);
+		});
+	});
+}
@@ -0,0 +1,125 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if INTEL_ISPC
+#include "NestedLaunch.ispc.generated.h"
+
+DEFINE_SPEC(
+	FMcroIspcNestedLaunch_Spec,
+	TEXT("McroISPC.NestedLaunch"),
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroIspcNestedLaunch_Spec::Define()
+{
+	Describe(TEXT("Recursive launches"), [this]
+	{
+		It(TEXT("should sort with parallel quicksort"), [this]
+		{
+			FRandomStream random(1337);
+			TArray<int32> values;
+			for (int32 i = 0; i < 200'000; ++i)
+				values.Add(random.RandRange(-100'000, 100'000));
+
+			TArray<int32> expected = values;
+			expected.Sort();
+
+			ispc::ParallelQuickSort(values.GetData(), values.Num());
+			TestTrue(TEXT("Values are sorted like Algo::Sort does"), values == expected);
+		});
+
+		It(TEXT("should survive degenerate (deep) quicksort recursion"), [this]
+		{
+			// Few distinct values make two-way partitions lopsided, which used to make the recursion linearly deep
+			FRandomStream random(42);
+			TArray<int32> values;
+			for (int32 i = 0; i < 50'000; ++i)
+				values.Add(random.RandRange(0, 3));
+
+			TArray<int32> expected = values;
+			expected.Sort();
+
+			ispc::ParallelQuickSort(values.GetData(), values.Num());
+			TestTrue(TEXT("Values are sorted like Algo::Sort does"), values == expected);
+		});
+
+		It(TEXT("should build a consistent BVH"), [this]
+		{
+			constexpr int32 count = 100'000;
+			FRandomStream random(7);
+			TArray<float> centers;
+			TArray<int32> indices;
+			for (int32 i = 0; i < count; ++i)
+			{
+				centers.Add(random.FRandRange(-100.f, 100.f));
+				centers.Add(random.FRandRange(-10.f, 10.f));
+				centers.Add(random.FRandRange(-1000.f, 1000.f));
+				indices.Add(i);
+			}
+
+			TArray<ispc::FTestBvhNode> nodes;
+			nodes.SetNumZeroed(count * 2);
+			int32 nodeCount = ispc::BuildTestBvh(centers.GetData(), indices.GetData(), nodes.GetData(), count);
+			TestTrue(TEXT("Node count is within bounds"), nodeCount > 1 && nodeCount <= count * 2);
+
+			TArray<int32> visitedPrimitives;
+			visitedPrimitives.SetNumZeroed(count);
+			bool bBoundsOk = true;
+			bool bRangesOk = true;
+
+			TArray<int32> stack { 0 };
+			while (!stack.IsEmpty())
+			{
+				const ispc::FTestBvhNode& node = nodes[stack.Pop()];
+				if (node.Left < 0)
+				{
+					for (int32 i = node.First; i < node.First + node.Count; ++i)
+					{
+						int32 primitive = indices[i];
+						++visitedPrimitives[primitive];
+						for (int32 a = 0; a < 3; ++a)
+						{
+							float value = centers[primitive * 3 + a];
+							bBoundsOk &= value >= node.BoundsMin[a] && value <= node.BoundsMax[a];
+						}
+					}
+					continue;
+				}
+
+				const ispc::FTestBvhNode& left = nodes[node.Left];
+				const ispc::FTestBvhNode& right = nodes[node.Right];
+				bRangesOk &= left.First == node.First
+					&& left.Count + right.Count == node.Count
+					&& right.First == left.First + left.Count;
+
+				for (int32 a = 0; a < 3; ++a)
+				{
+					bBoundsOk &= left.BoundsMin[a] >= node.BoundsMin[a] && left.BoundsMax[a] <= node.BoundsMax[a];
+					bBoundsOk &= right.BoundsMin[a] >= node.BoundsMin[a] && right.BoundsMax[a] <= node.BoundsMax[a];
+				}
+				stack.Add(node.Left);
+				stack.Add(node.Right);
+			}
+
+			TestTrue(TEXT("Every primitive is in exactly one leaf"), !visitedPrimitives.ContainsByPredicate([](int32 v) { return v != 1; }));
+			TestTrue(TEXT("Child ranges partition their parents"), bRangesOk);
+			TestTrue(TEXT("Bounds contain their children and primitives"), bBoundsOk);
+		});
+	});
+}
+
+#endif
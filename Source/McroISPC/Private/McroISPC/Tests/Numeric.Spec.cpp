@@ -0,0 +1,91 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "McroISPC/Numeric.h"
+
+using namespace Mcro::Range;
+
+DEFINE_SPEC(
+	FMcroIspcNumeric_Spec,
+	TEXT("McroISPC.Numeric"),
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroIspcNumeric_Spec::Define()
+{
+	Describe(TEXT("Reductions"), [this]
+	{
+		It(TEXT("should match sequential loops across many tasks"), [this]
+		{
+			// Enough elements for several tasks, with a remainder
+			TArray<int32> ints;
+			for (int32 i = 0; i < 1'000'003; ++i)
+				ints.Add(i % 1000 - 300);
+
+			int64 expectedSum = 0;
+			for (int32 value : ints)
+				expectedSum += value;
+
+			TestEqual(TEXT("Integer sum"), ints | IspcSum(), expectedSum);
+
+			auto minMax = ints | IspcMinMax();
+			TestTrue(TEXT("Has min/max"), minMax.IsSet());
+			TestEqual(TEXT("Min"), minMax->Min, -300);
+			TestEqual(TEXT("Max"), minMax->Max, 699);
+
+			TArray<float> floats;
+			for (int32 i = 0; i < 200'000; ++i)
+				floats.Add(0.5f);
+
+			TestNearlyEqual(TEXT("Float sum"), floats | IspcSum(), 100'000.0f, 0.01f);
+			TestNearlyEqual(TEXT("Dot"), floats | IspcDot(floats), 50'000.0f, 0.01f);
+			TestFalse(TEXT("Empty has no min/max"), (TArray<float>() | IspcMinMax()).IsSet());
+		});
+	});
+
+	Describe(TEXT("Scans and transforms"), [this]
+	{
+		It(TEXT("should compute inclusive prefix sums across task boundaries"), [this]
+		{
+			TArray<int32> ones;
+			ones.Init(1, 300'001);
+			TArray<int32> scanned = ones | IspcPrefixSum();
+
+			bool matching = true;
+			for (int32 i = 0; i < scanned.Num(); ++i)
+				matching &= scanned[i] == i + 1;
+			TestTrue(TEXT("Prefix sum"), matching);
+		});
+
+		It(TEXT("should bin, gather and transform"), [this]
+		{
+			TArray<float> values { 0.0f, 0.1f, 0.5f, 0.99f, 1.0f, -1.0f, 2.0f };
+			TArray<int32> bins = values | IspcHistogram(0.0f, 1.0f, 4);
+			TestEqual(TEXT("Histogram"), bins, TArray<int32> { 2, 0, 1, 2 });
+			TestEqual(TEXT("Degenerate histogram"),
+				values | IspcHistogram(1.0f, 1.0f, 3), TArray<int32> { 0, 0, 1 }
+			);
+
+			TArray<int32> indices { 4, 0, 2 };
+			TestEqual(TEXT("Gather"), values | IspcGather(indices), TArray<float> { 1.0f, 0.0f, 0.5f });
+
+			TArray<int32> ints { 1, 2, 3 };
+			TestEqual(TEXT("Affine"), ints | IspcTransformAffine(3, -1), TArray<int32> { 2, 5, 8 });
+
+			Mcro::ISPC::TransformAffine(values, values, 2.0f, 1.0f);
+			TestEqual(TEXT("In-place affine"), values[2], 2.0f);
+		});
+	});
+}
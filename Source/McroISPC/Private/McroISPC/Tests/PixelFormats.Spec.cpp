@@ -0,0 +1,103 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "McroISPC/PixelFormats.h"
+
+using namespace Mcro::Rendering::Textures;
+
+DEFINE_SPEC(
+	FMcroIspcPixelFormats_Spec,
+	TEXT("McroISPC.PixelFormats"),
+	EAutomationTestFlags_ApplicationContextMask
+	| EAutomationTestFlags::CriticalPriority
+	| EAutomationTestFlags::ProductFilter
+);
+
+void FMcroIspcPixelFormats_Spec::Define()
+{
+	Describe(TEXT("ConvertPixels"), [this]
+	{
+		It(TEXT("should swizzle BGRA8 to RGBA8"), [this]
+		{
+			TArray<FColor> source;
+			for (int32 i = 0; i < 300 * 300; ++i)
+				source.Add(FColor(i % 256, (i / 256) % 256, 7, 200));
+
+			TArray<uint32> destination;
+			destination.SetNumZeroed(source.Num());
+			TestTrue(TEXT("Conversion is supported"), ConvertPixels(source.GetData(), destination.GetData(), 300, 300, {
+				.SourceFormat = PF_B8G8R8A8,
+				.DestinationFormat = PF_R8G8B8A8
+			}));
+
+			bool matching = true;
+			for (int32 i = 0; i < source.Num(); ++i)
+			{
+				const uint8* rgba = reinterpret_cast<const uint8*>(&destination[i]);
+				matching &= rgba[0] == source[i].R && rgba[1] == source[i].G && rgba[2] == source[i].B && rgba[3] == source[i].A;
+			}
+			TestTrue(TEXT("Channels are in RGBA order"), matching);
+		});
+
+		It(TEXT("should round trip BGRA8 through FloatRGBA with sRGB conversion"), [this]
+		{
+			FRandomStream random(1337);
+			TArray<FColor> source;
+			for (int32 i = 0; i < 512 * 64; ++i)
+				source.Add(FColor(random.RandRange(0, 255), random.RandRange(0, 255), random.RandRange(0, 255), 255));
+
+			TArray<FFloat16Color> linear;
+			linear.SetNumZeroed(source.Num());
+			ConvertPixels(source.GetData(), linear.GetData(), 512, 64, {
+				.SourceFormat = PF_B8G8R8A8,
+				.DestinationFormat = PF_FloatRGBA,
+				.bSourceSrgb = true
+			});
+
+			FLinearColor expected = FLinearColor::FromSRGBColor(source[10]);
+			TestNearlyEqual(TEXT("Red is linearized"), linear[10].R.GetFloat(), expected.R, 0.002f);
+			TestNearlyEqual(TEXT("Blue is linearized"), linear[10].B.GetFloat(), expected.B, 0.002f);
+
+			TArray<FColor> result;
+			result.SetNumZeroed(source.Num());
+			ConvertPixels(linear.GetData(), result.GetData(), 512, 64, {
+				.SourceFormat = PF_FloatRGBA,
+				.DestinationFormat = PF_B8G8R8A8,
+				.bDestinationSrgb = true
+			});
+			TestTrue(TEXT("Colors are the same after the round trip"), result == source);
+		});
+
+		It(TEXT("should respect row sizes and reject unknown formats"), [this]
+		{
+			// 3 pixels wide rows padded to 4 pixels
+			TArray<uint32> source { 0x3FF, 0xFFC00, 0x3FF00000, 0, 0xC0000000, 0, 0, 0 };
+			TArray<FFloat16Color> destination;
+			destination.SetNumZeroed(6);
+			ConvertPixels(source.GetData(), destination.GetData(), 3, 2, {
+				.SourceFormat = PF_A2B10G10R10,
+				.DestinationFormat = PF_FloatRGBA,
+				.SourceRowBytes = 16
+			});
+			TestEqual(TEXT("Red"), destination[0].R.GetFloat(), 1.0f);
+			TestEqual(TEXT("Green"), destination[1].G.GetFloat(), 1.0f);
+			TestEqual(TEXT("Blue"), destination[2].B.GetFloat(), 1.0f);
+			TestEqual(TEXT("Alpha of the second row"), destination[3].A.GetFloat(), 1.0f);
+
+			TestFalse(TEXT("Unsupported format"), ConvertPixels(source.GetData(), destination.GetData(), 1, 1, {
+				.SourceFormat = PF_DXT1
+			}));
+		});
+	});
+}
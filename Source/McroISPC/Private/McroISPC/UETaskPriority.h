@@ -0,0 +1,41 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "McroISPC/TaskSystem.h"
+#include "Tasks/Task.h"
+
+// UE task priorities of ISPC launches, both the UE task system and launch graphs dispatch with these
+#ifndef ISPC_UE_TASKS_PRIORITY
+#define ISPC_UE_TASKS_PRIORITY UE::Tasks::ETaskPriority::Normal
+#endif
+#ifndef ISPC_UE_TASKS_CRITICAL_PRIORITY
+#define ISPC_UE_TASKS_CRITICAL_PRIORITY UE::Tasks::ETaskPriority::High
+#endif
+#ifndef ISPC_UE_TASKS_BACKGROUND_PRIORITY
+#define ISPC_UE_TASKS_BACKGROUND_PRIORITY UE::Tasks::ETaskPriority::BackgroundNormal
+#endif
+
+namespace Mcro::ISPC::Detail
+{
+	/** @brief The UE task priority ISPC tasks of given launch priority are dispatched with */
+	FORCEINLINE UE::Tasks::ETaskPriority GetUETaskPriority(ELaunchPriority priority)
+	{
+		switch (priority)
+		{
+		case ELaunchPriority::FrameCritical: return ISPC_UE_TASKS_CRITICAL_PRIORITY;
+		case ELaunchPriority::Background:    return ISPC_UE_TASKS_BACKGROUND_PRIORITY;
+		default:                             return ISPC_UE_TASKS_PRIORITY;
+		}
+	}
+}
@@ -0,0 +1,108 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ *	@brief
+ *	An opt-in shared bump allocator serving `ISPCAlloc` requests which don't fit into the small inline buffer of ISPC
+ *	task groups.
+ *
+ *	Memory handed out by the frame arena is only valid until the task group which requested it is synced (the same
+ *	lifespan ISPC guarantees for `ISPCAlloc`), and the whole arena is rewound at the end of every frame. The reset is
+ *	skipped (and counted) when a task group is still holding frame arena memory at that time, so it's safe to sync
+ *	ISPC kernels across frame boundaries. When the arena is exhausted allocations fall back to the heap as before.
+ */
+namespace Mcro::ISPC
+{
+	/** @brief Usage metrics of the ISPC frame arena, use them to size the arena appropriately */
+	struct FFrameArenaStats
+	{
+		/** @brief Current size of the arena in bytes, 0 when it's disabled */
+		uint64 Capacity = 0;
+
+		/** @brief Bytes handed out since the last reset */
+		uint64 Used = 0;
+
+		/** @brief Peak of bytes handed out during the last completed frame */
+		uint64 LastFrameHighWaterMark = 0;
+
+		/** @brief Peak of bytes handed out during a single frame since the arena was enabled */
+		uint64 HighWaterMark = 0;
+
+		/** @brief Number of allocations which didn't fit into the arena and fell back to the heap */
+		uint64 Overflows = 0;
+
+		/** @brief Number of resets which had to be postponed because task groups were still holding arena memory */
+		uint64 DeferredResets = 0;
+	};
+
+	/** @brief Where the memory of the frame arena comes from, the default is FMemory */
+	struct FFrameArenaMemory
+	{
+		void* (*Allocate)(uint64 size) = nullptr;
+		void (*Free)(void* memory, uint64 size) = nullptr;
+	};
+
+	/**
+	 *	@brief
+	 *	Back the frame arena with custom memory (for example large pages). It takes effect when the arena is next
+	 *	(re)allocated, so call it before EnableFrameArena. Passing an empty FFrameArenaMemory restores FMemory.
+	 */
+	MCROISPC_API void SetFrameArenaMemory(FFrameArenaMemory const& memory);
+
+	/**
+	 *	@brief
+	 *	Make `ISPCAlloc` draw from a frame arena of given size. If the arena is already enabled it will be resized at
+	 *	the next reset.
+	 *	
+	 *	@param capacity  Size of the arena in bytes
+	 */
+	MCROISPC_API void EnableFrameArena(uint64 capacity);
+
+	/** @brief Stop serving `ISPCAlloc` from the frame arena, it's memory is freed at the next reset */
+	MCROISPC_API void DisableFrameArena();
+
+	/** @returns True if the frame arena is (or about to be) enabled */
+	MCROISPC_API bool IsFrameArenaEnabled();
+
+	/**
+	 *	@brief
+	 *	Rewind the frame arena. This is called automatically at the end of each engine frame, but it can be called
+	 *	manually at other well defined points where no ISPC work is expected to be in flight.
+	 *	
+	 *	@return  False if there were still task groups holding arena memory and the reset was deferred.
+	 */
+	MCROISPC_API bool ResetFrameArena();
+
+	/** @returns Usage metrics of the frame arena */
+	MCROISPC_API FFrameArenaStats GetFrameArenaStats();
+
+	namespace Detail
+	{
+		/**
+		 *	@brief
+		 *	Called by a task group before its first frame arena allocation. Every successful acquire must be paired
+		 *	with a ReleaseFrameArena once the task group is synced.
+		 *	
+		 *	@return  False when the arena is disabled or it's being reset at the moment. 
+		 */
+		bool AcquireFrameArena();
+
+		/** @brief Signal that a task group doesn't use its frame arena memory anymore */
+		void ReleaseFrameArena();
+
+		/** @returns Memory from the frame arena or nullptr if it's exhausted */
+		void* AllocFromFrameArena(int64 size, int32 alignment);
+	}
+}
@@ -0,0 +1,51 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	@brief
+ *	Tell which instruction set ISPC kernels run with. On platforms having more than one, ISPC sources are compiled
+ *	for several targets, and the best one supported by the CPU is selected when a kernel is first called.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Mcro::ISPC
+{
+	/** @brief Instruction sets ISPC kernels can be compiled for, in increasing order of preference per architecture */
+	enum class EIspcTarget : uint8
+	{
+		Unknown,
+		SSE4,
+		AVX,
+		AVX2,
+		AVX512SKX,
+		NEON
+	};
+
+	/** @returns The ISPC targets kernels in this build are compiled for, in the order of preference */
+	MCROISPC_API TConstArrayView<EIspcTarget> GetCompiledIspcTargets();
+
+	/** @returns Whether the CPU (and the OS) of this machine supports the instruction set of the given ISPC target */
+	MCROISPC_API bool IsIspcTargetSupported(EIspcTarget target);
+
+	/**
+	 *	@returns
+	 *	The target the ISPC dispatcher selects on this machine, which is the first compiled target supported by the
+	 *	CPU. This is the same for every ISPC kernel as the targets are set by the build for the entire toolchain.
+	 */
+	MCROISPC_API EIspcTarget GetIspcTarget();
+
+	/** @returns The name of the given ISPC target as it's given to the ISPC compiler */
+	MCROISPC_API const TCHAR* GetIspcTargetName(EIspcTarget target);
+}
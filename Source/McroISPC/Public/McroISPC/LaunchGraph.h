@@ -0,0 +1,157 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	@brief
+ *	Dependency-aware scheduling of ISPC task launches.
+ *
+ *	ISPC `launch` / `sync` is fork-join only, so a multi-stage kernel written in ISPC synchronizes every worker after
+ *	each stage. FLaunchGraph submits each stage from C++ as a node with explicit prerequisites instead: a node is
+ *	launched (through ISPCLaunch, on the selected task system) as soon as all of its prerequisites finished, so
+ *	independent branches overlap and the tail of one stage doesn't hold up unrelated work.
+ *
+ *	@code
+ *	FLaunchGraph graph;
+ *	auto build = graph.Add(TEXT("Build"), binCount, [&](int32 task, int32 count) { ispc::BuildBins(...); });
+ *	auto scan = graph.Add(TEXT("PrefixSum"), 1, [&](int32, int32) { ispc::ScanBins(...); }, { build });
+ *	graph.Add(TEXT("Scatter"), binCount, [&](int32 task, int32 count) { ispc::Scatter(...); }, { scan });
+ *	graph.Run();
+ *	// ... other work ...
+ *	graph.Wait();
+ *	@endcode
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include "McroISPC/TaskSystem.h"
+
+namespace Mcro::ISPC
+{
+	/** @brief Signature of the ISPC task functions, as they are passed to ISPCLaunch */
+	using FTaskFunction = void(*)(
+		void* data, int threadIndex, int threadCount,
+		int taskIndex, int taskCount,
+		int taskIndex0, int taskIndex1, int taskIndex2,
+		int taskCount0, int taskCount1, int taskCount2
+	);
+
+	/** @brief Refers to a node of an FLaunchGraph it was added to */
+	struct FLaunchNode
+	{
+		int32 Index = INDEX_NONE;
+
+		bool IsValid() const { return Index != INDEX_NONE; }
+	};
+
+	/**
+	 *	@brief
+	 *	A small DAG of ISPC launches. Nodes can only depend on nodes added before them so the graph cannot have
+	 *	cycles. Every node is dispatched with ISPCLaunch, so task coalescing, worker placement and Insights tracing
+	 *	of the selected task system apply to them, and their tasks may make nested launches.
+	 *
+	 *	The graph is built on one thread, then executed once with Run. Data referenced by the nodes must stay alive
+	 *	until Wait returns. The destructor waits for a running graph.
+	 *
+	 *	Nodes are launched with the ELaunchPriority in effect when they were added (see MCRO_ISPC_LAUNCH_PRIORITY).
+	 */
+	class MCROISPC_API FLaunchGraph
+	{
+	public:
+		/** @brief A C++ task body receiving the index of the task and the number of tasks in its node */
+		using FTaskBody = TFunction<void(int32 taskIndex, int32 taskCount)>;
+
+		FLaunchGraph() = default;
+		~FLaunchGraph();
+
+		FLaunchGraph(const FLaunchGraph&) = delete;
+		FLaunchGraph& operator = (const FLaunchGraph&) = delete;
+
+		/**
+		 *	@brief  Add a node launching an ISPC task function, equivalent of `launch[countX, countY, countZ]`.
+		 *
+		 *	@param name           Name of the launch in Insights, a string with static storage duration or nullptr
+		 *	@param taskFunction   Called for each task of the node
+		 *	@param data           Passed to each task, it must outlive the execution of the graph
+		 *	@param countX         Task counts of the launch, nodes with zero tasks complete immediately
+		 *	@param countY
+		 *	@param countZ
+		 *	@param prerequisites  Nodes which must finish before this node starts
+		 */
+		FLaunchNode Add(
+			const TCHAR* name,
+			FTaskFunction taskFunction, void* data,
+			int32 countX, int32 countY = 1, int32 countZ = 1,
+			TConstArrayView<FLaunchNode> prerequisites = {}
+		);
+
+		/**
+		 *	@brief
+		 *	Add a node running a C++ callable for each of its tasks, for example one calling an exported ISPC
+		 *	function on a slice of the data.
+		 *
+		 *	@param name           Name of the launch in Insights, a string with static storage duration or nullptr
+		 *	@param taskCount      Number of tasks, nodes with zero tasks complete immediately
+		 *	@param body           Called for each task of the node
+		 *	@param prerequisites  Nodes which must finish before this node starts
+		 */
+		FLaunchNode Add(
+			const TCHAR* name,
+			int32 taskCount,
+			FTaskBody&& body,
+			TConstArrayView<FLaunchNode> prerequisites = {}
+		);
+
+		/** @brief Start the nodes without prerequisites, the rest start when their prerequisites finished */
+		void Run();
+
+		/**
+		 *	@brief
+		 *	Wait until every node of the graph finished, the calling thread may execute tasks meanwhile. It also runs
+		 *	the graph if it wasn't started yet.
+		 */
+		void Wait();
+
+		/** @returns True if the graph has been run and all of its nodes finished */
+		bool IsCompleted() const;
+
+		/** @returns Number of nodes added to the graph */
+		int32 Num() const { return Nodes.Num(); }
+
+	private:
+		struct FNode
+		{
+			const TCHAR* Name = nullptr;
+			FTaskFunction TaskFunction = nullptr;
+			void* Data = nullptr;
+			int32 Count[3] { 0, 0, 0 };
+			FTaskBody Body;
+			TArray<int32, TInlineAllocator<4>> Prerequisites;
+			ELaunchPriority Priority = ELaunchPriority::Normal;
+			bool bHasDependents = false;
+		};
+
+		FLaunchNode AddNode(FNode&& node, TConstArrayView<FLaunchNode> prerequisites);
+
+		static void RunBody(
+			void* data, int threadIndex, int threadCount,
+			int taskIndex, int taskCount,
+			int taskIndex0, int taskIndex1, int taskIndex2,
+			int taskCount0, int taskCount1, int taskCount2
+		);
+
+		TArray<FNode> Nodes;
+		TArray<UE::Tasks::FTask> Tasks;
+		TArray<UE::Tasks::FTask> Sinks;
+	};
+}
@@ -0,0 +1,211 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	@brief
+ *	Task-parallel ISPC kernels over contiguous arrays of `float` or `int32`. They're available as plain functions
+ *	taking array views in `Mcro::ISPC`, and as pipeline terminals for contiguous ranges in `Mcro::Range`, for example:
+ *	@code
+ *	using namespace Mcro::Range;
+ *	TArray<float> values = ...;
+ *	float sum = values | IspcSum();
+ *	TArray<float> scaled = values | IspcTransformAffine(2.0f, 1.0f);
+ *	@endcode
+ *	Inputs are split into tasks of at least `Mcro::ISPC::NumericElementsPerTask` elements, so small inputs run in a
+ *	single task on the calling thread's gang.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Mcro/Range/Contiguous.h"
+
+namespace Mcro::ISPC
+{
+	/** @brief Aim for at least this many elements per task, so tiny inputs are not split at all */
+	inline constexpr int32 NumericElementsPerTask = 64 * 1024;
+
+	/** @brief Result of MinMax */
+	template <typename T>
+	struct TMinMax
+	{
+		T Min;
+		T Max;
+	};
+
+	/** @brief Sum of the elements. The order of additions differs from a sequential loop */
+	MCROISPC_API float Sum(TConstArrayView<float> values);
+
+	/** @brief Sum of the elements, accumulated in 64 bits so it doesn't overflow */
+	MCROISPC_API int64 Sum(TConstArrayView<int32> values);
+
+	/** @returns The smallest and the largest element, or nothing if input is empty */
+	MCROISPC_API TOptional<TMinMax<float>> MinMax(TConstArrayView<float> values);
+
+	/** @copydoc MinMax */
+	MCROISPC_API TOptional<TMinMax<int32>> MinMax(TConstArrayView<int32> values);
+
+	/** @brief Dot product of two arrays of the same size */
+	MCROISPC_API float Dot(TConstArrayView<float> a, TConstArrayView<float> b);
+
+	/**
+	 *	@brief
+	 *	Inclusive prefix sum, `result[i]` is the sum of `values[0]` to `values[i]`. `result` must have the same size
+	 *	as `values`, they may be the same array for an in-place scan. Integers wrap around on overflow.
+	 */
+	MCROISPC_API void PrefixSum(TConstArrayView<float> values, TArrayView<float> result);
+
+	/** @copydoc PrefixSum */
+	MCROISPC_API void PrefixSum(TConstArrayView<int32> values, TArrayView<int32> result);
+
+	/**
+	 *	@brief
+	 *	Count the values into bins evenly dividing [low, high]. Values equal to high are counted in the last bin,
+	 *	values outside the interval (and NaNs) are ignored. Previous content of `bins` is overwritten. When low equals
+	 *	high (or the interval is too narrow to be divided), every value equal to them is counted in the last bin.
+	 */
+	MCROISPC_API void Histogram(TConstArrayView<float> values, float low, float high, TArrayView<int32> bins);
+
+	/**
+	 *	@brief
+	 *	`result[i] = source[indices[i]]`. `result` must have the same size as `indices`, and every index must be
+	 *	valid in `source`, which is only checked with `checkSlow`.
+	 */
+	MCROISPC_API void Gather(TConstArrayView<float> source, TConstArrayView<int32> indices, TArrayView<float> result);
+
+	/** @copydoc Gather */
+	MCROISPC_API void Gather(TConstArrayView<int32> source, TConstArrayView<int32> indices, TArrayView<int32> result);
+
+	/**
+	 *	@brief
+	 *	`result[i] = values[i] * scale + offset`. `result` must have the same size as `values`, they may be the same
+	 *	array for an in-place transform. Integers wrap around on overflow.
+	 */
+	MCROISPC_API void TransformAffine(TConstArrayView<float> values, TArrayView<float> result, float scale, float offset);
+
+	/** @copydoc TransformAffine */
+	MCROISPC_API void TransformAffine(TConstArrayView<int32> values, TArrayView<int32> result, int32 scale, int32 offset);
+}
+
+namespace Mcro::Range
+{
+	namespace Detail
+	{
+		template <typename Range>
+		using TContiguousElement = std::remove_const_t<std::remove_pointer_t<decltype(GetContiguousData(DeclVal<Range&>()))>>;
+
+		template <CContiguousRange Range>
+		auto AsConstIspcView(Range&& range)
+		{
+			const int64 num = GetContiguousNum(range);
+			check(num <= MAX_int32);
+			return TConstArrayView<TContiguousElement<Range>>(GetContiguousData(range), static_cast<int32>(num));
+		}
+	}
+
+	/** @brief A contiguous range of elements which ISPC numeric kernels accept (`float` or `int32`) */
+	template <typename Range>
+	concept CIspcNumericRange = CContiguousRange<Range>
+		&& (CSameAs<Detail::TContiguousElement<Range>, float> || CSameAs<Detail::TContiguousElement<Range>, int32>)
+	;
+
+	/** @brief A contiguous range of floats */
+	template <typename Range>
+	concept CIspcFloatRange = CIspcNumericRange<Range> && CSameAs<Detail::TContiguousElement<Range>, float>;
+
+	/** @brief Pipeline terminal for `Mcro::ISPC::Sum` */
+	FORCEINLINE auto IspcSum()
+	{
+		return ranges::make_pipeable([]<CIspcNumericRange Input>(Input&& range)
+		{
+			return Mcro::ISPC::Sum(Detail::AsConstIspcView(range));
+		});
+	}
+
+	/** @brief Pipeline terminal for `Mcro::ISPC::MinMax` */
+	FORCEINLINE auto IspcMinMax()
+	{
+		return ranges::make_pipeable([]<CIspcNumericRange Input>(Input&& range)
+		{
+			return Mcro::ISPC::MinMax(Detail::AsConstIspcView(range));
+		});
+	}
+
+	/** @brief Pipeline terminal for `Mcro::ISPC::Dot` with another contiguous range of floats */
+	template <CIspcFloatRange Other>
+	auto IspcDot(Other&& other)
+	{
+		return ranges::make_pipeable([other = Detail::AsConstIspcView(other)]<CIspcFloatRange Input>(Input&& range)
+		{
+			return Mcro::ISPC::Dot(Detail::AsConstIspcView(range), other);
+		});
+	}
+
+	/** @brief Pipeline terminal for `Mcro::ISPC::PrefixSum`, returning the result in a new array */
+	FORCEINLINE auto IspcPrefixSum()
+	{
+		return ranges::make_pipeable([]<CIspcNumericRange Input>(Input&& range)
+		{
+			auto values = Detail::AsConstIspcView(range);
+			TArray<Detail::TContiguousElement<Input>> result;
+			result.SetNumUninitialized(values.Num());
+			Mcro::ISPC::PrefixSum(values, result);
+			return result;
+		});
+	}
+
+	/** @brief Pipeline terminal for `Mcro::ISPC::Histogram`, returning `binCount` bins */
+	FORCEINLINE auto IspcHistogram(float low, float high, int32 binCount)
+	{
+		return ranges::make_pipeable([=]<CIspcFloatRange Input>(Input&& range)
+		{
+			TArray<int32> bins;
+			bins.SetNumUninitialized(binCount);
+			Mcro::ISPC::Histogram(Detail::AsConstIspcView(range), low, high, bins);
+			return bins;
+		});
+	}
+
+	/**
+	 *	@brief
+	 *	Pipeline terminal for `Mcro::ISPC::Gather`, the input is the source and the result is a new array with the
+	 *	same size as the given indices.
+	 */
+	template <CContiguousRange Indices>
+	requires CSameAs<Detail::TContiguousElement<Indices>, int32>
+	auto IspcGather(Indices&& indices)
+	{
+		return ranges::make_pipeable([indices = Detail::AsConstIspcView(indices)]<CIspcNumericRange Input>(Input&& range)
+		{
+			TArray<Detail::TContiguousElement<Input>> result;
+			result.SetNumUninitialized(indices.Num());
+			Mcro::ISPC::Gather(Detail::AsConstIspcView(range), indices, result);
+			return result;
+		});
+	}
+
+	/** @brief Pipeline terminal for `Mcro::ISPC::TransformAffine`, returning the result in a new array */
+	template <typename T>
+	requires CSameAs<T, float> || CSameAs<T, int32>
+	auto IspcTransformAffine(T scale, T offset)
+	{
+		return ranges::make_pipeable([=]<CIspcNumericRange Input>(Input&& range)
+		requires CSameAs<Detail::TContiguousElement<Input>, T>
+		{
+			auto values = Detail::AsConstIspcView(range);
+			TArray<T> result;
+			result.SetNumUninitialized(values.Num());
+			Mcro::ISPC::TransformAffine(values, result, scale, offset);
+			return result;
+		});
+	}
+}
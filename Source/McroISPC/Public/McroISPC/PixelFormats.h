@@ -0,0 +1,67 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	@brief
+ *	Task-parallel ISPC kernels converting images between common pixel formats on the CPU.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+
+namespace Mcro::Rendering::Textures
+{
+	/**
+	 *	@brief
+	 *	Describing a pixel conversion for ConvertPixels. Supported formats are `PF_B8G8R8A8`, `PF_R8G8B8A8`,
+	 *	`PF_FloatRGBA` and `PF_A2B10G10R10`, in any combination.
+	 */
+	struct FPixelConversion
+	{
+		EPixelFormat SourceFormat = PF_B8G8R8A8;
+		EPixelFormat DestinationFormat = PF_B8G8R8A8;
+
+		/** @brief The source colors are sRGB encoded and they should be converted to linear first */
+		bool bSourceSrgb = false;
+
+		/** @brief The destination colors should be sRGB encoded */
+		bool bDestinationSrgb = false;
+
+		/** @brief Distance between the rows of the source in bytes, 0 means tightly packed rows */
+		int32 SourceRowBytes = 0;
+
+		/** @brief Distance between the rows of the destination in bytes, 0 means tightly packed rows */
+		int32 DestinationRowBytes = 0;
+	};
+
+	/** @returns True if ConvertPixels can convert from one pixel format to the other */
+	MCROISPC_API bool CanConvertPixels(EPixelFormat from, EPixelFormat to);
+
+	/**
+	 *	@brief
+	 *	Convert an image between pixel formats, optionally between sRGB and linear color. The kernel is selected from
+	 *	the source and destination formats: identical layouts are copied, BGRA8 <-> RGBA8 without a transfer function
+	 *	change is a plain swizzle, everything else is decoded to floats and encoded again. The work is split by rows
+	 *	into ISPC tasks. Source and destination must not overlap, unless they're the same with the same row size.
+	 *
+	 *	@return  False if the formats are not supported (see FPixelConversion)
+	 */
+	MCROISPC_API bool ConvertPixels(
+		const void* source,
+		void* destination,
+		int32 width,
+		int32 height,
+		FPixelConversion const& conversion = {}
+	);
+}
@@ -0,0 +1,290 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	@brief
+ *	Runtime configuration of the task system serving ISPC `launch` and `sync`.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ *	@brief
+ *	Set the priority of the ISPC launches made from the current scope. Tasks inherit the priority of their launch,
+ *	so launches nested inside them keep it unless they're in a scope of their own.
+ */
+#define MCRO_ISPC_LAUNCH_PRIORITY(priority) \
+	const Mcro::ISPC::FScopedLaunchPriority PREPROCESSOR_JOIN(McroIspcLaunchPriority_, __LINE__)(priority)
+
+namespace Mcro::ISPC
+{
+	/**
+	 *	@brief
+	 *	Select the task system executing ISPC launches, overriding the `McroISPC.TaskSystem` console variable. The
+	 *	task system is decided on the first ISPC launch and it cannot be changed afterwards, so call this early, like
+	 *	in the `StartupModule` of a module loading before the first ISPC kernel runs.
+	 *	
+	 *	@param name  One of GetAvailableTaskSystems (case insensitive)
+	 *	@return  False if the task system is not available or a task system has been already selected
+	 */
+	MCROISPC_API bool SetTaskSystem(const TCHAR* name);
+
+	/** @returns The names of the task systems compiled in for the current platform */
+	MCROISPC_API TArray<const TCHAR*> GetAvailableTaskSystems();
+
+	/** @returns Name of the task system ISPC launches are executed with (this also locks the selection) */
+	MCROISPC_API const TCHAR* GetTaskSystemName();
+
+	/**
+	 *	@returns
+	 *	Number of threads the task system executes ISPC tasks on (including the thread calling sync). This creates
+	 *	the worker threads of the task system if they weren't created yet.
+	 */
+	MCROISPC_API int32 GetTaskSystemWorkerCount();
+
+	/** @brief Which cores should the ISPC worker threads prefer on hybrid CPUs */
+	enum class ECorePreference : uint8
+	{
+		/** @brief Let the OS schedule workers on any core */
+		Any,
+
+		/** @brief Restrict all workers to performance cores */
+		PerformanceOnly,
+
+		/**
+		 *	@brief
+		 *	Workers are split between performance and efficiency cores, but workers on efficiency cores don't steal
+		 *	long-running launches for a while, giving workers on performance cores a chance to pick them up first.
+		 *	Only the work-stealing task system supports this, others treat it as `Any`.
+		 */
+		PerformanceForLongTasks
+	};
+
+	/**
+	 *	@brief
+	 *	Placement of the worker threads created by the pthreads and work-stealing ISPC task systems. The UE task
+	 *	system runs on the engine worker threads so it's not affected.
+	 *
+	 *	By default these are read from the following console variables (which can be set from ini files or the
+	 *	command line), unless SetWorkerPlacement has been called:
+	 *	- `McroISPC.WorkerCount`
+	 *	- `McroISPC.AffinityMask`
+	 *	- `McroISPC.WorkerPriority`
+	 *	- `McroISPC.CorePreference`
+	 *	- `McroISPC.LongTaskMicroseconds`
+	 *	
+	 *	Worker threads are created on the first ISPC launch, changes afterwards have no effect on them.
+	 */
+	struct FWorkerPlacementSettings
+	{
+		/** @brief Number of worker threads, 0 means one less than the (selected) logical processors */
+		int32 WorkerCount = 0;
+
+		/**
+		 *	@brief
+		 *	Logical processors (of the first 64) the workers may run on, 0 means it's decided by CorePreference.
+		 *	An explicit mask overrides CorePreference.
+		 */
+		uint64 AffinityMask = 0;
+
+		EThreadPriority Priority = TPri_Normal;
+
+		ECorePreference CorePreference = ECorePreference::Any;
+
+		/**
+		 *	@brief
+		 *	With `ECorePreference::PerformanceForLongTasks` launches are considered long-running when the measured
+		 *	average execution time of their tasks exceeds this.
+		 */
+		double LongTaskMicroseconds = 500.0;
+	};
+
+	/** @brief Override the console variables deciding ISPC worker placement */
+	MCROISPC_API void SetWorkerPlacement(const FWorkerPlacementSettings& settings);
+
+	/** @returns The ISPC worker placement in effect */
+	MCROISPC_API FWorkerPlacementSettings GetWorkerPlacement();
+
+	/** @brief Logical processors grouped by core type (limited to the first 64 logical processors) */
+	struct FCpuTopology
+	{
+		uint64 PerformanceCoreMask = 0;
+		uint64 EfficiencyCoreMask = 0;
+
+		/** @brief False if the CPU has only one type of cores or the topology couldn't be detected */
+		bool bHybrid = false;
+	};
+
+	/** @returns The detected core types of the current CPU */
+	MCROISPC_API const FCpuTopology& GetCpuTopology();
+
+	/**
+	 *	@brief
+	 *	Settings for automatically coalescing many tiny ISPC tasks into fewer dispatched units of work.
+	 *
+	 *	When enabled, launches with more tasks than `UnitsPerWorker` times the number of workers are split into
+	 *	chunks of consecutive task indices. The chunk count is derived from the measured average execution time of
+	 *	previous launches of the same task function, so each dispatched chunk takes roughly `MinUnitMicroseconds`,
+	 *	but there are never fewer chunks than workers. The `taskIndex` / `taskCount` values seen by ISPC code are
+	 *	unaffected.
+	 */
+	struct FTaskCoalescingSettings
+	{
+		bool bEnabled = false;
+
+		/** @brief The desired minimum duration of a single dispatched chunk of tasks */
+		double MinUnitMicroseconds = 20.0;
+
+		/** @brief Launches with fewer tasks than this times the worker count are never coalesced */
+		int32 UnitsPerWorker = 8;
+	};
+
+	/** @brief Configure automatic ISPC task coalescing, it's disabled by default */
+	MCROISPC_API void SetTaskCoalescing(const FTaskCoalescingSettings& settings);
+
+	/** @returns The current ISPC task coalescing settings */
+	MCROISPC_API FTaskCoalescingSettings GetTaskCoalescing();
+
+	/**
+	 *	@brief
+	 *	Counters of the ISPC task group pool. Task groups are first recycled via a small thread-local cache (which
+	 *	is not counted) then via a shared lock-free stack.
+	 */
+	struct FTaskGroupPoolStats
+	{
+		/** @brief Number of task groups allocated because no pooled one was available (pool misses) */
+		uint64 Created = 0;
+
+		/** @brief Number of task groups taken from the shared pool because the thread-local cache was empty */
+		uint64 SharedPoolHits = 0;
+
+		/** @brief Number of task groups returned to the shared pool because the thread-local cache was full */
+		uint64 SharedPoolReturns = 0;
+	};
+
+	/** @returns Counters of the ISPC task group pool since startup */
+	MCROISPC_API FTaskGroupPoolStats GetTaskGroupPoolStats();
+
+	/**
+	 *	@brief
+	 *	Scheduling class of ISPC launches. Workers pick up queued tasks of higher priorities first, and tasks of
+	 *	background launches give way to queued higher priority work at task boundaries.
+	 *
+	 *	- UE task system: launches are dispatched with `ISPC_UE_TASKS_CRITICAL_PRIORITY` (High),
+	 *	  `ISPC_UE_TASKS_PRIORITY` (Normal) or `ISPC_UE_TASKS_BACKGROUND_PRIORITY` (BackgroundNormal)
+	 *	- Work-stealing and pthreads task systems: separate queues for each priority
+	 *	- GCD: high, default and background priority global queues
+	 *	- ConcRT: not supported, every launch is scheduled the same way
+	 */
+	enum class ELaunchPriority : uint8
+	{
+		/** @brief Work the current frame is waiting for */
+		FrameCritical,
+
+		/** @brief The default priority */
+		Normal,
+
+		/** @brief Long-running work not bound to frames, like navmesh or cache baking */
+		Background
+	};
+
+	constexpr int32 LaunchPriorityCount = 3;
+
+	/** @returns The priority of ISPC launches made from the calling thread */
+	MCROISPC_API ELaunchPriority GetLaunchPriority();
+
+	/** @brief Counters of how launch priorities were honored, only the UE task system reports them */
+	struct FLaunchPriorityStats
+	{
+		/** @brief Number of times a background range gave its worker to higher priority launches */
+		uint64 BackgroundYields = 0;
+
+		/** @brief Number of frame-critical and normal ranges which still have tasks nobody has claimed yet */
+		int32 UnclaimedUrgentRanges = 0;
+	};
+
+	/** @returns Counters of launch priorities since startup */
+	MCROISPC_API FLaunchPriorityStats GetLaunchPriorityStats();
+
+	/** @brief Set the priority of ISPC launches made from this thread while this object is alive. Prefer MCRO_ISPC_LAUNCH_PRIORITY */
+	class MCROISPC_API FScopedLaunchPriority
+	{
+	public:
+		FScopedLaunchPriority(ELaunchPriority priority);
+		~FScopedLaunchPriority();
+
+		FScopedLaunchPriority(const FScopedLaunchPriority&) = delete;
+		FScopedLaunchPriority& operator = (const FScopedLaunchPriority&) = delete;
+
+	private:
+		ELaunchPriority Previous;
+	};
+
+	namespace Detail
+	{
+		/** @brief Measured execution time of a given ISPC task function */
+		struct FTaskTimingStats;
+
+		/** @brief How should a launch be dispatched */
+		struct FLaunchPlan
+		{
+			/** @brief The number of chunks, equals to the task count if the launch isn't coalesced */
+			int32 Chunks;
+
+			/** @brief The timing stats the chunks should record into, or nullptr if no measurement is needed */
+			FTaskTimingStats* TimingStats;
+
+			/** @brief The launch is expected to be long-running and it should prefer performance cores */
+			bool bPreferPerformanceCores;
+		};
+
+		/**
+		 *	@brief  Decide how a launch should be dispatched
+		 *	
+		 *	@param taskFunction  The launched ISPC task function
+		 *	@param taskCount     Total number of tasks in the launch
+		 *	@param workerCount   Number of threads the current task system may run tasks on
+		 */
+		FLaunchPlan PlanLaunch(const void* taskFunction, int32 taskCount, int32 workerCount);
+
+		/** @brief Record how long did it take to run a number of tasks */
+		void RecordTaskTiming(FTaskTimingStats* stats, int32 taskCount, uint64 cycles);
+
+		enum class ETaskGroupPoolEvent
+		{
+			Created,
+			SharedPoolHit,
+			SharedPoolReturn
+		};
+
+		/** @brief Increment the pool counter corresponding to given event */
+		void CountTaskGroupPoolEvent(ETaskGroupPoolEvent event);
+
+		/**
+		 *	@returns
+		 *	The number of worker threads a task system should create according to current placement settings.
+		 *	
+		 *	@param defaultCount  Number of workers when it's not specified by the placement settings
+		 */
+		int32 GetWorkerCount(int32 defaultCount);
+
+		/**
+		 *	@brief  Apply the placement settings to the calling worker thread
+		 *	
+		 *	@param workerIndex  Ordinal of the calling worker among the workers of the task system
+		 *	@return  True if the worker has been placed on efficiency cores
+		 */
+		bool PlaceWorkerThread(int32 workerIndex);
+	}
+}
@@ -0,0 +1,126 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+/**
+ *	@file
+ *	@brief
+ *	Unreal Insights instrumentation of ISPC `launch` and `sync`.
+ *
+ *	Tracing is opt-in, enable the `McroISPC` channel (for example with `-trace=cpu,McroISPC`) to record for each
+ *	launch:
+ *	- A `McroISPC.Launch` event with the task function pointer, the task name and `countx/y/z`
+ *	- A CPU timing span around the launch itself
+ *	- A CPU timing span for every executed task (on whichever thread it ran on)
+ *	- A CPU timing span for the time the launching thread spent in `sync`
+ *
+ *	ISPC task functions are internal symbols of the ISPC module, so the launches are named after the innermost
+ *	MCRO_ISPC_TASK_NAME scope on the launching thread, or a name registered for the task function pointer, or
+ *	finally just the address of the task function. Launches made from inside ISPC tasks inherit the name of the task
+ *	group which launched them.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#define MCRO_ISPC_TRACE CPUPROFILERTRACE_ENABLED
+
+#if MCRO_ISPC_TRACE
+UE_TRACE_CHANNEL_EXTERN(McroISPCChannel, MCROISPC_API)
+#endif
+
+/**
+ *	@brief
+ *	Name the ISPC launches made from the current scope in Unreal Insights. The name must be a string with static
+ *	storage duration (like a string literal).
+ */
+#define MCRO_ISPC_TASK_NAME(name) \
+	const Mcro::ISPC::FScopedTaskName PREPROCESSOR_JOIN(McroIspcTaskName_, __LINE__)(name)
+
+namespace Mcro::ISPC
+{
+	/**
+	 *	@brief
+	 *	Give a permanent name to an ISPC task function, if it can be referred to from C++ (for example when the task
+	 *	is also declared as `export`).
+	 *	
+	 *	@param taskFunction  The function pointer ISPC passes to ISPCLaunch
+	 *	@param name          A string with static storage duration
+	 */
+	MCROISPC_API void RegisterTaskName(const void* taskFunction, const TCHAR* name);
+
+	/**
+	 *	@brief
+	 *	Receiver of every ISPC launch, for tracing backends other than Unreal Insights. It's called on the launching
+	 *	thread, `name` is null if the launch has no name.
+	 */
+	using FLaunchObserver = void(*)(const TCHAR* name, const void* taskFunction, int countx, int county, int countz);
+
+	/** @brief Install a launch observer or remove it with nullptr. There can be only one at a time */
+	MCROISPC_API void SetLaunchObserver(FLaunchObserver observer);
+
+	/** @brief Name the ISPC launches made from this thread while this object is alive. Prefer MCRO_ISPC_TASK_NAME */
+	class MCROISPC_API FScopedTaskName
+	{
+	public:
+		FScopedTaskName(const TCHAR* name);
+		~FScopedTaskName();
+
+	private:
+		const TCHAR* Previous;
+	};
+
+	namespace Detail
+	{
+		/** @brief Registered CPU profiler event types for a given launch */
+		struct FTaskTraceSpecs
+		{
+			const TCHAR* Name;
+			uint32 Launch;
+			uint32 Task;
+			uint32 Sync;
+		};
+
+		/** @returns Event types for tasks of given function launched from this thread, or nullptr when not tracing */
+		const FTaskTraceSpecs* GetTaskTraceSpecs(const void* taskFunction);
+
+		/** @brief Emit the launch event carrying the task counts, and notify the launch observer */
+		void TraceLaunch(const FTaskTraceSpecs* specs, const void* taskFunction, int countx, int county, int countz);
+
+		enum class ETraceSpan
+		{
+			Launch,
+			Task,
+			Sync
+		};
+
+		/**
+		 *	@brief
+		 *	A CPU timing span of an ISPC launch, task or sync. Task spans also propagate the task name to launches
+		 *	made from within the task.
+		 */
+		class FTaskTraceScope
+		{
+		public:
+			FTaskTraceScope(const FTaskTraceSpecs* specs, ETraceSpan span);
+			~FTaskTraceScope();
+
+		private:
+#if MCRO_ISPC_TRACE
+			FCpuProfilerTrace::FEventScope Scope;
+#endif
+			const TCHAR* PreviousName;
+			bool bNamesTasks;
+		};
+	}
+}
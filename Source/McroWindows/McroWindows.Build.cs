@@ -44,6 +44,7 @@ public class McroWindows : ModuleRules
 		{
 			"CoreUObject",
 			"Engine",
+			"McroISPC",
 		});
 		
 		PublicSystemLibraries.AddRange(new[]
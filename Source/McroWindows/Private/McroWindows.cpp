@@ -10,7 +10,26 @@
  */
 
 #include "Modules/ModuleManager.h"
+#include "McroWindows/Tracing/Etw.h"
 
-class FMcroWindowsModule : public IModuleInterface {};
+namespace Mcro::Windows::IO::Detail
+{
+	extern void ShutdownCompletionPort();
+}
+
+class FMcroWindowsModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		Mcro::Windows::Tracing::Detail::RegisterEtwProvider();
+	}
+
+	virtual void ShutdownModule() override
+	{
+		Mcro::Windows::Tracing::Detail::UnregisterEtwProvider();
+		Mcro::Windows::IO::Detail::ShutdownCompletionPort();
+	}
+};
 
 IMPLEMENT_MODULE(FMcroWindowsModule, McroWindows);
@@ -12,6 +12,7 @@
 #include "McroWindows/Error/WindowsError.h"
 #include "Mcro/TextMacros.h"
 #include "Windows/WindowsPlatformMisc.h"
+#include "Misc/ScopeRWLock.h"
 
 #define MCRO_ALLOW_TEXT 1
 #include "Mcro/LibraryIncludes/Start.h"
@@ -20,34 +21,97 @@
 
 namespace Mcro::Windows::Error
 {
+	namespace
+	{
+		/** @brief Process-wide cache of texts resolved from error codes, they never change during the process */
+		template <typename Value>
+		class TErrorCodeTextCache
+		{
+		public:
+			template <typename Function>
+			Value Get(int64 code, Function&& resolve)
+			{
+				{
+					FReadScopeLock lock(Lock);
+					if (const Value* cached = Entries.Find(code))
+						return *cached;
+				}
+				Value resolved = resolve();
+				FWriteScopeLock lock(Lock);
+				return Entries.FindOrAdd(code, MoveTemp(resolved));
+			}
+
+		private:
+			FRWLock Lock;
+			TMap<int64, Value> Entries;
+		};
+
+		struct FHresultTexts
+		{
+			FString SystemMessage;
+			FString ProgramID;
+			FString Description;
+		};
+	}
+
 	FLastError::FLastError(int32 errorCode) : ErrorCode(errorCode)
 	{
-		TCHAR errorTextBuffer[2048];
-		FWindowsPlatformMisc::GetSystemErrorMessage(errorTextBuffer, 2048, errorCode);
-		SystemMessage = errorTextBuffer;
-		IError::AddAppendix(TEXT_"SystemMessage", SystemMessage);
-		IError::AddAppendix(TEXT_"ErrorCode", FString::FromInt(errorCode));
+		bHasDeferredTexts = true;
 	}
 
-	FHresultError::FHresultError(HRESULT result, bool fastMode) : Result(result)
+	void FLastError::ResolveDeferredTexts() const
 	{
-		if (fastMode)
+		static TErrorCodeTextCache<FString> cache;
+		SystemMessage = cache.Get(ErrorCode, [this]
 		{
-			SystemMessage = FString::FromInt(result);
-			IError::AddAppendix(TEXT_"SystemMessage", SystemMessage);
-		}
-		else SetHumanReadable();
+			TCHAR errorTextBuffer[2048];
+			FWindowsPlatformMisc::GetSystemErrorMessage(errorTextBuffer, 2048, ErrorCode);
+			return FString(errorTextBuffer);
+		});
+
+		// Appendices are inner errors, resolution happens once under the lock of IError
+		auto self = const_cast<FLastError*>(this);
+		self->AddAppendix(TEXT_"SystemMessage", SystemMessage);
+		self->AddAppendix(TEXT_"ErrorCode", FString::FromInt(ErrorCode));
+	}
+
+	FHresultError::FHresultError(HRESULT result, bool fastMode) : Result(result), bFastMode(fastMode)
+	{
+		bHasDeferredTexts = true;
 	}
 
 	void FHresultError::SetHumanReadable()
 	{
-		_com_error comError(Result);
-		SystemMessage = comError.ErrorMessage();
-		ProgramID = comError.Source();
-		Description = comError.Description();
-		IError::AddAppendix(TEXT_"SystemMessage", SystemMessage);
-		IError::AddAppendix(TEXT_"Description", Description);
-		IError::AddAppendix(TEXT_"ProgramID", ProgramID);
-		IError::AddAppendix(TEXT_"ErrorCode", FString::FromInt(Result));
+		bFastMode = false;
+	}
+
+	void FHresultError::ResolveDeferredTexts() const
+	{
+		auto self = const_cast<FHresultError*>(this);
+		if (bFastMode)
+		{
+			SystemMessage = FString::FromInt(Result);
+			self->AddAppendix(TEXT_"SystemMessage", SystemMessage);
+			return;
+		}
+
+		static TErrorCodeTextCache<FHresultTexts> cache;
+		FHresultTexts texts = cache.Get(Result, [this]
+		{
+			_com_error comError(Result);
+			return FHresultTexts {
+				comError.ErrorMessage(),
+				comError.Source(),
+				comError.Description()
+			};
+		});
+		SystemMessage = MoveTemp(texts.SystemMessage);
+		ProgramID = MoveTemp(texts.ProgramID);
+		Description = MoveTemp(texts.Description);
+
+		self->AddAppendix(TEXT_"SystemMessage", SystemMessage);
+		self->AddAppendix(TEXT_"Description", Description);
+		self->AddAppendix(TEXT_"ProgramID", ProgramID);
+		self->AddAppendix(TEXT_"ErrorCode", FString::FromInt(Result));
 	}
 }
@@ -0,0 +1,481 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroWindows/IO/AsyncFile.h"
+#include "Mcro/TextMacros.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+namespace Mcro::Windows::IO
+{
+	namespace Detail
+	{
+		/** @brief Collects the results of the overlapped operations a single read or write was split into */
+		struct FIoBatch
+		{
+			FIoBatch(int32 operations) : Remaining(operations) {}
+
+			std::atomic<int32> Remaining;
+			std::atomic<int64> Transferred { 0 };
+			std::atomic<int32> ErrorCode { ERROR_SUCCESS };
+			TPromise<FAsyncFile::FResult> Promise;
+
+			void Complete(int64 bytes, int32 errorCode)
+			{
+				Transferred.fetch_add(bytes, std::memory_order_relaxed);
+				if (errorCode != ERROR_SUCCESS)
+				{
+					int32 expected = ERROR_SUCCESS;
+					ErrorCode.compare_exchange_strong(expected, errorCode, std::memory_order_relaxed);
+				}
+				if (Remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+					return;
+
+				const int32 error = ErrorCode.load(std::memory_order_relaxed);
+				if (error != ERROR_SUCCESS)
+					Promise.SetValue(IError::Make(new FLastError(error))
+						->WithMessage(TEXT_"Overlapped file operation failed")
+					);
+				else Promise.SetValue(Transferred.load(std::memory_order_relaxed));
+			}
+		};
+
+		/** @brief A single overlapped operation, OVERLAPPED must stay the first member */
+		struct FIoRequest
+		{
+			OVERLAPPED Overlapped {};
+			TSharedPtr<FIoBatch> Batch;
+			TSharedPtr<FAsyncFile> File;
+		};
+
+		int32 NormalizeErrorCode(int32 errorCode)
+		{
+			// Reading past the end of the file is not an error, it just transfers fewer bytes
+			return errorCode == ERROR_HANDLE_EOF ? ERROR_SUCCESS : errorCode;
+		}
+
+		class FIoCompletionPort : public FRunnable
+		{
+		public:
+			static constexpr int32 MaxWorkers = 4;
+
+			FIoCompletionPort()
+			{
+				Port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 0);
+				const int32 workers = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 4, 1, MaxWorkers);
+				for (int32 i = 0; i < workers; ++i)
+				{
+					Workers.Add(FRunnableThread::Create(
+						this, *FString::Printf(TEXT_"McroWindows IOCP %d", i), 64 * 1024, TPri_AboveNormal
+					));
+				}
+			}
+
+			virtual ~FIoCompletionPort() override
+			{
+				for (int32 i = 0; i < Workers.Num(); ++i)
+					PostQueuedCompletionStatus(Port, 0, QuitKey, nullptr);
+				for (FRunnableThread* worker : Workers)
+				{
+					worker->WaitForCompletion();
+					delete worker;
+				}
+				CloseHandle(Port);
+			}
+
+			bool Associate(HANDLE file)
+			{
+				return CreateIoCompletionPort(file, Port, FileKey, 0) == Port;
+			}
+
+			virtual uint32 Run() override
+			{
+				for (;;)
+				{
+					DWORD bytes = 0;
+					ULONG_PTR key = 0;
+					LPOVERLAPPED overlapped = nullptr;
+					const bool success = GetQueuedCompletionStatus(Port, &bytes, &key, &overlapped, INFINITE);
+					if (!overlapped)
+					{
+						if (success && key == QuitKey) return 0;
+						continue;
+					}
+
+					FIoRequest* request = reinterpret_cast<FIoRequest*>(overlapped);
+					const int32 errorCode = success ? ERROR_SUCCESS : NormalizeErrorCode(static_cast<int32>(GetLastError()));
+					request->Batch->Complete(bytes, errorCode);
+					delete request;
+				}
+			}
+
+		private:
+			static constexpr ULONG_PTR QuitKey = 0;
+			static constexpr ULONG_PTR FileKey = 1;
+
+			HANDLE Port;
+			TArray<FRunnableThread*> Workers;
+		};
+
+		TUniquePtr<FIoCompletionPort>& GetCompletionPortStorage()
+		{
+			static TUniquePtr<FIoCompletionPort> port;
+			return port;
+		}
+
+		FIoCompletionPort& GetCompletionPort()
+		{
+			static FCriticalSection lock;
+			FScopeLock scope(&lock);
+			auto& port = GetCompletionPortStorage();
+			if (!port) port = MakeUnique<FIoCompletionPort>();
+			return *port;
+		}
+
+		/** @brief Called on module shutdown, all files should be closed and all I/O should be finished by then */
+		void ShutdownCompletionPort()
+		{
+			GetCompletionPortStorage().Reset();
+		}
+
+		uint32 QuerySectorSize(HANDLE file)
+		{
+			FILE_STORAGE_INFO storage {};
+			if (GetFileInformationByHandleEx(file, FileStorageInfo, &storage, sizeof(storage)))
+				return FMath::Max<uint32>(storage.PhysicalBytesPerSectorForPerformance, storage.LogicalBytesPerSector);
+			return 4096;
+		}
+
+		uint32 GetPageSize()
+		{
+			SYSTEM_INFO info;
+			GetSystemInfo(&info);
+			return info.dwPageSize;
+		}
+
+		int32 GetSizeClass(int64 size)
+		{
+			static const int64 pageSize = GetPageSize();
+			const int64 rounded = FMath::Max<int64>(size, pageSize);
+			return static_cast<int32>(FMath::CeilLogTwo64(static_cast<uint64>(rounded)));
+		}
+
+		TFuture<FAsyncFile::FResult> MakeIoError(IErrorRef const& error)
+		{
+			return MakeFulfilledPromise<FAsyncFile::FResult>(error).GetFuture();
+		}
+	}
+
+	using namespace Detail;
+
+	FAlignedBuffer::FAlignedBuffer(FAlignedBuffer&& other) noexcept
+		: Pool(MoveTemp(other.Pool))
+		, Data(Exchange(other.Data, nullptr))
+		, Size(Exchange(other.Size, 0))
+		, SizeClass(Exchange(other.SizeClass, INDEX_NONE))
+	{}
+
+	FAlignedBuffer& FAlignedBuffer::operator = (FAlignedBuffer&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (Pool) Pool->Release(Data, SizeClass);
+			Pool = MoveTemp(other.Pool);
+			Data = Exchange(other.Data, nullptr);
+			Size = Exchange(other.Size, 0);
+			SizeClass = Exchange(other.SizeClass, INDEX_NONE);
+		}
+		return *this;
+	}
+
+	FAlignedBuffer::~FAlignedBuffer()
+	{
+		if (Pool) Pool->Release(Data, SizeClass);
+	}
+
+	FAlignedBufferPool::FAlignedBufferPool(int64 maxPooledBytes)
+		: MaxPooledBytes(maxPooledBytes)
+	{
+		Free.SetNum(64);
+	}
+
+	FAlignedBufferPool::~FAlignedBufferPool()
+	{
+		for (TArray<uint8*>& sizeClass : Free)
+		{
+			for (uint8* data : sizeClass)
+				VirtualFree(data, 0, MEM_RELEASE);
+		}
+	}
+
+	TSharedRef<FAlignedBufferPool> FAlignedBufferPool::Get()
+	{
+		static TSharedRef<FAlignedBufferPool> pool = MakeShared<FAlignedBufferPool>();
+		return pool;
+	}
+
+	FAlignedBuffer FAlignedBufferPool::Acquire(int64 size)
+	{
+		FAlignedBuffer result;
+		result.SizeClass = GetSizeClass(size);
+		result.Size = int64(1) << result.SizeClass;
+		{
+			FScopeLock lock(&Lock);
+			if (Free[result.SizeClass].Num() > 0)
+			{
+				result.Data = Free[result.SizeClass].Pop(EAllowShrinking::No);
+				PooledBytes -= result.Size;
+			}
+		}
+		if (!result.Data)
+			result.Data = static_cast<uint8*>(VirtualAlloc(nullptr, result.Size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+		if (!result.Data)
+			return {};
+
+		result.Pool = AsShared();
+		return result;
+	}
+
+	int64 FAlignedBufferPool::GetPooledBytes() const
+	{
+		FScopeLock lock(&Lock);
+		return PooledBytes;
+	}
+
+	void FAlignedBufferPool::Release(uint8* data, int32 sizeClass)
+	{
+		if (!data) return;
+		const int64 size = int64(1) << sizeClass;
+		{
+			FScopeLock lock(&Lock);
+			if (PooledBytes + size <= MaxPooledBytes)
+			{
+				Free[sizeClass].Add(data);
+				PooledBytes += size;
+				return;
+			}
+		}
+		VirtualFree(data, 0, MEM_RELEASE);
+	}
+
+	TMaybe<TSharedRef<FAsyncFile>> FAsyncFile::Open(FString const& path, FAsyncFileOptions const& options)
+	{
+		DWORD access = 0;
+		DWORD creation = OPEN_EXISTING;
+		switch (options.Access)
+		{
+		case EAsyncFileAccess::Read:
+			access = GENERIC_READ;
+			break;
+		case EAsyncFileAccess::Write:
+			access = GENERIC_WRITE;
+			creation = CREATE_ALWAYS;
+			break;
+		case EAsyncFileAccess::ReadWrite:
+			access = GENERIC_READ | GENERIC_WRITE;
+			creation = OPEN_ALWAYS;
+			break;
+		}
+
+		DWORD flags = FILE_FLAG_OVERLAPPED;
+		if (options.bUnbuffered) flags |= FILE_FLAG_NO_BUFFERING;
+		if (options.bWriteThrough) flags |= FILE_FLAG_WRITE_THROUGH;
+
+		HANDLE handle = CreateFileW(*path, access, FILE_SHARE_READ, nullptr, creation, flags, nullptr);
+		if (handle == INVALID_HANDLE_VALUE)
+			return IError::Make(new FLastError(static_cast<int32>(GetLastError())))
+				->AsRecoverable()
+				->WithMessageF(TEXT_"Couldn't open {0} for overlapped I/O", path);
+
+		if (!GetCompletionPort().Associate(handle))
+		{
+			const int32 errorCode = static_cast<int32>(GetLastError());
+			CloseHandle(handle);
+			return IError::Make(new FLastError(errorCode))
+				->WithMessageF(TEXT_"Couldn't associate {0} with the I/O completion port", path);
+		}
+
+		// A completion packet is still queued when an operation completes synchronously, it's handled on the
+		// completion port threads either way.
+		return MakeShared<FAsyncFile>(handle, path, options, QuerySectorSize(handle));
+	}
+
+	FAsyncFile::FAsyncFile(HANDLE handle, FString const& path, FAsyncFileOptions const& options, uint32 sectorSize)
+		: Handle(handle)
+		, Path(path)
+		, MaxRequestBytes(FMath::Clamp<int64>(
+			AlignArbitrary<int64>(options.MaxRequestBytes, sectorSize),
+			sectorSize,
+			// ReadFile and WriteFile take a DWORD size
+			static_cast<int64>(MAXDWORD) / sectorSize * sectorSize
+		))
+		, SectorSize(sectorSize)
+		, bUnbuffered(options.bUnbuffered)
+	{}
+
+	FAsyncFile::~FAsyncFile()
+	{
+		CloseHandle(Handle);
+	}
+
+	FCanFail FAsyncFile::CheckAlignment(int64 offset, int64 size, const void* data) const
+	{
+		if (!bUnbuffered) return Success();
+		const bool aligned = offset % SectorSize == 0
+			&& size % SectorSize == 0
+			&& reinterpret_cast<UPTRINT>(data) % SectorSize == 0;
+
+		if (!aligned)
+			return IError::Make(new FAssertion())
+				->AsRecoverable()
+				->WithMessageF(
+					TEXT_"Unbuffered I/O on {0} needs offset, size and memory aligned to {1} bytes",
+					Path, SectorSize
+				)
+				->WithAppendixF(TEXT_"Request", TEXT_"offset: {0}, size: {1}", offset, size);
+		return Success();
+	}
+
+	TFuture<FAsyncFile::FResult> FAsyncFile::Read(int64 offset, TArrayView64<uint8> destination)
+	{
+		return Transfer(offset, destination.GetData(), destination.Num(), false);
+	}
+
+	TFuture<FAsyncFile::FResult> FAsyncFile::Write(int64 offset, TArrayView64<const uint8> source)
+	{
+		return Transfer(offset, const_cast<uint8*>(source.GetData()), source.Num(), true);
+	}
+
+	TFuture<FAsyncFile::FResult> FAsyncFile::Transfer(int64 offset, uint8* data, int64 size, bool write)
+	{
+		if (auto aligned = CheckAlignment(offset, size, data); aligned.HasError())
+			return MakeIoError(aligned.GetErrorRef());
+		if (size <= 0)
+			return MakeFulfilledPromise<FResult>(int64(0)).GetFuture();
+
+		const int32 operations = static_cast<int32>(FMath::DivideAndRoundUp(size, MaxRequestBytes));
+		auto batch = MakeShared<FIoBatch>(operations);
+		TFuture<FResult> future = batch->Promise.GetFuture();
+
+		for (int64 done = 0; done < size; done += MaxRequestBytes)
+		{
+			const int64 position = offset + done;
+			const DWORD bytes = static_cast<DWORD>(FMath::Min(MaxRequestBytes, size - done));
+
+			FIoRequest* request = new FIoRequest();
+			request->Overlapped.Offset = static_cast<DWORD>(position & 0xFFFFFFFF);
+			request->Overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+			request->Batch = batch;
+			request->File = AsShared();
+
+			const bool completed = write
+				? WriteFile(Handle, data + done, bytes, nullptr, &request->Overlapped)
+				: ReadFile(Handle, data + done, bytes, nullptr, &request->Overlapped);
+
+			const int32 errorCode = completed ? ERROR_SUCCESS : static_cast<int32>(GetLastError());
+			if (!completed && errorCode != ERROR_IO_PENDING)
+			{
+				// No completion packet is queued for operations which failed to start
+				batch->Complete(0, NormalizeErrorCode(errorCode));
+				delete request;
+			}
+		}
+		return future;
+	}
+
+	TFuture<FAsyncFile::FResult> FAsyncFile::ReadScatter(int64 offset, TConstArrayView<uint8*> pages)
+	{
+		return TransferPages(offset, pages, false);
+	}
+
+	TFuture<FAsyncFile::FResult> FAsyncFile::WriteGather(int64 offset, TConstArrayView<uint8*> pages)
+	{
+		return TransferPages(offset, pages, true);
+	}
+
+	TFuture<FAsyncFile::FResult> FAsyncFile::TransferPages(int64 offset, TConstArrayView<uint8*> pages, bool write)
+	{
+		static const int64 pageSize = GetPageSize();
+		if (!bUnbuffered || offset % pageSize != 0)
+			return MakeIoError(IError::Make(new FAssertion())
+				->AsRecoverable()
+				->WithMessageF(TEXT_"Scatter/gather I/O on {0} needs an unbuffered file and a page aligned offset", Path)
+			);
+		if (pages.IsEmpty())
+			return MakeFulfilledPromise<FResult>(int64(0)).GetFuture();
+
+		const int64 totalBytes = static_cast<int64>(pages.Num()) * pageSize;
+		if (totalBytes > MAXDWORD)
+			return MakeIoError(IError::Make(new FAssertion())
+				->AsRecoverable()
+				->WithMessageF(TEXT_"Scatter/gather I/O on {0} can't transfer more than 4GB at once", Path)
+			);
+
+		// The segment array must be terminated by a null element
+		TArray<FILE_SEGMENT_ELEMENT> segments;
+		segments.SetNumZeroed(pages.Num() + 1);
+		for (int32 i = 0; i < pages.Num(); ++i)
+		{
+			if (reinterpret_cast<UPTRINT>(pages[i]) % pageSize != 0)
+				return MakeIoError(IError::Make(new FAssertion())
+					->AsRecoverable()
+					->WithMessageF(TEXT_"Scatter/gather I/O on {0} needs page aligned memory", Path)
+				);
+			segments[i].Buffer = PtrToPtr64(pages[i]);
+		}
+
+		auto batch = MakeShared<FIoBatch>(1);
+		TFuture<FResult> future = batch->Promise.GetFuture();
+
+		FIoRequest* request = new FIoRequest();
+		request->Overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFF);
+		request->Overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+		request->Batch = batch;
+		request->File = AsShared();
+
+		const DWORD bytes = static_cast<DWORD>(totalBytes);
+		const bool completed = write
+			? WriteFileGather(Handle, segments.GetData(), bytes, nullptr, &request->Overlapped)
+			: ReadFileScatter(Handle, segments.GetData(), bytes, nullptr, &request->Overlapped);
+
+		const int32 errorCode = completed ? ERROR_SUCCESS : static_cast<int32>(GetLastError());
+		if (!completed && errorCode != ERROR_IO_PENDING)
+		{
+			batch->Complete(0, NormalizeErrorCode(errorCode));
+			delete request;
+		}
+		return future;
+	}
+
+	FCanFail FAsyncFile::SetSize(int64 size)
+	{
+		FILE_END_OF_FILE_INFO info {};
+		info.EndOfFile.QuadPart = size;
+		if (!SetFileInformationByHandle(Handle, FileEndOfFileInfo, &info, sizeof(info)))
+			return IError::Make(new FLastError(static_cast<int32>(GetLastError())))
+				->AsRecoverable()
+				->WithMessageF(TEXT_"Couldn't set the size of {0}", Path);
+		return Success();
+	}
+
+	TMaybe<int64> FAsyncFile::GetSize() const
+	{
+		LARGE_INTEGER size {};
+		if (!GetFileSizeEx(Handle, &size))
+			return IError::Make(new FLastError(static_cast<int32>(GetLastError())))
+				->AsRecoverable()
+				->WithMessageF(TEXT_"Couldn't get the size of {0}", Path);
+		return static_cast<int64>(size.QuadPart);
+	}
+}
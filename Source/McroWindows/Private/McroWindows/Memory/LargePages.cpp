@@ -0,0 +1,304 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroWindows/Memory/LargePages.h"
+#include "Mcro/TextMacros.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeRWLock.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include <Windows.h>
+#include "Mcro/LibraryIncludes/End.h"
+
+namespace Mcro::Windows::Memory
+{
+	namespace
+	{
+		/** @brief Allocations of the container allocator are aligned to this, matching the default of FMemory */
+		constexpr uint32 ContainerAlignment = 16;
+
+		/** @brief Which step of enabling SeLockMemoryPrivilege failed */
+		enum class EPrivilegeStep : uint8
+		{
+			None,
+			OpenToken,
+			LookUp,
+			Adjust
+		};
+
+		/** @brief Outcome of enabling SeLockMemoryPrivilege, errors are made from it for each caller */
+		struct FPrivilegeResult
+		{
+			EPrivilegeStep FailedStep = EPrivilegeStep::None;
+			int32 ErrorCode = 0;
+		};
+
+		FPrivilegeResult TryEnableLargePagePrivilege()
+		{
+			HANDLE token = nullptr;
+			if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+				return { EPrivilegeStep::OpenToken, static_cast<int32>(GetLastError()) };
+
+			ON_SCOPE_EXIT { CloseHandle(token); };
+
+			TOKEN_PRIVILEGES privileges {};
+			privileges.PrivilegeCount = 1;
+			privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+			if (!LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid))
+				return { EPrivilegeStep::LookUp, static_cast<int32>(GetLastError()) };
+
+			// AdjustTokenPrivileges succeeds even when the privilege is not held, that's only told by the last error
+			const bool adjusted = AdjustTokenPrivileges(token, false, &privileges, 0, nullptr, nullptr);
+			const int32 errorCode = static_cast<int32>(GetLastError());
+			if (!adjusted || errorCode == ERROR_NOT_ALL_ASSIGNED)
+				return { EPrivilegeStep::Adjust, errorCode };
+			return {};
+		}
+
+		FCanFail MakePrivilegeError(FPrivilegeResult const& result)
+		{
+			switch (result.FailedStep)
+			{
+			case EPrivilegeStep::None:
+				return Success();
+			case EPrivilegeStep::OpenToken:
+				return IError::Make(new FLastError(result.ErrorCode))
+					->AsRecoverable()
+					->WithMessage(TEXT_"Couldn't open the access token of the process");
+			case EPrivilegeStep::LookUp:
+				return IError::Make(new FLastError(result.ErrorCode))
+					->AsRecoverable()
+					->WithMessage(TEXT_"Couldn't look up SeLockMemoryPrivilege");
+			case EPrivilegeStep::Adjust:
+				break;
+			}
+			return IError::Make(new FLastError(result.ErrorCode))
+				->AsRecoverable()
+				->WithMessage(TEXT_"Couldn't enable SeLockMemoryPrivilege")
+				->WithDetails(TEXT_
+					"Large pages need the \"Lock pages in memory\" user right for the account running the process"
+					" (Local Security Policy > User Rights Assignment)."
+				);
+		}
+
+		/** @brief Commit memory on large pages, reporting why it's not possible through the returned error */
+		TMaybe<uint8*> CommitLargePages(uint64 size)
+		{
+			if (GetLargePageSize() == 0)
+				return IError::Make(new FUnavailable())
+					->AsRecoverable()
+					->WithMessage(TEXT_"Large pages are not supported on this system");
+
+			if (auto privilege = EnableLargePagePrivilege(); privilege.HasError())
+				return privilege.GetErrorRef();
+
+			void* memory = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+			if (!memory)
+				return IError::Make(new FLastError(static_cast<int32>(GetLastError())))
+					->AsRecoverable()
+					->WithMessageF(TEXT_"Couldn't commit {0} bytes on large pages", size)
+					->WithDetails(TEXT_"Physical memory may be too fragmented to find contiguous large pages.");
+			return static_cast<uint8*>(memory);
+		}
+
+		uint8* CommitRegularPages(uint64 size)
+		{
+			return static_cast<uint8*>(VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+		}
+
+		uint64 RoundToLargePages(uint64 size)
+		{
+			const uint64 largePage = GetLargePageSize();
+			return largePage > 0 ? AlignArbitrary(size, largePage) : size;
+		}
+
+		struct FDefaultArena
+		{
+			FRWLock Lock;
+			TSharedPtr<FLargePageArena> Arena;
+		};
+
+		FDefaultArena& GetDefaultArenaStorage()
+		{
+			static FDefaultArena storage;
+			return storage;
+		}
+	}
+
+	FCanFail EnableLargePagePrivilege()
+	{
+		// Only the outcome is kept, errors are mutable so each caller gets its own
+		static const FPrivilegeResult result = TryEnableLargePagePrivilege();
+		return MakePrivilegeError(result);
+	}
+
+	uint64 GetLargePageSize()
+	{
+		static const uint64 size = GetLargePageMinimum();
+		return size;
+	}
+
+	void* AllocateLargePages(uint64 size)
+	{
+		const uint64 rounded = RoundToLargePages(size);
+		auto memory = CommitLargePages(rounded);
+		if (memory.HasValue()) return memory.GetValue();
+		return CommitRegularPages(rounded);
+	}
+
+	void FreeLargePages(void* memory, uint64 size)
+	{
+		if (memory) VirtualFree(memory, 0, MEM_RELEASE);
+	}
+
+	TMaybe<TSharedRef<FLargePageArena>> FLargePageArena::Create(uint64 capacity, bool bAllowFallback)
+	{
+		const uint64 rounded = RoundToLargePages(capacity);
+		auto largePages = CommitLargePages(rounded);
+		if (largePages.HasValue())
+			return MakeShared<FLargePageArena>(largePages.GetValue(), rounded, nullptr);
+
+		if (!bAllowFallback)
+			return largePages.GetErrorRef();
+
+		uint8* memory = CommitRegularPages(rounded);
+		if (!memory)
+			return IError::Make(new FLastError(static_cast<int32>(GetLastError())))
+				->WithMessageF(TEXT_"Couldn't commit {0} bytes for a large page arena", rounded)
+				->WithError(largePages.GetErrorRef());
+
+		return MakeShared<FLargePageArena>(memory, rounded, largePages.GetError());
+	}
+
+	TSharedPtr<FLargePageArena> FLargePageArena::GetDefault()
+	{
+		auto& storage = GetDefaultArenaStorage();
+		FReadScopeLock lock(storage.Lock);
+		return storage.Arena;
+	}
+
+	void FLargePageArena::SetDefault(TSharedPtr<FLargePageArena> const& arena)
+	{
+		auto& storage = GetDefaultArenaStorage();
+		FWriteScopeLock lock(storage.Lock);
+		storage.Arena = arena;
+	}
+
+	FLargePageArena::FLargePageArena(uint8* memory, uint64 capacity, IErrorPtr const& fallbackReason)
+		: Memory(memory)
+		, Capacity(capacity)
+		, FallbackReason(fallbackReason)
+	{}
+
+	FLargePageArena::~FLargePageArena()
+	{
+		VirtualFree(Memory, 0, MEM_RELEASE);
+	}
+
+	void* FLargePageArena::Allocate(uint64 size, uint32 alignment)
+	{
+		uint64 offset = Offset.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			const uint64 start = AlignArbitrary(offset, static_cast<uint64>(FMath::Max(alignment, 1u)));
+			if (start + size > Capacity) return nullptr;
+			if (Offset.compare_exchange_weak(offset, start + size, std::memory_order_relaxed))
+				return Memory + start;
+		}
+	}
+
+	bool FLargePageArena::Resize(void* memory, uint64 size, uint64 newSize)
+	{
+		const uint64 start = static_cast<uint8*>(memory) - Memory;
+		if (start + newSize > Capacity) return false;
+
+		uint64 expected = start + size;
+		return Offset.compare_exchange_strong(expected, start + newSize, std::memory_order_relaxed);
+	}
+
+	void FLargePageArena::Free(void* memory, uint64 size)
+	{
+		const uint64 start = static_cast<uint8*>(memory) - Memory;
+		uint64 expected = start + size;
+		Offset.compare_exchange_strong(expected, start, std::memory_order_relaxed);
+	}
+
+	void FLargePageArena::Reset()
+	{
+		Offset.store(0, std::memory_order_relaxed);
+	}
+
+	void FLargePageAllocator::ForAnyElementType::MoveToEmpty(ForAnyElementType& other)
+	{
+		check(this != &other);
+		FreeAllocation();
+
+		Data = Exchange(other.Data, nullptr);
+		AllocatedBytes = Exchange(other.AllocatedBytes, 0);
+		Arena = MoveTemp(other.Arena);
+	}
+
+	FLargePageAllocator::ForAnyElementType::~ForAnyElementType()
+	{
+		FreeAllocation();
+	}
+
+	void FLargePageAllocator::ForAnyElementType::FreeAllocation()
+	{
+		if (!Data) return;
+		if (Arena) Arena->Free(Data, AllocatedBytes);
+		else FMemory::Free(Data);
+
+		Data = nullptr;
+		AllocatedBytes = 0;
+		Arena.Reset();
+	}
+
+	void FLargePageAllocator::ForAnyElementType::ResizeAllocation(
+		SizeType currentNum, SizeType newMax, SIZE_T numBytesPerElement
+	) {
+		const SIZE_T newBytes = static_cast<SIZE_T>(newMax) * numBytesPerElement;
+		if (newBytes == 0)
+		{
+			FreeAllocation();
+			return;
+		}
+
+		if (Arena && Arena->Resize(Data, AllocatedBytes, newBytes))
+		{
+			AllocatedBytes = newBytes;
+			return;
+		}
+
+		TSharedPtr<FLargePageArena> newArena = FLargePageArena::GetDefault();
+		void* newData = newArena ? newArena->Allocate(newBytes, ContainerAlignment) : nullptr;
+		if (!newData)
+		{
+			newArena.Reset();
+			if (!Arena)
+			{
+				Data = static_cast<FScriptContainerElement*>(FMemory::Realloc(Data, newBytes, ContainerAlignment));
+				AllocatedBytes = newBytes;
+				return;
+			}
+			newData = FMemory::Malloc(newBytes, ContainerAlignment);
+		}
+
+		if (Data)
+		{
+			FMemory::Memcpy(newData, Data, FMath::Min<SIZE_T>(currentNum * numBytesPerElement, newBytes));
+			FreeAllocation();
+		}
+		Data = static_cast<FScriptContainerElement*>(newData);
+		AllocatedBytes = newBytes;
+		Arena = MoveTemp(newArena);
+	}
+}
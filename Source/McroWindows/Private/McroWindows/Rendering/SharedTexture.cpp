@@ -0,0 +1,271 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroWindows/Rendering/SharedTexture.h"
+#include "McroWindows/Error/HResultMacros.h"
+#include "McroWindows/COM/Cast.h"
+#include "ID3D11DynamicRHI.h"
+#include "ID3D12DynamicRHI.h"
+#include "RHICommandList.h"
+
+namespace Mcro::Windows::Rendering::Textures
+{
+	using namespace Mcro::Windows::COM;
+	using namespace Mcro::Windows::Error;
+
+	FScopedHandle::~FScopedHandle()
+	{
+		if (Handle) CloseHandle(Handle);
+	}
+
+	FScopedHandle& FScopedHandle::operator = (FScopedHandle&& other) noexcept
+	{
+		if (this != &other)
+		{
+			if (Handle) CloseHandle(Handle);
+			Handle = other.Release();
+		}
+		return *this;
+	}
+
+	namespace
+	{
+		TMaybe<HANDLE> DuplicateOwnHandle(HANDLE handle)
+		{
+			HANDLE result = nullptr;
+			const HANDLE process = GetCurrentProcess();
+			if (!DuplicateHandle(process, handle, process, &result, 0, false, DUPLICATE_SAME_ACCESS))
+				return IError::Make(new FLastError(GetLastError()))
+					->WithMessage(TEXT_"Couldn't duplicate the handle of a shared resource");
+			return result;
+		}
+	}
+
+	TMaybe<TSharedRef<FSharedTexture>> FSharedTexture::Create(FDXGITextureSize const& size, const TCHAR* debugName)
+	{
+		ASSERT_RETURN(size)
+			->WithMessage(TEXT_"A shared texture needs a non-zero size and a known format");
+
+		switch (RHIGetInterfaceType())
+		{
+		case ERHIInterfaceType::D3D12: return Create12(size, debugName);
+		case ERHIInterfaceType::D3D11: return Create11(size, debugName);
+		default:
+			UNAVAILABLE()->WithMessage(TEXT_"Shared textures are only supported with the D3D11 and D3D12 RHIs");
+		}
+	}
+
+	TMaybe<TSharedRef<FSharedTexture>> FSharedTexture::Open(HANDLE textureHandle, HANDLE fenceHandle)
+	{
+		ASSERT_RETURN(textureHandle)
+			->WithMessage(TEXT_"Cannot open a shared texture without a handle");
+
+		switch (RHIGetInterfaceType())
+		{
+		case ERHIInterfaceType::D3D12: return Open12(textureHandle, fenceHandle);
+		case ERHIInterfaceType::D3D11: return Open11(textureHandle);
+		default:
+			UNAVAILABLE()->WithMessage(TEXT_"Shared textures are only supported with the D3D11 and D3D12 RHIs");
+		}
+	}
+
+	TMaybe<TSharedRef<FSharedTexture>> FSharedTexture::Create12(FDXGITextureSize const& size, const TCHAR* debugName)
+	{
+		ID3D12Device* device = GetID3D12DynamicRHI()->RHIGetDevice(0);
+		auto result = MakeShared<FSharedTexture>();
+		result->Size = size;
+
+		D3D12_HEAP_PROPERTIES heap {};
+		heap.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+		D3D12_RESOURCE_DESC desc {};
+		desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+		desc.Width = size.Width;
+		desc.Height = size.Height;
+		desc.DepthOrArraySize = 1;
+		desc.MipLevels = 1;
+		desc.Format = size.Format;
+		desc.SampleDesc.Count = 1;
+		desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+		desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_SIMULTANEOUS_ACCESS;
+
+		HR_TRY_FAST(device->CreateCommittedResource(
+			&heap, D3D12_HEAP_FLAG_SHARED, &desc, D3D12_RESOURCE_STATE_COMMON, nullptr,
+			IID_PPV_ARGS(&result->Resource12)
+		));
+		if (debugName) result->Resource12->SetName(debugName);
+
+		HANDLE textureHandle = nullptr;
+		HR_TRY_FAST(device->CreateSharedHandle(result->Resource12.Get(), nullptr, GENERIC_ALL, nullptr, &textureHandle));
+		result->TextureHandle = FScopedHandle(textureHandle);
+
+		HR_TRY_FAST(device->CreateFence(0, D3D12_FENCE_FLAG_SHARED, IID_PPV_ARGS(&result->Fence)));
+		HANDLE fenceHandle = nullptr;
+		HR_TRY_FAST(device->CreateSharedHandle(result->Fence.Get(), nullptr, GENERIC_ALL, nullptr, &fenceHandle));
+		result->FenceHandle = FScopedHandle(fenceHandle);
+
+		if (auto wrapped = result->WrapRhiTexture(true); wrapped.HasError())
+			return wrapped.GetErrorRef();
+		return result;
+	}
+
+	TMaybe<TSharedRef<FSharedTexture>> FSharedTexture::Create11(FDXGITextureSize const& size, const TCHAR* debugName)
+	{
+		ID3D11Device* device = GetID3D11DynamicRHI()->RHIGetDevice();
+		auto result = MakeShared<FSharedTexture>();
+		result->Size = size;
+
+		D3D11_TEXTURE2D_DESC desc {};
+		desc.Width = size.Width;
+		desc.Height = size.Height;
+		desc.MipLevels = 1;
+		desc.ArraySize = 1;
+		desc.Format = size.Format;
+		desc.SampleDesc.Count = 1;
+		desc.Usage = D3D11_USAGE_DEFAULT;
+		desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+		desc.MiscFlags = D3D11_RESOURCE_MISC_SHARED_NTHANDLE | D3D11_RESOURCE_MISC_SHARED_KEYEDMUTEX;
+
+		HR_TRY_FAST(device->CreateTexture2D(&desc, nullptr, &result->Resource11));
+		if (debugName)
+		{
+			auto name = StringCast<ANSICHAR>(debugName);
+			result->Resource11->SetPrivateData(WKPDID_D3DDebugObjectName, name.Length(), name.Get());
+		}
+
+		TComPtr<IDXGIResource1> dxgiResource;
+		if (auto cast = ComCast(result->Resource11, dxgiResource); cast.HasError())
+			return cast.GetErrorRef();
+
+		HANDLE textureHandle = nullptr;
+		HR_TRY_FAST(dxgiResource->CreateSharedHandle(
+			nullptr, DXGI_SHARED_RESOURCE_READ | DXGI_SHARED_RESOURCE_WRITE, nullptr, &textureHandle
+		));
+		result->TextureHandle = FScopedHandle(textureHandle);
+
+		if (auto cast = ComCast(result->Resource11, result->KeyedMutex); cast.HasError())
+			return cast.GetErrorRef();
+
+		if (auto wrapped = result->WrapRhiTexture(true); wrapped.HasError())
+			return wrapped.GetErrorRef();
+		return result;
+	}
+
+	TMaybe<TSharedRef<FSharedTexture>> FSharedTexture::Open12(HANDLE textureHandle, HANDLE fenceHandle)
+	{
+		ASSERT_RETURN(fenceHandle)
+			->WithMessage(TEXT_"Shared textures on D3D12 need a shared fence handle as well");
+
+		ID3D12Device* device = GetID3D12DynamicRHI()->RHIGetDevice(0);
+		auto result = MakeShared<FSharedTexture>();
+
+		HR_TRY_FAST(device->OpenSharedHandle(textureHandle, IID_PPV_ARGS(&result->Resource12)));
+		HR_TRY_FAST(device->OpenSharedHandle(fenceHandle, IID_PPV_ARGS(&result->Fence)));
+
+		const D3D12_RESOURCE_DESC desc = result->Resource12->GetDesc();
+		ASSERT_RETURN(desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE2D)
+			->WithMessage(TEXT_"The shared resource is not a 2D texture");
+		result->Size = { static_cast<uint32>(desc.Width), desc.Height, desc.Format };
+
+		auto ownTextureHandle = DuplicateOwnHandle(textureHandle);
+		if (ownTextureHandle.HasError()) return ownTextureHandle.GetErrorRef();
+		result->TextureHandle = FScopedHandle(ownTextureHandle.GetValue());
+
+		auto ownFenceHandle = DuplicateOwnHandle(fenceHandle);
+		if (ownFenceHandle.HasError()) return ownFenceHandle.GetErrorRef();
+		result->FenceHandle = FScopedHandle(ownFenceHandle.GetValue());
+
+		if (auto wrapped = result->WrapRhiTexture(desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET); wrapped.HasError())
+			return wrapped.GetErrorRef();
+		return result;
+	}
+
+	TMaybe<TSharedRef<FSharedTexture>> FSharedTexture::Open11(HANDLE textureHandle)
+	{
+		TComPtr<ID3D11Device1> device;
+		if (auto cast = ComCast(GetID3D11DynamicRHI()->RHIGetDevice(), device); cast.HasError())
+			return cast.GetErrorRef();
+
+		auto result = MakeShared<FSharedTexture>();
+		HR_TRY_FAST(device->OpenSharedResource1(textureHandle, IID_PPV_ARGS(&result->Resource11)));
+
+		if (auto cast = ComCast(result->Resource11, result->KeyedMutex); cast.HasError())
+			return cast.GetErrorRef()
+				->WithMessage(TEXT_"Shared textures on D3D11 need to be created with a keyed mutex");
+
+		D3D11_TEXTURE2D_DESC desc;
+		result->Resource11->GetDesc(&desc);
+		result->Size = { desc.Width, desc.Height, desc.Format };
+
+		auto ownTextureHandle = DuplicateOwnHandle(textureHandle);
+		if (ownTextureHandle.HasError()) return ownTextureHandle.GetErrorRef();
+		result->TextureHandle = FScopedHandle(ownTextureHandle.GetValue());
+
+		if (auto wrapped = result->WrapRhiTexture(desc.BindFlags & D3D11_BIND_RENDER_TARGET); wrapped.HasError())
+			return wrapped.GetErrorRef();
+		return result;
+	}
+
+	FCanFail FSharedTexture::WrapRhiTexture(bool renderTargetable)
+	{
+		const EPixelFormat format = ConvertFormat<EPixelFormat>(Size.Format);
+		ASSERT_RETURN(format != PF_Unknown)
+			->WithMessageF(TEXT_"DXGI format {0} of the shared texture has no Unreal equivalent", static_cast<int32>(Size.Format));
+
+		ETextureCreateFlags flags = TexCreate_ShaderResource;
+		if (renderTargetable) flags |= TexCreate_RenderTargetable;
+
+		RhiTexture = Resource12
+			? GetID3D12DynamicRHI()->RHICreateTexture2DFromResource(format, flags, FClearValueBinding::None, Resource12.Get())
+			: GetID3D11DynamicRHI()->RHICreateTexture2DFromResource(format, flags, FClearValueBinding::None, Resource11.Get());
+
+		ASSERT_RETURN(RhiTexture.IsValid())
+			->WithMessage(TEXT_"The RHI couldn't wrap the shared texture");
+		return Success();
+	}
+
+	void FSharedTexture::BeginAccess(FRHICommandListImmediate& cmdList, uint64 keyOrValue, uint32 timeoutMilliseconds)
+	{
+		check(IsInRenderingThread());
+		if (Fence)
+		{
+			GetID3D12DynamicRHI()->RHIWaitManualFence(cmdList, Fence.Get(), keyOrValue);
+			return;
+		}
+		cmdList.EnqueueLambda([self = AsShared(), keyOrValue, timeoutMilliseconds](FRHICommandListImmediate&)
+		{
+			// AcquireSync returns WAIT_TIMEOUT or WAIT_ABANDONED as success codes
+			const HRESULT result = self->KeyedMutex->AcquireSync(keyOrValue, timeoutMilliseconds);
+			if (result != S_OK)
+				IError::Make(new FHresultError(result))
+					->WithMessageF(TEXT_"Couldn't acquire the keyed mutex of a shared texture with key {0}", keyOrValue)
+					->Report();
+		});
+	}
+
+	void FSharedTexture::EndAccess(FRHICommandListImmediate& cmdList, uint64 keyOrValue)
+	{
+		check(IsInRenderingThread());
+		if (Fence)
+		{
+			GetID3D12DynamicRHI()->RHISignalManualFence(cmdList, Fence.Get(), keyOrValue);
+			return;
+		}
+		cmdList.EnqueueLambda([self = AsShared(), keyOrValue](FRHICommandListImmediate&)
+		{
+			const HRESULT result = self->KeyedMutex->ReleaseSync(keyOrValue);
+			if (result != S_OK)
+				IError::Make(new FHresultError(result))
+					->WithMessageF(TEXT_"Couldn't release the keyed mutex of a shared texture with key {0}", keyOrValue)
+					->Report();
+		});
+	}
+}
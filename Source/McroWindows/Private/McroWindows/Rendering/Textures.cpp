@@ -10,6 +10,7 @@
  */
 
 #include "McroWindows/Rendering/Textures.h"
+#include "RHIGlobals.h"
 
 namespace Mcro::Rendering::Textures
 {
@@ -18,24 +19,52 @@ namespace Mcro::Rendering::Textures
 		return static_cast<DXGI_FORMAT>(GPixelFormats[from].PlatformFormat);
 	}
 
-	template <> EPixelFormat ConvertFormat<EPixelFormat, DXGI_FORMAT>(DXGI_FORMAT from)
+	namespace
 	{
-		static TMap<DXGI_FORMAT, EPixelFormat> formatCache;
-		if (EPixelFormat* result = formatCache.Find(from))
-			return *result;
+		// DXGI_FORMAT values in use are all below this
+		constexpr int32 GDxgiFormatTableSize = 256;
 
-		for (int32 i = 0; i < PF_MAX; ++i)
+		EPixelFormat FindPixelFormat(DXGI_FORMAT from)
 		{
-			const auto& formatDesc = GPixelFormats[i];
-			auto currFormat = static_cast<DXGI_FORMAT>(formatDesc.PlatformFormat);
-			if (currFormat == from)
+			for (int32 i = 0; i < PF_MAX; ++i)
 			{
-				formatCache.Add(currFormat, formatDesc.UnrealFormat);
-				return formatDesc.UnrealFormat;
+				const auto& formatDesc = GPixelFormats[i];
+				if (static_cast<DXGI_FORMAT>(formatDesc.PlatformFormat) == from)
+					return formatDesc.UnrealFormat;
 			}
+			return PF_Unknown;
 		}
 
-		return PF_Unknown;
+		struct FPixelFormatFromDxgiTable
+		{
+			FPixelFormatFromDxgiTable()
+			{
+				for (EPixelFormat& format : Formats)
+					format = PF_Unknown;
+
+				// Iterating forward so the first matching pixel format wins, the same as FindPixelFormat
+				for (int32 i = 0; i < PF_MAX; ++i)
+				{
+					const auto& formatDesc = GPixelFormats[i];
+					const uint32 platformFormat = formatDesc.PlatformFormat;
+					if (platformFormat < GDxgiFormatTableSize && Formats[platformFormat] == PF_Unknown)
+						Formats[platformFormat] = formatDesc.UnrealFormat;
+				}
+			}
+
+			TStaticArray<EPixelFormat, GDxgiFormatTableSize> Formats;
+		};
+	}
+
+	template <> EPixelFormat ConvertFormat<EPixelFormat, DXGI_FORMAT>(DXGI_FORMAT from)
+	{
+		// Platform formats of GPixelFormats are only filled in when the RHI is initialized
+		if (!GIsRHIInitialized) [[unlikely]]
+			return FindPixelFormat(from);
+
+		static const FPixelFormatFromDxgiTable table;
+		const uint32 index = static_cast<uint32>(from);
+		return index < GDxgiFormatTableSize ? table.Formats[index] : FindPixelFormat(from);
 	}
 
 	template <>
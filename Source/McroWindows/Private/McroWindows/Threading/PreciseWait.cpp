@@ -0,0 +1,176 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroWindows/Threading/PreciseWait.h"
+#include "Mcro/TextMacros.h"
+#include "HAL/IConsoleManager.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include <Windows.h>
+#include "Mcro/LibraryIncludes/End.h"
+
+// Only declared by Windows SDKs since 10.0.17134
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+static TAutoConsoleVariable<int32> CVarPreciseWaitSpinMicroseconds(
+	TEXT_"McroWindows.PreciseWait.SpinMicroseconds", 250,
+	TEXT_"The last part of a precise wait which is spent spinning instead of sleeping on a waitable timer. High"
+	TEXT_" resolution timers usually wake up within this margin, larger values spend more CPU time for accuracy.",
+	ECVF_Default
+);
+
+namespace Mcro::Windows::Threading
+{
+	namespace
+	{
+		/** @brief Windows default system timer resolution (64 Hz), if the current one cannot be queried */
+		constexpr double DefaultTimerResolution = 1.0 / 64.0;
+
+		using FNtQueryTimerResolution = LONG (NTAPI*)(PULONG minimum, PULONG maximum, PULONG current);
+
+		/**
+		 *	@brief
+		 *	Extra spinning when the timer is not high resolution or the wait falls back to regular sleep, as they may
+		 *	wake up later by the current system timer resolution. That is changed by any process calling
+		 *	timeBeginPeriod, so it's queried on every wait.
+		 */
+		double GetLowResolutionSlack()
+		{
+			static const FNtQueryTimerResolution queryTimerResolution = []
+			{
+				HMODULE ntdll = GetModuleHandleW(L"ntdll.dll");
+				return ntdll
+					? reinterpret_cast<FNtQueryTimerResolution>(GetProcAddress(ntdll, "NtQueryTimerResolution"))
+					: nullptr;
+			}();
+
+			// In 100 ns units
+			ULONG minimum, maximum, current;
+			if (queryTimerResolution && queryTimerResolution(&minimum, &maximum, &current) >= 0 && current > 0)
+				return current / 10'000'000.0;
+			return DefaultTimerResolution;
+		}
+
+		HANDLE CreateTimer(bool bHighResolution)
+		{
+			return CreateWaitableTimerExW(
+				nullptr, nullptr,
+				bHighResolution ? CREATE_WAITABLE_TIMER_HIGH_RESOLUTION : 0,
+				TIMER_ALL_ACCESS
+			);
+		}
+
+		struct FThreadTimer
+		{
+			FThreadTimer()
+			{
+				Handle = CreateTimer(true);
+				bHighResolution = Handle != nullptr;
+				if (!Handle) Handle = CreateTimer(false);
+				if (!Handle) CreateErrorCode = static_cast<int32>(GetLastError());
+			}
+
+			~FThreadTimer()
+			{
+				if (Handle) CloseHandle(Handle);
+			}
+
+			HANDLE Handle = nullptr;
+			bool bHighResolution = false;
+			int32 CreateErrorCode = 0;
+		};
+
+		FThreadTimer& GetThreadTimer()
+		{
+			thread_local FThreadTimer timer;
+			return timer;
+		}
+
+		double GetSpinTail()
+		{
+			return FMath::Max(CVarPreciseWaitSpinMicroseconds.GetValueOnAnyThread(), 0) / 1'000'000.0;
+		}
+
+		void SleepUntil(double deadline, double tail)
+		{
+			const double remaining = deadline - FPlatformTime::Seconds() - tail;
+			if (remaining > 0.0)
+				FPlatformProcess::SleepNoStats(static_cast<float>(remaining));
+		}
+
+		FCanFail WaitOnTimer(FThreadTimer const& timer, double deadline, double tail)
+		{
+			const double remaining = deadline - FPlatformTime::Seconds() - tail;
+			if (remaining <= 0.0) return Success();
+
+			// Negative due time is relative, in 100 ns units
+			LARGE_INTEGER dueTime;
+			dueTime.QuadPart = -FMath::Max<LONGLONG>(static_cast<LONGLONG>(remaining * 10'000'000.0), 1);
+			if (!SetWaitableTimerEx(timer.Handle, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+				return IError::Make(new FLastError(static_cast<int32>(GetLastError())))
+					->AsRecoverable()
+					->WithMessage(TEXT_"Couldn't set the waitable timer of a precise wait");
+
+			if (WaitForSingleObject(timer.Handle, INFINITE) != WAIT_OBJECT_0)
+				return IError::Make(new FLastError(static_cast<int32>(GetLastError())))
+					->AsRecoverable()
+					->WithMessage(TEXT_"Couldn't wait on the waitable timer of a precise wait");
+
+			return Success();
+		}
+	}
+
+	FCanFail PreciseWaitUntil(double deadline)
+	{
+		FThreadTimer const& timer = GetThreadTimer();
+		const double spinTail = GetSpinTail();
+
+		FCanFail result = Success();
+		if (timer.Handle)
+		{
+			const double timerTail = timer.bHighResolution ? spinTail : spinTail + GetLowResolutionSlack();
+			result = WaitOnTimer(timer, deadline, timerTail);
+			if (result.HasError())
+				SleepUntil(deadline, spinTail + GetLowResolutionSlack());
+		}
+		else
+		{
+			// Errors are mutable (context may be added by callers), so each failing wait gets its own
+			result = IError::Make(new FLastError(timer.CreateErrorCode))
+				->AsRecoverable()
+				->WithMessage(TEXT_"Couldn't create a waitable timer, precise waits fall back to sleep");
+			SleepUntil(deadline, spinTail + GetLowResolutionSlack());
+		}
+
+		while (FPlatformTime::Seconds() < deadline)
+			YieldProcessor();
+
+		return result;
+	}
+
+	FCanFail PreciseWait(FTimespan const& duration)
+	{
+		return PreciseWaitUntil(FPlatformTime::Seconds() + duration.GetTotalSeconds());
+	}
+
+	bool IsHighResolutionTimerAvailable()
+	{
+		static const bool available = []
+		{
+			HANDLE timer = CreateTimer(true);
+			if (timer) CloseHandle(timer);
+			return timer != nullptr;
+		}();
+		return available;
+	}
+}
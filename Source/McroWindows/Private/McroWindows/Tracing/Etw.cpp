@@ -0,0 +1,150 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#include "McroWindows/Tracing/Etw.h"
+#include "Mcro/TraceHooks.h"
+#include "McroISPC/TaskTrace.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include <Windows.h>
+#include <TraceLoggingProvider.h>
+#include <winmeta.h>
+#include "Mcro/LibraryIncludes/End.h"
+
+#include <atomic>
+
+// Name hashed GUID of "Mcro", so the provider can be enabled as *Mcro
+TRACELOGGING_DEFINE_PROVIDER(
+	GMcroEtwProvider, "Mcro",
+	(0x8038c9d0, 0xdd3f, 0x539a, 0x7b, 0xb9, 0xf6, 0x23, 0xd9, 0x40, 0xf4, 0x42)
+);
+
+namespace Mcro::Windows::Tracing
+{
+	using namespace Mcro::TraceHooks;
+
+	namespace
+	{
+		std::atomic<uint64> GEnabledKeywords { 0 };
+
+		uint64 ToMicroseconds(uint64 startCycles, uint64 endCycles)
+		{
+			return static_cast<uint64>(FPlatformTime::ToSeconds64(endCycles - startCycles) * 1'000'000.0);
+		}
+
+		class FEtwTraceHooks : public ITraceHooks
+		{
+		public:
+			virtual void OnThreadHopEnqueued(int32 targetThread, uint64 hopId) override
+			{
+				TraceLoggingWrite(GMcroEtwProvider, "RunInThreadEnqueue",
+					TraceLoggingKeyword(static_cast<uint64>(EEtwKeyword::Threading)),
+					TraceLoggingUInt64(hopId, "HopId"),
+					TraceLoggingInt32(targetThread, "TargetThread")
+				);
+			}
+
+			virtual void OnThreadHopExecuted(int32 targetThread, uint64 hopId, uint64 startCycles, uint64 endCycles) override
+			{
+				TraceLoggingWrite(GMcroEtwProvider, "RunInThreadExecute",
+					TraceLoggingKeyword(static_cast<uint64>(EEtwKeyword::Threading)),
+					TraceLoggingUInt64(hopId, "HopId"),
+					TraceLoggingInt32(targetThread, "TargetThread"),
+					TraceLoggingUInt64(ToMicroseconds(startCycles, endCycles), "DurationUs")
+				);
+			}
+
+			virtual void OnEventBroadcast(FStringView signature, uint64 startCycles, uint64 endCycles) override
+			{
+				TraceLoggingWrite(GMcroEtwProvider, "EventBroadcast",
+					TraceLoggingKeyword(static_cast<uint64>(EEtwKeyword::Events)),
+					TraceLoggingCountedWideString(signature.GetData(), static_cast<USHORT>(signature.Len()), "Signature"),
+					TraceLoggingUInt64(ToMicroseconds(startCycles, endCycles), "DurationUs")
+				);
+			}
+
+			virtual void OnErrorMade(FStringView typeName) override
+			{
+				TraceLoggingWrite(GMcroEtwProvider, "ErrorMade",
+					TraceLoggingKeyword(static_cast<uint64>(EEtwKeyword::Errors)),
+					TraceLoggingCountedWideString(typeName.GetData(), static_cast<USHORT>(typeName.Len()), "Type")
+				);
+			}
+		};
+
+		FEtwTraceHooks GEtwTraceHooks;
+
+		void OnIspcLaunch(const TCHAR* name, const void* taskFunction, int countx, int county, int countz)
+		{
+			TraceLoggingWrite(GMcroEtwProvider, "IspcLaunch",
+				TraceLoggingKeyword(static_cast<uint64>(EEtwKeyword::Ispc)),
+				TraceLoggingWideString(name ? name : L"", "Name"),
+				TraceLoggingPointer(taskFunction, "TaskFunction"),
+				TraceLoggingInt32(countx, "CountX"),
+				TraceLoggingInt32(county, "CountY"),
+				TraceLoggingInt32(countz, "CountZ")
+			);
+		}
+
+		/** @brief Only observe what at least one session listens to, so disabled keywords cost nothing in MCRO */
+		void UpdateHooks(uint64 keywords)
+		{
+			GEnabledKeywords.store(keywords, std::memory_order_relaxed);
+
+			ETraceHook hooks = ETraceHook::None;
+			if (keywords & static_cast<uint64>(EEtwKeyword::Threading)) hooks |= ETraceHook::Threading;
+			if (keywords & static_cast<uint64>(EEtwKeyword::Events))    hooks |= ETraceHook::Events;
+			if (keywords & static_cast<uint64>(EEtwKeyword::Errors))    hooks |= ETraceHook::Errors;
+			SetEnabledTraceHooks(hooks);
+
+			Mcro::ISPC::SetLaunchObserver(
+				keywords & static_cast<uint64>(EEtwKeyword::Ispc) ? &OnIspcLaunch : nullptr
+			);
+		}
+
+		void NTAPI OnProviderEnabled(
+			LPCGUID sourceId, ULONG isEnabled, UCHAR level,
+			ULONGLONG matchAnyKeyword, ULONGLONG matchAllKeyword,
+			PEVENT_FILTER_DESCRIPTOR filterData, PVOID context
+		) {
+			switch (isEnabled)
+			{
+			case EVENT_CONTROL_CODE_DISABLE_PROVIDER:
+				UpdateHooks(0);
+				break;
+			case EVENT_CONTROL_CODE_ENABLE_PROVIDER:
+				// A session without keywords receives every event
+				UpdateHooks(matchAnyKeyword ? matchAnyKeyword : ~0ull);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	EEtwKeyword GetEnabledEtwKeywords()
+	{
+		return static_cast<EEtwKeyword>(GEnabledKeywords.load(std::memory_order_relaxed));
+	}
+
+	void Detail::RegisterEtwProvider()
+	{
+		SetTraceHooks(&GEtwTraceHooks);
+		TraceLoggingRegisterEx(GMcroEtwProvider, &OnProviderEnabled, nullptr);
+	}
+
+	void Detail::UnregisterEtwProvider()
+	{
+		UpdateHooks(0);
+		SetTraceHooks(nullptr);
+		TraceLoggingUnregister(GMcroEtwProvider);
+	}
+}
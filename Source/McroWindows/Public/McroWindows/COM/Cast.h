@@ -15,6 +15,7 @@
 #include "McroWindows/Error/WindowsError.h"
 #include "Mcro/TextMacros.h"
 #include "Microsoft/COMPointer.h"
+#include "Misc/ScopeRWLock.h"
 
 namespace Mcro::Windows::COM
 {
@@ -45,7 +46,8 @@ namespace Mcro::Windows::COM
 	TMaybe<TComPtr<To>> ComCast(From* from, bool fastError = false)
 	{
 		TComPtr<To> to;
-		ComCast(from, to, fastError);
+		if (auto result = ComCast(from, to, fastError); result.HasError())
+			return result.GetErrorRef();
 		return MoveTemp(to);
 	}
 	
@@ -54,4 +56,111 @@ namespace Mcro::Windows::COM
 	{
 		return ComCast(from.Get(), fastError);
 	}
+
+	/**
+	 *	@brief
+	 *	Query an interface which the object may legitimately not implement. Unlike ComCast this doesn't allocate an
+	 *	error on failure, it just returns an empty pointer.
+	 */
+	template <typename To, typename From>
+	TComPtr<To> ComProbe(From* from)
+	{
+		TComPtr<To> to;
+		if (from && from->QueryInterface(IID_PPV_ARGS(&to)) == S_OK)
+			return to;
+		return {};
+	}
+
+	/** @copydoc ComProbe */
+	template <typename To, typename From>
+	TComPtr<To> ComProbe(TComPtr<From> const& from)
+	{
+		return ComProbe<To>(from.Get());
+	}
+
+	/**
+	 *	@brief
+	 *	Remember the results of querying interface `To` from objects which are cast repeatedly, like every frame.
+	 *	Failures are remembered as well, so optional interfaces are only queried once per object.
+	 *
+	 *	The cache holds a reference to the objects passed to it, so their address cannot be reused by another object
+	 *	while they're cached. Use Remove or Reset when they should be released. It is safe to use from multiple
+	 *	threads.
+	 */
+	template <typename To>
+	class TComCastCache
+	{
+	public:
+		/** @brief Get the interface of an object or an empty pointer if it doesn't implement it */
+		template <typename From>
+		TComPtr<To> Probe(From* from)
+		{
+			if (!from) return {};
+			IUnknown* key = from;
+			{
+				FReadScopeLock lock(Lock);
+				if (const FEntry* entry = Entries.Find(key))
+					return entry->Result;
+			}
+
+			FEntry entry { key, ComProbe<To>(from) };
+			FWriteScopeLock lock(Lock);
+			return Entries.FindOrAdd(key, MoveTemp(entry)).Result;
+		}
+
+		/** @copydoc Probe */
+		template <typename From>
+		TComPtr<To> Probe(TComPtr<From> const& from)
+		{
+			return Probe(from.Get());
+		}
+
+		/** @brief Get the interface of an object or an error if it doesn't implement it */
+		template <typename From>
+		TMaybe<TComPtr<To>> Cast(From* from)
+		{
+			if (TComPtr<To> result = Probe(from))
+				return result;
+			return IError::Make(new FHresultError(E_NOINTERFACE, true))
+				->AsRecoverable()
+				->WithMessageF(
+					TEXT_"Object of type {0} did not implement {1}",
+					TTypeName<From>,
+					TTypeName<To>
+				);
+		}
+
+		/** @copydoc Cast */
+		template <typename From>
+		TMaybe<TComPtr<To>> Cast(TComPtr<From> const& from)
+		{
+			return Cast(from.Get());
+		}
+
+		/** @brief Forget an object and release the references held to it */
+		template <typename From>
+		void Remove(From* from)
+		{
+			FWriteScopeLock lock(Lock);
+			Entries.Remove(static_cast<IUnknown*>(from));
+		}
+
+		/** @brief Forget all objects and release the references held to them */
+		void Reset()
+		{
+			FWriteScopeLock lock(Lock);
+			Entries.Empty();
+		}
+
+	private:
+		struct FEntry
+		{
+			/** @brief Keeps the object alive so its address is not reused while it's a key */
+			TComPtr<IUnknown> Source;
+			TComPtr<To> Result;
+		};
+
+		FRWLock Lock;
+		TMap<IUnknown*, FEntry> Entries;
+	};
 }
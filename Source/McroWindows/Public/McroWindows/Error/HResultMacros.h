@@ -30,7 +30,7 @@
 	if (UNLIKELY(tempVar != S_OK))                                                                      \
 		return Mcro::Error::IError::Make(new Mcro::Windows::Error::FHresultError(tempVar, noErrorInfo)) \
 			->WithLocation()                                                                            \
-			->AsRecoverable                                                                             \
+			->AsRecoverable()                                                                           \
 			->WithCodeContext(PREPROCESSOR_TO_TEXT(expression))                                        //
 
 /** @brief Use this macro in a function which returns an `Mcro::Error::TMaybe`. */
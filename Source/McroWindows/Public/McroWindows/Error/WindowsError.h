@@ -18,7 +18,12 @@ namespace Mcro::Windows::Error
 {
 	using namespace Mcro::Error;
 
-	/** @brief An error wrapping the returned code of GetLastError and attempts to get a string description of it */
+	/**
+	 *	@brief
+	 *	An error wrapping the returned code of GetLastError and attempts to get a string description of it. Only the
+	 *	code is stored on construction, the description and the appendices are resolved when the error is first
+	 *	displayed or serialized. Descriptions are cached process-wide per error code.
+	 */
 	MCROWINDOWS_API class FLastError : public IError
 	{
 	public:
@@ -26,14 +31,26 @@ namespace Mcro::Windows::Error
 
 		/** @brief The result code wrapped by this error */
 		int32 ErrorCode;
-		
+
+		/**
+		 *	@brief
+		 *	The message what the Windows API communicates to us. It's only filled when the error is resolved, prefer
+		 *	`GetSystemMessage` which resolves it first.
+		 */
+		mutable FString SystemMessage;
+
 		/** @brief The message what the Windows API communicates to us */
-		FString SystemMessage;
+		FString const& GetSystemMessage() const { ResolveTexts(); return SystemMessage; }
+
+	protected:
+		virtual void ResolveDeferredTexts() const override;
 	};
 
 	/**
 	 *	@brief
 	 *	An error wrapping HRESULT code returned by many Microsoft APIs. It will also collect human readable metadata.
+	 *	Only the code is stored on construction, the metadata and the appendices are resolved when the error is first
+	 *	displayed or serialized. Messages are cached process-wide per HRESULT.
 	 */
 	MCROWINDOWS_API class FHresultError : public  IError
 	{
@@ -48,21 +65,48 @@ namespace Mcro::Windows::Error
 		 */
 		FHresultError(HRESULT result, bool fastMode = false);
 
+		/** @brief Gather human readable information when the error is resolved, even if it was made in fast mode */
 		void SetHumanReadable();
 
 		/** @brief The result code wrapped by this error */
 		HRESULT Result;
 
+		/**
+		 *	@brief
+		 *	The message what the Windows API communicates to us. It's only filled when the error is resolved, prefer
+		 *	`GetSystemMessage` which resolves it first.
+		 */
+		mutable FString SystemMessage;
+
+		/**
+		 *	@brief
+		 *	Stores the language-dependent programmatic ID (ProgID) for the class or application that raised the error.
+		 *	It's only filled when the error is resolved, prefer `GetProgramID` which resolves it first.
+		 */
+		mutable FString ProgramID;
+
+		/**
+		 *	@brief
+		 *	A textual description of the error (might be different from Message). It's only filled when the error is
+		 *	resolved, prefer `GetDescription` which resolves it first.
+		 */
+		mutable FString Description;
+
 		/** @brief The message what the Windows API communicates to us */
-		FString SystemMessage;
+		FString const& GetSystemMessage() const { ResolveTexts(); return SystemMessage; }
 
 		/**
 		 *	@brief
 		 *	Stores the language-dependent programmatic ID (ProgID) for the class or application that raised the error.
 		 */
-		FString ProgramID;
+		FString const& GetProgramID() const { ResolveTexts(); return ProgramID; }
 
 		/** @brief A textual description of the error (might be different from Message) */
-		FString Description;
+		FString const& GetDescription() const { ResolveTexts(); return Description; }
+
+	protected:
+		virtual void ResolveDeferredTexts() const override;
+
+		bool bFastMode;
 	};
 }
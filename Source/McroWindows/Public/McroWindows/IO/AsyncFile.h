@@ -0,0 +1,194 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "McroWindows/Error/WindowsError.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include <Windows.h>
+#include "Mcro/LibraryIncludes/End.h"
+
+/**
+ *	@file
+ *	Overlapped file I/O completed through an I/O completion port, so many reads and writes can be in flight at once
+ *	from any thread. Files are opened unbuffered by default, bypassing the system file cache, which requires offsets,
+ *	sizes and memory to be aligned to the sector size of the volume. Buffers of an FAlignedBufferPool satisfy the
+ *	memory alignment.
+ *
+ *	@code
+ *	auto file = FAsyncFile::Open(TEXT_"D:/Captures/Take01.bin");
+ *	if (file.HasError()) return file.GetErrorRef();
+ *	FAlignedBuffer buffer = FAlignedBufferPool::Get()->Acquire(64 * 1024 * 1024);
+ *	file.GetValue()->Read(0, buffer.GetView()).Then([](TFuture<TMaybe<int64>> bytesRead) { ... });
+ *	@endcode
+ */
+namespace Mcro::Windows::IO
+{
+	using namespace Mcro::Error;
+	using namespace Mcro::Windows::Error;
+
+	class FAlignedBufferPool;
+
+	/** @brief A page aligned memory block from an FAlignedBufferPool, given back to the pool on destruction */
+	class MCROWINDOWS_API FAlignedBuffer
+	{
+	public:
+		FAlignedBuffer() = default;
+		FAlignedBuffer(FAlignedBuffer&& other) noexcept;
+		FAlignedBuffer& operator = (FAlignedBuffer&& other) noexcept;
+		~FAlignedBuffer();
+
+		uint8* GetData() const { return Data; }
+		int64 Num() const { return Size; }
+		TArrayView64<uint8> GetView() const { return TArrayView64<uint8>(Data, Size); }
+
+		explicit operator bool() const { return Data != nullptr; }
+
+	private:
+		friend class FAlignedBufferPool;
+
+		TSharedPtr<FAlignedBufferPool> Pool;
+		uint8* Data = nullptr;
+		int64 Size = 0;
+		int32 SizeClass = INDEX_NONE;
+	};
+
+	/**
+	 *	@brief
+	 *	Recycles page aligned buffers suitable for unbuffered I/O. Requested sizes are rounded up to powers of two
+	 *	(of at least one page), and given back buffers are kept for reuse until the pool holds `maxPooledBytes`.
+	 *	It is safe to use from multiple threads.
+	 */
+	class MCROWINDOWS_API FAlignedBufferPool : public TSharedFromThis<FAlignedBufferPool>
+	{
+	public:
+		FAlignedBufferPool(int64 maxPooledBytes = 256 * 1024 * 1024);
+		~FAlignedBufferPool();
+
+		FAlignedBufferPool(FAlignedBufferPool const&) = delete;
+		FAlignedBufferPool& operator = (FAlignedBufferPool const&) = delete;
+
+		/** @brief A pool shared by everyone in the process */
+		static TSharedRef<FAlignedBufferPool> Get();
+
+		/** @brief Get a buffer of at least `size` bytes */
+		FAlignedBuffer Acquire(int64 size);
+
+		/** @brief Memory of the buffers waiting in the pool */
+		int64 GetPooledBytes() const;
+
+	private:
+		friend class FAlignedBuffer;
+
+		void Release(uint8* data, int32 sizeClass);
+
+		mutable FCriticalSection Lock;
+		TArray<TArray<uint8*>> Free;
+		int64 PooledBytes = 0;
+		int64 MaxPooledBytes;
+	};
+
+	enum class EAsyncFileAccess : uint8
+	{
+		Read,
+
+		/** @brief Create the file, or truncate it if it already exists */
+		Write,
+
+		/** @brief Open the file for both reading and writing, creating it if it doesn't exist */
+		ReadWrite
+	};
+
+	struct FAsyncFileOptions
+	{
+		EAsyncFileAccess Access = EAsyncFileAccess::Read;
+
+		/**
+		 *	@brief
+		 *	Bypass the system file cache (FILE_FLAG_NO_BUFFERING). Offsets, sizes and memory of each request must then
+		 *	be aligned to the sector size of the volume.
+		 */
+		bool bUnbuffered = true;
+
+		/** @brief Write through the disk cache (FILE_FLAG_WRITE_THROUGH) */
+		bool bWriteThrough = false;
+
+		/**
+		 *	@brief
+		 *	Requests larger than this are split into multiple overlapped operations issued at once. It's rounded up to
+		 *	the sector size, and clamped to the largest size a single ReadFile or WriteFile call can take.
+		 */
+		int64 MaxRequestBytes = 16 * 1024 * 1024;
+	};
+
+	/**
+	 *	@brief
+	 *	A file read and written with overlapped I/O. Each read or write returns a future fulfilled on one of the
+	 *	completion port threads with the number of transferred bytes, or an FLastError. Keep the memory of a request
+	 *	alive until its future is fulfilled. The file is kept open while it has requests in flight.
+	 */
+	class MCROWINDOWS_API FAsyncFile : public TSharedFromThis<FAsyncFile>
+	{
+	public:
+		using FResult = TMaybe<int64>;
+
+		static TMaybe<TSharedRef<FAsyncFile>> Open(FString const& path, FAsyncFileOptions const& options = {});
+
+		FAsyncFile(FAsyncFile const&) = delete;
+		FAsyncFile& operator = (FAsyncFile const&) = delete;
+		~FAsyncFile();
+
+		/** @brief Read into `destination` from `offset`, reads at the end of the file transfer fewer bytes */
+		TFuture<FResult> Read(int64 offset, TArrayView64<uint8> destination);
+
+		/** @brief Write `source` at `offset` */
+		TFuture<FResult> Write(int64 offset, TArrayView64<const uint8> source);
+
+		/**
+		 *	@brief
+		 *	Read consecutive pages of the file into separate memory pages in a single operation (ReadFileScatter).
+		 *	Each page must be page aligned and exactly one system page large, the file must be unbuffered.
+		 */
+		TFuture<FResult> ReadScatter(int64 offset, TConstArrayView<uint8*> pages);
+
+		/** @brief Write separate memory pages into consecutive pages of the file (WriteFileGather), see ReadScatter */
+		TFuture<FResult> WriteGather(int64 offset, TConstArrayView<uint8*> pages);
+
+		/** @brief Set the size of the file, use it to trim the padding of the last sector after unbuffered writes */
+		FCanFail SetSize(int64 size);
+
+		TMaybe<int64> GetSize() const;
+
+		/** @brief Offsets, sizes and memory of unbuffered requests must be aligned to this */
+		uint32 GetSectorSize() const { return SectorSize; }
+
+		bool IsUnbuffered() const { return bUnbuffered; }
+
+		FString const& GetPath() const { return Path; }
+
+		/** @brief Use Open instead, this takes ownership of an already opened overlapped file handle */
+		FAsyncFile(HANDLE handle, FString const& path, FAsyncFileOptions const& options, uint32 sectorSize);
+
+	private:
+		HANDLE Handle;
+		FString Path;
+		int64 MaxRequestBytes;
+		uint32 SectorSize;
+		bool bUnbuffered;
+
+		FCanFail CheckAlignment(int64 offset, int64 size, const void* data) const;
+		TFuture<FResult> Transfer(int64 offset, uint8* data, int64 size, bool write);
+		TFuture<FResult> TransferPages(int64 offset, TConstArrayView<uint8*> pages, bool write);
+	};
+}
@@ -0,0 +1,219 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "McroWindows/Error/WindowsError.h"
+
+#include <atomic>
+
+/**
+ *	@file
+ *	Memory backed by large (usually 2 MB) pages, reducing TLB misses of big flat buffers. Large pages need the
+ *	"Lock pages in memory" user right (SeLockMemoryPrivilege), they are never paged out and they may not be available
+ *	when physical memory is fragmented. Every allocation here falls back to regular pages when large pages cannot be
+ *	acquired, the reason is available as an FLastError.
+ *
+ *	To make the ISPC frame arena live on large pages:
+ *	@code
+ *	Mcro::ISPC::SetFrameArenaMemory({ &Mcro::Windows::Memory::AllocateLargePages, &Mcro::Windows::Memory::FreeLargePages });
+ *	@endcode
+ */
+namespace Mcro::Windows::Memory
+{
+	using namespace Mcro::Error;
+	using namespace Mcro::Windows::Error;
+
+	/**
+	 *	@brief
+	 *	Enable SeLockMemoryPrivilege for the current process. This is only attempted once, subsequent calls report the
+	 *	outcome of the first attempt, with a new error for each call.
+	 */
+	MCROWINDOWS_API FCanFail EnableLargePagePrivilege();
+
+	/** @returns The size of a large page, or 0 if the system doesn't support them */
+	MCROWINDOWS_API uint64 GetLargePageSize();
+
+	/**
+	 *	@brief
+	 *	Commit memory on large pages, or on regular pages if that's not possible. The size is rounded up to the large
+	 *	page size. The signature matches `Mcro::ISPC::FFrameArenaMemory`.
+	 *	
+	 *	@return  nullptr if even regular pages couldn't be committed
+	 */
+	MCROWINDOWS_API void* AllocateLargePages(uint64 size);
+
+	/** @brief Release memory acquired from AllocateLargePages */
+	MCROWINDOWS_API void FreeLargePages(void* memory, uint64 size);
+
+	/**
+	 *	@brief
+	 *	A thread safe bump allocator over a single large page backed block committed up front. Memory is reclaimed only
+	 *	when the most recent allocation is freed, or when the whole arena is reset, so it's meant for long lived flat
+	 *	buffers which are sized once.
+	 */
+	class MCROWINDOWS_API FLargePageArena
+	{
+	public:
+		/**
+		 *	@param capacity        Size of the arena, rounded up to the large page size
+		 *	@param bAllowFallback  Use regular pages when large pages are not available, instead of failing
+		 */
+		static TMaybe<TSharedRef<FLargePageArena>> Create(uint64 capacity, bool bAllowFallback = true);
+
+		/**
+		 *	@brief
+		 *	The arena used by FLargePageAllocator. It's empty by default, in which case containers using that allocator
+		 *	take their memory from the regular heap. Containers keep the arena they allocated from alive.
+		 */
+		static TSharedPtr<FLargePageArena> GetDefault();
+		static void SetDefault(TSharedPtr<FLargePageArena> const& arena);
+
+		FLargePageArena(uint8* memory, uint64 capacity, IErrorPtr const& fallbackReason);
+		~FLargePageArena();
+
+		FLargePageArena(FLargePageArena const&) = delete;
+		FLargePageArena& operator = (FLargePageArena const&) = delete;
+
+		/** @returns Memory from the arena, or nullptr if it's exhausted */
+		void* Allocate(uint64 size, uint32 alignment = PLATFORM_CACHE_LINE_SIZE);
+
+		/** @brief Grow or shrink an allocation in place, this only succeeds for the most recent allocation */
+		bool Resize(void* memory, uint64 size, uint64 newSize);
+
+		/** @brief Give back an allocation, its memory is reused only if it was the most recent allocation */
+		void Free(void* memory, uint64 size);
+
+		/** @brief Rewind the arena, everything allocated from it is invalid afterwards */
+		void Reset();
+
+		bool Owns(const void* memory) const { return memory >= Memory && memory < Memory + Capacity; }
+
+		uint64 GetCapacity() const { return Capacity; }
+		uint64 GetUsed() const { return Offset.load(std::memory_order_relaxed); }
+
+		bool UsesLargePages() const { return !FallbackReason.IsValid(); }
+
+		/** @returns Why the arena had to fall back to regular pages, or null if it uses large pages */
+		IErrorPtr GetFallbackReason() const { return FallbackReason; }
+
+	private:
+		uint8* Memory;
+		uint64 Capacity;
+		std::atomic<uint64> Offset { 0 };
+		IErrorPtr FallbackReason;
+	};
+
+	/**
+	 *	@brief
+	 *	Container allocator taking memory from the default FLargePageArena, falling back to the regular heap when there's
+	 *	no default arena or it's exhausted. Follows the structure of `Mcro::Ansi::FAllocator`.
+	 */
+	class MCROWINDOWS_API FLargePageAllocator
+	{
+	public:
+		using SizeType = int32;
+
+		enum { NeedsElementType = false };
+		enum { RequireRangeCheck = true };
+
+		typedef FLargePageAllocator ElementAllocator;
+		typedef FLargePageAllocator BitArrayAllocator;
+
+		class MCROWINDOWS_API ForAnyElementType
+		{
+		public:
+			ForAnyElementType() {}
+
+			/**
+			 *	@brief  Moves the state of another allocator into this one.
+			 *	
+			 *	Assumes that the allocator is currently empty, i.e. memory may be allocated but any existing elements
+			 *	have already been destructed (if necessary).
+			 *	
+			 *	@param other  The allocator to move the state from.  This allocator should be left in a valid empty state.
+			 */
+			void MoveToEmpty(ForAnyElementType& other);
+
+			/** Destructor. */
+			~ForAnyElementType();
+
+			// FContainerAllocatorInterface
+			FORCEINLINE FScriptContainerElement* GetAllocation() const
+			{
+				return Data;
+			}
+			void ResizeAllocation(SizeType currentNum, SizeType newMax, SIZE_T numBytesPerElement);
+			SizeType CalculateSlackReserve(SizeType newMax, SIZE_T numBytesPerElement) const
+			{
+				return DefaultCalculateSlackReserve(newMax, numBytesPerElement, false);
+			}
+			SizeType CalculateSlackShrink(SizeType newMax, SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return DefaultCalculateSlackShrink(newMax, currentMax, numBytesPerElement, false);
+			}
+			SizeType CalculateSlackGrow(SizeType newMax, SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return DefaultCalculateSlackGrow(newMax, currentMax, numBytesPerElement, false);
+			}
+
+			SIZE_T GetAllocatedSize(SizeType currentMax, SIZE_T numBytesPerElement) const
+			{
+				return currentMax * numBytesPerElement;
+			}
+
+			bool HasAllocation() const
+			{
+				return !!Data;
+			}
+
+			SizeType GetInitialCapacity() const
+			{
+				return 0;
+			}
+
+		private:
+			ForAnyElementType(const ForAnyElementType&) = delete;
+			ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+			void FreeAllocation();
+
+			/** A pointer to the container's elements. */
+			FScriptContainerElement* Data = nullptr;
+
+			/** Size of the allocation in bytes, needed for resizing within the arena */
+			SIZE_T AllocatedBytes = 0;
+
+			/** The arena owning Data, or null if Data is on the heap */
+			TSharedPtr<FLargePageArena> Arena;
+		};
+
+		template<typename ElementType>
+		class ForElementType : public ForAnyElementType
+		{
+		public:
+
+			/** Default constructor. */
+			ForElementType()
+			{}
+
+			FORCEINLINE ElementType* GetAllocation() const
+			{
+				return (ElementType*)ForAnyElementType::GetAllocation();
+			}
+		};
+	};
+}
+
+/** @brief TArray alias which allocates from the default large page arena */
+template <typename T>
+using TLargePageArray = TArray<T, Mcro::Windows::Memory::FLargePageAllocator>;
@@ -0,0 +1,120 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RHIResources.h"
+#include "Mcro/Error.h"
+#include "McroWindows/Rendering/Textures.h"
+#include "Microsoft/COMPointer.h"
+
+#include "Mcro/LibraryIncludes/Start.h"
+#include <d3d11_1.h>
+#include <d3d12.h>
+#include "Mcro/LibraryIncludes/End.h"
+
+namespace Mcro::Windows::Rendering::Textures
+{
+	using namespace Mcro::Error;
+
+	/** @brief Owner of a Windows NT handle, closing it on destruction */
+	class MCROWINDOWS_API FScopedHandle
+	{
+	public:
+		FScopedHandle() = default;
+		explicit FScopedHandle(HANDLE handle) : Handle(handle) {}
+		~FScopedHandle();
+
+		FScopedHandle(FScopedHandle const&) = delete;
+		FScopedHandle& operator = (FScopedHandle const&) = delete;
+		FScopedHandle(FScopedHandle&& other) noexcept : Handle(other.Release()) {}
+		FScopedHandle& operator = (FScopedHandle&& other) noexcept;
+
+		HANDLE Get() const { return Handle; }
+
+		/** @brief Give up ownership of the handle without closing it */
+		HANDLE Release() { return Exchange(Handle, nullptr); }
+
+		explicit operator bool() const { return Handle != nullptr; }
+
+	private:
+		HANDLE Handle = nullptr;
+	};
+
+	/**
+	 *	@brief
+	 *	A texture shared via NT handles between the D3D11 or D3D12 device of Unreal and other devices or processes,
+	 *	without copying the pixels through the CPU.
+	 *
+	 *	Access of the texture is synchronized differently on the two RHIs:
+	 *	- D3D12: with a shared fence. `BeginAccess(value)` makes Unreal's GPU queue wait until the fence reaches the
+	 *	  value, `EndAccess(value)` signals the value after the commands touching the texture so far.
+	 *	- D3D11: with the keyed mutex of the texture. `BeginAccess(key)` acquires and `EndAccess(key)` releases it.
+	 *
+	 *	BeginAccess and EndAccess are recorded into a render thread command list, so they're ordered with the
+	 *	rendering commands using the texture. The other party needs to follow the same protocol with the same
+	 *	handles. Errors during synchronization on the RHI thread are reported but cannot be returned.
+	 */
+	class MCROWINDOWS_API FSharedTexture : public TSharedFromThis<FSharedTexture>
+	{
+	public:
+		/** @brief Create a new texture on Unreal's device which can be opened by others via the exported handles */
+		static TMaybe<TSharedRef<FSharedTexture>> Create(FDXGITextureSize const& size, const TCHAR* debugName = nullptr);
+
+		/**
+		 *	@brief
+		 *	Open a texture created by another device or process on Unreal's device. The given handles are duplicated,
+		 *	the caller stays responsible for closing them.
+		 *
+		 *	@param  textureHandle  An NT handle of a shared texture
+		 *	@param    fenceHandle  An NT handle of a shared fence, required only on D3D12
+		 */
+		static TMaybe<TSharedRef<FSharedTexture>> Open(HANDLE textureHandle, HANDLE fenceHandle = nullptr);
+
+		/** @brief The texture as Unreal sees it */
+		FTextureRHIRef const& GetRhiTexture() const { return RhiTexture; }
+
+		/** @brief The NT handle other devices or processes can open the texture with */
+		HANDLE GetTextureHandle() const { return TextureHandle.Get(); }
+
+		/** @brief The NT handle of the shared fence synchronizing the texture, nullptr on D3D11 */
+		HANDLE GetFenceHandle() const { return FenceHandle.Get(); }
+
+		FDXGITextureSize const& GetSize() const { return Size; }
+
+		/** @brief Wait for the other party until Unreal may use the texture, on the render thread */
+		void BeginAccess(FRHICommandListImmediate& cmdList, uint64 keyOrValue, uint32 timeoutMilliseconds = INFINITE);
+
+		/** @brief Let the other party use the texture after Unreal's commands so far, on the render thread */
+		void EndAccess(FRHICommandListImmediate& cmdList, uint64 keyOrValue);
+
+	private:
+		FTextureRHIRef RhiTexture;
+		FScopedHandle TextureHandle;
+		FScopedHandle FenceHandle;
+		FDXGITextureSize Size;
+
+		/** @brief D3D12 only */
+		TComPtr<ID3D12Resource> Resource12;
+		TComPtr<ID3D12Fence> Fence;
+
+		/** @brief D3D11 only */
+		TComPtr<ID3D11Texture2D> Resource11;
+		TComPtr<IDXGIKeyedMutex> KeyedMutex;
+
+		static TMaybe<TSharedRef<FSharedTexture>> Create12(FDXGITextureSize const& size, const TCHAR* debugName);
+		static TMaybe<TSharedRef<FSharedTexture>> Create11(FDXGITextureSize const& size, const TCHAR* debugName);
+		static TMaybe<TSharedRef<FSharedTexture>> Open12(HANDLE textureHandle, HANDLE fenceHandle);
+		static TMaybe<TSharedRef<FSharedTexture>> Open11(HANDLE textureHandle);
+		FCanFail WrapRhiTexture(bool renderTargetable);
+	};
+}
@@ -13,6 +13,7 @@
 
 #include "CoreMinimal.h"
 #include "Mcro/Rendering/Textures.h"
+#include "Mcro/Rendering/TexturePool.h"
 
 #include "Mcro/LibraryIncludes/Start.h"
 #include <dxgiformat.h>
@@ -34,4 +35,8 @@ namespace Mcro::Windows::Rendering::Textures
 	using namespace Mcro::Rendering::Textures;
 
 	using FDXGITextureSize = TTextureSize<uint32, DXGI_FORMAT>;
+
+	/** @brief A pool of native texture resources keyed by their size and DXGI format, like `TComPtr<ID3D12Resource>` */
+	template <typename Resource>
+	using TDXGITexturePool = TTexturePool<FDXGITextureSize, Resource>;
 }
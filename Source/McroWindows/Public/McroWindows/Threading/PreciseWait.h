@@ -0,0 +1,49 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "McroWindows/Error/WindowsError.h"
+
+/**
+ *	@file
+ *	Waits with sub-millisecond wake-up accuracy. `FPlatformProcess::Sleep` is only as accurate as the system timer
+ *	resolution (1 ms at best, 15.6 ms by default), so a typical frame pacing loop either overshoots its deadline or
+ *	spins for most of the wait. These functions sleep on a high resolution waitable timer, which is accurate to a few
+ *	hundred microseconds without changing the system timer resolution, and spin only for the short remainder.
+ *
+ *	The length of the spinning tail is set by the `McroWindows.PreciseWait.SpinMicroseconds` console variable.
+ */
+namespace Mcro::Windows::Threading
+{
+	using namespace Mcro::Error;
+	using namespace Mcro::Windows::Error;
+
+	/**
+	 *	@brief
+	 *	Block the calling thread until `FPlatformTime::Seconds()` reaches the given deadline. Each thread uses its own
+	 *	waitable timer, created on the first wait.
+	 *
+	 *	The deadline is kept even when the waitable timer cannot be created or waited on. In that case the wait falls
+	 *	back to `FPlatformProcess::Sleep` spinning for the current system timer resolution, and the reason is returned
+	 *	as an FLastError.
+	 *	
+	 *	@param deadline  Absolute time in the domain of `FPlatformTime::Seconds()`
+	 */
+	MCROWINDOWS_API FCanFail PreciseWaitUntil(double deadline);
+
+	/** @brief Block the calling thread for the given duration. See `PreciseWaitUntil` */
+	MCROWINDOWS_API FCanFail PreciseWait(FTimespan const& duration);
+
+	/** @returns Whether the waitable timers of this system support high resolution (Windows 10 1803 or later) */
+	MCROWINDOWS_API bool IsHighResolutionTimerAvailable();
+}
@@ -0,0 +1,60 @@
+/** @noop License Comment
+ *  @file
+ *  @copyright
+ *  This Source Code is subject to the terms of the Mozilla Public License, v2.0.
+ *  If a copy of the MPL was not distributed with this file You can obtain one at
+ *  https://mozilla.org/MPL/2.0/
+ *  
+ *  @author David Mórász
+ *  @date 2025
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ *	@file
+ *	A TraceLogging (ETW) provider making MCRO internals visible in system wide traces (WPR / WPA, PerfView).
+ *	
+ *	The provider is named `Mcro`, its GUID is derived from that name as usual with TraceLogging and EventSource
+ *	(`8038c9d0-dd3f-539a-7bb9-f623d940f442`), so it can be enabled with `*Mcro`, for example:
+ *	@code
+ *	xperf -start McroSession -on *Mcro:0xF -f Mcro.etl
+ *	@endcode
+ *	
+ *	Events are filtered by keywords (EEtwKeyword). Nothing is measured or formatted for keywords no session has
+ *	enabled, MCRO pays only for a relaxed atomic load at each observation point.
+ *	
+ *	| Event                | Keyword   | Fields                                            |
+ *	|----------------------|-----------|---------------------------------------------------|
+ *	| `RunInThreadEnqueue` | Threading | HopId, TargetThread                               |
+ *	| `RunInThreadExecute` | Threading | HopId, TargetThread, DurationUs (written at end)  |
+ *	| `EventBroadcast`     | Events    | Signature, DurationUs (written at end)            |
+ *	| `ErrorMade`          | Errors    | Type                                              |
+ *	| `IspcLaunch`         | Ispc      | Name, TaskFunction, CountX, CountY, CountZ        |
+ */
+namespace Mcro::Windows::Tracing
+{
+	enum class EEtwKeyword : uint64
+	{
+		None      = 0,
+		Threading = 0x1,
+		Events    = 0x2,
+		Errors    = 0x4,
+		Ispc      = 0x8,
+	};
+	ENUM_CLASS_FLAGS(EEtwKeyword)
+
+	/** @returns The keywords currently enabled by any ETW session */
+	MCROWINDOWS_API EEtwKeyword GetEnabledEtwKeywords();
+
+	namespace Detail
+	{
+		/** @brief Called on module startup */
+		void RegisterEtwProvider();
+
+		/** @brief Called on module shutdown */
+		void UnregisterEtwProvider();
+	}
+}